@@ -202,14 +202,74 @@ TSIGKeyInfo::toElement() const {
 // *********************** DnsServerInfo  *************************
 DnsServerInfo::DnsServerInfo(const std::string& hostname,
                              isc::asiolink::IOAddress ip_address, uint32_t port,
-                             bool enabled)
+                             bool enabled, size_t max_in_flight,
+                             const dhcp_ddns::NameChangeProtocol& protocol)
     :hostname_(hostname), ip_address_(ip_address), port_(port),
-    enabled_(enabled) {
+    enabled_(enabled), max_in_flight_(max_in_flight), protocol_(protocol),
+    in_flight_(0), stats_() {
 }
 
 DnsServerInfo::~DnsServerInfo() {
 }
 
+void
+DnsServerInfo::updateSent() {
+    ++in_flight_;
+    ++stats_.sent_;
+}
+
+void
+DnsServerInfo::updateCompleted(const UpdateOutcome& outcome,
+                               const uint64_t latency) {
+    if (in_flight_ > 0) {
+        --in_flight_;
+    }
+
+    switch (outcome) {
+    case UPDATE_SUCCESS:
+        ++stats_.succeeded_;
+        break;
+    case UPDATE_REJECTED:
+        ++stats_.rejected_;
+        break;
+    case UPDATE_TIMEOUT:
+        ++stats_.timeouts_;
+        break;
+    default:
+        ++stats_.failed_;
+        break;
+    }
+
+    stats_.total_latency_ += latency;
+    if (latency > stats_.max_latency_) {
+        stats_.max_latency_ = latency;
+    }
+}
+
+void
+DnsServerInfo::updateAbandoned() {
+    if (in_flight_ > 0) {
+        --in_flight_;
+    }
+}
+
+std::string
+DnsServerInfo::statsToText() const {
+    const uint64_t completed = stats_.succeeded_ + stats_.rejected_ +
+        stats_.timeouts_ + stats_.failed_;
+    std::ostringstream stream;
+    stream << "sent: " << stats_.sent_
+           << ", succeeded: " << stats_.succeeded_
+           << ", rejected: " << stats_.rejected_
+           << ", timeouts: " << stats_.timeouts_
+           << ", failed: " << stats_.failed_
+           << ", in flight: " << in_flight_
+           << ", average latency: "
+           << (completed ? stats_.total_latency_ / completed : 0) << " us"
+           << ", maximum latency: " << stats_.max_latency_ << " us";
+    return (stream.str());
+}
+
 std::string
 DnsServerInfo::toText() const {
     std::ostringstream stream;
@@ -228,6 +288,16 @@ DnsServerInfo::toElement() const {
     result->set("ip-address", Element::create(ip_address_.toText()));
     // Set port
     result->set("port", Element::create(static_cast<int64_t>(port_)));
+    // Set max-in-flight only when the limit is configured
+    if (max_in_flight_ > 0) {
+        result->set("max-in-flight",
+                    Element::create(static_cast<int64_t>(max_in_flight_)));
+    }
+    // Set protocol only when it is not the default
+    if (protocol_ != dhcp_ddns::NCR_UDP) {
+        result->set("protocol",
+                    Element::create(dhcp_ddns::ncrProtocolToString(protocol_)));
+    }
 
     return (result);
 }
@@ -480,6 +550,27 @@ DnsServerInfoParser::parse(ConstElementPtr server_config) {
     std::string hostname = getString(server_config, "hostname");
     std::string ip_address = getString(server_config, "ip-address");
     uint32_t port = getInteger(server_config, "port");
+    // The limit of concurrent updates is optional.
+    int64_t max_in_flight = 0;
+    if (server_config->contains("max-in-flight")) {
+        max_in_flight = getInteger(server_config, "max-in-flight");
+        if (max_in_flight < 0) {
+            isc_throw(D2CfgError, "Dns Server : max-in-flight cannot be"
+                      " negative (" << getPosition("max-in-flight",
+                                                   server_config) << ")");
+        }
+    }
+    // The transport protocol is optional too.
+    dhcp_ddns::NameChangeProtocol protocol = dhcp_ddns::NCR_UDP;
+    if (server_config->contains("protocol")) {
+        try {
+            protocol = dhcp_ddns::stringToNcrProtocol(getString(server_config,
+                                                                "protocol"));
+        } catch (const isc::BadValue& ex) {
+            isc_throw(D2CfgError, "Dns Server : " << ex.what() << " ("
+                      << getPosition("protocol", server_config) << ")");
+        }
+    }
     ConstElementPtr user_context = server_config->get("user-context");
 
     // The configuration must specify one or the other.
@@ -511,7 +602,9 @@ DnsServerInfoParser::parse(ConstElementPtr server_config) {
             // Create an IOAddress from the IP address string given and then
             // create the DnsServerInfo.
             isc::asiolink::IOAddress io_addr(ip_address);
-            server_info.reset(new DnsServerInfo(hostname, io_addr, port));
+            server_info.reset(new DnsServerInfo(hostname, io_addr, port,
+                                                true, max_in_flight,
+                                                protocol));
         } catch (const isc::asiolink::IOError& ex) {
             isc_throw(D2CfgError, "Dns Server : invalid IP address : "
                       << ip_address
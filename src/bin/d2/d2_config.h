@@ -412,11 +412,61 @@ typedef boost::shared_ptr<TSIGKeyInfoMap> TSIGKeyInfoMapPtr;
 /// belongs to a list of servers supporting DNS for a given domain. It will
 /// be used to establish communications with the server to carry out DNS
 /// updates.
+///
+/// It also keeps track of the updates currently sent to the server, which
+/// allows for limiting the number of concurrent updates sent to the
+/// server, and of the statistics of the updates sent to the server since
+/// the server has been configured.
 class DnsServerInfo : public isc::dhcp::UserContext, public isc::data::CfgToElement {
 public:
     /// @brief defines DNS standard port value
     static const uint32_t STANDARD_DNS_PORT = 53;
 
+    /// @brief Defines the outcomes of the DNS updates sent to the server.
+    enum UpdateOutcome {
+        /// @brief The server responded with NOERROR.
+        UPDATE_SUCCESS,
+        /// @brief The server responded with an error rcode. Note that
+        /// this includes the failed prerequisites which are the expected
+        /// outcome of some of the steps of the transactions.
+        UPDATE_REJECTED,
+        /// @brief The server did not respond in time.
+        UPDATE_TIMEOUT,
+        /// @brief Any other IO failure, e.g. an invalid response.
+        UPDATE_FAILED
+    };
+
+    /// @brief Statistics of the DNS updates sent to the server.
+    struct Stats {
+        /// @brief Constructor.
+        Stats()
+            : sent_(0), succeeded_(0), rejected_(0), timeouts_(0),
+              failed_(0), total_latency_(0), max_latency_(0) {
+        }
+
+        /// @brief Number of the updates sent.
+        uint64_t sent_;
+
+        /// @brief Number of the updates responded with NOERROR.
+        uint64_t succeeded_;
+
+        /// @brief Number of the updates responded with an error rcode.
+        uint64_t rejected_;
+
+        /// @brief Number of the updates which timed out.
+        uint64_t timeouts_;
+
+        /// @brief Number of the updates which failed for other reasons.
+        uint64_t failed_;
+
+        /// @brief Sum of the latencies of the completed updates in
+        /// microseconds.
+        uint64_t total_latency_;
+
+        /// @brief Maximum latency of the completed updates in microseconds.
+        uint64_t max_latency_;
+    };
+
     /// @brief Constructor
     ///
     /// @param hostname is the resolvable name of the server. If not blank,
@@ -429,10 +479,17 @@ public:
     /// the default.)
     /// @param enabled is a flag that indicates whether this server is
     /// enabled for use. It defaults to true.
+    /// @param max_in_flight is the maximum number of updates concurrently
+    /// sent to the server. It defaults to 0 which means no limit.
+    /// @param protocol is the transport protocol used to send the updates
+    /// to the server. It defaults to UDP.
     DnsServerInfo(const std::string& hostname,
                   isc::asiolink::IOAddress ip_address,
                   uint32_t port = STANDARD_DNS_PORT,
-                  bool enabled=true);
+                  bool enabled=true,
+                  size_t max_in_flight = 0,
+                  const dhcp_ddns::NameChangeProtocol& protocol =
+                  dhcp_ddns::NCR_UDP);
 
     /// @brief Destructor
     virtual ~DnsServerInfo();
@@ -476,6 +533,58 @@ public:
         enabled_ = false;
     }
 
+    /// @brief Returns the transport protocol used to send the updates.
+    ///
+    /// @return the protocol, UDP or TCP.
+    const dhcp_ddns::NameChangeProtocol& getProtocol() const {
+        return (protocol_);
+    }
+
+    /// @brief Returns the maximum number of concurrent updates.
+    ///
+    /// @return the limit or 0 if the number of updates is not limited.
+    size_t getMaxInFlight() const {
+        return (max_in_flight_);
+    }
+
+    /// @brief Returns the number of updates currently sent to the server.
+    size_t getInFlight() const {
+        return (in_flight_);
+    }
+
+    /// @brief Checks if another update may be sent to the server.
+    ///
+    /// @return true if the number of updates currently sent to the server
+    /// is below the limit or there is no limit.
+    bool isAvailable() const {
+        return ((max_in_flight_ == 0) || (in_flight_ < max_in_flight_));
+    }
+
+    /// @brief Records that an update has been sent to the server.
+    void updateSent();
+
+    /// @brief Records the completion of an update sent to the server.
+    ///
+    /// @param outcome the outcome of the update.
+    /// @param latency time between sending the update and its completion
+    /// in microseconds.
+    void updateCompleted(const UpdateOutcome& outcome, const uint64_t latency);
+
+    /// @brief Records that an update sent to the server has been abandoned.
+    ///
+    /// This is used when the transaction is destroyed before the update
+    /// completes. The update is no longer counted as in flight, but it
+    /// doesn't affect the statistics.
+    void updateAbandoned();
+
+    /// @brief Returns the statistics of the updates sent to the server.
+    const Stats& getStats() const {
+        return (stats_);
+    }
+
+    /// @brief Returns a text representation of the server's statistics.
+    std::string statsToText() const;
+
     /// @brief Returns a text representation for the server.
     std::string toText() const;
 
@@ -500,6 +609,19 @@ private:
     /// @param enabled is a flag that indicates whether this server is
     /// enabled for use. It defaults to true.
     bool enabled_;
+
+    /// @brief Maximum number of updates concurrently sent to the server.
+    /// The value of 0 means no limit.
+    size_t max_in_flight_;
+
+    /// @brief Transport protocol used to send the updates to the server.
+    dhcp_ddns::NameChangeProtocol protocol_;
+
+    /// @brief Number of updates currently sent to the server.
+    size_t in_flight_;
+
+    /// @brief Statistics of the updates sent to the server.
+    Stats stats_;
 };
 
 std::ostream&
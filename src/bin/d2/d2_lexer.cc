@@ -465,8 +465,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	(yy_c_buf_p) = yy_cp;
 
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 64
-#define YY_END_OF_BUFFER 65
+#define YY_NUM_RULES 66
+#define YY_END_OF_BUFFER 67
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -474,50 +474,53 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[388] =
+static yyconst flex_int16_t yy_accept[407] =
     {   0,
-       57,   57,    0,    0,    0,    0,    0,    0,    0,    0,
-       65,   63,   10,   11,   63,    1,   57,   54,   57,   57,
-       63,   56,   55,   63,   63,   63,   63,   63,   50,   51,
-       63,   63,   63,   52,   53,    5,    5,    5,   63,   63,
-       63,   10,   11,    0,    0,   46,    0,    0,    0,    0,
+       59,   59,    0,    0,    0,    0,    0,    0,    0,    0,
+       67,   65,   10,   11,   65,    1,   59,   56,   59,   59,
+       65,   58,   57,   65,   65,   65,   65,   65,   52,   53,
+       65,   65,   65,   54,   55,    5,    5,    5,   65,   65,
+       65,   10,   11,    0,    0,   48,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-       57,   57,    0,   56,   57,    3,    2,    6,    0,   57,
+       59,   59,    0,   58,   59,    3,    2,    6,    0,   59,
         0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
-        0,   47,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   49,    0,    0,    0,    0,    0,    0,    0,    0,
 
-       49,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       51,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    2,    0,    0,    0,    0,    0,    0,
-        0,    8,    0,    0,    0,    0,    0,    0,    0,    0,
-       48,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    2,    0,    0,    0,    0,    0,
+        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
+        0,   50,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   62,   60,    0,   59,   58,
-        0,    0,    0,    0,    0,    0,   19,   18,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   64,   62,    0,
+       61,   60,    0,    0,    0,    0,    0,    0,   21,   20,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,   61,   58,    0,    0,    0,    0,    0,    0,
-       20,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   40,    0,    0,
-        0,   14,    0,    0,    0,    0,    0,    0,    0,    0,
-       43,   44,    0,    0,    0,    0,    0,    0,    0,    0,
-       37,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    7,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   63,   60,    0,    0,
+        0,    0,    0,    0,   22,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   39,    0,    0,   36,    0,    0,   32,    0,
-        0,    0,    0,    0,   33,    0,   22,    0,    0,    0,
-
-        0,    0,    0,    0,    0,   34,   38,    0,    0,    0,
-        0,    0,    0,    0,    0,   12,    0,    0,    0,    0,
-        0,    0,   28,    0,   26,    0,    0,    0,    0,   42,
-        0,    0,    0,   30,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   29,    0,    0,    0,   41,    0,
-        0,    0,    0,   13,   17,    0,    0,    0,    0,    0,
-        0,   31,    0,   27,    0,    0,    0,    0,    0,    0,
-       25,    0,   23,   16,    0,   24,   21,   45,    0,    0,
-        0,   35,    0,    0,    0,   15,    0
+        0,    0,   42,    0,    0,    0,   14,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   45,   46,    0,    0,
+        0,    0,    0,    0,    0,    0,   39,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    7,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   41,    0,    0,   38,    0,    0,    0,   34,    0,
+
+        0,    0,    0,    0,   35,    0,   24,    0,    0,    0,
+        0,    0,    0,    0,    0,   36,    0,   40,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   12,    0,    0,
+        0,    0,    0,    0,   30,    0,   28,    0,    0,    0,
+        0,   16,    0,   44,    0,    0,    0,   32,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   31,
+        0,    0,    0,   43,    0,    0,    0,    0,   13,    0,
+       19,    0,    0,    0,    0,    0,    0,   33,    0,   29,
+        0,    0,    0,    0,    0,    0,    0,   27,    0,   25,
+        0,   18,    0,   26,   23,   47,    0,   15,    0,    0,
+
+       37,    0,    0,    0,   17,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -563,103 +566,107 @@ static yyconst flex_int32_t yy_meta[67] =
         3,    3,    3,    3,    3,    3
     } ;
 
-static yyconst flex_int16_t yy_base[399] =
+static yyconst flex_int16_t yy_base[418] =
     {   0,
         0,    0,   65,   68,   71,    0,   69,   73,   54,   70,
-      706,  707,   89,  702,  137,    0,  192,  707,  197,  200,
-       86,  212,  707,  684,   97,   74,   63,   69,  707,  707,
-       83,   68,   78,  707,  707,  707,  124,  690,  649,    0,
-      682,  128,  697,  212,  234,  707,  645,  651,  172,  643,
-      196,  196,  257,  645,  641,  187,  191,  640,  638,  648,
-      637,  650,   91,  630,  634,  643,  642,  209,  210,    0,
-      281,  289,  308,  314,  293,  707,    0,  707,  232,  257,
-      182,  224,  219,  283,  284,  285,  707,  643,  678,  707,
-      294,  707,  330,  630,  640,  291,  635,  296,  301,  674,
-
-        0,  376,  633,  626,  624,  635,  629,  617,  614,  616,
-      614,  659,  606,  622,  605,  614,  609,  606,  607,  602,
-      299,  613,  616,    0,  305,  312,  255,  309,  318,  324,
-      608,  707,    0,  600,  602,  319,  610,  649,  648,  647,
-      707,  408,  598,  599,  593,  590,  604,  636,  589,  584,
-      586,  603,  631,  595,  290,  596,  628,  583,  579,  592,
-      579,  590,  587,  576,  329,  707,  707,  330,  707,  707,
-      572,    0,  574,  337,  623,  580,  707,  707,  440,  571,
-      582,  614,  578,  566,  565,  574,  580,  566,  575,  564,
-      572,  567,  570,  607,  205,  553,  605,  554,  565,  552,
-
-      596,  595,  707,  707,  562,    0,  550,  597,  596,  558,
-      707,  547,  472,  551,  545,  554,  545,  537,  550,  587,
-      536,  551,  547,  549,  532,  523,  530,  707,  531,  528,
-      525,  707,  525,  523,  532,  529,  536,  533,    0,  525,
-      707,  707,  522,  528,  515,  514,  517,  526,  558,  512,
-      707,  524,  514,  509,  512,  506,  518,  555,  504,  505,
-      354,  514,  551,  498,  511,  500,  707,  542,  495,  545,
-      497,  525,  477,  464,  470,  450,  498,  464,  463,  462,
-      499,  498,  707,  451,  444,  707,  447,  489,  707,  436,
-      429,  438,  450,  483,  707,  427,  707,  438,  433,  428,
-
-      431,  431,  467,  415,  465,  707,  707,  430,  415,  413,
-      424,  454,  402,  400,  411,  707,  441,  398,  394,  386,
-      387,  399,  707,  384,  707,  382,  397,  380,  394,  707,
-      430,  391,  384,  707,  374,  420,  368,  346,  362,  408,
-      407,  358,  363,  357,  707,  347,  355,  350,  707,  400,
-      347,  398,  339,  707,  707,  344,  340,  330,  327,  326,
-      376,  707,  333,  707,  374,  373,  325,  371,  370,  364,
-      707,  313,  707,  707,  307,  707,  707,  707,  221,  258,
-      205,  707,  196,  185,  217,  707,  707,  517,  522,  527,
-      532,  537,  542,  545,  216,  130,  115,   87
-
+      725,  726,   89,  721,  137,    0,  192,  726,  197,  200,
+       86,  212,  726,  703,   97,   74,   63,   69,  726,  726,
+       83,   68,   78,  726,  726,  726,  124,  709,  668,    0,
+      701,  128,  716,  212,  234,  726,  664,  670,  172,  662,
+      196,  196,  257,  664,  660,  187,  191,  659,  657,  667,
+      656,  669,   91,  649,  167,  663,  662,  209,  210,    0,
+      281,  289,  308,  314,  293,  726,    0,  726,  232,  257,
+      182,  224,  219,  283,  284,  285,  726,  663,  698,  726,
+      294,  726,  330,  650,  660,  291,  655,  296,  301,  694,
+
+        0,  376,  653,  646,  644,  655,  649,  637,  634,  636,
+      634,  679,  626,  642,  625,  634,  629,  626,  627,  628,
+      621,  299,  632,  635,    0,  305,  312,  255,  309,  318,
+      324,  627,  726,    0,  619,  621,  319,  629,  668,  667,
+      666,  726,  408,  617,  618,  612,  609,  623,  655,  608,
+      603,  605,  622,  650,  614,  336,  615,  647,  602,  598,
+      597,  610,  597,  608,  605,  594,  329,  726,  726,  330,
+      726,  726,  590,    0,  592,  337,  641,  598,  726,  726,
+      440,  589,  600,  632,  596,  584,  583,  592,  598,  584,
+      593,  582,  590,  585,  584,  587,  624,  205,  570,  622,
+
+      573,  570,  581,  568,  612,  611,  726,  726,  578,    0,
+      566,  613,  612,  574,  726,  563,  472,  567,  561,  570,
+      561,  553,  566,  603,  552,  567,  563,  565,  548,  550,
+      538,  545,  726,  546,  543,  540,  726,  555,  539,  537,
+      546,  543,  550,  547,    0,  539,  726,  726,  536,  542,
+      529,  528,  531,  540,  572,  526,  726,  538,  528,  523,
+      526,  520,  565,  531,  568,  517,  518,  364,  517,  526,
+      563,  510,  523,  512,  726,  554,  507,  557,  515,  555,
+      508,  499,  517,  497,  545,  511,  510,  509,  546,  506,
+      538,  726,  479,  471,  726,  470,  460,  499,  726,  446,
+
+      445,  454,  466,  499,  726,  452,  726,  463,  458,  453,
+      456,  456,  486,  434,  484,  726,  438,  726,  439,  424,
+      422,  470,  432,  468,  416,  414,  425,  726,  464,  421,
+      417,  409,  404,  416,  726,  401,  726,  409,  389,  404,
+      387,  726,  401,  726,  437,  398,  397,  726,  387,  433,
+      381,  349,  384,  430,  389,  422,  373,  378,  372,  726,
+      353,  361,  356,  726,  406,  353,  404,  352,  726,  361,
+      726,  356,  351,  347,  337,  336,  381,  726,  337,  726,
+      378,  324,  375,  327,  373,  372,  371,  726,  324,  726,
+      359,  726,  307,  726,  726,  726,  313,  726,  344,  211,
+
+      726,  205,  201,  249,  726,  726,  517,  522,  527,  532,
+      537,  542,  545,  238,  130,  115,   87
     } ;
 
-static yyconst flex_int16_t yy_def[399] =
+static yyconst flex_int16_t yy_def[418] =
     {   0,
-      387,    1,  388,  388,    1,    5,    5,    5,    5,    5,
-      387,  387,  387,  387,  387,  389,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  390,
-      387,  387,  387,  391,   15,  387,   45,   45,   45,   45,
-       45,   45,  392,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,  389,
-      387,  387,  387,  387,  387,  387,  393,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  390,  387,
-      391,  387,  387,   45,   45,   45,   45,   45,   45,  394,
-
-       45,  392,   45,   45,   45,   45,   45,   45,   45,   45,
+      406,    1,  407,  407,    1,    5,    5,    5,    5,    5,
+      406,  406,  406,  406,  406,  408,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  409,
+      406,  406,  406,  410,   15,  406,   45,   45,   45,   45,
+       45,   45,  411,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  408,
+      406,  406,  406,  406,  406,  406,  412,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  409,  406,
+      410,  406,  406,   45,   45,   45,   45,   45,   45,  413,
+
+       45,  411,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,  393,  387,  387,  387,  387,  387,  387,
-      387,  387,  395,   45,   45,   45,   45,   45,   45,  394,
-      387,  392,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  387,  387,  387,  387,  387,  387,
-      387,  396,   45,   45,   45,   45,  387,  387,  392,   45,
+       45,   45,   45,   45,  412,  406,  406,  406,  406,  406,
+      406,  406,  406,  414,   45,   45,   45,   45,   45,   45,
+      413,  406,  411,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  406,  406,  406,  406,
+      406,  406,  406,  415,   45,   45,   45,   45,  406,  406,
+      411,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,  387,  387,  387,  397,   45,   45,   45,   45,
-      387,   45,  392,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,  387,   45,   45,
-       45,  387,   45,   45,   45,   45,   45,  387,  398,   45,
-      387,  387,   45,   45,   45,   45,   45,   45,   45,   45,
-      387,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,  387,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,  406,  406,  406,  416,
+       45,   45,   45,   45,  406,   45,  411,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,  387,   45,   45,  387,   45,   45,  387,   45,
-       45,   45,   45,   45,  387,   45,  387,   45,   45,   45,
-
-       45,   45,   45,   45,   45,  387,  387,   45,   45,   45,
-       45,   45,   45,   45,   45,  387,   45,   45,   45,   45,
-       45,   45,  387,   45,  387,   45,   45,   45,   45,  387,
-       45,   45,   45,  387,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  387,   45,   45,   45,  387,   45,
-       45,   45,   45,  387,  387,   45,   45,   45,   45,   45,
-       45,  387,   45,  387,   45,   45,   45,   45,   45,   45,
-      387,   45,  387,  387,   45,  387,  387,  387,   45,   45,
-       45,  387,   45,   45,   45,  387,    0,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387
-
+       45,   45,  406,   45,   45,   45,  406,   45,   45,   45,
+       45,   45,   45,  406,  417,   45,  406,  406,   45,   45,
+       45,   45,   45,   45,   45,   45,  406,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,  406,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,  406,   45,   45,  406,   45,   45,   45,  406,   45,
+
+       45,   45,   45,   45,  406,   45,  406,   45,   45,   45,
+       45,   45,   45,   45,   45,  406,   45,  406,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,  406,   45,   45,
+       45,   45,   45,   45,  406,   45,  406,   45,   45,   45,
+       45,  406,   45,  406,   45,   45,   45,  406,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,  406,
+       45,   45,   45,  406,   45,   45,   45,   45,  406,   45,
+      406,   45,   45,   45,   45,   45,   45,  406,   45,  406,
+       45,   45,   45,   45,   45,   45,   45,  406,   45,  406,
+       45,  406,   45,  406,  406,  406,   45,  406,   45,   45,
+
+      406,   45,   45,   45,  406,    0,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406
     } ;
 
-static yyconst flex_int16_t yy_nxt[774] =
+static yyconst flex_int16_t yy_nxt[793] =
     {   0,
        12,   13,   14,   13,   12,   15,   16,   12,   17,   18,
        19,   20,   21,   22,   22,   22,   23,   24,   12,   12,
@@ -673,9 +680,9 @@ static yyconst flex_int16_t yy_nxt[774] =
        42,   91,   42,   76,   81,   12,   12,   82,   77,   12,
 
        83,   12,   82,   81,   12,   79,   12,   79,   12,   83,
-       80,   80,   80,   81,   12,   12,   12,   12,   39,  239,
+       80,   80,   80,   81,   12,   12,   12,   12,   39,  245,
        12,   82,   84,   12,   83,   42,   85,   42,   12,   42,
-      116,   42,  117,   86,  206,   12,   12,   44,   44,   44,
+      116,   42,  117,   86,  210,   12,   12,   44,   44,   44,
        45,   45,   46,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   47,
        48,   45,   45,   49,   50,   45,   45,   45,   45,   45,
@@ -683,72 +690,75 @@ static yyconst flex_int16_t yy_nxt[774] =
        45,   57,   45,   58,   59,   49,   60,   61,   62,   63,
        64,   65,   66,   67,   68,   69,   45,   45,   45,   45,
 
-       45,   45,   45,   71,   96,   72,   72,   72,   71,  125,
+       45,   45,   45,   71,   96,   72,   72,   72,   71,  126,
        74,   74,   74,   75,   75,   75,   73,   92,   98,   99,
-      172,   73,  386,   71,   73,   74,   74,   74,   96,  105,
-      106,   98,  125,   99,  107,   73,   73,   98,   99,  108,
-       73,  109,  385,   73,  110,   80,   80,   80,   93,  229,
-       98,  126,   99,  127,  384,   73,   45,   45,  383,  230,
-       45,   45,  101,  382,  381,  122,  123,   45,   45,   45,
-       80,   80,   80,   45,  126,   45,   45,  127,   45,  167,
+      119,   73,  120,   71,   73,   74,   74,   74,   96,  105,
+      106,   98,  126,   99,  107,   73,   73,   98,   99,  108,
+       73,  109,  174,   73,  110,   80,   80,   80,   93,  234,
+       98,  127,   99,  128,  405,   73,   45,   45,  404,  235,
+       45,   45,  101,  403,  402,  123,  124,   45,   45,   45,
+       80,   80,   80,   45,  127,   45,   45,  128,   45,  169,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   75,   75,   75,   45,  167,   92,
+       45,   45,   45,   45,   75,   75,   75,   45,  169,   92,
 
        71,   45,   72,   72,   72,   73,   75,   75,   75,   45,
-      125,  126,   45,   73,   45,  102,   79,   73,   79,  127,
-      136,   80,   80,   80,   73,   71,  138,   74,   74,   74,
-       93,  139,   73,  128,  129,   91,   73,  165,   73,  166,
-      161,  165,   91,  130,  136,  166,  192,  175,  167,  193,
-      138,  208,  209,  203,  203,  139,  351,   73,  162,  286,
-      210,  165,  166,  380,  379,  168,   91,  170,  169,  378,
-       91,  175,  203,  204,   91,  377,  376,  375,  374,  373,
-      372,  371,   91,  370,  369,   91,  368,   91,  133,  142,
-      142,  142,  287,  367,  366,  365,  142,  142,  142,  142,
-
-      142,  142,  352,  364,  363,  362,  361,  360,  359,  358,
-      357,  356,  355,  354,  353,  142,  142,  142,  142,  142,
-      142,  179,  179,  179,  350,  349,  348,  347,  179,  179,
-      179,  179,  179,  179,  346,  345,  344,  343,  342,  341,
-      340,  339,  338,  337,  336,  335,  334,  179,  179,  179,
-      179,  179,  179,  213,  213,  213,  333,  332,  331,  330,
-      213,  213,  213,  213,  213,  213,  329,  328,  327,  326,
-      325,  324,  323,  322,  321,  320,  319,  318,  317,  213,
-      213,  213,  213,  213,  213,   45,   45,   45,  316,  315,
-      314,  313,   45,   45,   45,   45,   45,   45,  312,  311,
-
-      310,  309,  308,  307,  306,  305,  304,  303,  302,  301,
-      300,   45,   45,   45,   45,   45,   45,   36,   36,   36,
-       36,   36,   70,  299,   70,   70,   70,   89,  298,   89,
-      297,   89,   91,   91,   91,   91,   91,  100,  100,  100,
-      100,  100,  124,  296,  124,  124,  124,  140,  140,  140,
-      295,  294,  293,  292,  291,  290,  289,  288,  285,  284,
-      283,  282,  281,  280,  279,  278,  277,  276,  275,  274,
-      273,  272,  271,  270,  269,  268,  267,  266,  265,  264,
-      263,  262,  261,  260,  259,  258,  257,  256,  255,  254,
-      253,  252,  251,  250,  249,  248,  247,  246,  245,  244,
-
-      243,  242,  241,  240,  238,  237,  236,  235,  234,  233,
-      232,  231,  228,  227,  226,  225,  224,  223,  222,  221,
-      220,  219,  218,  217,  216,  215,  214,  212,  211,  207,
-      205,  202,  201,  200,  199,  198,  197,  196,  195,  194,
-      191,  190,  189,  188,  187,  186,  185,  184,  183,  182,
-      181,  180,  141,  178,  177,  176,  174,  173,  171,  164,
-      163,  160,  159,  158,  157,  156,  155,  154,  153,  152,
-      151,  150,  149,  148,  147,  146,  145,  144,  143,  141,
-      137,  135,  134,  132,  131,  121,  120,  119,  118,  115,
-      114,  113,  112,  111,  104,  103,   97,   95,   94,   43,
-
-       90,   88,   87,   78,   43,  387,   11,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387
+      126,  127,   45,   73,   45,  102,   79,   73,   79,  128,
+      137,   80,   80,   80,   73,   71,  139,   74,   74,   74,
+       93,  140,   73,  129,  130,   91,   73,  167,   73,  168,
+      163,  167,   91,  131,  137,  168,  194,  177,  169,  401,
+      139,  212,  213,  207,  207,  140,  400,   73,  164,  366,
+      214,  167,  168,  399,  398,  170,   91,  172,  171,  295,
+       91,  177,  207,  208,   91,  397,  396,  395,  394,  393,
+      392,  391,   91,  390,  389,   91,  388,   91,  134,  143,
+      143,  143,  195,  387,  386,  196,  143,  143,  143,  143,
+
+      143,  143,  296,  385,  384,  367,  383,  382,  381,  380,
+      379,  378,  377,  376,  375,  143,  143,  143,  143,  143,
+      143,  181,  181,  181,  374,  373,  372,  371,  181,  181,
+      181,  181,  181,  181,  370,  369,  368,  365,  364,  363,
+      362,  361,  360,  359,  358,  357,  356,  181,  181,  181,
+      181,  181,  181,  217,  217,  217,  355,  354,  353,  352,
+      217,  217,  217,  217,  217,  217,  351,  350,  349,  348,
+      347,  346,  345,  344,  343,  342,  341,  340,  339,  217,
+      217,  217,  217,  217,  217,   45,   45,   45,  338,  337,
+      336,  335,   45,   45,   45,   45,   45,   45,  334,  333,
+
+      332,  331,  330,  329,  328,  327,  326,  325,  324,  323,
+      322,   45,   45,   45,   45,   45,   45,   36,   36,   36,
+       36,   36,   70,  321,   70,   70,   70,   89,  320,   89,
+      319,   89,   91,   91,   91,   91,   91,  100,  100,  100,
+      100,  100,  125,  318,  125,  125,  125,  141,  141,  141,
+      317,  316,  315,  314,  313,  312,  311,  310,  309,  308,
+      307,  306,  305,  304,  303,  302,  301,  300,  299,  298,
+      297,  294,  293,  292,  291,  290,  289,  288,  287,  286,
+      285,  284,  283,  282,  281,  280,  279,  278,  277,  276,
+      275,  274,  273,  272,  271,  270,  269,  268,  267,  266,
+
+      265,  264,  263,  262,  261,  260,  259,  258,  257,  256,
+      255,  254,  253,  252,  251,  250,  249,  248,  247,  246,
+      244,  243,  242,  241,  240,  239,  238,  237,  236,  233,
+      232,  231,  230,  229,  228,  227,  226,  225,  224,  223,
+      222,  221,  220,  219,  218,  216,  215,  211,  209,  206,
+      205,  204,  203,  202,  201,  200,  199,  198,  197,  193,
+      192,  191,  190,  189,  188,  187,  186,  185,  184,  183,
+      182,  142,  180,  179,  178,  176,  175,  173,  166,  165,
+      162,  161,  160,  159,  158,  157,  156,  155,  154,  153,
+      152,  151,  150,  149,  148,  147,  146,  145,  144,  142,
+
+      138,  136,  135,  133,  132,  122,  121,  118,  115,  114,
+      113,  112,  111,  104,  103,   97,   95,   94,   43,   90,
+       88,   87,   78,   43,  406,   11,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406
+
     } ;
 
-static yyconst flex_int16_t yy_chk[774] =
+static yyconst flex_int16_t yy_chk[793] =
     {   0,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
         1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
@@ -759,12 +769,12 @@ static yyconst flex_int16_t yy_chk[774] =
         1,    1,    1,    1,    1,    1,    3,    3,    3,    4,
         4,    4,    3,    9,    7,    4,    5,    5,    8,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,   10,
-       13,  398,   13,   21,   26,    5,    5,   27,   21,    5,
+       13,  417,   13,   21,   26,    5,    5,   27,   21,    5,
 
        28,    9,   32,   31,    5,   25,    5,   25,    5,   33,
-       25,   25,   25,   26,    5,    5,    7,   10,    5,  397,
+       25,   25,   25,   26,    5,    5,    7,   10,    5,  416,
         8,   27,   31,    5,   28,   37,   32,   37,    5,   42,
-       63,   42,   63,   33,  396,    5,    5,   15,   15,   15,
+       63,   42,   63,   33,  415,    5,    5,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -774,67 +784,70 @@ static yyconst flex_int16_t yy_chk[774] =
 
        15,   15,   15,   17,   49,   17,   17,   17,   19,   81,
        19,   19,   19,   20,   20,   20,   17,   44,   51,   52,
-      395,   19,  385,   22,   20,   22,   22,   22,   49,   56,
+       65,   19,   65,   22,   20,   22,   22,   22,   49,   56,
        56,   68,   81,   69,   56,   17,   22,   51,   52,   56,
-       19,   57,  384,   20,   57,   79,   79,   79,   44,  195,
-       68,   82,   69,   83,  383,   22,   45,   45,  381,  195,
-       45,   45,   53,  380,  379,   68,   69,   45,   45,   53,
-       80,   80,   80,   45,   82,   45,   45,   83,   45,  127,
+       19,   57,  414,   20,   57,   79,   79,   79,   44,  198,
+       68,   82,   69,   83,  404,   22,   45,   45,  403,  198,
+       45,   45,   53,  402,  400,   68,   69,   45,   45,   53,
+       80,   80,   80,   45,   82,   45,   45,   83,   45,  128,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   53,   71,   71,   71,   53,  127,   91,
+       45,   45,   45,   53,   71,   71,   71,   53,  128,   91,
 
        72,   53,   72,   72,   72,   71,   75,   75,   75,   53,
        84,   85,   53,   72,   53,   53,   73,   75,   73,   86,
        96,   73,   73,   73,   71,   74,   98,   74,   74,   74,
-       91,   99,   72,   84,   85,   93,   75,  125,   74,  126,
-      121,  128,   93,   86,   96,  129,  155,  136,  130,  155,
-       98,  174,  174,  165,  168,   99,  338,   74,  121,  261,
-      174,  125,  126,  375,  372,  128,   93,  130,  129,  370,
-       93,  136,  165,  168,   93,  369,  368,  367,  366,  365,
-      363,  361,   93,  360,  359,   93,  358,   93,   93,  102,
-      102,  102,  261,  357,  356,  353,  102,  102,  102,  102,
-
-      102,  102,  338,  352,  351,  350,  348,  347,  346,  344,
-      343,  342,  341,  340,  339,  102,  102,  102,  102,  102,
-      102,  142,  142,  142,  337,  336,  335,  333,  142,  142,
-      142,  142,  142,  142,  332,  331,  329,  328,  327,  326,
-      324,  322,  321,  320,  319,  318,  317,  142,  142,  142,
-      142,  142,  142,  179,  179,  179,  315,  314,  313,  312,
-      179,  179,  179,  179,  179,  179,  311,  310,  309,  308,
-      305,  304,  303,  302,  301,  300,  299,  298,  296,  179,
-      179,  179,  179,  179,  179,  213,  213,  213,  294,  293,
-      292,  291,  213,  213,  213,  213,  213,  213,  290,  288,
-
-      287,  285,  284,  282,  281,  280,  279,  278,  277,  276,
-      275,  213,  213,  213,  213,  213,  213,  388,  388,  388,
-      388,  388,  389,  274,  389,  389,  389,  390,  273,  390,
-      272,  390,  391,  391,  391,  391,  391,  392,  392,  392,
-      392,  392,  393,  271,  393,  393,  393,  394,  394,  394,
-      270,  269,  268,  266,  265,  264,  263,  262,  260,  259,
-      258,  257,  256,  255,  254,  253,  252,  250,  249,  248,
-      247,  246,  245,  244,  243,  240,  238,  237,  236,  235,
-      234,  233,  231,  230,  229,  227,  226,  225,  224,  223,
-      222,  221,  220,  219,  218,  217,  216,  215,  214,  212,
-
-      210,  209,  208,  207,  205,  202,  201,  200,  199,  198,
-      197,  196,  194,  193,  192,  191,  190,  189,  188,  187,
-      186,  185,  184,  183,  182,  181,  180,  176,  175,  173,
-      171,  164,  163,  162,  161,  160,  159,  158,  157,  156,
+       91,   99,   72,   84,   85,   93,   75,  126,   74,  127,
+      122,  129,   93,   86,   96,  130,  156,  137,  131,  399,
+       98,  176,  176,  167,  170,   99,  397,   74,  122,  352,
+      176,  126,  127,  393,  391,  129,   93,  131,  130,  268,
+       93,  137,  167,  170,   93,  389,  387,  386,  385,  384,
+      383,  382,   93,  381,  379,   93,  377,   93,   93,  102,
+      102,  102,  156,  376,  375,  156,  102,  102,  102,  102,
+
+      102,  102,  268,  374,  373,  352,  372,  370,  368,  367,
+      366,  365,  363,  362,  361,  102,  102,  102,  102,  102,
+      102,  143,  143,  143,  359,  358,  357,  356,  143,  143,
+      143,  143,  143,  143,  355,  354,  353,  351,  350,  349,
+      347,  346,  345,  343,  341,  340,  339,  143,  143,  143,
+      143,  143,  143,  181,  181,  181,  338,  336,  334,  333,
+      181,  181,  181,  181,  181,  181,  332,  331,  330,  329,
+      327,  326,  325,  324,  323,  322,  321,  320,  319,  181,
+      181,  181,  181,  181,  181,  217,  217,  217,  317,  315,
+      314,  313,  217,  217,  217,  217,  217,  217,  312,  311,
+
+      310,  309,  308,  306,  304,  303,  302,  301,  300,  298,
+      297,  217,  217,  217,  217,  217,  217,  407,  407,  407,
+      407,  407,  408,  296,  408,  408,  408,  409,  294,  409,
+      293,  409,  410,  410,  410,  410,  410,  411,  411,  411,
+      411,  411,  412,  291,  412,  412,  412,  413,  413,  413,
+      290,  289,  288,  287,  286,  285,  284,  283,  282,  281,
+      280,  279,  278,  277,  276,  274,  273,  272,  271,  270,
+      269,  267,  266,  265,  264,  263,  262,  261,  260,  259,
+      258,  256,  255,  254,  253,  252,  251,  250,  249,  246,
+      244,  243,  242,  241,  240,  239,  238,  236,  235,  234,
+
+      232,  231,  230,  229,  228,  227,  226,  225,  224,  223,
+      222,  221,  220,  219,  218,  216,  214,  213,  212,  211,
+      209,  206,  205,  204,  203,  202,  201,  200,  199,  197,
+      196,  195,  194,  193,  192,  191,  190,  189,  188,  187,
+      186,  185,  184,  183,  182,  178,  177,  175,  173,  166,
+      165,  164,  163,  162,  161,  160,  159,  158,  157,  155,
       154,  153,  152,  151,  150,  149,  148,  147,  146,  145,
-      144,  143,  140,  139,  138,  137,  135,  134,  131,  123,
-      122,  120,  119,  118,  117,  116,  115,  114,  113,  112,
+      144,  141,  140,  139,  138,  136,  135,  132,  124,  123,
+      121,  120,  119,  118,  117,  116,  115,  114,  113,  112,
       111,  110,  109,  108,  107,  106,  105,  104,  103,  100,
-       97,   95,   94,   89,   88,   67,   66,   65,   64,   62,
-       61,   60,   59,   58,   55,   54,   50,   48,   47,   43,
-
-       41,   39,   38,   24,   14,   11,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387,  387,  387,  387,  387,  387,  387,  387,
-      387,  387,  387
+
+       97,   95,   94,   89,   88,   67,   66,   64,   62,   61,
+       60,   59,   58,   55,   54,   50,   48,   47,   43,   41,
+       39,   38,   24,   14,   11,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406,  406,  406,  406,  406,  406,  406,  406,  406,
+      406,  406
+
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -843,15 +856,15 @@ static char *yy_last_accepting_cpos;
 extern int d2_parser__flex_debug;
 int d2_parser__flex_debug = 1;
 
-static yyconst flex_int16_t yy_rule_linenum[64] =
+static yyconst flex_int16_t yy_rule_linenum[66] =
     {   0,
       132,  134,  136,  141,  142,  147,  148,  149,  161,  164,
-      169,  175,  184,  195,  206,  215,  224,  233,  243,  253,
-      263,  279,  295,  304,  313,  323,  333,  343,  354,  363,
-      373,  383,  394,  403,  412,  421,  430,  439,  448,  457,
-      470,  479,  488,  497,  506,  516,  615,  620,  625,  630,
-      631,  632,  633,  634,  635,  637,  655,  668,  673,  677,
-      679,  681,  683
+      169,  175,  184,  195,  206,  216,  226,  235,  244,  253,
+      263,  273,  283,  299,  315,  324,  333,  343,  353,  363,
+      374,  383,  393,  403,  414,  423,  432,  441,  450,  459,
+      468,  477,  490,  499,  508,  517,  526,  536,  635,  640,
+      645,  650,  651,  652,  653,  654,  655,  657,  675,  688,
+      693,  697,  699,  701,  703
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -928,7 +941,7 @@ unsigned int comment_start_line = 0;
    by moving it ahead by d2_parser_leng bytes. d2_parser_leng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(d2_parser_leng);
-#line 932 "d2_lexer.cc"
+#line 945 "d2_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1207,7 +1220,7 @@ YY_DECL
     }
 
 
-#line 1211 "d2_lexer.cc"
+#line 1224 "d2_lexer.cc"
 
 	if ( !(yy_init) )
 		{
@@ -1270,13 +1283,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 388 )
+				if ( yy_current_state >= 407 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 387 );
+		while ( yy_current_state != 406 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1295,13 +1308,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 64 )
+			else if ( yy_act < 66 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], d2_parser_text );
-			else if ( yy_act == 64 )
+			else if ( yy_act == 66 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         d2_parser_text );
-			else if ( yy_act == 65 )
+			else if ( yy_act == 67 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1448,6 +1461,32 @@ YY_RULE_SETUP
 case 15:
 YY_RULE_SETUP
 #line 206 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_MAX_IN_FLIGHT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("max-in-flight", driver.loc_);
+    }
+}
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+#line 216 "d2_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("protocol", driver.loc_);
+    }
+}
+	YY_BREAK
+case 17:
+YY_RULE_SETUP
+#line 226 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1457,9 +1496,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 16:
+case 18:
 YY_RULE_SETUP
-#line 215 "d2_lexer.ll"
+#line 235 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1469,9 +1508,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 17:
+case 19:
 YY_RULE_SETUP
-#line 224 "d2_lexer.ll"
+#line 244 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1481,9 +1520,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 18:
+case 20:
 YY_RULE_SETUP
-#line 233 "d2_lexer.ll"
+#line 253 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
@@ -1494,9 +1533,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 19:
+case 21:
 YY_RULE_SETUP
-#line 243 "d2_lexer.ll"
+#line 263 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_PROTOCOL) {
@@ -1507,9 +1546,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 20:
+case 22:
 YY_RULE_SETUP
-#line 253 "d2_lexer.ll"
+#line 273 "d2_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::d2::D2ParserContext::NCR_FORMAT) {
@@ -1520,9 +1559,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 21:
+case 23:
 YY_RULE_SETUP
-#line 263 "d2_lexer.ll"
+#line 283 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1539,9 +1578,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 22:
+case 24:
 YY_RULE_SETUP
-#line 279 "d2_lexer.ll"
+#line 299 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1558,9 +1597,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 23:
+case 25:
 YY_RULE_SETUP
-#line 295 "d2_lexer.ll"
+#line 315 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1570,9 +1609,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 24:
+case 26:
 YY_RULE_SETUP
-#line 304 "d2_lexer.ll"
+#line 324 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1582,9 +1621,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 25:
+case 27:
 YY_RULE_SETUP
-#line 313 "d2_lexer.ll"
+#line 333 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::FORWARD_DDNS:
@@ -1595,9 +1634,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 26:
+case 28:
 YY_RULE_SETUP
-#line 323 "d2_lexer.ll"
+#line 343 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1608,9 +1647,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 27:
+case 29:
 YY_RULE_SETUP
-#line 333 "d2_lexer.ll"
+#line 353 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DDNS_DOMAIN:
@@ -1621,9 +1660,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 30:
 YY_RULE_SETUP
-#line 343 "d2_lexer.ll"
+#line 363 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DNS_SERVER:
@@ -1634,9 +1673,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 31:
 YY_RULE_SETUP
-#line 354 "d2_lexer.ll"
+#line 374 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
@@ -1646,9 +1685,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 32:
 YY_RULE_SETUP
-#line 363 "d2_lexer.ll"
+#line 383 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1659,9 +1698,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 33:
 YY_RULE_SETUP
-#line 373 "d2_lexer.ll"
+#line 393 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1672,9 +1711,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 34:
 YY_RULE_SETUP
-#line 383 "d2_lexer.ll"
+#line 403 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::TSIG_KEY:
@@ -1685,9 +1724,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 35:
 YY_RULE_SETUP
-#line 394 "d2_lexer.ll"
+#line 414 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1697,9 +1736,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 36:
 YY_RULE_SETUP
-#line 403 "d2_lexer.ll"
+#line 423 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGING:
@@ -1709,9 +1748,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 37:
 YY_RULE_SETUP
-#line 412 "d2_lexer.ll"
+#line 432 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1721,9 +1760,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 38:
 YY_RULE_SETUP
-#line 421 "d2_lexer.ll"
+#line 441 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1733,9 +1772,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 39:
 YY_RULE_SETUP
-#line 430 "d2_lexer.ll"
+#line 450 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1745,9 +1784,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 40:
 YY_RULE_SETUP
-#line 439 "d2_lexer.ll"
+#line 459 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1757,9 +1796,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 41:
 YY_RULE_SETUP
-#line 448 "d2_lexer.ll"
+#line 468 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::OUTPUT_OPTIONS:
@@ -1769,9 +1808,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 42:
 YY_RULE_SETUP
-#line 457 "d2_lexer.ll"
+#line 477 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1785,9 +1824,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 43:
 YY_RULE_SETUP
-#line 470 "d2_lexer.ll"
+#line 490 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1797,9 +1836,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 44:
 YY_RULE_SETUP
-#line 479 "d2_lexer.ll"
+#line 499 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::LOGGERS:
@@ -1809,9 +1848,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 45:
 YY_RULE_SETUP
-#line 488 "d2_lexer.ll"
+#line 508 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1821,9 +1860,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 46:
 YY_RULE_SETUP
-#line 497 "d2_lexer.ll"
+#line 517 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1833,9 +1872,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 47:
 YY_RULE_SETUP
-#line 506 "d2_lexer.ll"
+#line 526 "d2_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::CONFIG:
@@ -1845,9 +1884,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 48:
 YY_RULE_SETUP
-#line 516 "d2_lexer.ll"
+#line 536 "d2_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -1947,65 +1986,65 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 47:
-/* rule 47 can match eol */
+case 49:
+/* rule 49 can match eol */
 YY_RULE_SETUP
-#line 615 "d2_lexer.ll"
+#line 635 "d2_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(d2_parser_text));
 }
 	YY_BREAK
-case 48:
-/* rule 48 can match eol */
+case 50:
+/* rule 50 can match eol */
 YY_RULE_SETUP
-#line 620 "d2_lexer.ll"
+#line 640 "d2_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(d2_parser_text));
 }
 	YY_BREAK
-case 49:
+case 51:
 YY_RULE_SETUP
-#line 625 "d2_lexer.ll"
+#line 645 "d2_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(d2_parser_text));
 }
 	YY_BREAK
-case 50:
+case 52:
 YY_RULE_SETUP
-#line 630 "d2_lexer.ll"
+#line 650 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 51:
+case 53:
 YY_RULE_SETUP
-#line 631 "d2_lexer.ll"
+#line 651 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 52:
+case 54:
 YY_RULE_SETUP
-#line 632 "d2_lexer.ll"
+#line 652 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 53:
+case 55:
 YY_RULE_SETUP
-#line 633 "d2_lexer.ll"
+#line 653 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 54:
+case 56:
 YY_RULE_SETUP
-#line 634 "d2_lexer.ll"
+#line 654 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 55:
+case 57:
 YY_RULE_SETUP
-#line 635 "d2_lexer.ll"
+#line 655 "d2_lexer.ll"
 { return isc::d2::D2Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 56:
+case 58:
 YY_RULE_SETUP
-#line 637 "d2_lexer.ll"
+#line 657 "d2_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(d2_parser_text);
@@ -2024,9 +2063,9 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 57:
+case 59:
 YY_RULE_SETUP
-#line 655 "d2_lexer.ll"
+#line 675 "d2_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(d2_parser_text);
@@ -2040,43 +2079,43 @@ YY_RULE_SETUP
     return isc::d2::D2Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 58:
+case 60:
 YY_RULE_SETUP
-#line 668 "d2_lexer.ll"
+#line 688 "d2_lexer.ll"
 {
     string tmp(d2_parser_text);
     return isc::d2::D2Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 59:
+case 61:
 YY_RULE_SETUP
-#line 673 "d2_lexer.ll"
+#line 693 "d2_lexer.ll"
 {
    return isc::d2::D2Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 60:
+case 62:
 YY_RULE_SETUP
-#line 677 "d2_lexer.ll"
+#line 697 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 61:
+case 63:
 YY_RULE_SETUP
-#line 679 "d2_lexer.ll"
+#line 699 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 62:
+case 64:
 YY_RULE_SETUP
-#line 681 "d2_lexer.ll"
+#line 701 "d2_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 63:
+case 65:
 YY_RULE_SETUP
-#line 683 "d2_lexer.ll"
+#line 703 "d2_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(d2_parser_text));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 685 "d2_lexer.ll"
+#line 705 "d2_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::d2::D2Parser::make_END(driver.loc_);
@@ -2100,12 +2139,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 64:
+case 66:
 YY_RULE_SETUP
-#line 708 "d2_lexer.ll"
+#line 728 "d2_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 2109 "d2_lexer.cc"
+#line 2148 "d2_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -2417,7 +2456,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 388 )
+			if ( yy_current_state >= 407 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -2450,11 +2489,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 388 )
+		if ( yy_current_state >= 407 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 387);
+	yy_is_jam = (yy_current_state == 406);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -3185,7 +3224,7 @@ void d2_parser_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 708 "d2_lexer.ll"
+#line 728 "d2_lexer.ll"
 
 
 
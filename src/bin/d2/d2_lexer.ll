@@ -203,6 +203,26 @@ ControlCharacterFill            [^"\\]|\\{JSONEscapeSequence}
     }
 }
 
+\"max-in-flight\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_MAX_IN_FLIGHT(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("max-in-flight", driver.loc_);
+    }
+}
+
+\"protocol\" {
+    switch(driver.ctx_) {
+    case isc::d2::D2ParserContext::DNS_SERVER:
+    case isc::d2::D2ParserContext::DNS_SERVERS:
+        return isc::d2::D2Parser::make_PROTOCOL(driver.loc_);
+    default:
+        return isc::d2::D2Parser::make_STRING("protocol", driver.loc_);
+    }
+}
+
 \"dns-server-timeout\" {
     switch(driver.ctx_) {
     case isc::d2::D2ParserContext::DHCPDDNS:
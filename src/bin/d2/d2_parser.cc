@@ -253,25 +253,25 @@ namespace isc { namespace d2 {
   {
       switch (that.type_get ())
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -290,25 +290,25 @@ namespace isc { namespace d2 {
     state = that.state;
       switch (that.type_get ())
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -348,51 +348,51 @@ namespace isc { namespace d2 {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 53: // "constant string"
+            case 55: // "constant string"
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 356 "d2_parser.cc" // lalr1.cc:636
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 363 "d2_parser.cc" // lalr1.cc:636
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 370 "d2_parser.cc" // lalr1.cc:636
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 377 "d2_parser.cc" // lalr1.cc:636
         break;
 
-      case 68: // value
+      case 70: // value
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 384 "d2_parser.cc" // lalr1.cc:636
         break;
 
-      case 72: // map_value
+      case 74: // map_value
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 391 "d2_parser.cc" // lalr1.cc:636
         break;
 
-      case 96: // ncr_protocol_value
+      case 98: // ncr_protocol_value
 
-#line 111 "d2_parser.yy" // lalr1.cc:636
+#line 113 "d2_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 398 "d2_parser.cc" // lalr1.cc:636
         break;
@@ -594,25 +594,25 @@ namespace isc { namespace d2 {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -634,103 +634,103 @@ namespace isc { namespace d2 {
           switch (yyn)
             {
   case 2:
-#line 120 "d2_parser.yy" // lalr1.cc:859
+#line 122 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 640 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 121 "d2_parser.yy" // lalr1.cc:859
+#line 123 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 646 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 122 "d2_parser.yy" // lalr1.cc:859
+#line 124 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCPDDNS; }
 #line 652 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 123 "d2_parser.yy" // lalr1.cc:859
+#line 125 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.TSIG_KEY; }
 #line 658 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 124 "d2_parser.yy" // lalr1.cc:859
+#line 126 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.TSIG_KEYS; }
 #line 664 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 125 "d2_parser.yy" // lalr1.cc:859
+#line 127 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DDNS_DOMAIN; }
 #line 670 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 126 "d2_parser.yy" // lalr1.cc:859
+#line 128 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DDNS_DOMAINS; }
 #line 676 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 127 "d2_parser.yy" // lalr1.cc:859
+#line 129 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DNS_SERVERS; }
 #line 682 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 128 "d2_parser.yy" // lalr1.cc:859
+#line 130 "d2_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DNS_SERVERS; }
 #line 688 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 136 "d2_parser.yy" // lalr1.cc:859
+#line 138 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 694 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 21:
-#line 137 "d2_parser.yy" // lalr1.cc:859
+#line 139 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 700 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 138 "d2_parser.yy" // lalr1.cc:859
+#line 140 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 706 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 23:
-#line 139 "d2_parser.yy" // lalr1.cc:859
+#line 141 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 712 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 140 "d2_parser.yy" // lalr1.cc:859
+#line 142 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 718 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 25:
-#line 141 "d2_parser.yy" // lalr1.cc:859
+#line 143 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 724 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 142 "d2_parser.yy" // lalr1.cc:859
+#line 144 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 730 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 27:
-#line 145 "d2_parser.yy" // lalr1.cc:859
+#line 147 "d2_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -739,7 +739,7 @@ namespace isc { namespace d2 {
     break;
 
   case 28:
-#line 150 "d2_parser.yy" // lalr1.cc:859
+#line 152 "d2_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -750,7 +750,7 @@ namespace isc { namespace d2 {
     break;
 
   case 29:
-#line 155 "d2_parser.yy" // lalr1.cc:859
+#line 157 "d2_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -760,13 +760,13 @@ namespace isc { namespace d2 {
     break;
 
   case 30:
-#line 161 "d2_parser.yy" // lalr1.cc:859
+#line 163 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 766 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 168 "d2_parser.yy" // lalr1.cc:859
+#line 170 "d2_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -775,7 +775,7 @@ namespace isc { namespace d2 {
     break;
 
   case 34:
-#line 172 "d2_parser.yy" // lalr1.cc:859
+#line 174 "d2_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -785,7 +785,7 @@ namespace isc { namespace d2 {
     break;
 
   case 35:
-#line 179 "d2_parser.yy" // lalr1.cc:859
+#line 181 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -794,7 +794,7 @@ namespace isc { namespace d2 {
     break;
 
   case 36:
-#line 182 "d2_parser.yy" // lalr1.cc:859
+#line 184 "d2_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -802,7 +802,7 @@ namespace isc { namespace d2 {
     break;
 
   case 39:
-#line 190 "d2_parser.yy" // lalr1.cc:859
+#line 192 "d2_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -811,7 +811,7 @@ namespace isc { namespace d2 {
     break;
 
   case 40:
-#line 194 "d2_parser.yy" // lalr1.cc:859
+#line 196 "d2_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -820,7 +820,7 @@ namespace isc { namespace d2 {
     break;
 
   case 41:
-#line 205 "d2_parser.yy" // lalr1.cc:859
+#line 207 "d2_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -831,7 +831,7 @@ namespace isc { namespace d2 {
     break;
 
   case 42:
-#line 215 "d2_parser.yy" // lalr1.cc:859
+#line 217 "d2_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -842,7 +842,7 @@ namespace isc { namespace d2 {
     break;
 
   case 43:
-#line 220 "d2_parser.yy" // lalr1.cc:859
+#line 222 "d2_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -852,7 +852,7 @@ namespace isc { namespace d2 {
     break;
 
   case 52:
-#line 242 "d2_parser.yy" // lalr1.cc:859
+#line 244 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("DhcpDdns", m);
@@ -863,7 +863,7 @@ namespace isc { namespace d2 {
     break;
 
   case 53:
-#line 247 "d2_parser.yy" // lalr1.cc:859
+#line 249 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -872,7 +872,7 @@ namespace isc { namespace d2 {
     break;
 
   case 54:
-#line 252 "d2_parser.yy" // lalr1.cc:859
+#line 254 "d2_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcpddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -882,7 +882,7 @@ namespace isc { namespace d2 {
     break;
 
   case 55:
-#line 256 "d2_parser.yy" // lalr1.cc:859
+#line 258 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -890,7 +890,7 @@ namespace isc { namespace d2 {
     break;
 
   case 69:
-#line 278 "d2_parser.yy" // lalr1.cc:859
+#line 280 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -898,7 +898,7 @@ namespace isc { namespace d2 {
     break;
 
   case 70:
-#line 280 "d2_parser.yy" // lalr1.cc:859
+#line 282 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
@@ -908,7 +908,7 @@ namespace isc { namespace d2 {
     break;
 
   case 71:
-#line 286 "d2_parser.yy" // lalr1.cc:859
+#line 288 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
@@ -920,7 +920,7 @@ namespace isc { namespace d2 {
     break;
 
   case 72:
-#line 294 "d2_parser.yy" // lalr1.cc:859
+#line 296 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< int64_t > () <= 0) {
         error(yystack_[0].location, "dns-server-timeout must be greater than zero");
@@ -933,7 +933,7 @@ namespace isc { namespace d2 {
     break;
 
   case 73:
-#line 303 "d2_parser.yy" // lalr1.cc:859
+#line 305 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
@@ -941,7 +941,7 @@ namespace isc { namespace d2 {
     break;
 
   case 74:
-#line 305 "d2_parser.yy" // lalr1.cc:859
+#line 307 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -950,19 +950,19 @@ namespace isc { namespace d2 {
     break;
 
   case 75:
-#line 311 "d2_parser.yy" // lalr1.cc:859
+#line 313 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
 #line 956 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 76:
-#line 312 "d2_parser.yy" // lalr1.cc:859
+#line 314 "d2_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
 #line 962 "d2_parser.cc" // lalr1.cc:859
     break;
 
   case 77:
-#line 315 "d2_parser.yy" // lalr1.cc:859
+#line 317 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
@@ -970,7 +970,7 @@ namespace isc { namespace d2 {
     break;
 
   case 78:
-#line 317 "d2_parser.yy" // lalr1.cc:859
+#line 319 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
@@ -980,7 +980,7 @@ namespace isc { namespace d2 {
     break;
 
   case 79:
-#line 323 "d2_parser.yy" // lalr1.cc:859
+#line 325 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -988,7 +988,7 @@ namespace isc { namespace d2 {
     break;
 
   case 80:
-#line 325 "d2_parser.yy" // lalr1.cc:859
+#line 327 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
@@ -1015,7 +1015,7 @@ namespace isc { namespace d2 {
     break;
 
   case 81:
-#line 348 "d2_parser.yy" // lalr1.cc:859
+#line 350 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1023,7 +1023,7 @@ namespace isc { namespace d2 {
     break;
 
   case 82:
-#line 350 "d2_parser.yy" // lalr1.cc:859
+#line 352 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -1052,7 +1052,7 @@ namespace isc { namespace d2 {
     break;
 
   case 83:
-#line 375 "d2_parser.yy" // lalr1.cc:859
+#line 377 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("forward-ddns", m);
@@ -1063,7 +1063,7 @@ namespace isc { namespace d2 {
     break;
 
   case 84:
-#line 380 "d2_parser.yy" // lalr1.cc:859
+#line 382 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1072,7 +1072,7 @@ namespace isc { namespace d2 {
     break;
 
   case 85:
-#line 385 "d2_parser.yy" // lalr1.cc:859
+#line 387 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reverse-ddns", m);
@@ -1083,7 +1083,7 @@ namespace isc { namespace d2 {
     break;
 
   case 86:
-#line 390 "d2_parser.yy" // lalr1.cc:859
+#line 392 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1092,7 +1092,7 @@ namespace isc { namespace d2 {
     break;
 
   case 93:
-#line 409 "d2_parser.yy" // lalr1.cc:859
+#line 411 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ddns-domains", l);
@@ -1103,7 +1103,7 @@ namespace isc { namespace d2 {
     break;
 
   case 94:
-#line 414 "d2_parser.yy" // lalr1.cc:859
+#line 416 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1112,7 +1112,7 @@ namespace isc { namespace d2 {
     break;
 
   case 95:
-#line 419 "d2_parser.yy" // lalr1.cc:859
+#line 421 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -1121,7 +1121,7 @@ namespace isc { namespace d2 {
     break;
 
   case 96:
-#line 422 "d2_parser.yy" // lalr1.cc:859
+#line 424 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -1129,7 +1129,7 @@ namespace isc { namespace d2 {
     break;
 
   case 101:
-#line 434 "d2_parser.yy" // lalr1.cc:859
+#line 436 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1139,7 +1139,7 @@ namespace isc { namespace d2 {
     break;
 
   case 102:
-#line 438 "d2_parser.yy" // lalr1.cc:859
+#line 440 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
@@ -1147,7 +1147,7 @@ namespace isc { namespace d2 {
     break;
 
   case 103:
-#line 442 "d2_parser.yy" // lalr1.cc:859
+#line 444 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
@@ -1156,7 +1156,7 @@ namespace isc { namespace d2 {
     break;
 
   case 104:
-#line 445 "d2_parser.yy" // lalr1.cc:859
+#line 447 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -1164,7 +1164,7 @@ namespace isc { namespace d2 {
     break;
 
   case 113:
-#line 462 "d2_parser.yy" // lalr1.cc:859
+#line 464 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1172,7 +1172,7 @@ namespace isc { namespace d2 {
     break;
 
   case 114:
-#line 464 "d2_parser.yy" // lalr1.cc:859
+#line 466 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< std::string > () == "") {
         error(yystack_[1].location, "Ddns domain name cannot be blank");
@@ -1186,7 +1186,7 @@ namespace isc { namespace d2 {
     break;
 
   case 115:
-#line 474 "d2_parser.yy" // lalr1.cc:859
+#line 476 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1194,7 +1194,7 @@ namespace isc { namespace d2 {
     break;
 
   case 116:
-#line 476 "d2_parser.yy" // lalr1.cc:859
+#line 478 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr elem(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
@@ -1205,7 +1205,7 @@ namespace isc { namespace d2 {
     break;
 
   case 117:
-#line 486 "d2_parser.yy" // lalr1.cc:859
+#line 488 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dns-servers", l);
@@ -1216,7 +1216,7 @@ namespace isc { namespace d2 {
     break;
 
   case 118:
-#line 491 "d2_parser.yy" // lalr1.cc:859
+#line 493 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1225,7 +1225,7 @@ namespace isc { namespace d2 {
     break;
 
   case 119:
-#line 496 "d2_parser.yy" // lalr1.cc:859
+#line 498 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -1234,7 +1234,7 @@ namespace isc { namespace d2 {
     break;
 
   case 120:
-#line 499 "d2_parser.yy" // lalr1.cc:859
+#line 501 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -1242,7 +1242,7 @@ namespace isc { namespace d2 {
     break;
 
   case 123:
-#line 507 "d2_parser.yy" // lalr1.cc:859
+#line 509 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1252,7 +1252,7 @@ namespace isc { namespace d2 {
     break;
 
   case 124:
-#line 511 "d2_parser.yy" // lalr1.cc:859
+#line 513 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
@@ -1260,7 +1260,7 @@ namespace isc { namespace d2 {
     break;
 
   case 125:
-#line 515 "d2_parser.yy" // lalr1.cc:859
+#line 517 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
@@ -1269,23 +1269,23 @@ namespace isc { namespace d2 {
     break;
 
   case 126:
-#line 518 "d2_parser.yy" // lalr1.cc:859
+#line 520 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
 #line 1277 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 135:
-#line 534 "d2_parser.yy" // lalr1.cc:859
+  case 137:
+#line 538 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1285 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 136:
-#line 536 "d2_parser.yy" // lalr1.cc:859
+  case 138:
+#line 540 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< std::string > () != "") {
         error(yystack_[1].location, "hostname is not yet supported");
@@ -1298,16 +1298,16 @@ namespace isc { namespace d2 {
 #line 1299 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 137:
-#line 546 "d2_parser.yy" // lalr1.cc:859
+  case 139:
+#line 550 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1307 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 138:
-#line 548 "d2_parser.yy" // lalr1.cc:859
+  case 140:
+#line 552 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", s);
@@ -1316,8 +1316,8 @@ namespace isc { namespace d2 {
 #line 1317 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 139:
-#line 554 "d2_parser.yy" // lalr1.cc:859
+  case 141:
+#line 558 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< int64_t > () <= 0 || yystack_[0].value.as< int64_t > () >= 65536 ) {
         error(yystack_[0].location, "port must be greater than zero but less than 65536");
@@ -1328,89 +1328,118 @@ namespace isc { namespace d2 {
 #line 1329 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 568 "d2_parser.yy" // lalr1.cc:859
+  case 142:
+#line 566 "d2_parser.yy" // lalr1.cc:859
+    {
+    if (yystack_[0].value.as< int64_t > () < 0) {
+        error(yystack_[0].location, "max-in-flight cannot be negative");
+    }
+    ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("max-in-flight", i);
+}
+#line 1341 "d2_parser.cc" // lalr1.cc:859
+    break;
+
+  case 143:
+#line 575 "d2_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NCR_PROTOCOL);
+}
+#line 1349 "d2_parser.cc" // lalr1.cc:859
+    break;
+
+  case 144:
+#line 577 "d2_parser.yy" // lalr1.cc:859
+    {
+    ctx.stack_.back()->set("protocol", yystack_[0].value.as< ElementPtr > ());
+    ctx.leave();
+}
+#line 1358 "d2_parser.cc" // lalr1.cc:859
+    break;
+
+  case 145:
+#line 588 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tsig-keys", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.TSIG_KEYS);
 }
-#line 1340 "d2_parser.cc" // lalr1.cc:859
+#line 1369 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 573 "d2_parser.yy" // lalr1.cc:859
+  case 146:
+#line 593 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1349 "d2_parser.cc" // lalr1.cc:859
+#line 1378 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 578 "d2_parser.yy" // lalr1.cc:859
+  case 147:
+#line 598 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
 }
-#line 1358 "d2_parser.cc" // lalr1.cc:859
+#line 1387 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 581 "d2_parser.yy" // lalr1.cc:859
+  case 148:
+#line 601 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1366 "d2_parser.cc" // lalr1.cc:859
+#line 1395 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 148:
-#line 593 "d2_parser.yy" // lalr1.cc:859
+  case 153:
+#line 613 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1376 "d2_parser.cc" // lalr1.cc:859
+#line 1405 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 149:
-#line 597 "d2_parser.yy" // lalr1.cc:859
+  case 154:
+#line 617 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1384 "d2_parser.cc" // lalr1.cc:859
+#line 1413 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 150:
-#line 601 "d2_parser.yy" // lalr1.cc:859
+  case 155:
+#line 621 "d2_parser.yy" // lalr1.cc:859
     {
     // Parse tsig key list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1394 "d2_parser.cc" // lalr1.cc:859
+#line 1423 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 151:
-#line 605 "d2_parser.yy" // lalr1.cc:859
+  case 156:
+#line 625 "d2_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1402 "d2_parser.cc" // lalr1.cc:859
+#line 1431 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 161:
-#line 623 "d2_parser.yy" // lalr1.cc:859
+  case 166:
+#line 643 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1410 "d2_parser.cc" // lalr1.cc:859
+#line 1439 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 162:
-#line 625 "d2_parser.yy" // lalr1.cc:859
+  case 167:
+#line 645 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< std::string > () == "") {
         error(yystack_[1].location, "TSIG key name cannot be blank");
@@ -1420,19 +1449,19 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1424 "d2_parser.cc" // lalr1.cc:859
+#line 1453 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 163:
-#line 635 "d2_parser.yy" // lalr1.cc:859
+  case 168:
+#line 655 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1432 "d2_parser.cc" // lalr1.cc:859
+#line 1461 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 164:
-#line 637 "d2_parser.yy" // lalr1.cc:859
+  case 169:
+#line 657 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< std::string > () == "") {
         error(yystack_[1].location, "TSIG key algorithm cannot be blank");
@@ -1441,11 +1470,11 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("algorithm", elem);
     ctx.leave();
 }
-#line 1445 "d2_parser.cc" // lalr1.cc:859
+#line 1474 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 165:
-#line 646 "d2_parser.yy" // lalr1.cc:859
+  case 170:
+#line 666 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< int64_t > () < 0 || (yystack_[0].value.as< int64_t > () > 0  && (yystack_[0].value.as< int64_t > () % 8 != 0))) {
         error(yystack_[0].location, "TSIG key digest-bits must either be zero or a positive, multiple of eight");
@@ -1453,19 +1482,19 @@ namespace isc { namespace d2 {
     ElementPtr elem(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("digest-bits", elem);
 }
-#line 1457 "d2_parser.cc" // lalr1.cc:859
+#line 1486 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 166:
-#line 654 "d2_parser.yy" // lalr1.cc:859
+  case 171:
+#line 674 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1465 "d2_parser.cc" // lalr1.cc:859
+#line 1494 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 167:
-#line 656 "d2_parser.yy" // lalr1.cc:859
+  case 172:
+#line 676 "d2_parser.yy" // lalr1.cc:859
     {
     if (yystack_[0].value.as< std::string > () == "") {
         error(yystack_[1].location, "TSIG key secret cannot be blank");
@@ -1474,248 +1503,248 @@ namespace isc { namespace d2 {
     ctx.stack_.back()->set("secret", elem);
     ctx.leave();
 }
-#line 1478 "d2_parser.cc" // lalr1.cc:859
+#line 1507 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 168:
-#line 669 "d2_parser.yy" // lalr1.cc:859
+  case 173:
+#line 689 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1486 "d2_parser.cc" // lalr1.cc:859
+#line 1515 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 169:
-#line 671 "d2_parser.yy" // lalr1.cc:859
+  case 174:
+#line 691 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1495 "d2_parser.cc" // lalr1.cc:859
+#line 1524 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 170:
-#line 676 "d2_parser.yy" // lalr1.cc:859
+  case 175:
+#line 696 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1503 "d2_parser.cc" // lalr1.cc:859
+#line 1532 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 171:
-#line 678 "d2_parser.yy" // lalr1.cc:859
+  case 176:
+#line 698 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1512 "d2_parser.cc" // lalr1.cc:859
+#line 1541 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 172:
-#line 683 "d2_parser.yy" // lalr1.cc:859
+  case 177:
+#line 703 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1520 "d2_parser.cc" // lalr1.cc:859
+#line 1549 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 173:
-#line 685 "d2_parser.yy" // lalr1.cc:859
+  case 178:
+#line 705 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1529 "d2_parser.cc" // lalr1.cc:859
+#line 1558 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 174:
-#line 695 "d2_parser.yy" // lalr1.cc:859
+  case 179:
+#line 715 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 1540 "d2_parser.cc" // lalr1.cc:859
+#line 1569 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 175:
-#line 700 "d2_parser.yy" // lalr1.cc:859
+  case 180:
+#line 720 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1549 "d2_parser.cc" // lalr1.cc:859
+#line 1578 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 179:
-#line 717 "d2_parser.yy" // lalr1.cc:859
+  case 184:
+#line 737 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 1560 "d2_parser.cc" // lalr1.cc:859
+#line 1589 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 180:
-#line 722 "d2_parser.yy" // lalr1.cc:859
+  case 185:
+#line 742 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1569 "d2_parser.cc" // lalr1.cc:859
+#line 1598 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 183:
-#line 734 "d2_parser.yy" // lalr1.cc:859
+  case 188:
+#line 754 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 1579 "d2_parser.cc" // lalr1.cc:859
+#line 1608 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 184:
-#line 738 "d2_parser.yy" // lalr1.cc:859
+  case 189:
+#line 758 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1587 "d2_parser.cc" // lalr1.cc:859
+#line 1616 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 194:
-#line 755 "d2_parser.yy" // lalr1.cc:859
+  case 199:
+#line 775 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1595 "d2_parser.cc" // lalr1.cc:859
+#line 1624 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 195:
-#line 757 "d2_parser.yy" // lalr1.cc:859
+  case 200:
+#line 777 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1605 "d2_parser.cc" // lalr1.cc:859
+#line 1634 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 196:
-#line 763 "d2_parser.yy" // lalr1.cc:859
+  case 201:
+#line 783 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 1614 "d2_parser.cc" // lalr1.cc:859
+#line 1643 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 197:
-#line 767 "d2_parser.yy" // lalr1.cc:859
+  case 202:
+#line 787 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1622 "d2_parser.cc" // lalr1.cc:859
+#line 1651 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 198:
-#line 769 "d2_parser.yy" // lalr1.cc:859
+  case 203:
+#line 789 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 1632 "d2_parser.cc" // lalr1.cc:859
+#line 1661 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 199:
-#line 775 "d2_parser.yy" // lalr1.cc:859
+  case 204:
+#line 795 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 1643 "d2_parser.cc" // lalr1.cc:859
+#line 1672 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 200:
-#line 780 "d2_parser.yy" // lalr1.cc:859
+  case 205:
+#line 800 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1652 "d2_parser.cc" // lalr1.cc:859
+#line 1681 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 203:
-#line 789 "d2_parser.yy" // lalr1.cc:859
+  case 208:
+#line 809 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1662 "d2_parser.cc" // lalr1.cc:859
+#line 1691 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 204:
-#line 793 "d2_parser.yy" // lalr1.cc:859
+  case 209:
+#line 813 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1670 "d2_parser.cc" // lalr1.cc:859
+#line 1699 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 211:
-#line 807 "d2_parser.yy" // lalr1.cc:859
+  case 216:
+#line 827 "d2_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1678 "d2_parser.cc" // lalr1.cc:859
+#line 1707 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 212:
-#line 809 "d2_parser.yy" // lalr1.cc:859
+  case 217:
+#line 829 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 1688 "d2_parser.cc" // lalr1.cc:859
+#line 1717 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 213:
-#line 815 "d2_parser.yy" // lalr1.cc:859
+  case 218:
+#line 835 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 1697 "d2_parser.cc" // lalr1.cc:859
+#line 1726 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 214:
-#line 820 "d2_parser.yy" // lalr1.cc:859
+  case 219:
+#line 840 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 1706 "d2_parser.cc" // lalr1.cc:859
+#line 1735 "d2_parser.cc" // lalr1.cc:859
     break;
 
-  case 215:
-#line 825 "d2_parser.yy" // lalr1.cc:859
+  case 220:
+#line 845 "d2_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 1715 "d2_parser.cc" // lalr1.cc:859
+#line 1744 "d2_parser.cc" // lalr1.cc:859
     break;
 
 
-#line 1719 "d2_parser.cc" // lalr1.cc:859
+#line 1748 "d2_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -1970,49 +1999,50 @@ namespace isc { namespace d2 {
   }
 
 
-  const signed char D2Parser::yypact_ninf_ = -90;
+  const signed char D2Parser::yypact_ninf_ = -94;
 
   const signed char D2Parser::yytable_ninf_ = -1;
 
   const short int
   D2Parser::yypact_[] =
   {
-      47,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-      12,     2,     1,    23,    33,    11,    38,    58,    64,    73,
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,     2,   -25,
-       8,     9,    15,    96,    37,   115,    21,   116,   -90,   124,
-     113,   127,   130,   137,   -90,   -90,   -90,   -90,   -90,   146,
-     -90,    19,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   148,
-     150,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,    46,
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   152,   -90,   -90,   -90,   -90,   -90,    76,   -90,
-     -90,   -90,   -90,   -90,   -90,   151,   155,   -90,   -90,   -90,
-     -90,   -90,   -90,   -90,    77,   -90,   -90,   -90,   -90,   -90,
-     153,   157,   -90,   -90,   161,   -90,   -90,   -90,   -90,    78,
-     -90,   -90,   -90,   -90,   -90,   118,   -90,   -90,     2,     2,
-     -90,   108,   162,   163,   164,   165,   166,   -90,     8,   -90,
-     167,   119,   120,   168,   171,   172,   173,   174,   175,   176,
-       9,   -90,   177,   128,   179,   180,    15,   -90,    15,   -90,
-      96,   181,   182,   183,    37,   -90,    37,   -90,   115,   184,
-     135,   186,    21,   -90,    21,   116,   -90,   -90,   -90,   187,
-       2,     2,     2,   185,   188,   -90,   140,   -90,   -90,    70,
-     178,   189,   141,   190,   195,   198,   -90,   154,   -90,   156,
-     158,   -90,    79,   -90,   159,   199,   160,   -90,    97,   -90,
-     169,   -90,   170,   -90,    98,   -90,     2,   -90,   -90,   -90,
-       9,   191,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -12,   -12,    96,   -90,   -90,   -90,   -90,   -90,   116,   -90,
-     -90,   -90,   -90,   -90,   -90,    99,   -90,   101,   -90,   -90,
-     -90,   -90,   109,   -90,   -90,   -90,   110,   200,   126,   -90,
-     201,   191,   -90,   204,   -12,   -90,   -90,   -90,   -90,   205,
-     -90,   209,   -90,   208,   115,   -90,   143,   -90,   210,    30,
-     208,   -90,   -90,   -90,   -90,   213,   -90,   -90,   -90,   -90,
-     111,   -90,   -90,   -90,   -90,   -90,   -90,   214,   215,   192,
-     216,    30,   -90,   194,   219,   -90,   197,   -90,   -90,   218,
-     -90,   -90,   145,   -90,    34,   218,   -90,   -90,   217,   223,
-     224,   112,   -90,   -90,   -90,   -90,   -90,   -90,   225,   196,
-     202,   203,    34,   -90,   206,   -90,   -90,   -90,   -90,   -90
+      44,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+       7,     3,    23,    30,    46,     9,    50,    13,    68,    27,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,     3,    52,
+      10,    11,    29,    92,    49,   119,    25,   120,   -94,   103,
+     131,   142,   127,   139,   -94,   -94,   -94,   -94,   -94,   148,
+     -94,     8,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   150,
+     151,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,    21,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   152,   -94,   -94,   -94,   -94,   -94,    41,   -94,
+     -94,   -94,   -94,   -94,   -94,   153,   154,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,    42,   -94,   -94,   -94,   -94,   -94,
+     156,   155,   -94,   -94,   160,   -94,   161,   -94,   -94,   -94,
+     -94,    65,   -94,   -94,   -94,   -94,   -94,   -94,   -94,    35,
+     -94,   -94,     3,     3,   -94,   105,   162,   166,   167,   168,
+     169,   -94,    10,   -94,   170,   121,   123,   171,   172,   174,
+     176,   177,   178,   179,    11,   -94,   180,   129,   182,   183,
+      29,   -94,    29,   -94,    92,   184,   185,   186,    49,   -94,
+      49,   -94,   119,   187,   136,   189,   140,   190,    25,   -94,
+      25,   120,   -94,   -94,   -94,   191,     3,     3,     3,   192,
+     193,   -94,   143,   -94,   -94,   102,   181,   194,   149,   196,
+     199,   202,   -94,   157,   -94,   158,   159,   -94,    71,   -94,
+     163,   205,   164,   -94,    97,   -94,   165,   -94,   173,   -94,
+     102,   -94,    98,   -94,     3,   -94,   -94,   -94,    11,   188,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -13,   -13,
+      92,   -94,   -94,   -94,   -94,   -94,   120,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,   100,   -94,   107,   -94,   -94,   -94,
+     -94,   108,   -94,   -94,   -94,   114,   209,   122,   -94,   207,
+     188,   -94,   212,   -13,   -94,   -94,   -94,   -94,   216,   -94,
+     217,   -94,   210,   119,   -94,   130,   -94,   218,    47,   210,
+     -94,   -94,   -94,   -94,   219,   -94,   -94,   -94,   -94,   115,
+     -94,   -94,   -94,   -94,   -94,   -94,   222,   223,   141,   225,
+      47,   -94,   175,   226,   -94,   195,   -94,   -94,   227,   -94,
+     -94,   138,   -94,    38,   227,   -94,   -94,   228,   229,   231,
+     116,   -94,   -94,   -94,   -94,   -94,   -94,   232,   197,   198,
+     200,    38,   -94,   204,   -94,   -94,   -94,   -94,   -94
   };
 
   const unsigned char
@@ -2021,213 +2051,220 @@ namespace isc { namespace d2 {
        0,     2,     4,     6,     8,    10,    12,    14,    16,    18,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        1,    35,    28,    24,    23,    20,    21,    22,    27,     3,
-      25,    26,    42,     5,    54,     7,   150,     9,   142,    11,
+      25,    26,    42,     5,    54,     7,   155,     9,   147,    11,
      103,    13,    95,    15,   125,    17,   119,    19,    37,    31,
-       0,     0,     0,   144,     0,    97,     0,     0,    39,     0,
-      38,     0,     0,    32,   168,   170,   172,    52,   174,     0,
+       0,     0,     0,   149,     0,    97,     0,     0,    39,     0,
+      38,     0,     0,    32,   173,   175,   177,    52,   179,     0,
       51,     0,    44,    49,    46,    48,    50,    47,    69,     0,
-       0,    73,    77,    79,    81,    83,    85,   140,    68,     0,
+       0,    73,    77,    79,    81,    83,    85,   145,    68,     0,
       56,    58,    59,    60,    61,    62,    66,    67,    63,    64,
-      65,   163,     0,   166,   161,   160,   158,   159,     0,   152,
-     154,   155,   156,   157,   148,     0,   145,   146,   115,   117,
+      65,   168,     0,   171,   166,   165,   163,   164,     0,   157,
+     159,   160,   161,   162,   153,     0,   150,   151,   115,   117,
      113,   112,   110,   111,     0,   105,   107,   108,   109,   101,
-       0,    98,    99,   137,     0,   135,   134,   132,   133,     0,
-     127,   129,   130,   131,   123,     0,   121,    36,     0,     0,
-      29,     0,     0,     0,     0,     0,     0,    41,     0,    43,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,    55,     0,     0,     0,     0,     0,   151,     0,   143,
-       0,     0,     0,     0,     0,   104,     0,    96,     0,     0,
-       0,     0,     0,   126,     0,     0,   120,    40,    33,     0,
-       0,     0,     0,     0,     0,    45,     0,    71,    72,     0,
-       0,     0,     0,     0,     0,     0,    57,     0,   165,     0,
-       0,   153,     0,   147,     0,     0,     0,   106,     0,   100,
-       0,   139,     0,   128,     0,   122,     0,   169,   171,   173,
-       0,     0,    70,    75,    76,    74,    78,    30,    80,    82,
-      87,    87,   144,   164,   167,   162,   149,   116,     0,   114,
-     102,   138,   136,   124,    34,     0,   179,     0,   176,   178,
-      93,    92,     0,    88,    89,    91,     0,     0,     0,    53,
-       0,     0,   175,     0,     0,    84,    86,   141,   118,     0,
-     177,     0,    90,     0,    97,   183,     0,   181,     0,     0,
-       0,   180,    94,   194,   199,     0,   197,   193,   191,   192,
-       0,   185,   187,   189,   190,   188,   182,     0,     0,     0,
-       0,     0,   184,     0,     0,   196,     0,   186,   195,     0,
-     198,   203,     0,   201,     0,     0,   200,   211,     0,     0,
-       0,     0,   205,   207,   208,   209,   210,   202,     0,     0,
-       0,     0,     0,   204,     0,   213,   214,   215,   206,   212
+       0,    98,    99,   139,     0,   137,     0,   143,   136,   134,
+     135,     0,   127,   129,   130,   131,   132,   133,   123,     0,
+     121,    36,     0,     0,    29,     0,     0,     0,     0,     0,
+       0,    41,     0,    43,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,    55,     0,     0,     0,     0,
+       0,   156,     0,   148,     0,     0,     0,     0,     0,   104,
+       0,    96,     0,     0,     0,     0,     0,     0,     0,   126,
+       0,     0,   120,    40,    33,     0,     0,     0,     0,     0,
+       0,    45,     0,    71,    72,     0,     0,     0,     0,     0,
+       0,     0,    57,     0,   170,     0,     0,   158,     0,   152,
+       0,     0,     0,   106,     0,   100,     0,   141,     0,   142,
+       0,   128,     0,   122,     0,   174,   176,   178,     0,     0,
+      70,    75,    76,    74,    78,    30,    80,    82,    87,    87,
+     149,   169,   172,   167,   154,   116,     0,   114,   102,   140,
+     138,   144,   124,    34,     0,   184,     0,   181,   183,    93,
+      92,     0,    88,    89,    91,     0,     0,     0,    53,     0,
+       0,   180,     0,     0,    84,    86,   146,   118,     0,   182,
+       0,    90,     0,    97,   188,     0,   186,     0,     0,     0,
+     185,    94,   199,   204,     0,   202,   198,   196,   197,     0,
+     190,   192,   194,   195,   193,   187,     0,     0,     0,     0,
+       0,   189,     0,     0,   201,     0,   191,   200,     0,   203,
+     208,     0,   206,     0,     0,   205,   216,     0,     0,     0,
+       0,   210,   212,   213,   214,   215,   207,     0,     0,     0,
+       0,     0,   209,     0,   218,   219,   220,   211,   217
   };
 
   const signed char
   D2Parser::yypgoto_[] =
   {
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -38,   -90,    20,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   -50,   -90,   -90,   -90,    72,   -90,   -90,   -90,
-     -90,    -8,    63,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   -51,   -90,   -39,   -90,   -90,   -90,   -90,   -90,
-     -16,   -90,   -48,   -90,   -90,   -90,   -90,   -57,   -90,    50,
-     -90,   -90,   -90,    53,    56,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   -90,   -17,    48,   -90,   -90,   -90,    51,    52,
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -10,
-     -90,    71,   -90,   -90,   -90,    75,    82,   -90,   -90,   -90,
-     -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,
-     -90,   -90,   -90,   -27,   -90,   -90,   -90,   -45,   -90,   -90,
-     -60,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -90,   -73,
-     -90,   -90,   -89,   -90,   -90,   -90,   -90,   -90
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -39,   -94,    20,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -50,   -94,   -94,   -94,    76,   -94,   -94,   -94,
+     -94,    -9,    66,   -94,   -94,   -94,   -94,   -94,   -94,     1,
+     -94,   -94,   -51,   -94,   -37,   -94,   -94,   -94,   -94,   -94,
+     -17,   -94,   -49,   -94,   -94,   -94,   -94,   -58,   -94,    54,
+     -94,   -94,   -94,    57,    60,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -15,    48,   -94,   -94,   -94,    53,    62,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,    -8,   -94,    77,   -94,   -94,   -94,    80,    83,
+     -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -94,   -94,   -94,   -94,   -26,   -94,   -94,   -94,
+     -44,   -94,   -94,   -64,   -94,   -94,   -94,   -94,   -94,   -94,
+     -94,   -94,   -77,   -94,   -94,   -93,   -94,   -94,   -94,   -94,
+     -94
   };
 
   const short int
   D2Parser::yydefgoto_[] =
   {
       -1,    10,    11,    12,    13,    14,    15,    16,    17,    18,
-      19,    28,    29,    30,    49,   248,    62,    63,    31,    48,
-      59,    60,    88,    33,    50,    71,    72,    73,   155,    35,
-      51,    89,    90,    91,   160,    92,    93,    94,   163,   245,
-      95,   164,    96,   165,    97,   166,    98,   167,    99,   168,
-     272,   273,   274,   275,   283,    43,    55,   130,   131,   132,
-     186,    41,    54,   124,   125,   126,   183,   127,   181,   128,
-     182,    47,    57,   145,   146,   194,    45,    56,   139,   140,
-     141,   191,   142,   189,   143,   100,   169,    39,    53,   115,
-     116,   117,   178,    37,    52,   108,   109,   110,   175,   111,
-     172,   112,   113,   174,    74,   152,    75,   153,    76,   154,
-      77,   156,   267,   268,   269,   280,   296,   297,   299,   310,
-     311,   312,   317,   313,   314,   320,   315,   318,   332,   333,
-     334,   341,   342,   343,   348,   344,   345,   346
+      19,    28,    29,    30,    49,   256,    62,    63,    31,    48,
+      59,    60,    88,    33,    50,    71,    72,    73,   159,    35,
+      51,    89,    90,    91,   164,    92,    93,    94,   167,   253,
+      95,   168,    96,   169,    97,   170,    98,   171,    99,   172,
+     281,   282,   283,   284,   292,    43,    55,   130,   131,   132,
+     190,    41,    54,   124,   125,   126,   187,   127,   185,   128,
+     186,    47,    57,   149,   150,   200,    45,    56,   141,   142,
+     143,   195,   144,   193,   145,   146,   147,   197,   100,   173,
+      39,    53,   115,   116,   117,   182,    37,    52,   108,   109,
+     110,   179,   111,   176,   112,   113,   178,    74,   156,    75,
+     157,    76,   158,    77,   160,   276,   277,   278,   289,   305,
+     306,   308,   319,   320,   321,   326,   322,   323,   329,   324,
+     327,   341,   342,   343,   350,   351,   352,   357,   353,   354,
+     355
   };
 
   const unsigned short int
   D2Parser::yytable_[] =
   {
-      70,   106,   105,   122,   121,   137,   136,    21,    32,    22,
-      58,    23,    20,   107,   270,   123,    38,   138,    64,    65,
-      66,    67,   158,    78,    79,    80,    81,   159,    61,    82,
-      34,    83,    84,    85,    86,   133,   134,    83,    84,    87,
-      36,    69,    68,    83,    84,    40,   101,   102,   103,   170,
-     135,   104,    83,    84,   171,    24,    25,    26,    27,    83,
-      84,    69,    69,    42,   118,   119,   303,   304,    69,   305,
-     306,    44,   337,   120,    69,   338,   339,   340,    46,   176,
-     184,   192,   176,    69,   177,   185,   193,   256,   243,   244,
-      69,     1,     2,     3,     4,     5,     6,     7,     8,     9,
-     184,   192,   170,   114,   281,   260,   263,   279,    70,   282,
-     197,   198,   284,   284,   321,   352,   148,   285,   286,   322,
-     353,   195,   129,   144,   196,   106,   105,   106,   105,   195,
-     147,   149,   288,   122,   121,   122,   121,   107,   150,   107,
-     151,   137,   136,   137,   136,   123,   300,   123,   335,   301,
-     157,   336,   161,   138,   162,   138,   173,   179,   180,   187,
-     188,   199,   237,   238,   239,   190,   200,   201,   202,   203,
-     204,   206,   209,   207,   208,   210,   211,   212,   213,   214,
-     215,   217,   218,   219,   220,   224,   225,   226,   230,   231,
-     232,   236,   240,   242,   249,   241,    22,   250,   264,   246,
-     271,   271,   251,   252,   258,   289,   287,   253,   291,   254,
-     293,   255,   257,   259,   294,   295,   302,   319,   323,   324,
-     326,   349,   261,   262,   329,   331,   266,   350,   351,   354,
-     205,   247,   265,   216,   271,   276,   292,   298,   229,   228,
-     227,   278,   277,   235,   233,   234,   325,   328,   308,   307,
-     330,   223,   355,   222,   290,   316,   356,   357,   221,   359,
-     309,   327,   347,   358,     0,     0,     0,     0,     0,     0,
-     308,   307,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   309
+      70,   106,   105,   122,   121,   139,   138,    20,    21,    58,
+      22,   162,    23,   279,    38,   107,   163,   123,    42,   140,
+      64,    65,    66,    67,   174,    78,    79,    80,    81,   175,
+      32,    82,    46,    83,    84,    85,    86,    34,   201,   133,
+     134,   202,    69,    87,   180,   188,    68,    83,    84,   181,
+     189,    83,    84,    36,   135,   136,   137,    40,    24,    25,
+      26,    27,   101,   102,   103,    69,    69,   104,   198,    83,
+      84,    83,    84,   199,   180,    44,   118,   119,   346,   264,
+      69,   347,   348,   349,    69,   312,   313,   120,   314,   315,
+       1,     2,     3,     4,     5,     6,     7,     8,     9,   114,
+     188,   198,    69,   174,    69,   268,   272,    61,   288,   151,
+     290,   293,    70,   203,   204,   291,   294,   293,   330,   361,
+     251,   252,   295,   331,   362,   201,   129,   148,   297,   106,
+     105,   106,   105,   309,   152,   154,   310,   122,   121,   122,
+     121,   344,   155,   107,   345,   107,   153,   139,   138,   139,
+     138,   123,   161,   123,   165,   166,   177,   184,   192,   183,
+     205,   140,   191,   140,   194,   196,   206,   245,   246,   247,
+     207,   208,   209,   210,   212,   215,   216,   213,   217,   214,
+     218,   219,   220,   221,   223,   224,   225,   226,   230,   231,
+     232,   236,   237,   238,   240,   244,   239,   334,   250,   248,
+     249,    22,   254,   258,   257,   273,   259,   260,   280,   280,
+     266,   298,   261,   262,   263,   296,   300,   304,   265,   267,
+     269,   302,   303,   328,   311,   275,   332,   333,   270,   335,
+     337,   338,   358,   359,   340,   360,   363,   255,   211,   274,
+     222,   271,   285,   280,   301,   307,   235,   234,   233,   243,
+     339,   287,   286,   242,   365,   364,   366,   317,   316,   368,
+     241,   229,   228,   227,   299,   325,   336,   356,   367,     0,
+       0,   318,     0,     0,     0,     0,     0,     0,     0,   317,
+     316,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   318
   };
 
   const short int
   D2Parser::yycheck_[] =
   {
-      50,    52,    52,    54,    54,    56,    56,     5,     7,     7,
-      48,     9,     0,    52,    26,    54,     5,    56,    10,    11,
-      12,    13,     3,    14,    15,    16,    17,     8,    53,    20,
-       7,    22,    23,    24,    25,    14,    15,    22,    23,    30,
-       7,    53,    34,    22,    23,     7,    31,    32,    33,     3,
-      29,    36,    22,    23,     8,    53,    54,    55,    56,    22,
-      23,    53,    53,     5,    27,    28,    36,    37,    53,    39,
-      40,     7,    38,    36,    53,    41,    42,    43,     5,     3,
-       3,     3,     3,    53,     8,     8,     8,     8,    18,    19,
-      53,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-       3,     3,     3,     7,     3,     8,     8,     8,   158,     8,
-     148,   149,     3,     3,     3,     3,     3,     8,     8,     8,
-       8,     3,     7,     7,     6,   176,   176,   178,   178,     3,
-       6,     4,     6,   184,   184,   186,   186,   176,     8,   178,
-       3,   192,   192,   194,   194,   184,     3,   186,     3,     6,
-       4,     6,     4,   192,     4,   194,     4,     6,     3,     6,
-       3,    53,   200,   201,   202,     4,     4,     4,     4,     4,
-       4,     4,     4,    54,    54,     4,     4,     4,     4,     4,
-       4,     4,    54,     4,     4,     4,     4,     4,     4,    54,
-       4,     4,     7,    53,    53,     7,     7,     7,   236,    21,
-     250,   251,     7,     5,     5,     4,     6,    53,     4,    53,
-       5,    53,    53,    53,     5,     7,     6,     4,     4,     4,
-       4,     4,    53,    53,     5,     7,    35,     4,     4,     4,
-     158,   211,   240,   170,   284,   251,   284,   294,   188,   186,
-     184,   258,   252,   195,   192,   194,    54,    53,   299,   299,
-      53,   180,    56,   178,   281,   300,    54,    54,   176,    53,
-     299,   321,   335,   352,    -1,    -1,    -1,    -1,    -1,    -1,
-     321,   321,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,   321
+      50,    52,    52,    54,    54,    56,    56,     0,     5,    48,
+       7,     3,     9,    26,     5,    52,     8,    54,     5,    56,
+      10,    11,    12,    13,     3,    14,    15,    16,    17,     8,
+       7,    20,     5,    22,    23,    24,    25,     7,     3,    14,
+      15,     6,    55,    32,     3,     3,    36,    22,    23,     8,
+       8,    22,    23,     7,    29,    30,    31,     7,    55,    56,
+      57,    58,    33,    34,    35,    55,    55,    38,     3,    22,
+      23,    22,    23,     8,     3,     7,    27,    28,    40,     8,
+      55,    43,    44,    45,    55,    38,    39,    38,    41,    42,
+      46,    47,    48,    49,    50,    51,    52,    53,    54,     7,
+       3,     3,    55,     3,    55,     8,     8,    55,     8,     6,
+       3,     3,   162,   152,   153,     8,     8,     3,     3,     3,
+      18,    19,     8,     8,     8,     3,     7,     7,     6,   180,
+     180,   182,   182,     3,     3,     8,     6,   188,   188,   190,
+     190,     3,     3,   180,     6,   182,     4,   198,   198,   200,
+     200,   188,     4,   190,     4,     4,     4,     3,     3,     6,
+      55,   198,     6,   200,     4,     4,     4,   206,   207,   208,
+       4,     4,     4,     4,     4,     4,     4,    56,     4,    56,
+       4,     4,     4,     4,     4,    56,     4,     4,     4,     4,
+       4,     4,    56,     4,     4,     4,    56,    56,    55,     7,
+       7,     7,    21,     7,    55,   244,     7,     5,   258,   259,
+       5,     4,    55,    55,    55,     6,     4,     7,    55,    55,
+      55,     5,     5,     4,     6,    37,     4,     4,    55,     4,
+      55,     5,     4,     4,     7,     4,     4,   217,   162,   248,
+     174,   240,   259,   293,   293,   303,   192,   190,   188,   201,
+      55,   266,   260,   200,    56,    58,    56,   308,   308,    55,
+     198,   184,   182,   180,   290,   309,   330,   344,   361,    -1,
+      -1,   308,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   330,
+     330,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   330
   };
 
   const unsigned char
   D2Parser::yystos_[] =
   {
-       0,    44,    45,    46,    47,    48,    49,    50,    51,    52,
-      58,    59,    60,    61,    62,    63,    64,    65,    66,    67,
-       0,     5,     7,     9,    53,    54,    55,    56,    68,    69,
-      70,    75,     7,    80,     7,    86,     7,   150,     5,   144,
-       7,   118,     5,   112,     7,   133,     5,   128,    76,    71,
-      81,    87,   151,   145,   119,   113,   134,   129,    68,    77,
-      78,    53,    73,    74,    10,    11,    12,    13,    34,    53,
-      79,    82,    83,    84,   161,   163,   165,   167,    14,    15,
-      16,    17,    20,    22,    23,    24,    25,    30,    79,    88,
-      89,    90,    92,    93,    94,    97,    99,   101,   103,   105,
-     142,    31,    32,    33,    36,    79,    99,   101,   152,   153,
-     154,   156,   158,   159,     7,   146,   147,   148,    27,    28,
-      36,    79,    99,   101,   120,   121,   122,   124,   126,     7,
-     114,   115,   116,    14,    15,    29,    79,    99,   101,   135,
-     136,   137,   139,   141,     7,   130,   131,     6,     3,     4,
-       8,     3,   162,   164,   166,    85,   168,     4,     3,     8,
-      91,     4,     4,    95,    98,   100,   102,   104,   106,   143,
-       3,     8,   157,     4,   160,   155,     3,     8,   149,     6,
-       3,   125,   127,   123,     3,     8,   117,     6,     3,   140,
-       4,   138,     3,     8,   132,     3,     6,    68,    68,    53,
-       4,     4,     4,     4,     4,    83,     4,    54,    54,     4,
-       4,     4,     4,     4,     4,     4,    89,     4,    54,     4,
-       4,   153,   152,   148,     4,     4,     4,   121,   120,   116,
-       4,    54,     4,   136,   135,   131,     4,    68,    68,    68,
-       7,     7,    53,    18,    19,    96,    21,    70,    72,    53,
-       7,     7,     5,    53,    53,    53,     8,    53,     5,    53,
-       8,    53,    53,     8,    68,    88,    35,   169,   170,   171,
-      26,    79,   107,   108,   109,   110,   107,   146,   130,     8,
-     172,     3,     8,   111,     3,     8,     8,     6,     6,     4,
-     170,     4,   109,     5,     5,     7,   173,   174,   114,   175,
-       3,     6,     6,    36,    37,    39,    40,    79,    99,   101,
-     176,   177,   178,   180,   181,   183,   174,   179,   184,     4,
-     182,     3,     8,     4,     4,    54,     4,   177,    53,     5,
-      53,     7,   185,   186,   187,     3,     6,    38,    41,    42,
-      43,   188,   189,   190,   192,   193,   194,   186,   191,     4,
-       4,     4,     3,     8,     4,    56,    54,    54,   189,    53
+       0,    46,    47,    48,    49,    50,    51,    52,    53,    54,
+      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
+       0,     5,     7,     9,    55,    56,    57,    58,    70,    71,
+      72,    77,     7,    82,     7,    88,     7,   155,     5,   149,
+       7,   120,     5,   114,     7,   135,     5,   130,    78,    73,
+      83,    89,   156,   150,   121,   115,   136,   131,    70,    79,
+      80,    55,    75,    76,    10,    11,    12,    13,    36,    55,
+      81,    84,    85,    86,   166,   168,   170,   172,    14,    15,
+      16,    17,    20,    22,    23,    24,    25,    32,    81,    90,
+      91,    92,    94,    95,    96,    99,   101,   103,   105,   107,
+     147,    33,    34,    35,    38,    81,   101,   103,   157,   158,
+     159,   161,   163,   164,     7,   151,   152,   153,    27,    28,
+      38,    81,   101,   103,   122,   123,   124,   126,   128,     7,
+     116,   117,   118,    14,    15,    29,    30,    31,    81,   101,
+     103,   137,   138,   139,   141,   143,   144,   145,     7,   132,
+     133,     6,     3,     4,     8,     3,   167,   169,   171,    87,
+     173,     4,     3,     8,    93,     4,     4,    97,   100,   102,
+     104,   106,   108,   148,     3,     8,   162,     4,   165,   160,
+       3,     8,   154,     6,     3,   127,   129,   125,     3,     8,
+     119,     6,     3,   142,     4,   140,     4,   146,     3,     8,
+     134,     3,     6,    70,    70,    55,     4,     4,     4,     4,
+       4,    85,     4,    56,    56,     4,     4,     4,     4,     4,
+       4,     4,    91,     4,    56,     4,     4,   158,   157,   153,
+       4,     4,     4,   123,   122,   118,     4,    56,     4,    56,
+       4,   138,   137,   133,     4,    70,    70,    70,     7,     7,
+      55,    18,    19,    98,    21,    72,    74,    55,     7,     7,
+       5,    55,    55,    55,     8,    55,     5,    55,     8,    55,
+      55,    98,     8,    70,    90,    37,   174,   175,   176,    26,
+      81,   109,   110,   111,   112,   109,   151,   132,     8,   177,
+       3,     8,   113,     3,     8,     8,     6,     6,     4,   175,
+       4,   111,     5,     5,     7,   178,   179,   116,   180,     3,
+       6,     6,    38,    39,    41,    42,    81,   101,   103,   181,
+     182,   183,   185,   186,   188,   179,   184,   189,     4,   187,
+       3,     8,     4,     4,    56,     4,   182,    55,     5,    55,
+       7,   190,   191,   192,     3,     6,    40,    43,    44,    45,
+     193,   194,   195,   197,   198,   199,   191,   196,     4,     4,
+       4,     3,     8,     4,    58,    56,    56,   194,    55
   };
 
   const unsigned char
   D2Parser::yyr1_[] =
   {
-       0,    57,    59,    58,    60,    58,    61,    58,    62,    58,
-      63,    58,    64,    58,    65,    58,    66,    58,    67,    58,
-      68,    68,    68,    68,    68,    68,    68,    69,    71,    70,
-      72,    73,    73,    74,    74,    76,    75,    77,    77,    78,
-      78,    79,    81,    80,    82,    82,    83,    83,    83,    83,
-      83,    83,    85,    84,    87,    86,    88,    88,    89,    89,
-      89,    89,    89,    89,    89,    89,    89,    89,    89,    91,
-      90,    92,    93,    95,    94,    96,    96,    98,    97,   100,
-      99,   102,   101,   104,   103,   106,   105,   107,   107,   108,
-     108,   109,   109,   111,   110,   113,   112,   114,   114,   115,
-     115,   117,   116,   119,   118,   120,   120,   121,   121,   121,
-     121,   121,   121,   123,   122,   125,   124,   127,   126,   129,
-     128,   130,   130,   132,   131,   134,   133,   135,   135,   136,
-     136,   136,   136,   136,   136,   138,   137,   140,   139,   141,
-     143,   142,   145,   144,   146,   146,   147,   147,   149,   148,
-     151,   150,   152,   152,   153,   153,   153,   153,   153,   153,
-     153,   155,   154,   157,   156,   158,   160,   159,   162,   161,
-     164,   163,   166,   165,   168,   167,   169,   169,   170,   172,
-     171,   173,   173,   175,   174,   176,   176,   177,   177,   177,
-     177,   177,   177,   177,   179,   178,   180,   182,   181,   184,
-     183,   185,   185,   187,   186,   188,   188,   189,   189,   189,
-     189,   191,   190,   192,   193,   194
+       0,    59,    61,    60,    62,    60,    63,    60,    64,    60,
+      65,    60,    66,    60,    67,    60,    68,    60,    69,    60,
+      70,    70,    70,    70,    70,    70,    70,    71,    73,    72,
+      74,    75,    75,    76,    76,    78,    77,    79,    79,    80,
+      80,    81,    83,    82,    84,    84,    85,    85,    85,    85,
+      85,    85,    87,    86,    89,    88,    90,    90,    91,    91,
+      91,    91,    91,    91,    91,    91,    91,    91,    91,    93,
+      92,    94,    95,    97,    96,    98,    98,   100,    99,   102,
+     101,   104,   103,   106,   105,   108,   107,   109,   109,   110,
+     110,   111,   111,   113,   112,   115,   114,   116,   116,   117,
+     117,   119,   118,   121,   120,   122,   122,   123,   123,   123,
+     123,   123,   123,   125,   124,   127,   126,   129,   128,   131,
+     130,   132,   132,   134,   133,   136,   135,   137,   137,   138,
+     138,   138,   138,   138,   138,   138,   138,   140,   139,   142,
+     141,   143,   144,   146,   145,   148,   147,   150,   149,   151,
+     151,   152,   152,   154,   153,   156,   155,   157,   157,   158,
+     158,   158,   158,   158,   158,   158,   160,   159,   162,   161,
+     163,   165,   164,   167,   166,   169,   168,   171,   170,   173,
+     172,   174,   174,   175,   177,   176,   178,   178,   180,   179,
+     181,   181,   182,   182,   182,   182,   182,   182,   182,   184,
+     183,   185,   187,   186,   189,   188,   190,   190,   192,   191,
+     193,   193,   194,   194,   194,   194,   196,   195,   197,   198,
+     199
   };
 
   const unsigned char
@@ -2246,15 +2283,16 @@ namespace isc { namespace d2 {
        3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
        1,     1,     1,     0,     4,     0,     4,     0,     6,     0,
        4,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     1,     1,     0,     4,     0,     4,     3,
-       0,     6,     0,     4,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     0,     4,     3,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     6,     1,     3,     1,     0,
-       6,     1,     3,     0,     4,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     3,     0,     4,     0,
-       6,     1,     3,     0,     4,     1,     3,     1,     1,     1,
-       1,     0,     4,     3,     3,     3
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     3,     3,     0,     4,     0,     6,     0,     4,     0,
+       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
+       1,     1,     1,     1,     1,     1,     0,     4,     0,     4,
+       3,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       6,     1,     3,     1,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     3,     0,     4,     0,     6,     1,     3,     0,     4,
+       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
+       3
   };
 
 
@@ -2270,16 +2308,17 @@ namespace isc { namespace d2 {
   "\"dns-server-timeout\"", "\"ncr-protocol\"", "\"UDP\"", "\"TCP\"",
   "\"ncr-format\"", "\"JSON\"", "\"user-context\"", "\"comment\"",
   "\"forward-ddns\"", "\"reverse-ddns\"", "\"ddns-domains\"",
-  "\"key-name\"", "\"dns-servers\"", "\"hostname\"", "\"tsig-keys\"",
-  "\"algorithm\"", "\"digest-bits\"", "\"secret\"", "\"Logging\"",
-  "\"loggers\"", "\"name\"", "\"output_options\"", "\"output\"",
-  "\"debuglevel\"", "\"severity\"", "\"flush\"", "\"maxsize\"",
-  "\"maxver\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS",
-  "SUB_TSIG_KEY", "SUB_TSIG_KEYS", "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS",
-  "SUB_DNS_SERVER", "SUB_DNS_SERVERS", "\"constant string\"",
-  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
-  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value",
-  "sub_json", "map2", "$@10", "map_value", "map_content", "not_empty_map",
+  "\"key-name\"", "\"dns-servers\"", "\"hostname\"", "\"max-in-flight\"",
+  "\"protocol\"", "\"tsig-keys\"", "\"algorithm\"", "\"digest-bits\"",
+  "\"secret\"", "\"Logging\"", "\"loggers\"", "\"name\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
+  "\"flush\"", "\"maxsize\"", "\"maxver\"", "TOPLEVEL_JSON",
+  "TOPLEVEL_DHCPDDNS", "SUB_DHCPDDNS", "SUB_TSIG_KEY", "SUB_TSIG_KEYS",
+  "SUB_DDNS_DOMAIN", "SUB_DDNS_DOMAINS", "SUB_DNS_SERVER",
+  "SUB_DNS_SERVERS", "\"constant string\"", "\"integer\"",
+  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
+  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "value", "sub_json",
+  "map2", "$@10", "map_value", "map_content", "not_empty_map",
   "list_generic", "$@11", "list_content", "not_empty_list",
   "unknown_map_entry", "syntax_map", "$@12", "global_objects",
   "global_object", "dhcpddns_object", "$@13", "sub_dhcpddns", "$@14",
@@ -2295,46 +2334,48 @@ namespace isc { namespace d2 {
   "sub_dns_servers", "$@29", "dns_server_list", "dns_server", "$@30",
   "sub_dns_server", "$@31", "dns_server_params", "dns_server_param",
   "dns_server_hostname", "$@32", "dns_server_ip_address", "$@33",
-  "dns_server_port", "tsig_keys", "$@34", "sub_tsig_keys", "$@35",
-  "tsig_keys_list", "not_empty_tsig_keys_list", "tsig_key", "$@36",
-  "sub_tsig_key", "$@37", "tsig_key_params", "tsig_key_param",
-  "tsig_key_name", "$@38", "tsig_key_algorithm", "$@39",
-  "tsig_key_digest_bits", "tsig_key_secret", "$@40", "dhcp6_json_object",
-  "$@41", "dhcp4_json_object", "$@42", "control_agent_json_object", "$@43",
-  "logging_object", "$@44", "logging_params", "logging_param", "loggers",
-  "$@45", "loggers_entries", "logger_entry", "$@46", "logger_params",
-  "logger_param", "name", "$@47", "debuglevel", "severity", "$@48",
-  "output_options_list", "$@49", "output_options_list_content",
-  "output_entry", "$@50", "output_params_list", "output_params", "output",
-  "$@51", "flush", "maxsize", "maxver", YY_NULLPTR
+  "dns_server_port", "dns_server_max_in_flight", "dns_server_protocol",
+  "$@34", "tsig_keys", "$@35", "sub_tsig_keys", "$@36", "tsig_keys_list",
+  "not_empty_tsig_keys_list", "tsig_key", "$@37", "sub_tsig_key", "$@38",
+  "tsig_key_params", "tsig_key_param", "tsig_key_name", "$@39",
+  "tsig_key_algorithm", "$@40", "tsig_key_digest_bits", "tsig_key_secret",
+  "$@41", "dhcp6_json_object", "$@42", "dhcp4_json_object", "$@43",
+  "control_agent_json_object", "$@44", "logging_object", "$@45",
+  "logging_params", "logging_param", "loggers", "$@46", "loggers_entries",
+  "logger_entry", "$@47", "logger_params", "logger_param", "name", "$@48",
+  "debuglevel", "severity", "$@49", "output_options_list", "$@50",
+  "output_options_list_content", "output_entry", "$@51",
+  "output_params_list", "output_params", "output", "$@52", "flush",
+  "maxsize", "maxver", YY_NULLPTR
   };
 
 #if D2_PARSER_DEBUG
   const unsigned short int
   D2Parser::yyrline_[] =
   {
-       0,   120,   120,   120,   121,   121,   122,   122,   123,   123,
-     124,   124,   125,   125,   126,   126,   127,   127,   128,   128,
-     136,   137,   138,   139,   140,   141,   142,   145,   150,   150,
-     161,   164,   165,   168,   172,   179,   179,   186,   187,   190,
-     194,   205,   215,   215,   227,   228,   232,   233,   234,   235,
-     236,   237,   242,   242,   252,   252,   260,   261,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   275,   278,
-     278,   286,   294,   303,   303,   311,   312,   315,   315,   323,
-     323,   348,   348,   375,   375,   385,   385,   395,   396,   399,
-     400,   403,   404,   409,   409,   419,   419,   426,   427,   430,
-     431,   434,   434,   442,   442,   449,   450,   453,   454,   455,
-     456,   457,   458,   462,   462,   474,   474,   486,   486,   496,
-     496,   503,   504,   507,   507,   515,   515,   522,   523,   526,
-     527,   528,   529,   530,   531,   534,   534,   546,   546,   554,
-     568,   568,   578,   578,   585,   586,   589,   590,   593,   593,
-     601,   601,   610,   611,   614,   615,   616,   617,   618,   619,
-     620,   623,   623,   635,   635,   646,   654,   654,   669,   669,
-     676,   676,   683,   683,   695,   695,   708,   709,   713,   717,
-     717,   729,   730,   734,   734,   742,   743,   746,   747,   748,
-     749,   750,   751,   752,   755,   755,   763,   767,   767,   775,
-     775,   785,   786,   789,   789,   797,   798,   801,   802,   803,
-     804,   807,   807,   815,   820,   825
+       0,   122,   122,   122,   123,   123,   124,   124,   125,   125,
+     126,   126,   127,   127,   128,   128,   129,   129,   130,   130,
+     138,   139,   140,   141,   142,   143,   144,   147,   152,   152,
+     163,   166,   167,   170,   174,   181,   181,   188,   189,   192,
+     196,   207,   217,   217,   229,   230,   234,   235,   236,   237,
+     238,   239,   244,   244,   254,   254,   262,   263,   267,   268,
+     269,   270,   271,   272,   273,   274,   275,   276,   277,   280,
+     280,   288,   296,   305,   305,   313,   314,   317,   317,   325,
+     325,   350,   350,   377,   377,   387,   387,   397,   398,   401,
+     402,   405,   406,   411,   411,   421,   421,   428,   429,   432,
+     433,   436,   436,   444,   444,   451,   452,   455,   456,   457,
+     458,   459,   460,   464,   464,   476,   476,   488,   488,   498,
+     498,   505,   506,   509,   509,   517,   517,   524,   525,   528,
+     529,   530,   531,   532,   533,   534,   535,   538,   538,   550,
+     550,   558,   566,   575,   575,   588,   588,   598,   598,   605,
+     606,   609,   610,   613,   613,   621,   621,   630,   631,   634,
+     635,   636,   637,   638,   639,   640,   643,   643,   655,   655,
+     666,   674,   674,   689,   689,   696,   696,   703,   703,   715,
+     715,   728,   729,   733,   737,   737,   749,   750,   754,   754,
+     762,   763,   766,   767,   768,   769,   770,   771,   772,   775,
+     775,   783,   787,   787,   795,   795,   805,   806,   809,   809,
+     817,   818,   821,   822,   823,   824,   827,   827,   835,   840,
+     845
   };
 
   // Print the state stack on the debug stream.
@@ -2369,8 +2410,8 @@ namespace isc { namespace d2 {
 
 #line 14 "d2_parser.yy" // lalr1.cc:1167
 } } // isc::d2
-#line 2373 "d2_parser.cc" // lalr1.cc:1167
-#line 830 "d2_parser.yy" // lalr1.cc:1168
+#line 2414 "d2_parser.cc" // lalr1.cc:1167
+#line 850 "d2_parser.yy" // lalr1.cc:1168
 
 
 void
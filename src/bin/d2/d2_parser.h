@@ -370,33 +370,35 @@ namespace isc { namespace d2 {
         TOKEN_KEY_NAME = 282,
         TOKEN_DNS_SERVERS = 283,
         TOKEN_HOSTNAME = 284,
-        TOKEN_TSIG_KEYS = 285,
-        TOKEN_ALGORITHM = 286,
-        TOKEN_DIGEST_BITS = 287,
-        TOKEN_SECRET = 288,
-        TOKEN_LOGGING = 289,
-        TOKEN_LOGGERS = 290,
-        TOKEN_NAME = 291,
-        TOKEN_OUTPUT_OPTIONS = 292,
-        TOKEN_OUTPUT = 293,
-        TOKEN_DEBUGLEVEL = 294,
-        TOKEN_SEVERITY = 295,
-        TOKEN_FLUSH = 296,
-        TOKEN_MAXSIZE = 297,
-        TOKEN_MAXVER = 298,
-        TOKEN_TOPLEVEL_JSON = 299,
-        TOKEN_TOPLEVEL_DHCPDDNS = 300,
-        TOKEN_SUB_DHCPDDNS = 301,
-        TOKEN_SUB_TSIG_KEY = 302,
-        TOKEN_SUB_TSIG_KEYS = 303,
-        TOKEN_SUB_DDNS_DOMAIN = 304,
-        TOKEN_SUB_DDNS_DOMAINS = 305,
-        TOKEN_SUB_DNS_SERVER = 306,
-        TOKEN_SUB_DNS_SERVERS = 307,
-        TOKEN_STRING = 308,
-        TOKEN_INTEGER = 309,
-        TOKEN_FLOAT = 310,
-        TOKEN_BOOLEAN = 311
+        TOKEN_MAX_IN_FLIGHT = 285,
+        TOKEN_PROTOCOL = 286,
+        TOKEN_TSIG_KEYS = 287,
+        TOKEN_ALGORITHM = 288,
+        TOKEN_DIGEST_BITS = 289,
+        TOKEN_SECRET = 290,
+        TOKEN_LOGGING = 291,
+        TOKEN_LOGGERS = 292,
+        TOKEN_NAME = 293,
+        TOKEN_OUTPUT_OPTIONS = 294,
+        TOKEN_OUTPUT = 295,
+        TOKEN_DEBUGLEVEL = 296,
+        TOKEN_SEVERITY = 297,
+        TOKEN_FLUSH = 298,
+        TOKEN_MAXSIZE = 299,
+        TOKEN_MAXVER = 300,
+        TOKEN_TOPLEVEL_JSON = 301,
+        TOKEN_TOPLEVEL_DHCPDDNS = 302,
+        TOKEN_SUB_DHCPDDNS = 303,
+        TOKEN_SUB_TSIG_KEY = 304,
+        TOKEN_SUB_TSIG_KEYS = 305,
+        TOKEN_SUB_DDNS_DOMAIN = 306,
+        TOKEN_SUB_DDNS_DOMAINS = 307,
+        TOKEN_SUB_DNS_SERVER = 308,
+        TOKEN_SUB_DNS_SERVERS = 309,
+        TOKEN_STRING = 310,
+        TOKEN_INTEGER = 311,
+        TOKEN_FLOAT = 312,
+        TOKEN_BOOLEAN = 313
       };
     };
 
@@ -623,6 +625,14 @@ namespace isc { namespace d2 {
     symbol_type
     make_HOSTNAME (const location_type& l);
 
+    static inline
+    symbol_type
+    make_MAX_IN_FLIGHT (const location_type& l);
+
+    static inline
+    symbol_type
+    make_PROTOCOL (const location_type& l);
+
     static inline
     symbol_type
     make_TSIG_KEYS (const location_type& l);
@@ -936,12 +946,12 @@ namespace isc { namespace d2 {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 282,     ///< Last index in yytable_.
-      yynnts_ = 138,  ///< Number of nonterminal symbols.
+      yylast_ = 293,     ///< Last index in yytable_.
+      yynnts_ = 141,  ///< Number of nonterminal symbols.
       yyfinal_ = 20, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 57  ///< Number of tokens.
+      yyntokens_ = 59  ///< Number of tokens.
     };
 
 
@@ -989,9 +999,9 @@ namespace isc { namespace d2 {
       25,    26,    27,    28,    29,    30,    31,    32,    33,    34,
       35,    36,    37,    38,    39,    40,    41,    42,    43,    44,
       45,    46,    47,    48,    49,    50,    51,    52,    53,    54,
-      55,    56
+      55,    56,    57,    58
     };
-    const unsigned int user_token_number_max_ = 311;
+    const unsigned int user_token_number_max_ = 313;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1024,25 +1034,25 @@ namespace isc { namespace d2 {
   {
       switch (other.type_get ())
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1063,25 +1073,25 @@ namespace isc { namespace d2 {
     (void) v;
       switch (this->type_get ())
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1161,25 +1171,25 @@ namespace isc { namespace d2 {
     // Type destructor.
     switch (yytype)
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1206,25 +1216,25 @@ namespace isc { namespace d2 {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 68: // value
-      case 72: // map_value
-      case 96: // ncr_protocol_value
+      case 70: // value
+      case 74: // map_value
+      case 98: // ncr_protocol_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 56: // "boolean"
+      case 58: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 55: // "floating point"
+      case 57: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 54: // "integer"
+      case 56: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 53: // "constant string"
+      case 55: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1288,7 +1298,7 @@ namespace isc { namespace d2 {
      275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
      285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
      295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311
+     305,   306,   307,   308,   309,   310,   311,   312,   313
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -1461,6 +1471,18 @@ namespace isc { namespace d2 {
     return symbol_type (token::TOKEN_HOSTNAME, l);
   }
 
+  D2Parser::symbol_type
+  D2Parser::make_MAX_IN_FLIGHT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_MAX_IN_FLIGHT, l);
+  }
+
+  D2Parser::symbol_type
+  D2Parser::make_PROTOCOL (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_PROTOCOL, l);
+  }
+
   D2Parser::symbol_type
   D2Parser::make_TSIG_KEYS (const location_type& l)
   {
@@ -1626,7 +1648,7 @@ namespace isc { namespace d2 {
 
 #line 14 "d2_parser.yy" // lalr1.cc:377
 } } // isc::d2
-#line 1630 "d2_parser.h" // lalr1.cc:377
+#line 1652 "d2_parser.h" // lalr1.cc:377
 
 
 
@@ -70,6 +70,8 @@ using namespace std;
   KEY_NAME "key-name"
   DNS_SERVERS "dns-servers"
   HOSTNAME "hostname"
+  MAX_IN_FLIGHT "max-in-flight"
+  PROTOCOL "protocol"
   TSIG_KEYS "tsig-keys"
   ALGORITHM "algorithm"
   DIGEST_BITS "digest-bits"
@@ -526,6 +528,8 @@ dns_server_params: dns_server_param
 dns_server_param: dns_server_hostname
               | dns_server_ip_address
               | dns_server_port
+              | dns_server_max_in_flight
+              | dns_server_protocol
               | user_context
               | comment
               | unknown_map_entry
@@ -559,6 +563,22 @@ dns_server_port: PORT COLON INTEGER {
     ctx.stack_.back()->set("port", i);
 };
 
+dns_server_max_in_flight: MAX_IN_FLIGHT COLON INTEGER {
+    if ($3 < 0) {
+        error(@3, "max-in-flight cannot be negative");
+    }
+    ElementPtr i(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("max-in-flight", i);
+};
+
+// The values are the same as for the ncr-protocol.
+dns_server_protocol: PROTOCOL {
+    ctx.enter(ctx.NCR_PROTOCOL);
+} COLON ncr_protocol_value {
+    ctx.stack_.back()->set("protocol", $4);
+    ctx.leave();
+};
+
 // --- end of dns-servers ---------------------------------
 
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -80,6 +80,8 @@ D2Process::run() {
     // this might be the place to do it, once there is a persistence mgr.
     // This may also be better in checkQueueStatus.
 
+    logServerStats();
+
     LOG_DEBUG(d2_logger, isc::log::DBGLVL_START_SHUT, DHCP_DDNS_RUN_EXIT);
 
 };
@@ -197,6 +199,12 @@ D2Process::configure(isc::data::ConstElementPtr config_set, bool check_only) {
         .arg(check_only ? "check" : "update")
         .arg(config_set->str());
 
+    // The statistics are held by the DNS servers of the current
+    // configuration, which is about to be replaced.
+    if (!check_only) {
+        logServerStats();
+    }
+
     isc::data::ConstElementPtr answer;
     answer = getCfgMgr()->parseConfig(config_set, check_only);;
     if (check_only) {
@@ -311,6 +319,43 @@ D2Process::checkQueueStatus() {
     }
 }
 
+void
+D2Process::logServerStats() {
+    D2CfgContextPtr context = getD2CfgMgr()->getD2CfgContext();
+    if (!context) {
+        return;
+    }
+
+    DdnsDomainListMgrPtr mgrs[] = { context->getForwardMgr(),
+                                    context->getReverseMgr() };
+    for (size_t i = 0; i < sizeof(mgrs) / sizeof(mgrs[0]); ++i) {
+        if (!mgrs[i] || !mgrs[i]->getDomains()) {
+            continue;
+        }
+
+        const DdnsDomainMapPtr& domains = mgrs[i]->getDomains();
+        for (DdnsDomainMap::const_iterator domain = domains->begin();
+             domain != domains->end(); ++domain) {
+            const DnsServerInfoStoragePtr& servers = domain->second->getServers();
+            if (!servers) {
+                continue;
+            }
+
+            for (DnsServerInfoStorage::const_iterator server = servers->begin();
+                 server != servers->end(); ++server) {
+                // Skip the servers which have not been used at all.
+                if ((*server)->getStats().sent_ == 0) {
+                    continue;
+                }
+                LOG_INFO(d2_logger, DHCP_DDNS_SERVER_STATS)
+                    .arg(domain->first)
+                    .arg((*server)->toText())
+                    .arg((*server)->statsToText());
+            }
+        }
+    }
+}
+
 void
 D2Process::reconfigureQueueMgr() {
     // Set reconfigure flag to false.  We are only here because we have
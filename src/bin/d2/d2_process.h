@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -205,6 +205,14 @@ protected:
     /// This method is exception safe.
     virtual void reconfigureQueueMgr();
 
+    /// @brief Logs the statistics of the DNS servers.
+    ///
+    /// Logs the update statistics of each DNS server of the current
+    /// configuration to which at least one update has been sent. It is
+    /// called when the event loop exits and before the configuration
+    /// (and thus the statistics) is replaced.
+    void logServerStats();
+
     /// @brief Allows IO processing to run until at least callback is invoked.
     ///
     /// This method is called from within the D2Process main event loop and is
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <d2/nc_add.h>
 #include <d2/nc_remove.h>
 
+#include <set>
 #include <sstream>
 #include <iostream>
 #include <vector>
@@ -42,19 +43,19 @@ D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
 
 D2UpdateMgr::~D2UpdateMgr() {
     transaction_list_.clear();
+    // The TCP connections to the DNS servers use our IO service.
+    DNSClient::closeTCPConnections();
 }
 
 void D2UpdateMgr::sweep() {
     // cleanup finished transactions;
     checkFinishedTransactions();
 
-    // if the queue isn't empty, find the next suitable job and
-    // start a transaction for it.
-    // @todo - Do we want to queue max transactions? The logic here will only
-    // start one new transaction per invocation.  On the other hand a busy
-    // system will generate many IO events and this method will be called
-    // frequently.  It will likely achieve max transactions quickly on its own.
-    if (getQueueCount() > 0)  {
+    // While the queue isn't empty, find the next suitable job and start
+    // a transaction for it. Starting as many transactions as allowed at
+    // once lets a burst of requests be sent to the DNS servers in parallel
+    // rather than one per IO event.
+    while (getQueueCount() > 0)  {
         if (getTransactionCount() >= max_transactions_) {
             LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
                       DHCP_DDNS_AT_MAX_TRANSACTIONS).arg(getQueueCount())
@@ -64,7 +65,9 @@ void D2UpdateMgr::sweep() {
         }
 
         // We are not at maximum transactions, so pick and start the next job.
-        pickNextJob();
+        if (!pickNextJob()) {
+            return;
+        }
     }
 }
 
@@ -91,28 +94,95 @@ D2UpdateMgr::checkFinishedTransactions() {
     }
 }
 
-void D2UpdateMgr::pickNextJob() {
+bool D2UpdateMgr::pickNextJob() {
     // Start at the front of the queue, looking for the first entry for
     // which no transaction is in progress.  If we find an eligible entry
     // remove it from the queue and  make a transaction for it.
     // Requests and transactions are associated by DHCID.  If a request has
     // the same DHCID as a transaction, they are presumed to be for the same
     // "end user".
+    // Requests skipped because their servers are busy hold back later
+    // requests with the same DHCID, so the order of the changes for the
+    // same "end user" is preserved.
+    std::set<TransactionKey> skipped;
     size_t queue_count = getQueueCount();
+
+    // The domains remembered for the postponed requests belong to the
+    // configuration they have been matched with. The requests which are
+    // no longer queued, e.g. because the queue has been cleared, are
+    // forgotten when there are more of them than queued requests.
+    D2CfgContextPtr context = cfg_mgr_->getD2CfgContext();
+    if (context != matched_context_) {
+        matched_domains_.clear();
+        matched_context_ = context;
+
+    } else if (matched_domains_.size() > queue_count) {
+        std::map<dhcp_ddns::NameChangeRequestPtr, MatchedDomains> queued;
+        for (size_t index = 0; index < queue_count; ++index) {
+            auto match = matched_domains_.find(queue_mgr_->peekAt(index));
+            if (match != matched_domains_.end()) {
+                queued.insert(*match);
+            }
+        }
+        matched_domains_.swap(queued);
+    }
+
     for (size_t index = 0; index < queue_count; ++index) {
         dhcp_ddns::NameChangeRequestPtr found_ncr = queue_mgr_->peekAt(index);
-        if (!hasTransaction(found_ncr->getDhcid())) {
+        const TransactionKey key = found_ncr->getDhcid();
+        if (hasTransaction(key) || (skipped.count(key) > 0)) {
+            continue;
+        }
+
+        DdnsDomainPtr forward_domain;
+        DdnsDomainPtr reverse_domain;
+        auto match = matched_domains_.find(found_ncr);
+        if (match != matched_domains_.end()) {
+            forward_domain = match->second.first;
+            reverse_domain = match->second.second;
+
+        } else if (!matchDomains(found_ncr, forward_domain, reverse_domain)) {
+            // There is nothing to do for this request. It has been logged,
+            // so just discard it.
             queue_mgr_->dequeueAt(index);
-            makeTransaction(found_ncr);
-            return;
+            return (true);
+        }
+
+        if (!serverAvailable(forward_domain) ||
+            !serverAvailable(reverse_domain)) {
+            if (match == matched_domains_.end()) {
+                matched_domains_[found_ncr] = MatchedDomains(forward_domain,
+                                                             reverse_domain);
+            }
+            skipped.insert(key);
+            continue;
+        }
+
+        if (match != matched_domains_.end()) {
+            matched_domains_.erase(match);
         }
+        queue_mgr_->dequeueAt(index);
+        startNewTransaction(found_ncr, forward_domain, reverse_domain);
+        return (true);
     }
 
     // There were no eligible jobs. All of the current DHCIDs already have
-    // transactions pending.
+    // transactions pending or their servers are busy.
     LOG_DEBUG(dhcp_to_d2_logger, isc::log::DBGLVL_TRACE_DETAIL_DATA,
               DHCP_DDNS_NO_ELIGIBLE_JOBS)
         .arg(getQueueCount()).arg(getTransactionCount());
+    return (false);
+}
+
+bool
+D2UpdateMgr::serverAvailable(const DdnsDomainPtr& domain) {
+    // The transaction sends its first update to the first server of the
+    // domain, so this is the server which must accept it.
+    if (!domain) {
+        return (true);
+    }
+    const DnsServerInfoStoragePtr& servers = domain->getServers();
+    return (!servers || servers->empty() || (*servers)[0]->isAvailable());
 }
 
 void
@@ -127,9 +197,19 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
             << key.toStr());
     }
 
+    DdnsDomainPtr forward_domain;
+    DdnsDomainPtr reverse_domain;
+    if (matchDomains(next_ncr, forward_domain, reverse_domain)) {
+        startNewTransaction(next_ncr, forward_domain, reverse_domain);
+    }
+}
+
+bool
+D2UpdateMgr::matchDomains(dhcp_ddns::NameChangeRequestPtr& next_ncr,
+                          DdnsDomainPtr& forward_domain,
+                          DdnsDomainPtr& reverse_domain) {
     int direction_count = 0;
     // If forward change is enabled, match to forward servers.
-    DdnsDomainPtr forward_domain;
     if (next_ncr->isForwardChange()) {
         if (!cfg_mgr_->forwardUpdatesEnabled()) {
             next_ncr->setForwardChange(false);
@@ -147,7 +227,7 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
                 LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_NO_FWD_MATCH_ERROR)
                           .arg(next_ncr->getRequestId())
                           .arg(next_ncr->toText());
-                return;
+                return (false);
             }
 
             ++direction_count;
@@ -155,7 +235,6 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     }
 
     // If reverse change is enabled, match to reverse servers.
-    DdnsDomainPtr reverse_domain;
     if (next_ncr->isReverseChange()) {
         if (!cfg_mgr_->reverseUpdatesEnabled()) {
             next_ncr->setReverseChange(false);
@@ -173,7 +252,7 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
                 LOG_ERROR(dhcp_to_d2_logger, DHCP_DDNS_NO_REV_MATCH_ERROR)
                           .arg(next_ncr->getRequestId())
                           .arg(next_ncr->toText());
-                return;
+                return (false);
             }
 
             ++direction_count;
@@ -187,9 +266,16 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
                   DHCP_DDNS_REQUEST_DROPPED)
                   .arg(next_ncr->getRequestId())
                   .arg(next_ncr->toText());
-        return;
+        return (false);
     }
 
+    return (true);
+}
+
+void
+D2UpdateMgr::startNewTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr,
+                                 DdnsDomainPtr& forward_domain,
+                                 DdnsDomainPtr& reverse_domain) {
     // We matched to the required servers, so construct the transaction.
     // @todo If multi-threading is implemented, one would pass in an
     // empty IOServicePtr, rather than our instance value.  This would cause
@@ -207,7 +293,7 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     }
 
     // Add the new transaction to the list.
-    transaction_list_[key] = trans;
+    transaction_list_[next_ncr->getDhcid()] = trans;
 
     // Start it.
     trans->startTransaction();
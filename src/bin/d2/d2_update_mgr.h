@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -57,6 +57,13 @@ typedef std::map<TransactionKey, NameChangeTransactionPtr> TransactionList;
 /// transactions complete,  D2UpdateMgr removes them from the transaction list,
 /// replacing them with new transactions.
 ///
+/// The DNS servers may limit the number of updates concurrently sent to them
+/// (see @c DnsServerInfo::getMaxInFlight). Requests which would be sent to
+/// a server which has reached its limit are left on the queue, and the
+/// requests behind them which can be sent to other servers are processed
+/// first. A request is never selected ahead of an earlier queued request for
+/// the same DHCID, so the requests of each client are processed in order.
+///
 /// D2UpdateMgr carries out each of the above steps, with a method called
 /// sweep().  This method is intended to be called as IO events complete.
 /// The upper layer(s) are responsible for calling sweep in a timely and cyclic
@@ -106,11 +113,9 @@ public:
     ///
     /// - Removes all completed transactions from the transaction list.
     ///
-    /// - If the request queue is not empty and the number of transactions
-    /// in the transaction list has not reached maximum allowed, then select
-    /// a request from the queue.
-    ///
-    /// - If a request was selected, start a new transaction for it and
+    /// - While the request queue is not empty and the number of transactions
+    /// in the transaction list has not reached maximum allowed, select
+    /// a request from the queue, start a new transaction for it and
     /// add the transaction to the list of transactions.
     void sweep();
 
@@ -127,15 +132,38 @@ protected:
     /// This method will scan the request queue for the next request to
     /// dequeue.  The current implementation starts at the front of the queue
     /// and looks for the first request for whose DHCID there is no current
-    /// transaction in progress.
+    /// transaction in progress, for whose DHCID there is no earlier request
+    /// left on the queue and whose DNS servers can accept another update.
     ///
     /// If a request is selected, it is removed from the queue and transaction
     /// is constructed for it.
     ///
-    /// It is possible that no such request exists, though this is likely to be
-    /// rather rare unless a system is frequently seeing requests for the same
-    /// clients in quick succession.
-    void pickNextJob();
+    /// It is possible that no such request exists, e.g. when the system is
+    /// frequently seeing requests for the same clients in quick succession
+    /// or when all servers have reached their limits of concurrent updates.
+    ///
+    /// @return true if a request has been selected, false otherwise.
+    bool pickNextJob();
+
+    /// @brief Returns the number of queued requests with remembered domains.
+    ///
+    /// The domains are remembered for the requests which are postponed
+    /// because their DNS servers are busy.
+    size_t getMatchedRequestCount() const {
+        return (matched_domains_.size());
+    }
+
+    /// @brief Checks if the DNS server of the domain can accept an update.
+    ///
+    /// Checks that the first server of the domain, which is the server
+    /// the transaction sends its first update to, has not reached its
+    /// limit of concurrent updates.
+    ///
+    /// @param domain the domain matched to the request. It may be null
+    /// when the request doesn't ask for the change in this direction.
+    ///
+    /// @return true if the update may be sent to the server now.
+    static bool serverAvailable(const DdnsDomainPtr& domain);
 
     /// @brief Create a new transaction for the given request.
     ///
@@ -161,6 +189,30 @@ protected:
     /// exists. Note this would be programmatic error.
     void makeTransaction(isc::dhcp_ddns::NameChangeRequestPtr& ncr);
 
+    /// @brief Matches the request to the forward and reverse domains.
+    ///
+    /// This implements the matching of the request described for
+    /// @c makeTransaction, including the logging of the discarded requests.
+    ///
+    /// @param ncr the NameChangeRequest to match.
+    /// @param [out] forward_domain the matched forward domain.
+    /// @param [out] reverse_domain the matched reverse domain.
+    ///
+    /// @return true if the request matched the domains for all requested
+    /// and enabled directions, false if the request should be discarded.
+    bool matchDomains(isc::dhcp_ddns::NameChangeRequestPtr& ncr,
+                      DdnsDomainPtr& forward_domain,
+                      DdnsDomainPtr& reverse_domain);
+
+    /// @brief Creates and starts a transaction for the matched request.
+    ///
+    /// @param ncr the NameChangeRequest for which to create a transaction.
+    /// @param forward_domain the matched forward domain.
+    /// @param reverse_domain the matched reverse domain.
+    void startNewTransaction(isc::dhcp_ddns::NameChangeRequestPtr& ncr,
+                             DdnsDomainPtr& forward_domain,
+                             DdnsDomainPtr& reverse_domain);
+
 public:
     /// @brief Gets the D2UpdateMgr's IOService.
     ///
@@ -245,6 +297,19 @@ private:
 
     /// @brief List of transactions.
     TransactionList transaction_list_;
+
+    /// @brief Forward and reverse domains matched to a request.
+    typedef std::pair<DdnsDomainPtr, DdnsDomainPtr> MatchedDomains;
+
+    /// @brief Domains matched to the queued requests.
+    ///
+    /// The requests postponed because their DNS servers are busy are
+    /// examined by each invocation of @c pickNextJob, so their domains
+    /// are remembered rather than matched again.
+    std::map<dhcp_ddns::NameChangeRequestPtr, MatchedDomains> matched_domains_;
+
+    /// @brief Configuration context the remembered domains belong to.
+    D2CfgContextPtr matched_context_;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
@@ -1,14 +1,27 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/interval_timer.h>
 #include <d2/dns_client.h>
 #include <d2/d2_log.h>
 #include <dns/messagerenderer.h>
+
+#include <boost/asio/ip/tcp.hpp>
+#include <boost/bind.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <boost/function.hpp>
+#include <algorithm>
+#include <deque>
 #include <limits>
+#include <list>
+#include <map>
+#include <sstream>
+#include <vector>
 
 namespace isc {
 namespace d2 {
@@ -20,6 +33,10 @@ namespace {
 // DNSClient class.
 const size_t DEFAULT_BUFFER_SIZE = 128;
 
+// Maximum size of a DNS message sent over UDP without EDNS (RFC 1035,
+// section 4.2.1). Larger messages are sent over TCP.
+const size_t MAX_UDP_MESSAGE_SIZE = 512;
+
 }
 
 using namespace isc::util;
@@ -27,6 +44,650 @@ using namespace isc::asiolink;
 using namespace isc::asiodns;
 using namespace isc::dns;
 
+class DNSTCPConnection;
+
+// Pointer to the TCP connection to a DNS server.
+typedef boost::shared_ptr<DNSTCPConnection> DNSTCPConnectionPtr;
+
+// This class represents a persistent TCP connection to a DNS server. The
+// connection is shared by all DNSClient instances sending updates to the
+// same server. The update messages are pipelined over the connection, i.e.
+// a message is sent without waiting for the responses to the previous
+// messages, and the responses are matched with the requests by the message
+// ID (RFC 7766). A message having the same ID as a message in flight is
+// held until the exchange of the latter completes. The connection is
+// established when the first message is sent and remains open when there
+// are no messages in flight, so it can be reused for the subsequent
+// messages. If the connection is lost, it is
+// reestablished and the messages which have not been answered yet are sent
+// again, once.
+class DNSTCPConnection : public boost::enable_shared_from_this<DNSTCPConnection> {
+public:
+    // Type of the function invoked when the message exchange completes.
+    typedef boost::function<void(const DNSClient::Status&)> Handler;
+
+    // Constructor.
+    DNSTCPConnection(IOService& io_service, const IOAddress& address,
+                     const uint16_t port);
+
+    // Destructor.
+    ~DNSTCPConnection();
+
+    // Returns the connection to the given server, creating it if it doesn't
+    // exist.
+    static DNSTCPConnectionPtr get(IOService& io_service,
+                                   const IOAddress& address,
+                                   const uint16_t port);
+
+    // Closes all connections.
+    static void closeAll();
+
+    // Returns the number of connections.
+    static size_t count();
+
+    // Starts the exchange of the message with the server. The response is
+    // written to the response buffer and the handler is invoked when the
+    // response is received, the wait time elapses or the message can't
+    // be sent. Returns the identifier of the exchange.
+    uint64_t send(const OutputBufferPtr& request,
+                  const OutputBufferPtr& response,
+                  const unsigned int wait, const Handler& handler);
+
+    // Cancels the exchange without invoking its handler.
+    void cancel(const uint16_t qid, const uint64_t id);
+
+    // Closes the connection and discards all exchanges without invoking
+    // their handlers.
+    void close();
+
+private:
+    // An exchange of a message with the server.
+    struct Exchange {
+        // Identifier of the exchange.
+        uint64_t id_;
+        // Message ID of the request.
+        uint16_t qid_;
+        // Request preceded by its length.
+        OutputBufferPtr request_;
+        // Buffer for the response.
+        OutputBufferPtr response_;
+        // Handler invoked when the exchange completes.
+        Handler handler_;
+        // Timer limiting the time to wait for the response.
+        IntervalTimerPtr timer_;
+        // Indicates whether the request has been written to the connection.
+        bool sent_;
+        // Indicates whether the request has been sent again after the
+        // connection has been lost.
+        bool resent_;
+    };
+
+    // Pointer to an exchange.
+    typedef boost::shared_ptr<Exchange> ExchangePtr;
+
+    // Makes the exchange pending and writes its request when possible.
+    void start(const ExchangePtr& exchange);
+
+    // Starts the first held exchange with the given message ID.
+    void release(const uint16_t qid);
+
+    // Removes the held exchange with the given message ID and identifier
+    // and returns it.
+    ExchangePtr removeHeld(const uint16_t qid, const uint64_t id);
+
+    // Starts establishing the connection.
+    void connect();
+
+    // Invoked when the connection is established or fails.
+    void connectHandler(const unsigned int generation,
+                        const boost::system::error_code& ec);
+
+    // Writes the next queued request if the connection is established and
+    // no request is being written.
+    void doWrite();
+
+    // Invoked when the request has been written.
+    void writeHandler(const unsigned int generation, ExchangePtr exchange,
+                      const boost::system::error_code& ec);
+
+    // Starts reading the length of the next response.
+    void doRead();
+
+    // Invoked when the length of the response has been read.
+    void readLengthHandler(const unsigned int generation,
+                           const boost::system::error_code& ec);
+
+    // Invoked when the response has been read.
+    void readBodyHandler(const unsigned int generation,
+                         const boost::system::error_code& ec);
+
+    // Invoked when the wait time of the exchange elapses.
+    void timeoutHandler(const uint16_t qid, const uint64_t id);
+
+    // Closes the socket and sends the pending requests again over a new
+    // connection.
+    void connectionLost(const std::string& reason);
+
+    // Closes the socket and reports all exchanges as failed.
+    void connectFailed(const std::string& reason);
+
+    // Closes the socket and invalidates the outstanding socket handlers.
+    void closeSocket();
+
+    // Removes the exchange and invokes its handler.
+    void complete(const ExchangePtr& exchange,
+                  const DNSClient::Status& status);
+
+    // Cancels the timer of the removed exchange and invokes its handler.
+    static void invoke(const ExchangePtr& exchange,
+                       const DNSClient::Status& status);
+
+    // Orders the exchanges by their identifiers.
+    static bool lessId(const ExchangePtr& first, const ExchangePtr& second);
+
+    // Returns the exchange with the given message ID and identifier.
+    ExchangePtr findExchange(const uint16_t qid, const uint64_t id) const;
+
+    // Returns the textual representation of the server.
+    std::string serverText() const;
+
+    // Connections by server address and port.
+    typedef std::map<std::pair<IOAddress, uint16_t>,
+                     DNSTCPConnectionPtr> ConnectionMap;
+
+    // Returns the connections.
+    static ConnectionMap& getConnections();
+
+    // IO service used by the connection.
+    IOService& io_service_;
+    // Endpoint of the server.
+    boost::asio::ip::tcp::endpoint endpoint_;
+    // Socket.
+    boost::asio::ip::tcp::socket socket_;
+    // State of the connection.
+    enum { CLOSED, CONNECTING, CONNECTED } state_;
+    // Incremented each time the socket is closed, so as the handlers of the
+    // operations on the closed socket can be ignored.
+    unsigned int generation_;
+    // Pending exchanges by message ID.
+    std::map<uint16_t, ExchangePtr> exchanges_;
+    // Exchanges waiting for the pending exchanges with the same message ID
+    // to complete, in the order they were started.
+    std::list<ExchangePtr> held_;
+    // Requests waiting to be written.
+    std::deque<ExchangePtr> write_queue_;
+    // Indicates whether a request is being written.
+    bool writing_;
+    // Length of the response being read.
+    uint8_t length_buf_[2];
+    // Response being read.
+    std::vector<uint8_t> read_buf_;
+    // Identifier of the last exchange.
+    uint64_t last_id_;
+};
+
+DNSTCPConnection::DNSTCPConnection(IOService& io_service,
+                                   const IOAddress& address,
+                                   const uint16_t port)
+    : io_service_(io_service),
+      endpoint_(boost::asio::ip::address::from_string(address.toText()), port),
+      socket_(io_service.get_io_service()), state_(CLOSED), generation_(0),
+      exchanges_(), held_(), write_queue_(), writing_(false), read_buf_(),
+      last_id_(0) {
+}
+
+DNSTCPConnection::~DNSTCPConnection() {
+    boost::system::error_code ec;
+    socket_.close(ec);
+}
+
+DNSTCPConnection::ConnectionMap&
+DNSTCPConnection::getConnections() {
+    static ConnectionMap connections;
+    return (connections);
+}
+
+DNSTCPConnectionPtr
+DNSTCPConnection::get(IOService& io_service, const IOAddress& address,
+                      const uint16_t port) {
+    ConnectionMap& connections = getConnections();
+    DNSTCPConnectionPtr& connection = connections[std::make_pair(address, port)];
+    // The connection can't be shared between IO services.
+    if (connection && (&connection->io_service_ != &io_service)) {
+        connection->close();
+        connection.reset();
+    }
+    if (!connection) {
+        connection.reset(new DNSTCPConnection(io_service, address, port));
+    }
+    return (connection);
+}
+
+void
+DNSTCPConnection::closeAll() {
+    ConnectionMap& connections = getConnections();
+    for (ConnectionMap::iterator it = connections.begin();
+         it != connections.end(); ++it) {
+        it->second->close();
+    }
+    connections.clear();
+}
+
+size_t
+DNSTCPConnection::count() {
+    return (getConnections().size());
+}
+
+uint64_t
+DNSTCPConnection::send(const OutputBufferPtr& request,
+                       const OutputBufferPtr& response,
+                       const unsigned int wait, const Handler& handler) {
+    if (request->getLength() < 2) {
+        isc_throw(isc::BadValue, "DNS message to be sent over TCP is"
+                  " too short: " << request->getLength() << " bytes");
+    }
+    if (request->getLength() > std::numeric_limits<uint16_t>::max()) {
+        isc_throw(isc::BadValue, "DNS message to be sent over TCP is"
+                  " too long: " << request->getLength() << " bytes");
+    }
+
+    const uint16_t qid = static_cast<uint16_t>(((*request)[0] << 8) |
+                                               (*request)[1]);
+    ExchangePtr exchange(new Exchange());
+    exchange->id_ = ++last_id_;
+    exchange->qid_ = qid;
+    // Messages sent over TCP are preceded by their length (RFC 1035,
+    // section 4.2.2).
+    exchange->request_.reset(new OutputBuffer(request->getLength() + 2));
+    exchange->request_->writeUint16(static_cast<uint16_t>(request->getLength()));
+    exchange->request_->writeData(request->getData(), request->getLength());
+    exchange->response_ = response;
+    exchange->handler_ = handler;
+    exchange->sent_ = false;
+    exchange->resent_ = false;
+    if (wait > 0) {
+        exchange->timer_.reset(new IntervalTimer(io_service_));
+        exchange->timer_->setup(boost::bind(&DNSTCPConnection::timeoutHandler,
+                                            shared_from_this(), qid,
+                                            exchange->id_),
+                                static_cast<long>(wait),
+                                IntervalTimer::ONE_SHOT);
+    }
+
+    // The message ID is used to match the response with the request, so
+    // it must be unique among the pending exchanges. The message can't be
+    // given another ID because it may have been signed, so it waits.
+    if (exchanges_.count(qid) > 0) {
+        LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  DHCP_DDNS_DNS_TCP_MESSAGE_HELD)
+            .arg(qid)
+            .arg(serverText());
+        held_.push_back(exchange);
+    } else {
+        start(exchange);
+    }
+
+    return (exchange->id_);
+}
+
+void
+DNSTCPConnection::start(const ExchangePtr& exchange) {
+    exchanges_[exchange->qid_] = exchange;
+    write_queue_.push_back(exchange);
+
+    if (state_ == CLOSED) {
+        connect();
+    } else {
+        doWrite();
+    }
+}
+
+void
+DNSTCPConnection::release(const uint16_t qid) {
+    for (std::list<ExchangePtr>::iterator it = held_.begin();
+         it != held_.end(); ++it) {
+        if ((*it)->qid_ == qid) {
+            ExchangePtr exchange = *it;
+            held_.erase(it);
+            start(exchange);
+            return;
+        }
+    }
+}
+
+DNSTCPConnection::ExchangePtr
+DNSTCPConnection::removeHeld(const uint16_t qid, const uint64_t id) {
+    for (std::list<ExchangePtr>::iterator it = held_.begin();
+         it != held_.end(); ++it) {
+        if (((*it)->qid_ == qid) && ((*it)->id_ == id)) {
+            ExchangePtr exchange = *it;
+            held_.erase(it);
+            return (exchange);
+        }
+    }
+    return (ExchangePtr());
+}
+
+void
+DNSTCPConnection::cancel(const uint16_t qid, const uint64_t id) {
+    ExchangePtr exchange = findExchange(qid, id);
+    if (exchange) {
+        exchanges_.erase(qid);
+        release(qid);
+    } else {
+        exchange = removeHeld(qid, id);
+    }
+    if (exchange && exchange->timer_) {
+        exchange->timer_->cancel();
+    }
+}
+
+void
+DNSTCPConnection::close() {
+    closeSocket();
+    for (std::map<uint16_t, ExchangePtr>::iterator it = exchanges_.begin();
+         it != exchanges_.end(); ++it) {
+        if (it->second->timer_) {
+            it->second->timer_->cancel();
+        }
+    }
+    for (std::list<ExchangePtr>::iterator it = held_.begin();
+         it != held_.end(); ++it) {
+        if ((*it)->timer_) {
+            (*it)->timer_->cancel();
+        }
+    }
+    exchanges_.clear();
+    held_.clear();
+    write_queue_.clear();
+}
+
+void
+DNSTCPConnection::connect() {
+    state_ = CONNECTING;
+    socket_.async_connect(endpoint_,
+                          boost::bind(&DNSTCPConnection::connectHandler,
+                                      shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::connectHandler(const unsigned int generation,
+                                 const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        connectFailed(ec.message());
+        return;
+    }
+
+    state_ = CONNECTED;
+    doRead();
+    doWrite();
+}
+
+void
+DNSTCPConnection::doWrite() {
+    if ((state_ != CONNECTED) || writing_) {
+        return;
+    }
+
+    // Skip the requests of the exchanges which have completed or have been
+    // cancelled before they could be sent.
+    while (!write_queue_.empty()) {
+        ExchangePtr exchange = write_queue_.front();
+        write_queue_.pop_front();
+        if (findExchange(exchange->qid_, exchange->id_)) {
+            writing_ = true;
+            exchange->sent_ = true;
+            boost::asio::async_write(socket_,
+                boost::asio::buffer(exchange->request_->getData(),
+                                    exchange->request_->getLength()),
+                boost::bind(&DNSTCPConnection::writeHandler,
+                            shared_from_this(), generation_, exchange, _1));
+            return;
+        }
+    }
+}
+
+void
+DNSTCPConnection::writeHandler(const unsigned int generation,
+                               ExchangePtr /* exchange */,
+                               const boost::system::error_code& ec) {
+    // The exchange is bound to the handler to keep the request buffer
+    // valid until the write completes.
+    if (generation != generation_) {
+        return;
+    }
+
+    writing_ = false;
+    if (ec) {
+        connectionLost(ec.message());
+        return;
+    }
+
+    doWrite();
+}
+
+void
+DNSTCPConnection::doRead() {
+    boost::asio::async_read(socket_,
+                            boost::asio::buffer(length_buf_,
+                                                sizeof(length_buf_)),
+                            boost::bind(&DNSTCPConnection::readLengthHandler,
+                                        shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::readLengthHandler(const unsigned int generation,
+                                    const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        connectionLost(ec.message());
+        return;
+    }
+
+    const size_t length = (static_cast<size_t>(length_buf_[0]) << 8) |
+        length_buf_[1];
+    if (length == 0) {
+        doRead();
+        return;
+    }
+
+    read_buf_.resize(length);
+    boost::asio::async_read(socket_, boost::asio::buffer(read_buf_),
+                            boost::bind(&DNSTCPConnection::readBodyHandler,
+                                        shared_from_this(), generation_, _1));
+}
+
+void
+DNSTCPConnection::readBodyHandler(const unsigned int generation,
+                                  const boost::system::error_code& ec) {
+    if (generation != generation_) {
+        return;
+    }
+
+    if (ec) {
+        connectionLost(ec.message());
+        return;
+    }
+
+    // Find the exchange by the message ID of the response. The responses
+    // to the exchanges which have timed out are dropped.
+    ExchangePtr exchange;
+    if (read_buf_.size() >= 2) {
+        const uint16_t qid = static_cast<uint16_t>((read_buf_[0] << 8) |
+                                                   read_buf_[1]);
+        std::map<uint16_t, ExchangePtr>::const_iterator it =
+            exchanges_.find(qid);
+        if (it != exchanges_.end()) {
+            exchange = it->second;
+            exchange->response_->clear();
+            exchange->response_->writeData(&read_buf_[0], read_buf_.size());
+        }
+    }
+
+    // Continue reading before the handler is invoked as the handler may
+    // send another message.
+    doRead();
+
+    if (exchange) {
+        complete(exchange, DNSClient::SUCCESS);
+    }
+}
+
+void
+DNSTCPConnection::timeoutHandler(const uint16_t qid, const uint64_t id) {
+    ExchangePtr exchange = findExchange(qid, id);
+    if (exchange) {
+        complete(exchange, DNSClient::TIMEOUT);
+        return;
+    }
+
+    // The exchange may time out while it is held.
+    exchange = removeHeld(qid, id);
+    if (exchange) {
+        invoke(exchange, DNSClient::TIMEOUT);
+    }
+}
+
+void
+DNSTCPConnection::connectionLost(const std::string& reason) {
+    closeSocket();
+
+    // The server closes the idle connections, so it is not worth logging
+    // when there are no exchanges in flight.
+    if (exchanges_.empty()) {
+        write_queue_.clear();
+        return;
+    }
+
+    LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              DHCP_DDNS_DNS_TCP_CONNECTION_LOST)
+        .arg(serverText())
+        .arg(reason);
+
+    // Queue the pending requests again, in the order they were sent.
+    // The requests which have already been sent twice fail.
+    std::vector<ExchangePtr> pending;
+    std::vector<ExchangePtr> failed;
+    for (std::map<uint16_t, ExchangePtr>::const_iterator it =
+             exchanges_.begin(); it != exchanges_.end(); ++it) {
+        if (it->second->sent_ && it->second->resent_) {
+            failed.push_back(it->second);
+        } else {
+            if (it->second->sent_) {
+                it->second->sent_ = false;
+                it->second->resent_ = true;
+            }
+            pending.push_back(it->second);
+        }
+    }
+
+    std::sort(pending.begin(), pending.end(), &DNSTCPConnection::lessId);
+    write_queue_.assign(pending.begin(), pending.end());
+    if (!write_queue_.empty()) {
+        connect();
+    }
+
+    for (std::vector<ExchangePtr>::const_iterator it = failed.begin();
+         it != failed.end(); ++it) {
+        complete(*it, DNSClient::OTHER);
+    }
+}
+
+void
+DNSTCPConnection::connectFailed(const std::string& reason) {
+    closeSocket();
+
+    LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
+              DHCP_DDNS_DNS_TCP_CONNECT_FAILED)
+        .arg(serverText())
+        .arg(reason);
+
+    // The handlers may send new messages, so the exchanges are removed
+    // before they are invoked. The held exchanges fail too.
+    std::map<uint16_t, ExchangePtr> failed;
+    failed.swap(exchanges_);
+    std::list<ExchangePtr> held;
+    held.swap(held_);
+    write_queue_.clear();
+    for (std::map<uint16_t, ExchangePtr>::const_iterator it = failed.begin();
+         it != failed.end(); ++it) {
+        invoke(it->second, DNSClient::OTHER);
+    }
+    for (std::list<ExchangePtr>::const_iterator it = held.begin();
+         it != held.end(); ++it) {
+        invoke(*it, DNSClient::OTHER);
+    }
+}
+
+void
+DNSTCPConnection::closeSocket() {
+    boost::system::error_code ec;
+    socket_.close(ec);
+    state_ = CLOSED;
+    writing_ = false;
+    ++generation_;
+}
+
+void
+DNSTCPConnection::complete(const ExchangePtr& exchange,
+                           const DNSClient::Status& status) {
+    std::map<uint16_t, ExchangePtr>::iterator it =
+        exchanges_.find(exchange->qid_);
+    if ((it == exchanges_.end()) || (it->second != exchange)) {
+        return;
+    }
+    exchanges_.erase(it);
+
+    // The next exchange with the same message ID can be started now.
+    release(exchange->qid_);
+
+    // The handler may destroy the client which owns the exchange and send
+    // new messages, so it must be the last thing done here.
+    invoke(exchange, status);
+}
+
+void
+DNSTCPConnection::invoke(const ExchangePtr& exchange,
+                         const DNSClient::Status& status) {
+    if (exchange->timer_) {
+        exchange->timer_->cancel();
+    }
+
+    Handler handler;
+    handler.swap(exchange->handler_);
+    if (handler) {
+        handler(status);
+    }
+}
+
+bool
+DNSTCPConnection::lessId(const ExchangePtr& first, const ExchangePtr& second) {
+    return (first->id_ < second->id_);
+}
+
+DNSTCPConnection::ExchangePtr
+DNSTCPConnection::findExchange(const uint16_t qid, const uint64_t id) const {
+    std::map<uint16_t, ExchangePtr>::const_iterator it = exchanges_.find(qid);
+    if ((it != exchanges_.end()) && (it->second->id_ == id)) {
+        return (it->second);
+    }
+    return (ExchangePtr());
+}
+
+std::string
+DNSTCPConnection::serverText() const {
+    std::ostringstream s;
+    s << endpoint_.address().to_string() << " port:" << endpoint_.port();
+    return (s.str());
+}
+
 // This class provides the implementation for the DNSClient. This allows for
 // the separation of the DNSClient interface from the implementation details.
 // Currently, implementation uses IOFetch object to handle asynchronous
@@ -55,6 +716,12 @@ public:
     DNSClient::Protocol proto_;
     // TSIG context used to sign outbound and verify inbound messages.
     dns::TSIGContextPtr tsig_context_;
+    // TCP connection over which the pending message has been sent.
+    DNSTCPConnectionPtr tcp_connection_;
+    // Message ID of the message sent over TCP.
+    uint16_t tcp_qid_;
+    // Identifier of the exchange of the message sent over TCP.
+    uint64_t tcp_exchange_id_;
 
     // Constructor and Destructor
     DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
@@ -68,6 +735,14 @@ public:
     // type, representing a response from the server is set.
     virtual void operator()(asiodns::IOFetch::Result result);
 
+    // This internal callback is called when the DNS update message exchange
+    // over TCP is complete.
+    void tcpHandler(const DNSClient::Status& status);
+
+    // Parses the response if the exchange was successful and invokes the
+    // external callback.
+    void complete(DNSClient::Status status);
+
     // Starts asynchronous DNS Update using TSIG.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
@@ -84,7 +759,8 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
                              DNSClient::Callback* callback,
                              const DNSClient::Protocol proto)
     : in_buf_(new OutputBuffer(DEFAULT_BUFFER_SIZE)),
-      response_(response_placeholder), callback_(callback), proto_(proto) {
+      response_(response_placeholder), callback_(callback), proto_(proto),
+      tsig_context_(), tcp_connection_(), tcp_qid_(0), tcp_exchange_id_(0) {
 
     // Response should be an empty pointer. It gets populated by the
     // operator() method.
@@ -92,17 +768,6 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
         isc_throw(isc::BadValue, "Response buffer pointer should be null");
     }
 
-    // @todo Currently we only support UDP. The support for TCP is planned for
-    // the future release.
-    if (proto_ == DNSClient::TCP) {
-        isc_throw(isc::NotImplemented, "TCP is currently not supported as a"
-                  << " Transport protocol for DNS Updates; please use UDP");
-    }
-
-    // Given that we already eliminated the possibility that TCP is used, it
-    // would be sufficient  to check that (proto != DNSClient::UDP). But, once
-    // support TCP is added the check above will disappear and the extra check
-    // will be needed here anyway.
     // Note that cascaded check is used here instead of:
     //   if (proto_ != DNSClient::TCP && proto_ != DNSClient::UDP)..
     // because some versions of GCC compiler complain that check above would
@@ -118,13 +783,28 @@ DNSClientImpl::DNSClientImpl(D2UpdateMessagePtr& response_placeholder,
 }
 
 DNSClientImpl::~DNSClientImpl() {
+    // The pending exchange must not invoke the callback of the destroyed
+    // object.
+    if (tcp_connection_) {
+        tcp_connection_->cancel(tcp_qid_, tcp_exchange_id_);
+    }
 }
 
 void
 DNSClientImpl::operator()(asiodns::IOFetch::Result result) {
     // Get the status from IO. If no success, we just call user's callback
     // and pass the status code.
-    DNSClient::Status status = getStatus(result);
+    complete(getStatus(result));
+}
+
+void
+DNSClientImpl::tcpHandler(const DNSClient::Status& status) {
+    tcp_connection_.reset();
+    complete(status);
+}
+
+void
+DNSClientImpl::complete(DNSClient::Status status) {
     if (status == DNSClient::SUCCESS) {
         // Allocate a new response message. (Note that Message::fromWire
         // may only be run once per message, so we need to start fresh
@@ -213,6 +893,25 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
     // invalid message object is given.
     update.toWire(renderer, tsig_context_.get());
 
+    // Send the message over the persistent TCP connection to the server
+    // if TCP is preferred or the message doesn't fit in a UDP datagram.
+    if ((proto_ == DNSClient::TCP) ||
+        (msg_buf->getLength() > MAX_UDP_MESSAGE_SIZE)) {
+        // A previous exchange which hasn't completed is abandoned.
+        if (tcp_connection_) {
+            tcp_connection_->cancel(tcp_qid_, tcp_exchange_id_);
+            tcp_connection_.reset();
+        }
+        DNSTCPConnectionPtr connection =
+            DNSTCPConnection::get(io_service, ns_addr, ns_port);
+        tcp_exchange_id_ =
+            connection->send(msg_buf, in_buf_, wait,
+                             boost::bind(&DNSClientImpl::tcpHandler, this, _1));
+        tcp_qid_ = update.getId();
+        tcp_connection_ = connection;
+        return;
+    }
+
     // IOFetch has all the mechanisms that we need to perform asynchronous
     // communication with the DNS server. The last but one argument points to
     // this object as a completion callback for the message exchange. As a
@@ -244,6 +943,16 @@ DNSClient::getMaxTimeout() {
     return (max_timeout);
 }
 
+void
+DNSClient::closeTCPConnections() {
+    DNSTCPConnection::closeAll();
+}
+
+size_t
+DNSClient::getTCPConnectionCount() {
+    return (DNSTCPConnection::count());
+}
+
 void
 DNSClient::doUpdate(asiolink::IOService& io_service,
                     const IOAddress& ns_addr,
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2015,2017-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -39,13 +39,21 @@ class DNSClientImpl;
 /// encapsulate DNS response, through class constructor. An exception will be
 /// thrown if the pointer is not initialized by the caller.
 ///
-/// @todo Ultimately, this class will support both TCP and UDP Transport.
-/// Currently only UDP is supported and can be specified as a preferred
-/// protocol. @c DNSClient constructor will throw an exception if TCP is
-/// specified. Once both protocols are supported, the @c DNSClient logic will
-/// try to obey caller's preference. However, it may use the other protocol if
-/// on its own discretion, when there is a legitimate reason to do so. For
-/// example, if communication with the server using preferred protocol fails.
+/// Both UDP and TCP Transport are supported. The @c DNSClient obeys the
+/// caller's preference, except that a message which doesn't fit in a UDP
+/// datagram (512 bytes) is always sent over TCP.
+///
+/// The messages sent over TCP use a persistent connection to the DNS
+/// server, which is shared by all @c DNSClient instances sending messages
+/// to this server. The messages are pipelined, i.e. they are sent without
+/// waiting for the responses to the previous messages, and the responses
+/// are matched with the requests by the message ID. The connection stays
+/// open after the exchanges complete, so the subsequent messages don't pay
+/// for the connection establishment. If the connection is lost, it is
+/// reestablished and the messages which have not been answered are sent
+/// again, once. The connections must be closed with
+/// @c DNSClient::closeTCPConnections before the IO service they use is
+/// destroyed.
 class DNSClient {
 public:
 
@@ -120,6 +128,15 @@ public:
     /// @return maximal allowed timeout value accepted by @c DNSClient::doUpdate
     static unsigned int getMaxTimeout();
 
+    /// @brief Closes the TCP connections to the DNS servers.
+    ///
+    /// The pending exchanges over these connections are discarded without
+    /// invoking their callbacks. This is meant to be called on shutdown.
+    static void closeTCPConnections();
+
+    /// @brief Returns the number of TCP connections to the DNS servers.
+    static size_t getTCPConnectionCount();
+
     /// @brief Start asynchronous DNS Update with TSIG.
     ///
     /// This function starts asynchronous DNS Update and returns. The DNS Update
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,7 @@
 #include <dns/rdata.h>
 #include <util/random/qid_gen.h>
 
+#include <boost/date_time/posix_time/posix_time.hpp>
 #include <sstream>
 
 using namespace isc::util;
@@ -52,7 +53,8 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
      dns_update_status_(DNSClient::OTHER), dns_update_response_(),
      forward_change_completed_(false), reverse_change_completed_(false),
      current_server_list_(), current_server_(), next_server_pos_(0),
-     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_() {
+     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_(), update_server_(),
+     update_sent_time_() {
     /// @todo if io_service is NULL we are multi-threading and should
     /// instantiate our own
     if (!io_service_) {
@@ -81,6 +83,11 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
 }
 
 NameChangeTransaction::~NameChangeTransaction(){
+    // The update will never complete so it must not be counted as in
+    // flight anymore.
+    if (update_server_) {
+        update_server_->updateAbandoned();
+    }
 }
 
 void
@@ -100,6 +107,7 @@ NameChangeTransaction::operator()(DNSClient::Status status) {
     // runModel is exception safe so we are good to call it here.
     // It won't exit until we hit the next IO wait or the state model ends.
     setDnsUpdateStatus(status);
+    updateServerStats(status);
     LOG_DEBUG(d2_to_dns_logger, isc::log::DBGLVL_TRACE_DETAIL,
               DHCP_DDNS_UPDATE_RESPONSE_RECEIVED)
               .arg(getRequestId())
@@ -165,6 +173,30 @@ NameChangeTransaction::transactionOutcomeString() const {
 }
 
 
+void
+NameChangeTransaction::updateServerStats(const DNSClient::Status& status) {
+    if (!update_server_) {
+        return;
+    }
+
+    DnsServerInfo::UpdateOutcome outcome = DnsServerInfo::UPDATE_FAILED;
+    if (status == DNSClient::SUCCESS) {
+        if (dns_update_response_ &&
+            (dns_update_response_->getRcode() == dns::Rcode::NOERROR())) {
+            outcome = DnsServerInfo::UPDATE_SUCCESS;
+        } else {
+            outcome = DnsServerInfo::UPDATE_REJECTED;
+        }
+    } else if (status == DNSClient::TIMEOUT) {
+        outcome = DnsServerInfo::UPDATE_TIMEOUT;
+    }
+
+    const boost::posix_time::time_duration latency =
+        boost::posix_time::microsec_clock::universal_time() - update_sent_time_;
+    update_server_->updateCompleted(outcome, latency.total_microseconds());
+    update_server_.reset();
+}
+
 void
 NameChangeTransaction::sendUpdate(const std::string& comment) {
     try {
@@ -173,6 +205,11 @@ NameChangeTransaction::sendUpdate(const std::string& comment) {
         // use_tsig_ is true. We should be able to navigate to the TSIG key
         // for the current server.  If not we would need to add that.
 
+        // The update is in flight until the completion handler is invoked.
+        update_server_ = current_server_;
+        update_server_->updateSent();
+        update_sent_time_ = boost::posix_time::microsec_clock::universal_time();
+
         D2ParamsPtr d2_params = cfg_mgr_->getD2Params();
         dns_client_->doUpdate(*io_service_, current_server_->getIpAddress(),
                               current_server_->getPort(), *dns_update_request_,
@@ -193,6 +230,10 @@ NameChangeTransaction::sendUpdate(const std::string& comment) {
         // DNSClient callback.  Any problem here most likely means the request
         // is corrupt in some way and cannot be completed, therefore we will
         // log it and transition it to failure.
+        if (update_server_) {
+            update_server_->updateAbandoned();
+            update_server_.reset();
+        }
         LOG_ERROR(d2_to_dns_logger, DHCP_DDNS_TRANS_SEND_ERROR)
                   .arg(getRequestId())
                   .arg(ex.what());
@@ -452,12 +493,12 @@ NameChangeTransaction::selectNextServer() {
         // Toss out any previous response.
         dns_update_response_.reset();
 
-        // @todo  Protocol is set on DNSClient constructor.  We need
-        // to propagate a configuration value downward, probably starting
-        // at global, then domain, then server
-        // Once that is supported we need to add it here.
+        // Protocol is set on DNSClient constructor, so it is created for
+        // each server.
         dns_client_.reset(new DNSClient(dns_update_response_ , this,
-                                        DNSClient::UDP));
+                                        (current_server_->getProtocol() ==
+                                         dhcp_ddns::NCR_TCP ?
+                                         DNSClient::TCP : DNSClient::UDP)));
         ++next_server_pos_;
         return (true);
     }
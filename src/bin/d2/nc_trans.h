@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -17,6 +17,7 @@
 #include <dns/tsig.h>
 #include <util/state_model.h>
 
+#include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
 
@@ -190,6 +191,10 @@ public:
     /// the given status and invokes runStateModel() with an event value of
     /// IO_COMPLETED_EVT.
     ///
+    /// The outcome and the latency of the exchange are recorded in the
+    /// statistics of the server the update was sent to, see
+    /// @ref updateServerStats.
+    ///
     /// @param status is the outcome of the DNS update packet exchange.
     /// This method is exception safe.
     virtual void operator()(DNSClient::Status status);
@@ -206,12 +211,25 @@ protected:
     /// the key to sign the request and verify the response, otherwise it
     /// will be conducted without TSIG.
     ///
+    /// The update is counted as in flight for the current server until
+    /// the DNSClient invokes the completion handler.
+    ///
     /// @param comment text to include in log detail
     ///
     /// If an exception occurs it will be logged and and the transaction will
     /// be failed.
     virtual void sendUpdate(const std::string& comment = "");
 
+    /// @brief Records the outcome of the update in the server statistics.
+    ///
+    /// If an update is in flight, the server it has been sent to is told
+    /// whether the update succeeded, was rejected, timed out or failed
+    /// otherwise, along with the time elapsed since the update was sent.
+    /// The update is no longer in flight afterwards.
+    ///
+    /// @param status is the outcome of the DNS update packet exchange.
+    void updateServerStats(const DNSClient::Status& status);
+
     /// @brief Adds events defined by NameChangeTransaction to the event set.
     ///
     /// This method adds the events common to NCR transaction processing to
@@ -582,6 +600,14 @@ private:
 
     /// @brief Pointer to the TSIG key which should be used (if any).
     dns::TSIGKeyPtr tsig_key_;
+
+    /// @brief Pointer to the server the pending update has been sent to.
+    ///
+    /// It is null when there is no update in flight.
+    DnsServerInfoPtr update_server_;
+
+    /// @brief Time when the pending update has been sent.
+    boost::posix_time::ptime update_sent_time_;
 };
 
 /// @brief Defines a pointer to a NameChangeTransaction.
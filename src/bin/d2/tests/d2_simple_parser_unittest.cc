@@ -1,4 +1,4 @@
-// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2017-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -821,6 +821,8 @@ TEST_F(TSIGKeyInfoListParserTest, validTSIGKeyList) {
 /// 1. Specifying both a hostname and an ip address is not allowed.
 /// 2. Specifying both blank a hostname and blank ip address is not allowed.
 /// 3. Specifying a negative port number is not allowed.
+/// 4. Specifying a negative max-in-flight is not allowed.
+/// 5. Specifying an unknown protocol is not allowed.
 
 TEST_F(DnsServerInfoParserTest, invalidEntry) {
     // Create a config in which both host and ip address are supplied.
@@ -845,6 +847,21 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
              "  \"ip-address\": \"192.168.5.6\" ,"
              "  \"port\": -100 }";
     PARSE_FAIL(config, "<string>:1.60-63: port must be greater than zero but less than 65536");
+
+    // Create a config with a negative limit of the updates in flight.
+    // Verify that build fails.
+    config = "{ \"hostname\": \"\", "
+             "  \"ip-address\": \"192.168.5.6\" ,"
+             "  \"max-in-flight\": -1 }";
+    PARSE_FAIL(config, "<string>:1.69-70: max-in-flight cannot be negative");
+
+    // Create a config with an unknown protocol.
+    // Verify that build fails.
+    config = "{ \"hostname\": \"\", "
+             "  \"ip-address\": \"192.168.5.6\" ,"
+             "  \"protocol\": \"BOGUS\" }";
+    PARSE_FAIL(config, "<string>:1.64-70: syntax error,"
+                       " unexpected constant string, expecting UDP or TCP");
 }
 
 
@@ -854,6 +871,8 @@ TEST_F(DnsServerInfoParserTest, invalidEntry) {
 /// 1. A DnsServerInfo entry is correctly made, when given only a hostname.
 /// 2. A DnsServerInfo entry is correctly made, when given ip address and port.
 /// 3. A DnsServerInfo entry is correctly made, when given only an ip address.
+/// 4. The limit of the updates in flight is optional.
+/// 5. The protocol is optional and defaults to UDP.
 TEST_F(DnsServerInfoParserTest, validEntry) {
     /// @todo When resolvable hostname is supported you'll need this test.
     /// // Valid entries for dynamic host
@@ -895,6 +914,36 @@ TEST_F(DnsServerInfoParserTest, validEntry) {
     ASSERT_TRUE(server_);
     EXPECT_TRUE(checkServer(server_, "", "192.168.2.5",
                             DnsServerInfo::STANDARD_DNS_PORT));
+    // By default the number of updates in flight is not limited.
+    EXPECT_EQ(0, server_->getMaxInFlight());
+    EXPECT_TRUE(server_->isAvailable());
+    EXPECT_EQ(dhcp_ddns::NCR_UDP, server_->getProtocol());
+
+    // Valid entries with the limit of the updates in flight.
+    config = " { \"hostname\" : \"\", "
+             "  \"ip-address\": \"127.0.0.1\" , "
+             "  \"port\": 100, "
+             "  \"max-in-flight\": 5 }";
+    PARSE_OK(config);
+    ASSERT_TRUE(server_);
+    EXPECT_TRUE(checkServer(server_, "", "127.0.0.1", 100));
+    EXPECT_EQ(5, server_->getMaxInFlight());
+
+    // Verify unparsing.
+    runToElementTest<DnsServerInfo>(config, *server_);
+
+    // Valid entries with TCP as the protocol.
+    config = " { \"hostname\" : \"\", "
+             "  \"ip-address\": \"127.0.0.1\" , "
+             "  \"port\": 100, "
+             "  \"protocol\": \"TCP\" }";
+    PARSE_OK(config);
+    ASSERT_TRUE(server_);
+    EXPECT_TRUE(checkServer(server_, "", "127.0.0.1", 100));
+    EXPECT_EQ(dhcp_ddns::NCR_TCP, server_->getProtocol());
+
+    // Verify unparsing.
+    runToElementTest<DnsServerInfo>(config, *server_);
 }
 
 /// @brief Verifies that attempting to parse an invalid list of DnsServerInfo
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -51,6 +51,7 @@ public:
     using D2UpdateMgr::checkFinishedTransactions;
     using D2UpdateMgr::pickNextJob;
     using D2UpdateMgr::makeTransaction;
+    using D2UpdateMgr::getMatchedRequestCount;
 };
 
 /// @brief Defines a pointer to a D2UpdateMgr instance.
@@ -591,11 +592,11 @@ TEST_F(D2UpdateMgrTest, sweep) {
         EXPECT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i]));
     }
 
-    // Invoke sweep canned_count_ times which should create a
-    // transaction for each canned ncr.
+    // Invoke sweep once which should create a transaction for each
+    // canned ncr as the servers are not limited.
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_EQ(canned_count_, update_mgr_->getTransactionCount());
     for (int i = 0; i < canned_count_; i++) {
-        EXPECT_NO_THROW(update_mgr_->sweep());
-        EXPECT_EQ(i + 1, update_mgr_->getTransactionCount());
         EXPECT_TRUE(update_mgr_->hasTransaction(canned_ncrs_[i]->getDhcid()));
     }
 
@@ -653,6 +654,84 @@ TEST_F(D2UpdateMgrTest, sweep) {
     EXPECT_EQ(0, update_mgr_->getTransactionCount());
 }
 
+/// @brief Tests that the requests for busy servers are postponed.
+/// This test verifies that:
+/// 1. A request is not dequeued when the server of its domain has reached
+/// its limit of updates in flight.
+/// 2. A request for another server is dequeued in the meantime.
+/// 3. A request for the same DHCID as a postponed request is postponed
+/// as well, even if its server is available.
+/// 4. The postponed requests are dequeued when the server is available.
+TEST_F(D2UpdateMgrTest, serverMaxInFlight) {
+    std::string config =
+             "{ "
+              "\"ip-address\" : \"192.168.1.33\" , "
+              "\"port\" : 88 , "
+              "\"tsig-keys\": [] ,"
+              "\"forward-ddns\" : {"
+              "\"ddns-domains\": [ "
+              "{ \"name\": \"example.com.\" , "
+              "  \"dns-servers\" : [ "
+              "  { \"ip-address\": \"127.0.0.1\", \"port\" : 5301, "
+              "    \"max-in-flight\": 1 } "
+              "  ] },"
+              "{ \"name\": \"org.\" , "
+              "  \"dns-servers\" : [ "
+              "  { \"ip-address\": \"127.0.0.1\" } "
+              "  ] } "
+              "] } }";
+    ASSERT_TRUE(fromJSON(config));
+    answer_ = cfg_mgr_->parseConfig(config_set_);
+    ASSERT_TRUE(checkAnswer(0));
+
+    DnsServerInfoPtr server = (*cfg_mgr_->getD2CfgContext()->getForwardMgr()->
+                               getDomains())["example.com."]->getServers()->at(0);
+    ASSERT_EQ(1, server->getMaxInFlight());
+
+    // Two requests for the limited server followed by two requests for
+    // the other server, the first of them for the same DHCID as the second
+    // request.
+    NameChangeRequestPtr org_ncr(new NameChangeRequest(*(canned_ncrs_[1])));
+    org_ncr->setFqdn("my.example.org.");
+    NameChangeRequestPtr other_org_ncr(new NameChangeRequest(*(canned_ncrs_[3])));
+    other_org_ncr->setFqdn("other.example.org.");
+    ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[0]));
+    ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[1]));
+    ASSERT_NO_THROW(queue_mgr_->enqueue(org_ncr));
+    ASSERT_NO_THROW(queue_mgr_->enqueue(other_org_ncr));
+
+    // The first request is sent to the limited server.
+    ASSERT_TRUE(update_mgr_->pickNextJob());
+    EXPECT_TRUE(update_mgr_->hasTransaction(canned_ncrs_[0]->getDhcid()));
+    EXPECT_EQ(1, server->getInFlight());
+    EXPECT_FALSE(server->isAvailable());
+
+    // The second request is postponed and so is the request with the
+    // same DHCID, so the last request is picked.
+    ASSERT_TRUE(update_mgr_->pickNextJob());
+    EXPECT_EQ(2, update_mgr_->getTransactionCount());
+    EXPECT_TRUE(update_mgr_->hasTransaction(other_org_ncr->getDhcid()));
+    EXPECT_EQ(2, update_mgr_->getQueueCount());
+
+    // Nothing else can be picked. The domains of the postponed request
+    // are not matched again.
+    EXPECT_EQ(1, update_mgr_->getMatchedRequestCount());
+    EXPECT_FALSE(update_mgr_->pickNextJob());
+    EXPECT_EQ(2, update_mgr_->getQueueCount());
+    EXPECT_EQ(1, update_mgr_->getMatchedRequestCount());
+
+    // Complete the first transaction. The sweep removes it, which frees
+    // the server, and picks the second request. The request with the same
+    // DHCID has to wait for the second request to complete.
+    completeTransaction(0, dhcp_ddns::ST_COMPLETED);
+    EXPECT_NO_THROW(update_mgr_->sweep());
+    EXPECT_FALSE(update_mgr_->hasTransaction(canned_ncrs_[0]->getDhcid()));
+    EXPECT_TRUE(update_mgr_->hasTransaction(canned_ncrs_[1]->getDhcid()));
+    EXPECT_EQ(1, update_mgr_->getQueueCount());
+    EXPECT_EQ(1, server->getInFlight());
+    EXPECT_EQ(0, update_mgr_->getMatchedRequestCount());
+}
+
 /// @brief Tests integration of NameAddTransaction
 /// This test verifies that update manager can create and manage a
 /// NameAddTransaction from start to finish.  It utilizes a fake server
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,8 +11,12 @@
 #include <asiodns/logger.h>
 #include <asiolink/interval_timer.h>
 #include <dns/messagerenderer.h>
+#include <dns/rdata.h>
+#include <boost/asio/ip/tcp.hpp>
 #include <boost/asio/ip/udp.hpp>
+#include <boost/asio/read.hpp>
 #include <boost/asio/socket_base.hpp>
+#include <boost/asio/write.hpp>
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
@@ -62,6 +66,11 @@ public:
     asiolink::IntervalTimer test_timer_;
     int received_;
     int expected_;
+    boost::scoped_ptr<tcp::acceptor> tcp_acceptor_;
+    boost::scoped_ptr<tcp::socket> tcp_socket_;
+    uint8_t tcp_length_[2];
+    bool tcp_respond_;
+    int tcp_accepts_;
 
     /// @brief Constructor
     //
@@ -77,7 +86,7 @@ public:
           corrupt_response_(false),
           expect_response_(true),
           test_timer_(service_),
-          received_(0), expected_(0) {
+          received_(0), expected_(0), tcp_respond_(true), tcp_accepts_(0) {
         asiodns::logger.setSeverity(isc::log::INFO);
         response_.reset();
         dns_client_.reset(new DNSClient(response_, this));
@@ -89,8 +98,10 @@ public:
 
     /// @brief Destructor
     //
-    // Sets the asiodns logging level back to DEBUG.
+    // Sets the asiodns logging level back to DEBUG and closes the TCP
+    // connections which use the IO service of this test.
     virtual ~DNSClientTest() {
+        DNSClient::closeTCPConnections();
         asiodns::logger.setSeverity(isc::log::DEBUG);
     };
 
@@ -179,6 +190,83 @@ public:
                         *remote);
     }
 
+    /// @brief Starts listening for a TCP connection from the client.
+    //
+    // The connection is accepted by the tcpAcceptHandler, which starts
+    // serving the requests received over it.
+    void tcpListen() {
+        tcp_acceptor_.reset(new tcp::acceptor(service_.get_io_service(),
+                                              tcp::endpoint(address::from_string(TEST_ADDRESS),
+                                                            TEST_PORT),
+                                              true));
+        tcp_socket_.reset(new tcp::socket(service_.get_io_service()));
+        tcp_acceptor_->async_accept(*tcp_socket_,
+                                    boost::bind(&DNSClientTest::tcpAcceptHandler,
+                                                this, _1));
+    }
+
+    /// @brief Handler invoked when the TCP connection is accepted.
+    //
+    // @param ec Error code of the accept operation.
+    void tcpAcceptHandler(const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        ++tcp_accepts_;
+        tcpReceive();
+    }
+
+    /// @brief Starts reading the length of the next request over TCP.
+    void tcpReceive() {
+        boost::asio::async_read(*tcp_socket_,
+                                boost::asio::buffer(tcp_length_,
+                                                    sizeof(tcp_length_)),
+                                boost::bind(&DNSClientTest::tcpLengthHandler,
+                                            this, _1));
+    }
+
+    /// @brief Handler invoked when the length of a request has been read.
+    //
+    // @param ec Error code of the read operation.
+    void tcpLengthHandler(const boost::system::error_code& ec) {
+        if (ec) {
+            return;
+        }
+        const size_t length = (tcp_length_[0] << 8) | tcp_length_[1];
+        ASSERT_LE(length, sizeof(receive_buffer_));
+        boost::asio::async_read(*tcp_socket_,
+                                boost::asio::buffer(receive_buffer_, length),
+                                boost::bind(&DNSClientTest::tcpRequestHandler,
+                                            this, _1, _2));
+    }
+
+    /// @brief Handler invoked when a request has been received over TCP.
+    //
+    // Unless the responses are disabled, this handler sends back a copy of
+    // the request with the QR bit set, preceded by its length, and waits
+    // for the next request on the same connection.
+    //
+    // @param ec Error code of the read operation.
+    // @param receive_length A length (in bytes) of the received request.
+    void tcpRequestHandler(const boost::system::error_code& ec,
+                           size_t receive_length) {
+        if (ec) {
+            return;
+        }
+        if (tcp_respond_) {
+            OutputBuffer response_buf(receive_length + 2);
+            response_buf.writeUint16(receive_length);
+            response_buf.writeData(receive_buffer_, receive_length);
+            // Set the QR bit. See udpReceiveHandler for details. The message
+            // is preceded by two bytes of length.
+            response_buf.writeUint8At(0xA8, 4);
+            boost::asio::write(*tcp_socket_,
+                               boost::asio::buffer(response_buf.getData(),
+                                                   response_buf.getLength()));
+        }
+        tcpReceive();
+    }
+
     /// @brief Request handler for testing clients using TSIG
     //
     // This callback handler is installed when performing async read on a
@@ -259,12 +347,132 @@ public:
     // callback object is NULL.
     void runConstructorTest() {
         EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::UDP));
+        EXPECT_NO_THROW(DNSClient(response_, NULL, DNSClient::TCP));
+    }
+
+    // This test verifies that DNSClient can exchange the DNS Update messages
+    // with a server over TCP and that the connection is reused.
+    //
+    // @param message_count Number of messages sent one after another, each
+    // after the response to the previous message has been received.
+    // @param concurrent_count Number of messages sent at once using
+    // different DNSClient instances.
+    void runTCPSendReceiveTest(const int message_count,
+                               const int concurrent_count) {
+        tcpListen();
+        dns_client_.reset(new DNSClient(response_, this, DNSClient::TCP));
+
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+
+        const int timeout = 500;
+        for (int i = 0; i < message_count; ++i) {
+            expected_ = 1;
+            received_ = 0;
+            message.setId(i + 1);
+            dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                                  message, timeout);
+            service_.run();
+            service_.get_io_service().reset();
+            EXPECT_EQ(1, received_);
+        }
+
+        // The messages of the other clients are pipelined. Note that the
+        // clients share the response placeholder, which is checked by the
+        // callback as soon as it is updated.
+        std::vector<DNSClientPtr> clients;
+        expected_ = concurrent_count;
+        received_ = 0;
+        for (int i = 0; i < concurrent_count; ++i) {
+            clients.push_back(DNSClientPtr(new DNSClient(response_, this,
+                                                         DNSClient::TCP)));
+            message.setId(1000 + i);
+            clients.back()->doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                     TEST_PORT, message, timeout);
+        }
+        if (concurrent_count > 0) {
+            service_.run();
+            service_.get_io_service().reset();
+            EXPECT_EQ(concurrent_count, received_);
+        }
+
+        // All messages have been sent over the same connection.
+        EXPECT_EQ(1, tcp_accepts_);
+        EXPECT_EQ(1, DNSClient::getTCPConnectionCount());
+    }
+
+    // This test verifies that the messages having the same ID are sent
+    // over the same connection one after another.
+    void runTCPSameIdTest(const int concurrent_count) {
+        tcpListen();
+
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+        message.setId(1234);
+
+        const int timeout = 500;
+        std::vector<DNSClientPtr> clients;
+        expected_ = concurrent_count;
+        received_ = 0;
+        for (int i = 0; i < concurrent_count; ++i) {
+            clients.push_back(DNSClientPtr(new DNSClient(response_, this,
+                                                         DNSClient::TCP)));
+            ASSERT_NO_THROW(clients.back()->doUpdate(service_,
+                                                     IOAddress(TEST_ADDRESS),
+                                                     TEST_PORT, message,
+                                                     timeout));
+        }
+        service_.run();
+        EXPECT_EQ(concurrent_count, received_);
+        EXPECT_EQ(1, tcp_accepts_);
+    }
+
+    // This test verifies that the timeout is reported when the server
+    // doesn't respond to the message sent over TCP.
+    void runTCPSendNoReceiveTest() {
+        expect_response_ = false;
+        tcp_respond_ = false;
+        tcpListen();
+        dns_client_.reset(new DNSClient(response_, this, DNSClient::TCP));
+
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+
+        const int timeout = 500;
+        EXPECT_NO_THROW(dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS),
+                                              TEST_PORT, message, timeout));
+        service_.run();
+        EXPECT_EQ(1, tcp_accepts_);
+    }
 
-        // The TCP Transport is not supported right now. So, we return exception
-        // if caller specified TCP as a preferred protocol. This test will be
-        // removed once TCP is supported.
-        EXPECT_THROW(DNSClient(response_, NULL, DNSClient::TCP),
-                     isc::NotImplemented);
+    // This test verifies that the message which doesn't fit in a UDP
+    // datagram is sent over TCP even though UDP is preferred.
+    void runLargeMessageTest() {
+        tcpListen();
+
+        D2UpdateMessage message(D2UpdateMessage::OUTBOUND);
+        ASSERT_NO_THROW(message.setRcode(Rcode(Rcode::NOERROR_CODE)));
+        ASSERT_NO_THROW(message.setZone(Name("example.com"), RRClass::IN()));
+        RRsetPtr update(new RRset(Name("foo.example.com"), RRClass::IN(),
+                                  RRType::A(), RRTTL(10)));
+        for (int i = 1; i <= 50; ++i) {
+            std::ostringstream address;
+            address << "10.0.0." << i;
+            update->addRdata(rdata::createRdata(RRType::A(), RRClass::IN(),
+                                                address.str()));
+        }
+        message.addRRset(D2UpdateMessage::SECTION_UPDATE, update);
+
+        const int timeout = 500;
+        expected_ = 1;
+        dns_client_->doUpdate(service_, IOAddress(TEST_ADDRESS), TEST_PORT,
+                              message, timeout);
+        service_.run();
+        EXPECT_EQ(1, received_);
+        EXPECT_EQ(1, tcp_accepts_);
     }
 
     // This test verifies that it accepted timeout values belong to the range of
@@ -464,6 +672,32 @@ TEST_F(DNSClientTest, constructor) {
     runConstructorTest();
 }
 
+// Verify that the DNSClient exchanges messages over TCP.
+TEST_F(DNSClientTest, tcpSendReceive) {
+    runTCPSendReceiveTest(1, 0);
+}
+
+// Verify that the TCP connection is reused by the subsequent messages,
+// including the messages sent by other DNSClient instances, and that the
+// messages can be sent without waiting for the previous responses.
+TEST_F(DNSClientTest, tcpConnectionReuse) {
+    runTCPSendReceiveTest(3, 3);
+}
+
+// Verify that timeout is reported when no response is received over TCP.
+TEST_F(DNSClientTest, tcpSameId) {
+    runTCPSameIdTest(3);
+}
+
+TEST_F(DNSClientTest, tcpTimeout) {
+    runTCPSendNoReceiveTest();
+}
+
+// Verify that a message too large for UDP is sent over TCP.
+TEST_F(DNSClientTest, largeMessageOverTCP) {
+    runLargeMessageTest();
+}
+
 // This test verifies that the maximal allowed timeout value is maximal int
 // value.
 TEST_F(DNSClientTest, getMaxTimeout) {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -73,6 +73,7 @@ public:
     virtual void operator()(DNSClient::Status status) {
         if (use_stub_callback_) {
             setDnsUpdateStatus(status);
+            updateServerStats(status);
             postNextEvent(IO_COMPLETED_EVT);
         } else {
             // For tests which need to use the real callback.
@@ -954,6 +955,9 @@ TEST_F(NameChangeTransactionTest, sendUpdateDoUpdateFailure) {
               name_change->getCurrState());
     ASSERT_EQ(NameChangeTransaction::UPDATE_FAILED_EVT,
               name_change->getNextEvent());
+
+    // Verify that the update is not left in flight.
+    EXPECT_EQ(0, name_change->getCurrentServer()->getInFlight());
 }
 
 /// @brief Tests sendUpdate method when underlying doUpdate times out.
@@ -980,6 +984,13 @@ TEST_F(NameChangeTransactionTest, sendUpdateTimeout) {
     ASSERT_EQ(NameChangeTransaction::IO_COMPLETED_EVT,
               name_change->getNextEvent());
     ASSERT_EQ(DNSClient::TIMEOUT, name_change->getDnsUpdateStatus());
+
+    // Verify that the timeout has been recorded for the server.
+    DnsServerInfoPtr server = name_change->getCurrentServer();
+    EXPECT_EQ(0, server->getInFlight());
+    EXPECT_EQ(1, server->getStats().sent_);
+    EXPECT_EQ(1, server->getStats().timeouts_);
+    EXPECT_EQ(0, server->getStats().succeeded_);
 }
 
 /// @brief Tests sendUpdate method when it receives a corrupt response from
@@ -1001,6 +1012,13 @@ TEST_F(NameChangeTransactionTest, sendUpdateCorruptResponse) {
     ASSERT_EQ(NameChangeTransaction::IO_COMPLETED_EVT,
               name_change->getNextEvent());
     ASSERT_EQ(DNSClient::INVALID_RESPONSE, name_change->getDnsUpdateStatus());
+
+    // Verify that the failure has been recorded for the server.
+    const DnsServerInfo::Stats& stats =
+        name_change->getCurrentServer()->getStats();
+    EXPECT_EQ(1, stats.sent_);
+    EXPECT_EQ(1, stats.failed_);
+    EXPECT_EQ(0, stats.succeeded_);
 }
 
 /// @brief Tests sendUpdate method when the exchange succeeds.
@@ -1030,6 +1048,15 @@ TEST_F(NameChangeTransactionTest, sendUpdate) {
     D2ZonePtr zone = response->getZone();
     EXPECT_TRUE(zone);
     EXPECT_EQ("response.example.com.", zone->getName().toText());
+
+    // Verify that the success has been recorded for the server.
+    DnsServerInfoPtr current = name_change->getCurrentServer();
+    EXPECT_EQ(0, current->getInFlight());
+    EXPECT_EQ(1, current->getStats().sent_);
+    EXPECT_EQ(1, current->getStats().succeeded_);
+    EXPECT_EQ(0, current->getStats().rejected_);
+    EXPECT_LE(current->getStats().total_latency_,
+              current->getStats().max_latency_);
 }
 
 /// @brief Tests that an unsigned response to a signed request is an error
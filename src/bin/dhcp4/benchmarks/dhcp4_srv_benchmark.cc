@@ -0,0 +1,433 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <benchmark/benchmark.h>
+#include <asiolink/io_address.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/option4_addrlst.h>
+#include <dhcp/option_int_array.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt_pool.h>
+#include <dhcp/tests/iface_mgr_test_config.h>
+#include <dhcp/tests/pkt_filter_test_stub.h>
+#include <dhcp4/dhcp4_srv.h>
+#include <dhcp4/json_config_parser.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cstdlib>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Number of the memory allocations made by the process.
+uint64_t allocations = 0;
+
+}
+
+/// @brief Counts the memory allocations.
+///
+/// The default operator new[] and the non-throwing variants are implemented
+/// in terms of this operator, so all allocations are counted.
+void*
+operator new(std::size_t size) {
+    ++allocations;
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+/// @brief Releases the memory allocated by the counting operator new.
+void
+operator delete(void* ptr) throw() {
+    std::free(ptr);
+}
+
+namespace {
+
+/// @brief Number of the clients in each subnet.
+const int CLIENTS_PER_SUBNET = 20;
+
+/// @brief Number of the subnets in each shared network.
+const int SUBNETS_PER_NETWORK = 4;
+
+/// @brief Address of the interface receiving the queries.
+const char* SERVER_ADDRESS = "10.0.0.1";
+
+/// @brief Returns the address in the subnet used by the benchmarks.
+///
+/// @param subnet Subnet index.
+/// @param host Host part of the address.
+std::string
+getAddress(const int subnet, const int host) {
+    std::ostringstream s;
+    s << "10." << ((subnet >> 8) & 0xff) << "." << (subnet & 0xff) << "."
+      << host;
+    return (s.str());
+}
+
+/// @brief Returns the address reserved for the client or requested by it.
+///
+/// The first client in each subnet has a reservation, the remaining
+/// clients are assigned the addresses from the pool.
+///
+/// @param subnet Subnet index.
+/// @param client Client index within the subnet.
+std::string
+getClientAddress(const int subnet, const int client) {
+    return (getAddress(subnet, client == 0 ? 201 : 10 + client));
+}
+
+/// @brief Returns the MAC address of the client.
+///
+/// @param subnet Subnet index.
+/// @param client Client index within the subnet.
+std::vector<uint8_t>
+getClientMac(const int subnet, const int client) {
+    std::vector<uint8_t> mac(6, 0);
+    mac[0] = 0x02;
+    mac[2] = static_cast<uint8_t>((subnet >> 8) & 0xff);
+    mac[3] = static_cast<uint8_t>(subnet & 0xff);
+    mac[5] = static_cast<uint8_t>(client);
+    return (mac);
+}
+
+/// @brief Creates a DHCPv4 server configuration.
+///
+/// The subnets are grouped in the shared networks. Each subnet has a pool,
+/// a few options and a few host reservations, one of them for the first
+/// client of the subnet. The client classes are selected by the vendor
+/// class identifier sent by some clients.
+///
+/// @param subnets Number of subnets.
+std::string
+createConfig(const int subnets) {
+    std::ostringstream s;
+    s << "{ \"interfaces-config\": { \"interfaces\": [ \"eth0\" ],"
+      << " \"re-detect\": false },"
+      << " \"valid-lifetime\": 4000, \"renew-timer\": 1000,"
+      << " \"rebind-timer\": 2000,"
+      << " \"lease-database\": { \"type\": \"memfile\", \"persist\": false },"
+      << " \"client-classes\": ["
+      << " { \"name\": \"voip\","
+      << " \"test\": \"substring(option[60].hex,0,4) == 'VOIP'\","
+      << " \"option-data\": [ { \"name\": \"tftp-server-name\","
+      << " \"data\": \"tftp.example.org\" } ] },"
+      << " { \"name\": \"pxe\", \"test\": \"option[60].text == 'PXEClient'\","
+      << " \"next-server\": \"192.0.2.10\", \"boot-file-name\": \"pxelinux.0\" },"
+      << " { \"name\": \"other\", \"test\": \"not member('voip') and"
+      << " not member('pxe')\" } ],"
+      << " \"shared-networks\": [";
+    for (int i = 0; i < subnets; ++i) {
+        if (i % SUBNETS_PER_NETWORK == 0) {
+            s << (i > 0 ? " ] }," : "") << "\n { \"name\": \"network-"
+              << (i / SUBNETS_PER_NETWORK) << "\", \"subnet4\": [";
+        } else {
+            s << ",";
+        }
+        const std::vector<uint8_t> mac = getClientMac(i, 0);
+        s << "\n  { \"id\": " << (i + 1) << ","
+          << " \"subnet\": \"" << getAddress(i, 0) << "/24\","
+          << " \"pools\": [ { \"pool\": \"" << getAddress(i, 10) << " - "
+          << getAddress(i, 200) << "\" } ],"
+          << " \"option-data\": ["
+          << " { \"name\": \"routers\", \"data\": \"" << getAddress(i, 1)
+          << "\" },"
+          << " { \"name\": \"domain-name-servers\","
+          << " \"data\": \"192.0.2.1, 192.0.2.2\" } ],"
+          << " \"reservations\": ["
+          << " { \"hw-address\": \"" << HWAddr(mac, HTYPE_ETHER).toText(false)
+          << "\", \"ip-address\": \"" << getClientAddress(i, 0) << "\","
+          << " \"hostname\": \"host-" << i << "\" }";
+        for (int j = 1; j < 4; ++j) {
+            s << ", { \"hw-address\": \"1a:1b:1c:" << std::hex
+              << ((i >> 8) & 0xff) << ":" << (i & 0xff) << ":" << j << std::dec
+              << "\", \"ip-address\": \"" << getAddress(i, 201 + j) << "\" }";
+        }
+        s << " ] }";
+    }
+    s << (subnets > 0 ? " ] }" : "") << " ] }";
+    return (s.str());
+}
+
+/// @brief Query sent by the client.
+struct Query {
+    /// @brief Query in the wire format.
+    std::vector<uint8_t> data_;
+
+    /// @brief Address of the relay forwarding the query.
+    IOAddress relay_;
+};
+
+/// @brief Packet filter injecting the queries into the server.
+///
+/// The sockets are opened on /dev/null, so the server always finds a
+/// socket ready to read and calls @c receive, which returns the query
+/// set with @c setQuery. The responses are counted and discarded.
+class PktFilterBenchmark : public PktFilterTestStub {
+public:
+
+    /// @brief Constructor.
+    PktFilterBenchmark()
+        : query_(0), sent_(0), pkt_pool_() {
+    }
+
+    /// @brief Sets the query returned by the next call to @c receive.
+    ///
+    /// @param query Query to be received by the server. It must be valid
+    /// until it is received.
+    void setQuery(const Query& query) {
+        query_ = &query;
+    }
+
+    /// @brief Returns the number of responses sent by the server.
+    uint64_t getSent() const {
+        return (sent_);
+    }
+
+    /// @brief Creates the packet from the query.
+    ///
+    /// The packet is created from the pool as in the @c PktFilterInet.
+    ///
+    /// @param iface Interface on which the query is received.
+    /// @param sock_info Socket on which the query is received.
+    ///
+    /// @return Received packet or null if no query was set.
+    virtual Pkt4Ptr receive(Iface& iface, const SocketInfo& sock_info) {
+        if (!query_) {
+            return (Pkt4Ptr());
+        }
+        Pkt4Ptr pkt = pkt_pool_.create(&query_->data_[0],
+                                       query_->data_.size());
+        pkt->updateTimestamp();
+        pkt->setIndex(iface.getIndex());
+        pkt->setIface(iface.getName());
+        pkt->setRemoteAddr(query_->relay_);
+        pkt->setRemotePort(DHCP4_SERVER_PORT);
+        pkt->setLocalAddr(sock_info.addr_);
+        pkt->setLocalPort(sock_info.port_);
+        query_ = 0;
+        return (pkt);
+    }
+
+    /// @brief Counts the response.
+    ///
+    /// @return 0.
+    virtual int send(const Iface&, uint16_t, const Pkt4Ptr&) {
+        ++sent_;
+        return (0);
+    }
+
+private:
+
+    /// @brief Query returned by the next call to @c receive.
+    const Query* query_;
+
+    /// @brief Number of responses sent by the server.
+    uint64_t sent_;
+
+    /// @brief Pool of the received packets.
+    PktPool<Pkt4> pkt_pool_;
+};
+
+/// @brief Pointer to the packet filter injecting the queries.
+typedef boost::shared_ptr<PktFilterBenchmark> PktFilterBenchmarkPtr;
+
+/// @brief Fixture class benchmarking the DHCPv4 server.
+///
+/// The server is configured with the number of subnets given by the
+/// benchmark argument and receives the queries from fake interfaces,
+/// through the same code path as the queries received from the network.
+/// The leases are stored in the memfile backend which doesn't persist
+/// them, so the benchmarks don't need root privileges, network access
+/// or a database.
+class Dhcpv4SrvBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Configures the server.
+    ///
+    /// @param state Benchmark state, the first argument is the number
+    /// of subnets.
+    void SetUp(::benchmark::State const& state) override {
+        const int subnets = static_cast<int>(state.range(0));
+        iface_config_.reset(new IfaceMgrTestConfig(true));
+        filter_.reset(new PktFilterBenchmark());
+        IfaceMgr::instance().setPacketFilter(filter_);
+
+        srv_.reset(new Dhcpv4Srv(0, false, false));
+        CfgMgr::instance().clear();
+        ConstElementPtr answer =
+            configureDhcp4Server(*srv_, Element::fromJSON(createConfig(subnets)));
+        int rcode = 0;
+        ConstElementPtr comment = config::parseAnswer(rcode, answer);
+        if (rcode != 0) {
+            isc_throw(Unexpected, "failed to configure the server: "
+                      << comment->str());
+        }
+        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+        cfg_db->setAppendedParameters("universe=4");
+        cfg_db->createManagers();
+        CfgMgr::instance().commit();
+        CfgMgr::instance().getCurrentCfg()->getCfgIface()->
+            openSockets(AF_INET, DHCP4_SERVER_PORT, false);
+    }
+
+    /// @brief Destroys the server and restores the interfaces.
+    void TearDown(::benchmark::State const&) override {
+        queries_.clear();
+        srv_.reset();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        stats::StatsMgr::instance().removeAll();
+        filter_.reset();
+        iface_config_.reset();
+    }
+
+    /// @brief Creates the queries of all clients.
+    ///
+    /// The queries are relayed. Every third client sends the vendor class
+    /// identifier selecting one of the client classes. The requests are
+    /// sent in the SELECTING state, i.e. they carry the server identifier
+    /// and the requested address.
+    ///
+    /// @param subnets Number of subnets.
+    /// @param type Message type, DHCPDISCOVER or DHCPREQUEST.
+    void createQueries(const int subnets, const uint8_t type) {
+        queries_.clear();
+        for (int i = 0; i < subnets; ++i) {
+            for (int j = 0; j < CLIENTS_PER_SUBNET; ++j) {
+                Pkt4Ptr query(new Pkt4(type, i * CLIENTS_PER_SUBNET + j));
+                const std::vector<uint8_t> mac = getClientMac(i, j);
+                query->setHWAddr(HTYPE_ETHER, mac.size(), mac);
+                query->setGiaddr(IOAddress(getAddress(i, 1)));
+                query->setHops(1);
+
+                OptionBuffer client_id(1, HTYPE_ETHER);
+                client_id.insert(client_id.end(), mac.begin(), mac.end());
+                query->addOption(OptionPtr(new Option(Option::V4,
+                                                      DHO_DHCP_CLIENT_IDENTIFIER,
+                                                      client_id)));
+
+                OptionUint8ArrayPtr prl(new OptionUint8Array(Option::V4,
+                                                             DHO_DHCP_PARAMETER_REQUEST_LIST));
+                prl->addValue(DHO_SUBNET_MASK);
+                prl->addValue(DHO_ROUTERS);
+                prl->addValue(DHO_DOMAIN_NAME_SERVERS);
+                prl->addValue(DHO_DOMAIN_NAME);
+                query->addOption(prl);
+
+                if (j % 3 != 0) {
+                    const std::string vendor_class =
+                        (j % 3 == 1) ? "VOIP-phone" : "PXEClient";
+                    query->addOption(OptionPtr(new Option(Option::V4,
+                                                          DHO_VENDOR_CLASS_IDENTIFIER,
+                                                          OptionBuffer(vendor_class.begin(),
+                                                                       vendor_class.end()))));
+                }
+
+                if (type == DHCPREQUEST) {
+                    query->addOption(OptionPtr(new Option4AddrLst(DHO_DHCP_SERVER_IDENTIFIER,
+                                                                  IOAddress(SERVER_ADDRESS))));
+                    query->addOption(OptionPtr(new Option4AddrLst(DHO_DHCP_REQUESTED_ADDRESS,
+                                                                  IOAddress(getClientAddress(i, j)))));
+                }
+
+                query->pack();
+                const util::OutputBuffer& buf = query->getBuffer();
+                const uint8_t* data = static_cast<const uint8_t*>(buf.getData());
+                Query q = { std::vector<uint8_t>(data, data + buf.getLength()),
+                            query->getGiaddr() };
+                queries_.push_back(q);
+            }
+        }
+    }
+
+    /// @brief Benchmarks the processing of the queries.
+    ///
+    /// The clients send their queries in turns. Each iteration processes
+    /// a single query, so the items per second are the packets processed
+    /// per second. The number of memory allocations per packet is
+    /// reported in the allocs/pkt counter.
+    ///
+    /// @param state Benchmark state.
+    /// @param type Message type, DHCPDISCOVER or DHCPREQUEST.
+    void benchQueries(::benchmark::State& state, const uint8_t type) {
+        createQueries(static_cast<int>(state.range(0)), type);
+        size_t next = 0;
+        const uint64_t allocations_before = allocations;
+        while (state.KeepRunning()) {
+            filter_->setQuery(queries_[next]);
+            srv_->run_one();
+            if (++next == queries_.size()) {
+                next = 0;
+            }
+        }
+        const uint64_t allocations_done = allocations - allocations_before;
+        if (filter_->getSent() == 0) {
+            state.SkipWithError("the server sent no responses");
+            return;
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.counters["allocs/pkt"] =
+            static_cast<double>(allocations_done) / state.iterations();
+    }
+
+protected:
+
+    /// @brief Fake interfaces.
+    boost::scoped_ptr<IfaceMgrTestConfig> iface_config_;
+
+    /// @brief Packet filter injecting the queries.
+    PktFilterBenchmarkPtr filter_;
+
+    /// @brief Benchmarked server.
+    boost::scoped_ptr<Dhcpv4Srv> srv_;
+
+    /// @brief Queries of all clients.
+    std::vector<Query> queries_;
+};
+
+}
+
+/// @brief Benchmarks the processing of the DHCPDISCOVER messages.
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, discover)(::benchmark::State& state) {
+    benchQueries(state, DHCPDISCOVER);
+}
+
+/// @brief Benchmarks the processing of the DHCPREQUEST messages.
+///
+/// The first request of each client allocates the lease, the following
+/// requests extend it.
+BENCHMARK_DEFINE_F(Dhcpv4SrvBenchmark, request)(::benchmark::State& state) {
+    benchQueries(state, DHCPREQUEST);
+}
+
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, discover)->Arg(10)->Arg(1000)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Dhcpv4SrvBenchmark, request)->Arg(10)->Arg(1000)
+    ->Unit(::benchmark::kMicrosecond);
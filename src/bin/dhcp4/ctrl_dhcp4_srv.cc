@@ -17,6 +17,8 @@
 #include <dhcpsrv/cfg_db_access.h>
 #include <hooks/hooks.h>
 #include <hooks/hooks_manager.h>
+#include <hooks/server_hooks.h>
+#include <log/logger_manager.h>
 #include <stats/stats_mgr.h>
 #include <cfgrpt/config_report.h>
 #include <signal.h>
@@ -48,6 +50,28 @@ struct CtrlDhcp4Hooks {
 // module is called.
 CtrlDhcp4Hooks Hooks;
 
+/// @brief Interval of the log statistics updates in milliseconds.
+const long LOG_STATS_INTERVAL = 1000;
+
+/// @brief Interval of the parking lot expiration in milliseconds.
+const long PARKING_LOT_INTERVAL = 1000;
+
+/// @brief Default timeout of the parked packets in milliseconds.
+///
+/// It applies to the parking lots for which the hooks libraries don't
+/// set a timeout. It is longer than the timeouts of the asynchronous
+/// operations of the libraries, e.g. the lease updates sent by the High
+/// Availability library, so it only removes the packets which would
+/// otherwise be never unparked.
+const long PARKED_PACKET_TIMEOUT = 30000;
+
+/// @brief Interval of the packet pool statistics updates in milliseconds.
+const long PKT_POOL_STATS_INTERVAL = 1000;
+
+/// @brief Interval of the checks for the allocation failures to be
+/// summarized in milliseconds.
+const long ALLOC_FAIL_SUMMARY_INTERVAL = 1000;
+
 /// @brief Signals handler for DHCPv4 server.
 ///
 /// This signal handler handles the following signals received by the DHCPv4
@@ -607,7 +631,15 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
             boost::bind(&ControlledDhcpv4Srv::dbLostCallback, srv, _1);
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
         cfg_db->setAppendedParameters("universe=4");
-        cfg_db->createManagers();
+        // Reuse the existing lease manager and host data sources if their
+        // parameters haven't changed. The host data sources may be provided
+        // by the hooks libraries which have been reloaded, so they are only
+        // reused when no hooks libraries are configured.
+        ConstSrvConfigPtr current = CfgMgr::instance().getCurrentCfg();
+        const bool reuse_hosts =
+            CfgMgr::instance().getStagingCfg()->getHooksConfig().get().empty() &&
+            current->getHooksConfig().get().empty();
+        cfg_db->updateManagers(*current->getCfgDbAccess(), reuse_hosts);
     } catch (const std::exception& ex) {
         err << "Unable to open database: " << ex.what();
         return (isc::config::createAnswer(1, err.str()));
@@ -638,9 +670,18 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
     // guards against exceptions and invokes a callback function to
     // log warnings. Since we allow that this fails for some interfaces there
     // is no need to rollback configuration if socket fails to open on any
-    // of the interfaces.
-    CfgMgr::instance().getStagingCfg()->getCfgIface()->
-        openSockets(AF_INET, srv->getPort(), getInstance()->useBroadcast());
+    // of the interfaces. The sockets are not reopened when the interfaces
+    // configuration hasn't changed and the re-detected interfaces are the
+    // same (their sockets are closed otherwise), because reopening them
+    // drops the packets received in the meantime.
+    ConstCfgIfacePtr cfg_iface = CfgMgr::instance().getStagingCfg()->getCfgIface();
+    if (cfg_iface->equals(*CfgMgr::instance().getCurrentCfg()->getCfgIface()) &&
+        IfaceMgr::instance().hasOpenSocket(AF_INET)) {
+        LOG_INFO(dhcp4_logger, DHCP4_CONFIG_SOCKETS_REUSED);
+    } else {
+        CfgMgr::instance().getStagingCfg()->getCfgIface()->
+            openSockets(AF_INET, srv->getPort(), getInstance()->useBroadcast());
+    }
 
     // Install the timers for handling leases reclamation.
     try {
@@ -656,6 +697,68 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Install the timer publishing the number of log messages dropped by
+    // the asynchronous logging outputs.
+    bool async_logging = false;
+    const LoggingInfoStorage& loggers =
+        CfgMgr::instance().getStagingCfg()->getLoggingInfo();
+    for (LoggingInfoStorage::const_iterator logger = loggers.begin();
+         logger != loggers.end(); ++logger) {
+        for (std::vector<LoggingDestination>::const_iterator dest =
+                 logger->destinations_.begin();
+             dest != logger->destinations_.end(); ++dest) {
+            async_logging = async_logging || dest->async_;
+        }
+    }
+    if (async_logging &&
+        !TimerMgr::instance()->isTimerRegistered("Dhcp4LogStatsTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp4LogStatsTimer",
+                        boost::bind(&ControlledDhcpv4Srv::updateLogStatistics),
+                        LOG_STATS_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp4LogStatsTimer");
+        updateLogStatistics();
+    }
+
+    // Install the timer logging the summary of the allocations which
+    // failed because the pools were exhausted.
+    if (!TimerMgr::instance()->isTimerRegistered("Dhcp4AllocFailSummaryTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp4AllocFailSummaryTimer",
+                        boost::bind(&ControlledDhcpv4Srv::logExhaustedFailures,
+                                    server_),
+                        ALLOC_FAIL_SUMMARY_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp4AllocFailSummaryTimer");
+    }
+
+    // Install the timer publishing the counters of the pool of received
+    // packets.
+    if (!TimerMgr::instance()->isTimerRegistered("Dhcp4PktPoolStatsTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp4PktPoolStatsTimer",
+                        boost::bind(&ControlledDhcpv4Srv::updatePacketPoolStatistics),
+                        PKT_POOL_STATS_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp4PktPoolStatsTimer");
+    }
+
+    // Packets must not be parked forever, even when the hooks library
+    // doesn't set a timeout. The libraries have been loaded already, so
+    // their settings take precedence.
+    ServerHooks::getServerHooks().getParkingLotsPtr()->
+        setDefaultTimeout(PARKED_PACKET_TIMEOUT, ParkingLot::TIMEOUT_DROP);
+
+    // Install the timer removing the packets parked for longer than the
+    // parking lot timeout and publishing the parking statistics.
+    if (HooksManager::calloutsPresent(ServerHooks::getServerHooks().
+                                      getIndex("leases4_committed")) &&
+        !TimerMgr::instance()->isTimerRegistered("Dhcp4ParkingLotTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp4ParkingLotTimer",
+                        boost::bind(&ControlledDhcpv4Srv::expireParkedPackets),
+                        PARKING_LOT_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp4ParkingLotTimer");
+    }
+
     // This hook point notifies hooks libraries that the configuration of the
     // DHCPv4 server has completed. It provides the hook library with the pointer
     // to the common IO service object, new server configuration in the JSON
@@ -750,6 +853,16 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv4Srv::commandVersionGetHandler, this, _1, _2));
 
+    // Register callout timing related commands
+    CommandMgr::instance().registerCommand("callout-timing-disable",
+        boost::bind(&HooksManager::calloutTimingDisableHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("callout-timing-enable",
+        boost::bind(&HooksManager::calloutTimingEnableHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("list-callout-timings",
+        boost::bind(&HooksManager::listCalloutTimingsHandler, _1, _2));
+
     // Register statistic related commands
     CommandMgr::instance().registerCommand("statistic-get",
         boost::bind(&StatsMgr::statisticGetHandler, _1, _2));
@@ -791,12 +904,15 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
 
         // Deregister any registered commands (please keep in alphabetic order)
         CommandMgr::instance().deregisterCommand("build-report");
+        CommandMgr::instance().deregisterCommand("callout-timing-disable");
+        CommandMgr::instance().deregisterCommand("callout-timing-enable");
         CommandMgr::instance().deregisterCommand("config-get");
         CommandMgr::instance().deregisterCommand("config-reload");
         CommandMgr::instance().deregisterCommand("config-test");
         CommandMgr::instance().deregisterCommand("config-write");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
+        CommandMgr::instance().deregisterCommand("list-callout-timings");
         CommandMgr::instance().deregisterCommand("config-set");
         CommandMgr::instance().deregisterCommand("dhcp-disable");
         CommandMgr::instance().deregisterCommand("dhcp-enable");
@@ -846,6 +962,50 @@ ControlledDhcpv4Srv::deleteExpiredReclaimedLeases(const uint32_t secs) {
     TimerMgr::instance()->setup(CfgExpiration::FLUSH_RECLAIMED_TIMER_NAME);
 }
 
+void
+ControlledDhcpv4Srv::logExhaustedFailures() {
+    if (alloc_engine_) {
+        alloc_engine_->logExhaustedFailures4();
+    }
+}
+
+void
+ControlledDhcpv4Srv::expireParkedPackets() {
+    ParkingLotPtr parking_lot = ServerHooks::getServerHooks().
+        getParkingLotPtr("leases4_committed");
+    const size_t expired = parking_lot->expire();
+    if (expired > 0) {
+        LOG_WARN(dhcp4_logger, DHCP4_HOOK_LEASES4_COMMITTED_PARK_TIMEOUT)
+            .arg(expired);
+        StatsMgr::instance().addValue("pkt4-park-timeouts",
+                                      static_cast<int64_t>(expired));
+        // The packets removed without calling the unpark callback are
+        // never processed, so they are dropped as received packets too.
+        if (parking_lot->getTimeoutAction() == ParkingLot::TIMEOUT_DROP) {
+            StatsMgr::instance().addValue("pkt4-receive-drop",
+                                          static_cast<int64_t>(expired));
+        }
+    }
+    StatsMgr::instance().setValue("pkt4-parked",
+                                  static_cast<int64_t>(parking_lot->size()));
+    StatsMgr::instance().setValue("pkt4-parked-max",
+        static_cast<int64_t>(parking_lot->getMaxSize()));
+}
+
+void
+ControlledDhcpv4Srv::updatePacketPoolStatistics() {
+    StatsMgr::instance().setValue("pkt4-pool-hits",
+        static_cast<int64_t>(IfaceMgr::instance().getPacketPoolHits4()));
+    StatsMgr::instance().setValue("pkt4-pool-misses",
+        static_cast<int64_t>(IfaceMgr::instance().getPacketPoolMisses4()));
+}
+
+void
+ControlledDhcpv4Srv::updateLogStatistics() {
+    StatsMgr::instance().setValue("log-messages-dropped",
+        static_cast<int64_t>(isc::log::LoggerManager::getDroppedMessages()));
+}
+
 void
 ControlledDhcpv4Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
     bool reopened = false;
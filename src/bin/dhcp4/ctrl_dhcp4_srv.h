@@ -318,6 +318,42 @@ private:
     /// deleted.
     void deleteExpiredReclaimedLeases(const uint32_t secs);
 
+    /// @brief Logs the summary of the allocations which failed because
+    /// the pools were exhausted.
+    ///
+    /// This is a wrapper method for @c AllocEngine::logExhaustedFailures4
+    /// called periodically by a timer, so the failures are reported even
+    /// when no further allocation fails.
+    void logExhaustedFailures();
+
+    /// @brief Removes the timed out parked packets.
+    ///
+    /// Expires the packets parked after the leases4_committed hook point
+    /// for longer than the timeout set for the parking lot by the hooks
+    /// libraries, or the default timeout of 30 seconds, and updates the
+    /// "pkt4-parked", "pkt4-parked-max" and "pkt4-park-timeouts"
+    /// statistics. The expired packets which are dropped rather than
+    /// unparked are also counted in "pkt4-receive-drop". It is called
+    /// periodically by a timer installed when callouts are present for
+    /// this hook point.
+    static void expireParkedPackets();
+
+    /// @brief Publishes the counters of the pool of received packets.
+    ///
+    /// Sets the "pkt4-pool-hits" and "pkt4-pool-misses" statistics to the
+    /// number of received packets which reused a packet object from the
+    /// pool and which required a new packet object respectively. It is
+    /// called periodically by a timer.
+    static void updatePacketPoolStatistics();
+
+    /// @brief Publishes the number of dropped log messages.
+    ///
+    /// Sets the "log-messages-dropped" statistic to the number of log
+    /// messages dropped by the asynchronous logging outputs because their
+    /// queue was full. It is called periodically by a timer installed when
+    /// at least one logging output is asynchronous.
+    static void updateLogStatistics();
+
     /// @brief Attempts to reconnect the server to the DB backend managers
     ///
     /// This is a self-rescheduling function that attempts to reconnect to the
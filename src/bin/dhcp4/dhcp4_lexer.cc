@@ -465,8 +465,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	(yy_c_buf_p) = yy_cp;
 
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 173
-#define YY_END_OF_BUFFER 174
+#define YY_NUM_RULES 177
+#define YY_END_OF_BUFFER 178
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -474,167 +474,170 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1443] =
+static yyconst flex_int16_t yy_accept[1480] =
     {   0,
-      166,  166,    0,    0,    0,    0,    0,    0,    0,    0,
-      174,  172,   10,   11,  172,    1,  166,  163,  166,  166,
-      172,  165,  164,  172,  172,  172,  172,  172,  159,  160,
-      172,  172,  172,  161,  162,    5,    5,    5,  172,  172,
-      172,   10,   11,    0,    0,  155,    0,    0,    0,    0,
+      170,  170,    0,    0,    0,    0,    0,    0,    0,    0,
+      178,  176,   10,   11,  176,    1,  170,  167,  170,  170,
+      176,  169,  168,  176,  176,  176,  176,  176,  163,  164,
+      176,  176,  176,  165,  166,    5,    5,    5,  176,  176,
+      176,   10,   11,    0,    0,  159,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    1,
-      166,  166,    0,  165,  166,    3,    2,    6,    0,  166,
+      170,  170,    0,  169,  170,    3,    2,    6,    0,  170,
         0,    0,    0,    0,    0,    0,    4,    0,    0,    9,
 
-        0,  156,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  158,    0,    0,    0,
+        0,  160,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  162,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
-        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
+        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-      157,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  161,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   65,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   66,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  171,  169,    0,  168,
-      167,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  175,
+      173,    0,  172,  171,    0,    0,    0,    0,    0,    0,
 
-        0,  136,    0,  135,    0,    0,   72,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   32,    0,    0,    0,
+        0,    0,    0,    0,  140,    0,  139,    0,    0,   73,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       33,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   69,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   17,    0,    0,
+        0,    0,    0,    0,    0,    0,   70,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   18,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       18,    0,    0,    0,    0,  170,  167,    0,    0,    0,
+        0,    0,    0,    0,    0,   19,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,  137,    0,    0,
-      139,    0,    0,    0,    0,    0,    0,    0,   73,    0,
-        0,    0,    0,    0,   56,    0,    0,    0,    0,    0,
-       90,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   35,    0,    0,    0,    0,    0,    0,    0,    0,
+      174,  171,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  141,    0,    0,  143,    0,    0,    0,    0,
+        0,    0,    0,    0,   74,    0,    0,    0,    0,    0,
+       57,    0,    0,    0,    0,    0,   94,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   36,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       55,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   59,    0,   36,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   56,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       60,    0,   37,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,   87,   28,    0,    0,   33,    0,    0,    0,
-        0,    0,    0,    0,    0,   12,  144,    0,  141,    0,
-      140,    0,    0,    0,  100,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   80,    0,    0,    0,    0,    0,
+       91,   29,    0,    0,   34,    0,    0,    0,    0,    0,
+        0,    0,    0,   12,  148,    0,  145,    0,  144,    0,
+        0,    0,  104,   84,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   30,    0,    0,
+        0,    0,    0,   81,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       58,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      101,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   31,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       59,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,   96,    0,    0,    0,    0,    0,    0,
-        0,    7,    0,    0,  142,    0,    0,    0,    0,    0,
+        0,  105,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  100,    0,    0,    0,    0,    0,
+        0,    0,    7,    0,    0,  146,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   71,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   72,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   82,    0,    0,    0,    0,    0,    0,    0,    0,
-       78,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   83,    0,    0,    0,    0,    0,    0,    0,
+        0,   79,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   62,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   75,
-        0,    0,    0,    0,    0,    0,    0,    0,   61,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   94,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  106,   76,
-        0,    0,    0,    0,   81,   29,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   37,    0,    0,
+       63,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   76,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   62,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   98,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  110,   77,    0,    0,    0,    0,   82,   30,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   38,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   51,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,  145,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   68,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   95,    0,    0,    0,    0,    0,   40,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   52,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  149,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   34,    0,    0,    0,
-        0,   27,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   83,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   69,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   99,    0,
+        0,    0,    0,    0,   41,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   92,    0,
+        0,    0,    0,    0,   35,    0,    0,    0,    0,    0,
+       28,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   87,    0,    0,
 
-        0,    0,    0,    0,    0,  118,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       63,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   96,    0,    0,
+        0,    0,    0,    0,    0,  122,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   23,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  123,    0,
-        0,  121,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  149,    0,    0,    0,    0,    0,    0,
-       93,    0,    0,    0,    0,   97,   79,    0,    0,    0,
+       64,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,   91,    0,   22,    0,  102,    0,    0,    0,    0,
-        0,    0,    0,    0,  127,    0,    0,    0,    0,   53,
-        0,    0,    0,    0,    0,  105,   31,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   24,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      127,    0,    0,  125,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  153,    0,    0,    0,    0,
+
+        0,    0,   97,    0,    0,    0,    0,    0,  101,   80,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   57,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   99,    0,
+        0,    0,    0,    0,   95,    0,   23,    0,  106,    0,
+        0,    0,    0,    0,    0,    0,    0,  131,    0,    0,
+        0,    0,   54,    0,    0,    0,    0,    0,    0,  109,
+       32,    0,   85,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  152,    0,
-       54,   70,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,   48,    0,    0,    0,    0,    0,    0,    0,
-      124,    0,  122,    0,  117,  116,    0,   44,    0,   21,
-        0,    0,    0,    0,    0,  138,    0,    0,   86,    0,
-        0,    0,    0,    0,    0,  114,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   64,    0,  103,   15,
-        0,   38,    0,    0,    0,    0,    0,  126,    0,    0,
-        0,    0,    0,    0,   66,   49,    0,    0,   98,    0,
-        0,    0,    0,   89,    0,    0,    0,    0,    0,    0,
-       60,    0,  147,    0,  146,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   58,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  103,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  156,    0,   55,   71,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   49,
+        0,    0,    0,    0,    0,    0,    0,  128,    0,  126,
+        0,  121,  120,    0,   45,    0,   22,    0,    0,    0,
+        0,    0,  142,    0,    0,   90,    0,    0,    0,    0,
+        0,    0,    0,  118,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   65,    0,  107,   16,    0,   39,
+        0,    0,    0,    0,    0,  130,    0,    0,    0,    0,
+        0,    0,    0,   67,   50,    0,    0,  102,    0,    0,
+
+        0,    0,   93,    0,    0,    0,    0,    0,    0,   61,
+        0,  151,    0,  150,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   14,    0,    0,   43,    0,    0,
-        0,    0,    0,  154,   84,    0,   45,  115,    0,    0,
-      150,  119,    0,    0,    0,    0,    0,    0,    0,    0,
-       25,    0,    0,   24,    0,  125,    0,    0,    0,    0,
-        0,   77,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   47,    0,    0,    0,   39,
-        0,    0,    0,    0,    0,    0,  104,    0,    0,    0,
-       26,    0,  151,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   42,    0,    0,   20,  153,   52,
-        0,  148,  143,    0,    0,   16,    0,    0,  132,    0,
-        0,    0,    0,    0,    0,  112,    0,   88,    0,    0,
-        0,    0,    0,    0,    0,    0,   67,    0,    0,    0,
-        0,    0,    0,    0,    0,  133,   13,    0,    0,    0,
-        0,    0,  120,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  111,    0,   19,    0,  129,
-        0,    0,    0,    0,    0,  128,    0,    0,    0,  110,
-        0,    0,   46,    0,    0,   41,  131,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   14,    0,    0,   44,    0,
+        0,    0,    0,    0,  158,   88,    0,    0,   46,  119,
+        0,    0,  154,  123,    0,    0,    0,    0,    0,    0,
+        0,    0,   26,    0,    0,   25,    0,  129,    0,    0,
+        0,    0,    0,   78,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,   48,    0,
+        0,    0,    0,   40,    0,    0,    0,    0,    0,    0,
+      108,    0,    0,    0,   27,    0,  155,    0,    0,    0,
+        0,    0,   86,    0,    0,    0,    0,    0,    0,   43,
+        0,    0,   21,  157,   53,    0,  152,  147,    0,    0,
+        0,   17,    0,    0,  136,    0,    0,    0,    0,    0,
+        0,  116,    0,   92,    0,    0,    0,    0,    0,    0,
+        0,    0,   68,    0,    0,   15,    0,    0,    0,    0,
+        0,    0,  137,   13,    0,    0,    0,    0,    0,  124,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,  115,    0,   20,    0,  133,    0,    0,    0,
+        0,    0,  132,    0,    0,    0,  114,    0,    0,   47,
+        0,    0,   42,  135,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  130,    0,   85,    0,    0,    0,    0,    0,
-        0,  108,  113,   50,    0,    0,    0,    0,  107,    0,
-        0,  134,    0,    0,    0,    0,    0,   74,    0,    0,
-      109,    0
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  134,
+        0,   89,    0,    0,    0,    0,    0,    0,  112,  117,
+       51,    0,    0,    0,    0,  111,    0,    0,  138,    0,
+        0,    0,    0,    0,   75,    0,    0,  113,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -681,351 +684,361 @@ static yyconst flex_int32_t yy_meta[72] =
         3
     } ;
 
-static yyconst flex_int16_t yy_base[1455] =
+static yyconst flex_int16_t yy_base[1492] =
     {   0,
         0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1805, 1806,   32, 1801,  141,    0,  201, 1806,  206,   88,
-       11,  213, 1806, 1783,  114,   25,    2,    6, 1806, 1806,
-       73,   11,   17, 1806, 1806, 1806,  104, 1789, 1744,    0,
-     1781,  107, 1796,  217,  247, 1806, 1740,  185, 1739, 1745,
-       93,   58, 1737,   91,  211,  195,   14,  273,  195, 1736,
-      181,  275,  202,  209,   76,   68,  188, 1745,  232,  219,
-      296,  284,  207, 1728,  230,  287,  324,  305, 1747,    0,
-      339,  359,  367,  374,  379, 1806,    0, 1806,  301,  344,
-      295,  336,  196,  348,  350,  292, 1806, 1744, 1783, 1806,
-
-      355, 1806,  395, 1772,  331, 1730, 1740,  351,  367, 1735,
-      363,  370,  373,  379,  241, 1778,    0,  446,  375, 1722,
-     1724, 1720, 1728,  363, 1724, 1713, 1714,   76, 1730, 1713,
-     1722, 1722,  322, 1713,  367, 1714, 1712,  359, 1758, 1762,
-     1704, 1755, 1697, 1720, 1717, 1717, 1711,  349, 1704, 1697,
-     1702, 1696,  381, 1707, 1700, 1691, 1690, 1704,  362, 1690,
-      381, 1706,  266,  442,  376,  390, 1705, 1702, 1703, 1701,
-      417, 1683, 1685,  418, 1677, 1694, 1686,    0,  392,  428,
-      441,  401,  445,  448, 1685, 1806,    0, 1728,  454, 1675,
-     1678,  444,  450, 1686,  457, 1729,  460, 1728,  454, 1727,
-
-     1806,  498, 1726,  482, 1687, 1667, 1683, 1680, 1679, 1670,
-       75, 1719, 1713, 1679, 1658, 1666, 1661, 1675, 1671, 1659,
-     1671, 1671, 1662, 1646, 1650, 1663, 1665, 1662, 1654, 1644,
-     1662, 1806, 1657, 1660, 1641, 1640, 1690, 1639, 1649, 1652,
-      453, 1648, 1636, 1647, 1683, 1630, 1686, 1623, 1638,  505,
-     1628, 1644, 1625, 1624, 1630, 1621, 1620, 1627, 1629, 1674,
-     1632, 1631, 1625,  470, 1632, 1627, 1619, 1609, 1624, 1623,
-     1618, 1622, 1603, 1619, 1605, 1611, 1618, 1606,  521, 1599,
-     1613, 1654, 1615,  468, 1606,  485, 1806, 1806,  492, 1806,
-     1806, 1593,    0,  479,  470, 1595,  533,  505, 1649, 1602,
-
-      501, 1806, 1647, 1806, 1641,  551, 1806,  500, 1583, 1639,
-     1585, 1591, 1641, 1598, 1597,  491, 1806, 1595, 1637, 1592,
-     1589,  540, 1595, 1633, 1627, 1582, 1577, 1574, 1623, 1582,
-     1571, 1587, 1619, 1567,  548, 1581, 1566, 1579, 1566, 1576,
-     1571, 1578, 1573, 1569,  476, 1567, 1570, 1565, 1561, 1609,
-      511, 1603, 1806, 1602, 1554, 1553, 1552, 1545, 1547, 1551,
-     1540, 1553,  550, 1598, 1553, 1550, 1554, 1806, 1552, 1541,
-     1541, 1553,  521, 1528, 1529, 1550,  531, 1532, 1581, 1528,
-     1542, 1541, 1527, 1539, 1538, 1537, 1536,  504, 1577, 1576,
-     1806, 1520, 1519,  574, 1532, 1806, 1806, 1531,    0, 1520,
-
-     1512,  529, 1517, 1568, 1567, 1525, 1565, 1806, 1513, 1563,
-     1806,  554,  600,  547, 1562, 1518, 1514, 1502, 1806, 1507,
-     1517, 1516, 1503, 1502, 1806, 1504, 1501,  190, 1499, 1501,
-     1806, 1509, 1506, 1491, 1504, 1499,  581, 1506, 1494, 1487,
-     1536, 1806, 1485, 1501, 1533, 1496, 1493, 1494, 1496, 1528,
-     1481, 1476, 1475, 1524, 1470, 1485, 1463, 1470, 1475, 1523,
-     1806, 1470, 1466, 1464, 1473, 1467, 1474, 1458, 1458, 1468,
-     1471, 1460, 1455, 1806, 1510, 1806, 1454, 1465, 1502, 1449,
-     1454, 1463, 1457, 1451, 1460, 1500, 1494, 1458, 1441, 1441,
-     1436, 1456, 1431, 1437, 1436, 1444, 1448, 1431, 1487, 1429,
-
-     1443, 1432, 1806, 1806, 1432, 1430, 1806, 1441, 1475, 1437,
-        0, 1421, 1438, 1476, 1426, 1806, 1806, 1423, 1806, 1429,
-     1806,  559,  568,  582, 1806, 1426, 1414, 1465, 1412, 1411,
-     1410, 1417, 1410, 1422, 1421, 1421, 1409, 1450, 1417, 1409,
-     1452, 1398, 1414, 1413, 1806, 1398, 1395, 1451, 1408, 1400,
-     1406, 1397, 1405, 1390, 1406, 1388, 1402,  556, 1384, 1378,
-     1383, 1398, 1395, 1396, 1393, 1434, 1391, 1806, 1377, 1379,
-     1388, 1386, 1423, 1422, 1375,  563, 1384, 1367, 1368, 1365,
-     1806, 1379, 1358, 1379, 1376, 1368, 1411, 1365, 1372, 1408,
-     1806, 1355, 1369, 1353, 1367, 1370, 1351, 1401, 1400, 1399,
-
-     1346, 1397, 1396, 1806,   14, 1358, 1358, 1356, 1339, 1344,
-     1346, 1806, 1352, 1342, 1806, 1387, 1335, 1390,  569,  546,
-      556, 1340, 1383,  581, 1387, 1381, 1380, 1379, 1333, 1323,
-     1376, 1329, 1339, 1373, 1336, 1330, 1317, 1325, 1368, 1372,
-     1329, 1328, 1806, 1329, 1322, 1311, 1324, 1327, 1322, 1323,
-     1320, 1319, 1315, 1321, 1316, 1357, 1356, 1306, 1296,  573,
-     1353, 1806, 1352, 1301, 1293, 1294, 1343, 1306, 1293, 1304,
-     1806, 1292, 1301, 1300, 1300, 1340, 1283, 1292, 1285, 1296,
-     1273, 1277, 1328, 1292, 1274, 1284, 1324, 1323, 1322, 1269,
-     1320, 1284,  578,  583, 1261, 1271,  593, 1806, 1321, 1267,
-
-     1277, 1277, 1260, 1265, 1269, 1259, 1271, 1274, 1311, 1806,
-     1305,  602, 1258, 1266, 1265, 1260, 1256, 1263, 1806, 1246,
-     1249, 1245,   15,   20,   76,  184,  234,  261,  357,  386,
-      386,  421,  426, 1806,  543,  560,  564,  575,  590,  646,
-      576,  578,  593,  581,  645,  605,  591,  594, 1806, 1806,
-      606,  611,  616,  604, 1806, 1806,  618,  605,  600,  605,
-      623,  610,  658,  611,  661,  612,  668, 1806,  615,  619,
-      621,  615,  673,  628,  618,  619,  615,  628,  639,  623,
-      641,  636,  637,  639,  632,  634,  635,  635,  637,  690,
-      649,  654,  631, 1806,  656,  646,  691,  651,  641,  656,
-
-      657,  644,  658, 1806,  677,  685,  665,  655,  702,  667,
-      671,  710,  665,  660,  661,  657,  666,  661,  717,  676,
-      667, 1806,  669,  680,  665,  681,  675,  720,  688,  673,
-      674, 1806,  691,  694,  677,  734,  679, 1806,  696,  699,
-      679,  698,  736,  696,  692,  687,  705,  704,  705,  691,
-      706,  698,  705,  695,  713,  698, 1806,  706,  712,  707,
-      758, 1806,  709,  714,  756,  709,  721,  716,  720,  718,
-      716,  718,  728,  771,  717,  717,  774,  720, 1806,  719,
-      727,  725,  730,  742,  726,  731,  741,  742,  747,  786,
-      745,  761,  767,  740,  751,  742,  794,  739, 1806,  746,
-
-      751,  758,  799,  800,  749, 1806,  745,  748,  747,  767,
-      764,  769,  770,  756,  764,  773,  753,  768,  775,  815,
-     1806,  771,  819,  820,  773,  783,  785,  774,  770,  777,
-      786,  829,  778,  776,  778,  795,  834,  786,  785,  791,
-      789,  787,  840,  841,  837,  797, 1806,  802,  795,  786,
-      805,  793,  803,  800,  805,  801,  814,  814, 1806,  798,
-      799, 1806,  800,  798,  817,  818,  815,  801,  822,  821,
-      805,  810,  828, 1806,  818,  851,  842,  814,  873,  836,
-     1806,  819,  834,  826,  830, 1806, 1806,  840,  875,  824,
-      877,  826,  884,  829,  840,  832,  838,  834,  852,  853,
-
-      854, 1806,  853, 1806,  855, 1806,  840,  841,  860,  851,
-      844,  856,  898,  864, 1806,  856,  906,  849,  908, 1806,
-      909,  853,  859,  866,  908, 1806, 1806,  858,  858,  861,
-      875,  880,  863,  920,  879,  880,  881,  919,  873,  878,
-      927,  877,  929,  878,  931,  932,  874,  934,  895,  936,
-      880,  892,  897,  883,  913,  942,  902, 1806,  894,  945,
-      894,  890,  906,  911,  893,  951,  906,  911, 1806,  912,
-      905,  914,  915,  912,  902,  905,  905,  962,  911,  964,
-      965,  910,  967,  963,  907,  922,  915,  973, 1806,  928,
-     1806, 1806,  934,  926,  936,  922,  923,  982,  983,  929,
-
-      939,  986, 1806,  937,  937,  939,  941,  992,  935,  938,
-     1806,  957, 1806,  941, 1806, 1806,  955, 1806,  949, 1806,
-      999,  950, 1001, 1002,  984, 1806,  962,  963, 1806,  951,
-      950,  953,  953,  954,  950, 1806,  972,  958,  959,  974,
-      974,  977,  977,  974, 1016,  980, 1806,  972, 1806, 1806,
-      982, 1806,  979,  985,  986,  983, 1025, 1806,  976,  977,
-      977,  983,  982,  993, 1806, 1806, 1032,  981, 1806,  982,
-      982,  984,  990, 1806,  992, 1044,  995,  998, 1047, 1010,
-     1806, 1007, 1806, 1004, 1806, 1027, 1047, 1053, 1054,  998,
-     1056, 1057, 1012, 1006, 1060, 1061, 1057, 1022, 1018, 1060,
-
-     1010, 1015, 1013, 1070, 1028, 1072, 1032, 1074, 1037, 1026,
-     1020, 1037, 1037, 1081, 1025, 1042, 1041, 1025, 1081, 1082,
-     1031, 1084, 1049, 1050, 1806, 1050, 1037, 1806, 1048, 1095,
-     1055, 1068, 1055, 1806, 1806, 1099, 1806, 1806, 1048, 1059,
-     1806, 1806, 1049, 1098, 1043, 1048, 1106, 1056, 1066, 1067,
-     1806, 1110, 1065, 1806, 1112, 1806, 1057, 1072, 1060, 1075,
-     1079, 1806, 1113, 1081, 1074, 1083, 1065, 1072, 1124, 1087,
-     1086, 1129, 1130, 1131, 1082, 1806, 1133, 1134, 1081, 1806,
-     1085, 1137, 1083, 1082, 1140, 1095, 1806, 1137, 1090, 1087,
-     1806, 1101, 1806, 1104, 1147, 1102, 1149, 1110, 1093, 1095,
-
-     1092, 1108, 1109, 1118, 1806, 1108, 1158, 1806, 1806, 1806,
-     1154, 1806, 1806, 1119, 1156, 1806, 1110, 1117, 1806, 1114,
-     1119, 1117, 1167, 1168, 1113, 1806, 1128, 1806, 1129, 1119,
-     1131, 1174, 1118, 1126, 1127, 1140, 1806, 1139, 1129, 1128,
-     1142, 1133, 1142, 1144, 1148, 1806, 1806, 1187, 1132, 1189,
-     1149, 1191, 1806, 1187, 1151, 1152, 1139, 1134, 1197, 1156,
-     1157, 1158, 1201, 1160, 1163, 1806, 1204, 1806, 1167, 1806,
-     1149, 1207, 1208, 1153, 1170, 1806, 1156, 1156, 1158, 1806,
-     1163, 1173, 1806, 1159, 1171, 1806, 1806, 1176, 1170, 1174,
-     1165, 1217, 1166, 1174, 1183, 1176, 1171, 1186, 1177, 1184,
-
-     1171, 1186, 1191, 1234, 1193, 1236, 1181, 1197, 1188, 1202,
-     1198, 1191, 1806, 1243, 1806, 1244, 1245, 1202, 1201, 1202,
-     1192, 1806, 1806, 1806, 1250, 1194, 1210, 1253, 1806, 1249,
-     1200, 1806, 1199, 1201, 1212, 1259, 1210, 1806, 1219, 1262,
-     1806, 1806, 1268, 1273, 1278, 1283, 1288, 1293, 1298, 1301,
-     1275, 1280, 1282, 1295
+     1841, 1842,   32, 1837,  141,    0,  201, 1842,  206,   88,
+       11,  213, 1842, 1819,  114,   25,    2,    6, 1842, 1842,
+       73,   11,   17, 1842, 1842, 1842,  104, 1825, 1780,    0,
+     1817,  107, 1832,  217,  247, 1842, 1776,  185, 1775, 1781,
+       93,   58, 1773,   91,  211,  195,   14,  273,  204, 1772,
+      193,  275,  189,  294,   76,   68,  231, 1781,  283,  195,
+      296,  294,  216, 1764,  188,  304,  323,  323, 1783,    0,
+      350,  362,  379,  367,  386, 1842,    0, 1842,  389,  392,
+      195,  212,  216,  295,  299,  253, 1842, 1780, 1819, 1842,
+
+      275, 1842,  383, 1808,  291, 1766, 1776,  331,  314, 1771,
+      296,  367,  361,  377,  387, 1814,    0,  434,  375, 1758,
+     1750, 1759, 1755, 1763,  382, 1759, 1748, 1749,   76, 1765,
+     1748, 1757, 1757,  370, 1748,  369, 1749, 1747,  365, 1793,
+     1797, 1739, 1790, 1732, 1755, 1752, 1752, 1746,  355, 1739,
+     1732, 1737, 1731,  400, 1742, 1735, 1726, 1725, 1739,  381,
+     1725,  408,  420,  171,  440,  396,  431, 1741, 1738, 1739,
+     1737,  413, 1719, 1721,  430, 1713, 1730, 1722,    0,  429,
+      432,  406,  439,  448,  446, 1721, 1842,    0, 1764,  454,
+     1711, 1714,  442,  460, 1722,  468, 1765,  480, 1764,  476,
+
+     1763, 1842,  520, 1762,  486, 1723, 1709, 1702, 1718, 1715,
+     1714, 1705,   75, 1754, 1748, 1714, 1693, 1701, 1696, 1710,
+     1706, 1694, 1706, 1706, 1697, 1681, 1685, 1698, 1700, 1697,
+     1689, 1679, 1697, 1842, 1692, 1695, 1676, 1675, 1725, 1674,
+     1684, 1687,  497, 1683, 1671, 1682, 1718, 1665, 1721, 1658,
+     1673,  502, 1663, 1679, 1660, 1659, 1665, 1656, 1655, 1662,
+     1652, 1663, 1708, 1666, 1665, 1659,  229, 1666, 1661, 1653,
+     1643, 1658, 1657, 1652, 1656, 1637, 1653, 1639, 1645, 1652,
+     1640,  314, 1633, 1647, 1688, 1649,  463, 1640,  484, 1842,
+     1842,  489, 1842, 1842, 1627,    0,  458,  472, 1629,  503,
+
+      490, 1683, 1636,  488, 1842, 1681, 1842, 1675,  556, 1842,
+      483, 1617, 1638, 1672, 1618, 1624, 1674, 1631, 1630,  468,
+     1842, 1628, 1670, 1625, 1622,  537, 1628, 1666, 1660, 1615,
+     1610, 1607, 1656, 1615, 1604, 1620, 1652, 1600,  549, 1614,
+     1599, 1612, 1599, 1609, 1604, 1611, 1606, 1602,  465, 1600,
+     1603, 1598, 1594, 1642,  504, 1636, 1842, 1635, 1587, 1586,
+     1585, 1578,  524, 1585, 1574, 1587,  525, 1632, 1587, 1584,
+     1587, 1587, 1842, 1585, 1574, 1574, 1586,  493, 1561, 1562,
+     1583,  536, 1565, 1614, 1561, 1575, 1574, 1560, 1572, 1571,
+     1570, 1569,  529, 1610, 1609, 1842, 1553, 1552,  583, 1565,
+
+     1842, 1842, 1564,    0, 1553, 1545,  556, 1550, 1601, 1600,
+     1558, 1598, 1842, 1546, 1596, 1842,  563,  609,  557, 1595,
+     1594, 1550, 1546, 1534, 1842, 1539, 1549, 1548, 1535, 1534,
+     1842, 1536, 1533,  545, 1531, 1533, 1842, 1541, 1538, 1523,
+     1536, 1531,  602, 1538, 1526, 1519, 1568, 1842, 1517, 1533,
+     1565, 1528, 1525, 1526, 1528, 1560, 1513, 1508, 1507, 1556,
+     1502, 1517, 1495, 1502, 1507, 1555, 1842, 1502, 1498, 1496,
+     1505, 1499, 1506, 1490, 1490, 1497, 1499, 1502, 1491, 1486,
+     1842, 1541, 1842, 1485, 1496, 1533, 1532, 1479, 1484, 1493,
+     1487, 1481, 1490, 1530, 1524, 1488, 1471, 1471, 1466, 1486,
+
+     1461, 1467, 1466, 1474, 1478, 1461, 1517, 1459, 1473, 1462,
+     1842, 1842, 1462, 1460, 1842, 1471, 1505, 1467,    0, 1451,
+     1468, 1506, 1456, 1842, 1842, 1453, 1842, 1459, 1842,  568,
+      576,  604, 1842, 1842, 1456, 1444, 1495, 1442, 1441, 1440,
+     1447, 1440, 1452, 1451, 1451, 1439, 1480, 1447, 1439, 1482,
+     1428, 1444, 1443, 1842, 1428, 1425, 1481, 1438, 1430, 1436,
+     1427, 1435, 1420, 1436, 1418, 1432,  510, 1414, 1408, 1413,
+     1428, 1425, 1426, 1423, 1464, 1421, 1842, 1407, 1409, 1418,
+     1416, 1453, 1452, 1405,  533, 1403, 1413, 1396, 1397, 1394,
+     1842, 1408, 1387, 1392, 1407, 1404, 1396, 1439, 1393, 1400,
+
+     1436, 1842, 1383, 1397, 1381, 1395, 1398, 1379, 1429, 1428,
+     1427, 1374, 1425, 1424, 1842,   14, 1386, 1386, 1384, 1367,
+     1372, 1374, 1842, 1380, 1370, 1842, 1415, 1363, 1418,  577,
+      549,  565, 1368, 1411,  590, 1415, 1409, 1408, 1407, 1361,
+     1351, 1404, 1357, 1367, 1401, 1364, 1358, 1345, 1353, 1396,
+     1400, 1357, 1356, 1842, 1357, 1350, 1339, 1352, 1355, 1350,
+     1351, 1348, 1347, 1343, 1349, 1344, 1385, 1384, 1334, 1324,
+      583, 1381, 1842, 1380, 1329, 1321, 1322, 1371, 1334, 1321,
+     1332, 1842, 1320, 1311, 1328, 1327, 1327, 1367, 1310, 1319,
+     1318, 1311, 1322, 1299, 1303, 1354, 1318, 1300, 1310, 1350,
+
+     1349, 1348, 1295, 1346, 1310,  562,  593, 1287, 1297,  310,
+     1842, 1347, 1293, 1303, 1303, 1286, 1291, 1295, 1285, 1297,
+     1300, 1337, 1842,   17,  605,    2,   20,   87,  195,  214,
+      372,  377, 1842,  460,  499,  513,  552,  550,  557,  566,
+      575,  584,  640,  599,  589,  605,  595, 1842,  613,  613,
+      606,  617,  615,  658,  602,  604,  620,  608,  665,  624,
+      610,  613, 1842, 1842,  623,  628,  633,  621, 1842, 1842,
+      635,  622,  616,  621,  639,  626,  674,  627,  677,  678,
+      629,  685, 1842,  632,  636,  625,  639,  633,  691,  646,
+      636,  637,  633,  646,  657,  641,  659,  654,  655,  657,
+
+      650,  652,  653,  653,  655,  708,  667,  672,  649, 1842,
+      674,  664,  709,  669,  659,  674,  675,  662,  676, 1842,
+      695,  703,  683,  673,  720,  685,  689,  728,  672,  684,
+      679,  680,  676,  685,  680,  736,  695,  686, 1842,  688,
+      699,  684,  700,  694,  739,  708,  692,  694, 1842,  710,
+      713,  696,  753,  698, 1842,  715,  718,  698,  717,  755,
+      715,  711,  706,  724,  723,  724,  710,  725,  717,  724,
+      714,  719,  733,  718, 1842,  726,  732,  735,  728,  779,
+     1842,  730,  735,  777,  730,  743,  737,  741,  739,  737,
+      739,  749,  792,  738,  738,  795,  741, 1842,  740,  748,
+
+      746,  751,  763,  747,  752,  762,  763,  768,  807,  766,
+      783,  788,  762,  772,  763,  815,  760, 1842,  775,  768,
+      773,  780,  821,  822,  771, 1842,  767,  770,  769,  789,
+      786,  791,  792,  778,  786,  795,  775,  790,  797,  837,
+     1842,  794,  841,  842,  795,  805,  807,  796,  792,  799,
+      808,  851,  800,  798,  800,  817,  856,  808,  807,  813,
+      808,  812,  810,  863,  864,  860,  866,  821, 1842,  826,
+      819,  810,  829,  817,  827,  824,  829,  825,  838,  838,
+     1842,  822,  823, 1842,  824,  822,  841,  843,  840,  825,
+      846,  845,  829,  834,  852, 1842,  842,  875,  866,  838,
+
+      897,  860, 1842,  843,  895,  859,  851,  855, 1842, 1842,
+      865,  900,  849,  902,  851,  909,  854,  865,  857,  863,
+      859,  877,  878,  880, 1842,  878, 1842,  880, 1842,  865,
+      866,  886,  876,  869,  881,  923,  889, 1842,  881,  931,
+      874,  933, 1842,  934,  878,  884,  888,  892,  934, 1842,
+     1842,  884, 1842,  884,  887,  901,  906,  889,  946,  905,
+      906,  907,  945,  899,  904,  953,  903,  955,  904,  957,
+      958,  900,  960,  921,  962,  906,  918,  923,  909,  939,
+      968,  928, 1842,  920,  971,  923,  921,  917,  933,  938,
+      920,  978,  933,  938, 1842,  939,  932,  941,  942,  939,
+
+      929,  932,  932,  989,  938,  991,  992,  937,  994,  991,
+      934,  949,  942, 1000, 1842,  956, 1842, 1842,  961,  953,
+      959,  965,  950,  951, 1010, 1011,  957,  968, 1015, 1842,
+      965,  965,  967,  969, 1020,  963,  966, 1842,  985, 1842,
+      969, 1842, 1842,  983, 1842,  977, 1842, 1027,  978, 1029,
+     1030, 1012, 1842,  990,  991, 1842,  979,  990,  979,  982,
+      982,  983,  979, 1842, 1001,  987,  988, 1003, 1003, 1006,
+     1006, 1003, 1045, 1009, 1842, 1001, 1842, 1842, 1011, 1842,
+     1009, 1014, 1015, 1012, 1054, 1842, 1005, 1006, 1006, 1023,
+     1013, 1012, 1023, 1842, 1842, 1062, 1011, 1842, 1012, 1012,
+
+     1014, 1020, 1842, 1022, 1074, 1025, 1028, 1077, 1040, 1842,
+     1037, 1842, 1034, 1842, 1057, 1077, 1083, 1084, 1035, 1029,
+     1087, 1088, 1043, 1037, 1091, 1092, 1088, 1053, 1049, 1091,
+     1041, 1046, 1044, 1101, 1059, 1103, 1063, 1105, 1068, 1057,
+     1052, 1068, 1068, 1112, 1051, 1057, 1074, 1073, 1057, 1113,
+     1114, 1063, 1116, 1081, 1082, 1842, 1082, 1069, 1842, 1080,
+     1127, 1087, 1101, 1086, 1842, 1842, 1085, 1132, 1842, 1842,
+     1081, 1092, 1842, 1842, 1082, 1131, 1076, 1081, 1139, 1089,
+     1099, 1100, 1842, 1143, 1098, 1842, 1145, 1842, 1090, 1105,
+     1093, 1108, 1112, 1842, 1151, 1147, 1115, 1108, 1117, 1099,
+
+     1108, 1160, 1121, 1120, 1163, 1164, 1165, 1116, 1842, 1167,
+     1168, 1115, 1113, 1842, 1120, 1172, 1118, 1117, 1175, 1130,
+     1842, 1172, 1125, 1122, 1842, 1136, 1842, 1139, 1182, 1137,
+     1184, 1145, 1842, 1128, 1130, 1127, 1143, 1144, 1153, 1842,
+     1143, 1193, 1842, 1842, 1842, 1189, 1842, 1842, 1154, 1196,
+     1192, 1842, 1146, 1153, 1842, 1150, 1155, 1153, 1203, 1204,
+     1149, 1842, 1164, 1842, 1165, 1155, 1167, 1210, 1154, 1162,
+     1163, 1176, 1842, 1175, 1165, 1842, 1164, 1178, 1169, 1178,
+     1180, 1184, 1842, 1842, 1223, 1168, 1225, 1185, 1227, 1842,
+     1223, 1187, 1188, 1175, 1170, 1233, 1192, 1193, 1194, 1237,
+
+     1196, 1199, 1842, 1240, 1842, 1203, 1842, 1185, 1243, 1244,
+     1189, 1206, 1842, 1192, 1192, 1194, 1842, 1199, 1209, 1842,
+     1195, 1207, 1842, 1842, 1212, 1206, 1210, 1201, 1253, 1202,
+     1210, 1219, 1212, 1207, 1222, 1213, 1220, 1207, 1222, 1227,
+     1270, 1229, 1272, 1217, 1233, 1224, 1238, 1234, 1227, 1842,
+     1279, 1842, 1280, 1281, 1238, 1237, 1238, 1228, 1842, 1842,
+     1842, 1286, 1230, 1246, 1289, 1842, 1285, 1236, 1842, 1235,
+     1237, 1248, 1295, 1246, 1842, 1255, 1298, 1842, 1842, 1304,
+     1309, 1314, 1319, 1324, 1329, 1334, 1337, 1311, 1316, 1318,
+     1331
+
     } ;
 
-static yyconst flex_int16_t yy_def[1455] =
+static yyconst flex_int16_t yy_def[1492] =
     {   0,
-     1443, 1443, 1444, 1444, 1443, 1443, 1443, 1443, 1443, 1443,
-     1442, 1442, 1442, 1442, 1442, 1445, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1446,
-     1442, 1442, 1442, 1447,   15, 1442,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1448,   45,   45,
+     1480, 1480, 1481, 1481, 1480, 1480, 1480, 1480, 1480, 1480,
+     1479, 1479, 1479, 1479, 1479, 1482, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1483,
+     1479, 1479, 1479, 1484,   15, 1479,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1485,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
-     1442, 1442, 1442, 1442, 1442, 1442, 1449, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1446, 1442,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1482,
+     1479, 1479, 1479, 1479, 1479, 1479, 1486, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1483, 1479,
 
-     1447, 1442, 1442,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1450,   45, 1448,   45,   45,
+     1484, 1479, 1479,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1487,   45, 1485,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1449, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1451,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1450,
+       45,   45,   45,   45,   45,   45,   45,   45, 1486, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1488,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-     1442, 1448,   45,   45,   45,   45,   45,   45,   45,   45,
+     1487, 1479, 1485,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1452,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1489,   45,   45,   45,   45,
 
-       45, 1442,   45, 1442,   45, 1448, 1442,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1442,   45,   45,   45,
+       45,   45,   45,   45, 1479,   45, 1479,   45, 1485, 1479,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1479,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1442,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1442,   45,   45,
+       45,   45,   45,   45,   45,   45, 1479,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45, 1442, 1442, 1442, 1453,   45,
+       45,   45,   45,   45,   45, 1479,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45, 1442,   45,   45,
-     1442,   45, 1448,   45,   45,   45,   45,   45, 1442,   45,
-       45,   45,   45,   45, 1442,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
+     1479, 1479, 1479, 1490,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45, 1479,   45, 1485,   45,   45,
+       45,   45,   45,   45, 1479,   45,   45,   45,   45,   45,
+     1479,   45,   45,   45,   45,   45, 1479,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1479,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1442,   45, 1442,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1479,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1479,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45, 1442, 1442,   45,   45, 1442,   45,   45, 1442,
-     1454,   45,   45,   45,   45, 1442, 1442,   45, 1442,   45,
-     1442,   45,   45,   45, 1442,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1442,   45,   45,   45,   45,   45,
+     1479, 1479,   45,   45, 1479,   45,   45, 1479, 1491,   45,
+       45,   45,   45, 1479, 1479,   45, 1479,   45, 1479,   45,
+       45,   45, 1479, 1479,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1442,   45,   45,
+       45,   45,   45,   45,   45,   45, 1479,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1479,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 1442,   45,   45,   45,   45,   45,   45,
-       45, 1442,   45,   45, 1442,   45,   45,   45,   45,   45,
+       45, 1479,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1479,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45, 1479,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1442,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
+       45, 1479,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1442,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1442,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1442,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442, 1442,
-       45,   45,   45,   45, 1442, 1442,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1442,   45,   45,
+     1479,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1479,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479, 1479,   45,   45,   45,   45, 1479, 1479,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1442,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45, 1442,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45, 1442,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1479,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1479,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1442,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1479,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1479,   45,
+       45,   45,   45,   45, 1479,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442,   45,
+       45,   45,   45,   45, 1479,   45,   45,   45,   45,   45,
+     1479,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1479,   45,   45,
 
-       45,   45,   45,   45,   45, 1442,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1479,   45,   45,
+       45,   45,   45,   45,   45, 1479,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1442,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1442,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45,   45,   45, 1442, 1442,   45,   45,   45,
+     1479,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45, 1442,   45, 1442,   45, 1442,   45,   45,   45,   45,
-       45,   45,   45,   45, 1442,   45,   45,   45,   45, 1442,
-       45,   45,   45,   45,   45, 1442, 1442,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1479,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1479,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1479,   45,   45,   45,   45,
+
+       45,   45, 1479,   45,   45,   45,   45,   45, 1479, 1479,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1442,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442,   45,
+       45,   45,   45,   45, 1479,   45, 1479,   45, 1479,   45,
+       45,   45,   45,   45,   45,   45,   45, 1479,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45, 1479,
+     1479,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1442,   45,
-     1442, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 1442,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45, 1442,   45, 1442, 1442,   45, 1442,   45, 1442,
-       45,   45,   45,   45,   45, 1442,   45,   45, 1442,   45,
-       45,   45,   45,   45,   45, 1442,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1442,   45, 1442, 1442,
-       45, 1442,   45,   45,   45,   45,   45, 1442,   45,   45,
-       45,   45,   45,   45, 1442, 1442,   45,   45, 1442,   45,
-       45,   45,   45, 1442,   45,   45,   45,   45,   45,   45,
-     1442,   45, 1442,   45, 1442,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1479,   45,   45,   45,   45,   45,
 
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1479,   45, 1479, 1479,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1479,
+       45,   45,   45,   45,   45,   45,   45, 1479,   45, 1479,
+       45, 1479, 1479,   45, 1479,   45, 1479,   45,   45,   45,
+       45,   45, 1479,   45,   45, 1479,   45,   45,   45,   45,
+       45,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1479,   45, 1479, 1479,   45, 1479,
+       45,   45,   45,   45,   45, 1479,   45,   45,   45,   45,
+       45,   45,   45, 1479, 1479,   45,   45, 1479,   45,   45,
+
+       45,   45, 1479,   45,   45,   45,   45,   45,   45, 1479,
+       45, 1479,   45, 1479,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1442,   45,   45, 1442,   45,   45,
-       45,   45,   45, 1442, 1442,   45, 1442, 1442,   45,   45,
-     1442, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-     1442,   45,   45, 1442,   45, 1442,   45,   45,   45,   45,
-       45, 1442,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1442,   45,   45,   45, 1442,
-       45,   45,   45,   45,   45,   45, 1442,   45,   45,   45,
-     1442,   45, 1442,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45, 1442,   45,   45, 1442, 1442, 1442,
-       45, 1442, 1442,   45,   45, 1442,   45,   45, 1442,   45,
-       45,   45,   45,   45,   45, 1442,   45, 1442,   45,   45,
-       45,   45,   45,   45,   45,   45, 1442,   45,   45,   45,
-       45,   45,   45,   45,   45, 1442, 1442,   45,   45,   45,
-       45,   45, 1442,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1442,   45, 1442,   45, 1442,
-       45,   45,   45,   45,   45, 1442,   45,   45,   45, 1442,
-       45,   45, 1442,   45,   45, 1442, 1442,   45,   45,   45,
+       45,   45,   45,   45,   45, 1479,   45,   45, 1479,   45,
+       45,   45,   45,   45, 1479, 1479,   45,   45, 1479, 1479,
+       45,   45, 1479, 1479,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45, 1479,   45, 1479,   45,   45,
+       45,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45, 1479,   45,
+       45,   45,   45, 1479,   45,   45,   45,   45,   45,   45,
+     1479,   45,   45,   45, 1479,   45, 1479,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45,   45,   45,   45, 1479,
+       45,   45, 1479, 1479, 1479,   45, 1479, 1479,   45,   45,
+       45, 1479,   45,   45, 1479,   45,   45,   45,   45,   45,
+       45, 1479,   45, 1479,   45,   45,   45,   45,   45,   45,
+       45,   45, 1479,   45,   45, 1479,   45,   45,   45,   45,
+       45,   45, 1479, 1479,   45,   45,   45,   45,   45, 1479,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
+       45,   45, 1479,   45, 1479,   45, 1479,   45,   45,   45,
+       45,   45, 1479,   45,   45,   45, 1479,   45,   45, 1479,
+       45,   45, 1479, 1479,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1442,   45, 1442,   45,   45,   45,   45,   45,
-       45, 1442, 1442, 1442,   45,   45,   45,   45, 1442,   45,
-       45, 1442,   45,   45,   45,   45,   45, 1442,   45,   45,
-     1442,    0, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1479,
+       45, 1479,   45,   45,   45,   45,   45,   45, 1479, 1479,
+     1479,   45,   45,   45,   45, 1479,   45,   45, 1479,   45,
+       45,   45,   45,   45, 1479,   45,   45, 1479,    0, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479
+
     } ;
 
-static yyconst flex_int16_t yy_nxt[1878] =
+static yyconst flex_int16_t yy_nxt[1914] =
     {   0,
-     1442,   13,   14,   13, 1442,   15,   16, 1442,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   86,  698,
-       37,   14,   37,   87,   25,   26,   38, 1442,  699,   27,
+     1479,   13,   14,   13, 1479,   15,   16, 1479,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   86,  711,
+       37,   14,   37,   87,   25,   26,   38,  821,  712,   27,
        37,   14,   37,   42,   28,   42,   38,   92,   93,   29,
       115,   30,   13,   14,   13,   91,   92,   25,   31,   93,
-       13,   14,   13,   13,   14,   13,   32,   40,  816,   13,
-       14,   13,   33,   40,  115,   92,   93,  817,   91,   34,
+       13,   14,   13,   13,   14,   13,   32,   40,  823,   13,
+       14,   13,   33,   40,  115,   92,   93,  824,   91,   34,
        35,   13,   14,   13,   95,   15,   16,   96,   17,   18,
        19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
        13,  109,   39,   91,   25,   26,   13,   14,   13,   27,
 
        39,   85,   85,   85,   28,   42,   41,   42,   42,   29,
        42,   30,   83,  108,   41,  111,   94,   25,   31,  109,
-      215,  216,   89,  136,   89,  138,   32,   90,   90,   90,
-      137,  315,   33,  139,  818,   83,  108,  316,  111,   34,
+      217,  218,   89,  137,   89,  139,   32,   90,   90,   90,
+      138,  319,   33,  140,  825,   83,  108,  320,  111,   34,
        35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
        45,   45,   45,   45,   45,   47,   45,   45,   45,   45,
        45,   48,   45,   49,   50,   45,   51,   45,   52,   53,
@@ -1035,207 +1048,212 @@ static yyconst flex_int16_t yy_nxt[1878] =
 
        74,   75,   76,   77,   78,   79,   57,   45,   45,   45,
        45,   45,   81,  105,   82,   82,   82,   81,  114,   84,
-       84,   84,  102,  105,   81,   83,   84,   84,   84,  108,
-       83,  181,  122,  112,  140,  123,  536,   83,  124,  105,
-      125,  114,  126,  113,  141,  819,  142,  132,   83,  119,
-      159,  537,  108,   83,  160,  120,  112,  103,  133,  181,
-       83,   45,  148,  135,  161,  199,  149,   45,  134,   45,
-       45,  113,   45,  163,   45,   45,   45,  164,  117,  144,
-      145,   45,   45,  146,   45,   45,  150,  820,  199,  147,
+       84,   84,  102,  180,   81,   83,   84,   84,   84,  262,
+       83,  164,  105,  112,  133,  165,  263,   83,  149,  105,
+      181,  114,  150,  113,  123,  134,  826,  124,   83,  180,
+      125,  182,  126,   83,  127,  135,  112,  103,  119,  160,
+       83,   45,  151,  161,  120,  121,  181,   45,  827,   45,
+       45,  113,   45,  162,   45,   45,   45,  141,  117,  182,
+      102,   45,   45,  377,   45,   45,  378,  142,  182,  143,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   90,   90,   90,   45,  127,  821,
-      111,   45,  128,  179,  259,  129,  130,  181,  114,   45,
-      165,  260,  154,   45,  166,   45,  118,  167,  131,  151,
-      155,  152,  156,  153,  168,  169,  112,  157,  158,  179,
-      170,  174,   85,   85,   85,  184,  113,   90,   90,   90,
-      102,  175,  822,   83,  180,  221,  176,  222,  189,  171,
-       81,  172,   82,   82,   82,   89,  179,   89,  180,  192,
-       90,   90,   90,   83,  113,   81,   83,   84,   84,   84,
-      180,  173,   85,   85,   85,  103,  189,  193,   83,  195,
-
-      101,  196,  182,   83,  183,  192,   83,  101,  197,  209,
-      198,  240,  189,  228,  224,  241,  229,  195,  210,  211,
-      230,   83,  252,  253,  193,  286,   83,  195,  196,  203,
-      225,  270,  271,  823,  286,  101,  197,  198,  255,  101,
-      204,  256,  257,  101,  824,  195,  272,  246,  196,  198,
-      273,  101,  261,  286,  274,  101,  287,  101,  187,  202,
-      202,  202,  289,  345,  825,  288,  202,  202,  202,  202,
-      202,  202,  288,  287,  295,  279,  282,  298,  393,  299,
-      826,  301,  287,  305,  303,  262,  263,  264,  288,  202,
-      202,  202,  202,  202,  202,  291,  265,  295,  266,  290,
-
-      267,  268,  295,  269,  301,  298,  299,  303,  402,  396,
-      305,  306,  306,  306,  346,  356,  396,  347,  306,  306,
-      306,  306,  306,  306,  372,  308,  302,  373,  394,  407,
-      400,  388,  396,  410,  422,  455,  456,  402,  402,  397,
-      401,  306,  306,  306,  306,  306,  306,  404,  405,  357,
-      428,  423,  407,  442,  429,  474,  406,  501,  443,  462,
-      502,  410,  514,  358,  413,  413,  413,  414,  671,  463,
-      712,  413,  413,  413,  413,  413,  413,  484,  489,  507,
-      514,  485,  490,  522,  508,  523,  545,  615,  827,  619,
-      514,  546,  621,  712,  413,  413,  413,  413,  413,  413,
-
-      620,  653,  654,  711,  444,  672,  828,  713,  524,  445,
-      522,  475,  523,   45,   45,   45,  619,  714,  829,  830,
-       45,   45,   45,   45,   45,   45,  717,  753,  620,  785,
-      754,  711,  718,  787,  788,  806,  786,  831,  834,  835,
-      836,  789,  837,   45,   45,   45,   45,   45,   45,  792,
-      838,  832,  839,  840,  841,  793,  833,  842,  843,  844,
-      845,  846,  847,  806,  848,  849,  850,  852,  853,  854,
-      851,  855,  856,  857,  858,  859,  860,  861,  862,  863,
-      864,  865,  866,  867,  868,  869,  870,  871,  872,  873,
-      874,  875,  876,  877,  878,  879,  880,  881,  882,  883,
-
-      884,  885,  886,  887,  888,  889,  890,  891,  892,  893,
-      894,  895,  896,  897,  898,  899,  900,  901,  902,  903,
-      904,  905,  906,  907,  908,  909,  910,  911,  912,  913,
-      914,  915,  893,  916,  917,  892,  918,  919,  920,  921,
-      924,  925,  926,  927,  922,  928,  929,  930,  931,  932,
-      933,  934,  935,  936,  937,  938,  939,  940,  941,  943,
-      944,  945,  946,  947,  948,  949,  950,  951,  952,  942,
-      953,  954,  955,  956,  957,  958,  959,  960,  961,  962,
-      963,  964,  965,  966,  967,  968,  969,  970,  971,  972,
-      973,  974,  975,  976,  978,  923,  977,  979,  980,  981,
-
-      982,  983,  984,  985,  986,  987,  988,  989,  990,  991,
-      992,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
-     1002,  976, 1003,  977, 1004, 1006, 1008, 1009, 1010, 1005,
-     1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020,
-     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
-     1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
-     1041, 1042, 1043, 1044, 1045, 1046, 1047, 1007, 1048, 1049,
-     1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
-     1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069,
-     1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077, 1055, 1078,
-
-     1079, 1080, 1081, 1082, 1056, 1083, 1084, 1085, 1086, 1087,
-     1088, 1089, 1090, 1091, 1092, 1093, 1094, 1095, 1096, 1097,
-     1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107,
+       45,   45,   45,   45,  108,  103,  185,   45,  128,  305,
+      111,   45,  129,  180,  393,  130,  131,  181,  190,   45,
+      145,  146,  196,   45,  147,   45,  118,  108,  132,  152,
+      148,  153,  155,  154,  194,  112,  114,  166,  136,  183,
+      156,  167,  157,  184,  168,  113,  190,  158,  159,  193,
+      196,  169,  170,   85,   85,   85,  808,  171,  172,  175,
+      173,  194,  809,   81,   83,   82,   82,   82,   81,  176,
+       84,   84,   84,  113,  177,  193,   83,   89,  101,   89,
+      174,   83,   90,   90,   90,  101,  198,   83,  197,   85,
+
+       85,   85,   90,   90,   90,   90,   90,   90,  199,   83,
+       83,  200,  190,  223,   83,  224,  226,  242,  828,  230,
+      829,  243,  231,  101,  198,  197,  232,  101,  211,  204,
+      291,  101,  227,   83,  200,  199,  196,  212,  213,  101,
+      205,  254,  255,  101,  197,  101,  188,  203,  203,  203,
+      264,  273,  274,  291,  203,  203,  203,  203,  203,  203,
+      290,  199,  289,  260,  196,  257,  248,  261,  258,  259,
+      291,  282,  289,  398,  298,  301,  290,  203,  203,  203,
+      203,  203,  203,  265,  266,  267,  290,  275,  285,  302,
+      289,  276,  304,  294,  268,  277,  269,  298,  270,  271,
+
+      292,  272,  293,  301,  306,  308,  298,  349,  401,  405,
+      407,  428,  360,  401,  412,  304,  302,  409,  410,  406,
+      415,  407,  830,  399,  461,  462,  411,  306,  429,  311,
+      481,  401,  308,  309,  309,  309,  402,  412,  682,  407,
+      309,  309,  309,  309,  309,  309,  361,  434,  415,  492,
+      419,  435,  468,  493,  448,  664,  665,  831,  350,  449,
+      362,  351,  469,  309,  309,  309,  309,  309,  309,  418,
+      418,  418,  476,  725,  832,  683,  418,  418,  418,  418,
+      418,  418,  509,  497,  477,  510,  482,  498,  515,  522,
+      522,  545,  530,  516,  531,  833,  725,  834,  630,  418,
+
+      418,  418,  418,  418,  418,  450,  546,  554,  631,  626,
+      451,  724,  555,  801,  632,  835,  726,  522,  532,  530,
+      802,  531,   45,   45,   45,  630,  727,  836,  837,   45,
+       45,   45,   45,   45,   45,  730,  631,  767,  822,  724,
+      768,  731,  838,  803,  804,  839,  840,  841,  842,  843,
+      732,  805,   45,   45,   45,   45,   45,   45,  844,  845,
+      846,  847,  848,  849,  851,  852,  822,  853,  850,  854,
+      855,  856,  857,  858,  859,  860,  861,  862,  863,  864,
+      865,  866,  867,  869,  870,  871,  868,  872,  873,  874,
+      875,  876,  877,  878,  879,  880,  881,  882,  883,  884,
+
+      885,  886,  887,  888,  889,  890,  891,  892,  893,  894,
+      895,  896,  897,  898,  899,  900,  901,  902,  903,  904,
+      905,  906,  907,  908,  909,  910,  911,  912,  913,  914,
+      915,  916,  917,  918,  919,  920,  921,  922,  923,  924,
+      925,  926,  927,  928,  929,  930,  931,  932,  933,  934,
+      912,  935,  936,  911,  937,  938,  939,  940,  941,  944,
+      945,  946,  947,  942,  948,  949,  950,  951,  952,  953,
+      954,  955,  956,  957,  958,  959,  960,  961,  962,  964,
+      965,  966,  967,  968,  969,  970,  971,  972,  973,  963,
+      974,  975,  976,  977,  978,  979,  980,  981,  982,  983,
+
+      984,  985,  986,  987,  988,  989,  990,  991,  992,  993,
+      994,  995,  996,  997,  943,  998, 1000,  999, 1001, 1002,
+     1003, 1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,
+     1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021, 1022,
+     1023, 1024, 1025,  998,  999, 1026, 1027, 1029, 1031, 1032,
+     1033, 1028, 1034, 1035, 1036, 1037, 1038, 1039, 1040, 1041,
+     1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
+     1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061,
+     1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1030,
+     1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
+
+     1081, 1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1090,
+     1091, 1092, 1093, 1094, 1095, 1096, 1097, 1098, 1099, 1100,
+     1101, 1102, 1080, 1103, 1104, 1105, 1106, 1107, 1081, 1108,
      1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
      1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 1128,
-     1129, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1138, 1139,
+     1129, 1130, 1131, 1132, 1133, 1134, 1136, 1137, 1138, 1139,
      1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
-     1150, 1151, 1152, 1153, 1125, 1154, 1155, 1157, 1158, 1159,
-     1108, 1160, 1161, 1162, 1156, 1163, 1164, 1165, 1166, 1167,
-     1168, 1169, 1130, 1170, 1171, 1172, 1173, 1174, 1175, 1176,
-
-     1177, 1178, 1179, 1180, 1181, 1182, 1183, 1185, 1186, 1187,
-     1188, 1184, 1189, 1190, 1191, 1192, 1193, 1194, 1195, 1196,
-     1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206,
-     1207, 1186, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
-     1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225,
-     1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235,
-     1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245,
-     1246, 1247, 1248, 1249, 1250, 1251, 1253, 1254, 1255, 1256,
-     1257, 1258, 1259, 1232, 1260, 1261, 1262, 1263, 1264, 1265,
-     1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275,
-
-     1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 1285,
-     1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293, 1294, 1295,
-     1296, 1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305,
-     1278, 1252, 1306, 1307, 1308, 1309, 1310, 1311, 1312, 1313,
-     1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322, 1323,
-     1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333,
-     1334, 1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343,
-     1344, 1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353,
-     1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363,
-     1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373,
-
-     1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383,
-     1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393,
-     1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403,
-     1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413,
-     1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423,
-     1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433,
-     1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441,   12,   12,
-       12,   12,   12,   36,   36,   36,   36,   36,   80,  293,
-       80,   80,   80,   99,  399,   99,  511,   99,  101,  101,
-      101,  101,  101,  116,  116,  116,  116,  116,  178,  101,
-
-      178,  178,  178,  200,  200,  200,  815,  814,  813,  812,
-      811,  810,  809,  808,  807,  805,  804,  803,  802,  801,
-      800,  799,  798,  797,  796,  795,  794,  791,  790,  784,
-      783,  782,  781,  780,  779,  778,  777,  776,  775,  774,
-      773,  772,  771,  770,  769,  768,  767,  766,  765,  764,
-      763,  762,  761,  760,  759,  758,  757,  756,  755,  752,
-      751,  750,  749,  748,  747,  746,  745,  744,  743,  742,
-      741,  740,  739,  738,  737,  736,  735,  734,  733,  732,
-      731,  730,  729,  728,  727,  726,  725,  724,  723,  722,
-      721,  720,  719,  716,  715,  710,  709,  708,  707,  706,
-
-      705,  704,  703,  702,  701,  700,  697,  696,  695,  694,
-      693,  692,  691,  690,  689,  688,  687,  686,  685,  684,
-      683,  682,  681,  680,  679,  678,  677,  676,  675,  674,
-      673,  670,  669,  668,  667,  666,  665,  664,  663,  662,
-      661,  660,  659,  658,  657,  656,  655,  652,  651,  650,
-      649,  648,  647,  646,  645,  644,  643,  642,  641,  640,
-      639,  638,  637,  636,  635,  634,  633,  632,  631,  630,
-      629,  628,  627,  626,  625,  624,  623,  622,  618,  617,
-      616,  615,  614,  613,  612,  611,  610,  609,  608,  607,
-      606,  605,  604,  603,  602,  601,  600,  599,  598,  597,
-
-      596,  595,  594,  593,  592,  591,  590,  589,  588,  587,
-      586,  585,  584,  583,  582,  581,  580,  579,  578,  577,
-      576,  575,  574,  573,  572,  571,  570,  569,  568,  567,
-      566,  565,  564,  563,  562,  561,  560,  559,  558,  557,
-      556,  555,  554,  553,  552,  551,  550,  549,  548,  547,
-      544,  543,  542,  541,  540,  539,  538,  535,  534,  533,
-      532,  531,  530,  529,  528,  527,  526,  525,  521,  520,
-      519,  518,  517,  516,  515,  513,  512,  510,  509,  506,
-      505,  504,  503,  500,  499,  498,  497,  496,  495,  494,
-      493,  492,  491,  488,  487,  486,  483,  482,  481,  480,
-
-      479,  478,  477,  476,  473,  472,  471,  470,  469,  468,
-      467,  466,  465,  464,  461,  460,  459,  458,  457,  454,
-      453,  452,  451,  450,  449,  448,  447,  446,  441,  440,
-      439,  438,  437,  436,  435,  434,  433,  432,  431,  430,
-      427,  426,  425,  424,  421,  420,  419,  418,  417,  416,
-      415,  412,  411,  409,  408,  403,  398,  395,  392,  391,
-      390,  389,  387,  386,  385,  384,  383,  382,  381,  380,
-      379,  378,  377,  376,  375,  374,  371,  370,  369,  368,
-      367,  366,  365,  364,  363,  362,  361,  360,  359,  355,
-      354,  353,  352,  351,  350,  349,  348,  344,  343,  342,
-
-      341,  340,  339,  338,  337,  336,  335,  334,  333,  332,
-      331,  330,  329,  328,  327,  326,  325,  324,  323,  322,
-      321,  320,  319,  318,  317,  314,  313,  312,  311,  310,
-      309,  307,  201,  304,  302,  300,  297,  296,  294,  292,
-      285,  284,  283,  281,  280,  278,  277,  276,  275,  258,
-      254,  251,  250,  249,  248,  247,  245,  244,  243,  242,
-      239,  238,  237,  236,  235,  234,  233,  232,  231,  227,
-      226,  223,  220,  219,  218,  217,  214,  213,  212,  208,
-      207,  206,  205,  201,  194,  191,  190,  188,  186,  185,
-      177,  162,  143,  121,  110,  107,  106,  104,   43,  100,
-
-       98,   97,   88,   43, 1442,   11, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442
+     1150, 1151, 1152, 1153, 1154, 1155, 1156, 1158, 1159, 1160,
+     1161, 1162, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1170,
+     1171, 1172, 1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180,
+
+     1152, 1181, 1182, 1183, 1185, 1186, 1135, 1187, 1188, 1189,
+     1190, 1184, 1191, 1192, 1193, 1194, 1195, 1196, 1157, 1197,
+     1198, 1199, 1200, 1201, 1202, 1203, 1204, 1205, 1206, 1207,
+     1208, 1209, 1210, 1211, 1212, 1214, 1215, 1216, 1217, 1213,
+     1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+     1228, 1229, 1230, 1231, 1232, 1233, 1234, 1235, 1236, 1215,
+     1237, 1238, 1239, 1240, 1241, 1242, 1243, 1244, 1245, 1246,
+     1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1256,
+     1257, 1258, 1259, 1260, 1261, 1262, 1263, 1264, 1265, 1266,
+     1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274, 1275, 1276,
+
+     1277, 1278, 1279, 1280, 1281, 1282, 1283, 1285, 1286, 1287,
+     1288, 1289, 1290, 1263, 1291, 1292, 1293, 1294, 1295, 1296,
+     1297, 1298, 1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306,
+     1307, 1308, 1309, 1310, 1312, 1311, 1313, 1314, 1315, 1316,
+     1317, 1318, 1319, 1320, 1321, 1322, 1323, 1324, 1325, 1326,
+     1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334, 1335, 1336,
+     1337, 1338, 1284, 1311, 1339, 1340, 1341, 1342, 1343, 1344,
+     1345, 1346, 1347, 1348, 1349, 1350, 1351, 1352, 1353, 1354,
+     1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364,
+     1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372, 1373, 1374,
+
+     1375, 1376, 1377, 1378, 1379, 1380, 1381, 1382, 1383, 1384,
+     1385, 1386, 1387, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
+     1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404,
+     1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1413, 1414,
+     1415, 1416, 1417, 1418, 1419, 1420, 1421, 1422, 1423, 1424,
+     1425, 1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434,
+     1435, 1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444,
+     1445, 1446, 1447, 1448, 1449, 1450, 1451, 1452, 1453, 1454,
+     1455, 1456, 1457, 1458, 1459, 1460, 1461, 1462, 1463, 1464,
+     1465, 1466, 1467, 1468, 1469, 1470, 1471, 1472, 1473, 1474,
+
+     1475, 1476, 1477, 1478,   12,   12,   12,   12,   12,   36,
+       36,   36,   36,   36,   80,  296,   80,   80,   80,   99,
+      404,   99,  519,   99,  101,  101,  101,  101,  101,  116,
+      116,  116,  116,  116,  179,  101,  179,  179,  179,  201,
+      201,  201,  820,  819,  818,  817,  816,  815,  814,  813,
+      812,  811,  810,  807,  806,  800,  799,  798,  797,  796,
+      795,  794,  793,  792,  791,  790,  789,  788,  787,  786,
+      785,  784,  783,  782,  781,  780,  779,  778,  777,  776,
+      775,  774,  773,  772,  771,  770,  769,  766,  765,  764,
+      763,  762,  761,  760,  759,  758,  757,  756,  755,  754,
+
+      753,  752,  751,  750,  749,  748,  747,  746,  745,  744,
+      743,  742,  741,  740,  739,  738,  737,  736,  735,  734,
+      733,  729,  728,  723,  722,  721,  720,  719,  718,  717,
+      716,  715,  714,  713,  710,  709,  708,  707,  706,  705,
+      704,  703,  702,  701,  700,  699,  698,  697,  696,  695,
+      694,  693,  692,  691,  690,  689,  688,  687,  686,  685,
+      684,  681,  680,  679,  678,  677,  676,  675,  674,  673,
+      672,  671,  670,  669,  668,  667,  666,  663,  662,  661,
+      660,  659,  658,  657,  656,  655,  654,  653,  652,  651,
+      650,  649,  648,  647,  646,  645,  644,  643,  642,  641,
+
+      640,  639,  638,  637,  636,  635,  634,  633,  629,  628,
+      627,  626,  625,  624,  623,  622,  621,  620,  619,  618,
+      617,  616,  615,  614,  613,  612,  611,  610,  609,  608,
+      607,  606,  605,  604,  603,  602,  601,  600,  599,  598,
+      597,  596,  595,  594,  593,  592,  591,  590,  589,  588,
+      587,  586,  585,  584,  583,  582,  581,  580,  579,  578,
+      577,  576,  575,  574,  573,  572,  571,  570,  569,  568,
+      567,  566,  565,  564,  563,  562,  561,  560,  559,  558,
+      557,  556,  553,  552,  551,  550,  549,  548,  547,  544,
+      543,  542,  541,  540,  539,  538,  537,  536,  535,  534,
+
+      533,  529,  528,  527,  526,  525,  524,  523,  521,  520,
+      518,  517,  514,  513,  512,  511,  508,  507,  506,  505,
+      504,  503,  502,  501,  500,  499,  496,  495,  494,  491,
+      490,  489,  488,  487,  486,  485,  484,  483,  480,  479,
+      478,  475,  474,  473,  472,  471,  470,  467,  466,  465,
+      464,  463,  460,  459,  458,  457,  456,  455,  454,  453,
+      452,  447,  446,  445,  444,  443,  442,  441,  440,  439,
+      438,  437,  436,  433,  432,  431,  430,  427,  426,  425,
+      424,  423,  422,  421,  420,  417,  416,  414,  413,  408,
+      403,  400,  397,  396,  395,  394,  392,  391,  390,  389,
+
+      388,  387,  386,  385,  384,  383,  382,  381,  380,  379,
+      376,  375,  374,  373,  372,  371,  370,  369,  368,  367,
+      366,  365,  364,  363,  359,  358,  357,  356,  355,  354,
+      353,  352,  348,  347,  346,  345,  344,  343,  342,  341,
+      340,  339,  338,  337,  336,  335,  334,  333,  332,  331,
+      330,  329,  328,  327,  326,  325,  324,  323,  322,  321,
+      318,  317,  316,  315,  314,  313,  312,  310,  202,  307,
+      305,  303,  300,  299,  297,  295,  288,  287,  286,  284,
+      283,  281,  280,  279,  278,  256,  253,  252,  251,  250,
+      249,  247,  246,  245,  244,  241,  240,  239,  238,  237,
+
+      236,  235,  234,  233,  229,  228,  225,  222,  221,  220,
+      219,  216,  215,  214,  210,  209,  208,  207,  206,  202,
+      195,  192,  191,  189,  187,  186,  178,  163,  144,  122,
+      110,  107,  106,  104,   43,  100,   98,   97,   88,   43,
+     1479,   11, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479
     } ;
 
-static yyconst flex_int16_t yy_chk[1878] =
+static yyconst flex_int16_t yy_chk[1914] =
     {   0,
         0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  605,
-        3,    3,    3,   21,    1,    1,    3,    0,  605,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,   21,  616,
+        3,    3,    3,   21,    1,    1,    3,  724,  616,    1,
         4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
        57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  723,    8,
-        8,    8,    1,    8,   57,   27,   28,  724,   26,    1,
+        6,    6,    6,    7,    7,    7,    1,    7,  726,    8,
+        8,    8,    1,    8,   57,   27,   28,  727,   26,    1,
         1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
         9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
 
         6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
        42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-      128,  128,   25,   65,   25,   66,    2,   25,   25,   25,
-       65,  211,    2,   66,  725,   20,   51,  211,   54,    2,
+      129,  129,   25,   65,   25,   66,    2,   25,   25,   25,
+       65,  213,    2,   66,  728,   20,   51,  213,   54,    2,
         2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1245,188 +1263,193 @@ static yyconst flex_int16_t yy_chk[1878] =
 
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   17,   48,   17,   17,   17,   19,   56,   19,
-       19,   19,   44,   59,   22,   17,   22,   22,   22,   64,
-       19,   93,   61,   55,   67,   61,  428,   22,   61,   48,
-       61,   56,   61,   55,   67,  726,   67,   63,   17,   59,
-       73,  428,   64,   19,   73,   59,   55,   44,   63,   93,
-       22,   45,   70,   64,   73,  115,   70,   45,   63,   45,
-       45,   55,   45,   75,   45,   45,   45,   75,   58,   69,
-       69,   45,   45,   69,   45,   58,   70,  727,  115,   69,
+       19,   19,   44,   91,   22,   17,   22,   22,   22,  164,
+       19,   75,   59,   55,   63,   75,  164,   22,   70,   48,
+       92,   56,   70,   55,   61,   63,  729,   61,   17,   91,
+       61,   93,   61,   19,   61,   63,   55,   44,   59,   73,
+       22,   45,   70,   73,   59,   59,   92,   45,  730,   45,
+       45,   55,   45,   73,   45,   45,   45,   67,   58,   93,
+      101,   45,   45,  267,   45,   58,  267,   67,   96,   67,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   58,   89,   89,   89,   58,   62,  728,
-       71,   58,   62,   91,  163,   62,   62,   96,   78,   58,
-       76,  163,   72,   58,   76,   58,   58,   76,   62,   71,
-       72,   71,   72,   71,   76,   76,   77,   72,   72,   91,
-       76,   78,   81,   81,   81,   96,   77,   90,   90,   90,
-      101,   78,  729,   81,   92,  133,   78,  133,  105,   77,
-       82,   77,   82,   82,   82,   83,   94,   83,   95,  108,
-       83,   83,   83,   82,   77,   84,   81,   84,   84,   84,
-       92,   77,   85,   85,   85,  101,  105,  109,   84,  111,
-
-      103,  112,   94,   85,   95,  108,   82,  103,  113,  124,
-      114,  148,  119,  138,  135,  148,  138,  153,  124,  124,
-      138,   84,  159,  159,  109,  179,   85,  111,  112,  119,
-      135,  165,  165,  730,  182,  103,  113,  114,  161,  103,
-      119,  161,  161,  103,  731,  153,  166,  153,  171,  174,
-      166,  103,  164,  179,  166,  103,  180,  103,  103,  118,
-      118,  118,  182,  241,  732,  181,  118,  118,  118,  118,
-      118,  118,  184,  183,  189,  171,  174,  192,  284,  193,
-      733,  195,  180,  199,  197,  164,  164,  164,  181,  118,
-      118,  118,  118,  118,  118,  184,  164,  189,  164,  183,
-
-      164,  164,  204,  164,  195,  192,  193,  197,  295,  286,
-      199,  202,  202,  202,  241,  250,  289,  241,  202,  202,
-      202,  202,  202,  202,  264,  204,  279,  264,  284,  298,
-      294,  279,  286,  301,  316,  345,  345,  295,  308,  289,
-      294,  202,  202,  202,  202,  202,  202,  297,  297,  250,
-      322,  316,  298,  335,  322,  363,  297,  388,  335,  351,
-      388,  301,  402,  250,  306,  306,  306,  308,  576,  351,
-      620,  306,  306,  306,  306,  306,  306,  373,  377,  394,
-      414,  373,  377,  412,  394,  412,  437,  524,  735,  522,
-      402,  437,  524,  620,  306,  306,  306,  306,  306,  306,
-
-      523,  558,  558,  619,  335,  576,  736,  621,  414,  335,
-      412,  363,  412,  413,  413,  413,  522,  621,  737,  738,
-      413,  413,  413,  413,  413,  413,  624,  660,  523,  693,
-      660,  619,  624,  694,  694,  712,  693,  739,  741,  742,
-      743,  694,  744,  413,  413,  413,  413,  413,  413,  697,
-      745,  740,  746,  747,  748,  697,  740,  751,  752,  753,
-      754,  757,  758,  712,  759,  760,  761,  762,  763,  764,
-      761,  765,  766,  767,  769,  770,  771,  772,  773,  774,
-      775,  776,  777,  778,  779,  780,  781,  782,  783,  784,
-      785,  786,  787,  788,  789,  790,  791,  792,  793,  795,
-
-      796,  797,  798,  799,  800,  801,  802,  803,  805,  806,
-      807,  808,  809,  810,  811,  812,  813,  814,  815,  816,
-      817,  818,  819,  820,  821,  823,  824,  825,  826,  827,
-      828,  829,  806,  830,  831,  805,  833,  834,  835,  836,
-      837,  839,  840,  841,  836,  842,  843,  844,  845,  846,
-      847,  848,  849,  850,  851,  852,  853,  854,  855,  856,
-      858,  859,  860,  861,  863,  864,  865,  866,  867,  855,
-      868,  869,  870,  871,  872,  873,  874,  875,  876,  877,
-      878,  880,  881,  882,  883,  884,  885,  886,  887,  888,
-      889,  890,  891,  892,  894,  836,  893,  895,  896,  897,
-
-      898,  900,  901,  902,  903,  904,  905,  907,  908,  909,
-      910,  911,  912,  913,  914,  915,  916,  917,  918,  919,
-      920,  892,  922,  893,  923,  924,  925,  926,  927,  923,
+       45,   45,   45,   58,   64,  101,   96,   58,   62,  282,
+       71,   58,   62,   94,  282,   62,   62,   95,  105,   58,
+       69,   69,  111,   58,   69,   58,   58,   64,   62,   71,
+       69,   71,   72,   71,  109,   77,   78,   76,   64,   94,
+       72,   76,   72,   95,   76,   77,  105,   72,   72,  108,
+      111,   76,   76,   81,   81,   81,  710,   76,   77,   78,
+       77,  109,  710,   82,   81,   82,   82,   82,   84,   78,
+       84,   84,   84,   77,   78,  108,   82,   83,  103,   83,
+       77,   84,   83,   83,   83,  103,  113,   81,  112,   85,
+
+       85,   85,   89,   89,   89,   90,   90,   90,  114,   82,
+       85,  115,  119,  134,   84,  134,  136,  149,  731,  139,
+      732,  149,  139,  103,  113,  112,  139,  103,  125,  119,
+      182,  103,  136,   85,  115,  114,  154,  125,  125,  103,
+      119,  160,  160,  103,  172,  103,  103,  118,  118,  118,
+      165,  166,  166,  182,  118,  118,  118,  118,  118,  118,
+      181,  175,  180,  163,  154,  162,  154,  163,  162,  162,
+      185,  172,  183,  287,  190,  193,  184,  118,  118,  118,
+      118,  118,  118,  165,  165,  165,  181,  167,  175,  194,
+      180,  167,  196,  185,  165,  167,  165,  190,  165,  165,
+
+      183,  165,  184,  193,  198,  200,  205,  243,  289,  297,
+      298,  320,  252,  292,  301,  196,  194,  300,  300,  297,
+      304,  311,  734,  287,  349,  349,  300,  198,  320,  205,
+      367,  289,  200,  203,  203,  203,  292,  301,  585,  298,
+      203,  203,  203,  203,  203,  203,  252,  326,  304,  378,
+      311,  326,  355,  378,  339,  567,  567,  735,  243,  339,
+      252,  243,  355,  203,  203,  203,  203,  203,  203,  309,
+      309,  309,  363,  631,  736,  585,  309,  309,  309,  309,
+      309,  309,  393,  382,  363,  393,  367,  382,  399,  407,
+      419,  434,  417,  399,  417,  737,  631,  738,  530,  309,
+
+      309,  309,  309,  309,  309,  339,  434,  443,  531,  532,
+      339,  630,  443,  706,  532,  739,  632,  407,  419,  417,
+      706,  417,  418,  418,  418,  530,  632,  740,  741,  418,
+      418,  418,  418,  418,  418,  635,  531,  671,  725,  630,
+      671,  635,  742,  707,  707,  743,  744,  745,  746,  747,
+      635,  707,  418,  418,  418,  418,  418,  418,  749,  750,
+      751,  752,  753,  754,  755,  756,  725,  757,  754,  758,
+      759,  760,  761,  762,  765,  766,  767,  768,  771,  772,
+      773,  774,  775,  776,  777,  778,  775,  779,  780,  781,
+      782,  784,  785,  786,  787,  788,  789,  790,  791,  792,
+
+      793,  794,  795,  796,  797,  798,  799,  800,  801,  802,
+      803,  804,  805,  806,  807,  808,  809,  811,  812,  813,
+      814,  815,  816,  817,  818,  819,  821,  822,  823,  824,
+      825,  826,  827,  828,  829,  830,  831,  832,  833,  834,
+      835,  836,  837,  838,  840,  841,  842,  843,  844,  845,
+      822,  846,  847,  821,  848,  850,  851,  852,  853,  854,
+      856,  857,  858,  853,  859,  860,  861,  862,  863,  864,
+      865,  866,  867,  868,  869,  870,  871,  872,  873,  874,
+      876,  877,  878,  879,  880,  882,  883,  884,  885,  873,
+      886,  887,  888,  889,  890,  891,  892,  893,  894,  895,
+
+      896,  897,  899,  900,  901,  902,  903,  904,  905,  906,
+      907,  908,  909,  910,  853,  911,  913,  912,  914,  915,
+      916,  917,  919,  920,  921,  922,  923,  924,  925,  927,
       928,  929,  930,  931,  932,  933,  934,  935,  936,  937,
-      938,  939,  940,  941,  942,  943,  944,  945,  946,  948,
-      949,  950,  951,  952,  953,  954,  955,  956,  957,  958,
-      960,  961,  963,  964,  965,  966,  967,  924,  968,  969,
-      970,  971,  972,  973,  975,  976,  977,  978,  979,  980,
-      982,  983,  984,  985,  988,  989,  990,  991,  992,  993,
-      994,  995,  996,  997,  998,  999, 1000, 1001,  976, 1003,
-
-     1005, 1007, 1008, 1009,  977, 1010, 1011, 1012, 1013, 1014,
-     1016, 1017, 1018, 1019, 1021, 1022, 1023, 1024, 1025, 1028,
-     1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
-     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
-     1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1059,
-     1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1070,
-     1071, 1072, 1073, 1074, 1075, 1076, 1077, 1078, 1079, 1080,
-     1081, 1082, 1083, 1084, 1055, 1085, 1086, 1087, 1088, 1090,
-     1038, 1093, 1094, 1095, 1086, 1096, 1097, 1098, 1099, 1100,
-     1101, 1102, 1060, 1104, 1105, 1106, 1107, 1108, 1109, 1110,
-
-     1112, 1114, 1117, 1119, 1121, 1122, 1123, 1124, 1125, 1127,
-     1128, 1123, 1130, 1131, 1132, 1133, 1134, 1135, 1137, 1138,
-     1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1148, 1151,
-     1153, 1125, 1154, 1155, 1156, 1157, 1159, 1160, 1161, 1162,
-     1163, 1164, 1167, 1168, 1170, 1171, 1172, 1173, 1175, 1176,
-     1177, 1178, 1179, 1180, 1182, 1184, 1186, 1187, 1188, 1189,
-     1190, 1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199,
-     1200, 1201, 1202, 1203, 1203, 1204, 1205, 1206, 1207, 1208,
-     1209, 1210, 1211, 1186, 1212, 1213, 1214, 1215, 1216, 1217,
-     1218, 1219, 1220, 1221, 1222, 1223, 1224, 1226, 1227, 1229,
-
-     1230, 1231, 1232, 1233, 1236, 1239, 1240, 1243, 1244, 1245,
-     1246, 1247, 1248, 1249, 1250, 1252, 1253, 1255, 1257, 1258,
-     1259, 1260, 1261, 1263, 1264, 1265, 1266, 1267, 1268, 1269,
-     1232, 1204, 1270, 1271, 1272, 1273, 1274, 1275, 1277, 1278,
-     1279, 1281, 1282, 1283, 1284, 1285, 1286, 1288, 1289, 1290,
-     1292, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301, 1302,
-     1303, 1304, 1306, 1307, 1311, 1314, 1315, 1317, 1318, 1320,
-     1321, 1322, 1323, 1324, 1325, 1327, 1329, 1330, 1331, 1332,
-     1333, 1334, 1335, 1336, 1338, 1339, 1340, 1341, 1342, 1343,
-     1344, 1345, 1348, 1349, 1350, 1351, 1352, 1354, 1355, 1356,
-
-     1357, 1358, 1359, 1360, 1361, 1362, 1363, 1364, 1365, 1367,
-     1369, 1371, 1372, 1373, 1374, 1375, 1377, 1378, 1379, 1381,
-     1382, 1384, 1385, 1388, 1389, 1390, 1391, 1392, 1393, 1394,
-     1395, 1396, 1397, 1398, 1399, 1400, 1401, 1402, 1403, 1404,
-     1405, 1406, 1407, 1408, 1409, 1410, 1411, 1412, 1414, 1416,
-     1417, 1418, 1419, 1420, 1421, 1425, 1426, 1427, 1428, 1430,
-     1431, 1433, 1434, 1435, 1436, 1437, 1439, 1440, 1443, 1443,
-     1443, 1443, 1443, 1444, 1444, 1444, 1444, 1444, 1445, 1451,
-     1445, 1445, 1445, 1446, 1452, 1446, 1453, 1446, 1447, 1447,
-     1447, 1447, 1447, 1448, 1448, 1448, 1448, 1448, 1449, 1454,
-
-     1449, 1449, 1449, 1450, 1450, 1450,  722,  721,  720,  718,
-      717,  716,  715,  714,  713,  711,  709,  708,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  696,  695,  692,
-      691,  690,  689,  688,  687,  686,  685,  684,  683,  682,
-      681,  680,  679,  678,  677,  676,  675,  674,  673,  672,
-      670,  669,  668,  667,  666,  665,  664,  663,  661,  659,
-      658,  657,  656,  655,  654,  653,  652,  651,  650,  649,
-      648,  647,  646,  645,  644,  642,  641,  640,  639,  638,
-      637,  636,  635,  634,  633,  632,  631,  630,  629,  628,
-      627,  626,  625,  623,  622,  618,  617,  616,  614,  613,
-
-      611,  610,  609,  608,  607,  606,  603,  602,  601,  600,
-      599,  598,  597,  596,  595,  594,  593,  592,  590,  589,
-      588,  587,  586,  585,  584,  583,  582,  580,  579,  578,
-      577,  575,  574,  573,  572,  571,  570,  569,  567,  566,
-      565,  564,  563,  562,  561,  560,  559,  557,  556,  555,
-      554,  553,  552,  551,  550,  549,  548,  547,  546,  544,
-      543,  542,  541,  540,  539,  538,  537,  536,  535,  534,
-      533,  532,  531,  530,  529,  528,  527,  526,  520,  518,
-      515,  514,  513,  512,  510,  509,  508,  506,  505,  502,
-      501,  500,  499,  498,  497,  496,  495,  494,  493,  492,
-
-      491,  490,  489,  488,  487,  486,  485,  484,  483,  482,
-      481,  480,  479,  478,  477,  475,  473,  472,  471,  470,
-      469,  468,  467,  466,  465,  464,  463,  462,  460,  459,
-      458,  457,  456,  455,  454,  453,  452,  451,  450,  449,
-      448,  447,  446,  445,  444,  443,  441,  440,  439,  438,
-      436,  435,  434,  433,  432,  430,  429,  427,  426,  424,
-      423,  422,  421,  420,  418,  417,  416,  415,  410,  409,
-      407,  406,  405,  404,  403,  401,  400,  398,  395,  393,
-      392,  390,  389,  387,  386,  385,  384,  383,  382,  381,
-      380,  379,  378,  376,  375,  374,  372,  371,  370,  369,
-
-      367,  366,  365,  364,  362,  361,  360,  359,  358,  357,
-      356,  355,  354,  352,  350,  349,  348,  347,  346,  344,
-      343,  342,  341,  340,  339,  338,  337,  336,  334,  333,
-      332,  331,  330,  329,  328,  327,  326,  325,  324,  323,
-      321,  320,  319,  318,  315,  314,  313,  312,  311,  310,
-      309,  305,  303,  300,  299,  296,  292,  285,  283,  282,
-      281,  280,  278,  277,  276,  275,  274,  273,  272,  271,
-      270,  269,  268,  267,  266,  265,  263,  262,  261,  260,
-      259,  258,  257,  256,  255,  254,  253,  252,  251,  249,
-      248,  247,  246,  245,  244,  243,  242,  240,  239,  238,
-
-      237,  236,  235,  234,  233,  231,  230,  229,  228,  227,
-      226,  225,  224,  223,  222,  221,  220,  219,  218,  217,
-      216,  215,  214,  213,  212,  210,  209,  208,  207,  206,
-      205,  203,  200,  198,  196,  194,  191,  190,  188,  185,
-      177,  176,  175,  173,  172,  170,  169,  168,  167,  162,
-      160,  158,  157,  156,  155,  154,  152,  151,  150,  149,
-      147,  146,  145,  144,  143,  142,  141,  140,  139,  137,
-      136,  134,  132,  131,  130,  129,  127,  126,  125,  123,
-      122,  121,  120,  116,  110,  107,  106,  104,   99,   98,
-       79,   74,   68,   60,   53,   50,   49,   47,   43,   41,
-
-       39,   38,   24,   14,   11, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442, 1442,
-     1442, 1442, 1442, 1442, 1442, 1442, 1442
+      938,  939,  940,  911,  912,  942,  943,  944,  945,  946,
+      947,  943,  948,  949,  950,  951,  952,  953,  954,  955,
+      956,  957,  958,  959,  960,  961,  962,  963,  964,  965,
+      966,  967,  968,  970,  971,  972,  973,  974,  975,  976,
+      977,  978,  979,  980,  982,  983,  985,  986,  987,  944,
+      988,  989,  990,  991,  992,  993,  994,  995,  997,  998,
+
+      999, 1000, 1001, 1002, 1004, 1005, 1006, 1007, 1008, 1011,
+     1012, 1013, 1014, 1015, 1016, 1017, 1018, 1019, 1020, 1021,
+     1022, 1023,  998, 1024, 1026, 1028, 1030, 1031,  999, 1032,
+     1033, 1034, 1035, 1036, 1037, 1039, 1040, 1041, 1042, 1044,
+     1045, 1046, 1047, 1048, 1049, 1052, 1054, 1055, 1056, 1057,
+     1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+     1078, 1079, 1080, 1081, 1082, 1084, 1085, 1086, 1087, 1088,
+     1089, 1090, 1091, 1092, 1093, 1094, 1096, 1097, 1098, 1099,
+     1100, 1101, 1102, 1103, 1104, 1105, 1106, 1107, 1108, 1109,
+
+     1080, 1110, 1111, 1112, 1113, 1114, 1063, 1116, 1119, 1120,
+     1121, 1112, 1122, 1123, 1124, 1125, 1126, 1127, 1085, 1128,
+     1129, 1131, 1132, 1133, 1134, 1135, 1136, 1137, 1139, 1141,
+     1144, 1146, 1148, 1149, 1150, 1151, 1152, 1154, 1155, 1150,
+     1157, 1158, 1159, 1160, 1161, 1162, 1163, 1165, 1166, 1167,
+     1168, 1169, 1170, 1171, 1172, 1173, 1174, 1176, 1179, 1152,
+     1181, 1182, 1183, 1184, 1185, 1187, 1188, 1189, 1190, 1191,
+     1192, 1193, 1196, 1197, 1199, 1200, 1201, 1202, 1204, 1205,
+     1206, 1207, 1208, 1209, 1211, 1213, 1215, 1216, 1217, 1218,
+     1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227, 1228,
+
+     1229, 1230, 1231, 1232, 1233, 1233, 1234, 1235, 1236, 1237,
+     1238, 1239, 1240, 1215, 1241, 1242, 1243, 1244, 1245, 1246,
+     1247, 1248, 1249, 1250, 1251, 1252, 1253, 1254, 1255, 1257,
+     1258, 1260, 1261, 1262, 1264, 1263, 1267, 1268, 1271, 1272,
+     1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1284, 1285,
+     1287, 1289, 1290, 1291, 1292, 1293, 1295, 1296, 1297, 1298,
+     1299, 1300, 1234, 1263, 1301, 1302, 1303, 1304, 1305, 1306,
+     1307, 1308, 1310, 1311, 1312, 1313, 1315, 1316, 1317, 1318,
+     1319, 1320, 1322, 1323, 1324, 1326, 1328, 1329, 1330, 1331,
+     1332, 1334, 1335, 1336, 1337, 1338, 1339, 1341, 1342, 1346,
+
+     1349, 1350, 1351, 1353, 1354, 1356, 1357, 1358, 1359, 1360,
+     1361, 1363, 1365, 1366, 1367, 1368, 1369, 1370, 1371, 1372,
+     1374, 1375, 1377, 1378, 1379, 1380, 1381, 1382, 1385, 1386,
+     1387, 1388, 1389, 1391, 1392, 1393, 1394, 1395, 1396, 1397,
+     1398, 1399, 1400, 1401, 1402, 1404, 1406, 1408, 1409, 1410,
+     1411, 1412, 1414, 1415, 1416, 1418, 1419, 1421, 1422, 1425,
+     1426, 1427, 1428, 1429, 1430, 1431, 1432, 1433, 1434, 1435,
+     1436, 1437, 1438, 1439, 1440, 1441, 1442, 1443, 1444, 1445,
+     1446, 1447, 1448, 1449, 1451, 1453, 1454, 1455, 1456, 1457,
+     1458, 1462, 1463, 1464, 1465, 1467, 1468, 1470, 1471, 1472,
+
+     1473, 1474, 1476, 1477, 1480, 1480, 1480, 1480, 1480, 1481,
+     1481, 1481, 1481, 1481, 1482, 1488, 1482, 1482, 1482, 1483,
+     1489, 1483, 1490, 1483, 1484, 1484, 1484, 1484, 1484, 1485,
+     1485, 1485, 1485, 1485, 1486, 1491, 1486, 1486, 1486, 1487,
+     1487, 1487,  722,  721,  720,  719,  718,  717,  716,  715,
+      714,  713,  712,  709,  708,  705,  704,  703,  702,  701,
+      700,  699,  698,  697,  696,  695,  694,  693,  692,  691,
+      690,  689,  688,  687,  686,  685,  684,  683,  681,  680,
+      679,  678,  677,  676,  675,  674,  672,  670,  669,  668,
+      667,  666,  665,  664,  663,  662,  661,  660,  659,  658,
+
+      657,  656,  655,  653,  652,  651,  650,  649,  648,  647,
+      646,  645,  644,  643,  642,  641,  640,  639,  638,  637,
+      636,  634,  633,  629,  628,  627,  625,  624,  622,  621,
+      620,  619,  618,  617,  614,  613,  612,  611,  610,  609,
+      608,  607,  606,  605,  604,  603,  601,  600,  599,  598,
+      597,  596,  595,  594,  593,  592,  590,  589,  588,  587,
+      586,  584,  583,  582,  581,  580,  579,  578,  576,  575,
+      574,  573,  572,  571,  570,  569,  568,  566,  565,  564,
+      563,  562,  561,  560,  559,  558,  557,  556,  555,  553,
+      552,  551,  550,  549,  548,  547,  546,  545,  544,  543,
+
+      542,  541,  540,  539,  538,  537,  536,  535,  528,  526,
+      523,  522,  521,  520,  518,  517,  516,  514,  513,  510,
+      509,  508,  507,  506,  505,  504,  503,  502,  501,  500,
+      499,  498,  497,  496,  495,  494,  493,  492,  491,  490,
+      489,  488,  487,  486,  485,  484,  482,  480,  479,  478,
+      477,  476,  475,  474,  473,  472,  471,  470,  469,  468,
+      466,  465,  464,  463,  462,  461,  460,  459,  458,  457,
+      456,  455,  454,  453,  452,  451,  450,  449,  447,  446,
+      445,  444,  442,  441,  440,  439,  438,  436,  435,  433,
+      432,  430,  429,  428,  427,  426,  424,  423,  422,  421,
+
+      420,  415,  414,  412,  411,  410,  409,  408,  406,  405,
+      403,  400,  398,  397,  395,  394,  392,  391,  390,  389,
+      388,  387,  386,  385,  384,  383,  381,  380,  379,  377,
+      376,  375,  374,  372,  371,  370,  369,  368,  366,  365,
+      364,  362,  361,  360,  359,  358,  356,  354,  353,  352,
+      351,  350,  348,  347,  346,  345,  344,  343,  342,  341,
+      340,  338,  337,  336,  335,  334,  333,  332,  331,  330,
+      329,  328,  327,  325,  324,  323,  322,  319,  318,  317,
+      316,  315,  314,  313,  312,  308,  306,  303,  302,  299,
+      295,  288,  286,  285,  284,  283,  281,  280,  279,  278,
+
+      277,  276,  275,  274,  273,  272,  271,  270,  269,  268,
+      266,  265,  264,  263,  262,  261,  260,  259,  258,  257,
+      256,  255,  254,  253,  251,  250,  249,  248,  247,  246,
+      245,  244,  242,  241,  240,  239,  238,  237,  236,  235,
+      233,  232,  231,  230,  229,  228,  227,  226,  225,  224,
+      223,  222,  221,  220,  219,  218,  217,  216,  215,  214,
+      212,  211,  210,  209,  208,  207,  206,  204,  201,  199,
+      197,  195,  192,  191,  189,  186,  178,  177,  176,  174,
+      173,  171,  170,  169,  168,  161,  159,  158,  157,  156,
+      155,  153,  152,  151,  150,  148,  147,  146,  145,  144,
+
+      143,  142,  141,  140,  138,  137,  135,  133,  132,  131,
+      130,  128,  127,  126,  124,  123,  122,  121,  120,  116,
+      110,  107,  106,  104,   99,   98,   79,   74,   68,   60,
+       53,   50,   49,   47,   43,   41,   39,   38,   24,   14,
+       11, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+
+     1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479, 1479,
+     1479, 1479, 1479
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1435,27 +1458,27 @@ static char *yy_last_accepting_cpos;
 extern int parser4__flex_debug;
 int parser4__flex_debug = 1;
 
-static yyconst flex_int16_t yy_rule_linenum[173] =
+static yyconst flex_int16_t yy_rule_linenum[177] =
     {   0,
       144,  146,  148,  153,  154,  159,  160,  161,  173,  176,
-      181,  188,  197,  206,  215,  224,  233,  242,  252,  261,
-      270,  279,  288,  297,  306,  315,  324,  333,  344,  353,
-      362,  371,  380,  390,  400,  410,  420,  430,  440,  450,
-      460,  470,  480,  490,  500,  510,  520,  531,  542,  553,
-      562,  572,  581,  591,  605,  620,  629,  638,  647,  656,
-      676,  696,  705,  715,  724,  733,  742,  752,  761,  770,
-      779,  788,  797,  807,  816,  825,  834,  843,  852,  861,
-      870,  879,  888,  897,  907,  918,  930,  939,  948,  958,
-      968,  978,  988,  998, 1008, 1017, 1027, 1036, 1045, 1054,
-
-     1063, 1073, 1083, 1092, 1102, 1111, 1120, 1129, 1138, 1147,
+      181,  188,  197,  206,  215,  224,  233,  242,  251,  261,
+      270,  279,  288,  297,  306,  315,  324,  333,  342,  353,
+      362,  371,  380,  389,  399,  409,  419,  429,  439,  449,
+      459,  469,  479,  489,  499,  509,  519,  529,  540,  551,
+      562,  571,  581,  590,  600,  614,  629,  638,  647,  656,
+      665,  685,  705,  714,  724,  733,  742,  751,  761,  770,
+      779,  788,  797,  806,  816,  825,  834,  843,  852,  861,
+      870,  879,  888,  897,  906,  915,  924,  933,  943,  954,
+      966,  975,  984,  994, 1004, 1014, 1024, 1034, 1044, 1053,
+
+     1063, 1072, 1081, 1090, 1099, 1109, 1119, 1128, 1138, 1147,
      1156, 1165, 1174, 1183, 1192, 1201, 1210, 1219, 1228, 1237,
      1246, 1255, 1264, 1273, 1282, 1291, 1300, 1309, 1318, 1327,
-     1336, 1345, 1354, 1363, 1372, 1382, 1392, 1402, 1412, 1422,
-     1432, 1442, 1452, 1462, 1471, 1480, 1489, 1498, 1507, 1516,
-     1525, 1536, 1549, 1562, 1577, 1676, 1681, 1686, 1691, 1692,
-     1693, 1694, 1695, 1696, 1698, 1716, 1729, 1734, 1738, 1740,
-     1742, 1744
+     1336, 1345, 1354, 1363, 1372, 1381, 1390, 1399, 1408, 1418,
+     1428, 1438, 1448, 1458, 1468, 1478, 1488, 1498, 1507, 1516,
+     1525, 1534, 1543, 1552, 1561, 1572, 1585, 1598, 1613, 1712,
+     1717, 1722, 1727, 1728, 1729, 1730, 1731, 1732, 1734, 1752,
+     1765, 1770, 1774, 1776, 1778, 1780
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1534,7 +1557,7 @@ using namespace isc::dhcp;
    by moving it ahead by parser4_leng bytes. parser4_leng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(parser4_leng);
-#line 1538 "dhcp4_lexer.cc"
+#line 1561 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1823,7 +1846,7 @@ YY_DECL
     }
 
 
-#line 1827 "dhcp4_lexer.cc"
+#line 1850 "dhcp4_lexer.cc"
 
 	if ( !(yy_init) )
 		{
@@ -1886,13 +1909,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1443 )
+				if ( yy_current_state >= 1480 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1442 );
+		while ( yy_current_state != 1479 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1911,13 +1934,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 173 )
+			else if ( yy_act < 177 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], parser4_text );
-			else if ( yy_act == 173 )
+			else if ( yy_act == 177 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         parser4_text );
-			else if ( yy_act == 174 )
+			else if ( yy_act == 178 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -2060,6 +2083,18 @@ YY_RULE_SETUP
 case 15:
 YY_RULE_SETUP
 #line 215 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::DHCP4:
+        return  isc::dhcp::Dhcp4Parser::make_CLIENT_RATE_LIMIT(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("client-rate-limit", driver.loc_);
+    }
+}
+	YY_BREAK
+case 16:
+YY_RULE_SETUP
+#line 224 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SANITY_CHECKS:
@@ -2069,9 +2104,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 16:
+case 17:
 YY_RULE_SETUP
-#line 224 "dhcp4_lexer.ll"
+#line 233 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
@@ -2081,9 +2116,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 17:
+case 18:
 YY_RULE_SETUP
-#line 233 "dhcp4_lexer.ll"
+#line 242 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_SOCKET_TYPE:
@@ -2093,9 +2128,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 18:
+case 19:
 YY_RULE_SETUP
-#line 242 "dhcp4_lexer.ll"
+#line 251 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_SOCKET_TYPE:
@@ -2106,9 +2141,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 19:
+case 20:
 YY_RULE_SETUP
-#line 252 "dhcp4_lexer.ll"
+#line 261 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case Parser4Context::INTERFACES_CONFIG:
@@ -2118,9 +2153,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 20:
+case 21:
 YY_RULE_SETUP
-#line 261 "dhcp4_lexer.ll"
+#line 270 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case Parser4Context::OUTBOUND_INTERFACE:
@@ -2130,9 +2165,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 21:
+case 22:
 YY_RULE_SETUP
-#line 270 "dhcp4_lexer.ll"
+#line 279 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case Parser4Context::OUTBOUND_INTERFACE:
@@ -2142,9 +2177,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 22:
+case 23:
 YY_RULE_SETUP
-#line 279 "dhcp4_lexer.ll"
+#line 288 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
@@ -2154,9 +2189,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 23:
+case 24:
 YY_RULE_SETUP
-#line 288 "dhcp4_lexer.ll"
+#line 297 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
@@ -2166,9 +2201,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 24:
+case 25:
 YY_RULE_SETUP
-#line 297 "dhcp4_lexer.ll"
+#line 306 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2178,9 +2213,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 25:
+case 26:
 YY_RULE_SETUP
-#line 306 "dhcp4_lexer.ll"
+#line 315 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2190,9 +2225,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 26:
+case 27:
 YY_RULE_SETUP
-#line 315 "dhcp4_lexer.ll"
+#line 324 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2202,9 +2237,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 27:
+case 28:
 YY_RULE_SETUP
-#line 324 "dhcp4_lexer.ll"
+#line 333 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOSTS_DATABASE:
@@ -2214,9 +2249,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 28:
+case 29:
 YY_RULE_SETUP
-#line 333 "dhcp4_lexer.ll"
+#line 342 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2228,9 +2263,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 29:
+case 30:
 YY_RULE_SETUP
-#line 344 "dhcp4_lexer.ll"
+#line 353 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2240,9 +2275,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 30:
+case 31:
 YY_RULE_SETUP
-#line 353 "dhcp4_lexer.ll"
+#line 362 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2252,9 +2287,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 31:
+case 32:
 YY_RULE_SETUP
-#line 362 "dhcp4_lexer.ll"
+#line 371 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2264,9 +2299,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 32:
+case 33:
 YY_RULE_SETUP
-#line 371 "dhcp4_lexer.ll"
+#line 380 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2276,9 +2311,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 33:
+case 34:
 YY_RULE_SETUP
-#line 380 "dhcp4_lexer.ll"
+#line 389 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2289,9 +2324,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 35:
 YY_RULE_SETUP
-#line 390 "dhcp4_lexer.ll"
+#line 399 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2302,9 +2337,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 36:
 YY_RULE_SETUP
-#line 400 "dhcp4_lexer.ll"
+#line 409 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2315,9 +2350,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 37:
 YY_RULE_SETUP
-#line 410 "dhcp4_lexer.ll"
+#line 419 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2328,9 +2363,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 38:
 YY_RULE_SETUP
-#line 420 "dhcp4_lexer.ll"
+#line 429 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2341,9 +2376,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 39:
 YY_RULE_SETUP
-#line 430 "dhcp4_lexer.ll"
+#line 439 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2354,9 +2389,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 40:
 YY_RULE_SETUP
-#line 440 "dhcp4_lexer.ll"
+#line 449 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2367,9 +2402,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 41:
 YY_RULE_SETUP
-#line 450 "dhcp4_lexer.ll"
+#line 459 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2380,9 +2415,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 42:
 YY_RULE_SETUP
-#line 460 "dhcp4_lexer.ll"
+#line 469 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2393,9 +2428,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 43:
 YY_RULE_SETUP
-#line 470 "dhcp4_lexer.ll"
+#line 479 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2406,9 +2441,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 44:
 YY_RULE_SETUP
-#line 480 "dhcp4_lexer.ll"
+#line 489 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2419,9 +2454,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 45:
 YY_RULE_SETUP
-#line 490 "dhcp4_lexer.ll"
+#line 499 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2432,9 +2467,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 46:
 YY_RULE_SETUP
-#line 500 "dhcp4_lexer.ll"
+#line 509 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2445,9 +2480,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 47:
 YY_RULE_SETUP
-#line 510 "dhcp4_lexer.ll"
+#line 519 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2458,9 +2493,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 48:
 YY_RULE_SETUP
-#line 520 "dhcp4_lexer.ll"
+#line 529 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2472,9 +2507,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 49:
 YY_RULE_SETUP
-#line 531 "dhcp4_lexer.ll"
+#line 540 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2486,9 +2521,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 50:
 YY_RULE_SETUP
-#line 542 "dhcp4_lexer.ll"
+#line 551 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2500,9 +2535,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 51:
 YY_RULE_SETUP
-#line 553 "dhcp4_lexer.ll"
+#line 562 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2512,9 +2547,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 52:
 YY_RULE_SETUP
-#line 562 "dhcp4_lexer.ll"
+#line 571 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2525,9 +2560,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 53:
 YY_RULE_SETUP
-#line 572 "dhcp4_lexer.ll"
+#line 581 "dhcp4_lexer.ll"
 {
     switch (driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2537,9 +2572,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 54:
 YY_RULE_SETUP
-#line 581 "dhcp4_lexer.ll"
+#line 590 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2550,9 +2585,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 55:
 YY_RULE_SETUP
-#line 591 "dhcp4_lexer.ll"
+#line 600 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2567,9 +2602,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 56:
 YY_RULE_SETUP
-#line 605 "dhcp4_lexer.ll"
+#line 614 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2585,9 +2620,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 57:
 YY_RULE_SETUP
-#line 620 "dhcp4_lexer.ll"
+#line 629 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2597,9 +2632,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 58:
 YY_RULE_SETUP
-#line 629 "dhcp4_lexer.ll"
+#line 638 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2609,9 +2644,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 59:
 YY_RULE_SETUP
-#line 638 "dhcp4_lexer.ll"
+#line 647 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2621,9 +2656,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 60:
 YY_RULE_SETUP
-#line 647 "dhcp4_lexer.ll"
+#line 656 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2633,9 +2668,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 61:
 YY_RULE_SETUP
-#line 656 "dhcp4_lexer.ll"
+#line 665 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2656,9 +2691,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 62:
 YY_RULE_SETUP
-#line 676 "dhcp4_lexer.ll"
+#line 685 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2679,9 +2714,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 63:
 YY_RULE_SETUP
-#line 696 "dhcp4_lexer.ll"
+#line 705 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2691,9 +2726,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 64:
 YY_RULE_SETUP
-#line 705 "dhcp4_lexer.ll"
+#line 714 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2704,9 +2739,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 65:
 YY_RULE_SETUP
-#line 715 "dhcp4_lexer.ll"
+#line 724 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2716,9 +2751,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 66:
 YY_RULE_SETUP
-#line 724 "dhcp4_lexer.ll"
+#line 733 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2728,9 +2763,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 67:
 YY_RULE_SETUP
-#line 733 "dhcp4_lexer.ll"
+#line 742 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2740,9 +2775,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 68:
 YY_RULE_SETUP
-#line 742 "dhcp4_lexer.ll"
+#line 751 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2753,9 +2788,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 69:
 YY_RULE_SETUP
-#line 752 "dhcp4_lexer.ll"
+#line 761 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2765,9 +2800,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 70:
 YY_RULE_SETUP
-#line 761 "dhcp4_lexer.ll"
+#line 770 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2777,9 +2812,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 71:
 YY_RULE_SETUP
-#line 770 "dhcp4_lexer.ll"
+#line 779 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2789,9 +2824,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 72:
 YY_RULE_SETUP
-#line 779 "dhcp4_lexer.ll"
+#line 788 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2801,9 +2836,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 73:
 YY_RULE_SETUP
-#line 788 "dhcp4_lexer.ll"
+#line 797 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATION_MODE:
@@ -2813,9 +2848,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 74:
 YY_RULE_SETUP
-#line 797 "dhcp4_lexer.ll"
+#line 806 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2826,9 +2861,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 75:
 YY_RULE_SETUP
-#line 807 "dhcp4_lexer.ll"
+#line 816 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2838,9 +2873,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 76:
 YY_RULE_SETUP
-#line 816 "dhcp4_lexer.ll"
+#line 825 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -2850,9 +2885,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 77:
 YY_RULE_SETUP
-#line 825 "dhcp4_lexer.ll"
+#line 834 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -2862,9 +2897,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 78:
 YY_RULE_SETUP
-#line 834 "dhcp4_lexer.ll"
+#line 843 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2874,9 +2909,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 79:
 YY_RULE_SETUP
-#line 843 "dhcp4_lexer.ll"
+#line 852 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2886,9 +2921,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 80:
 YY_RULE_SETUP
-#line 852 "dhcp4_lexer.ll"
+#line 861 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2898,9 +2933,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 81:
 YY_RULE_SETUP
-#line 861 "dhcp4_lexer.ll"
+#line 870 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2910,9 +2945,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 82:
 YY_RULE_SETUP
-#line 870 "dhcp4_lexer.ll"
+#line 879 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2922,9 +2957,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 83:
 YY_RULE_SETUP
-#line 879 "dhcp4_lexer.ll"
+#line 888 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2934,21 +2969,57 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 84:
 YY_RULE_SETUP
-#line 888 "dhcp4_lexer.ll"
+#line 897 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
-    case isc::dhcp::Parser4Context::LOGGERS:
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 85:
+YY_RULE_SETUP
+#line 906 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 86:
+YY_RULE_SETUP
+#line 915 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp4Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+#line 924 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LOGGERS:
         return isc::dhcp::Dhcp4Parser::make_SEVERITY(driver.loc_);
     default:
         return isc::dhcp::Dhcp4Parser::make_STRING("severity", driver.loc_);
     }
 }
 	YY_BREAK
-case 84:
+case 88:
 YY_RULE_SETUP
-#line 897 "dhcp4_lexer.ll"
+#line 933 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2959,9 +3030,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 89:
 YY_RULE_SETUP
-#line 907 "dhcp4_lexer.ll"
+#line 943 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2973,9 +3044,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 90:
 YY_RULE_SETUP
-#line 918 "dhcp4_lexer.ll"
+#line 954 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2988,9 +3059,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 91:
 YY_RULE_SETUP
-#line 930 "dhcp4_lexer.ll"
+#line 966 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3000,9 +3071,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 92:
 YY_RULE_SETUP
-#line 939 "dhcp4_lexer.ll"
+#line 975 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -3012,9 +3083,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 93:
 YY_RULE_SETUP
-#line 948 "dhcp4_lexer.ll"
+#line 984 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3025,9 +3096,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 94:
 YY_RULE_SETUP
-#line 958 "dhcp4_lexer.ll"
+#line 994 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3038,9 +3109,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 95:
 YY_RULE_SETUP
-#line 968 "dhcp4_lexer.ll"
+#line 1004 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3051,9 +3122,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 96:
 YY_RULE_SETUP
-#line 978 "dhcp4_lexer.ll"
+#line 1014 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3064,9 +3135,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 97:
 YY_RULE_SETUP
-#line 988 "dhcp4_lexer.ll"
+#line 1024 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3077,9 +3148,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 98:
 YY_RULE_SETUP
-#line 998 "dhcp4_lexer.ll"
+#line 1034 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3090,9 +3161,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 99:
 YY_RULE_SETUP
-#line 1008 "dhcp4_lexer.ll"
+#line 1044 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -3102,9 +3173,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 100:
 YY_RULE_SETUP
-#line 1017 "dhcp4_lexer.ll"
+#line 1053 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3115,9 +3186,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 101:
 YY_RULE_SETUP
-#line 1027 "dhcp4_lexer.ll"
+#line 1063 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -3127,9 +3198,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 102:
 YY_RULE_SETUP
-#line 1036 "dhcp4_lexer.ll"
+#line 1072 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3139,9 +3210,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 103:
 YY_RULE_SETUP
-#line 1045 "dhcp4_lexer.ll"
+#line 1081 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3151,9 +3222,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 104:
 YY_RULE_SETUP
-#line 1054 "dhcp4_lexer.ll"
+#line 1090 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -3163,9 +3234,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 105:
 YY_RULE_SETUP
-#line 1063 "dhcp4_lexer.ll"
+#line 1099 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3176,9 +3247,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 106:
 YY_RULE_SETUP
-#line 1073 "dhcp4_lexer.ll"
+#line 1109 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3189,9 +3260,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 107:
 YY_RULE_SETUP
-#line 1083 "dhcp4_lexer.ll"
+#line 1119 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -3201,9 +3272,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 108:
 YY_RULE_SETUP
-#line 1092 "dhcp4_lexer.ll"
+#line 1128 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3213,9 +3284,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 109:
 YY_RULE_SETUP
-#line 1102 "dhcp4_lexer.ll"
+#line 1138 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3225,9 +3296,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 110:
 YY_RULE_SETUP
-#line 1111 "dhcp4_lexer.ll"
+#line 1147 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -3237,9 +3308,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 111:
 YY_RULE_SETUP
-#line 1120 "dhcp4_lexer.ll"
+#line 1156 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3249,9 +3320,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 112:
 YY_RULE_SETUP
-#line 1129 "dhcp4_lexer.ll"
+#line 1165 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3261,9 +3332,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 113:
 YY_RULE_SETUP
-#line 1138 "dhcp4_lexer.ll"
+#line 1174 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3273,9 +3344,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 114:
 YY_RULE_SETUP
-#line 1147 "dhcp4_lexer.ll"
+#line 1183 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3285,9 +3356,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 115:
 YY_RULE_SETUP
-#line 1156 "dhcp4_lexer.ll"
+#line 1192 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3297,9 +3368,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 116:
 YY_RULE_SETUP
-#line 1165 "dhcp4_lexer.ll"
+#line 1201 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3309,9 +3380,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 117:
 YY_RULE_SETUP
-#line 1174 "dhcp4_lexer.ll"
+#line 1210 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -3321,9 +3392,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 118:
 YY_RULE_SETUP
-#line 1183 "dhcp4_lexer.ll"
+#line 1219 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3333,9 +3404,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 119:
 YY_RULE_SETUP
-#line 1192 "dhcp4_lexer.ll"
+#line 1228 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3345,9 +3416,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 120:
 YY_RULE_SETUP
-#line 1201 "dhcp4_lexer.ll"
+#line 1237 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3357,9 +3428,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 121:
 YY_RULE_SETUP
-#line 1210 "dhcp4_lexer.ll"
+#line 1246 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -3369,9 +3440,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 122:
 YY_RULE_SETUP
-#line 1219 "dhcp4_lexer.ll"
+#line 1255 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3381,9 +3452,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 123:
 YY_RULE_SETUP
-#line 1228 "dhcp4_lexer.ll"
+#line 1264 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3393,9 +3464,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 124:
 YY_RULE_SETUP
-#line 1237 "dhcp4_lexer.ll"
+#line 1273 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3405,9 +3476,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 125:
 YY_RULE_SETUP
-#line 1246 "dhcp4_lexer.ll"
+#line 1282 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3417,9 +3488,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 126:
 YY_RULE_SETUP
-#line 1255 "dhcp4_lexer.ll"
+#line 1291 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3429,9 +3500,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 127:
 YY_RULE_SETUP
-#line 1264 "dhcp4_lexer.ll"
+#line 1300 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3441,9 +3512,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 128:
 YY_RULE_SETUP
-#line 1273 "dhcp4_lexer.ll"
+#line 1309 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3453,9 +3524,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 129:
 YY_RULE_SETUP
-#line 1282 "dhcp4_lexer.ll"
+#line 1318 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3465,9 +3536,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 130:
 YY_RULE_SETUP
-#line 1291 "dhcp4_lexer.ll"
+#line 1327 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3477,9 +3548,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 131:
 YY_RULE_SETUP
-#line 1300 "dhcp4_lexer.ll"
+#line 1336 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3489,9 +3560,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 132:
 YY_RULE_SETUP
-#line 1309 "dhcp4_lexer.ll"
+#line 1345 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3501,9 +3572,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 133:
 YY_RULE_SETUP
-#line 1318 "dhcp4_lexer.ll"
+#line 1354 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3513,9 +3584,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 134:
 YY_RULE_SETUP
-#line 1327 "dhcp4_lexer.ll"
+#line 1363 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3525,9 +3596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 135:
 YY_RULE_SETUP
-#line 1336 "dhcp4_lexer.ll"
+#line 1372 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3537,9 +3608,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 136:
 YY_RULE_SETUP
-#line 1345 "dhcp4_lexer.ll"
+#line 1381 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3549,9 +3620,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 137:
 YY_RULE_SETUP
-#line 1354 "dhcp4_lexer.ll"
+#line 1390 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3561,9 +3632,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 138:
 YY_RULE_SETUP
-#line 1363 "dhcp4_lexer.ll"
+#line 1399 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3573,9 +3644,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 139:
 YY_RULE_SETUP
-#line 1372 "dhcp4_lexer.ll"
+#line 1408 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3586,9 +3657,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 136:
+case 140:
 YY_RULE_SETUP
-#line 1382 "dhcp4_lexer.ll"
+#line 1418 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3599,9 +3670,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 137:
+case 141:
 YY_RULE_SETUP
-#line 1392 "dhcp4_lexer.ll"
+#line 1428 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -3612,9 +3683,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 138:
+case 142:
 YY_RULE_SETUP
-#line 1402 "dhcp4_lexer.ll"
+#line 1438 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3625,9 +3696,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 139:
+case 143:
 YY_RULE_SETUP
-#line 1412 "dhcp4_lexer.ll"
+#line 1448 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3638,9 +3709,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 140:
+case 144:
 YY_RULE_SETUP
-#line 1422 "dhcp4_lexer.ll"
+#line 1458 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3651,9 +3722,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 141:
+case 145:
 YY_RULE_SETUP
-#line 1432 "dhcp4_lexer.ll"
+#line 1468 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3664,9 +3735,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 142:
+case 146:
 YY_RULE_SETUP
-#line 1442 "dhcp4_lexer.ll"
+#line 1478 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3677,9 +3748,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 143:
+case 147:
 YY_RULE_SETUP
-#line 1452 "dhcp4_lexer.ll"
+#line 1488 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3690,9 +3761,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 144:
+case 148:
 YY_RULE_SETUP
-#line 1462 "dhcp4_lexer.ll"
+#line 1498 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3702,9 +3773,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 149:
 YY_RULE_SETUP
-#line 1471 "dhcp4_lexer.ll"
+#line 1507 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3714,9 +3785,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 150:
 YY_RULE_SETUP
-#line 1480 "dhcp4_lexer.ll"
+#line 1516 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3726,9 +3797,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 151:
 YY_RULE_SETUP
-#line 1489 "dhcp4_lexer.ll"
+#line 1525 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3738,9 +3809,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 152:
 YY_RULE_SETUP
-#line 1498 "dhcp4_lexer.ll"
+#line 1534 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3750,9 +3821,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 153:
 YY_RULE_SETUP
-#line 1507 "dhcp4_lexer.ll"
+#line 1543 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3762,9 +3833,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 154:
 YY_RULE_SETUP
-#line 1516 "dhcp4_lexer.ll"
+#line 1552 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3774,9 +3845,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 155:
 YY_RULE_SETUP
-#line 1525 "dhcp4_lexer.ll"
+#line 1561 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3788,9 +3859,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 156:
 YY_RULE_SETUP
-#line 1536 "dhcp4_lexer.ll"
+#line 1572 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3804,9 +3875,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 157:
 YY_RULE_SETUP
-#line 1549 "dhcp4_lexer.ll"
+#line 1585 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3820,9 +3891,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 158:
 YY_RULE_SETUP
-#line 1562 "dhcp4_lexer.ll"
+#line 1598 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3836,9 +3907,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 159:
 YY_RULE_SETUP
-#line 1577 "dhcp4_lexer.ll"
+#line 1613 "dhcp4_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -3938,65 +4009,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 156:
-/* rule 156 can match eol */
+case 160:
+/* rule 160 can match eol */
 YY_RULE_SETUP
-#line 1676 "dhcp4_lexer.ll"
+#line 1712 "dhcp4_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(parser4_text));
 }
 	YY_BREAK
-case 157:
-/* rule 157 can match eol */
+case 161:
+/* rule 161 can match eol */
 YY_RULE_SETUP
-#line 1681 "dhcp4_lexer.ll"
+#line 1717 "dhcp4_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(parser4_text));
 }
 	YY_BREAK
-case 158:
+case 162:
 YY_RULE_SETUP
-#line 1686 "dhcp4_lexer.ll"
+#line 1722 "dhcp4_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(parser4_text));
 }
 	YY_BREAK
-case 159:
+case 163:
 YY_RULE_SETUP
-#line 1691 "dhcp4_lexer.ll"
+#line 1727 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 160:
+case 164:
 YY_RULE_SETUP
-#line 1692 "dhcp4_lexer.ll"
+#line 1728 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 161:
+case 165:
 YY_RULE_SETUP
-#line 1693 "dhcp4_lexer.ll"
+#line 1729 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 162:
+case 166:
 YY_RULE_SETUP
-#line 1694 "dhcp4_lexer.ll"
+#line 1730 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 163:
+case 167:
 YY_RULE_SETUP
-#line 1695 "dhcp4_lexer.ll"
+#line 1731 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 164:
+case 168:
 YY_RULE_SETUP
-#line 1696 "dhcp4_lexer.ll"
+#line 1732 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 165:
+case 169:
 YY_RULE_SETUP
-#line 1698 "dhcp4_lexer.ll"
+#line 1734 "dhcp4_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(parser4_text);
@@ -4015,9 +4086,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 166:
+case 170:
 YY_RULE_SETUP
-#line 1716 "dhcp4_lexer.ll"
+#line 1752 "dhcp4_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(parser4_text);
@@ -4031,43 +4102,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 167:
+case 171:
 YY_RULE_SETUP
-#line 1729 "dhcp4_lexer.ll"
+#line 1765 "dhcp4_lexer.ll"
 {
     string tmp(parser4_text);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 168:
+case 172:
 YY_RULE_SETUP
-#line 1734 "dhcp4_lexer.ll"
+#line 1770 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 169:
+case 173:
 YY_RULE_SETUP
-#line 1738 "dhcp4_lexer.ll"
+#line 1774 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 170:
+case 174:
 YY_RULE_SETUP
-#line 1740 "dhcp4_lexer.ll"
+#line 1776 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 171:
+case 175:
 YY_RULE_SETUP
-#line 1742 "dhcp4_lexer.ll"
+#line 1778 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 172:
+case 176:
 YY_RULE_SETUP
-#line 1744 "dhcp4_lexer.ll"
+#line 1780 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(parser4_text));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1746 "dhcp4_lexer.ll"
+#line 1782 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -4091,12 +4162,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 173:
+case 177:
 YY_RULE_SETUP
-#line 1769 "dhcp4_lexer.ll"
+#line 1805 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4100 "dhcp4_lexer.cc"
+#line 4171 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4408,7 +4479,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1443 )
+			if ( yy_current_state >= 1480 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4441,11 +4512,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1443 )
+		if ( yy_current_state >= 1480 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1442);
+	yy_is_jam = (yy_current_state == 1479);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5176,7 +5247,7 @@ void parser4_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1769 "dhcp4_lexer.ll"
+#line 1805 "dhcp4_lexer.ll"
 
 
 
@@ -253,30 +253,30 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -295,30 +295,30 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -358,86 +358,86 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 162: // "constant string"
+            case 166: // "constant string"
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 366 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 373 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 380 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 387 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 181: // value
+      case 185: // value
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 394 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 185: // map_value
+      case 189: // map_value
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 401 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 223: // socket_type
+      case 227: // socket_type
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 408 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 226: // outbound_interface_value
+      case 230: // outbound_interface_value
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 415 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 248: // db_type
+      case 254: // db_type
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 422 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 332: // hr_mode
+      case 338: // hr_mode
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 429 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 480: // ncr_protocol_value
+      case 486: // ncr_protocol_value
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 436 "dhcp4_parser.cc" // lalr1.cc:636
         break;
 
-      case 488: // replace_client_name_value
+      case 494: // replace_client_name_value
 
-#line 241 "dhcp4_parser.yy" // lalr1.cc:636
+#line 246 "dhcp4_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 443 "dhcp4_parser.cc" // lalr1.cc:636
         break;
@@ -639,30 +639,30 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -684,127 +684,127 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 250 "dhcp4_parser.yy" // lalr1.cc:859
+#line 255 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 690 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 251 "dhcp4_parser.yy" // lalr1.cc:859
+#line 256 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 696 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 252 "dhcp4_parser.yy" // lalr1.cc:859
+#line 257 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP4; }
 #line 702 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 253 "dhcp4_parser.yy" // lalr1.cc:859
+#line 258 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 708 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 254 "dhcp4_parser.yy" // lalr1.cc:859
+#line 259 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET4; }
 #line 714 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 255 "dhcp4_parser.yy" // lalr1.cc:859
+#line 260 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 720 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 256 "dhcp4_parser.yy" // lalr1.cc:859
+#line 261 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 726 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 257 "dhcp4_parser.yy" // lalr1.cc:859
+#line 262 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP4; }
 #line 732 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 258 "dhcp4_parser.yy" // lalr1.cc:859
+#line 263 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 738 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 259 "dhcp4_parser.yy" // lalr1.cc:859
+#line 264 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 744 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 260 "dhcp4_parser.yy" // lalr1.cc:859
+#line 265 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 750 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 261 "dhcp4_parser.yy" // lalr1.cc:859
+#line 266 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 756 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 262 "dhcp4_parser.yy" // lalr1.cc:859
+#line 267 "dhcp4_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.LOGGING; }
 #line 762 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 270 "dhcp4_parser.yy" // lalr1.cc:859
+#line 275 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 768 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 29:
-#line 271 "dhcp4_parser.yy" // lalr1.cc:859
+#line 276 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 774 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 272 "dhcp4_parser.yy" // lalr1.cc:859
+#line 277 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 780 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 31:
-#line 273 "dhcp4_parser.yy" // lalr1.cc:859
+#line 278 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 786 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 274 "dhcp4_parser.yy" // lalr1.cc:859
+#line 279 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 792 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 275 "dhcp4_parser.yy" // lalr1.cc:859
+#line 280 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 798 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 34:
-#line 276 "dhcp4_parser.yy" // lalr1.cc:859
+#line 281 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 804 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 35:
-#line 279 "dhcp4_parser.yy" // lalr1.cc:859
+#line 284 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -813,7 +813,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 36:
-#line 284 "dhcp4_parser.yy" // lalr1.cc:859
+#line 289 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -824,7 +824,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 37:
-#line 289 "dhcp4_parser.yy" // lalr1.cc:859
+#line 294 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -834,13 +834,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 295 "dhcp4_parser.yy" // lalr1.cc:859
+#line 300 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 840 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
   case 41:
-#line 302 "dhcp4_parser.yy" // lalr1.cc:859
+#line 307 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -849,7 +849,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 306 "dhcp4_parser.yy" // lalr1.cc:859
+#line 311 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -859,7 +859,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 43:
-#line 313 "dhcp4_parser.yy" // lalr1.cc:859
+#line 318 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -868,7 +868,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 316 "dhcp4_parser.yy" // lalr1.cc:859
+#line 321 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -876,7 +876,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 324 "dhcp4_parser.yy" // lalr1.cc:859
+#line 329 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -885,7 +885,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 328 "dhcp4_parser.yy" // lalr1.cc:859
+#line 333 "dhcp4_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -894,7 +894,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 335 "dhcp4_parser.yy" // lalr1.cc:859
+#line 340 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -902,7 +902,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 337 "dhcp4_parser.yy" // lalr1.cc:859
+#line 342 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -911,7 +911,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 346 "dhcp4_parser.yy" // lalr1.cc:859
+#line 351 "dhcp4_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -920,7 +920,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 350 "dhcp4_parser.yy" // lalr1.cc:859
+#line 355 "dhcp4_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -929,7 +929,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 361 "dhcp4_parser.yy" // lalr1.cc:859
+#line 366 "dhcp4_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -940,7 +940,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 371 "dhcp4_parser.yy" // lalr1.cc:859
+#line 376 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -951,7 +951,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 376 "dhcp4_parser.yy" // lalr1.cc:859
+#line 381 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -964,7 +964,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 66:
-#line 400 "dhcp4_parser.yy" // lalr1.cc:859
+#line 405 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -977,7 +977,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 67:
-#line 407 "dhcp4_parser.yy" // lalr1.cc:859
+#line 412 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -987,7 +987,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 68:
-#line 415 "dhcp4_parser.yy" // lalr1.cc:859
+#line 420 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp4 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -997,7 +997,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 69:
-#line 419 "dhcp4_parser.yy" // lalr1.cc:859
+#line 424 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     // parsing completed
@@ -1005,8 +1005,8 @@ namespace isc { namespace dhcp {
 #line 1006 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 101:
-#line 461 "dhcp4_parser.yy" // lalr1.cc:859
+  case 102:
+#line 467 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1014,8 +1014,8 @@ namespace isc { namespace dhcp {
 #line 1015 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 102:
-#line 466 "dhcp4_parser.yy" // lalr1.cc:859
+  case 103:
+#line 472 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1023,8 +1023,8 @@ namespace isc { namespace dhcp {
 #line 1024 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 103:
-#line 471 "dhcp4_parser.yy" // lalr1.cc:859
+  case 104:
+#line 477 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1032,8 +1032,8 @@ namespace isc { namespace dhcp {
 #line 1033 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 104:
-#line 476 "dhcp4_parser.yy" // lalr1.cc:859
+  case 105:
+#line 482 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1041,8 +1041,8 @@ namespace isc { namespace dhcp {
 #line 1042 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 105:
-#line 481 "dhcp4_parser.yy" // lalr1.cc:859
+  case 106:
+#line 487 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr echo(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("echo-client-id", echo);
@@ -1050,8 +1050,8 @@ namespace isc { namespace dhcp {
 #line 1051 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 106:
-#line 486 "dhcp4_parser.yy" // lalr1.cc:859
+  case 107:
+#line 492 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr match(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("match-client-id", match);
@@ -1059,8 +1059,8 @@ namespace isc { namespace dhcp {
 #line 1060 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 107:
-#line 492 "dhcp4_parser.yy" // lalr1.cc:859
+  case 108:
+#line 498 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1070,8 +1070,8 @@ namespace isc { namespace dhcp {
 #line 1071 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 108:
-#line 497 "dhcp4_parser.yy" // lalr1.cc:859
+  case 109:
+#line 503 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
@@ -1080,8 +1080,8 @@ namespace isc { namespace dhcp {
 #line 1081 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 118:
-#line 516 "dhcp4_parser.yy" // lalr1.cc:859
+  case 119:
+#line 522 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1090,8 +1090,8 @@ namespace isc { namespace dhcp {
 #line 1091 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 119:
-#line 520 "dhcp4_parser.yy" // lalr1.cc:859
+  case 120:
+#line 526 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     // parsing completed
@@ -1099,8 +1099,8 @@ namespace isc { namespace dhcp {
 #line 1100 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 120:
-#line 525 "dhcp4_parser.yy" // lalr1.cc:859
+  case 121:
+#line 531 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1110,8 +1110,8 @@ namespace isc { namespace dhcp {
 #line 1111 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 121:
-#line 530 "dhcp4_parser.yy" // lalr1.cc:859
+  case 122:
+#line 536 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1119,16 +1119,16 @@ namespace isc { namespace dhcp {
 #line 1120 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 122:
-#line 535 "dhcp4_parser.yy" // lalr1.cc:859
+  case 123:
+#line 541 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DHCP_SOCKET_TYPE);
 }
 #line 1128 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 123:
-#line 537 "dhcp4_parser.yy" // lalr1.cc:859
+  case 124:
+#line 543 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("dhcp-socket-type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1136,28 +1136,28 @@ namespace isc { namespace dhcp {
 #line 1137 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 124:
-#line 542 "dhcp4_parser.yy" // lalr1.cc:859
+  case 125:
+#line 548 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("raw", ctx.loc2pos(yystack_[0].location))); }
 #line 1143 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 125:
-#line 543 "dhcp4_parser.yy" // lalr1.cc:859
+  case 126:
+#line 549 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("udp", ctx.loc2pos(yystack_[0].location))); }
 #line 1149 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 126:
-#line 546 "dhcp4_parser.yy" // lalr1.cc:859
+  case 127:
+#line 552 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.OUTBOUND_INTERFACE);
 }
 #line 1157 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 127:
-#line 548 "dhcp4_parser.yy" // lalr1.cc:859
+  case 128:
+#line 554 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("outbound-interface", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1165,24 +1165,24 @@ namespace isc { namespace dhcp {
 #line 1166 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 128:
-#line 553 "dhcp4_parser.yy" // lalr1.cc:859
+  case 129:
+#line 559 "dhcp4_parser.yy" // lalr1.cc:859
     {
     yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("same-as-inbound", ctx.loc2pos(yystack_[0].location)));
 }
 #line 1174 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 129:
-#line 555 "dhcp4_parser.yy" // lalr1.cc:859
+  case 130:
+#line 561 "dhcp4_parser.yy" // lalr1.cc:859
     {
     yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("use-routing", ctx.loc2pos(yystack_[0].location)));
     }
 #line 1182 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 130:
-#line 559 "dhcp4_parser.yy" // lalr1.cc:859
+  case 131:
+#line 565 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
@@ -1190,8 +1190,8 @@ namespace isc { namespace dhcp {
 #line 1191 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 131:
-#line 565 "dhcp4_parser.yy" // lalr1.cc:859
+  case 132:
+#line 571 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1201,8 +1201,8 @@ namespace isc { namespace dhcp {
 #line 1202 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 132:
-#line 570 "dhcp4_parser.yy" // lalr1.cc:859
+  case 133:
+#line 576 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1212,8 +1212,8 @@ namespace isc { namespace dhcp {
 #line 1213 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 133:
-#line 577 "dhcp4_parser.yy" // lalr1.cc:859
+  case 134:
+#line 583 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
@@ -1223,8 +1223,8 @@ namespace isc { namespace dhcp {
 #line 1224 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 134:
-#line 582 "dhcp4_parser.yy" // lalr1.cc:859
+  case 135:
+#line 588 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1232,16 +1232,16 @@ namespace isc { namespace dhcp {
 #line 1233 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 138:
-#line 592 "dhcp4_parser.yy" // lalr1.cc:859
+  case 139:
+#line 598 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1241 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 139:
-#line 594 "dhcp4_parser.yy" // lalr1.cc:859
+  case 140:
+#line 600 "dhcp4_parser.yy" // lalr1.cc:859
     {
 
     if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
@@ -1260,574 +1260,591 @@ namespace isc { namespace dhcp {
 #line 1261 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 610 "dhcp4_parser.yy" // lalr1.cc:859
+  case 141:
+#line 617 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 1269 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 142:
+#line 619 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.stack_.back()->set("client-rate-limit", yystack_[0].value.as< ElementPtr > ());
+    ctx.leave();
+}
+#line 1278 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 143:
+#line 624 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
     ctx.stack_.push_back(i);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1272 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1289 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 615 "dhcp4_parser.yy" // lalr1.cc:859
+  case 144:
+#line 629 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1283 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1300 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 622 "dhcp4_parser.yy" // lalr1.cc:859
+  case 145:
+#line 636 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOSTS_DATABASE);
 }
-#line 1294 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1311 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 627 "dhcp4_parser.yy" // lalr1.cc:859
+  case 146:
+#line 641 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1303 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1320 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 148:
-#line 640 "dhcp4_parser.yy" // lalr1.cc:859
+  case 151:
+#line 654 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1313 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1330 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 149:
-#line 644 "dhcp4_parser.yy" // lalr1.cc:859
+  case 152:
+#line 658 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1323 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1340 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 170:
-#line 674 "dhcp4_parser.yy" // lalr1.cc:859
+  case 173:
+#line 688 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
-#line 1331 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1348 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 171:
-#line 676 "dhcp4_parser.yy" // lalr1.cc:859
+  case 174:
+#line 690 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1340 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1357 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 172:
-#line 681 "dhcp4_parser.yy" // lalr1.cc:859
+  case 175:
+#line 695 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
-#line 1346 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1363 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 173:
-#line 682 "dhcp4_parser.yy" // lalr1.cc:859
+  case 176:
+#line 696 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
-#line 1352 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1369 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 174:
-#line 683 "dhcp4_parser.yy" // lalr1.cc:859
+  case 177:
+#line 697 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
-#line 1358 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1375 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 175:
-#line 684 "dhcp4_parser.yy" // lalr1.cc:859
+  case 178:
+#line 698 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
-#line 1364 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1381 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 176:
-#line 687 "dhcp4_parser.yy" // lalr1.cc:859
+  case 179:
+#line 701 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1372 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1389 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 177:
-#line 689 "dhcp4_parser.yy" // lalr1.cc:859
+  case 180:
+#line 703 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
     ctx.leave();
 }
-#line 1382 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1399 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 178:
-#line 695 "dhcp4_parser.yy" // lalr1.cc:859
+  case 181:
+#line 709 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1390 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1407 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 179:
-#line 697 "dhcp4_parser.yy" // lalr1.cc:859
+  case 182:
+#line 711 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
     ctx.leave();
 }
-#line 1400 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1417 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 180:
-#line 703 "dhcp4_parser.yy" // lalr1.cc:859
+  case 183:
+#line 717 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1408 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1425 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 181:
-#line 705 "dhcp4_parser.yy" // lalr1.cc:859
+  case 184:
+#line 719 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
     ctx.leave();
 }
-#line 1418 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1435 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 182:
-#line 711 "dhcp4_parser.yy" // lalr1.cc:859
+  case 185:
+#line 725 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
 }
-#line 1427 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1444 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 183:
-#line 716 "dhcp4_parser.yy" // lalr1.cc:859
+  case 186:
+#line 730 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1435 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1452 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 184:
-#line 718 "dhcp4_parser.yy" // lalr1.cc:859
+  case 187:
+#line 732 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
     ctx.leave();
 }
-#line 1445 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1462 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 185:
-#line 724 "dhcp4_parser.yy" // lalr1.cc:859
+  case 188:
+#line 738 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
 }
-#line 1454 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1471 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 186:
-#line 729 "dhcp4_parser.yy" // lalr1.cc:859
+  case 189:
+#line 743 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
 }
-#line 1463 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1480 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 187:
-#line 734 "dhcp4_parser.yy" // lalr1.cc:859
+  case 190:
+#line 748 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
 }
-#line 1472 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1489 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 188:
-#line 739 "dhcp4_parser.yy" // lalr1.cc:859
+  case 191:
+#line 753 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
 }
-#line 1481 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1498 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 189:
-#line 744 "dhcp4_parser.yy" // lalr1.cc:859
+  case 192:
+#line 758 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
 }
-#line 1490 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1507 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 190:
-#line 749 "dhcp4_parser.yy" // lalr1.cc:859
+  case 193:
+#line 763 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
 }
-#line 1499 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1516 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 191:
-#line 754 "dhcp4_parser.yy" // lalr1.cc:859
+  case 194:
+#line 768 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
 }
-#line 1508 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1525 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 192:
-#line 759 "dhcp4_parser.yy" // lalr1.cc:859
+  case 195:
+#line 773 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1516 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1533 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 193:
-#line 761 "dhcp4_parser.yy" // lalr1.cc:859
+  case 196:
+#line 775 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1526 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1543 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 194:
-#line 767 "dhcp4_parser.yy" // lalr1.cc:859
+  case 197:
+#line 781 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1534 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1551 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 195:
-#line 769 "dhcp4_parser.yy" // lalr1.cc:859
+  case 198:
+#line 783 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1544 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1561 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 196:
-#line 775 "dhcp4_parser.yy" // lalr1.cc:859
+  case 199:
+#line 789 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
 }
-#line 1553 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1570 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 197:
-#line 780 "dhcp4_parser.yy" // lalr1.cc:859
+  case 200:
+#line 794 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
 }
-#line 1562 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1579 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 198:
-#line 785 "dhcp4_parser.yy" // lalr1.cc:859
+  case 201:
+#line 799 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1573 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1590 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 199:
-#line 790 "dhcp4_parser.yy" // lalr1.cc:859
+  case 202:
+#line 804 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1582 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1599 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 207:
-#line 806 "dhcp4_parser.yy" // lalr1.cc:859
+  case 210:
+#line 820 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1591 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1608 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 208:
-#line 811 "dhcp4_parser.yy" // lalr1.cc:859
+  case 211:
+#line 825 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1600 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1617 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 209:
-#line 816 "dhcp4_parser.yy" // lalr1.cc:859
+  case 212:
+#line 830 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr circuit(new StringElement("circuit-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(circuit);
 }
-#line 1609 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1626 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 210:
-#line 821 "dhcp4_parser.yy" // lalr1.cc:859
+  case 213:
+#line 835 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr client(new StringElement("client-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(client);
 }
-#line 1618 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1635 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 211:
-#line 826 "dhcp4_parser.yy" // lalr1.cc:859
+  case 214:
+#line 840 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
 }
-#line 1627 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1644 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 212:
-#line 831 "dhcp4_parser.yy" // lalr1.cc:859
+  case 215:
+#line 845 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1638 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1655 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 213:
-#line 836 "dhcp4_parser.yy" // lalr1.cc:859
+  case 216:
+#line 850 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1647 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1664 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 218:
-#line 849 "dhcp4_parser.yy" // lalr1.cc:859
+  case 221:
+#line 863 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1657 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1674 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 219:
-#line 853 "dhcp4_parser.yy" // lalr1.cc:859
+  case 222:
+#line 867 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1667 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1684 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 220:
-#line 859 "dhcp4_parser.yy" // lalr1.cc:859
+  case 223:
+#line 873 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1677 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1694 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 221:
-#line 863 "dhcp4_parser.yy" // lalr1.cc:859
+  case 224:
+#line 877 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1687 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1704 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 227:
-#line 878 "dhcp4_parser.yy" // lalr1.cc:859
+  case 230:
+#line 892 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1695 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1712 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 228:
-#line 880 "dhcp4_parser.yy" // lalr1.cc:859
+  case 231:
+#line 894 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1705 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1722 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 229:
-#line 886 "dhcp4_parser.yy" // lalr1.cc:859
+  case 232:
+#line 900 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1713 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1730 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 230:
-#line 888 "dhcp4_parser.yy" // lalr1.cc:859
+  case 233:
+#line 902 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1722 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1739 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 231:
-#line 894 "dhcp4_parser.yy" // lalr1.cc:859
+  case 234:
+#line 908 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1733 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1750 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 232:
-#line 899 "dhcp4_parser.yy" // lalr1.cc:859
+  case 235:
+#line 913 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1743 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1760 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 241:
-#line 917 "dhcp4_parser.yy" // lalr1.cc:859
+  case 244:
+#line 931 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1752 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1769 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 242:
-#line 922 "dhcp4_parser.yy" // lalr1.cc:859
+  case 245:
+#line 936 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1761 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1778 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 243:
-#line 927 "dhcp4_parser.yy" // lalr1.cc:859
+  case 246:
+#line 941 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1770 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1787 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 244:
-#line 932 "dhcp4_parser.yy" // lalr1.cc:859
+  case 247:
+#line 946 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1779 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1796 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 245:
-#line 937 "dhcp4_parser.yy" // lalr1.cc:859
+  case 248:
+#line 951 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1788 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1805 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 246:
-#line 942 "dhcp4_parser.yy" // lalr1.cc:859
+  case 249:
+#line 956 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1797 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1814 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 247:
-#line 950 "dhcp4_parser.yy" // lalr1.cc:859
+  case 250:
+#line 964 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet4", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET4);
 }
-#line 1808 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1825 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 248:
-#line 955 "dhcp4_parser.yy" // lalr1.cc:859
+  case 251:
+#line 969 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1817 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1834 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 253:
-#line 975 "dhcp4_parser.yy" // lalr1.cc:859
+  case 256:
+#line 989 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1827 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1844 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 254:
-#line 979 "dhcp4_parser.yy" // lalr1.cc:859
+  case 257:
+#line 993 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -1849,321 +1866,321 @@ namespace isc { namespace dhcp {
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 1853 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1870 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 255:
-#line 1001 "dhcp4_parser.yy" // lalr1.cc:859
+  case 258:
+#line 1015 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet4 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1863 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1880 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 256:
-#line 1005 "dhcp4_parser.yy" // lalr1.cc:859
+  case 259:
+#line 1019 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The subnet subnet4 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 1873 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1890 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 284:
-#line 1044 "dhcp4_parser.yy" // lalr1.cc:859
+  case 287:
+#line 1058 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1881 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1898 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 285:
-#line 1046 "dhcp4_parser.yy" // lalr1.cc:859
+  case 288:
+#line 1060 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1891 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1908 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 286:
-#line 1052 "dhcp4_parser.yy" // lalr1.cc:859
+  case 289:
+#line 1066 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1899 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1916 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 287:
-#line 1054 "dhcp4_parser.yy" // lalr1.cc:859
+  case 290:
+#line 1068 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface", iface);
     ctx.leave();
 }
-#line 1909 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1926 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 288:
-#line 1060 "dhcp4_parser.yy" // lalr1.cc:859
+  case 291:
+#line 1074 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1917 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1934 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 289:
-#line 1062 "dhcp4_parser.yy" // lalr1.cc:859
+  case 292:
+#line 1076 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-interface-id", iface);
     ctx.leave();
 }
-#line 1927 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1944 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 290:
-#line 1068 "dhcp4_parser.yy" // lalr1.cc:859
+  case 293:
+#line 1082 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1935 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1952 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 291:
-#line 1070 "dhcp4_parser.yy" // lalr1.cc:859
+  case 294:
+#line 1084 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("4o6-subnet", iface);
     ctx.leave();
 }
-#line 1945 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1962 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 292:
-#line 1076 "dhcp4_parser.yy" // lalr1.cc:859
+  case 295:
+#line 1090 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1953 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1970 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 293:
-#line 1078 "dhcp4_parser.yy" // lalr1.cc:859
+  case 296:
+#line 1092 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1963 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1980 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 294:
-#line 1084 "dhcp4_parser.yy" // lalr1.cc:859
+  case 297:
+#line 1098 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1971 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1988 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 295:
-#line 1086 "dhcp4_parser.yy" // lalr1.cc:859
+  case 298:
+#line 1100 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1981 "dhcp4_parser.cc" // lalr1.cc:859
+#line 1998 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 296:
-#line 1092 "dhcp4_parser.yy" // lalr1.cc:859
+  case 299:
+#line 1106 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1989 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2006 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 297:
-#line 1094 "dhcp4_parser.yy" // lalr1.cc:859
+  case 300:
+#line 1108 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1999 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2016 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 298:
-#line 1100 "dhcp4_parser.yy" // lalr1.cc:859
+  case 301:
+#line 1114 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2010 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2027 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 299:
-#line 1105 "dhcp4_parser.yy" // lalr1.cc:859
+  case 302:
+#line 1119 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2019 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2036 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 300:
-#line 1110 "dhcp4_parser.yy" // lalr1.cc:859
+  case 303:
+#line 1124 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
-#line 2027 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2044 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 301:
-#line 1112 "dhcp4_parser.yy" // lalr1.cc:859
+  case 304:
+#line 1126 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2036 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2053 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 302:
-#line 1117 "dhcp4_parser.yy" // lalr1.cc:859
+  case 305:
+#line 1131 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
-#line 2042 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2059 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 303:
-#line 1118 "dhcp4_parser.yy" // lalr1.cc:859
+  case 306:
+#line 1132 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
-#line 2048 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2065 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 304:
-#line 1119 "dhcp4_parser.yy" // lalr1.cc:859
+  case 307:
+#line 1133 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("global", ctx.loc2pos(yystack_[0].location))); }
-#line 2054 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2071 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 305:
-#line 1120 "dhcp4_parser.yy" // lalr1.cc:859
+  case 308:
+#line 1134 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
-#line 2060 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2077 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 306:
-#line 1123 "dhcp4_parser.yy" // lalr1.cc:859
+  case 309:
+#line 1137 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 2069 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2086 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 307:
-#line 1128 "dhcp4_parser.yy" // lalr1.cc:859
+  case 310:
+#line 1142 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 2078 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2095 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 308:
-#line 1135 "dhcp4_parser.yy" // lalr1.cc:859
+  case 311:
+#line 1149 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SHARED_NETWORK);
 }
-#line 2089 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2106 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 309:
-#line 1140 "dhcp4_parser.yy" // lalr1.cc:859
+  case 312:
+#line 1154 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2098 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2115 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 314:
-#line 1155 "dhcp4_parser.yy" // lalr1.cc:859
+  case 317:
+#line 1169 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2108 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2125 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 315:
-#line 1159 "dhcp4_parser.yy" // lalr1.cc:859
+  case 318:
+#line 1173 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2116 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2133 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 336:
-#line 1191 "dhcp4_parser.yy" // lalr1.cc:859
+  case 339:
+#line 1205 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 2127 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2144 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 337:
-#line 1196 "dhcp4_parser.yy" // lalr1.cc:859
+  case 340:
+#line 1210 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2136 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2153 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 338:
-#line 1204 "dhcp4_parser.yy" // lalr1.cc:859
+  case 341:
+#line 1218 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2145 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2162 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 339:
-#line 1207 "dhcp4_parser.yy" // lalr1.cc:859
+  case 342:
+#line 1221 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2153 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2170 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 344:
-#line 1223 "dhcp4_parser.yy" // lalr1.cc:859
+  case 347:
+#line 1237 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2163 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2180 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 345:
-#line 1227 "dhcp4_parser.yy" // lalr1.cc:859
+  case 348:
+#line 1241 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2171,21 +2188,21 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2175 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2192 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 346:
-#line 1238 "dhcp4_parser.yy" // lalr1.cc:859
+  case 349:
+#line 1252 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2185 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2202 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 347:
-#line 1242 "dhcp4_parser.yy" // lalr1.cc:859
+  case 350:
+#line 1256 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2193,281 +2210,281 @@ namespace isc { namespace dhcp {
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2197 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2214 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 363:
-#line 1274 "dhcp4_parser.yy" // lalr1.cc:859
+  case 366:
+#line 1288 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 2206 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2223 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 365:
-#line 1281 "dhcp4_parser.yy" // lalr1.cc:859
+  case 368:
+#line 1295 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2214 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2231 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 366:
-#line 1283 "dhcp4_parser.yy" // lalr1.cc:859
+  case 369:
+#line 1297 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 2224 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2241 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 367:
-#line 1289 "dhcp4_parser.yy" // lalr1.cc:859
+  case 370:
+#line 1303 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2232 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2249 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 368:
-#line 1291 "dhcp4_parser.yy" // lalr1.cc:859
+  case 371:
+#line 1305 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 2242 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2259 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 369:
-#line 1297 "dhcp4_parser.yy" // lalr1.cc:859
+  case 372:
+#line 1311 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2250 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2267 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 370:
-#line 1299 "dhcp4_parser.yy" // lalr1.cc:859
+  case 373:
+#line 1313 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 2260 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2277 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 372:
-#line 1307 "dhcp4_parser.yy" // lalr1.cc:859
+  case 375:
+#line 1321 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2268 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2285 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 373:
-#line 1309 "dhcp4_parser.yy" // lalr1.cc:859
+  case 376:
+#line 1323 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 2278 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2295 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 374:
-#line 1315 "dhcp4_parser.yy" // lalr1.cc:859
+  case 377:
+#line 1329 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 2287 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2304 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 375:
-#line 1324 "dhcp4_parser.yy" // lalr1.cc:859
+  case 378:
+#line 1338 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 2298 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2315 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 376:
-#line 1329 "dhcp4_parser.yy" // lalr1.cc:859
+  case 379:
+#line 1343 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2307 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2324 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 381:
-#line 1348 "dhcp4_parser.yy" // lalr1.cc:859
+  case 384:
+#line 1362 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2317 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2334 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 382:
-#line 1352 "dhcp4_parser.yy" // lalr1.cc:859
+  case 385:
+#line 1366 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
 }
-#line 2326 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2343 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 383:
-#line 1360 "dhcp4_parser.yy" // lalr1.cc:859
+  case 386:
+#line 1374 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2336 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2353 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 384:
-#line 1364 "dhcp4_parser.yy" // lalr1.cc:859
+  case 387:
+#line 1378 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
 }
-#line 2345 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2362 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 399:
-#line 1397 "dhcp4_parser.yy" // lalr1.cc:859
+  case 402:
+#line 1411 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2353 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2370 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 400:
-#line 1399 "dhcp4_parser.yy" // lalr1.cc:859
+  case 403:
+#line 1413 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 2363 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2380 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 403:
-#line 1409 "dhcp4_parser.yy" // lalr1.cc:859
+  case 406:
+#line 1423 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 2372 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2389 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 404:
-#line 1414 "dhcp4_parser.yy" // lalr1.cc:859
+  case 407:
+#line 1428 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
 }
-#line 2381 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2398 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 405:
-#line 1422 "dhcp4_parser.yy" // lalr1.cc:859
+  case 408:
+#line 1436 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 2392 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2409 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 406:
-#line 1427 "dhcp4_parser.yy" // lalr1.cc:859
+  case 409:
+#line 1441 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2401 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2418 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 411:
-#line 1442 "dhcp4_parser.yy" // lalr1.cc:859
+  case 414:
+#line 1456 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2411 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2428 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 412:
-#line 1446 "dhcp4_parser.yy" // lalr1.cc:859
+  case 415:
+#line 1460 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2421 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2438 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 413:
-#line 1452 "dhcp4_parser.yy" // lalr1.cc:859
+  case 416:
+#line 1466 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2431 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2448 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 414:
-#line 1456 "dhcp4_parser.yy" // lalr1.cc:859
+  case 417:
+#line 1470 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 2441 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2458 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 424:
-#line 1475 "dhcp4_parser.yy" // lalr1.cc:859
+  case 427:
+#line 1489 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2449 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2466 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 425:
-#line 1477 "dhcp4_parser.yy" // lalr1.cc:859
+  case 428:
+#line 1491 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2459 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2476 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 426:
-#line 1483 "dhcp4_parser.yy" // lalr1.cc:859
+  case 429:
+#line 1497 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2467 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2484 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 427:
-#line 1485 "dhcp4_parser.yy" // lalr1.cc:859
+  case 430:
+#line 1499 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
@@ -2490,19 +2507,19 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2494 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2511 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 428:
-#line 1508 "dhcp4_parser.yy" // lalr1.cc:859
+  case 431:
+#line 1522 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2502 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2519 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 429:
-#line 1510 "dhcp4_parser.yy" // lalr1.cc:859
+  case 432:
+#line 1524 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2527,996 +2544,1032 @@ namespace isc { namespace dhcp {
     parent->set("user-context", user_context);
     ctx.leave();
 }
-#line 2531 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2548 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 430:
-#line 1538 "dhcp4_parser.yy" // lalr1.cc:859
+  case 433:
+#line 1552 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2542 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2559 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 431:
-#line 1543 "dhcp4_parser.yy" // lalr1.cc:859
+  case 434:
+#line 1557 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2551 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2568 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 436:
-#line 1556 "dhcp4_parser.yy" // lalr1.cc:859
+  case 439:
+#line 1570 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2561 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2578 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 437:
-#line 1560 "dhcp4_parser.yy" // lalr1.cc:859
+  case 440:
+#line 1574 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
 }
-#line 2570 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2587 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 438:
-#line 1565 "dhcp4_parser.yy" // lalr1.cc:859
+  case 441:
+#line 1579 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2580 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2597 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 439:
-#line 1569 "dhcp4_parser.yy" // lalr1.cc:859
+  case 442:
+#line 1583 "dhcp4_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
 }
-#line 2589 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2606 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 459:
-#line 1600 "dhcp4_parser.yy" // lalr1.cc:859
+  case 462:
+#line 1614 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2597 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2614 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 460:
-#line 1602 "dhcp4_parser.yy" // lalr1.cc:859
+  case 463:
+#line 1616 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr next_server(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("next-server", next_server);
     ctx.leave();
 }
-#line 2607 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2624 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 461:
-#line 1608 "dhcp4_parser.yy" // lalr1.cc:859
+  case 464:
+#line 1622 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2615 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2632 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 462:
-#line 1610 "dhcp4_parser.yy" // lalr1.cc:859
+  case 465:
+#line 1624 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr srv(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-hostname", srv);
     ctx.leave();
 }
-#line 2625 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2642 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 463:
-#line 1616 "dhcp4_parser.yy" // lalr1.cc:859
+  case 466:
+#line 1630 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2633 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2650 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 464:
-#line 1618 "dhcp4_parser.yy" // lalr1.cc:859
+  case 467:
+#line 1632 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr bootfile(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("boot-file-name", bootfile);
     ctx.leave();
 }
-#line 2643 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2660 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 465:
-#line 1624 "dhcp4_parser.yy" // lalr1.cc:859
+  case 468:
+#line 1638 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2651 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2668 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 466:
-#line 1626 "dhcp4_parser.yy" // lalr1.cc:859
+  case 469:
+#line 1640 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
     ctx.leave();
 }
-#line 2661 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2678 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 467:
-#line 1632 "dhcp4_parser.yy" // lalr1.cc:859
+  case 470:
+#line 1646 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2672 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2689 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 468:
-#line 1637 "dhcp4_parser.yy" // lalr1.cc:859
+  case 471:
+#line 1651 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2681 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2698 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 469:
-#line 1642 "dhcp4_parser.yy" // lalr1.cc:859
+  case 472:
+#line 1656 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2689 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2706 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 470:
-#line 1644 "dhcp4_parser.yy" // lalr1.cc:859
+  case 473:
+#line 1658 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2699 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2716 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 471:
-#line 1650 "dhcp4_parser.yy" // lalr1.cc:859
+  case 474:
+#line 1664 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2707 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2724 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 472:
-#line 1652 "dhcp4_parser.yy" // lalr1.cc:859
+  case 475:
+#line 1666 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2717 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2734 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 473:
-#line 1658 "dhcp4_parser.yy" // lalr1.cc:859
+  case 476:
+#line 1672 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2725 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2742 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 474:
-#line 1660 "dhcp4_parser.yy" // lalr1.cc:859
+  case 477:
+#line 1674 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-id", hw);
     ctx.leave();
 }
-#line 2735 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2752 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 475:
-#line 1666 "dhcp4_parser.yy" // lalr1.cc:859
+  case 478:
+#line 1680 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2743 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2760 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 476:
-#line 1668 "dhcp4_parser.yy" // lalr1.cc:859
+  case 479:
+#line 1682 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("circuit-id", hw);
     ctx.leave();
 }
-#line 2753 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2770 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 477:
-#line 1674 "dhcp4_parser.yy" // lalr1.cc:859
+  case 480:
+#line 1688 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2761 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2778 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 478:
-#line 1676 "dhcp4_parser.yy" // lalr1.cc:859
+  case 481:
+#line 1690 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
     ctx.leave();
 }
-#line 2771 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2788 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 479:
-#line 1682 "dhcp4_parser.yy" // lalr1.cc:859
+  case 482:
+#line 1696 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2779 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2796 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 480:
-#line 1684 "dhcp4_parser.yy" // lalr1.cc:859
+  case 483:
+#line 1698 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2789 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2806 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 481:
-#line 1690 "dhcp4_parser.yy" // lalr1.cc:859
+  case 484:
+#line 1704 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2800 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2817 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 482:
-#line 1695 "dhcp4_parser.yy" // lalr1.cc:859
+  case 485:
+#line 1709 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2809 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2826 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 483:
-#line 1703 "dhcp4_parser.yy" // lalr1.cc:859
+  case 486:
+#line 1717 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2820 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2837 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 484:
-#line 1708 "dhcp4_parser.yy" // lalr1.cc:859
+  case 487:
+#line 1722 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2829 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2846 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 487:
-#line 1720 "dhcp4_parser.yy" // lalr1.cc:859
+  case 490:
+#line 1734 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2840 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2857 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 488:
-#line 1725 "dhcp4_parser.yy" // lalr1.cc:859
+  case 491:
+#line 1739 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2849 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2866 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 491:
-#line 1734 "dhcp4_parser.yy" // lalr1.cc:859
+  case 494:
+#line 1748 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2859 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2876 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 492:
-#line 1738 "dhcp4_parser.yy" // lalr1.cc:859
+  case 495:
+#line 1752 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
 }
-#line 2869 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2886 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 509:
-#line 1767 "dhcp4_parser.yy" // lalr1.cc:859
+  case 512:
+#line 1781 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2877 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2894 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 510:
-#line 1769 "dhcp4_parser.yy" // lalr1.cc:859
+  case 513:
+#line 1783 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2887 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2904 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 511:
-#line 1775 "dhcp4_parser.yy" // lalr1.cc:859
+  case 514:
+#line 1789 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
 }
-#line 2896 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2913 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 512:
-#line 1784 "dhcp4_parser.yy" // lalr1.cc:859
+  case 515:
+#line 1798 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2905 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2922 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 513:
-#line 1791 "dhcp4_parser.yy" // lalr1.cc:859
+  case 516:
+#line 1805 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2916 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2933 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 514:
-#line 1796 "dhcp4_parser.yy" // lalr1.cc:859
+  case 517:
+#line 1810 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2925 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2942 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 522:
-#line 1812 "dhcp4_parser.yy" // lalr1.cc:859
+  case 525:
+#line 1826 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2933 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2950 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 523:
-#line 1814 "dhcp4_parser.yy" // lalr1.cc:859
+  case 526:
+#line 1828 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2943 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2960 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 524:
-#line 1820 "dhcp4_parser.yy" // lalr1.cc:859
+  case 527:
+#line 1834 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2951 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2968 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 525:
-#line 1822 "dhcp4_parser.yy" // lalr1.cc:859
+  case 528:
+#line 1836 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2961 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2978 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 526:
-#line 1830 "dhcp4_parser.yy" // lalr1.cc:859
+  case 529:
+#line 1844 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2972 "dhcp4_parser.cc" // lalr1.cc:859
+#line 2989 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 527:
-#line 1835 "dhcp4_parser.yy" // lalr1.cc:859
+  case 530:
+#line 1849 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2983 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3000 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 528:
-#line 1842 "dhcp4_parser.yy" // lalr1.cc:859
+  case 531:
+#line 1856 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2993 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3010 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 529:
-#line 1846 "dhcp4_parser.yy" // lalr1.cc:859
+  case 532:
+#line 1860 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
     // parsing completed
 }
-#line 3003 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3020 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 551:
-#line 1877 "dhcp4_parser.yy" // lalr1.cc:859
+  case 554:
+#line 1891 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 3012 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3029 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 552:
-#line 1882 "dhcp4_parser.yy" // lalr1.cc:859
+  case 555:
+#line 1896 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3020 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3037 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 553:
-#line 1884 "dhcp4_parser.yy" // lalr1.cc:859
+  case 556:
+#line 1898 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 3030 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3047 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 554:
-#line 1890 "dhcp4_parser.yy" // lalr1.cc:859
+  case 557:
+#line 1904 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3038 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3055 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 555:
-#line 1892 "dhcp4_parser.yy" // lalr1.cc:859
+  case 558:
+#line 1906 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 3048 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3065 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 556:
-#line 1898 "dhcp4_parser.yy" // lalr1.cc:859
+  case 559:
+#line 1912 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 3057 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3074 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 557:
-#line 1903 "dhcp4_parser.yy" // lalr1.cc:859
+  case 560:
+#line 1917 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3065 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3082 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 558:
-#line 1905 "dhcp4_parser.yy" // lalr1.cc:859
+  case 561:
+#line 1919 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 3075 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3092 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 559:
-#line 1911 "dhcp4_parser.yy" // lalr1.cc:859
+  case 562:
+#line 1925 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 3084 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3101 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 560:
-#line 1916 "dhcp4_parser.yy" // lalr1.cc:859
+  case 563:
+#line 1930 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 3093 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3110 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 561:
-#line 1921 "dhcp4_parser.yy" // lalr1.cc:859
+  case 564:
+#line 1935 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 3101 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3118 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 562:
-#line 1923 "dhcp4_parser.yy" // lalr1.cc:859
+  case 565:
+#line 1937 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3110 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3127 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 563:
-#line 1929 "dhcp4_parser.yy" // lalr1.cc:859
+  case 566:
+#line 1943 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 3116 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3133 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 564:
-#line 1930 "dhcp4_parser.yy" // lalr1.cc:859
+  case 567:
+#line 1944 "dhcp4_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 3122 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3139 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 565:
-#line 1933 "dhcp4_parser.yy" // lalr1.cc:859
+  case 568:
+#line 1947 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 3130 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3147 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 566:
-#line 1935 "dhcp4_parser.yy" // lalr1.cc:859
+  case 569:
+#line 1949 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 3140 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3157 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 567:
-#line 1941 "dhcp4_parser.yy" // lalr1.cc:859
+  case 570:
+#line 1955 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 3149 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3166 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 568:
-#line 1946 "dhcp4_parser.yy" // lalr1.cc:859
+  case 571:
+#line 1960 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 3158 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3175 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 569:
-#line 1951 "dhcp4_parser.yy" // lalr1.cc:859
+  case 572:
+#line 1965 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 3167 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3184 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 570:
-#line 1956 "dhcp4_parser.yy" // lalr1.cc:859
+  case 573:
+#line 1970 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 3175 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3192 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 571:
-#line 1958 "dhcp4_parser.yy" // lalr1.cc:859
+  case 574:
+#line 1972 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3184 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3201 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 572:
-#line 1964 "dhcp4_parser.yy" // lalr1.cc:859
+  case 575:
+#line 1978 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 3192 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3209 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 573:
-#line 1967 "dhcp4_parser.yy" // lalr1.cc:859
+  case 576:
+#line 1981 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3200 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3217 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 574:
-#line 1970 "dhcp4_parser.yy" // lalr1.cc:859
+  case 577:
+#line 1984 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3208 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3225 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 575:
-#line 1973 "dhcp4_parser.yy" // lalr1.cc:859
+  case 578:
+#line 1987 "dhcp4_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 3216 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3233 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 576:
-#line 1976 "dhcp4_parser.yy" // lalr1.cc:859
+  case 579:
+#line 1990 "dhcp4_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 3225 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3242 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 577:
-#line 1982 "dhcp4_parser.yy" // lalr1.cc:859
+  case 580:
+#line 1996 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3233 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3250 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 578:
-#line 1984 "dhcp4_parser.yy" // lalr1.cc:859
+  case 581:
+#line 1998 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 3243 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3260 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 579:
-#line 1990 "dhcp4_parser.yy" // lalr1.cc:859
+  case 582:
+#line 2004 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3251 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3268 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 580:
-#line 1992 "dhcp4_parser.yy" // lalr1.cc:859
+  case 583:
+#line 2006 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
     ctx.leave();
 }
-#line 3261 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3278 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 581:
-#line 1998 "dhcp4_parser.yy" // lalr1.cc:859
+  case 584:
+#line 2012 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3269 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3286 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 582:
-#line 2000 "dhcp4_parser.yy" // lalr1.cc:859
+  case 585:
+#line 2014 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
     ctx.leave();
 }
-#line 3279 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3296 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 583:
-#line 2009 "dhcp4_parser.yy" // lalr1.cc:859
+  case 586:
+#line 2023 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3287 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3304 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 584:
-#line 2011 "dhcp4_parser.yy" // lalr1.cc:859
+  case 587:
+#line 2025 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp6", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3296 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3313 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 585:
-#line 2016 "dhcp4_parser.yy" // lalr1.cc:859
+  case 588:
+#line 2030 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3304 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3321 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 586:
-#line 2018 "dhcp4_parser.yy" // lalr1.cc:859
+  case 589:
+#line 2032 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3313 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3330 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 587:
-#line 2023 "dhcp4_parser.yy" // lalr1.cc:859
+  case 590:
+#line 2037 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3321 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3338 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 588:
-#line 2025 "dhcp4_parser.yy" // lalr1.cc:859
+  case 591:
+#line 2039 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 3330 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3347 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 589:
-#line 2035 "dhcp4_parser.yy" // lalr1.cc:859
+  case 592:
+#line 2049 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 3341 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3358 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 590:
-#line 2040 "dhcp4_parser.yy" // lalr1.cc:859
+  case 593:
+#line 2054 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3350 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3367 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 591:
-#line 2045 "dhcp4_parser.yy" // lalr1.cc:859
+  case 594:
+#line 2059 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 3360 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3377 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 592:
-#line 2049 "dhcp4_parser.yy" // lalr1.cc:859
+  case 595:
+#line 2063 "dhcp4_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 3368 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3385 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 596:
-#line 2065 "dhcp4_parser.yy" // lalr1.cc:859
+  case 599:
+#line 2079 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 3379 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3396 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 597:
-#line 2070 "dhcp4_parser.yy" // lalr1.cc:859
+  case 600:
+#line 2084 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3388 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3405 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 600:
-#line 2082 "dhcp4_parser.yy" // lalr1.cc:859
+  case 603:
+#line 2096 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 3398 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3415 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 601:
-#line 2086 "dhcp4_parser.yy" // lalr1.cc:859
+  case 604:
+#line 2100 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3406 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3423 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 611:
-#line 2103 "dhcp4_parser.yy" // lalr1.cc:859
+  case 614:
+#line 2117 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 3415 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3432 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 612:
-#line 2108 "dhcp4_parser.yy" // lalr1.cc:859
+  case 615:
+#line 2122 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3423 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3440 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 613:
-#line 2110 "dhcp4_parser.yy" // lalr1.cc:859
+  case 616:
+#line 2124 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3433 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3450 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 614:
-#line 2116 "dhcp4_parser.yy" // lalr1.cc:859
+  case 617:
+#line 2130 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3444 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3461 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 615:
-#line 2121 "dhcp4_parser.yy" // lalr1.cc:859
+  case 618:
+#line 2135 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3453 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3470 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 618:
-#line 2130 "dhcp4_parser.yy" // lalr1.cc:859
+  case 621:
+#line 2144 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3463 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3480 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 619:
-#line 2134 "dhcp4_parser.yy" // lalr1.cc:859
+  case 622:
+#line 2148 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3471 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3488 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 626:
-#line 2148 "dhcp4_parser.yy" // lalr1.cc:859
+  case 632:
+#line 2165 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3479 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3496 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 627:
-#line 2150 "dhcp4_parser.yy" // lalr1.cc:859
+  case 633:
+#line 2167 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3489 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3506 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 628:
-#line 2156 "dhcp4_parser.yy" // lalr1.cc:859
+  case 634:
+#line 2173 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
 }
-#line 3498 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3515 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 629:
-#line 2161 "dhcp4_parser.yy" // lalr1.cc:859
+  case 635:
+#line 2178 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
 }
-#line 3507 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3524 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
-  case 630:
-#line 2166 "dhcp4_parser.yy" // lalr1.cc:859
+  case 636:
+#line 2183 "dhcp4_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
 }
-#line 3516 "dhcp4_parser.cc" // lalr1.cc:859
+#line 3533 "dhcp4_parser.cc" // lalr1.cc:859
     break;
 
+  case 637:
+#line 2188 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 3542 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 638:
+#line 2193 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr qs(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", qs);
+}
+#line 3551 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+  case 639:
+#line 2198 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3559 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
 
-#line 3520 "dhcp4_parser.cc" // lalr1.cc:859
+  case 640:
+#line 2200 "dhcp4_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr policy(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 3569 "dhcp4_parser.cc" // lalr1.cc:859
+    break;
+
+
+#line 3573 "dhcp4_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -3771,115 +3824,116 @@ namespace isc { namespace dhcp {
   }
 
 
-  const short int Dhcp4Parser::yypact_ninf_ = -777;
+  const short int Dhcp4Parser::yypact_ninf_ = -775;
 
   const signed char Dhcp4Parser::yytable_ninf_ = -1;
 
   const short int
   Dhcp4Parser::yypact_[] =
   {
-     274,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,    37,    27,    71,   102,   152,   156,
-     179,   188,   189,   205,   220,   221,   222,   230,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,    27,  -113,    14,    68,    70,   183,
-      39,   427,    22,   151,    84,   -63,   457,   -21,  -777,   168,
-     264,   272,   269,   279,  -777,  -777,  -777,  -777,  -777,   287,
-    -777,    38,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-     304,   308,  -777,  -777,  -777,  -777,  -777,  -777,   311,   312,
-     319,   320,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,   321,  -777,  -777,  -777,    61,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-     322,  -777,   147,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,   323,   324,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   167,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,   185,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,   284,   307,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,   328,  -777,  -777,   326,
-    -777,  -777,  -777,   334,  -777,  -777,   331,   337,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,   338,   339,  -777,  -777,  -777,  -777,   333,   345,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,   191,  -777,  -777,  -777,   346,  -777,  -777,   347,  -777,
-     348,   349,  -777,  -777,   355,   356,   359,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,   194,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,   195,  -777,  -777,  -777,    27,    27,  -777,
-     187,   360,   362,   363,   365,   366,  -777,    14,  -777,   370,
-     372,   212,   214,   376,   377,   383,   385,   389,   391,   234,
-     235,   237,   239,   401,   407,   408,   415,   417,   432,   433,
-     434,   439,   441,   442,   285,   443,   450,    68,  -777,   451,
-     452,   453,   293,    70,  -777,   455,   456,   460,   462,   463,
-     464,   466,   298,   309,   467,   468,   469,   471,   183,  -777,
-     473,    39,  -777,   474,   476,   477,   478,   480,   481,   484,
-     485,  -777,   427,  -777,   487,   488,   330,   490,   492,   493,
-     336,  -777,   151,   494,   340,   341,  -777,    84,   498,   499,
-     -41,  -777,   343,   505,   506,   350,   507,   351,   354,   520,
-     522,   367,   368,   369,   527,   532,   533,   534,   457,  -777,
-     535,   -21,  -777,  -777,  -777,   536,   537,   538,    27,    27,
-      27,  -777,   539,   540,  -777,  -777,   379,   380,   381,   541,
-     542,   545,  -777,  -777,  -777,  -777,   546,   548,   549,   552,
-     551,   397,   555,   556,   557,   558,   559,  -777,   560,   561,
-    -777,   564,   109,   121,  -777,  -777,   402,   403,   409,   565,
-     424,   425,   426,  -777,  -777,   -10,   564,   428,   584,  -777,
-     435,  -777,   564,   436,   437,   438,   440,   444,   445,   446,
-    -777,   447,   448,  -777,   449,   454,   458,  -777,  -777,   459,
-    -777,  -777,  -777,   461,    27,  -777,  -777,   465,   470,  -777,
-     472,  -777,  -777,    25,   475,  -777,  -777,  -777,   -80,   479,
-     482,   483,  -777,   589,  -777,    27,    68,   -21,  -777,  -777,
-    -777,    70,   574,  -777,  -777,  -777,   258,   258,   594,   596,
-     597,   605,   606,  -777,  -777,  -777,    73,   607,   608,   610,
-      -1,    60,   457,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,   611,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,    86,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   615,
-    -777,   197,   207,   213,  -777,   217,  -777,  -777,  -777,  -777,
-    -777,  -777,   592,   620,   621,   622,   624,  -777,  -777,   625,
-     626,   627,   629,   631,  -777,   223,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,   233,  -777,   630,   634,  -777,  -777,
-     632,   636,  -777,  -777,   637,   639,  -777,  -777,   640,   644,
-    -777,  -777,   642,   646,  -777,  -777,  -777,  -777,  -777,  -777,
-      81,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   110,  -777,
-    -777,   645,   647,  -777,  -777,   648,   649,  -777,   651,   652,
-     653,   654,   655,   656,   240,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,   241,  -777,  -777,
-    -777,   260,   491,  -777,   657,   658,  -777,  -777,  -777,  -777,
-     659,  -777,   244,  -777,  -777,  -777,  -777,   660,   574,  -777,
-     661,   662,   664,   665,   508,   497,   509,   510,   511,   666,
-     669,   513,   514,   515,   516,   517,   258,  -777,  -777,   258,
-    -777,   594,   183,  -777,   596,   151,  -777,   597,    84,  -777,
-     605,   390,  -777,   606,    73,  -777,    42,   607,  -777,   427,
-    -777,   608,   -63,  -777,   610,   518,   521,   523,   524,   525,
-     526,    -1,  -777,   676,   679,    60,  -777,  -777,  -777,   684,
-     682,    39,  -777,   611,   687,  -777,   192,   615,  -777,   530,
-    -777,   288,   531,   543,   544,  -777,  -777,  -777,  -777,  -777,
-     547,   550,  -777,  -777,  -777,  -777,  -777,  -777,   263,  -777,
-     267,  -777,   686,  -777,   688,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,   271,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   691,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   689,
-     695,  -777,  -777,  -777,  -777,  -777,   692,  -777,   275,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,   553,   554,  -777,
-    -777,   562,   281,  -777,   564,  -777,   697,  -777,  -777,  -777,
-    -777,  -777,   282,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,   390,  -777,   698,   563,  -777,    42,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,   699,   567,   700,   192,
-    -777,  -777,   569,  -777,  -777,   635,  -777,   571,  -777,  -777,
-     701,  -777,  -777,   248,  -777,    -9,   701,  -777,  -777,   703,
-     706,   707,   306,  -777,  -777,  -777,  -777,  -777,  -777,   709,
-     583,   576,   587,    -9,  -777,   572,  -777,  -777,  -777,  -777,
-    -777
+     321,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,    49,    24,    65,    67,    84,   101,
+     109,   111,   152,   166,   167,   196,   224,   226,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,    24,  -101,     3,    60,    83,   161,
+     156,   182,   107,   137,   280,   -49,   336,    42,  -775,   238,
+     244,   253,   246,   266,  -775,  -775,  -775,  -775,  -775,   269,
+    -775,    95,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,   278,   282,  -775,  -775,  -775,  -775,  -775,  -775,   288,
+     300,   301,   304,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,   307,  -775,  -775,  -775,    97,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,   309,  -775,   124,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,   311,
+     314,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+     128,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,   132,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,   262,   281,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,   286,  -775,
+    -775,   315,  -775,  -775,  -775,   317,  -775,  -775,   316,   322,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,   329,   332,  -775,  -775,  -775,  -775,   331,
+     334,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,   134,  -775,  -775,  -775,   347,  -775,  -775,
+     351,  -775,   352,   362,  -775,  -775,   365,   368,   369,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,   136,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,   140,  -775,  -775,  -775,    24,
+      24,  -775,   197,   371,   378,   379,   382,   384,  -775,     3,
+    -775,   385,   388,   391,   171,   231,   402,   403,   407,   410,
+     411,   412,   198,   251,   257,   274,   438,   439,   440,   441,
+     443,   444,   445,   447,   483,   484,   485,   323,   487,   488,
+      60,  -775,   489,   491,   492,   328,    83,  -775,   497,   505,
+     506,   508,   509,   510,   511,   349,   348,   514,   518,   519,
+     520,   161,  -775,   521,   156,  -775,   522,   523,   524,   525,
+     526,   530,   531,   532,  -775,   182,  -775,   533,   534,   372,
+     536,   537,   538,   374,  -775,   137,   540,   376,   377,  -775,
+     280,   543,   544,   -55,  -775,   380,   546,   547,   387,   552,
+     390,   392,   554,   556,   393,   394,   395,   557,   561,   562,
+     563,   336,  -775,   564,    42,  -775,  -775,  -775,   565,   386,
+     566,    24,    24,    24,  -775,   567,   568,   569,  -775,  -775,
+     404,   405,   406,   570,   571,   574,  -775,  -775,  -775,  -775,
+     575,   576,   577,   578,   569,   418,   580,   581,   582,   583,
+     584,  -775,   585,   586,  -775,   589,   114,   205,  -775,  -775,
+     423,   424,   429,   591,   431,   432,   433,  -775,  -775,   247,
+     589,   434,   594,  -775,   436,  -775,   589,   437,   442,   446,
+     448,   449,   450,   451,  -775,   452,   453,  -775,   454,   455,
+     456,  -775,  -775,   457,  -775,  -775,  -775,   458,    24,  -775,
+    -775,   459,   460,  -775,   461,  -775,  -775,     8,   473,  -775,
+    -775,  -775,    -9,   462,   463,   464,  -775,   600,  -775,    24,
+      60,    42,  -775,  -775,  -775,    83,   588,  -775,  -775,  -775,
+    -775,  -775,   389,   389,   599,   603,   604,   606,   624,  -775,
+    -775,   -16,   625,   626,   627,   361,   151,   336,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,   628,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+      50,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,   629,  -775,   144,   155,   159,  -775,
+     162,  -775,  -775,  -775,  -775,  -775,  -775,   633,   634,   635,
+     636,   637,  -775,  -775,   638,   639,   640,   641,   642,  -775,
+     174,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,   186,
+    -775,   601,   644,  -775,  -775,   643,   645,  -775,  -775,   646,
+     647,  -775,  -775,   648,   650,  -775,  -775,   649,   653,  -775,
+    -775,  -775,  -775,  -775,  -775,    35,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,    58,  -775,  -775,   651,   655,  -775,  -775,
+     654,   656,  -775,   657,   658,   659,   660,   661,   662,   212,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,   242,  -775,  -775,  -775,   250,   501,  -775,   663,
+     665,  -775,  -775,  -775,  -775,   664,  -775,    98,  -775,  -775,
+    -775,  -775,   666,   588,  -775,   667,   669,   670,   671,   512,
+     482,   513,   507,   515,   673,   674,   516,   517,   527,   528,
+     529,   389,  -775,  -775,   389,  -775,   599,   161,  -775,   603,
+     137,  -775,   604,   280,  -775,   606,   236,  -775,   624,   -16,
+    -775,    33,   625,  -775,   182,  -775,   626,   -49,  -775,   627,
+     535,   539,   541,   542,   545,   548,   361,  -775,   677,   681,
+     151,  -775,  -775,  -775,   680,   684,   156,  -775,   628,   685,
+    -775,    36,   629,  -775,   550,  -775,   345,   551,   553,   555,
+    -775,  -775,  -775,  -775,  -775,   558,   559,  -775,  -775,  -775,
+    -775,  -775,  -775,   263,  -775,   264,  -775,   682,  -775,   683,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,   277,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,   688,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,   689,   690,  -775,  -775,  -775,  -775,
+    -775,   691,  -775,   287,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,   560,   572,  -775,  -775,   573,   290,  -775,   589,
+    -775,   692,  -775,  -775,  -775,  -775,  -775,   298,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,   236,  -775,
+     696,   549,  -775,    33,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,   697,   592,   699,    36,  -775,  -775,   595,  -775,  -775,
+     700,  -775,   602,  -775,  -775,   703,  -775,  -775,   177,  -775,
+     359,   703,  -775,  -775,   707,   709,   710,   716,   718,  -775,
+     299,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+     719,   605,   612,   618,   619,   631,   723,   359,  -775,   607,
+    -775,  -775,  -775,  -775,  -775,   668,  -775,  -775,  -775
   };
 
   const unsigned short int
@@ -3889,568 +3943,571 @@ namespace isc { namespace dhcp {
       20,    22,    24,    26,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     1,    43,
       36,    32,    31,    28,    29,    30,    35,     3,    33,    34,
-      56,     5,    68,     7,   118,     9,   255,    11,   413,    13,
-     438,    15,   338,    17,   346,    19,   383,    21,   220,    23,
-     528,    25,   591,    27,    45,    39,     0,     0,     0,     0,
-       0,   440,     0,   348,   385,     0,     0,     0,    47,     0,
-      46,     0,     0,    40,    66,   589,   583,   585,   587,     0,
-      65,     0,    58,    60,    62,    63,    64,    61,   107,   133,
-       0,     0,   459,   461,   463,   131,   140,   142,     0,     0,
-       0,     0,   247,   336,   375,   308,   426,   428,   198,   487,
-     430,   212,   231,     0,   513,   526,   100,     0,    70,    72,
-      73,    74,    75,    91,    92,    78,    79,    98,    80,    81,
-      82,    86,    87,    76,    77,    84,    85,    96,    97,    99,
-      93,    94,    95,    83,    88,    89,    90,   120,   122,   126,
-       0,   117,     0,   109,   111,   112,   113,   114,   115,   116,
-     286,   288,   290,   405,   284,   292,   294,     0,     0,   300,
-     298,   296,   483,   283,   259,   260,   261,   274,     0,   257,
-     264,   278,   279,   280,   265,   266,   269,   270,   272,   267,
-     268,   262,   263,   281,   282,   271,   275,   276,   277,   273,
-     424,   423,   419,   420,   418,     0,   415,   417,   421,   422,
-     481,   469,   471,   475,   473,   479,   477,   465,   458,   452,
-     456,   457,     0,   441,   442,   453,   454,   455,   449,   444,
-     450,   446,   447,   448,   451,   445,     0,   365,   183,     0,
-     369,   367,   372,     0,   361,   362,     0,   349,   350,   352,
-     364,   353,   354,   355,   371,   356,   357,   358,   359,   360,
-     399,     0,     0,   397,   398,   401,   402,     0,   386,   387,
-     389,   390,   391,   392,   393,   394,   395,   396,   227,   229,
-     224,     0,   222,   225,   226,     0,   552,   554,     0,   557,
-       0,     0,   561,   565,     0,     0,     0,   570,   577,   579,
-     581,   550,   548,   549,     0,   530,   532,   533,   534,   535,
-     536,   537,   538,   539,   540,   541,   542,   543,   544,   545,
-     546,   547,   596,     0,   593,   595,    44,     0,     0,    37,
-       0,     0,     0,     0,     0,     0,    55,     0,    57,     0,
+      56,     5,    68,     7,   119,     9,   258,    11,   416,    13,
+     441,    15,   341,    17,   349,    19,   386,    21,   223,    23,
+     531,    25,   594,    27,    45,    39,     0,     0,     0,     0,
+       0,   443,     0,   351,   388,     0,     0,     0,    47,     0,
+      46,     0,     0,    40,    66,   592,   586,   588,   590,     0,
+      65,     0,    58,    60,    62,    63,    64,    61,   108,   134,
+     141,     0,     0,   462,   464,   466,   132,   143,   145,     0,
+       0,     0,     0,   250,   339,   378,   311,   429,   431,   201,
+     490,   433,   215,   234,     0,   516,   529,   101,     0,    70,
+      72,    73,    74,    75,    91,    92,    78,    79,    98,    99,
+      80,    81,    82,    86,    87,    76,    77,    84,    85,    96,
+      97,   100,    93,    94,    95,    83,    88,    89,    90,   121,
+     123,   127,     0,   118,     0,   110,   112,   113,   114,   115,
+     116,   117,   289,   291,   293,   408,   287,   295,   297,     0,
+       0,   303,   301,   299,   486,   286,   262,   263,   264,   277,
+       0,   260,   267,   281,   282,   283,   268,   269,   272,   273,
+     275,   270,   271,   265,   266,   284,   285,   274,   278,   279,
+     280,   276,   427,   426,   422,   423,   421,     0,   418,   420,
+     424,   425,   484,   472,   474,   478,   476,   482,   480,   468,
+     461,   455,   459,   460,     0,   444,   445,   456,   457,   458,
+     452,   447,   453,   449,   450,   451,   454,   448,     0,   368,
+     186,     0,   372,   370,   375,     0,   364,   365,     0,   352,
+     353,   355,   367,   356,   357,   358,   374,   359,   360,   361,
+     362,   363,   402,     0,     0,   400,   401,   404,   405,     0,
+     389,   390,   392,   393,   394,   395,   396,   397,   398,   399,
+     230,   232,   227,     0,   225,   228,   229,     0,   555,   557,
+       0,   560,     0,     0,   564,   568,     0,     0,     0,   573,
+     580,   582,   584,   553,   551,   552,     0,   533,   535,   536,
+     537,   538,   539,   540,   541,   542,   543,   544,   545,   546,
+     547,   548,   549,   550,   599,     0,   596,   598,    44,     0,
+       0,    37,     0,     0,     0,     0,     0,     0,    55,     0,
+      57,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,    69,     0,     0,     0,     0,     0,   120,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   259,     0,     0,   417,     0,     0,     0,     0,
+       0,     0,     0,     0,   442,     0,   342,     0,     0,     0,
+       0,     0,     0,     0,   350,     0,     0,     0,     0,   387,
+       0,     0,     0,     0,   224,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    69,     0,
-       0,     0,     0,     0,   119,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   256,
-       0,     0,   414,     0,     0,     0,     0,     0,     0,     0,
-       0,   439,     0,   339,     0,     0,     0,     0,     0,     0,
-       0,   347,     0,     0,     0,     0,   384,     0,     0,     0,
-       0,   221,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,   529,
-       0,     0,   592,    48,    41,     0,     0,     0,     0,     0,
-       0,    59,     0,     0,   105,   106,     0,     0,     0,     0,
-       0,     0,   101,   102,   103,   104,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   512,     0,     0,
-      71,     0,     0,     0,   130,   110,     0,     0,     0,     0,
-       0,     0,     0,   306,   307,     0,     0,     0,     0,   258,
-       0,   416,     0,     0,     0,     0,     0,     0,     0,     0,
-     443,     0,     0,   363,     0,     0,     0,   374,   351,     0,
-     403,   404,   388,     0,     0,   223,   551,     0,     0,   556,
-       0,   559,   560,     0,     0,   567,   568,   569,     0,     0,
-       0,     0,   531,     0,   594,     0,     0,     0,   584,   586,
-     588,     0,     0,   460,   462,   464,     0,     0,   144,   249,
-     340,   377,   310,    38,   427,   429,     0,     0,   432,   214,
-       0,     0,     0,    49,   121,   124,   125,   123,   128,   129,
-     127,   287,   289,   291,   407,   285,   293,   295,   302,   303,
-     304,   305,   301,   299,   297,     0,   425,   482,   470,   472,
-     476,   474,   480,   478,   466,   366,   184,   370,   368,   373,
-     400,   228,   230,   553,   555,   558,   563,   564,   562,   566,
-     572,   573,   574,   575,   576,   571,   578,   580,   582,     0,
-      42,     0,     0,     0,   138,     0,   135,   137,   170,   176,
-     178,   180,     0,     0,     0,     0,     0,   192,   194,     0,
-       0,     0,     0,     0,   169,     0,   150,   152,   153,   154,
-     155,   156,   157,   158,   159,   160,   161,   165,   166,   167,
-     162,   168,   163,   164,     0,   148,     0,   145,   146,   253,
-       0,   250,   251,   344,     0,   341,   342,   381,     0,   378,
-     379,   314,     0,   311,   312,   207,   208,   209,   210,   211,
-       0,   200,   202,   203,   204,   205,   206,   491,     0,   489,
-     436,     0,   433,   434,   218,     0,   215,   216,     0,     0,
-       0,     0,     0,     0,     0,   233,   235,   236,   237,   238,
-     239,   240,   522,   524,   521,   519,   520,     0,   515,   517,
-     518,     0,    51,   411,     0,   408,   409,   467,   485,   486,
-       0,   600,     0,   598,    67,   590,   108,     0,     0,   134,
+       0,     0,   532,     0,     0,   595,    48,    41,     0,     0,
+       0,     0,     0,     0,    59,     0,     0,     0,   106,   107,
+       0,     0,     0,     0,     0,     0,   102,   103,   104,   105,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   132,   141,     0,
-     143,     0,     0,   248,     0,   348,   337,     0,   385,   376,
-       0,     0,   309,     0,     0,   199,   493,     0,   488,   440,
-     431,     0,     0,   213,     0,     0,     0,     0,     0,     0,
-       0,     0,   232,     0,     0,     0,   514,   527,    53,     0,
-      52,     0,   406,     0,     0,   484,     0,     0,   597,     0,
-     136,     0,     0,     0,     0,   182,   185,   186,   187,   188,
-       0,     0,   196,   197,   189,   190,   191,   151,     0,   147,
-       0,   252,     0,   343,     0,   380,   335,   332,   321,   322,
-     324,   318,   319,   320,   330,   331,   329,     0,   316,   323,
-     333,   334,   325,   326,   327,   328,   313,   201,   509,     0,
-     507,   508,   500,   501,   505,   506,   502,   503,   504,     0,
-     494,   495,   497,   498,   499,   490,     0,   435,     0,   217,
-     241,   242,   243,   244,   245,   246,   234,     0,     0,   516,
-      50,     0,     0,   410,     0,   614,     0,   612,   610,   604,
-     608,   609,     0,   602,   606,   607,   605,   599,   139,   172,
-     173,   174,   175,   171,   177,   179,   181,   193,   195,   149,
-     254,   345,   382,     0,   315,     0,     0,   492,     0,   437,
-     219,   523,   525,    54,   412,   468,     0,     0,     0,     0,
-     601,   317,     0,   511,   496,     0,   611,     0,   603,   510,
-       0,   613,   618,     0,   616,     0,     0,   615,   626,     0,
-       0,     0,     0,   620,   622,   623,   624,   625,   617,     0,
-       0,     0,     0,     0,   619,     0,   628,   629,   630,   621,
-     627
+       0,   515,     0,     0,    71,     0,     0,     0,   131,   111,
+       0,     0,     0,     0,     0,     0,     0,   309,   310,     0,
+       0,     0,     0,   261,     0,   419,     0,     0,     0,     0,
+       0,     0,     0,     0,   446,     0,     0,   366,     0,     0,
+       0,   377,   354,     0,   406,   407,   391,     0,     0,   226,
+     554,     0,     0,   559,     0,   562,   563,     0,     0,   570,
+     571,   572,     0,     0,     0,     0,   534,     0,   597,     0,
+       0,     0,   587,   589,   591,     0,     0,    38,   142,   463,
+     465,   467,     0,     0,   147,   252,   343,   380,   313,   430,
+     432,     0,     0,   435,   217,     0,     0,     0,    49,   122,
+     125,   126,   124,   129,   130,   128,   290,   292,   294,   410,
+     288,   296,   298,   305,   306,   307,   308,   304,   302,   300,
+       0,   428,   485,   473,   475,   479,   477,   483,   481,   469,
+     369,   187,   373,   371,   376,   403,   231,   233,   556,   558,
+     561,   566,   567,   565,   569,   575,   576,   577,   578,   579,
+     574,   581,   583,   585,     0,    42,     0,     0,     0,   139,
+       0,   136,   138,   173,   179,   181,   183,     0,     0,     0,
+       0,     0,   195,   197,     0,     0,     0,     0,     0,   172,
+       0,   153,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   168,   169,   170,   165,   171,   166,   167,     0,
+     151,     0,   148,   149,   256,     0,   253,   254,   347,     0,
+     344,   345,   384,     0,   381,   382,   317,     0,   314,   315,
+     210,   211,   212,   213,   214,     0,   203,   205,   206,   207,
+     208,   209,   494,     0,   492,   439,     0,   436,   437,   221,
+       0,   218,   219,     0,     0,     0,     0,     0,     0,     0,
+     236,   238,   239,   240,   241,   242,   243,   525,   527,   524,
+     522,   523,     0,   518,   520,   521,     0,    51,   414,     0,
+     411,   412,   470,   488,   489,     0,   603,     0,   601,    67,
+     593,   109,     0,     0,   135,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,   133,   144,     0,   146,     0,     0,   251,     0,
+     351,   340,     0,   388,   379,     0,     0,   312,     0,     0,
+     202,   496,     0,   491,   443,   434,     0,     0,   216,     0,
+       0,     0,     0,     0,     0,     0,     0,   235,     0,     0,
+       0,   517,   530,    53,     0,    52,     0,   409,     0,     0,
+     487,     0,     0,   600,     0,   137,     0,     0,     0,     0,
+     185,   188,   189,   190,   191,     0,     0,   199,   200,   192,
+     193,   194,   154,     0,   150,     0,   255,     0,   346,     0,
+     383,   338,   335,   324,   325,   327,   321,   322,   323,   333,
+     334,   332,     0,   319,   326,   336,   337,   328,   329,   330,
+     331,   316,   204,   512,     0,   510,   511,   503,   504,   508,
+     509,   505,   506,   507,     0,   497,   498,   500,   501,   502,
+     493,     0,   438,     0,   220,   244,   245,   246,   247,   248,
+     249,   237,     0,     0,   519,    50,     0,     0,   413,     0,
+     617,     0,   615,   613,   607,   611,   612,     0,   605,   609,
+     610,   608,   602,   140,   175,   176,   177,   178,   174,   180,
+     182,   184,   196,   198,   152,   257,   348,   385,     0,   318,
+       0,     0,   495,     0,   440,   222,   526,   528,    54,   415,
+     471,     0,     0,     0,     0,   604,   320,     0,   514,   499,
+       0,   614,     0,   606,   513,     0,   616,   621,     0,   619,
+       0,     0,   618,   632,     0,     0,     0,     0,     0,   639,
+       0,   623,   625,   626,   627,   628,   629,   630,   631,   620,
+       0,     0,     0,     0,     0,     0,     0,     0,   622,     0,
+     634,   635,   636,   637,   638,     0,   624,   633,   640
   };
 
   const short int
   Dhcp4Parser::yypgoto_[] =
   {
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,   -51,  -777,   219,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -485,  -777,  -777,  -777,
-     -66,  -777,  -777,  -777,   371,  -777,  -777,  -777,  -777,   158,
-     342,   -43,   -14,    -7,  -777,  -777,    12,  -777,  -777,   159,
-     344,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,   -47,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,   -74,  -777,  -544,   -33,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-     -44,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   -82,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   -91,  -777,
-    -777,  -777,   -87,   361,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,   -60,  -777,  -777,  -777,  -777,  -777,  -777,  -776,  -777,
-    -777,  -777,   -34,  -777,  -777,  -777,   -29,   375,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -773,  -777,  -777,  -777,
-     -64,  -777,   -11,  -777,  -770,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,   -39,  -777,  -777,  -185,   -61,  -777,  -777,
-    -777,  -777,  -777,   -23,  -777,  -777,  -777,   -19,  -777,   386,
-    -777,   -62,  -777,  -777,  -777,  -777,  -777,   -56,  -777,  -777,
-    -777,  -777,  -777,   -13,  -777,  -777,  -777,   -16,  -777,  -777,
-    -777,   -17,  -777,   374,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,   -31,  -777,  -777,  -777,   -42,
-     416,  -777,  -777,   -54,  -777,   -26,  -777,   -36,  -777,  -777,
-    -777,    -2,  -777,  -777,  -777,     7,  -777,   410,    -6,  -777,
-       5,  -777,     6,  -777,   216,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -766,  -777,  -777,  -777,  -777,  -777,    16,  -777,
-    -777,  -777,  -139,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,     0,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-     242,   378,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,
-    -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,  -777,   270,
-     382,  -777,  -777,  -777,    -8,  -777,  -777,  -141,  -777,  -777,
-    -777,  -777,  -777,  -777,  -156,  -777,  -777,  -172,  -777,  -777,
-    -777,  -777,  -777
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,   -40,  -775,  -421,  -775,   204,
+    -775,  -775,  -775,  -775,  -775,  -775,  -489,  -775,  -775,  -775,
+     -66,  -775,  -775,  -775,   355,  -775,  -775,  -775,  -775,   147,
+     350,   -44,   -41,   -39,  -775,  -775,    -7,  -775,  -775,   163,
+     343,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,   -38,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,   -64,  -775,
+    -567,   -58,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,   -22,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+     -73,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+     -77,  -775,  -775,  -775,   -46,   358,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,   -82,  -775,  -775,  -775,  -775,  -775,  -775,
+    -774,  -775,  -775,  -775,    -6,  -775,  -775,  -775,   -42,   413,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -763,  -775,
+    -775,  -775,   -20,  -775,     0,  -775,  -762,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,     5,  -775,  -775,  -153,   -61,
+    -775,  -775,  -775,  -775,  -775,    15,  -775,  -775,  -775,    20,
+    -775,   396,  -775,   -62,  -775,  -775,  -775,  -775,  -775,   -56,
+    -775,  -775,  -775,  -775,  -775,   -14,  -775,  -775,  -775,    18,
+    -775,  -775,  -775,    21,  -775,   397,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,   -13,  -775,  -775,
+    -775,   -10,   425,  -775,  -775,   -54,  -775,   -34,  -775,   -43,
+    -775,  -775,  -775,    12,  -775,  -775,  -775,    16,  -775,   416,
+      -3,  -775,    -2,  -775,     4,  -775,   222,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -761,  -775,  -775,  -775,  -775,  -775,
+      23,  -775,  -775,  -775,  -130,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,     7,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,   252,   398,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,
+    -775,   279,   399,  -775,  -775,  -775,    -4,  -775,  -775,  -133,
+    -775,  -775,  -775,  -775,  -775,  -775,  -149,  -775,  -775,  -174,
+    -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775,  -775
   };
 
   const short int
   Dhcp4Parser::yydefgoto_[] =
   {
       -1,    14,    15,    16,    17,    18,    19,    20,    21,    22,
-      23,    24,    25,    26,    27,    36,    37,    38,    65,   574,
-      82,    83,    39,    64,    79,    80,   584,   752,   829,   830,
-     664,    41,    66,    91,    92,    93,   341,    43,    67,   127,
-     128,   129,   130,   131,   132,   133,   134,   135,   349,   162,
-     163,    45,    68,   164,   379,   165,   380,   587,   166,   381,
-     590,   167,   136,   356,   137,   350,   645,   646,   647,   767,
-     138,   357,   139,   358,   686,   687,   688,   789,   665,   666,
-     667,   770,   943,   668,   771,   669,   772,   670,   773,   671,
-     672,   415,   673,   674,   675,   676,   677,   678,   679,   680,
-     779,   681,   780,   682,   683,   140,   369,   710,   711,   712,
-     713,   714,   715,   716,   141,   372,   725,   726,   727,   812,
-      59,    75,   291,   292,   293,   428,   294,   429,   142,   373,
-     734,   735,   736,   737,   738,   739,   740,   741,   143,   363,
-     690,   691,   692,   792,    47,    69,   188,   189,   190,   389,
-     191,   385,   192,   386,   193,   387,   194,   390,   195,   391,
-     196,   396,   197,   395,   198,   394,   602,   199,   200,   144,
-     366,   702,   703,   704,   801,   877,   878,   145,   364,    53,
-      72,   694,   695,   696,   795,    55,    73,   256,   257,   258,
-     259,   260,   261,   262,   414,   263,   418,   264,   417,   265,
-     266,   419,   267,   146,   365,   698,   699,   700,   798,    57,
-      74,   277,   278,   279,   280,   281,   423,   282,   283,   284,
-     285,   202,   388,   754,   755,   756,   831,    49,    70,   215,
-     216,   217,   400,   147,   367,   148,   368,   149,   371,   721,
-     722,   723,   809,    51,    71,   232,   233,   234,   150,   353,
-     151,   354,   152,   355,   238,   410,   759,   834,   239,   404,
-     240,   405,   241,   407,   242,   406,   243,   409,   244,   408,
-     245,   403,   209,   397,   760,   153,   370,   718,   719,   806,
-     899,   900,   901,   902,   903,   955,   904,   154,   155,   375,
-     747,   748,   749,   823,   750,   824,   156,   376,    61,    76,
-     314,   315,   316,   317,   433,   318,   434,   319,   320,   436,
-     321,   322,   323,   439,   628,   324,   440,   325,   326,   327,
-     328,   444,   635,   329,   445,   330,   446,   331,   447,    94,
-     343,    95,   344,    96,   345,    97,   342,    63,    77,   333,
-     334,   335,   450,   762,   763,   836,   932,   933,   934,   935,
-     968,   936,   966,   983,   984,   985,   992,   993,   994,   999,
-     995,   996,   997
+      23,    24,    25,    26,    27,    36,    37,    38,    65,   568,
+      82,    83,    39,    64,    79,    80,   589,   757,   834,   835,
+     669,    41,    66,    91,    92,    93,   343,    43,    67,   128,
+     129,   130,   131,   132,   133,   134,   135,   136,   351,   164,
+     165,    45,    68,   166,   382,   167,   383,   592,   168,   384,
+     595,   169,   137,   359,   138,   352,   650,   651,   652,   772,
+     139,   353,   140,   360,   141,   361,   691,   692,   693,   794,
+     670,   671,   672,   775,   948,   673,   776,   674,   777,   675,
+     778,   676,   677,   418,   678,   679,   680,   681,   682,   683,
+     684,   685,   784,   686,   785,   687,   688,   142,   372,   715,
+     716,   717,   718,   719,   720,   721,   143,   375,   730,   731,
+     732,   817,    59,    75,   293,   294,   295,   431,   296,   432,
+     144,   376,   739,   740,   741,   742,   743,   744,   745,   746,
+     145,   366,   695,   696,   697,   797,    47,    69,   190,   191,
+     192,   392,   193,   388,   194,   389,   195,   390,   196,   393,
+     197,   394,   198,   399,   199,   398,   200,   397,   607,   201,
+     202,   146,   369,   707,   708,   709,   806,   882,   883,   147,
+     367,    53,    72,   699,   700,   701,   800,    55,    73,   258,
+     259,   260,   261,   262,   263,   264,   417,   265,   421,   266,
+     420,   267,   268,   422,   269,   148,   368,   703,   704,   705,
+     803,    57,    74,   279,   280,   281,   282,   283,   426,   284,
+     285,   286,   287,   204,   391,   759,   760,   761,   836,    49,
+      70,   217,   218,   219,   403,   149,   370,   150,   371,   151,
+     374,   726,   727,   728,   814,    51,    71,   234,   235,   236,
+     152,   356,   153,   357,   154,   358,   240,   413,   764,   839,
+     241,   407,   242,   408,   243,   410,   244,   409,   245,   412,
+     246,   411,   247,   406,   211,   400,   765,   155,   373,   723,
+     724,   811,   904,   905,   906,   907,   908,   960,   909,   156,
+     157,   378,   752,   753,   754,   828,   755,   829,   158,   379,
+      61,    76,   316,   317,   318,   319,   436,   320,   437,   321,
+     322,   439,   323,   324,   325,   442,   633,   326,   443,   327,
+     328,   329,   330,   447,   640,   331,   448,   332,   449,   333,
+     450,    94,   345,    95,   346,    96,   347,    97,   344,    63,
+      77,   335,   336,   337,   453,   767,   768,   841,   937,   938,
+     939,   940,   973,   941,   971,   988,   989,   990,  1000,  1001,
+    1002,  1010,  1003,  1004,  1005,  1006,  1007,  1008,  1016
   };
 
   const unsigned short int
   Dhcp4Parser::yytable_[] =
   {
-      90,   126,   161,   183,   211,   228,   212,   254,   273,   290,
-     311,   246,   275,    78,   168,   203,   218,   230,   276,   268,
-     286,   603,   312,   684,    84,   872,   184,   607,   873,   255,
-     274,   876,    29,   205,    30,   885,    31,    28,   288,   289,
-     626,   347,   169,   204,   219,   231,   348,   269,   287,    81,
-     313,   630,   631,   632,   633,   185,   201,   214,   229,   213,
-     288,   289,   186,   206,   377,   235,   102,   103,   104,   378,
-     598,   599,   600,   601,   207,   208,   236,   237,    40,    98,
-     113,   187,   157,   158,   804,   634,   159,   805,    99,   160,
-     100,   101,   102,   103,   104,   105,   106,   107,   114,    89,
-     113,   114,   248,   728,   729,   730,   731,   732,   733,    42,
-     210,   116,   117,   807,   116,   117,   808,   332,   108,   109,
-     110,   111,   112,   585,   586,   180,   113,   114,   181,   888,
-     889,   988,   116,   117,   989,   990,   991,   115,   588,   589,
-     116,   117,   116,   117,   248,   270,   249,   250,   271,   272,
-     383,    85,   118,   119,   627,   384,   116,   117,   120,    44,
-      86,    87,    88,    46,   705,   706,   707,   708,   121,   709,
-     398,   122,   742,   743,   336,   399,    89,   872,   123,   124,
-     873,   247,   125,   876,   227,   757,    48,   885,   401,    32,
-      33,    34,    35,   402,   430,    50,    52,   448,   451,   431,
-     377,    89,   449,   452,    89,   764,   101,   102,   103,   104,
-     451,   248,    54,   249,   250,   765,   383,   251,   252,   253,
-     768,   766,    89,   116,   117,   769,   786,    56,    58,    60,
-      89,   787,    89,   108,   109,   110,   786,    62,   170,   171,
-     172,   788,   114,   821,   825,   858,    89,   837,   822,   826,
-     838,   986,   248,   173,   987,   116,   117,   174,   175,   176,
-     177,   178,   179,   448,   116,   117,   786,   337,   827,   180,
-     398,   949,   181,   120,   953,   950,   338,   339,   430,   954,
-     182,    90,   340,   960,   401,   969,   453,   454,   648,   964,
-     970,   346,   411,   649,   650,   651,   652,   653,   654,   655,
-     656,   657,   658,   659,   660,   661,   662,   663,   351,  1003,
-     412,   126,   352,    89,  1004,   359,   360,   161,   248,   939,
-     940,   941,   942,   361,   362,   374,   382,   392,   393,   168,
-     416,   925,   183,   926,   927,   211,   413,   212,   420,   421,
-     422,   426,   424,   425,   203,    89,   228,   218,   427,   455,
-     432,   435,   437,   438,    89,   184,   254,   169,   230,   441,
-     442,   273,   205,   443,   456,   275,   457,   458,   268,   459,
-     460,   276,   204,   286,   462,   219,   463,   464,   255,   465,
-     466,   467,   311,   274,   185,   201,   231,   468,   214,   469,
-     213,   186,   206,   470,   312,   471,   269,   472,   473,   229,
-     474,   287,   475,   207,   208,   476,   235,   558,   559,   560,
-     187,   477,   478,   101,   102,   103,   104,   236,   237,   479,
-      89,   480,   313,     1,     2,     3,     4,     5,     6,     7,
-       8,     9,    10,    11,    12,    13,   481,   482,   483,   965,
-     108,   109,   110,   484,   112,   485,   486,   488,   487,   114,
-     248,   102,   103,   104,   489,   491,   492,   493,   494,   496,
-     497,   503,   116,   117,   498,   175,   499,   500,   501,   179,
-     502,   505,   506,   507,   504,   508,   180,   510,   512,   181,
-     513,   514,   515,   622,   516,   517,   114,   182,   518,   519,
-     126,   521,   522,   523,   524,   161,   525,   526,   529,   116,
-     117,   527,   533,   534,   640,   530,   531,   168,   536,   537,
-     538,   540,   220,   539,   541,   744,   311,   542,   221,   222,
-     223,   224,   225,   226,   543,   227,   544,   745,   312,   116,
-     117,   548,   545,   546,   547,   169,   549,   550,   551,   553,
-     555,   563,   564,   565,   556,   557,   561,   562,   566,   567,
-     568,   569,    89,   570,   571,   746,   313,   572,    30,   575,
-     576,   577,   578,   579,   591,   592,   580,   581,   582,   583,
-     594,   593,   295,   296,   297,   298,   299,   300,   301,   302,
-     303,   304,   305,   306,   307,   308,   595,   596,   597,    89,
-     604,   605,   309,   310,   639,   644,   774,   606,   608,   609,
-     610,   685,   611,   689,   693,   629,   612,   613,   614,   615,
-     616,   617,   697,   701,   717,   720,   618,   724,   753,    89,
-     619,   620,   761,   621,   775,   776,   777,   623,   778,   781,
-     782,   783,   624,   784,   625,   785,   790,   791,   793,   794,
-     980,   636,   797,   796,   637,   638,   799,   800,   802,   803,
-     811,   810,   814,   828,   813,   815,   816,   817,   818,   819,
-     820,   833,   846,   832,   839,   841,   842,   835,   843,   844,
-     850,   845,   847,   851,   849,   848,   852,   853,   854,   855,
-     917,   910,   856,   918,   911,   921,   912,   913,   914,   915,
-     920,   924,   938,   944,   951,   956,   952,   957,   958,   573,
-     959,   967,   972,   975,   977,   945,   946,  1000,   982,   947,
-    1001,  1002,   948,  1005,   641,   961,   962,   859,   461,   490,
-     643,   840,   887,   909,   963,   908,   183,   495,   973,   254,
-     976,   979,   273,   981,  1010,   866,   275,   874,   203,  1007,
-     890,   268,   276,   228,   286,   892,   290,   880,  1006,   184,
-    1008,   255,   894,   857,   274,   230,   205,   871,   867,   744,
-     861,   916,   891,   860,   886,   211,   204,   212,   971,   269,
-     928,   745,   287,   509,   863,   881,   862,   218,   185,   201,
-     895,   864,   930,   231,   865,   186,   206,   868,   879,   922,
-     875,   535,   929,   893,   869,   882,   229,   207,   208,   746,
-     896,   532,   923,   235,   187,   219,   883,   884,   528,   907,
-     931,   897,   898,   870,   236,   237,   906,   511,   214,   974,
-     213,   758,   520,   905,   751,   919,   552,   642,   978,   937,
-     998,  1009,     0,   554,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      90,   127,   163,   185,   213,   230,   689,   256,   275,   292,
+     313,   248,   277,    84,   170,   205,   220,   232,   278,   270,
+     288,   608,   314,   631,    78,   186,   207,   612,   187,    29,
+     188,    30,   877,    31,   171,   206,   221,   233,   809,   271,
+     289,   810,   315,   878,   881,   890,   567,   290,   291,    28,
+     214,   257,   276,   290,   291,   203,   216,   231,   103,   104,
+     105,   812,   189,   567,   813,    81,   208,   209,   237,   238,
+     215,    98,    40,   210,    42,   239,   710,   711,   712,   713,
+      99,   714,   100,   101,   102,   103,   104,   105,   106,   107,
+     108,    44,   114,   115,   250,   159,   160,   250,   349,   161,
+     380,   842,   162,   350,   843,   381,   117,   118,    46,   117,
+     118,   109,   110,   111,   112,   113,    48,    89,    50,   114,
+     115,   893,   894,   635,   636,   637,   638,   386,   590,   591,
+     116,   401,   387,   117,   118,   404,   402,   433,   632,   451,
+     405,    85,   434,   454,   452,   119,   120,   380,   455,   229,
+     762,   121,   769,    86,    87,    88,   117,   118,   454,    52,
+     639,   122,   386,   770,   123,   773,   114,   771,   249,    89,
+     774,   124,   125,    54,    56,   126,   930,   791,   931,   932,
+     991,   334,   792,   992,   877,   102,   103,   104,   105,   791,
+      32,    33,    34,    35,   793,   878,   881,   890,   250,    89,
+     251,   252,    89,    58,   253,   254,   255,   103,   104,   105,
+     117,   118,   109,   110,   111,   826,   115,   172,   173,   174,
+     827,   115,   593,   594,   117,   118,    89,   863,   212,   117,
+     118,    60,   175,    62,   117,   118,   176,   177,   178,   179,
+     180,   181,   115,   182,   338,   830,   183,   339,   182,    89,
+     831,   183,   121,   451,   341,   117,   118,   340,   832,   184,
+     102,   103,   104,   105,   747,   748,   791,   401,   222,   342,
+     414,   954,   955,   348,   223,   224,   225,   226,   227,   228,
+     958,   229,   354,    90,   415,   959,   355,   109,   110,   111,
+     433,   113,   362,   404,   416,   965,   115,   250,   969,   456,
+     457,   974,  1017,    89,   363,   364,   975,  1018,   365,   117,
+     118,   377,   177,   385,   127,   395,   181,    89,   396,   419,
+     163,   423,    89,   182,   424,   425,   183,    89,   603,   604,
+     605,   606,   170,   427,   184,   185,   428,   430,   213,   429,
+     468,   250,   272,   251,   252,   273,   274,   205,    89,   230,
+     220,   435,   171,   117,   118,   438,   440,   186,   207,   256,
+     187,   232,   188,   458,   275,   476,   441,   206,   277,   444,
+     221,   270,   445,   446,   278,   459,   288,   944,   945,   946,
+     947,   233,   460,   461,   214,   313,   462,   203,   463,   465,
+     216,   271,   466,   560,   189,   467,   289,   314,   208,   209,
+     469,   231,    89,   257,   215,   210,   470,   471,   276,   117,
+     118,   472,   237,   238,   473,   474,   475,   315,   477,   239,
+     653,   562,   563,   564,   478,   654,   655,   656,   657,   658,
+     659,   660,   661,   662,   663,   664,   665,   666,   667,   668,
+     970,   479,   480,   481,   482,   483,    89,   484,   485,   486,
+     250,   487,   297,   298,   299,   300,   301,   302,   303,   304,
+     305,   306,   307,   308,   309,   310,   733,   734,   735,   736,
+     737,   738,   311,   312,     1,     2,     3,     4,     5,     6,
+       7,     8,     9,    10,    11,    12,    13,   488,   489,   490,
+     491,   492,   493,   495,   127,   496,   497,   498,   627,   163,
+     993,   500,    89,   994,   995,   996,   997,   998,   999,   501,
+     502,   170,   503,   504,   505,   506,   507,   508,   509,   645,
+     749,   313,   510,   511,   512,   514,   516,   517,   518,   519,
+     520,   171,   750,   314,   521,   522,   523,   525,   526,   527,
+     528,   529,   530,   531,   533,   534,   535,   537,   538,   540,
+     541,   542,   751,   315,   543,    89,   544,   545,   547,   546,
+     548,   552,   549,   550,   551,   553,   554,   555,   557,   559,
+     569,   570,   571,   561,   565,   566,    30,   572,   573,   574,
+     575,   576,   577,   578,   580,   581,   582,   583,   584,   596,
+     597,   585,   586,   587,   588,   598,   599,   600,   601,   602,
+     609,   610,   611,   613,   634,   644,   690,   795,   614,   649,
+     694,   698,   615,   702,   616,   617,   618,   619,   620,   621,
+     622,   623,   624,   625,   626,   628,   629,   630,   641,   642,
+     643,   706,   722,   725,   729,   758,   766,   779,   780,   781,
+     782,   783,   786,   787,   788,   789,   790,   796,   799,   798,
+     802,   851,   801,   805,   804,   807,   808,   815,   816,   819,
+     818,   820,   821,   822,   823,   824,   825,   833,   838,   837,
+     844,   846,   840,   847,   848,   849,   853,   855,   856,   850,
+     852,   922,   854,   857,   858,   923,   925,   926,   579,   929,
+     956,   957,   961,   963,   859,   860,   972,   962,   861,   964,
+     977,   980,   915,   982,   464,   985,   916,   646,   917,   918,
+     987,  1011,   919,  1012,  1013,   920,   943,   949,   978,   950,
+    1014,   951,  1015,  1019,   952,   953,   966,  1025,   648,   499,
+     494,   185,   864,   862,   256,   845,   892,   275,   967,   968,
+     871,   277,   914,   205,   921,   895,   270,   278,   230,   288,
+     897,   292,   885,   186,   207,   865,   187,   899,   188,   981,
+     232,   984,   872,   206,   749,   873,   271,   874,   986,   289,
+     213,   913,   886,  1027,  1020,   933,   750,   900,   257,  1021,
+     233,   276,   220,   203,   876,  1022,   879,   935,  1023,   896,
+     189,   539,   884,   866,   208,   209,   751,   898,  1024,   875,
+     231,   210,   221,   887,   888,   976,   880,   936,   901,   902,
+     889,   237,   238,   891,   513,   903,   214,   868,   239,   934,
+     867,   532,   216,   870,   869,   928,   927,   536,   912,   515,
+     911,   524,   763,   979,  1028,   910,   215,   924,   942,   756,
+     647,   983,  1009,  1026,     0,     0,     0,     0,     0,   556,
+       0,     0,     0,   558,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,   866,     0,   874,
-       0,     0,   890,     0,     0,     0,     0,   892,     0,   880,
-       0,     0,     0,   928,   894,     0,     0,     0,     0,   871,
-     867,     0,     0,     0,   891,   930,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,   929,     0,   881,     0,     0,
-       0,     0,   895,     0,     0,     0,     0,     0,     0,   868,
-     879,     0,   875,   931,     0,   893,   869,   882,     0,     0,
-       0,     0,   896,     0,     0,     0,     0,     0,   883,   884,
-       0,     0,     0,   897,   898,   870
+       0,     0,   871,     0,     0,     0,     0,   895,     0,     0,
+       0,     0,   897,     0,   885,     0,     0,     0,   933,   899,
+       0,     0,     0,     0,   872,     0,     0,   873,     0,   874,
+     935,     0,     0,     0,   886,     0,     0,     0,     0,   900,
+       0,     0,     0,     0,     0,     0,   876,     0,   879,     0,
+     936,   896,     0,     0,   884,     0,     0,     0,     0,   898,
+       0,   875,   934,     0,     0,   887,   888,     0,   880,     0,
+     901,   902,   889,     0,     0,     0,     0,   903
   };
 
   const short int
   Dhcp4Parser::yycheck_[] =
   {
-      66,    67,    68,    69,    70,    71,    70,    73,    74,    75,
-      76,    72,    74,    64,    68,    69,    70,    71,    74,    73,
-      74,   506,    76,   567,    10,   801,    69,   512,   801,    73,
-      74,   801,     5,    69,     7,   801,     9,     0,   101,   102,
-      15,     3,    68,    69,    70,    71,     8,    73,    74,   162,
-      76,   131,   132,   133,   134,    69,    69,    70,    71,    70,
-     101,   102,    69,    69,     3,    71,    24,    25,    26,     8,
-      80,    81,    82,    83,    69,    69,    71,    71,     7,    11,
-      58,    69,    12,    13,     3,   165,    16,     6,    20,    19,
-      22,    23,    24,    25,    26,    27,    28,    29,    59,   162,
-      58,    59,    60,   104,   105,   106,   107,   108,   109,     7,
-      71,    72,    73,     3,    72,    73,     6,   138,    50,    51,
-      52,    53,    54,    14,    15,    86,    58,    59,    89,    87,
-      88,   140,    72,    73,   143,   144,   145,    69,    17,    18,
-      72,    73,    72,    73,    60,    61,    62,    63,    64,    65,
-       3,   137,    84,    85,   129,     8,    72,    73,    90,     7,
-     146,   147,   148,     7,    91,    92,    93,    94,   100,    96,
-       3,   103,   112,   113,     6,     8,   162,   953,   110,   111,
-     953,    30,   114,   953,    98,    99,     7,   953,     3,   162,
-     163,   164,   165,     8,     3,     7,     7,     3,     3,     8,
-       3,   162,     8,     8,   162,     8,    23,    24,    25,    26,
-       3,    60,     7,    62,    63,     8,     3,    66,    67,    68,
-       3,     8,   162,    72,    73,     8,     3,     7,     7,     7,
-     162,     8,   162,    50,    51,    52,     3,     7,    55,    56,
-      57,     8,    59,     3,     3,   789,   162,     3,     8,     8,
-       6,     3,    60,    70,     6,    72,    73,    74,    75,    76,
-      77,    78,    79,     3,    72,    73,     3,     3,     8,    86,
-       3,     8,    89,    90,     3,     8,     4,     8,     3,     8,
-      97,   347,     3,     8,     3,     3,   337,   338,    30,     8,
-       8,     4,     8,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,     4,     3,
-       3,   377,     4,   162,     8,     4,     4,   383,    60,    31,
-      32,    33,    34,     4,     4,     4,     4,     4,     4,   383,
-       4,   139,   398,   141,   142,   401,     8,   401,     4,     8,
-       3,     8,     4,     4,   398,   162,   412,   401,     3,   162,
-       4,     4,     4,     4,   162,   398,   422,   383,   412,     4,
-       4,   427,   398,     4,     4,   427,     4,     4,   422,     4,
-       4,   427,   398,   427,     4,   401,     4,   165,   422,   165,
-       4,     4,   448,   427,   398,   398,   412,     4,   401,     4,
-     401,   398,   398,     4,   448,     4,   422,   163,   163,   412,
-     163,   427,   163,   398,   398,     4,   412,   458,   459,   460,
-     398,     4,     4,    23,    24,    25,    26,   412,   412,     4,
-     162,     4,   448,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,     4,     4,     4,   924,
-      50,    51,    52,     4,    54,     4,     4,     4,   163,    59,
-      60,    24,    25,    26,     4,     4,     4,     4,   165,     4,
-       4,   163,    72,    73,     4,    75,     4,     4,     4,    79,
-       4,     4,     4,     4,   165,     4,    86,     4,     4,    89,
-       4,     4,     4,   534,     4,     4,    59,    97,     4,     4,
-     556,     4,     4,   163,     4,   561,     4,     4,     4,    72,
-      73,   165,     4,     4,   555,   165,   165,   561,   165,     4,
-       4,     4,    85,   163,   163,   581,   582,   163,    91,    92,
-      93,    94,    95,    96,     4,    98,     4,   581,   582,    72,
-      73,     4,   165,   165,   165,   561,     4,     4,     4,     4,
-       4,   162,   162,   162,     7,     7,     7,     7,     7,     7,
-       5,     5,   162,     5,     5,   581,   582,     5,     7,   162,
-       5,     5,     5,     5,   162,   162,     7,     7,     7,     5,
-       5,   162,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   162,   162,   162,   162,
-     162,     7,   135,   136,     5,    21,     4,   162,   162,   162,
-     162,     7,   162,     7,     7,   130,   162,   162,   162,   162,
-     162,   162,     7,     7,     7,     7,   162,     7,     7,   162,
-     162,   162,     7,   162,     4,     4,     4,   162,     4,     4,
-       4,     4,   162,     4,   162,     4,     6,     3,     6,     3,
-       5,   162,     3,     6,   162,   162,     6,     3,     6,     3,
-       3,     6,     3,   162,     6,     4,     4,     4,     4,     4,
-       4,     3,   165,     6,     4,     4,     4,     8,     4,     4,
-       4,   163,   163,     4,   163,   165,   163,   163,   163,   163,
-       4,   163,   165,     4,   163,     3,   163,   163,   163,   163,
-       6,     4,   162,   162,     8,     4,     8,     8,     3,   480,
-       8,     4,     4,     4,     4,   162,   162,     4,     7,   162,
-       4,     4,   162,     4,   556,   162,   162,   791,   347,   377,
-     561,   768,   804,   814,   162,   812,   792,   383,   165,   795,
-     163,   162,   798,   162,   162,   801,   798,   801,   792,   163,
-     806,   795,   798,   809,   798,   806,   812,   801,   165,   792,
-     163,   795,   806,   786,   798,   809,   792,   801,   801,   825,
-     794,   821,   806,   792,   803,   831,   792,   831,   953,   795,
-     836,   825,   798,   398,   797,   801,   795,   831,   792,   792,
-     806,   798,   836,   809,   800,   792,   792,   801,   801,   831,
-     801,   430,   836,   806,   801,   801,   809,   792,   792,   825,
-     806,   427,   833,   809,   792,   831,   801,   801,   422,   811,
-     836,   806,   806,   801,   809,   809,   809,   401,   831,   958,
-     831,   605,   412,   807,   582,   825,   448,   557,   969,   837,
-     986,  1003,    -1,   451,    -1,    -1,    -1,    -1,    -1,    -1,
+      66,    67,    68,    69,    70,    71,   573,    73,    74,    75,
+      76,    72,    74,    10,    68,    69,    70,    71,    74,    73,
+      74,   510,    76,    15,    64,    69,    69,   516,    69,     5,
+      69,     7,   806,     9,    68,    69,    70,    71,     3,    73,
+      74,     6,    76,   806,   806,   806,   467,   102,   103,     0,
+      70,    73,    74,   102,   103,    69,    70,    71,    25,    26,
+      27,     3,    69,   484,     6,   166,    69,    69,    71,    71,
+      70,    11,     7,    69,     7,    71,    92,    93,    94,    95,
+      20,    97,    22,    23,    24,    25,    26,    27,    28,    29,
+      30,     7,    59,    60,    61,    12,    13,    61,     3,    16,
+       3,     3,    19,     8,     6,     8,    73,    74,     7,    73,
+      74,    51,    52,    53,    54,    55,     7,   166,     7,    59,
+      60,    88,    89,   132,   133,   134,   135,     3,    14,    15,
+      70,     3,     8,    73,    74,     3,     8,     3,   130,     3,
+       8,   138,     8,     3,     8,    85,    86,     3,     8,    99,
+     100,    91,     8,   150,   151,   152,    73,    74,     3,     7,
+     169,   101,     3,     8,   104,     3,    59,     8,    31,   166,
+       8,   111,   112,     7,     7,   115,   140,     3,   142,   143,
+       3,   139,     8,     6,   958,    24,    25,    26,    27,     3,
+     166,   167,   168,   169,     8,   958,   958,   958,    61,   166,
+      63,    64,   166,     7,    67,    68,    69,    25,    26,    27,
+      73,    74,    51,    52,    53,     3,    60,    56,    57,    58,
+       8,    60,    17,    18,    73,    74,   166,   794,    72,    73,
+      74,     7,    71,     7,    73,    74,    75,    76,    77,    78,
+      79,    80,    60,    87,     6,     3,    90,     3,    87,   166,
+       8,    90,    91,     3,     8,    73,    74,     4,     8,    98,
+      24,    25,    26,    27,   113,   114,     3,     3,    86,     3,
+       8,     8,     8,     4,    92,    93,    94,    95,    96,    97,
+       3,    99,     4,   349,     3,     8,     4,    51,    52,    53,
+       3,    55,     4,     3,     8,     8,    60,    61,     8,   339,
+     340,     3,     3,   166,     4,     4,     8,     8,     4,    73,
+      74,     4,    76,     4,   380,     4,    80,   166,     4,     4,
+     386,     4,   166,    87,     8,     3,    90,   166,    81,    82,
+      83,    84,   386,     4,    98,   401,     4,     3,   404,     8,
+     169,    61,    62,    63,    64,    65,    66,   401,   166,   415,
+     404,     4,   386,    73,    74,     4,     4,   401,   401,   425,
+     401,   415,   401,   166,   430,   167,     4,   401,   430,     4,
+     404,   425,     4,     4,   430,     4,   430,    32,    33,    34,
+      35,   415,     4,     4,   404,   451,     4,   401,     4,     4,
+     404,   425,     4,     7,   401,     4,   430,   451,   401,   401,
+     169,   415,   166,   425,   404,   401,     4,     4,   430,    73,
+      74,     4,   415,   415,     4,     4,     4,   451,   167,   415,
+      31,   461,   462,   463,   167,    36,    37,    38,    39,    40,
+      41,    42,    43,    44,    45,    46,    47,    48,    49,    50,
+     929,   167,     4,     4,     4,     4,   166,     4,     4,     4,
+      61,     4,   116,   117,   118,   119,   120,   121,   122,   123,
+     124,   125,   126,   127,   128,   129,   105,   106,   107,   108,
+     109,   110,   136,   137,   153,   154,   155,   156,   157,   158,
+     159,   160,   161,   162,   163,   164,   165,     4,     4,     4,
+     167,     4,     4,     4,   560,     4,     4,   169,   538,   565,
+     141,     4,   166,   144,   145,   146,   147,   148,   149,     4,
+       4,   565,     4,     4,     4,     4,   167,   169,     4,   559,
+     586,   587,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,   565,   586,   587,     4,     4,     4,     4,     4,   167,
+       4,     4,     4,   169,     4,   169,   169,     4,     4,   169,
+       4,     4,   586,   587,   167,   166,     4,   167,     4,   167,
+       4,     4,   169,   169,   169,     4,     4,     4,     4,     4,
+     166,   166,   166,     7,     7,     7,     7,     7,     7,     5,
+       5,     5,     5,     5,   166,     5,     5,     5,     5,   166,
+     166,     7,     7,     7,     5,   166,     5,   166,   166,   166,
+     166,     7,   166,   166,   131,     5,     7,     6,   166,    21,
+       7,     7,   166,     7,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   166,   166,   166,   166,
+     166,     7,     7,     7,     7,     7,     7,     4,     4,     4,
+       4,     4,     4,     4,     4,     4,     4,     3,     3,     6,
+       3,   169,     6,     3,     6,     6,     3,     6,     3,     3,
+       6,     4,     4,     4,     4,     4,     4,   166,     3,     6,
+       4,     4,     8,     4,     4,     4,   169,     4,     4,   167,
+     167,     4,   167,   167,   167,     4,     6,     3,   484,     4,
+       8,     8,     4,     3,   167,   167,     4,     8,   169,     8,
+       4,     4,   167,     4,   349,     5,   167,   560,   167,   167,
+       7,     4,   167,     4,     4,   167,   166,   166,   169,   166,
+       4,   166,     4,     4,   166,   166,   166,     4,   565,   386,
+     380,   797,   796,   791,   800,   773,   809,   803,   166,   166,
+     806,   803,   819,   797,   826,   811,   800,   803,   814,   803,
+     811,   817,   806,   797,   797,   797,   797,   811,   797,   167,
+     814,   166,   806,   797,   830,   806,   800,   806,   166,   803,
+     836,   817,   806,   166,   169,   841,   830,   811,   800,   167,
+     814,   803,   836,   797,   806,   167,   806,   841,   169,   811,
+     797,   433,   806,   799,   797,   797,   830,   811,   167,   806,
+     814,   797,   836,   806,   806,   958,   806,   841,   811,   811,
+     806,   814,   814,   808,   401,   811,   836,   802,   814,   841,
+     800,   425,   836,   805,   803,   838,   836,   430,   816,   404,
+     814,   415,   610,   963,   166,   812,   836,   830,   842,   587,
+     561,   974,   991,  1017,    -1,    -1,    -1,    -1,    -1,   451,
+      -1,    -1,    -1,   454,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,   953,    -1,   953,
-      -1,    -1,   958,    -1,    -1,    -1,    -1,   958,    -1,   953,
-      -1,    -1,    -1,   969,   958,    -1,    -1,    -1,    -1,   953,
-     953,    -1,    -1,    -1,   958,   969,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,   969,    -1,   953,    -1,    -1,
-      -1,    -1,   958,    -1,    -1,    -1,    -1,    -1,    -1,   953,
-     953,    -1,   953,   969,    -1,   958,   953,   953,    -1,    -1,
-      -1,    -1,   958,    -1,    -1,    -1,    -1,    -1,   953,   953,
-      -1,    -1,    -1,   958,   958,   953
+      -1,    -1,   958,    -1,    -1,    -1,    -1,   963,    -1,    -1,
+      -1,    -1,   963,    -1,   958,    -1,    -1,    -1,   974,   963,
+      -1,    -1,    -1,    -1,   958,    -1,    -1,   958,    -1,   958,
+     974,    -1,    -1,    -1,   958,    -1,    -1,    -1,    -1,   963,
+      -1,    -1,    -1,    -1,    -1,    -1,   958,    -1,   958,    -1,
+     974,   963,    -1,    -1,   958,    -1,    -1,    -1,    -1,   963,
+      -1,   958,   974,    -1,    -1,   958,   958,    -1,   958,    -1,
+     963,   963,   958,    -1,    -1,    -1,    -1,   963
   };
 
   const unsigned short int
   Dhcp4Parser::yystos_[] =
   {
-       0,   149,   150,   151,   152,   153,   154,   155,   156,   157,
-     158,   159,   160,   161,   167,   168,   169,   170,   171,   172,
-     173,   174,   175,   176,   177,   178,   179,   180,     0,     5,
-       7,     9,   162,   163,   164,   165,   181,   182,   183,   188,
-       7,   197,     7,   203,     7,   217,     7,   310,     7,   393,
-       7,   409,     7,   345,     7,   351,     7,   375,     7,   286,
-       7,   464,     7,   503,   189,   184,   198,   204,   218,   311,
-     394,   410,   346,   352,   376,   287,   465,   504,   181,   190,
-     191,   162,   186,   187,    10,   137,   146,   147,   148,   162,
-     196,   199,   200,   201,   495,   497,   499,   501,    11,    20,
-      22,    23,    24,    25,    26,    27,    28,    29,    50,    51,
-      52,    53,    54,    58,    59,    69,    72,    73,    84,    85,
-      90,   100,   103,   110,   111,   114,   196,   205,   206,   207,
-     208,   209,   210,   211,   212,   213,   228,   230,   236,   238,
-     271,   280,   294,   304,   335,   343,   369,   399,   401,   403,
-     414,   416,   418,   441,   453,   454,   462,    12,    13,    16,
-      19,   196,   215,   216,   219,   221,   224,   227,   399,   401,
-      55,    56,    57,    70,    74,    75,    76,    77,    78,    79,
-      86,    89,    97,   196,   207,   208,   209,   212,   312,   313,
-     314,   316,   318,   320,   322,   324,   326,   328,   330,   333,
-     334,   369,   387,   399,   401,   403,   414,   416,   418,   438,
-      71,   196,   326,   328,   369,   395,   396,   397,   399,   401,
-      85,    91,    92,    93,    94,    95,    96,    98,   196,   369,
-     399,   401,   411,   412,   413,   414,   416,   418,   420,   424,
-     426,   428,   430,   432,   434,   436,   343,    30,    60,    62,
-      63,    66,    67,    68,   196,   256,   353,   354,   355,   356,
-     357,   358,   359,   361,   363,   365,   366,   368,   399,   401,
-      61,    64,    65,   196,   256,   357,   363,   377,   378,   379,
-     380,   381,   383,   384,   385,   386,   399,   401,   101,   102,
-     196,   288,   289,   290,   292,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,   135,
-     136,   196,   399,   401,   466,   467,   468,   469,   471,   473,
-     474,   476,   477,   478,   481,   483,   484,   485,   486,   489,
-     491,   493,   138,   505,   506,   507,     6,     3,     4,     8,
-       3,   202,   502,   496,   498,   500,     4,     3,     8,   214,
-     231,     4,     4,   415,   417,   419,   229,   237,   239,     4,
-       4,     4,     4,   305,   344,   370,   336,   400,   402,   272,
-     442,   404,   281,   295,     4,   455,   463,     3,     8,   220,
-     222,   225,     4,     3,     8,   317,   319,   321,   388,   315,
-     323,   325,     4,     4,   331,   329,   327,   439,     3,     8,
-     398,     3,     8,   437,   425,   427,   431,   429,   435,   433,
-     421,     8,     3,     8,   360,   257,     4,   364,   362,   367,
-       4,     8,     3,   382,     4,     4,     8,     3,   291,   293,
-       3,     8,     4,   470,   472,     4,   475,     4,     4,   479,
-     482,     4,     4,     4,   487,   490,   492,   494,     3,     8,
-     508,     3,     8,   181,   181,   162,     4,     4,     4,     4,
-       4,   200,     4,     4,   165,   165,     4,     4,     4,     4,
-       4,     4,   163,   163,   163,   163,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,     4,     4,   163,     4,     4,
-     206,     4,     4,     4,   165,   216,     4,     4,     4,     4,
-       4,     4,     4,   163,   165,     4,     4,     4,     4,   313,
-       4,   396,     4,     4,     4,     4,     4,     4,     4,     4,
-     413,     4,     4,   163,     4,     4,     4,   165,   355,     4,
-     165,   165,   379,     4,     4,   289,   165,     4,     4,   163,
-       4,   163,   163,     4,     4,   165,   165,   165,     4,     4,
-       4,     4,   467,     4,   506,     4,     7,     7,   181,   181,
-     181,     7,     7,   162,   162,   162,     7,     7,     5,     5,
-       5,     5,     5,   183,   185,   162,     5,     5,     5,     5,
-       7,     7,     7,     5,   192,    14,    15,   223,    17,    18,
-     226,   162,   162,   162,     5,   162,   162,   162,    80,    81,
-      82,    83,   332,   192,   162,     7,   162,   192,   162,   162,
-     162,   162,   162,   162,   162,   162,   162,   162,   162,   162,
-     162,   162,   181,   162,   162,   162,    15,   129,   480,   130,
-     131,   132,   133,   134,   165,   488,   162,   162,   162,     5,
-     181,   205,   505,   215,    21,   232,   233,   234,    30,    35,
-      36,    37,    38,    39,    40,    41,    42,    43,    44,    45,
-      46,    47,    48,    49,   196,   244,   245,   246,   249,   251,
-     253,   255,   256,   258,   259,   260,   261,   262,   263,   264,
-     265,   267,   269,   270,   244,     7,   240,   241,   242,     7,
-     306,   307,   308,     7,   347,   348,   349,     7,   371,   372,
-     373,     7,   337,   338,   339,    91,    92,    93,    94,    96,
-     273,   274,   275,   276,   277,   278,   279,     7,   443,   444,
-       7,   405,   406,   407,     7,   282,   283,   284,   104,   105,
-     106,   107,   108,   109,   296,   297,   298,   299,   300,   301,
-     302,   303,   112,   113,   196,   399,   401,   456,   457,   458,
-     460,   466,   193,     7,   389,   390,   391,    99,   420,   422,
-     440,     7,   509,   510,     8,     8,     8,   235,     3,     8,
-     247,   250,   252,   254,     4,     4,     4,     4,     4,   266,
-     268,     4,     4,     4,     4,     4,     3,     8,     8,   243,
-       6,     3,   309,     6,     3,   350,     6,     3,   374,     6,
-       3,   340,     6,     3,     3,     6,   445,     3,     6,   408,
-       6,     3,   285,     6,     3,     4,     4,     4,     4,     4,
-       4,     3,     8,   459,   461,     3,     8,     8,   162,   194,
-     195,   392,     6,     3,   423,     8,   511,     3,     6,     4,
-     233,     4,     4,     4,     4,   163,   165,   163,   165,   163,
-       4,     4,   163,   163,   163,   163,   165,   245,   244,   242,
-     312,   308,   353,   349,   377,   373,   196,   207,   208,   209,
-     212,   256,   304,   322,   326,   328,   330,   341,   342,   369,
-     399,   401,   414,   416,   418,   438,   339,   274,    87,    88,
-     196,   256,   343,   369,   399,   401,   414,   416,   418,   446,
-     447,   448,   449,   450,   452,   444,   411,   407,   288,   284,
-     163,   163,   163,   163,   163,   163,   297,     4,     4,   457,
-       6,     3,   395,   391,     4,   139,   141,   142,   196,   256,
-     399,   401,   512,   513,   514,   515,   517,   510,   162,    31,
-      32,    33,    34,   248,   162,   162,   162,   162,   162,     8,
-       8,     8,     8,     3,     8,   451,     4,     8,     3,     8,
-       8,   162,   162,   162,     8,   192,   518,     4,   516,     3,
-       8,   342,     4,   165,   448,     4,   163,     4,   513,   162,
-       5,   162,     7,   519,   520,   521,     3,     6,   140,   143,
-     144,   145,   522,   523,   524,   526,   527,   528,   520,   525,
-       4,     4,     4,     3,     8,     4,   165,   163,   163,   523,
-     162
+       0,   153,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   171,   172,   173,   174,   175,   176,
+     177,   178,   179,   180,   181,   182,   183,   184,     0,     5,
+       7,     9,   166,   167,   168,   169,   185,   186,   187,   192,
+       7,   201,     7,   207,     7,   221,     7,   316,     7,   399,
+       7,   415,     7,   351,     7,   357,     7,   381,     7,   292,
+       7,   470,     7,   509,   193,   188,   202,   208,   222,   317,
+     400,   416,   352,   358,   382,   293,   471,   510,   185,   194,
+     195,   166,   190,   191,    10,   138,   150,   151,   152,   166,
+     200,   203,   204,   205,   501,   503,   505,   507,    11,    20,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    51,
+      52,    53,    54,    55,    59,    60,    70,    73,    74,    85,
+      86,    91,   101,   104,   111,   112,   115,   200,   209,   210,
+     211,   212,   213,   214,   215,   216,   217,   232,   234,   240,
+     242,   244,   277,   286,   300,   310,   341,   349,   375,   405,
+     407,   409,   420,   422,   424,   447,   459,   460,   468,    12,
+      13,    16,    19,   200,   219,   220,   223,   225,   228,   231,
+     405,   407,    56,    57,    58,    71,    75,    76,    77,    78,
+      79,    80,    87,    90,    98,   200,   211,   212,   213,   216,
+     318,   319,   320,   322,   324,   326,   328,   330,   332,   334,
+     336,   339,   340,   375,   393,   405,   407,   409,   420,   422,
+     424,   444,    72,   200,   332,   334,   375,   401,   402,   403,
+     405,   407,    86,    92,    93,    94,    95,    96,    97,    99,
+     200,   375,   405,   407,   417,   418,   419,   420,   422,   424,
+     426,   430,   432,   434,   436,   438,   440,   442,   349,    31,
+      61,    63,    64,    67,    68,    69,   200,   262,   359,   360,
+     361,   362,   363,   364,   365,   367,   369,   371,   372,   374,
+     405,   407,    62,    65,    66,   200,   262,   363,   369,   383,
+     384,   385,   386,   387,   389,   390,   391,   392,   405,   407,
+     102,   103,   200,   294,   295,   296,   298,   116,   117,   118,
+     119,   120,   121,   122,   123,   124,   125,   126,   127,   128,
+     129,   136,   137,   200,   405,   407,   472,   473,   474,   475,
+     477,   479,   480,   482,   483,   484,   487,   489,   490,   491,
+     492,   495,   497,   499,   139,   511,   512,   513,     6,     3,
+       4,     8,     3,   206,   508,   502,   504,   506,     4,     3,
+       8,   218,   235,   241,     4,     4,   421,   423,   425,   233,
+     243,   245,     4,     4,     4,     4,   311,   350,   376,   342,
+     406,   408,   278,   448,   410,   287,   301,     4,   461,   469,
+       3,     8,   224,   226,   229,     4,     3,     8,   323,   325,
+     327,   394,   321,   329,   331,     4,     4,   337,   335,   333,
+     445,     3,     8,   404,     3,     8,   443,   431,   433,   437,
+     435,   441,   439,   427,     8,     3,     8,   366,   263,     4,
+     370,   368,   373,     4,     8,     3,   388,     4,     4,     8,
+       3,   297,   299,     3,     8,     4,   476,   478,     4,   481,
+       4,     4,   485,   488,     4,     4,     4,   493,   496,   498,
+     500,     3,     8,   514,     3,     8,   185,   185,   166,     4,
+       4,     4,     4,     4,   204,     4,     4,     4,   169,   169,
+       4,     4,     4,     4,     4,     4,   167,   167,   167,   167,
+       4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,   167,     4,     4,   210,     4,     4,     4,   169,   220,
+       4,     4,     4,     4,     4,     4,     4,   167,   169,     4,
+       4,     4,     4,   319,     4,   402,     4,     4,     4,     4,
+       4,     4,     4,     4,   419,     4,     4,   167,     4,     4,
+       4,   169,   361,     4,   169,   169,   385,     4,     4,   295,
+     169,     4,     4,   167,     4,   167,   167,     4,     4,   169,
+     169,   169,     4,     4,     4,     4,   473,     4,   512,     4,
+       7,     7,   185,   185,   185,     7,     7,   187,   189,   166,
+     166,   166,     7,     7,     5,     5,     5,     5,     5,   189,
+     166,     5,     5,     5,     5,     7,     7,     7,     5,   196,
+      14,    15,   227,    17,    18,   230,   166,   166,   166,     5,
+     166,   166,   166,    81,    82,    83,    84,   338,   196,   166,
+       7,   166,   196,   166,   166,   166,   166,   166,   166,   166,
+     166,   166,   166,   166,   166,   166,   166,   185,   166,   166,
+     166,    15,   130,   486,   131,   132,   133,   134,   135,   169,
+     494,   166,   166,   166,     5,   185,   209,   511,   219,    21,
+     236,   237,   238,    31,    36,    37,    38,    39,    40,    41,
+      42,    43,    44,    45,    46,    47,    48,    49,    50,   200,
+     250,   251,   252,   255,   257,   259,   261,   262,   264,   265,
+     266,   267,   268,   269,   270,   271,   273,   275,   276,   250,
+       7,   246,   247,   248,     7,   312,   313,   314,     7,   353,
+     354,   355,     7,   377,   378,   379,     7,   343,   344,   345,
+      92,    93,    94,    95,    97,   279,   280,   281,   282,   283,
+     284,   285,     7,   449,   450,     7,   411,   412,   413,     7,
+     288,   289,   290,   105,   106,   107,   108,   109,   110,   302,
+     303,   304,   305,   306,   307,   308,   309,   113,   114,   200,
+     405,   407,   462,   463,   464,   466,   472,   197,     7,   395,
+     396,   397,   100,   426,   428,   446,     7,   515,   516,     8,
+       8,     8,   239,     3,     8,   253,   256,   258,   260,     4,
+       4,     4,     4,     4,   272,   274,     4,     4,     4,     4,
+       4,     3,     8,     8,   249,     6,     3,   315,     6,     3,
+     356,     6,     3,   380,     6,     3,   346,     6,     3,     3,
+       6,   451,     3,     6,   414,     6,     3,   291,     6,     3,
+       4,     4,     4,     4,     4,     4,     3,     8,   465,   467,
+       3,     8,     8,   166,   198,   199,   398,     6,     3,   429,
+       8,   517,     3,     6,     4,   237,     4,     4,     4,     4,
+     167,   169,   167,   169,   167,     4,     4,   167,   167,   167,
+     167,   169,   251,   250,   248,   318,   314,   359,   355,   383,
+     379,   200,   211,   212,   213,   216,   262,   310,   328,   332,
+     334,   336,   347,   348,   375,   405,   407,   420,   422,   424,
+     444,   345,   280,    88,    89,   200,   262,   349,   375,   405,
+     407,   420,   422,   424,   452,   453,   454,   455,   456,   458,
+     450,   417,   413,   294,   290,   167,   167,   167,   167,   167,
+     167,   303,     4,     4,   463,     6,     3,   401,   397,     4,
+     140,   142,   143,   200,   262,   405,   407,   518,   519,   520,
+     521,   523,   516,   166,    32,    33,    34,    35,   254,   166,
+     166,   166,   166,   166,     8,     8,     8,     8,     3,     8,
+     457,     4,     8,     3,     8,     8,   166,   166,   166,     8,
+     196,   524,     4,   522,     3,     8,   348,     4,   169,   454,
+       4,   167,     4,   519,   166,     5,   166,     7,   525,   526,
+     527,     3,     6,   141,   144,   145,   146,   147,   148,   149,
+     528,   529,   530,   532,   533,   534,   535,   536,   537,   526,
+     531,     4,     4,     4,     4,     4,   538,     3,     8,     4,
+     169,   167,   167,   169,   167,     4,   529,   166,   166
   };
 
   const unsigned short int
   Dhcp4Parser::yyr1_[] =
   {
-       0,   166,   168,   167,   169,   167,   170,   167,   171,   167,
-     172,   167,   173,   167,   174,   167,   175,   167,   176,   167,
-     177,   167,   178,   167,   179,   167,   180,   167,   181,   181,
-     181,   181,   181,   181,   181,   182,   184,   183,   185,   186,
-     186,   187,   187,   189,   188,   190,   190,   191,   191,   193,
-     192,   194,   194,   195,   195,   196,   198,   197,   199,   199,
-     200,   200,   200,   200,   200,   200,   202,   201,   204,   203,
-     205,   205,   206,   206,   206,   206,   206,   206,   206,   206,
-     206,   206,   206,   206,   206,   206,   206,   206,   206,   206,
-     206,   206,   206,   206,   206,   206,   206,   206,   206,   206,
-     206,   207,   208,   209,   210,   211,   212,   214,   213,   215,
-     215,   216,   216,   216,   216,   216,   216,   216,   218,   217,
-     220,   219,   222,   221,   223,   223,   225,   224,   226,   226,
-     227,   229,   228,   231,   230,   232,   232,   233,   235,   234,
-     237,   236,   239,   238,   240,   240,   241,   241,   243,   242,
-     244,   244,   245,   245,   245,   245,   245,   245,   245,   245,
-     245,   245,   245,   245,   245,   245,   245,   245,   245,   245,
-     247,   246,   248,   248,   248,   248,   250,   249,   252,   251,
-     254,   253,   255,   257,   256,   258,   259,   260,   261,   262,
-     263,   264,   266,   265,   268,   267,   269,   270,   272,   271,
-     273,   273,   274,   274,   274,   274,   274,   275,   276,   277,
-     278,   279,   281,   280,   282,   282,   283,   283,   285,   284,
-     287,   286,   288,   288,   288,   289,   289,   291,   290,   293,
-     292,   295,   294,   296,   296,   297,   297,   297,   297,   297,
-     297,   298,   299,   300,   301,   302,   303,   305,   304,   306,
-     306,   307,   307,   309,   308,   311,   310,   312,   312,   313,
-     313,   313,   313,   313,   313,   313,   313,   313,   313,   313,
-     313,   313,   313,   313,   313,   313,   313,   313,   313,   313,
-     313,   313,   313,   313,   315,   314,   317,   316,   319,   318,
-     321,   320,   323,   322,   325,   324,   327,   326,   329,   328,
-     331,   330,   332,   332,   332,   332,   333,   334,   336,   335,
-     337,   337,   338,   338,   340,   339,   341,   341,   342,   342,
-     342,   342,   342,   342,   342,   342,   342,   342,   342,   342,
-     342,   342,   342,   342,   342,   342,   344,   343,   346,   345,
-     347,   347,   348,   348,   350,   349,   352,   351,   353,   353,
-     354,   354,   355,   355,   355,   355,   355,   355,   355,   355,
-     355,   355,   356,   357,   358,   360,   359,   362,   361,   364,
-     363,   365,   367,   366,   368,   370,   369,   371,   371,   372,
-     372,   374,   373,   376,   375,   377,   377,   378,   378,   379,
-     379,   379,   379,   379,   379,   379,   379,   379,   380,   382,
-     381,   383,   384,   385,   386,   388,   387,   389,   389,   390,
-     390,   392,   391,   394,   393,   395,   395,   396,   396,   396,
-     396,   396,   396,   396,   398,   397,   400,   399,   402,   401,
-     404,   403,   405,   405,   406,   406,   408,   407,   410,   409,
-     411,   411,   412,   412,   413,   413,   413,   413,   413,   413,
-     413,   413,   413,   413,   413,   413,   413,   413,   413,   415,
-     414,   417,   416,   419,   418,   421,   420,   423,   422,   425,
-     424,   427,   426,   429,   428,   431,   430,   433,   432,   435,
-     434,   437,   436,   439,   438,   440,   440,   442,   441,   443,
-     443,   445,   444,   446,   446,   447,   447,   448,   448,   448,
-     448,   448,   448,   448,   448,   448,   448,   448,   449,   451,
-     450,   452,   453,   455,   454,   456,   456,   457,   457,   457,
-     457,   457,   459,   458,   461,   460,   463,   462,   465,   464,
-     466,   466,   467,   467,   467,   467,   467,   467,   467,   467,
-     467,   467,   467,   467,   467,   467,   467,   467,   467,   467,
-     467,   468,   470,   469,   472,   471,   473,   475,   474,   476,
-     477,   479,   478,   480,   480,   482,   481,   483,   484,   485,
-     487,   486,   488,   488,   488,   488,   488,   490,   489,   492,
-     491,   494,   493,   496,   495,   498,   497,   500,   499,   502,
-     501,   504,   503,   505,   505,   506,   508,   507,   509,   509,
-     511,   510,   512,   512,   513,   513,   513,   513,   513,   513,
-     513,   514,   516,   515,   518,   517,   519,   519,   521,   520,
-     522,   522,   523,   523,   523,   523,   525,   524,   526,   527,
-     528
+       0,   170,   172,   171,   173,   171,   174,   171,   175,   171,
+     176,   171,   177,   171,   178,   171,   179,   171,   180,   171,
+     181,   171,   182,   171,   183,   171,   184,   171,   185,   185,
+     185,   185,   185,   185,   185,   186,   188,   187,   189,   190,
+     190,   191,   191,   193,   192,   194,   194,   195,   195,   197,
+     196,   198,   198,   199,   199,   200,   202,   201,   203,   203,
+     204,   204,   204,   204,   204,   204,   206,   205,   208,   207,
+     209,   209,   210,   210,   210,   210,   210,   210,   210,   210,
+     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
+     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
+     210,   210,   211,   212,   213,   214,   215,   216,   218,   217,
+     219,   219,   220,   220,   220,   220,   220,   220,   220,   222,
+     221,   224,   223,   226,   225,   227,   227,   229,   228,   230,
+     230,   231,   233,   232,   235,   234,   236,   236,   237,   239,
+     238,   241,   240,   243,   242,   245,   244,   246,   246,   247,
+     247,   249,   248,   250,   250,   251,   251,   251,   251,   251,
+     251,   251,   251,   251,   251,   251,   251,   251,   251,   251,
+     251,   251,   251,   253,   252,   254,   254,   254,   254,   256,
+     255,   258,   257,   260,   259,   261,   263,   262,   264,   265,
+     266,   267,   268,   269,   270,   272,   271,   274,   273,   275,
+     276,   278,   277,   279,   279,   280,   280,   280,   280,   280,
+     281,   282,   283,   284,   285,   287,   286,   288,   288,   289,
+     289,   291,   290,   293,   292,   294,   294,   294,   295,   295,
+     297,   296,   299,   298,   301,   300,   302,   302,   303,   303,
+     303,   303,   303,   303,   304,   305,   306,   307,   308,   309,
+     311,   310,   312,   312,   313,   313,   315,   314,   317,   316,
+     318,   318,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   319,   319,   319,   319,
+     319,   319,   319,   319,   319,   319,   319,   321,   320,   323,
+     322,   325,   324,   327,   326,   329,   328,   331,   330,   333,
+     332,   335,   334,   337,   336,   338,   338,   338,   338,   339,
+     340,   342,   341,   343,   343,   344,   344,   346,   345,   347,
+     347,   348,   348,   348,   348,   348,   348,   348,   348,   348,
+     348,   348,   348,   348,   348,   348,   348,   348,   348,   350,
+     349,   352,   351,   353,   353,   354,   354,   356,   355,   358,
+     357,   359,   359,   360,   360,   361,   361,   361,   361,   361,
+     361,   361,   361,   361,   361,   362,   363,   364,   366,   365,
+     368,   367,   370,   369,   371,   373,   372,   374,   376,   375,
+     377,   377,   378,   378,   380,   379,   382,   381,   383,   383,
+     384,   384,   385,   385,   385,   385,   385,   385,   385,   385,
+     385,   386,   388,   387,   389,   390,   391,   392,   394,   393,
+     395,   395,   396,   396,   398,   397,   400,   399,   401,   401,
+     402,   402,   402,   402,   402,   402,   402,   404,   403,   406,
+     405,   408,   407,   410,   409,   411,   411,   412,   412,   414,
+     413,   416,   415,   417,   417,   418,   418,   419,   419,   419,
+     419,   419,   419,   419,   419,   419,   419,   419,   419,   419,
+     419,   419,   421,   420,   423,   422,   425,   424,   427,   426,
+     429,   428,   431,   430,   433,   432,   435,   434,   437,   436,
+     439,   438,   441,   440,   443,   442,   445,   444,   446,   446,
+     448,   447,   449,   449,   451,   450,   452,   452,   453,   453,
+     454,   454,   454,   454,   454,   454,   454,   454,   454,   454,
+     454,   455,   457,   456,   458,   459,   461,   460,   462,   462,
+     463,   463,   463,   463,   463,   465,   464,   467,   466,   469,
+     468,   471,   470,   472,   472,   473,   473,   473,   473,   473,
+     473,   473,   473,   473,   473,   473,   473,   473,   473,   473,
+     473,   473,   473,   473,   474,   476,   475,   478,   477,   479,
+     481,   480,   482,   483,   485,   484,   486,   486,   488,   487,
+     489,   490,   491,   493,   492,   494,   494,   494,   494,   494,
+     496,   495,   498,   497,   500,   499,   502,   501,   504,   503,
+     506,   505,   508,   507,   510,   509,   511,   511,   512,   514,
+     513,   515,   515,   517,   516,   518,   518,   519,   519,   519,
+     519,   519,   519,   519,   520,   522,   521,   524,   523,   525,
+     525,   527,   526,   528,   528,   529,   529,   529,   529,   529,
+     529,   529,   531,   530,   532,   533,   534,   535,   536,   538,
+     537
   };
 
   const unsigned char
@@ -4466,60 +4523,61 @@ namespace isc { namespace dhcp {
        1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     3,     0,     6,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       0,     4,     0,     4,     1,     1,     0,     4,     1,     1,
-       3,     0,     6,     0,     6,     1,     3,     1,     0,     4,
-       0,     6,     0,     6,     0,     1,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       0,     4,     1,     1,     1,     1,     0,     4,     0,     4,
-       0,     4,     3,     0,     4,     3,     3,     3,     3,     3,
-       3,     3,     0,     4,     0,     4,     3,     3,     0,     6,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     1,     3,     1,     1,     1,     0,     4,     0,
-       4,     0,     6,     1,     3,     1,     1,     1,     1,     1,
-       1,     3,     3,     3,     3,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     3,     3,     3,     3,     3,     3,     0,     6,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     1,     1,     0,     4,     1,
+       1,     3,     0,     6,     0,     6,     1,     3,     1,     0,
+       4,     0,     4,     0,     6,     0,     6,     0,     1,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
-       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
-       0,     4,     1,     1,     1,     1,     3,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     0,     6,     0,     4,
-       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
-       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     1,     0,     4,     0,     4,     0,
-       4,     1,     0,     4,     3,     0,     6,     0,     1,     1,
-       3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     1,     1,     3,     3,     0,     6,     0,     1,     1,
+       1,     1,     1,     0,     4,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     3,     0,     4,     3,     3,
+       3,     3,     3,     3,     3,     0,     4,     0,     4,     3,
+       3,     0,     6,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     0,     6,     0,     1,     1,
        3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
+       1,     1,     1,     1,     3,     3,     3,     3,     3,     3,
        0,     6,     0,     1,     1,     3,     0,     4,     0,     4,
-       0,     1,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
        4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     6,     1,     1,     0,     6,     1,
-       3,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       4,     0,     4,     0,     4,     1,     1,     1,     1,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     1,
+       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     0,
-       4,     3,     3,     0,     6,     1,     3,     1,     1,     1,
-       1,     1,     0,     4,     0,     4,     0,     6,     0,     4,
+       6,     0,     4,     0,     1,     1,     3,     0,     4,     0,
+       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     0,     4,
+       0,     4,     0,     4,     1,     0,     4,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
        1,     3,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     1,     1,     3,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
+       4,     0,     4,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     3,     0,     4,     0,     4,     3,     0,     4,     3,
-       3,     0,     4,     1,     1,     0,     4,     3,     3,     3,
-       0,     4,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     0,     4,     1,     3,     1,     0,     6,     1,     3,
-       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     3,     0,     4,     0,     6,     1,     3,     0,     4,
-       1,     3,     1,     1,     1,     1,     0,     4,     3,     3,
-       3
+       1,     1,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     4,     0,     4,     0,     6,     1,     1,
+       0,     6,     1,     3,     0,     4,     0,     1,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     3,     3,     0,     6,     1,     3,
+       1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
+       6,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     3,     0,     4,     0,     4,     3,
+       0,     4,     3,     3,     0,     4,     1,     1,     0,     4,
+       3,     3,     3,     0,     4,     1,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     4,     0,     4,     0,     4,
+       0,     4,     0,     6,     0,     4,     1,     3,     1,     0,
+       6,     1,     3,     0,     4,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     3,     0,     4,     0,     6,     1,
+       3,     0,     4,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     0,     4,     3,     3,     3,     3,     3,     0,
+       4
   };
 
 
@@ -4534,19 +4592,20 @@ namespace isc { namespace dhcp {
   "\"interfaces-config\"", "\"interfaces\"", "\"dhcp-socket-type\"",
   "\"raw\"", "\"udp\"", "\"outbound-interface\"", "\"same-as-inbound\"",
   "\"use-routing\"", "\"re-detect\"", "\"sanity-checks\"",
-  "\"lease-checks\"", "\"echo-client-id\"", "\"match-client-id\"",
-  "\"next-server\"", "\"server-hostname\"", "\"boot-file-name\"",
-  "\"lease-database\"", "\"hosts-database\"", "\"hosts-databases\"",
-  "\"type\"", "\"memfile\"", "\"mysql\"", "\"postgresql\"", "\"cql\"",
-  "\"user\"", "\"password\"", "\"host\"", "\"port\"", "\"persist\"",
-  "\"lfc-interval\"", "\"readonly\"", "\"connect-timeout\"",
-  "\"contact-points\"", "\"keyspace\"", "\"max-reconnect-tries\"",
-  "\"reconnect-wait-time\"", "\"request-timeout\"", "\"tcp-keepalive\"",
-  "\"tcp-nodelay\"", "\"valid-lifetime\"", "\"renew-timer\"",
-  "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet4\"",
-  "\"4o6-interface\"", "\"4o6-interface-id\"", "\"4o6-subnet\"",
-  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
-  "\"space\"", "\"csv-format\"", "\"always-send\"", "\"record-types\"",
+  "\"lease-checks\"", "\"client-rate-limit\"", "\"echo-client-id\"",
+  "\"match-client-id\"", "\"next-server\"", "\"server-hostname\"",
+  "\"boot-file-name\"", "\"lease-database\"", "\"hosts-database\"",
+  "\"hosts-databases\"", "\"type\"", "\"memfile\"", "\"mysql\"",
+  "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
+  "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
+  "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
+  "\"max-reconnect-tries\"", "\"reconnect-wait-time\"",
+  "\"request-timeout\"", "\"tcp-keepalive\"", "\"tcp-nodelay\"",
+  "\"valid-lifetime\"", "\"renew-timer\"", "\"rebind-timer\"",
+  "\"decline-probation-period\"", "\"subnet4\"", "\"4o6-interface\"",
+  "\"4o6-interface-id\"", "\"4o6-subnet\"", "\"option-def\"",
+  "\"option-data\"", "\"name\"", "\"data\"", "\"code\"", "\"space\"",
+  "\"csv-format\"", "\"always-send\"", "\"record-types\"",
   "\"encapsulate\"", "\"array\"", "\"shared-networks\"", "\"pools\"",
   "\"pool\"", "\"user-context\"", "\"comment\"", "\"subnet\"",
   "\"interface\"", "\"interface-id\"", "\"id\"", "\"rapid-commit\"",
@@ -4570,11 +4629,12 @@ namespace isc { namespace dhcp {
   "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
   "\"hostname-char-set\"", "\"hostname-char-replacement\"", "\"Logging\"",
   "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp6\"",
-  "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP4",
-  "SUB_DHCP4", "SUB_INTERFACES4", "SUB_SUBNET4", "SUB_POOL4",
-  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
-  "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"queue-size\"", "\"overflow-policy\"", "\"Dhcp6\"", "\"DhcpDdns\"",
+  "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP4", "SUB_DHCP4",
+  "SUB_INTERFACES4", "SUB_SUBNET4", "SUB_POOL4", "SUB_RESERVATION",
+  "SUB_OPTION_DEFS", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
+  "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
   "\"constant string\"", "\"integer\"", "\"floating point\"",
   "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
   "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12", "$@13", "value",
@@ -4591,147 +4651,149 @@ namespace isc { namespace dhcp {
   "socket_type", "outbound_interface", "$@24", "outbound_interface_value",
   "re_detect", "lease_database", "$@25", "sanity_checks", "$@26",
   "sanity_checks_params", "sanity_checks_param", "lease_checks", "$@27",
-  "hosts_database", "$@28", "hosts_databases", "$@29", "database_list",
-  "not_empty_database_list", "database", "$@30", "database_map_params",
-  "database_map_param", "database_type", "$@31", "db_type", "user", "$@32",
-  "password", "$@33", "host", "$@34", "port", "name", "$@35", "persist",
-  "lfc_interval", "readonly", "connect_timeout", "request_timeout",
-  "tcp_keepalive", "tcp_nodelay", "contact_points", "$@36", "keyspace",
-  "$@37", "max_reconnect_tries", "reconnect_wait_time",
-  "host_reservation_identifiers", "$@38",
+  "client_rate_limit", "$@28", "hosts_database", "$@29", "hosts_databases",
+  "$@30", "database_list", "not_empty_database_list", "database", "$@31",
+  "database_map_params", "database_map_param", "database_type", "$@32",
+  "db_type", "user", "$@33", "password", "$@34", "host", "$@35", "port",
+  "name", "$@36", "persist", "lfc_interval", "readonly", "connect_timeout",
+  "request_timeout", "tcp_keepalive", "tcp_nodelay", "contact_points",
+  "$@37", "keyspace", "$@38", "max_reconnect_tries", "reconnect_wait_time",
+  "host_reservation_identifiers", "$@39",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "duid_id", "hw_address_id", "circuit_id", "client_id", "flex_id",
-  "hooks_libraries", "$@39", "hooks_libraries_list",
-  "not_empty_hooks_libraries_list", "hooks_library", "$@40",
-  "sub_hooks_library", "$@41", "hooks_params", "hooks_param", "library",
-  "$@42", "parameters", "$@43", "expired_leases_processing", "$@44",
+  "hooks_libraries", "$@40", "hooks_libraries_list",
+  "not_empty_hooks_libraries_list", "hooks_library", "$@41",
+  "sub_hooks_library", "$@42", "hooks_params", "hooks_param", "library",
+  "$@43", "parameters", "$@44", "expired_leases_processing", "$@45",
   "expired_leases_params", "expired_leases_param",
   "reclaim_timer_wait_time", "flush_reclaimed_timer_wait_time",
   "hold_reclaimed_time", "max_reclaim_leases", "max_reclaim_time",
-  "unwarned_reclaim_cycles", "subnet4_list", "$@45",
-  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@46",
-  "sub_subnet4", "$@47", "subnet4_params", "subnet4_param", "subnet",
-  "$@48", "subnet_4o6_interface", "$@49", "subnet_4o6_interface_id",
-  "$@50", "subnet_4o6_subnet", "$@51", "interface", "$@52", "interface_id",
-  "$@53", "client_class", "$@54", "require_client_classes", "$@55",
-  "reservation_mode", "$@56", "hr_mode", "id", "rapid_commit",
-  "shared_networks", "$@57", "shared_networks_content",
-  "shared_networks_list", "shared_network", "$@58",
+  "unwarned_reclaim_cycles", "subnet4_list", "$@46",
+  "subnet4_list_content", "not_empty_subnet4_list", "subnet4", "$@47",
+  "sub_subnet4", "$@48", "subnet4_params", "subnet4_param", "subnet",
+  "$@49", "subnet_4o6_interface", "$@50", "subnet_4o6_interface_id",
+  "$@51", "subnet_4o6_subnet", "$@52", "interface", "$@53", "interface_id",
+  "$@54", "client_class", "$@55", "require_client_classes", "$@56",
+  "reservation_mode", "$@57", "hr_mode", "id", "rapid_commit",
+  "shared_networks", "$@58", "shared_networks_content",
+  "shared_networks_list", "shared_network", "$@59",
   "shared_network_params", "shared_network_param", "option_def_list",
-  "$@59", "sub_option_def_list", "$@60", "option_def_list_content",
-  "not_empty_option_def_list", "option_def_entry", "$@61",
-  "sub_option_def", "$@62", "option_def_params",
+  "$@60", "sub_option_def_list", "$@61", "option_def_list_content",
+  "not_empty_option_def_list", "option_def_entry", "$@62",
+  "sub_option_def", "$@63", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
-  "code", "option_def_code", "option_def_type", "$@63",
-  "option_def_record_types", "$@64", "space", "$@65", "option_def_space",
-  "option_def_encapsulate", "$@66", "option_def_array", "option_data_list",
-  "$@67", "option_data_list_content", "not_empty_option_data_list",
-  "option_data_entry", "$@68", "sub_option_data", "$@69",
+  "code", "option_def_code", "option_def_type", "$@64",
+  "option_def_record_types", "$@65", "space", "$@66", "option_def_space",
+  "option_def_encapsulate", "$@67", "option_def_array", "option_data_list",
+  "$@68", "option_data_list_content", "not_empty_option_data_list",
+  "option_data_entry", "$@69", "sub_option_data", "$@70",
   "option_data_params", "not_empty_option_data_params",
-  "option_data_param", "option_data_name", "option_data_data", "$@70",
+  "option_data_param", "option_data_name", "option_data_data", "$@71",
   "option_data_code", "option_data_space", "option_data_csv_format",
-  "option_data_always_send", "pools_list", "$@71", "pools_list_content",
-  "not_empty_pools_list", "pool_list_entry", "$@72", "sub_pool4", "$@73",
-  "pool_params", "pool_param", "pool_entry", "$@74", "user_context",
-  "$@75", "comment", "$@76", "reservations", "$@77", "reservations_list",
-  "not_empty_reservations_list", "reservation", "$@78", "sub_reservation",
-  "$@79", "reservation_params", "not_empty_reservation_params",
-  "reservation_param", "next_server", "$@80", "server_hostname", "$@81",
-  "boot_file_name", "$@82", "ip_address", "$@83", "ip_addresses", "$@84",
-  "duid", "$@85", "hw_address", "$@86", "client_id_value", "$@87",
-  "circuit_id_value", "$@88", "flex_id_value", "$@89", "hostname", "$@90",
-  "reservation_client_classes", "$@91", "relay", "$@92", "relay_map",
-  "client_classes", "$@93", "client_classes_list", "client_class_entry",
-  "$@94", "client_class_params", "not_empty_client_class_params",
-  "client_class_param", "client_class_name", "client_class_test", "$@95",
-  "only_if_required", "dhcp4o6_port", "control_socket", "$@96",
+  "option_data_always_send", "pools_list", "$@72", "pools_list_content",
+  "not_empty_pools_list", "pool_list_entry", "$@73", "sub_pool4", "$@74",
+  "pool_params", "pool_param", "pool_entry", "$@75", "user_context",
+  "$@76", "comment", "$@77", "reservations", "$@78", "reservations_list",
+  "not_empty_reservations_list", "reservation", "$@79", "sub_reservation",
+  "$@80", "reservation_params", "not_empty_reservation_params",
+  "reservation_param", "next_server", "$@81", "server_hostname", "$@82",
+  "boot_file_name", "$@83", "ip_address", "$@84", "ip_addresses", "$@85",
+  "duid", "$@86", "hw_address", "$@87", "client_id_value", "$@88",
+  "circuit_id_value", "$@89", "flex_id_value", "$@90", "hostname", "$@91",
+  "reservation_client_classes", "$@92", "relay", "$@93", "relay_map",
+  "client_classes", "$@94", "client_classes_list", "client_class_entry",
+  "$@95", "client_class_params", "not_empty_client_class_params",
+  "client_class_param", "client_class_name", "client_class_test", "$@96",
+  "only_if_required", "dhcp4o6_port", "control_socket", "$@97",
   "control_socket_params", "control_socket_param", "control_socket_type",
-  "$@97", "control_socket_name", "$@98", "dhcp_ddns", "$@99",
-  "sub_dhcp_ddns", "$@100", "dhcp_ddns_params", "dhcp_ddns_param",
-  "enable_updates", "qualifying_suffix", "$@101", "server_ip", "$@102",
-  "server_port", "sender_ip", "$@103", "sender_port", "max_queue_size",
-  "ncr_protocol", "$@104", "ncr_protocol_value", "ncr_format", "$@105",
+  "$@98", "control_socket_name", "$@99", "dhcp_ddns", "$@100",
+  "sub_dhcp_ddns", "$@101", "dhcp_ddns_params", "dhcp_ddns_param",
+  "enable_updates", "qualifying_suffix", "$@102", "server_ip", "$@103",
+  "server_port", "sender_ip", "$@104", "sender_port", "max_queue_size",
+  "ncr_protocol", "$@105", "ncr_protocol_value", "ncr_format", "$@106",
   "always_include_fqdn", "override_no_update", "override_client_update",
-  "replace_client_name", "$@106", "replace_client_name_value",
-  "generated_prefix", "$@107", "hostname_char_set", "$@108",
-  "hostname_char_replacement", "$@109", "dhcp6_json_object", "$@110",
-  "dhcpddns_json_object", "$@111", "control_agent_json_object", "$@112",
-  "logging_object", "$@113", "sub_logging", "$@114", "logging_params",
-  "logging_param", "loggers", "$@115", "loggers_entries", "logger_entry",
-  "$@116", "logger_params", "logger_param", "debuglevel", "severity",
-  "$@117", "output_options_list", "$@118", "output_options_list_content",
-  "output_entry", "$@119", "output_params_list", "output_params", "output",
-  "$@120", "flush", "maxsize", "maxver", YY_NULLPTR
+  "replace_client_name", "$@107", "replace_client_name_value",
+  "generated_prefix", "$@108", "hostname_char_set", "$@109",
+  "hostname_char_replacement", "$@110", "dhcp6_json_object", "$@111",
+  "dhcpddns_json_object", "$@112", "control_agent_json_object", "$@113",
+  "logging_object", "$@114", "sub_logging", "$@115", "logging_params",
+  "logging_param", "loggers", "$@116", "loggers_entries", "logger_entry",
+  "$@117", "logger_params", "logger_param", "debuglevel", "severity",
+  "$@118", "output_options_list", "$@119", "output_options_list_content",
+  "output_entry", "$@120", "output_params_list", "output_params", "output",
+  "$@121", "flush", "maxsize", "maxver", "async", "queue_size",
+  "overflow_policy", "$@122", YY_NULLPTR
   };
 
 #if PARSER4_DEBUG
   const unsigned short int
   Dhcp4Parser::yyrline_[] =
   {
-       0,   250,   250,   250,   251,   251,   252,   252,   253,   253,
-     254,   254,   255,   255,   256,   256,   257,   257,   258,   258,
-     259,   259,   260,   260,   261,   261,   262,   262,   270,   271,
-     272,   273,   274,   275,   276,   279,   284,   284,   295,   298,
-     299,   302,   306,   313,   313,   320,   321,   324,   328,   335,
-     335,   342,   343,   346,   350,   361,   371,   371,   387,   388,
-     392,   393,   394,   395,   396,   397,   400,   400,   415,   415,
-     424,   425,   430,   431,   432,   433,   434,   435,   436,   437,
-     438,   439,   440,   441,   442,   443,   444,   445,   446,   447,
-     448,   449,   450,   451,   452,   453,   454,   455,   456,   457,
-     458,   461,   466,   471,   476,   481,   486,   492,   492,   503,
-     504,   507,   508,   509,   510,   511,   512,   513,   516,   516,
-     525,   525,   535,   535,   542,   543,   546,   546,   553,   555,
-     559,   565,   565,   577,   577,   587,   588,   590,   592,   592,
-     610,   610,   622,   622,   632,   633,   636,   637,   640,   640,
-     650,   651,   654,   655,   656,   657,   658,   659,   660,   661,
-     662,   663,   664,   665,   666,   667,   668,   669,   670,   671,
-     674,   674,   681,   682,   683,   684,   687,   687,   695,   695,
-     703,   703,   711,   716,   716,   724,   729,   734,   739,   744,
-     749,   754,   759,   759,   767,   767,   775,   780,   785,   785,
-     795,   796,   799,   800,   801,   802,   803,   806,   811,   816,
-     821,   826,   831,   831,   841,   842,   845,   846,   849,   849,
-     859,   859,   869,   870,   871,   874,   875,   878,   878,   886,
-     886,   894,   894,   905,   906,   909,   910,   911,   912,   913,
-     914,   917,   922,   927,   932,   937,   942,   950,   950,   963,
-     964,   967,   968,   975,   975,  1001,  1001,  1012,  1013,  1017,
-    1018,  1019,  1020,  1021,  1022,  1023,  1024,  1025,  1026,  1027,
-    1028,  1029,  1030,  1031,  1032,  1033,  1034,  1035,  1036,  1037,
-    1038,  1039,  1040,  1041,  1044,  1044,  1052,  1052,  1060,  1060,
-    1068,  1068,  1076,  1076,  1084,  1084,  1092,  1092,  1100,  1100,
-    1110,  1110,  1117,  1118,  1119,  1120,  1123,  1128,  1135,  1135,
-    1146,  1147,  1151,  1152,  1155,  1155,  1163,  1164,  1167,  1168,
-    1169,  1170,  1171,  1172,  1173,  1174,  1175,  1176,  1177,  1178,
-    1179,  1180,  1181,  1182,  1183,  1184,  1191,  1191,  1204,  1204,
-    1213,  1214,  1217,  1218,  1223,  1223,  1238,  1238,  1252,  1253,
-    1256,  1257,  1260,  1261,  1262,  1263,  1264,  1265,  1266,  1267,
-    1268,  1269,  1272,  1274,  1279,  1281,  1281,  1289,  1289,  1297,
-    1297,  1305,  1307,  1307,  1315,  1324,  1324,  1336,  1337,  1342,
-    1343,  1348,  1348,  1360,  1360,  1372,  1373,  1378,  1379,  1384,
-    1385,  1386,  1387,  1388,  1389,  1390,  1391,  1392,  1395,  1397,
-    1397,  1405,  1407,  1409,  1414,  1422,  1422,  1434,  1435,  1438,
-    1439,  1442,  1442,  1452,  1452,  1462,  1463,  1466,  1467,  1468,
-    1469,  1470,  1471,  1472,  1475,  1475,  1483,  1483,  1508,  1508,
-    1538,  1538,  1548,  1549,  1552,  1553,  1556,  1556,  1565,  1565,
-    1574,  1575,  1578,  1579,  1583,  1584,  1585,  1586,  1587,  1588,
-    1589,  1590,  1591,  1592,  1593,  1594,  1595,  1596,  1597,  1600,
-    1600,  1608,  1608,  1616,  1616,  1624,  1624,  1632,  1632,  1642,
-    1642,  1650,  1650,  1658,  1658,  1666,  1666,  1674,  1674,  1682,
-    1682,  1690,  1690,  1703,  1703,  1713,  1714,  1720,  1720,  1730,
-    1731,  1734,  1734,  1744,  1745,  1748,  1749,  1752,  1753,  1754,
-    1755,  1756,  1757,  1758,  1759,  1760,  1761,  1762,  1765,  1767,
-    1767,  1775,  1784,  1791,  1791,  1801,  1802,  1805,  1806,  1807,
-    1808,  1809,  1812,  1812,  1820,  1820,  1830,  1830,  1842,  1842,
-    1852,  1853,  1856,  1857,  1858,  1859,  1860,  1861,  1862,  1863,
-    1864,  1865,  1866,  1867,  1868,  1869,  1870,  1871,  1872,  1873,
-    1874,  1877,  1882,  1882,  1890,  1890,  1898,  1903,  1903,  1911,
-    1916,  1921,  1921,  1929,  1930,  1933,  1933,  1941,  1946,  1951,
-    1956,  1956,  1964,  1967,  1970,  1973,  1976,  1982,  1982,  1990,
-    1990,  1998,  1998,  2009,  2009,  2016,  2016,  2023,  2023,  2035,
-    2035,  2045,  2045,  2056,  2057,  2061,  2065,  2065,  2077,  2078,
-    2082,  2082,  2090,  2091,  2094,  2095,  2096,  2097,  2098,  2099,
-    2100,  2103,  2108,  2108,  2116,  2116,  2126,  2127,  2130,  2130,
-    2138,  2139,  2142,  2143,  2144,  2145,  2148,  2148,  2156,  2161,
-    2166
+       0,   255,   255,   255,   256,   256,   257,   257,   258,   258,
+     259,   259,   260,   260,   261,   261,   262,   262,   263,   263,
+     264,   264,   265,   265,   266,   266,   267,   267,   275,   276,
+     277,   278,   279,   280,   281,   284,   289,   289,   300,   303,
+     304,   307,   311,   318,   318,   325,   326,   329,   333,   340,
+     340,   347,   348,   351,   355,   366,   376,   376,   392,   393,
+     397,   398,   399,   400,   401,   402,   405,   405,   420,   420,
+     429,   430,   435,   436,   437,   438,   439,   440,   441,   442,
+     443,   444,   445,   446,   447,   448,   449,   450,   451,   452,
+     453,   454,   455,   456,   457,   458,   459,   460,   461,   462,
+     463,   464,   467,   472,   477,   482,   487,   492,   498,   498,
+     509,   510,   513,   514,   515,   516,   517,   518,   519,   522,
+     522,   531,   531,   541,   541,   548,   549,   552,   552,   559,
+     561,   565,   571,   571,   583,   583,   593,   594,   596,   598,
+     598,   617,   617,   624,   624,   636,   636,   646,   647,   650,
+     651,   654,   654,   664,   665,   668,   669,   670,   671,   672,
+     673,   674,   675,   676,   677,   678,   679,   680,   681,   682,
+     683,   684,   685,   688,   688,   695,   696,   697,   698,   701,
+     701,   709,   709,   717,   717,   725,   730,   730,   738,   743,
+     748,   753,   758,   763,   768,   773,   773,   781,   781,   789,
+     794,   799,   799,   809,   810,   813,   814,   815,   816,   817,
+     820,   825,   830,   835,   840,   845,   845,   855,   856,   859,
+     860,   863,   863,   873,   873,   883,   884,   885,   888,   889,
+     892,   892,   900,   900,   908,   908,   919,   920,   923,   924,
+     925,   926,   927,   928,   931,   936,   941,   946,   951,   956,
+     964,   964,   977,   978,   981,   982,   989,   989,  1015,  1015,
+    1026,  1027,  1031,  1032,  1033,  1034,  1035,  1036,  1037,  1038,
+    1039,  1040,  1041,  1042,  1043,  1044,  1045,  1046,  1047,  1048,
+    1049,  1050,  1051,  1052,  1053,  1054,  1055,  1058,  1058,  1066,
+    1066,  1074,  1074,  1082,  1082,  1090,  1090,  1098,  1098,  1106,
+    1106,  1114,  1114,  1124,  1124,  1131,  1132,  1133,  1134,  1137,
+    1142,  1149,  1149,  1160,  1161,  1165,  1166,  1169,  1169,  1177,
+    1178,  1181,  1182,  1183,  1184,  1185,  1186,  1187,  1188,  1189,
+    1190,  1191,  1192,  1193,  1194,  1195,  1196,  1197,  1198,  1205,
+    1205,  1218,  1218,  1227,  1228,  1231,  1232,  1237,  1237,  1252,
+    1252,  1266,  1267,  1270,  1271,  1274,  1275,  1276,  1277,  1278,
+    1279,  1280,  1281,  1282,  1283,  1286,  1288,  1293,  1295,  1295,
+    1303,  1303,  1311,  1311,  1319,  1321,  1321,  1329,  1338,  1338,
+    1350,  1351,  1356,  1357,  1362,  1362,  1374,  1374,  1386,  1387,
+    1392,  1393,  1398,  1399,  1400,  1401,  1402,  1403,  1404,  1405,
+    1406,  1409,  1411,  1411,  1419,  1421,  1423,  1428,  1436,  1436,
+    1448,  1449,  1452,  1453,  1456,  1456,  1466,  1466,  1476,  1477,
+    1480,  1481,  1482,  1483,  1484,  1485,  1486,  1489,  1489,  1497,
+    1497,  1522,  1522,  1552,  1552,  1562,  1563,  1566,  1567,  1570,
+    1570,  1579,  1579,  1588,  1589,  1592,  1593,  1597,  1598,  1599,
+    1600,  1601,  1602,  1603,  1604,  1605,  1606,  1607,  1608,  1609,
+    1610,  1611,  1614,  1614,  1622,  1622,  1630,  1630,  1638,  1638,
+    1646,  1646,  1656,  1656,  1664,  1664,  1672,  1672,  1680,  1680,
+    1688,  1688,  1696,  1696,  1704,  1704,  1717,  1717,  1727,  1728,
+    1734,  1734,  1744,  1745,  1748,  1748,  1758,  1759,  1762,  1763,
+    1766,  1767,  1768,  1769,  1770,  1771,  1772,  1773,  1774,  1775,
+    1776,  1779,  1781,  1781,  1789,  1798,  1805,  1805,  1815,  1816,
+    1819,  1820,  1821,  1822,  1823,  1826,  1826,  1834,  1834,  1844,
+    1844,  1856,  1856,  1866,  1867,  1870,  1871,  1872,  1873,  1874,
+    1875,  1876,  1877,  1878,  1879,  1880,  1881,  1882,  1883,  1884,
+    1885,  1886,  1887,  1888,  1891,  1896,  1896,  1904,  1904,  1912,
+    1917,  1917,  1925,  1930,  1935,  1935,  1943,  1944,  1947,  1947,
+    1955,  1960,  1965,  1970,  1970,  1978,  1981,  1984,  1987,  1990,
+    1996,  1996,  2004,  2004,  2012,  2012,  2023,  2023,  2030,  2030,
+    2037,  2037,  2049,  2049,  2059,  2059,  2070,  2071,  2075,  2079,
+    2079,  2091,  2092,  2096,  2096,  2104,  2105,  2108,  2109,  2110,
+    2111,  2112,  2113,  2114,  2117,  2122,  2122,  2130,  2130,  2140,
+    2141,  2144,  2144,  2152,  2153,  2156,  2157,  2158,  2159,  2160,
+    2161,  2162,  2165,  2165,  2173,  2178,  2183,  2188,  2193,  2198,
+    2198
   };
 
   // Print the state stack on the debug stream.
@@ -4766,8 +4828,8 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 4770 "dhcp4_parser.cc" // lalr1.cc:1167
-#line 2171 "dhcp4_parser.yy" // lalr1.cc:1168
+#line 4832 "dhcp4_parser.cc" // lalr1.cc:1167
+#line 2206 "dhcp4_parser.yy" // lalr1.cc:1168
 
 
 void
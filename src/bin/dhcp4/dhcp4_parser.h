@@ -367,150 +367,154 @@ namespace isc { namespace dhcp {
         TOKEN_RE_DETECT = 274,
         TOKEN_SANITY_CHECKS = 275,
         TOKEN_LEASE_CHECKS = 276,
-        TOKEN_ECHO_CLIENT_ID = 277,
-        TOKEN_MATCH_CLIENT_ID = 278,
-        TOKEN_NEXT_SERVER = 279,
-        TOKEN_SERVER_HOSTNAME = 280,
-        TOKEN_BOOT_FILE_NAME = 281,
-        TOKEN_LEASE_DATABASE = 282,
-        TOKEN_HOSTS_DATABASE = 283,
-        TOKEN_HOSTS_DATABASES = 284,
-        TOKEN_TYPE = 285,
-        TOKEN_MEMFILE = 286,
-        TOKEN_MYSQL = 287,
-        TOKEN_POSTGRESQL = 288,
-        TOKEN_CQL = 289,
-        TOKEN_USER = 290,
-        TOKEN_PASSWORD = 291,
-        TOKEN_HOST = 292,
-        TOKEN_PORT = 293,
-        TOKEN_PERSIST = 294,
-        TOKEN_LFC_INTERVAL = 295,
-        TOKEN_READONLY = 296,
-        TOKEN_CONNECT_TIMEOUT = 297,
-        TOKEN_CONTACT_POINTS = 298,
-        TOKEN_KEYSPACE = 299,
-        TOKEN_MAX_RECONNECT_TRIES = 300,
-        TOKEN_RECONNECT_WAIT_TIME = 301,
-        TOKEN_REQUEST_TIMEOUT = 302,
-        TOKEN_TCP_KEEPALIVE = 303,
-        TOKEN_TCP_NODELAY = 304,
-        TOKEN_VALID_LIFETIME = 305,
-        TOKEN_RENEW_TIMER = 306,
-        TOKEN_REBIND_TIMER = 307,
-        TOKEN_DECLINE_PROBATION_PERIOD = 308,
-        TOKEN_SUBNET4 = 309,
-        TOKEN_SUBNET_4O6_INTERFACE = 310,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 311,
-        TOKEN_SUBNET_4O6_SUBNET = 312,
-        TOKEN_OPTION_DEF = 313,
-        TOKEN_OPTION_DATA = 314,
-        TOKEN_NAME = 315,
-        TOKEN_DATA = 316,
-        TOKEN_CODE = 317,
-        TOKEN_SPACE = 318,
-        TOKEN_CSV_FORMAT = 319,
-        TOKEN_ALWAYS_SEND = 320,
-        TOKEN_RECORD_TYPES = 321,
-        TOKEN_ENCAPSULATE = 322,
-        TOKEN_ARRAY = 323,
-        TOKEN_SHARED_NETWORKS = 324,
-        TOKEN_POOLS = 325,
-        TOKEN_POOL = 326,
-        TOKEN_USER_CONTEXT = 327,
-        TOKEN_COMMENT = 328,
-        TOKEN_SUBNET = 329,
-        TOKEN_INTERFACE = 330,
-        TOKEN_INTERFACE_ID = 331,
-        TOKEN_ID = 332,
-        TOKEN_RAPID_COMMIT = 333,
-        TOKEN_RESERVATION_MODE = 334,
-        TOKEN_DISABLED = 335,
-        TOKEN_OUT_OF_POOL = 336,
-        TOKEN_GLOBAL = 337,
-        TOKEN_ALL = 338,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 339,
-        TOKEN_CLIENT_CLASSES = 340,
-        TOKEN_REQUIRE_CLIENT_CLASSES = 341,
-        TOKEN_TEST = 342,
-        TOKEN_ONLY_IF_REQUIRED = 343,
-        TOKEN_CLIENT_CLASS = 344,
-        TOKEN_RESERVATIONS = 345,
-        TOKEN_DUID = 346,
-        TOKEN_HW_ADDRESS = 347,
-        TOKEN_CIRCUIT_ID = 348,
-        TOKEN_CLIENT_ID = 349,
-        TOKEN_HOSTNAME = 350,
-        TOKEN_FLEX_ID = 351,
-        TOKEN_RELAY = 352,
-        TOKEN_IP_ADDRESS = 353,
-        TOKEN_IP_ADDRESSES = 354,
-        TOKEN_HOOKS_LIBRARIES = 355,
-        TOKEN_LIBRARY = 356,
-        TOKEN_PARAMETERS = 357,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 358,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 359,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 360,
-        TOKEN_HOLD_RECLAIMED_TIME = 361,
-        TOKEN_MAX_RECLAIM_LEASES = 362,
-        TOKEN_MAX_RECLAIM_TIME = 363,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 364,
-        TOKEN_DHCP4O6_PORT = 365,
-        TOKEN_CONTROL_SOCKET = 366,
-        TOKEN_SOCKET_TYPE = 367,
-        TOKEN_SOCKET_NAME = 368,
-        TOKEN_DHCP_DDNS = 369,
-        TOKEN_ENABLE_UPDATES = 370,
-        TOKEN_QUALIFYING_SUFFIX = 371,
-        TOKEN_SERVER_IP = 372,
-        TOKEN_SERVER_PORT = 373,
-        TOKEN_SENDER_IP = 374,
-        TOKEN_SENDER_PORT = 375,
-        TOKEN_MAX_QUEUE_SIZE = 376,
-        TOKEN_NCR_PROTOCOL = 377,
-        TOKEN_NCR_FORMAT = 378,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 379,
-        TOKEN_OVERRIDE_NO_UPDATE = 380,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 381,
-        TOKEN_REPLACE_CLIENT_NAME = 382,
-        TOKEN_GENERATED_PREFIX = 383,
-        TOKEN_TCP = 384,
-        TOKEN_JSON = 385,
-        TOKEN_WHEN_PRESENT = 386,
-        TOKEN_NEVER = 387,
-        TOKEN_ALWAYS = 388,
-        TOKEN_WHEN_NOT_PRESENT = 389,
-        TOKEN_HOSTNAME_CHAR_SET = 390,
-        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 391,
-        TOKEN_LOGGING = 392,
-        TOKEN_LOGGERS = 393,
-        TOKEN_OUTPUT_OPTIONS = 394,
-        TOKEN_OUTPUT = 395,
-        TOKEN_DEBUGLEVEL = 396,
-        TOKEN_SEVERITY = 397,
-        TOKEN_FLUSH = 398,
-        TOKEN_MAXSIZE = 399,
-        TOKEN_MAXVER = 400,
-        TOKEN_DHCP6 = 401,
-        TOKEN_DHCPDDNS = 402,
-        TOKEN_CONTROL_AGENT = 403,
-        TOKEN_TOPLEVEL_JSON = 404,
-        TOKEN_TOPLEVEL_DHCP4 = 405,
-        TOKEN_SUB_DHCP4 = 406,
-        TOKEN_SUB_INTERFACES4 = 407,
-        TOKEN_SUB_SUBNET4 = 408,
-        TOKEN_SUB_POOL4 = 409,
-        TOKEN_SUB_RESERVATION = 410,
-        TOKEN_SUB_OPTION_DEFS = 411,
-        TOKEN_SUB_OPTION_DEF = 412,
-        TOKEN_SUB_OPTION_DATA = 413,
-        TOKEN_SUB_HOOKS_LIBRARY = 414,
-        TOKEN_SUB_DHCP_DDNS = 415,
-        TOKEN_SUB_LOGGING = 416,
-        TOKEN_STRING = 417,
-        TOKEN_INTEGER = 418,
-        TOKEN_FLOAT = 419,
-        TOKEN_BOOLEAN = 420
+        TOKEN_CLIENT_RATE_LIMIT = 277,
+        TOKEN_ECHO_CLIENT_ID = 278,
+        TOKEN_MATCH_CLIENT_ID = 279,
+        TOKEN_NEXT_SERVER = 280,
+        TOKEN_SERVER_HOSTNAME = 281,
+        TOKEN_BOOT_FILE_NAME = 282,
+        TOKEN_LEASE_DATABASE = 283,
+        TOKEN_HOSTS_DATABASE = 284,
+        TOKEN_HOSTS_DATABASES = 285,
+        TOKEN_TYPE = 286,
+        TOKEN_MEMFILE = 287,
+        TOKEN_MYSQL = 288,
+        TOKEN_POSTGRESQL = 289,
+        TOKEN_CQL = 290,
+        TOKEN_USER = 291,
+        TOKEN_PASSWORD = 292,
+        TOKEN_HOST = 293,
+        TOKEN_PORT = 294,
+        TOKEN_PERSIST = 295,
+        TOKEN_LFC_INTERVAL = 296,
+        TOKEN_READONLY = 297,
+        TOKEN_CONNECT_TIMEOUT = 298,
+        TOKEN_CONTACT_POINTS = 299,
+        TOKEN_KEYSPACE = 300,
+        TOKEN_MAX_RECONNECT_TRIES = 301,
+        TOKEN_RECONNECT_WAIT_TIME = 302,
+        TOKEN_REQUEST_TIMEOUT = 303,
+        TOKEN_TCP_KEEPALIVE = 304,
+        TOKEN_TCP_NODELAY = 305,
+        TOKEN_VALID_LIFETIME = 306,
+        TOKEN_RENEW_TIMER = 307,
+        TOKEN_REBIND_TIMER = 308,
+        TOKEN_DECLINE_PROBATION_PERIOD = 309,
+        TOKEN_SUBNET4 = 310,
+        TOKEN_SUBNET_4O6_INTERFACE = 311,
+        TOKEN_SUBNET_4O6_INTERFACE_ID = 312,
+        TOKEN_SUBNET_4O6_SUBNET = 313,
+        TOKEN_OPTION_DEF = 314,
+        TOKEN_OPTION_DATA = 315,
+        TOKEN_NAME = 316,
+        TOKEN_DATA = 317,
+        TOKEN_CODE = 318,
+        TOKEN_SPACE = 319,
+        TOKEN_CSV_FORMAT = 320,
+        TOKEN_ALWAYS_SEND = 321,
+        TOKEN_RECORD_TYPES = 322,
+        TOKEN_ENCAPSULATE = 323,
+        TOKEN_ARRAY = 324,
+        TOKEN_SHARED_NETWORKS = 325,
+        TOKEN_POOLS = 326,
+        TOKEN_POOL = 327,
+        TOKEN_USER_CONTEXT = 328,
+        TOKEN_COMMENT = 329,
+        TOKEN_SUBNET = 330,
+        TOKEN_INTERFACE = 331,
+        TOKEN_INTERFACE_ID = 332,
+        TOKEN_ID = 333,
+        TOKEN_RAPID_COMMIT = 334,
+        TOKEN_RESERVATION_MODE = 335,
+        TOKEN_DISABLED = 336,
+        TOKEN_OUT_OF_POOL = 337,
+        TOKEN_GLOBAL = 338,
+        TOKEN_ALL = 339,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 340,
+        TOKEN_CLIENT_CLASSES = 341,
+        TOKEN_REQUIRE_CLIENT_CLASSES = 342,
+        TOKEN_TEST = 343,
+        TOKEN_ONLY_IF_REQUIRED = 344,
+        TOKEN_CLIENT_CLASS = 345,
+        TOKEN_RESERVATIONS = 346,
+        TOKEN_DUID = 347,
+        TOKEN_HW_ADDRESS = 348,
+        TOKEN_CIRCUIT_ID = 349,
+        TOKEN_CLIENT_ID = 350,
+        TOKEN_HOSTNAME = 351,
+        TOKEN_FLEX_ID = 352,
+        TOKEN_RELAY = 353,
+        TOKEN_IP_ADDRESS = 354,
+        TOKEN_IP_ADDRESSES = 355,
+        TOKEN_HOOKS_LIBRARIES = 356,
+        TOKEN_LIBRARY = 357,
+        TOKEN_PARAMETERS = 358,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 359,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 360,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 361,
+        TOKEN_HOLD_RECLAIMED_TIME = 362,
+        TOKEN_MAX_RECLAIM_LEASES = 363,
+        TOKEN_MAX_RECLAIM_TIME = 364,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 365,
+        TOKEN_DHCP4O6_PORT = 366,
+        TOKEN_CONTROL_SOCKET = 367,
+        TOKEN_SOCKET_TYPE = 368,
+        TOKEN_SOCKET_NAME = 369,
+        TOKEN_DHCP_DDNS = 370,
+        TOKEN_ENABLE_UPDATES = 371,
+        TOKEN_QUALIFYING_SUFFIX = 372,
+        TOKEN_SERVER_IP = 373,
+        TOKEN_SERVER_PORT = 374,
+        TOKEN_SENDER_IP = 375,
+        TOKEN_SENDER_PORT = 376,
+        TOKEN_MAX_QUEUE_SIZE = 377,
+        TOKEN_NCR_PROTOCOL = 378,
+        TOKEN_NCR_FORMAT = 379,
+        TOKEN_ALWAYS_INCLUDE_FQDN = 380,
+        TOKEN_OVERRIDE_NO_UPDATE = 381,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 382,
+        TOKEN_REPLACE_CLIENT_NAME = 383,
+        TOKEN_GENERATED_PREFIX = 384,
+        TOKEN_TCP = 385,
+        TOKEN_JSON = 386,
+        TOKEN_WHEN_PRESENT = 387,
+        TOKEN_NEVER = 388,
+        TOKEN_ALWAYS = 389,
+        TOKEN_WHEN_NOT_PRESENT = 390,
+        TOKEN_HOSTNAME_CHAR_SET = 391,
+        TOKEN_HOSTNAME_CHAR_REPLACEMENT = 392,
+        TOKEN_LOGGING = 393,
+        TOKEN_LOGGERS = 394,
+        TOKEN_OUTPUT_OPTIONS = 395,
+        TOKEN_OUTPUT = 396,
+        TOKEN_DEBUGLEVEL = 397,
+        TOKEN_SEVERITY = 398,
+        TOKEN_FLUSH = 399,
+        TOKEN_MAXSIZE = 400,
+        TOKEN_MAXVER = 401,
+        TOKEN_ASYNC = 402,
+        TOKEN_QUEUE_SIZE = 403,
+        TOKEN_OVERFLOW_POLICY = 404,
+        TOKEN_DHCP6 = 405,
+        TOKEN_DHCPDDNS = 406,
+        TOKEN_CONTROL_AGENT = 407,
+        TOKEN_TOPLEVEL_JSON = 408,
+        TOKEN_TOPLEVEL_DHCP4 = 409,
+        TOKEN_SUB_DHCP4 = 410,
+        TOKEN_SUB_INTERFACES4 = 411,
+        TOKEN_SUB_SUBNET4 = 412,
+        TOKEN_SUB_POOL4 = 413,
+        TOKEN_SUB_RESERVATION = 414,
+        TOKEN_SUB_OPTION_DEFS = 415,
+        TOKEN_SUB_OPTION_DEF = 416,
+        TOKEN_SUB_OPTION_DATA = 417,
+        TOKEN_SUB_HOOKS_LIBRARY = 418,
+        TOKEN_SUB_DHCP_DDNS = 419,
+        TOKEN_SUB_LOGGING = 420,
+        TOKEN_STRING = 421,
+        TOKEN_INTEGER = 422,
+        TOKEN_FLOAT = 423,
+        TOKEN_BOOLEAN = 424
       };
     };
 
@@ -705,6 +709,10 @@ namespace isc { namespace dhcp {
     symbol_type
     make_LEASE_CHECKS (const location_type& l);
 
+    static inline
+    symbol_type
+    make_CLIENT_RATE_LIMIT (const location_type& l);
+
     static inline
     symbol_type
     make_ECHO_CLIENT_ID (const location_type& l);
@@ -1201,6 +1209,18 @@ namespace isc { namespace dhcp {
     symbol_type
     make_MAXVER (const location_type& l);
 
+    static inline
+    symbol_type
+    make_ASYNC (const location_type& l);
+
+    static inline
+    symbol_type
+    make_QUEUE_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_OVERFLOW_POLICY (const location_type& l);
+
     static inline
     symbol_type
     make_DHCP6 (const location_type& l);
@@ -1486,12 +1506,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 965,     ///< Last index in yytable_.
-      yynnts_ = 363,  ///< Number of nonterminal symbols.
+      yylast_ = 967,     ///< Last index in yytable_.
+      yynnts_ = 369,  ///< Number of nonterminal symbols.
       yyfinal_ = 28, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 166  ///< Number of tokens.
+      yyntokens_ = 170  ///< Number of tokens.
     };
 
 
@@ -1550,9 +1570,9 @@ namespace isc { namespace dhcp {
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165
+     165,   166,   167,   168,   169
     };
-    const unsigned int user_token_number_max_ = 420;
+    const unsigned int user_token_number_max_ = 424;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1585,30 +1605,30 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1629,30 +1649,30 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1732,30 +1752,30 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1782,30 +1802,30 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 181: // value
-      case 185: // map_value
-      case 223: // socket_type
-      case 226: // outbound_interface_value
-      case 248: // db_type
-      case 332: // hr_mode
-      case 480: // ncr_protocol_value
-      case 488: // replace_client_name_value
+      case 185: // value
+      case 189: // map_value
+      case 227: // socket_type
+      case 230: // outbound_interface_value
+      case 254: // db_type
+      case 338: // hr_mode
+      case 486: // ncr_protocol_value
+      case 494: // replace_client_name_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 165: // "boolean"
+      case 169: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 164: // "floating point"
+      case 168: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 163: // "integer"
+      case 167: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 162: // "constant string"
+      case 166: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1880,7 +1900,7 @@ namespace isc { namespace dhcp {
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
      395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
      405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -2005,6 +2025,12 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_LEASE_CHECKS, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CLIENT_RATE_LIMIT (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CLIENT_RATE_LIMIT, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_ECHO_CLIENT_ID (const location_type& l)
   {
@@ -2749,6 +2775,24 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_MAXVER, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_ASYNC (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_ASYNC, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_QUEUE_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_OVERFLOW_POLICY (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_DHCP6 (const location_type& l)
   {
@@ -2872,7 +2916,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 2876 "dhcp4_parser.h" // lalr1.cc:377
+#line 2920 "dhcp4_parser.h" // lalr1.cc:377
 
 
 
@@ -63,6 +63,8 @@ using namespace std;
   SANITY_CHECKS "sanity-checks"
   LEASE_CHECKS "lease-checks"
 
+  CLIENT_RATE_LIMIT "client-rate-limit"
+
   ECHO_CLIENT_ID "echo-client-id"
   MATCH_CLIENT_ID "match-client-id"
   NEXT_SERVER "next-server"
@@ -202,6 +204,9 @@ using namespace std;
   FLUSH "flush"
   MAXSIZE "maxsize"
   MAXVER "maxver"
+  ASYNC "async"
+  QUEUE_SIZE "queue-size"
+  OVERFLOW_POLICY "overflow-policy"
 
   DHCP6 "Dhcp6"
   DHCPDDNS "DhcpDdns"
@@ -454,6 +459,7 @@ global_param: valid_lifetime
             | user_context
             | comment
             | sanity_checks
+            | client_rate_limit
             | reservations
             | unknown_map_entry
             ;
@@ -607,6 +613,14 @@ lease_checks: LEASE_CHECKS {
     }
 }
 
+// The parameters are checked by the RateLimitParser.
+client_rate_limit: CLIENT_RATE_LIMIT {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON map_value {
+    ctx.stack_.back()->set("client-rate-limit", $4);
+    ctx.leave();
+};
+
 hosts_database: HOSTS_DATABASE {
     ElementPtr i(new MapElement(ctx.loc2pos(@1)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -2143,6 +2157,9 @@ output_params: output
              | flush
              | maxsize
              | maxver
+             | async
+             | queue_size
+             | overflow_policy
              ;
 
 output: OUTPUT {
@@ -2168,6 +2185,24 @@ maxver: MAXVER COLON INTEGER {
     ctx.stack_.back()->set("maxver", maxver);
 };
 
+async: ASYNC COLON BOOLEAN {
+    ElementPtr async(new BoolElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("async", async);
+};
+
+queue_size: QUEUE_SIZE COLON INTEGER {
+    ElementPtr qs(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("queue-size", qs);
+};
+
+overflow_policy: OVERFLOW_POLICY {
+    ctx.enter(ctx.NO_KEYWORD);
+} COLON STRING {
+    ElementPtr policy(new StringElement($4, ctx.loc2pos(@4)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+};
+
 %%
 
 void
@@ -27,6 +27,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_host_operations.h>
 #include <dhcpsrv/cfg_iface.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/cfg_subnets4.h>
 #include <dhcpsrv/lease_mgr.h>
@@ -106,6 +107,48 @@ struct Dhcp4Hooks {
     }
 };
 
+/// @brief Returns options resolved from the exchange's option list.
+///
+/// The resolved options are taken from the cache held by the current
+/// configuration, unless the list includes host specific options.
+///
+/// @param ex DHCPv4 exchange holding the configured option list.
+///
+/// @return Pointer to the resolved DHCPv4 options.
+ConstResolvedOptionsPtr
+getResolvedOptions(Dhcpv4Exchange& ex) {
+    const CfgOptionList& co_list = ex.getCfgOptionList();
+    ConstHostPtr host = ex.getContext()->currentHost();
+    if (host && !host->getCfgOption4()->empty()) {
+        return (ConstResolvedOptionsPtr(new ResolvedOptions(DHCP4_OPTION_SPACE,
+                                                            co_list)));
+    }
+    return (CfgMgr::instance().getCurrentCfg()->getCfgOptionListCache()->
+            get(DHCP4_OPTION_SPACE, co_list));
+}
+
+/// @brief Drops the query which failed to be parsed.
+///
+/// Logs the failure and increases the statistics of parse failures
+/// and dropped packets.
+///
+/// @param query Query which failed to be parsed.
+/// @param reason Description of the failure.
+void
+dropUnparsableQuery(const Pkt4Ptr& query, const std::string& reason) {
+    LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0001)
+        .arg(query->getRemoteAddr().toText())
+        .arg(query->getLocalAddr().toText())
+        .arg(query->getIface())
+        .arg(reason);
+
+    // Increase the statistics of parse failures and dropped packets.
+    isc::stats::StatsMgr::instance().addValue("pkt4-parse-failed",
+                                              static_cast<int64_t>(1));
+    isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                              static_cast<int64_t>(1));
+}
+
 } // end of anonymous namespace
 
 // Declare a Hooks object. As this is outside any function or method, it
@@ -442,7 +485,8 @@ const std::string Dhcpv4Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
                      const bool direct_response_desired)
     : io_service_(new IOService()), shutdown_(true), alloc_engine_(), port_(port),
-      use_bcast_(use_bcast), network_state_(new NetworkState(NetworkState::DHCPv4)) {
+      use_bcast_(use_bcast), network_state_(new NetworkState(NetworkState::DHCPv4)),
+      latency_stats_("pkt4") {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET).arg(port);
     try {
@@ -827,19 +871,38 @@ Dhcpv4Srv::run_one() {
             .arg(query->getLabel());
         return;
     } else {
+        // Time the processing phases of the packet. The timing of the
+        // parked packets ends when they are parked.
+        latency_stats_.start(*query);
         processPacket(query, rsp);
     }
 
     if (!rsp) {
+        latency_stats_.finish();
         return;
     }
 
     CalloutHandlePtr callout_handle = getCalloutHandle(query);
     processPacketBufferSend(callout_handle, rsp);
+    latency_stats_.mark(PktLatencyStats::BUFFER_SEND);
+    latency_stats_.finish();
 }
 
 void
 Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
+    try {
+        processQuery(query, rsp, allow_packet_park);
+
+    } catch (const LazyOptionUnpackError& e) {
+        // An option decoded after the packet was unpacked is malformed.
+        // Drop the packet as if it failed to be unpacked.
+        dropUnparsableQuery(query, e.what());
+        rsp.reset();
+    }
+}
+
+void
+Dhcpv4Srv::processQuery(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     // Log reception of the packet. We need to increase it early, as any
     // failures in unpacking will cause the packet to be dropped. We
     // will increase type specific statistic further down the road.
@@ -896,6 +959,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         }
 
         callout_handle->getArgument("query4", query);
+        latency_stats_.mark(PktLatencyStats::BUFFER_RECEIVE);
     }
 
     // Unpack the packet information unless the buffer4_receive callouts
@@ -906,6 +970,9 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            // Options are decoded when they are first retrieved, so the
+            // options the server doesn't look at are never decoded.
+            query->setLazyOptionUnpack(true);
             query->unpack();
         } catch (const SkipRemainingOptionsError& e) {
             // An option failed to unpack but we are to attempt to process it
@@ -915,25 +982,21 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
                 .arg(e.what());
         } catch (const std::exception& e) {
             // Failed to parse the packet.
-            LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL,
-                      DHCP4_PACKET_DROP_0001)
-                .arg(query->getRemoteAddr().toText())
-                .arg(query->getLocalAddr().toText())
-                .arg(query->getIface())
-                .arg(e.what());
-
-            // Increase the statistics of parse failures and dropped packets.
-            isc::stats::StatsMgr::instance().addValue("pkt4-parse-failed",
-                                                      static_cast<int64_t>(1));
-            isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                      static_cast<int64_t>(1));
+            dropUnparsableQuery(query, e.what());
             return;
         }
+        latency_stats_.mark(PktLatencyStats::UNPACK);
     }
 
     // Update statistics accordingly for received packet.
     processStatsReceived(query);
 
+    // Drop the retransmissions and the packets of the clients and relays
+    // exceeding their rates before spending time on processing them.
+    if (!acceptRate(query)) {
+        return;
+    }
+
     // Assign this packet to one or more classes if needed. We need to do
     // this before calling accept(), because getSubnet4() may need client
     // class information.
@@ -954,6 +1017,8 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
     // We have sanity checked (in accept() that the Message Type option
     // exists, so we can safely get it here.
     int type = query->getType();
+    latency_stats_.mark(PktLatencyStats::CLASSIFY);
+    latency_stats_.setMessageType(static_cast<uint8_t>(type), query->getName());
     LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC_DATA, DHCP4_PACKET_RECEIVED)
         .arg(query->getLabel())
         .arg(query->getName())
@@ -997,6 +1062,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         }
 
         callout_handle->getArgument("query4", query);
+        latency_stats_.mark(PktLatencyStats::PKT_RECEIVE);
     }
 
     AllocEngine::ClientContext4Ptr ctx;
@@ -1016,10 +1082,12 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
 
         case DHCPRELEASE:
             processRelease(query, ctx);
+            latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
             break;
 
         case DHCPDECLINE:
             processDecline(query, ctx);
+            latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
             break;
 
         case DHCPINFORM:
@@ -1032,6 +1100,10 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             // "switch" statement.
             ;
         }
+    } catch (const LazyOptionUnpackError&) {
+        // Malformed options are handled like the parse failures.
+        throw;
+
     } catch (const std::exception& e) {
 
         // Catch-all exception (we used to call only isc::Exception, but
@@ -1050,6 +1122,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
         isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
                                                   static_cast<int64_t>(1));
     }
+    latency_stats_.mark(PktLatencyStats::BUILD_RESPONSE);
 
     bool packet_park = false;
 
@@ -1095,6 +1168,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
                    && allow_packet_park) {
             packet_park = true;
         }
+        latency_stats_.mark(PktLatencyStats::LEASES_COMMITTED);
     }
 
     if (!rsp) {
@@ -1109,9 +1183,15 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
             .arg(query->getLabel());
 
         // Park the packet. The function we bind here will be executed when the hook
-        // library unparks the packet.
+        // library unparks the packet. The retransmissions are suppressed for
+        // as long as the parking lot may hold the packet.
+        ParkingLotPtr parking_lot = ServerHooks::getServerHooks().
+            getParkingLotPtr("leases4_committed");
+        rate_limiter_.park(query,
+                           std::chrono::milliseconds(parking_lot->getTimeout()));
         HooksManager::park("leases4_committed", query,
         [this, callout_handle, query, rsp]() mutable {
+            rate_limiter_.unpark(query);
             processPacketPktSend(callout_handle, query, rsp);
             processPacketBufferSend(callout_handle, rsp);
         });
@@ -1123,6 +1203,7 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park) {
 
     } else {
         processPacketPktSend(callout_handle, query, rsp);
+        latency_stats_.mark(PktLatencyStats::PKT_SEND);
     }
 }
 
@@ -1406,24 +1487,14 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
     if (option_prl) {
         requested_opts = option_prl->getValues();
     }
-    // Iterate on the configured option list to add persistent options
-    for (CfgOptionList::const_iterator copts = co_list.begin();
-         copts != co_list.end(); ++copts) {
-        const OptionContainerPtr& opts = (*copts)->getAll(DHCP4_OPTION_SPACE);
-        if (!opts) {
-            continue;
-        }
-        // Get persistent options
-        const OptionContainerPersistIndex& idx = opts->get<2>();
-        const OptionContainerPersistRange& range = idx.equal_range(true);
-        for (OptionContainerPersistIndex::const_iterator desc = range.first;
-             desc != range.second; ++desc) {
-            // Add the persistent option code to requested options
-            if (desc->option_) {
-                uint8_t code = static_cast<uint8_t>(desc->option_->getType());
-                requested_opts.push_back(code);
-            }
-        }
+    // Get the options resolved from the configured option list.
+    ConstResolvedOptionsPtr resolved = getResolvedOptions(ex);
+
+    // Add persistent options to requested options
+    const std::vector<uint16_t>& persistent = resolved->getPersistentCodes();
+    for (std::vector<uint16_t>::const_iterator code = persistent.begin();
+         code != persistent.end(); ++code) {
+        requested_opts.push_back(static_cast<uint8_t>(*code));
     }
 
     // For each requested option code get the instance of the option
@@ -1432,15 +1503,9 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
          opt != requested_opts.end(); ++opt) {
         // Add nothing when it is already there
         if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            OptionPtr option = resolved->get(*opt);
+            if (option) {
+                resp->addOption(option);
             }
         }
     }
@@ -1560,6 +1625,7 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
     }
 
     Pkt4Ptr resp = ex.getResponse();
+    ConstResolvedOptionsPtr resolved = getResolvedOptions(ex);
 
     // Try to find all 'required' options in the outgoing
     // message. Those that are not present will be added.
@@ -1567,14 +1633,9 @@ Dhcpv4Srv::appendBasicOptions(Dhcpv4Exchange& ex) {
         OptionPtr opt = resp->getOption(required_options[i]);
         if (!opt) {
             // Check whether option has been configured.
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE,
-                                                      required_options[i]);
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
+            opt = resolved->get(required_options[i]);
+            if (opt) {
+                resp->addOption(opt);
             }
         }
     }
@@ -2538,7 +2599,11 @@ Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
     sanityCheck(discover, FORBIDDEN);
 
     bool drop = false;
-    Dhcpv4Exchange ex(alloc_engine_, discover, selectSubnet(discover, drop));
+    Subnet4Ptr subnet = selectSubnet(discover, drop);
+    latency_stats_.mark(PktLatencyStats::SUBNET_SELECT);
+
+    Dhcpv4Exchange ex(alloc_engine_, discover, subnet);
+    latency_stats_.mark(PktLatencyStats::HOST_LOOKUP);
 
     // Stop here if selectSubnet decided to drop the packet
     if (drop) {
@@ -2550,8 +2615,10 @@ Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
     // option to indicate that whether it will take responsibility for
     // updating DNS when the client sends DHCPREQUEST message.
     processClientName(ex);
+    latency_stats_.mark(PktLatencyStats::DDNS);
 
     assignLease(ex);
+    latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
 
     if (!ex.getResponse()) {
         // The offer is empty so return it *now*!
@@ -2598,7 +2665,11 @@ Dhcpv4Srv::processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& cont
     /// sanityCheck(request, MANDATORY);
 
     bool drop = false;
-    Dhcpv4Exchange ex(alloc_engine_, request, selectSubnet(request, drop));
+    Subnet4Ptr subnet = selectSubnet(request, drop);
+    latency_stats_.mark(PktLatencyStats::SUBNET_SELECT);
+
+    Dhcpv4Exchange ex(alloc_engine_, request, subnet);
+    latency_stats_.mark(PktLatencyStats::HOST_LOOKUP);
 
     // Stop here if selectSubnet decided to drop the packet
     if (drop) {
@@ -2610,11 +2681,13 @@ Dhcpv4Srv::processRequest(Pkt4Ptr& request, AllocEngine::ClientContext4Ptr& cont
     // option to indicate if it takes responsibility for the DNS updates.
     // This is performed by the function below.
     processClientName(ex);
+    latency_stats_.mark(PktLatencyStats::DDNS);
 
     // Note that we treat REQUEST message uniformly, regardless if this is a
     // first request (requesting for new address), renewing existing address
     // or even rebinding.
     assignLease(ex);
+    latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
 
     if (!ex.getResponse()) {
         // The ack is empty so return it *now*!
@@ -2754,6 +2827,13 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release, AllocEngine::ClientContext4Ptr& cont
                 // Remove existing DNS entries for the lease, if any.
                 queueNCR(CHG_REMOVE, lease);
 
+                // The released address can be allocated again.
+                Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                    getCfgSubnets4()->getSubnet(lease->subnet_id_);
+                if (subnet) {
+                    subnet->resetPoolExhausted(Lease::TYPE_V4, lease->addr_);
+                }
+
             } else {
                 // Release failed
                 LOG_ERROR(lease4_logger, DHCP4_RELEASE_FAIL)
@@ -2925,7 +3005,11 @@ Dhcpv4Srv::processInform(Pkt4Ptr& inform) {
     sanityCheck(inform, FORBIDDEN);
 
     bool drop = false;
-    Dhcpv4Exchange ex(alloc_engine_, inform, selectSubnet(inform, drop));
+    Subnet4Ptr subnet = selectSubnet(inform, drop);
+    latency_stats_.mark(PktLatencyStats::SUBNET_SELECT);
+
+    Dhcpv4Exchange ex(alloc_engine_, inform, subnet);
+    latency_stats_.mark(PktLatencyStats::HOST_LOOKUP);
 
     // Stop here if selectSubnet decided to drop the packet
     if (drop) {
@@ -2996,6 +3080,43 @@ Dhcpv4Srv::accept(const Pkt4Ptr& query) const {
     return (true);
 }
 
+bool
+Dhcpv4Srv::acceptRate(const Pkt4Ptr& query) {
+    // The limiter forgets the clients when the configuration changes.
+    rate_limiter_.configure(CfgMgr::instance().getCurrentCfg()->getCfgRateLimit());
+
+    std::string stat_name;
+    switch (rate_limiter_.accept(query)) {
+    case ClientRateLimiter::ACCEPT:
+        return (true);
+
+    case ClientRateLimiter::DROP_DUPLICATE:
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0010)
+            .arg(query->getLabel());
+        stat_name = "pkt4-duplicate-drop";
+        break;
+
+    case ClientRateLimiter::DROP_CLIENT_RATE:
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0011)
+            .arg(query->getLabel());
+        stat_name = "pkt4-client-rate-limit-drop";
+        break;
+
+    case ClientRateLimiter::DROP_RELAY_RATE:
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0012)
+            .arg(query->getLabel())
+            .arg(query->getGiaddr().toText());
+        stat_name = "pkt4-relay-rate-limit-drop";
+        break;
+    }
+
+    isc::stats::StatsMgr::instance().addValue(stat_name,
+                                              static_cast<int64_t>(1));
+    isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                              static_cast<int64_t>(1));
+    return (false);
+}
+
 bool
 Dhcpv4Srv::acceptDirectRequest(const Pkt4Ptr& pkt) const {
     // Accept all relayed messages.
@@ -18,8 +18,10 @@
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/callout_handle_store.h>
+#include <dhcpsrv/client_rate_limiter.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/network_state.h>
+#include <dhcpsrv/pkt_latency_stats.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
@@ -240,6 +242,16 @@ public:
         return (network_state_);
     }
 
+    /// @brief Returns the latency statistics of the packet processing.
+    PktLatencyStats& getLatencyStats() {
+        return (latency_stats_);
+    }
+
+    /// @brief Returns the limiter of the received packets.
+    ClientRateLimiter& getRateLimiter() {
+        return (rate_limiter_);
+    }
+
     /// @brief returns Kea version on stdout and exit.
     /// redeclaration/redefinition. @ref Daemon::getVersion()
     static std::string getVersion(bool extended);
@@ -264,6 +276,9 @@ public:
     /// It verifies correctness of the passed packet, call per-type processXXX
     /// methods, generates appropriate answer.
     ///
+    /// The packet is dropped as if it failed to be unpacked when one of
+    /// the options decoded lazily during the processing is malformed.
+    ///
     /// @param query A pointer to the packet to be processed.
     /// @param rsp A pointer to the response
     /// @param allow_packet_park Indicates if parking a packet is allowed.
@@ -335,6 +350,17 @@ public:
 
 protected:
 
+    /// @brief Processes a single incoming DHCPv4 packet.
+    ///
+    /// This method implements the @ref processPacket. It is called by
+    /// the @ref processPacket which drops the packet when this method
+    /// throws @ref LazyOptionUnpackError.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    /// @param allow_packet_park Indicates if parking a packet is allowed.
+    void processQuery(Pkt4Ptr& query, Pkt4Ptr& rsp, bool allow_packet_park);
+
     /// @name Functions filtering and sanity-checking received messages.
     ///
     /// @todo These functions are supposed to be moved to a new class which
@@ -364,6 +390,19 @@ protected:
     /// the message should be discarded.
     bool accept(const Pkt4Ptr& query) const;
 
+    /// @brief Checks if a message should be dropped by the client-rate-limit.
+    ///
+    /// This function is called before the message is classified. It drops
+    /// the retransmissions of the parked messages and the messages from the
+    /// clients and relays exceeding their configured rates. It logs the
+    /// reason of the drop and updates the statistics.
+    ///
+    /// @param query Received message.
+    ///
+    /// @return true if the message should be further processed, or false if
+    /// the message should be discarded.
+    bool acceptRate(const Pkt4Ptr& query);
+
     /// @brief Check if a message sent by directly connected client should be
     /// accepted or discarded.
     ///
@@ -936,6 +975,12 @@ protected:
     /// disabled subnet/network scopes.
     NetworkStatePtr network_state_;
 
+    /// @brief Latency statistics of the packet processing phases.
+    PktLatencyStats latency_stats_;
+
+    /// @brief Limiter of the received packets.
+    ClientRateLimiter rate_limiter_;
+
 public:
     /// Class methods for DHCPv4-over-DHCPv6 handler
 
@@ -23,6 +23,7 @@
 #include <dhcpsrv/parsers/host_reservations_list_parser.h>
 #include <dhcpsrv/parsers/ifaces_config_parser.h>
 #include <dhcpsrv/parsers/option_data_parser.h>
+#include <dhcpsrv/parsers/rate_limit_parser.h>
 #include <dhcpsrv/parsers/simple_parser4.h>
 #include <dhcpsrv/parsers/shared_networks_list_parser.h>
 #include <dhcpsrv/parsers/sanity_checks_parser.h>
@@ -331,6 +332,17 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
         // And now derive (inherit) global parameters to subnets, if not specified.
         SimpleParser4::deriveParameters(mutable_cfg);
 
+        // The subnets, client classes and host reservations which are
+        // configured exactly as in the current configuration are reused
+        // rather than parsed again, unless the option definitions or the
+        // host identifiers they depend on have changed.
+        SrvConfigPtr current = CfgMgr::instance().getCurrentCfg();
+        if (!current->isParsedParameterUnchanged(mutable_cfg, "option-def") ||
+            !current->isParsedParameterUnchanged(mutable_cfg,
+                                                 "host-reservation-identifiers")) {
+            current.reset();
+        }
+
         // We need definitions first
         ConstElementPtr option_defs = mutable_cfg->get("option-def");
         if (option_defs) {
@@ -395,6 +407,12 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                 continue;
             }
 
+            if (config_pair.first == "client-rate-limit") {
+                RateLimitParser parser;
+                parser.parse(srv_cfg->getCfgRateLimit(), config_pair.second);
+                continue;
+            }
+
             if (config_pair.first == "expired-leases-processing") {
                 ExpirationConfigParser parser;
                 parser.parse(config_pair.second);
@@ -420,6 +438,13 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
             }
 
             if (config_pair.first == "client-classes") {
+                if (current &&
+                    current->isParsedParameterUnchanged(mutable_cfg,
+                                                        config_pair.first)) {
+                    srv_cfg->setClientClassDictionary(current->
+                                                      getClientClassDictionary());
+                    continue;
+                }
                 ClientClassDefListParser parser;
                 ClientClassDictionaryPtr dictionary =
                     parser.parse(config_pair.second, AF_INET);
@@ -456,7 +481,7 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
                 SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
                 Subnets4ListConfigParser subnets_parser;
                 // parse() returns number of subnets parsed. We may log it one day.
-                subnets_parser.parse(srv_cfg, config_pair.second);
+                subnets_parser.parse(srv_cfg, config_pair.second, current);
                 continue;
             }
 
@@ -479,8 +504,14 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
 
             if (config_pair.first == "reservations") {
                 HostCollection hosts;
-                HostReservationsListParser<HostReservationParser4> parser;
-                parser.parse(SUBNET_ID_GLOBAL, config_pair.second, hosts);
+                if (current &&
+                    current->isParsedParameterUnchanged(mutable_cfg,
+                                                        config_pair.first)) {
+                    hosts = current->getCfgHosts()->getAll4(SUBNET_ID_GLOBAL);
+                } else {
+                    HostReservationsListParser<HostReservationParser4> parser;
+                    parser.parse(SUBNET_ID_GLOBAL, config_pair.second, hosts);
+                }
                 for (auto h = hosts.begin(); h != hosts.end(); ++h) {
                     srv_cfg->getCfgHosts()->add(*h);
                 }
@@ -522,6 +553,11 @@ configureDhcp4Server(Dhcpv4Srv& server, isc::data::ConstElementPtr config_set,
         // defined as part of shared networks.
         global_parser.sanityChecks(srv_cfg, mutable_cfg);
 
+        // Remember the configuration so the next configuration can reuse
+        // the parts which haven't changed. The caller may modify the
+        // configuration afterwards, so a copy is stored.
+        srv_cfg->setParsedConfig(isc::data::copy(mutable_cfg));
+
     } catch (const isc::Exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_PARSER_FAIL)
                   .arg(config_pair.first).arg(ex.what());
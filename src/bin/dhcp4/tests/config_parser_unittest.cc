@@ -1019,6 +1019,91 @@ TEST_F(Dhcp4ParserTest, multipleSubnetsExplicitIDs) {
     } while (++cnt < 3);
 }
 
+// Check that the unchanged subnets having explicit ids are reused along
+// with their reservations by the new configuration.
+TEST_F(Dhcp4ParserTest, reuseUnchangedSubnets) {
+    const std::string subnets =
+        "\"subnet4\": [ { "
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\", "
+        "    \"id\": 1024, "
+        "    \"reservations\": [ { "
+        "        \"hw-address\": \"01:02:03:04:05:06\", "
+        "        \"ip-address\": \"192.0.2.200\" } ]"
+        " },"
+        " {"
+        "    \"pools\": [ { \"pool\": \"192.0.3.101 - 192.0.3.150\" } ],"
+        "    \"subnet\": \"192.0.3.0/24\", "
+        "    \"id\": 100 "
+        " } ],";
+    std::string config = "{ " + genIfaceConfig() + "," +
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, " + subnets +
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    ConstElementPtr x;
+    EXPECT_NO_THROW(x = configureDhcp4Server(*srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    CfgSubnets4Ptr cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet1 = cfg->getSubnet(1024);
+    Subnet4Ptr subnet2 = cfg->getSubnet(100);
+    ASSERT_TRUE(subnet1);
+    ASSERT_TRUE(subnet2);
+
+    // The same configuration reuses both subnets and the reservation.
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    EXPECT_NO_THROW(x = configureDhcp4Server(*srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    EXPECT_TRUE(cfg->getSubnet(1024) == subnet1);
+    EXPECT_TRUE(cfg->getSubnet(100) == subnet2);
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgHosts()->
+              getAll4(SubnetID(1024)).size());
+
+    // The global timers are derived to the subnets, so both subnets are
+    // parsed again.
+    config = "{ " + genIfaceConfig() + "," +
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, " + subnets +
+        "\"valid-lifetime\": 5000 }";
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    EXPECT_NO_THROW(x = configureDhcp4Server(*srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    ASSERT_TRUE(cfg->getSubnet(1024));
+    EXPECT_FALSE(cfg->getSubnet(1024) == subnet1);
+    EXPECT_EQ(5000, cfg->getSubnet(1024)->getValid());
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgHosts()->
+              getAll4(SubnetID(1024)).size());
+    subnet1 = cfg->getSubnet(1024);
+
+    // The option definitions may be used by the subnets, so the subnets
+    // are parsed again when they have changed.
+    config = "{ " + genIfaceConfig() + "," +
+        "\"option-def\": [ { "
+        "    \"name\": \"foo\", \"code\": 222, "
+        "    \"type\": \"uint32\", \"space\": \"dhcp4\" } ],"
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, " + subnets +
+        "\"valid-lifetime\": 5000 }";
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    EXPECT_NO_THROW(x = configureDhcp4Server(*srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    ASSERT_TRUE(cfg->getSubnet(1024));
+    EXPECT_FALSE(cfg->getSubnet(1024) == subnet1);
+}
+
 // Check that the configuration with two subnets having the same id is rejected.
 TEST_F(Dhcp4ParserTest, multipleSubnetsOverlappingIDs) {
     ConstElementPtr x;
@@ -4964,6 +5049,48 @@ TEST_F(Dhcp4ParserTest, expiredLeasesProcessing) {
     EXPECT_EQ(10, cfg->getUnwarnedReclaimCycles());
 }
 
+// Check that the client-rate-limit may be specified.
+TEST_F(Dhcp4ParserTest, clientRateLimit) {
+    string config = "{ " + genIfaceConfig() + "," +
+        "\"client-rate-limit\": "
+        "{"
+        "    \"client-rate\": 5,"
+        "    \"client-burst\": 10,"
+        "    \"relay-rate\": 1000,"
+        "    \"max-clients\": 1024,"
+        "    \"drop-duplicates\": true"
+        "},"
+        "\"subnet4\": [ ]"
+        "}";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+
+    ConstElementPtr status;
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 0);
+
+    ConstCfgRateLimitPtr cfg =
+        CfgMgr::instance().getStagingCfg()->getCfgRateLimit();
+    ASSERT_TRUE(cfg);
+    EXPECT_EQ(5, cfg->getClientRate());
+    EXPECT_EQ(10, cfg->getClientBurst());
+    EXPECT_EQ(1000, cfg->getRelayRate());
+    EXPECT_EQ(0, cfg->getRelayBurst());
+    EXPECT_EQ(1024, cfg->getMaxClients());
+    EXPECT_TRUE(cfg->getDropDuplicates());
+
+    // Unsupported parameters are rejected.
+    config = "{ " + genIfaceConfig() + "," +
+        "\"client-rate-limit\": { \"client-rates\": 5 },"
+        "\"subnet4\": [ ]"
+        "}";
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    EXPECT_NO_THROW(status = configureDhcp4Server(*srv_, json));
+    checkResult(status, 1);
+    EXPECT_TRUE(errorContainsPosition(status, "<string>"));
+}
+
 // Check that invalid configuration for the expired leases processing is
 // causing an error.
 TEST_F(Dhcp4ParserTest, expiredLeasesProcessingError) {
@@ -9,6 +9,7 @@
 #include <asiolink/interval_timer.h>
 #include <asiolink/io_service.h>
 #include <cc/command_interpreter.h>
+#include <cc/json_stream.h>
 #include <config/command_mgr.h>
 #include <config/timeouts.h>
 #include <dhcp/dhcp4.h>
@@ -377,6 +378,21 @@ public:
         }
         return (createAnswer(0, arguments));
     }
+
+    /// @brief Command handler which generates long streamed response
+    ///
+    /// This handler generates the same response as @c longResponseHandler
+    /// but the list items are generated while the response is being sent.
+    static ConstElementPtr longStreamedResponseHandler(const std::string&,
+                                                       const ConstElementPtr&) {
+        ElementPtr arguments(new StreamedListElement(80000,
+            [](const size_t i) {
+                std::ostringstream s;
+                s << std::setw(5) << i;
+                return (Element::create(s.str()));
+            }));
+        return (createAnswer(0, arguments));
+    }
 };
 
 TEST_F(CtrlChannelDhcpv4SrvTest, commands) {
@@ -845,10 +861,13 @@ TEST_F(CtrlChannelDhcpv4SrvTest, listCommands) {
 
     // We expect the server to report at least the following commands:
     checkListCommands(rsp, "build-report");
+    checkListCommands(rsp, "callout-timing-disable");
+    checkListCommands(rsp, "callout-timing-enable");
     checkListCommands(rsp, "config-get");
     checkListCommands(rsp, "config-reload");
     checkListCommands(rsp, "config-set");
     checkListCommands(rsp, "config-write");
+    checkListCommands(rsp, "list-callout-timings");
     checkListCommands(rsp, "list-commands");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
@@ -1411,6 +1430,70 @@ TEST_F(CtrlChannelDhcpv4SrvTest, longResponse) {
     EXPECT_EQ(reference_response, response.str());
 }
 
+// This test verifies that the server can send long response which list
+// items are generated while the response is being sent.
+TEST_F(CtrlChannelDhcpv4SrvTest, longStreamedResponse) {
+    ASSERT_NO_THROW(
+        CommandMgr::instance().registerCommand("foo",
+             boost::bind(&CtrlChannelDhcpv4SrvTest::longStreamedResponseHandler, _1, _2));
+    );
+
+    createUnixChannelServer();
+
+    // The UnixControlClient doesn't have any means to check that the entire
+    // response has been received. What we want to do is to generate a
+    // reference response using our command handler and then compare
+    // what we have received over the unix domain socket with this reference
+    // response to figure out when to stop receiving.
+    std::string reference_response = longResponseHandler("foo", ConstElementPtr())->str();
+
+    // In this stream we're going to collect out partial responses.
+    std::ostringstream response;
+
+    // The client is synchronous so it is useful to run it in a thread.
+    std::thread th([this, &response, reference_response]() {
+
+        // IO service will be stopped automatically when this object goes
+        // out of scope and is destroyed. This is useful because we use
+        // asserts which may break the thread in various exit points.
+        IOServiceWork work(getIOService());
+
+        // Remember the response size so as we know when we should stop
+        // receiving.
+        const size_t long_response_size = reference_response.size();
+
+        // Create the client and connect it to the server.
+        boost::scoped_ptr<UnixControlClient> client(new UnixControlClient());
+        ASSERT_TRUE(client);
+        ASSERT_TRUE(client->connectToServer(socket_path_));
+
+        // Send the stub command.
+        std::string command = "{ \"command\": \"foo\", \"arguments\": { }  }";
+        ASSERT_TRUE(client->sendCommand(command));
+
+        // Keep receiving response data until we have received the full answer.
+        while (response.tellp() < long_response_size) {
+            std::string partial;
+            const unsigned int timeout = 5;
+            ASSERT_TRUE(client->getResponse(partial, timeout));
+            response << partial;
+        }
+
+        // We have received the entire response, so close the connection and
+        // stop the IO service.
+        client->disconnectFromServer();
+    });
+
+    // Run the server until the entire response has been received.
+    getIOService()->run();
+
+    // Wait for the thread to complete.
+    th.join();
+
+    // Make sure we have received correct response.
+    EXPECT_EQ(reference_response, response.str());
+}
+
 // This test verifies that the server signals timeout if the transmission
 // takes too long, after receiving a partial command.
 TEST_F(CtrlChannelDhcpv4SrvTest, connectionTimeoutPartialCommand) {
@@ -4381,6 +4381,45 @@ TEST_F(Dhcpv4SrvTest, statisticsUnknownRcvd) {
     EXPECT_EQ(1, drop_stat->getInteger().first);
 }
 
+// Test checks that a packet carrying a malformed option, which is decoded
+// only when the server retrieves it, is dropped as a parse failure.
+TEST_F(Dhcpv4SrvTest, statisticsMalformedOption) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+    NakedDhcpv4Srv srv(0);
+
+    configure(CONFIGS[0]);
+
+    // Replace the vendor class identifier with an empty one. This option
+    // is retrieved by the classification so it is decoded by the server.
+    Pkt4Ptr pkt = PktCaptures::captureRelayedDiscover();
+    pkt->unpack();
+    ASSERT_TRUE(pkt->delOption(DHO_VENDOR_CLASS_IDENTIFIER));
+    pkt->addOption(OptionPtr(new Option(Option::V4,
+                                        DHO_VENDOR_CLASS_IDENTIFIER)));
+    pkt->pack();
+    pkt->data_.resize(pkt->getBuffer().getLength());
+    memcpy(&pkt->data_[0], pkt->getBuffer().getData(), pkt->getBuffer().getLength());
+
+    // The packet is unpacked successfully as the option is not decoded.
+    srv.fakeReceive(pkt);
+    srv.run();
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr parse_fail = mgr.getObservation("pkt4-parse-failed");
+    ObservationPtr recv_drop = mgr.getObservation("pkt4-receive-drop");
+
+    // The packet must have been dropped as a parse failure.
+    ASSERT_TRUE(parse_fail);
+    ASSERT_TRUE(recv_drop);
+    EXPECT_EQ(1, parse_fail->getInteger().first);
+    EXPECT_EQ(1, recv_drop->getInteger().first);
+
+    // No response must have been sent.
+    EXPECT_TRUE(srv.fake_sent_.empty());
+}
+
 // This test verifies that the server is able to handle an empty client-id
 // in incoming client message.
 TEST_F(Dhcpv4SrvTest, emptyClientId) {
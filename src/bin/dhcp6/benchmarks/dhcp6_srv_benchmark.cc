@@ -0,0 +1,461 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <benchmark/benchmark.h>
+#include <asiolink/io_address.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/duid.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp/option_int_array.h>
+#include <dhcp/pkt6.h>
+#include <dhcp/pkt_pool.h>
+#include <dhcp/tests/iface_mgr_test_config.h>
+#include <dhcp/tests/pkt_filter6_test_stub.h>
+#include <dhcp6/dhcp6_srv.h>
+#include <dhcp6/json_config_parser.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <new>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Number of the memory allocations made by the process.
+uint64_t allocations = 0;
+
+}
+
+/// @brief Counts the memory allocations.
+///
+/// The default operator new[] and the non-throwing variants are implemented
+/// in terms of this operator, so all allocations are counted.
+void*
+operator new(std::size_t size) {
+    ++allocations;
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (!ptr) {
+        throw std::bad_alloc();
+    }
+    return (ptr);
+}
+
+/// @brief Releases the memory allocated by the counting operator new.
+void
+operator delete(void* ptr) throw() {
+    std::free(ptr);
+}
+
+namespace {
+
+/// @brief Number of the clients in each subnet.
+const int CLIENTS_PER_SUBNET = 20;
+
+/// @brief Number of the subnets in each shared network.
+const int SUBNETS_PER_NETWORK = 4;
+
+/// @brief Identifier of the IA_NA sent by the clients.
+const uint32_t IAID = 1234;
+
+/// @brief Returns the address in the subnet used by the benchmarks.
+///
+/// @param subnet Subnet index.
+/// @param host Host part of the address.
+std::string
+getAddress(const int subnet, const int host) {
+    std::ostringstream s;
+    s << "2001:db8:" << std::hex << subnet << "::" << host;
+    return (s.str());
+}
+
+/// @brief Returns the address reserved for the client or requested by it.
+///
+/// The first client in each subnet has a reservation, the remaining
+/// clients are assigned the addresses from the pool.
+///
+/// @param subnet Subnet index.
+/// @param client Client index within the subnet.
+std::string
+getClientAddress(const int subnet, const int client) {
+    return (getAddress(subnet, client == 0 ? 0x100 : 0x1000 + client));
+}
+
+/// @brief Returns the DUID-LL of the client.
+///
+/// @param subnet Subnet index.
+/// @param client Client index within the subnet.
+std::vector<uint8_t>
+getClientDuid(const int subnet, const int client) {
+    std::vector<uint8_t> duid(10, 0);
+    duid[1] = DUID::DUID_LL;
+    duid[3] = HTYPE_ETHER;
+    duid[4] = 0x02;
+    duid[6] = static_cast<uint8_t>((subnet >> 8) & 0xff);
+    duid[7] = static_cast<uint8_t>(subnet & 0xff);
+    duid[9] = static_cast<uint8_t>(client);
+    return (duid);
+}
+
+/// @brief Creates a DHCPv6 server configuration.
+///
+/// The subnets are grouped in the shared networks. Each subnet has a pool,
+/// a few options and a few host reservations, one of them for the first
+/// client of the subnet. The client classes are selected by the user
+/// class and vendor class options sent by some clients.
+///
+/// @param subnets Number of subnets.
+std::string
+createConfig(const int subnets) {
+    std::ostringstream s;
+    s << "{ \"interfaces-config\": { \"interfaces\": [ \"eth0\" ],"
+      << " \"re-detect\": false },"
+      << " \"preferred-lifetime\": 3000, \"valid-lifetime\": 4000,"
+      << " \"renew-timer\": 1000, \"rebind-timer\": 2000,"
+      << " \"lease-database\": { \"type\": \"memfile\", \"persist\": false },"
+      << " \"client-classes\": ["
+      << " { \"name\": \"voip\","
+      << " \"test\": \"substring(option[15].hex,2,4) == 'VOIP'\","
+      << " \"option-data\": [ { \"name\": \"sip-server-addr\","
+      << " \"data\": \"2001:db8::10\" } ] },"
+      << " { \"name\": \"cable\", \"test\": \"option[16].exists\","
+      << " \"option-data\": [ { \"name\": \"domain-search\","
+      << " \"data\": \"cable.example.org\" } ] },"
+      << " { \"name\": \"other\", \"test\": \"not member('voip') and"
+      << " not member('cable')\" } ],"
+      << " \"shared-networks\": [";
+    for (int i = 0; i < subnets; ++i) {
+        if (i % SUBNETS_PER_NETWORK == 0) {
+            s << (i > 0 ? " ] }," : "") << "\n { \"name\": \"network-"
+              << (i / SUBNETS_PER_NETWORK) << "\", \"subnet6\": [";
+        } else {
+            s << ",";
+        }
+        s << "\n  { \"id\": " << (i + 1) << ","
+          << " \"subnet\": \"" << getAddress(i, 0) << "/64\","
+          << " \"pools\": [ { \"pool\": \"" << getAddress(i, 0x1000) << " - "
+          << getAddress(i, 0xffff) << "\" } ],"
+          << " \"option-data\": ["
+          << " { \"name\": \"dns-servers\","
+          << " \"data\": \"2001:db8::1, 2001:db8::2\" } ],"
+          << " \"reservations\": ["
+          << " { \"duid\": \"" << DUID(getClientDuid(i, 0)).toText()
+          << "\", \"ip-addresses\": [ \"" << getClientAddress(i, 0) << "\" ],"
+          << " \"hostname\": \"host-" << i << "\" }";
+        for (int j = 1; j < 4; ++j) {
+            s << ", { \"hw-address\": \"1a:1b:1c:" << std::hex
+              << ((i >> 8) & 0xff) << ":" << (i & 0xff) << ":" << j << std::dec
+              << "\", \"ip-addresses\": [ \"" << getAddress(i, 0x100 + j)
+              << "\" ] }";
+        }
+        s << " ] }";
+    }
+    s << (subnets > 0 ? " ] }" : "") << " ] }";
+    return (s.str());
+}
+
+/// @brief Query sent by the client.
+struct Query {
+    /// @brief Query in the wire format.
+    std::vector<uint8_t> data_;
+
+    /// @brief Address of the relay forwarding the query.
+    IOAddress relay_;
+};
+
+/// @brief Packet filter injecting the queries into the server.
+///
+/// The sockets are opened on /dev/null, so the server always finds a
+/// socket ready to read and calls @c receive, which returns the query
+/// set with @c setQuery. The responses are counted and discarded.
+class PktFilter6Benchmark : public PktFilter6TestStub {
+public:
+
+    /// @brief Constructor.
+    PktFilter6Benchmark()
+        : query_(0), sent_(0), pkt_pool_() {
+    }
+
+    /// @brief Sets the query returned by the next call to @c receive.
+    ///
+    /// @param query Query to be received by the server. It must be valid
+    /// until it is received.
+    void setQuery(const Query& query) {
+        query_ = &query;
+    }
+
+    /// @brief Returns the number of responses sent by the server.
+    uint64_t getSent() const {
+        return (sent_);
+    }
+
+    /// @brief Opens /dev/null in place of the socket.
+    ///
+    /// @param addr Address to which the socket is bound.
+    /// @param port Port to which the socket is bound.
+    ///
+    /// @return Structure describing the opened descriptor.
+    virtual SocketInfo openSocket(const Iface&, const IOAddress& addr,
+                                  const uint16_t port, const bool) {
+        int fd = open("/dev/null", O_RDONLY);
+        if (fd < 0) {
+            const char* errmsg = strerror(errno);
+            isc_throw(Unexpected, "PktFilter6Benchmark: cannot open"
+                      " /dev/null:" << errmsg);
+        }
+        return (SocketInfo(addr, port, fd));
+    }
+
+    /// @brief Creates the packet from the query.
+    ///
+    /// The packet is created from the pool as in the @c PktFilterInet6.
+    /// The queries are received on eth0.
+    ///
+    /// @param socket_info Socket on which the query is received.
+    ///
+    /// @return Received packet or null if no query was set.
+    virtual Pkt6Ptr receive(const SocketInfo& socket_info) {
+        if (!query_) {
+            return (Pkt6Ptr());
+        }
+        IfacePtr iface = IfaceMgr::instance().getIface("eth0");
+        if (!iface) {
+            isc_throw(Unexpected, "PktFilter6Benchmark: no eth0 interface");
+        }
+        Pkt6Ptr pkt = pkt_pool_.create(&query_->data_[0],
+                                       query_->data_.size());
+        pkt->updateTimestamp();
+        pkt->setLocalAddr(socket_info.addr_);
+        pkt->setLocalPort(socket_info.port_);
+        pkt->setRemoteAddr(query_->relay_);
+        pkt->setRemotePort(DHCP6_SERVER_PORT);
+        pkt->setIndex(iface->getIndex());
+        pkt->setIface(iface->getName());
+        query_ = 0;
+        return (pkt);
+    }
+
+    /// @brief Counts the response.
+    ///
+    /// @return 0.
+    virtual int send(const Iface&, uint16_t, const Pkt6Ptr&) {
+        ++sent_;
+        return (0);
+    }
+
+private:
+
+    /// @brief Query returned by the next call to @c receive.
+    const Query* query_;
+
+    /// @brief Number of responses sent by the server.
+    uint64_t sent_;
+
+    /// @brief Pool of the received packets.
+    PktPool<Pkt6> pkt_pool_;
+};
+
+/// @brief Pointer to the packet filter injecting the queries.
+typedef boost::shared_ptr<PktFilter6Benchmark> PktFilter6BenchmarkPtr;
+
+/// @brief Fixture class benchmarking the DHCPv6 server.
+///
+/// The server is configured with the number of subnets given by the
+/// benchmark argument and receives the queries from fake interfaces,
+/// through the same code path as the queries received from the network.
+/// The leases are stored in the memfile backend which doesn't persist
+/// them, so the benchmarks don't need root privileges, network access
+/// or a database.
+class Dhcpv6SrvBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Configures the server.
+    ///
+    /// @param state Benchmark state, the first argument is the number
+    /// of subnets.
+    void SetUp(::benchmark::State const& state) override {
+        const int subnets = static_cast<int>(state.range(0));
+        iface_config_.reset(new IfaceMgrTestConfig(true));
+        filter_.reset(new PktFilter6Benchmark());
+        IfaceMgr::instance().setPacketFilter(filter_);
+
+        srv_.reset(new Dhcpv6Srv(0));
+        CfgMgr::instance().clear();
+        ConstElementPtr answer =
+            configureDhcp6Server(*srv_, Element::fromJSON(createConfig(subnets)));
+        int rcode = 0;
+        ConstElementPtr comment = config::parseAnswer(rcode, answer);
+        if (rcode != 0) {
+            isc_throw(Unexpected, "failed to configure the server: "
+                      << comment->str());
+        }
+        CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
+        cfg_db->setAppendedParameters("universe=6");
+        cfg_db->createManagers();
+        CfgMgr::instance().commit();
+        CfgMgr::instance().getCurrentCfg()->getCfgIface()->
+            openSockets(AF_INET6, DHCP6_SERVER_PORT);
+    }
+
+    /// @brief Destroys the server and restores the interfaces.
+    void TearDown(::benchmark::State const&) override {
+        queries_.clear();
+        srv_.reset();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        stats::StatsMgr::instance().removeAll();
+        filter_.reset();
+        iface_config_.reset();
+    }
+
+    /// @brief Creates the queries of all clients.
+    ///
+    /// The queries are relayed and carry a single IA_NA. Every third
+    /// client sends the user class or vendor class option selecting one
+    /// of the client classes. The requests carry the server identifier
+    /// and the requested address.
+    ///
+    /// @param subnets Number of subnets.
+    /// @param type Message type, DHCPV6_SOLICIT or DHCPV6_REQUEST.
+    void createQueries(const int subnets, const uint8_t type) {
+        queries_.clear();
+        for (int i = 0; i < subnets; ++i) {
+            for (int j = 0; j < CLIENTS_PER_SUBNET; ++j) {
+                Pkt6Ptr query(new Pkt6(type, i * CLIENTS_PER_SUBNET + j));
+                query->addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                                      getClientDuid(i, j))));
+
+                Option6IAPtr ia(new Option6IA(D6O_IA_NA, IAID));
+                if (type == DHCPV6_REQUEST) {
+                    ia->addOption(OptionPtr(new Option6IAAddr(D6O_IAADDR,
+                                                              IOAddress(getClientAddress(i, j)),
+                                                              3000, 4000)));
+                    query->addOption(srv_->getServerID());
+                }
+                query->addOption(ia);
+
+                OptionUint16ArrayPtr oro(new OptionUint16Array(Option::V6,
+                                                               D6O_ORO));
+                oro->addValue(D6O_NAME_SERVERS);
+                oro->addValue(D6O_DOMAIN_SEARCH);
+                query->addOption(oro);
+
+                if (j % 3 == 1) {
+                    const uint8_t user_class[] = { 0, 4, 'V', 'O', 'I', 'P' };
+                    query->addOption(OptionPtr(new Option(Option::V6, D6O_USER_CLASS,
+                                                          OptionBuffer(user_class,
+                                                                       user_class + sizeof(user_class)))));
+                } else if (j % 3 == 2) {
+                    const uint8_t vendor_class[] = { 0, 0, 0x11, 0x8b,
+                                                     0, 5, 'c', 'a', 'b', 'l', 'e' };
+                    query->addOption(OptionPtr(new Option(Option::V6, D6O_VENDOR_CLASS,
+                                                          OptionBuffer(vendor_class,
+                                                                       vendor_class + sizeof(vendor_class)))));
+                }
+
+                Pkt6::RelayInfo relay;
+                relay.msg_type_ = DHCPV6_RELAY_FORW;
+                relay.hop_count_ = 0;
+                relay.linkaddr_ = IOAddress(getAddress(i, 1));
+                relay.peeraddr_ = IOAddress("fe80::1");
+                query->addRelayInfo(relay);
+
+                query->pack();
+                const util::OutputBuffer& buf = query->getBuffer();
+                const uint8_t* data = static_cast<const uint8_t*>(buf.getData());
+                Query q = { std::vector<uint8_t>(data, data + buf.getLength()),
+                            relay.linkaddr_ };
+                queries_.push_back(q);
+            }
+        }
+    }
+
+    /// @brief Benchmarks the processing of the queries.
+    ///
+    /// The clients send their queries in turns. Each iteration processes
+    /// a single query, so the items per second are the packets processed
+    /// per second. The number of memory allocations per packet is
+    /// reported in the allocs/pkt counter.
+    ///
+    /// @param state Benchmark state.
+    /// @param type Message type, DHCPV6_SOLICIT or DHCPV6_REQUEST.
+    void benchQueries(::benchmark::State& state, const uint8_t type) {
+        createQueries(static_cast<int>(state.range(0)), type);
+        size_t next = 0;
+        const uint64_t allocations_before = allocations;
+        while (state.KeepRunning()) {
+            filter_->setQuery(queries_[next]);
+            srv_->run_one();
+            if (++next == queries_.size()) {
+                next = 0;
+            }
+        }
+        const uint64_t allocations_done = allocations - allocations_before;
+        if (filter_->getSent() == 0) {
+            state.SkipWithError("the server sent no responses");
+            return;
+        }
+        state.SetItemsProcessed(state.iterations());
+        state.counters["allocs/pkt"] =
+            static_cast<double>(allocations_done) / state.iterations();
+    }
+
+protected:
+
+    /// @brief Fake interfaces.
+    boost::scoped_ptr<IfaceMgrTestConfig> iface_config_;
+
+    /// @brief Packet filter injecting the queries.
+    PktFilter6BenchmarkPtr filter_;
+
+    /// @brief Benchmarked server.
+    boost::scoped_ptr<Dhcpv6Srv> srv_;
+
+    /// @brief Queries of all clients.
+    std::vector<Query> queries_;
+};
+
+}
+
+/// @brief Benchmarks the processing of the Solicit messages.
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, solicit)(::benchmark::State& state) {
+    benchQueries(state, DHCPV6_SOLICIT);
+}
+
+/// @brief Benchmarks the processing of the Request messages.
+///
+/// The first request of each client allocates the lease, the following
+/// requests extend it.
+BENCHMARK_DEFINE_F(Dhcpv6SrvBenchmark, request)(::benchmark::State& state) {
+    benchQueries(state, DHCPV6_REQUEST);
+}
+
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, solicit)->Arg(10)->Arg(1000)
+    ->Unit(::benchmark::kMicrosecond);
+BENCHMARK_REGISTER_F(Dhcpv6SrvBenchmark, request)->Arg(10)->Arg(1000)
+    ->Unit(::benchmark::kMicrosecond);
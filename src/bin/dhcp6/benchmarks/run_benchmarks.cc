@@ -0,0 +1,26 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <benchmark/benchmark.h>
+#include <log/logger_support.h>
+
+/// @brief A simple class that initializes logging.
+///
+/// The server logs each processed packet at the INFO level, so only the
+/// warnings and errors are logged by default to not measure the logging.
+/// The severity can be changed with the KEA_LOGGER_SEVERITY variable.
+class Initializer {
+public:
+    Initializer() {
+        isc::log::initLogger(isc::log::WARN, 0);
+    }
+};
+
+Initializer initializer;
+
+BENCHMARK_MAIN();
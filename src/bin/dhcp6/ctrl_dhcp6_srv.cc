@@ -18,6 +18,8 @@
 #include <dhcp6/json_config_parser.h>
 #include <dhcp6/parser_context.h>
 #include <hooks/hooks_manager.h>
+#include <hooks/server_hooks.h>
+#include <log/logger_manager.h>
 #include <stats/stats_mgr.h>
 #include <cfgrpt/config_report.h>
 #include <signal.h>
@@ -49,6 +51,24 @@ struct CtrlDhcp6Hooks {
 // module is called.
 CtrlDhcp6Hooks Hooks;
 
+/// @brief Interval of the log statistics updates in milliseconds.
+const long LOG_STATS_INTERVAL = 1000;
+
+/// @brief Interval of the parking lot expiration in milliseconds.
+const long PARKING_LOT_INTERVAL = 1000;
+
+/// @brief Default timeout of the parked packets in milliseconds.
+///
+/// It applies to the parking lots for which the hooks libraries don't
+/// set a timeout. It is longer than the timeouts of the asynchronous
+/// operations of the libraries, e.g. the lease updates sent by the High
+/// Availability library, so it only removes the packets which would
+/// otherwise be never unparked.
+const long PARKED_PACKET_TIMEOUT = 30000;
+
+/// @brief Interval of the packet pool statistics updates in milliseconds.
+const long PKT_POOL_STATS_INTERVAL = 1000;
+
 // Name of the file holding server identifier.
 static const char* SERVER_DUID_FILE = "kea-dhcp6-serverid";
 
@@ -608,7 +628,15 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
             boost::bind(&ControlledDhcpv6Srv::dbLostCallback, srv, _1);
         CfgDbAccessPtr cfg_db = CfgMgr::instance().getStagingCfg()->getCfgDbAccess();
         cfg_db->setAppendedParameters("universe=6");
-        cfg_db->createManagers();
+        // Reuse the existing lease manager and host data sources if their
+        // parameters haven't changed. The host data sources may be provided
+        // by the hooks libraries which have been reloaded, so they are only
+        // reused when no hooks libraries are configured.
+        ConstSrvConfigPtr current = CfgMgr::instance().getCurrentCfg();
+        const bool reuse_hosts =
+            CfgMgr::instance().getStagingCfg()->getHooksConfig().get().empty() &&
+            current->getHooksConfig().get().empty();
+        cfg_db->updateManagers(*current->getCfgDbAccess(), reuse_hosts);
     } catch (const std::exception& ex) {
         return (isc::config::createAnswer(1, "Unable to open database: "
                                           + std::string(ex.what())));
@@ -658,8 +686,17 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
     // guards against exceptions and invokes a callback function to
     // log warnings. Since we allow that this fails for some interfaces there
     // is no need to rollback configuration if socket fails to open on any
-    // of the interfaces.
-    CfgMgr::instance().getStagingCfg()->getCfgIface()->openSockets(AF_INET6, srv->getPort());
+    // of the interfaces. The sockets are not reopened when the interfaces
+    // configuration hasn't changed and the re-detected interfaces are the
+    // same (their sockets are closed otherwise), because reopening them
+    // drops the packets received in the meantime.
+    ConstCfgIfacePtr cfg_iface = CfgMgr::instance().getStagingCfg()->getCfgIface();
+    if (cfg_iface->equals(*CfgMgr::instance().getCurrentCfg()->getCfgIface()) &&
+        IfaceMgr::instance().hasOpenSocket(AF_INET6)) {
+        LOG_INFO(dhcp6_logger, DHCP6_CONFIG_SOCKETS_REUSED);
+    } else {
+        CfgMgr::instance().getStagingCfg()->getCfgIface()->openSockets(AF_INET6, srv->getPort());
+    }
 
     // Install the timers for handling leases reclamation.
     try {
@@ -676,6 +713,57 @@ ControlledDhcpv6Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Install the timer publishing the number of log messages dropped by
+    // the asynchronous logging outputs.
+    bool async_logging = false;
+    const LoggingInfoStorage& loggers =
+        CfgMgr::instance().getStagingCfg()->getLoggingInfo();
+    for (LoggingInfoStorage::const_iterator logger = loggers.begin();
+         logger != loggers.end(); ++logger) {
+        for (std::vector<LoggingDestination>::const_iterator dest =
+                 logger->destinations_.begin();
+             dest != logger->destinations_.end(); ++dest) {
+            async_logging = async_logging || dest->async_;
+        }
+    }
+    if (async_logging &&
+        !TimerMgr::instance()->isTimerRegistered("Dhcp6LogStatsTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp6LogStatsTimer",
+                        boost::bind(&ControlledDhcpv6Srv::updateLogStatistics),
+                        LOG_STATS_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp6LogStatsTimer");
+        updateLogStatistics();
+    }
+
+    // Install the timer publishing the counters of the pool of received
+    // packets.
+    if (!TimerMgr::instance()->isTimerRegistered("Dhcp6PktPoolStatsTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp6PktPoolStatsTimer",
+                        boost::bind(&ControlledDhcpv6Srv::updatePacketPoolStatistics),
+                        PKT_POOL_STATS_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp6PktPoolStatsTimer");
+    }
+
+    // Packets must not be parked forever, even when the hooks library
+    // doesn't set a timeout. The libraries have been loaded already, so
+    // their settings take precedence.
+    ServerHooks::getServerHooks().getParkingLotsPtr()->
+        setDefaultTimeout(PARKED_PACKET_TIMEOUT, ParkingLot::TIMEOUT_DROP);
+
+    // Install the timer removing the packets parked for longer than the
+    // parking lot timeout and publishing the parking statistics.
+    if (HooksManager::calloutsPresent(ServerHooks::getServerHooks().
+                                      getIndex("leases6_committed")) &&
+        !TimerMgr::instance()->isTimerRegistered("Dhcp6ParkingLotTimer")) {
+        TimerMgr::instance()->registerTimer("Dhcp6ParkingLotTimer",
+                        boost::bind(&ControlledDhcpv6Srv::expireParkedPackets),
+                        PARKING_LOT_INTERVAL,
+                        asiolink::IntervalTimer::REPEATING);
+        TimerMgr::instance()->setup("Dhcp6ParkingLotTimer");
+    }
+
     // Finally, we can commit runtime option definitions in libdhcp++. This is
     // exception free.
     LibDHCP::commitRuntimeOptionDefs();
@@ -772,6 +860,16 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
     CommandMgr::instance().registerCommand("version-get",
         boost::bind(&ControlledDhcpv6Srv::commandVersionGetHandler, this, _1, _2));
 
+    // Register callout timing related commands
+    CommandMgr::instance().registerCommand("callout-timing-disable",
+        boost::bind(&HooksManager::calloutTimingDisableHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("callout-timing-enable",
+        boost::bind(&HooksManager::calloutTimingEnableHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("list-callout-timings",
+        boost::bind(&HooksManager::listCalloutTimingsHandler, _1, _2));
+
     // Register statistic related commands
     CommandMgr::instance().registerCommand("statistic-get",
         boost::bind(&StatsMgr::statisticGetHandler, _1, _2));
@@ -812,6 +910,8 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
 
         // Deregister any registered commands (please keep in alphabetic order)
         CommandMgr::instance().deregisterCommand("build-report");
+        CommandMgr::instance().deregisterCommand("callout-timing-disable");
+        CommandMgr::instance().deregisterCommand("callout-timing-enable");
         CommandMgr::instance().deregisterCommand("config-get");
         CommandMgr::instance().deregisterCommand("config-set");
         CommandMgr::instance().deregisterCommand("config-reload");
@@ -821,6 +921,7 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("dhcp-enable");
         CommandMgr::instance().deregisterCommand("leases-reclaim");
         CommandMgr::instance().deregisterCommand("libreload");
+        CommandMgr::instance().deregisterCommand("list-callout-timings");
         CommandMgr::instance().deregisterCommand("shutdown");
         CommandMgr::instance().deregisterCommand("statistic-get");
         CommandMgr::instance().deregisterCommand("statistic-get-all");
@@ -867,6 +968,43 @@ ControlledDhcpv6Srv::deleteExpiredReclaimedLeases(const uint32_t secs) {
     TimerMgr::instance()->setup(CfgExpiration::FLUSH_RECLAIMED_TIMER_NAME);
 }
 
+void
+ControlledDhcpv6Srv::expireParkedPackets() {
+    ParkingLotPtr parking_lot = ServerHooks::getServerHooks().
+        getParkingLotPtr("leases6_committed");
+    const size_t expired = parking_lot->expire();
+    if (expired > 0) {
+        LOG_WARN(dhcp6_logger, DHCP6_HOOK_LEASES6_COMMITTED_PARK_TIMEOUT)
+            .arg(expired);
+        StatsMgr::instance().addValue("pkt6-park-timeouts",
+                                      static_cast<int64_t>(expired));
+        // The packets removed without calling the unpark callback are
+        // never processed, so they are dropped as received packets too.
+        if (parking_lot->getTimeoutAction() == ParkingLot::TIMEOUT_DROP) {
+            StatsMgr::instance().addValue("pkt6-receive-drop",
+                                          static_cast<int64_t>(expired));
+        }
+    }
+    StatsMgr::instance().setValue("pkt6-parked",
+                                  static_cast<int64_t>(parking_lot->size()));
+    StatsMgr::instance().setValue("pkt6-parked-max",
+        static_cast<int64_t>(parking_lot->getMaxSize()));
+}
+
+void
+ControlledDhcpv6Srv::updatePacketPoolStatistics() {
+    StatsMgr::instance().setValue("pkt6-pool-hits",
+        static_cast<int64_t>(IfaceMgr::instance().getPacketPoolHits6()));
+    StatsMgr::instance().setValue("pkt6-pool-misses",
+        static_cast<int64_t>(IfaceMgr::instance().getPacketPoolMisses6()));
+}
+
+void
+ControlledDhcpv6Srv::updateLogStatistics() {
+    StatsMgr::instance().setValue("log-messages-dropped",
+        static_cast<int64_t>(isc::log::LoggerManager::getDroppedMessages()));
+}
+
 void
 ControlledDhcpv6Srv::dbReconnect(ReconnectCtlPtr db_reconnect_ctl) {
     bool reopened = false;
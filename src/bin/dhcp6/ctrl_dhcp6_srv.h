@@ -318,6 +318,34 @@ private:
     /// deleted.
     void deleteExpiredReclaimedLeases(const uint32_t secs);
 
+    /// @brief Removes the timed out parked packets.
+    ///
+    /// Expires the packets parked after the leases6_committed hook point
+    /// for longer than the timeout set for the parking lot by the hooks
+    /// libraries, or the default timeout of 30 seconds, and updates the
+    /// "pkt6-parked", "pkt6-parked-max" and "pkt6-park-timeouts"
+    /// statistics. The expired packets which are dropped rather than
+    /// unparked are also counted in "pkt6-receive-drop". It is called
+    /// periodically by a timer installed when callouts are present for
+    /// this hook point.
+    static void expireParkedPackets();
+
+    /// @brief Publishes the counters of the pool of received packets.
+    ///
+    /// Sets the "pkt6-pool-hits" and "pkt6-pool-misses" statistics to the
+    /// number of received packets which reused a packet object from the
+    /// pool and which required a new packet object respectively. It is
+    /// called periodically by a timer.
+    static void updatePacketPoolStatistics();
+
+    /// @brief Publishes the number of dropped log messages.
+    ///
+    /// Sets the "log-messages-dropped" statistic to the number of log
+    /// messages dropped by the asynchronous logging outputs because their
+    /// queue was full. It is called periodically by a timer installed when
+    /// at least one logging output is asynchronous.
+    static void updateLogStatistics();
+
     /// @brief Attempts to reconnect the server to the DB backend managers
     ///
     /// This is a self-rescheduling function that attempts to reconnect to the
@@ -465,8 +465,8 @@ static void yy_fatal_error (yyconst char msg[]  );
 	(yy_c_buf_p) = yy_cp;
 
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 175
-#define YY_END_OF_BUFFER 176
+#define YY_NUM_RULES 178
+#define YY_END_OF_BUFFER 179
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -474,164 +474,167 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[1420] =
+static yyconst flex_int16_t yy_accept[1446] =
     {   0,
-      168,  168,    0,    0,    0,    0,    0,    0,    0,    0,
-      176,  174,   10,   11,  174,    1,  168,  165,  168,  168,
-      174,  167,  166,  174,  174,  174,  174,  174,  161,  162,
-      174,  174,  174,  163,  164,    5,    5,    5,  174,  174,
-      174,   10,   11,    0,    0,  157,    0,    0,    0,    0,
+      171,  171,    0,    0,    0,    0,    0,    0,    0,    0,
+      179,  177,   10,   11,  177,    1,  171,  168,  171,  171,
+      177,  170,  169,  177,  177,  177,  177,  177,  164,  165,
+      177,  177,  177,  166,  167,    5,    5,    5,  177,  177,
+      177,   10,   11,    0,    0,  160,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  168,
-      168,    0,  167,  168,    3,    2,    6,    0,  168,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  171,
+      171,    0,  170,  171,    3,    2,    6,    0,  171,    0,
         0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
 
-      158,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  160,    0,    0,    0,
+      161,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  163,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    2,    0,    0,    0,
-        0,    0,    0,    0,    8,    0,    0,    0,    0,  136,
-        0,    0,  137,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
+        0,    0,    0,    0,    0,    8,    0,    0,    0,    0,
+      139,    0,    0,  140,    0,    0,    0,    0,    0,    0,
 
-        0,  159,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  162,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   92,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   92,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  173,  171,
-        0,  170,  169,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  176,  174,    0,  173,  172,    0,    0,    0,    0,
 
-      135,    0,    0,   29,    0,   28,    0,    0,   98,    0,
-        0,    0,    0,    0,    0,    0,   52,    0,    0,    0,
+        0,    0,    0,  138,    0,    0,   29,    0,   28,    0,
+        0,   98,    0,    0,    0,    0,    0,    0,    0,    0,
+       52,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   96,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   96,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  172,  169,    0,    0,
 
-        0,    0,    0,    0,    0,    0,   30,    0,    0,   32,
-        0,    0,    0,    0,    0,   99,    0,    0,    0,    0,
-        0,   77,    0,    0,    0,    0,    0,    0,  120,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   55,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  175,  172,    0,    0,    0,    0,    0,    0,    0,
+        0,   30,    0,    0,   32,    0,    0,    0,    0,    0,
+        0,   99,    0,    0,    0,    0,    0,   77,    0,    0,
+        0,    0,    0,    0,  123,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   55,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       76,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   86,    0,   56,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   76,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       86,    0,   56,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,  115,  140,   48,    0,   53,    0,    0,
-        0,    0,    0,    0,  154,   38,    0,   35,    0,   34,
-        0,    0,    0,  128,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,  107,    0,    0,    0,    0,    0,    0,    0,
-      139,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   50,    0,    0,   33,
+        0,  118,  143,   48,    0,   53,    0,    0,    0,    0,
+        0,    0,  157,   38,    0,   35,    0,   34,    0,    0,
+        0,  131,  110,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  107,    0,    0,    0,    0,    0,    0,    0,  142,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   50,    0,    0,   33,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,   79,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  129,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,  124,    0,    0,    0,    0,    0,
-        0,    7,   36,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  132,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,  127,    0,    0,    0,    0,
+        0,    0,    7,   36,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  109,    0,
-        0,    0,    0,    0,    0,  106,    0,    0,    0,    0,
-        0,    0,    0,    0,   81,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  109,
+        0,    0,    0,    0,    0,    0,  106,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   81,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   89,    0,    0,
 
-        0,    0,    0,    0,    0,    0,  103,    0,    0,    0,
-        0,    0,   88,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  123,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  133,  104,    0,    0,    0,    0,
-      108,   49,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   57,    0,    0,    0,    0,    0,    0,    0,
+       89,    0,    0,    0,    0,    0,    0,    0,    0,  103,
+        0,    0,    0,    0,    0,   88,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,  126,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,  136,  104,    0,
+        0,    0,    0,  108,   49,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   57,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       72,    0,    0,    0,    0,    0,    0,  155,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   95,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  122,    0,    0,    0,    0,    0,    0,
-       60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   54,   80,    0,
-        0,    0,  119,    0,    0,    0,   47,    0,    0,    0,
+
+        0,    0,    0,    0,    0,   72,    0,    0,    0,    0,
+        0,    0,  158,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   95,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,  125,    0,
+        0,    0,    0,    0,    0,   60,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  111,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   54,   80,    0,    0,    0,  122,    0,
+        0,    0,    0,   47,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,  153,    0,    0,    0,    0,
+      114,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   90,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  156,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   90,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   41,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
+      137,   14,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      128,  113,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,  124,  141,    0,
+       40,    0,  133,    0,    0,    0,    0,    0,    0,    0,
+        0,   20,    0,    0,    0,   74,    0,    0,    0,    0,
+        0,  135,   51,    0,   82,    0,  111,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   41,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   16,
-        0,  134,   14,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,  125,  110,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  121,  138,
-        0,   40,    0,  130,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   78,    0,    0,    0,    0,    0,    0,
+        0,    0,  130,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,  100,
+        0,    0,    0,    0,    0,   75,   97,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   69,
+        0,    0,    0,    0,    0,    0,   17,   15,    0,  155,
+      154,    0,   64,    0,    0,    0,    0,    0,   31,    0,
+      117,    0,    0,    0,    0,    0,    0,  152,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   91,
+        0,  121,   43,    0,   58,    0,    0,    0,    0,   19,
+        0,    0,    0,    0,    0,    0,    0,   93,   70,    0,
+        0,  129,    0,    0,    0,    0,    0,  120,    0,    0,
+        0,    0,   87,    0,  159,    0,    0,    0,    0,    0,
+        0,    0,   85,    0,  144,    0,    0,    0,    0,    0,
 
-        0,    0,   20,    0,    0,    0,   74,    0,    0,    0,
-        0,  132,   51,    0,   82,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   78,    0,    0,    0,    0,    0,    0,    0,
-        0,  127,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  100,    0,
-        0,    0,    0,    0,   75,   97,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   69,    0,    0,
-        0,    0,    0,    0,   17,   15,    0,  152,  151,    0,
-
-       64,    0,    0,    0,    0,    0,   31,    0,  114,    0,
-        0,    0,    0,    0,    0,  149,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   91,    0,  118,
-       43,    0,   58,    0,    0,    0,    0,   19,    0,    0,
-        0,    0,    0,    0,   93,   70,    0,    0,  126,    0,
-        0,    0,    0,    0,  117,    0,    0,    0,    0,   87,
-        0,  156,    0,    0,    0,    0,    0,    0,    0,   85,
-        0,  141,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   42,    0,   63,    0,    0,    0,
+        0,  115,    0,   65,  153,    0,   12,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   45,    0,    0,   44,
+       18,    0,    0,    0,    0,  105,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       68,    0,    0,   59,    0,   83,    0,    0,    0,    0,
+        0,  134,    0,    0,    0,   46,    0,    0,    0,    0,
+        0,  112,    0,    0,    0,    0,    0,    0,    0,    0,
+
+       62,    0,    0,   73,    0,   37,    0,    0,    0,    0,
+        0,   25,    0,    0,    0,    0,    0,    0,  150,    0,
+      119,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       94,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       26,   39,    0,    0,    0,    0,    0,   13,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-       42,    0,   63,    0,    0,    0,    0,  112,    0,   65,
-      150,    0,   12,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   45,    0,    0,   44,   18,    0,    0,    0,
-        0,  105,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,   68,    0,    0,   59,    0,
-       83,    0,    0,    0,    0,    0,  131,    0,    0,    0,
-       46,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   62,    0,    0,   73,    0,   37,
-        0,    0,    0,    0,    0,   25,    0,    0,    0,    0,
-        0,    0,  147,    0,  116,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,   94,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   26,   39,    0,    0,    0,    0,
-        0,   13,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  146,    0,    0,   22,
-       67,    0,    0,    0,    0,    0,    0,   21,    0,   84,
-        0,    0,  145,    0,    0,   66,    0,    0,   61,    0,
-       24,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  149,    0,    0,   22,   67,    0,    0,    0,
+        0,    0,    0,   21,    0,   84,    0,    0,  148,    0,
+        0,   66,    0,    0,   61,    0,   24,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   23,    0,
-      101,  113,    0,    0,    0,    0,    0,    0,  143,  148,
 
-       71,    0,    0,    0,    0,  142,    0,    0,   27,    0,
-        0,    0,    0,    0,  102,    0,    0,  144,    0
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   23,    0,  101,  116,    0,    0,
+        0,    0,    0,    0,  146,  151,   71,    0,    0,    0,
+        0,  145,    0,    0,   27,    0,    0,    0,    0,    0,
+      102,    0,    0,  147,    0
     } ;
 
 static yyconst flex_int32_t yy_ec[256] =
@@ -678,347 +681,351 @@ static yyconst flex_int32_t yy_meta[72] =
         3
     } ;
 
-static yyconst flex_int16_t yy_base[1432] =
+static yyconst flex_int16_t yy_base[1458] =
     {   0,
         0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1784, 1785,   32, 1780,  141,    0,  201, 1785,  206,   88,
-       11,  213, 1785, 1762,  114,   25,    2,    6, 1785, 1785,
-       73,   11,   17, 1785, 1785, 1785,  104, 1768, 1723,    0,
-     1760,  107, 1775,  217,  241, 1785,  185, 1719, 1725, 1745,
+     1810, 1811,   32, 1806,  141,    0,  201, 1811,  206,   88,
+       11,  213, 1811, 1788,  114,   25,    2,    6, 1811, 1811,
+       73,   11,   17, 1811, 1811, 1811,  104, 1794, 1749,    0,
+     1786,  107, 1801,  217,  241, 1811,  185, 1745, 1751, 1771,
        93,   58,  190,   91,  211,  200,   14,  267,  213,  175,
-      269,   64,  231, 1726,  187,   75, 1725,  274,  188,  290,
-      278,  297, 1708,  195,  302,  316,  316, 1727,    0,  355,
-      360,  372,  377,  380, 1785,    0, 1785,  267,  295,  296,
-      327,  283,  361,  368,  293, 1785, 1724, 1763, 1785,  359,
-
-     1785,  393,  341, 1711, 1721, 1760,  369,  220,  249, 1715,
-      364,  372,  373,  380,  385, 1758,    0,  444,  375, 1702,
-     1710,  364, 1706, 1695, 1696,  372, 1712, 1695, 1704,  399,
-      200,  371, 1698,  389, 1686, 1742,  416, 1689, 1740, 1682,
-     1705, 1702, 1702, 1696,  369, 1689, 1682, 1687, 1681,  409,
-     1692, 1685, 1676, 1675, 1689,  387, 1725, 1674,  414, 1686,
-     1689, 1673,  441, 1674,  416, 1686, 1683, 1684, 1682,  394,
-     1664, 1669, 1665, 1657, 1674, 1666,    0,  421,  385,  436,
-      437,  449,  454, 1665, 1785,    0,  461, 1656, 1659, 1785,
-      446,  464, 1785, 1711, 1666,  470, 1709,  472, 1708,  476,
-
-     1707, 1785,  520, 1706,  486, 1667, 1662, 1661, 1652,  291,
-     1701, 1695, 1661, 1640, 1648, 1654, 1642, 1656, 1652, 1653,
-     1653, 1648, 1640, 1642, 1626, 1630, 1643, 1643, 1635, 1625,
-     1628, 1642, 1785, 1628, 1636, 1639, 1620, 1619, 1669, 1618,
-     1628, 1666,  452, 1627, 1615, 1626, 1662,  484, 1666, 1603,
-     1618,    9, 1608, 1624, 1605, 1607, 1603, 1609, 1600, 1599,
-     1612, 1605, 1607, 1611, 1610, 1604,   80, 1611, 1606, 1598,
-     1588, 1603, 1598, 1602, 1583, 1599, 1585, 1591, 1598, 1586,
-      504, 1579, 1593, 1592, 1595, 1577, 1585,  491, 1785, 1785,
-      499, 1785, 1785, 1572,    0,  472, 1574,  507,  500, 1628,
-
-     1785, 1581,  493, 1785, 1626, 1785, 1620,  556, 1785,  488,
-     1562, 1572, 1622, 1579, 1578,  468, 1785, 1576, 1618, 1573,
-     1570, 1571,  303, 1575, 1613, 1563, 1558, 1555, 1551, 1553,
-     1602, 1561, 1550, 1599, 1547,  549, 1560, 1560, 1543, 1544,
-     1557, 1544, 1554, 1549, 1556, 1551, 1536,  477, 1545, 1548,
-     1543, 1539, 1587,  500,  524, 1785, 1581, 1533, 1532, 1525,
-     1527, 1531, 1520, 1527, 1532,  513, 1577, 1532,  510, 1529,
-     1533, 1531, 1520, 1520, 1532,  526, 1507, 1508, 1529,  536,
-     1511, 1508, 1522, 1521, 1507, 1519, 1518, 1517, 1516,  206,
-     1557, 1556, 1555, 1499,  580, 1512, 1785, 1785, 1511,    0,
-
-      527, 1499, 1550, 1549, 1507, 1547, 1785, 1495, 1545, 1785,
-      560,  606,  561, 1544, 1486, 1785, 1491, 1501, 1500, 1487,
-     1486, 1785, 1488, 1485, 1497, 1493, 1481, 1483, 1785, 1489,
-     1474, 1476, 1487, 1485, 1480,  587, 1487, 1469, 1518, 1785,
-     1467, 1483, 1515, 1519, 1477, 1471, 1473, 1474, 1476, 1508,
-     1461, 1456, 1455, 1457, 1450, 1465, 1443, 1450, 1455, 1503,
-     1785, 1450, 1446, 1500, 1453, 1447, 1454, 1439, 1449, 1452,
-     1441, 1440, 1435, 1785, 1490, 1785, 1434, 1433, 1426, 1443,
-     1480, 1427, 1432, 1441, 1435, 1429, 1438,  588, 1473, 1437,
-     1420, 1420, 1415, 1411, 1417, 1416, 1424, 1428, 1411, 1467,
-
-     1409, 1423, 1412, 1785, 1785, 1785, 1412, 1785, 1422, 1456,
-     1418,    0, 1459, 1409, 1785, 1785, 1406, 1785, 1412, 1785,
-      566,  574,  602, 1785, 1450, 1397, 1396, 1395, 1402, 1395,
-     1407, 1406, 1390, 1405, 1435, 1402, 1438, 1384, 1386, 1398,
-     1398, 1397, 1785, 1382, 1379, 1393, 1385, 1391, 1382, 1390,
-     1785, 1375, 1386, 1390, 1372, 1386,  504, 1368, 1362, 1367,
-     1364, 1379, 1380, 1377, 1418, 1375, 1785, 1361, 1363, 1785,
-     1371, 1408, 1407,  567, 1370, 1353, 1354, 1359, 1350, 1785,
-     1364, 1350,  627, 1342, 1363, 1360, 1352, 1395, 1349, 1356,
-     1392, 1785, 1340, 1338, 1352, 1336, 1350, 1353, 1385, 1384,
-
-     1383, 1330, 1381, 1380, 1785,  547, 1342, 1342, 1340, 1329,
-     1331, 1785, 1785, 1374, 1322, 1377,  574,  591,  563, 1336,
-     1375, 1369, 1368, 1367, 1321, 1311, 1364, 1326, 1316, 1361,
-     1324, 1306, 1314, 1316, 1320, 1355, 1359, 1316, 1315, 1316,
-     1309, 1298, 1311, 1314, 1309, 1304, 1309, 1306, 1305, 1301,
-     1307, 1302, 1343, 1342, 1286, 1282,  585, 1339, 1785, 1338,
-     1287, 1279, 1330, 1293, 1280, 1785, 1280, 1289, 1288, 1288,
-     1272, 1327, 1270, 1283, 1785, 1275, 1267, 1276, 1269, 1280,
-     1257, 1261, 1312, 1276, 1258, 1256, 1267, 1307, 1306, 1305,
-     1252, 1268,  300,  582, 1245, 1255,  555, 1785, 1305, 1251,
-
-     1261, 1261, 1250, 1254, 1261, 1298, 1785, 1292,  580, 1245,
-     1253, 1245, 1785, 1236, 1239, 1235, 1252, 1247, 1235, 1246,
-     1230, 1232, 1284, 1230, 1244, 1225, 1275,    4, 1785,   78,
-       79,  186,  322,  384,  638,  450,  466,  504,  526,  514,
-      590,  578,  573,  584, 1785, 1785,  600,  599,  604,  599,
-     1785, 1785,  613,  600,  598,  616,  603,  603,  652,  604,
-      660,  661, 1785,  608,  622,  622,  665,  615,  617,  611,
-      670,  625,  615,  616,  612,  622,  626,  637,  621,  639,
-      634,  636,  629,  631,  643,  633,  686,  645,  650,  627,
-     1785,  652,  642,  687,  636,  651,  651, 1785,  671,  679,
-
-      659,  649,  663,  656,  651,  652,  648,  657,  652,  703,
-      709,  658, 1785,  670,  655,  671,  661,  673,  667,  712,
-      680,  664,  665, 1785,  682,  685,  669,  671,  727,  672,
-     1785,  689,  692,  672,  691,  729,  689,  685,  680,  698,
-      697,  683,  698,  690,  686,  704,  689, 1785, 1785,  697,
-      742,  697, 1785,  705,  700,  751, 1785,  702,  707,  749,
-      703,  704,  716,  710,  714,  712,  710,  721,  764,  710,
-      766,  767,  713, 1785,  712,  720,  718,  723,  735,  719,
-      733,  734,  735,  751,  756,  730,  740,  726,  734,  739,
-      746,  787,  788,  737,  741, 1785,  736,  754,  751,  789,
-
-      740,  758,  759,  745,  753,  762,  742,  757,  764,  804,
-      805, 1785,  762,  809,  810,  763,  773,  775,  759,  760,
-      767,  776,  819,  768,  767,  784,  823,  775,  779,  777,
-      775,  828,  829,  781,  831,  827,  787, 1785,  792,  785,
-      776,  795,  789,  784,  794,  791,  796,  792,  804, 1785,
-      788, 1785, 1785,  789,  787,  806,  807,  804,  789,  811,
-      793,  798,  805,  838,  829,  801,  860,  805,  820,  812,
-      816, 1785, 1785,  826,  824,  810,  811,  869,  824,  829,
-      816,  827,  819,  825,  821,  839,  840,  841, 1785, 1785,
-      840, 1785,  842, 1785,  827,  828,  847,  838,  888,  843,
-
-      885,  851, 1785,  843,  835,  894, 1785,  895,  844,  851,
-      893, 1785, 1785,  853, 1785,  844,  844,  847,  861,  866,
-      849,  860,  907,  866,  867,  868,  906,  864,  913,  914,
-      863,  916,  917,  859,  919,  880,  864,  876,  866,  896,
-      925,  885, 1785,  927,  876,  872,  888,  893,  881,  933,
-      892, 1785,  894,  893,  895,  888,  897,  898,  895,  885,
-      888,  888,  945,  894,  947,  948,  893,  950, 1785,  888,
-      904,  897,  955,  910, 1785, 1785,  906,  916,  901,  917,
-      905,  964,  965,  911,  921,  968,  928, 1785,  920,  920,
-      922,  924,  975,  920, 1785, 1785,  922, 1785, 1785,  936,
-
-     1785,  930,  980,  931,  982,  964, 1785,  942, 1785,  929,
-      928,  931,  931,  932,  990, 1785,  935,  992,  947,  938,
-      953,  953,  956,  956,  953,  995,  959, 1785,  951, 1785,
-     1785,  961, 1785,  962,  963,  961, 1003, 1785,  954,  954,
-      960,  959,  971,  971, 1785, 1785, 1010,  959, 1785,  976,
-      961,  961,  963,  969, 1785, 1022,  975, 1024,  987, 1785,
-      984, 1785, 1003, 1023, 1029,  973, 1031, 1032,  987, 1785,
-     1034, 1785,  974, 1031,  996,  992, 1034,  984,  989,  987,
-     1044, 1002, 1046, 1047, 1010,  999,  993, 1009, 1052,  996,
-     1014,  999, 1014,  998, 1054, 1055, 1056, 1005, 1058, 1023,
-
-     1785, 1009, 1785, 1020, 1067, 1039, 1026, 1785, 1070, 1785,
-     1785, 1019, 1785, 1072, 1020, 1069, 1014, 1019, 1078, 1028,
-     1038, 1039, 1785, 1082, 1037, 1785, 1785, 1028, 1043, 1031,
-     1046, 1785, 1083, 1051, 1044, 1045, 1054, 1036, 1042, 1044,
-     1097, 1058, 1057, 1101, 1052, 1785, 1103, 1050, 1785, 1054,
-     1785, 1057, 1052, 1051, 1109, 1064, 1785, 1106, 1059, 1056,
-     1785, 1070, 1073, 1116, 1071, 1118, 1061, 1063, 1071, 1061,
-     1077, 1078, 1072, 1088, 1785, 1078, 1128, 1785, 1124, 1785,
-     1089, 1126, 1090, 1081, 1088, 1785, 1085, 1090, 1088, 1138,
-     1139, 1084, 1785, 1099, 1785, 1089, 1101, 1102, 1145, 1089,
-
-     1097, 1091, 1099, 1112, 1785, 1111, 1101, 1100, 1103, 1115,
-     1106, 1115, 1117, 1121, 1785, 1785, 1160, 1105, 1121, 1163,
-     1164, 1785, 1160, 1124, 1121, 1126, 1113, 1108, 1171, 1130,
-     1173, 1132, 1133, 1176, 1135, 1138, 1785, 1179, 1142, 1785,
-     1785, 1124, 1182, 1131, 1184, 1129, 1146, 1785, 1132, 1785,
-     1132, 1134, 1785, 1139, 1149, 1785, 1135, 1147, 1785, 1143,
-     1785, 1153, 1147, 1151, 1142, 1194, 1143, 1151, 1160, 1153,
-     1148, 1149, 1164, 1155, 1162, 1149, 1164, 1169, 1212, 1171,
-     1214, 1215, 1160, 1176, 1167, 1181, 1177, 1170, 1785, 1222,
-     1785, 1785, 1223, 1224, 1181, 1180, 1181, 1171, 1785, 1785,
-
-     1785, 1229, 1173, 1189, 1232, 1785, 1228, 1179, 1785, 1178,
-     1180, 1191, 1238, 1189, 1785, 1198, 1241, 1785, 1785, 1247,
-     1252, 1257, 1262, 1267, 1272, 1277, 1280, 1254, 1259, 1261,
-     1274
+      269,   64,  288, 1752,  187,   75, 1751,  277,  188,  238,
+      285,  293, 1734,  195,  304,  313,  323, 1753,    0,  342,
+      357,  377,  382,  362, 1811,    0, 1811,  385,  388,  223,
+      226,  247,  290,  298,  274, 1811, 1750, 1789, 1811,  354,
+
+     1811,  400,  345, 1737, 1747, 1786,  360,  308,  373, 1741,
+      347,  377,  378,  384,  392, 1784,    0,  451,  380, 1728,
+     1720, 1735,  372, 1731, 1720, 1721,  376, 1737, 1720, 1729,
+      381,  200,  375, 1723,  260, 1711, 1767,  414, 1714, 1765,
+     1707, 1730, 1727, 1727, 1721,  380, 1714, 1707, 1712, 1706,
+      387, 1717, 1710, 1701, 1700, 1714,  371, 1750, 1699,  376,
+     1711,  406, 1699,  447, 1700,  394, 1712, 1709, 1710, 1708,
+      421, 1690, 1695, 1691, 1683, 1700, 1692,    0,  422,  431,
+      423,  448,  439,  453, 1691, 1811,    0,  464, 1682, 1685,
+     1811,  449,  457, 1811, 1737, 1692,  464, 1735,  465, 1734,
+
+      458, 1733, 1811,  502, 1732,  498, 1693, 1679, 1687, 1686,
+     1677,  472, 1726, 1720, 1686, 1665, 1673, 1679, 1667, 1681,
+     1677, 1678, 1678, 1673, 1665, 1667, 1651, 1655, 1668, 1668,
+     1660, 1650, 1653, 1667, 1811, 1653, 1661, 1664, 1645, 1644,
+     1694, 1643, 1653, 1691,  468, 1652, 1640, 1651, 1687,  495,
+     1691, 1628, 1643,    9, 1633, 1649, 1630, 1632, 1628, 1634,
+     1625, 1624, 1637, 1630, 1620, 1631, 1635, 1634, 1628,   80,
+     1635, 1630, 1622, 1612, 1627, 1622, 1626, 1607, 1623, 1609,
+     1615, 1622, 1610,  525, 1603, 1617, 1616, 1619, 1601, 1609,
+      496, 1811, 1811,  497, 1811, 1811, 1596,    0,  464, 1598,
+
+      537,  509, 1652, 1811, 1605,  504, 1811, 1650, 1811, 1644,
+      552, 1811,  501, 1586, 1607, 1595, 1645, 1602, 1601,  494,
+     1811, 1599, 1641, 1596, 1593, 1594,  543, 1598, 1636, 1586,
+     1581, 1578, 1574, 1576, 1625, 1584, 1573, 1622, 1570,  553,
+     1583, 1583, 1566, 1567, 1580, 1567, 1577, 1572, 1579, 1574,
+     1559,  409, 1568, 1571, 1566, 1562, 1610,  192,  523, 1811,
+     1604, 1556, 1555, 1548,  511, 1555, 1544, 1551, 1556,  533,
+     1601, 1556,  531, 1553, 1556, 1556, 1554, 1543, 1543, 1555,
+      524, 1530, 1531, 1552,  534, 1534, 1531, 1545, 1544, 1530,
+     1542, 1541, 1540, 1539,  533, 1580, 1579, 1578, 1522,  582,
+
+     1535, 1811, 1811, 1534,    0,  529, 1522, 1573, 1572, 1530,
+     1570, 1811, 1518, 1568, 1811,  562,  608,  546, 1567, 1566,
+     1508, 1811, 1513, 1523, 1522, 1509, 1508, 1811, 1510, 1507,
+     1519, 1515, 1503, 1505, 1811, 1511, 1496, 1498, 1509, 1507,
+     1502,  596, 1509, 1491, 1540, 1811, 1489, 1505, 1537, 1541,
+     1499, 1493, 1495, 1496, 1498, 1530, 1483, 1478, 1477, 1479,
+     1472, 1487, 1465, 1472, 1477, 1525, 1811, 1472, 1468, 1522,
+     1475, 1469, 1476, 1461, 1468, 1470, 1473, 1462, 1461, 1456,
+     1811, 1511, 1811, 1455, 1454, 1447, 1464, 1501, 1500, 1447,
+     1452, 1461, 1455, 1449, 1458,  598, 1493, 1457, 1440, 1440,
+
+     1435, 1431, 1437, 1436, 1444, 1448, 1431, 1487, 1429, 1443,
+     1432, 1811, 1811, 1811, 1432, 1811, 1442, 1476, 1438,    0,
+     1479, 1429, 1811, 1811, 1426, 1811, 1432, 1811,  531,  578,
+      606, 1811, 1811, 1470, 1417, 1416, 1415, 1422, 1415, 1427,
+     1426, 1410, 1425, 1455, 1422, 1458, 1404, 1406, 1418, 1418,
+     1417, 1811, 1402, 1399, 1413, 1405, 1411, 1402, 1410, 1811,
+     1395, 1406, 1410, 1392, 1406,  524, 1388, 1382, 1387, 1384,
+     1399, 1400, 1397, 1438, 1395, 1811, 1381, 1383, 1811, 1391,
+     1428, 1427,  597, 1379, 1389, 1372, 1373, 1378, 1369, 1811,
+     1383, 1369,  614, 1361, 1366, 1381, 1378, 1370, 1413, 1367,
+
+     1374, 1410, 1811, 1358, 1356, 1370, 1354, 1368, 1371, 1403,
+     1402, 1401, 1348, 1399, 1398, 1811,  600, 1360, 1360, 1358,
+     1347, 1349, 1811, 1811, 1392, 1340, 1395,  578,  580,  574,
+     1354, 1393, 1387, 1386, 1385, 1339, 1329, 1382, 1344, 1334,
+     1379, 1342, 1324, 1332, 1334, 1338, 1373, 1377, 1334, 1333,
+     1334, 1327, 1316, 1329, 1332, 1327, 1322, 1327, 1324, 1323,
+     1319, 1325, 1320, 1361, 1360, 1304, 1300,  580, 1357, 1811,
+     1356, 1305, 1297, 1348, 1311, 1298, 1811, 1298, 1289, 1306,
+     1305, 1305, 1289, 1344, 1287, 1300, 1811, 1292, 1284, 1293,
+     1292, 1285, 1296, 1273, 1277, 1328, 1292, 1274, 1272, 1283,
+
+     1323, 1322, 1321, 1268, 1284,  585,  590, 1261, 1271,  588,
+     1811, 1321, 1267, 1277, 1277, 1266, 1270, 1277, 1314, 1811,
+     1308,  584, 1261, 1269, 1261, 1811, 1252, 1255, 1251, 1268,
+       11,   65,   79,  198,  255,  317,  305,  331,  419,  494,
+      486, 1811,  568,  580,  588,  602,  600,  652,  587,  597,
+      612,  613,  602,  659,  618,  604,  607, 1811, 1811,  623,
+      622,  627,  615, 1811, 1811,  629,  616,  614,  632,  619,
+      619,  668,  670,  621,  677,  678, 1811,  625,  639,  639,
+      682,  632,  621,  635,  629,  687,  642,  632,  633,  629,
+      639,  643,  654,  638,  656,  651,  653,  646,  648,  660,
+
+      650,  703,  662,  667,  644, 1811,  669,  659,  704,  653,
+      668,  668, 1811,  688,  696,  676,  666,  680,  673,  668,
+      669,  665,  674,  669,  720,  726,  675, 1811,  687,  672,
+      688,  678,  690,  684,  729,  697,  681,  682, 1811,  699,
+      702,  686,  688,  744,  689, 1811,  706,  709,  689,  708,
+      746,  706,  702,  697,  715,  714,  700,  715,  707,  703,
+      708,  722,  707, 1811, 1811,  715,  760,  715, 1811,  723,
+      726,  719,  770, 1811,  721,  726,  769,  722,  723,  735,
+      729,  733,  731,  729,  740,  783,  729,  785,  786,  732,
+     1811,  731,  739,  737,  742,  754,  738,  752,  753,  754,
+
+      770,  775,  749,  760,  746,  753,  758,  765,  806,  807,
+      756,  760, 1811,  755,  773,  770,  808,  759,  777,  778,
+      764,  772,  781,  761,  776,  783,  823,  824, 1811,  781,
+      828,  829,  782,  792,  794,  778,  779,  786,  795,  838,
+      787,  786,  803,  842,  794,  798,  793,  797,  795,  848,
+      849,  801,  851,  847,  853,  808, 1811,  813,  806,  797,
+      816,  810,  805,  815,  812,  817,  813,  825, 1811,  809,
+     1811, 1811,  810,  808,  827,  828,  826,  811,  832,  814,
+      819,  826,  859,  850,  822,  881,  826,  841,  833,  837,
+     1811, 1811,  847,  845,  831,  832,  890,  845,  850,  837,
+
+      848,  840,  846,  842,  860,  861,  862, 1811, 1811,  861,
+     1811,  863, 1811,  848,  849,  868,  859,  909,  864,  906,
+      872, 1811,  864,  856,  915, 1811,  916,  865,  869,  873,
+      915, 1811, 1811,  875, 1811,  866, 1811,  866,  869,  883,
+      888,  871,  882,  929,  888,  889,  890,  928,  886,  935,
+      936,  885,  938,  939,  881,  941,  902,  886,  898,  888,
+      918,  947,  907, 1811,  949,  898,  894,  910,  915,  903,
+      955,  914, 1811,  916,  915,  917,  910,  919,  920,  917,
+      907,  910,  910,  967,  916,  969,  970,  915,  972, 1811,
+      910,  926,  919,  977,  932, 1811, 1811,  928,  934,  939,
+
+      924,  942,  928,  987,  988,  934,  944,  992,  951, 1811,
+      943,  943,  945,  947,  998,  943, 1811, 1811,  945, 1811,
+     1811,  959, 1811,  953, 1003,  954, 1005,  987, 1811,  965,
+     1811,  952,  951,  954,  954,  955, 1013, 1811,  958, 1015,
+      970,  961,  976,  976,  979,  979,  976, 1018,  982, 1811,
+      974, 1811, 1811,  984, 1811,  985,  986,  984, 1026, 1811,
+      977,  977,  994,  984,  983,  995,  995, 1811, 1811, 1034,
+      983, 1811, 1000,  985,  985,  987,  993, 1811, 1046,  999,
+     1048, 1011, 1811, 1008, 1811, 1027, 1047, 1053,  997, 1055,
+     1056, 1011, 1811, 1058, 1811,  998, 1055, 1020, 1016, 1058,
+
+     1008, 1013, 1011, 1068, 1026, 1070, 1071, 1034, 1023, 1017,
+     1033, 1076, 1015, 1022, 1039, 1024, 1039, 1023, 1079, 1080,
+     1081, 1030, 1083, 1048, 1811, 1034, 1811, 1045, 1092, 1064,
+     1051, 1811, 1095, 1811, 1811, 1044, 1811, 1097, 1045, 1094,
+     1039, 1044, 1103, 1053, 1063, 1064, 1811, 1107, 1062, 1811,
+     1811, 1053, 1068, 1056, 1071, 1811, 1113, 1109, 1077, 1070,
+     1071, 1080, 1062, 1068, 1071, 1123, 1085, 1084, 1127, 1078,
+     1811, 1129, 1076, 1811, 1080, 1811, 1083, 1078, 1077, 1135,
+     1090, 1811, 1132, 1085, 1082, 1811, 1096, 1099, 1142, 1097,
+     1144, 1811, 1087, 1089, 1097, 1087, 1103, 1104, 1098, 1114,
+
+     1811, 1104, 1154, 1811, 1150, 1811, 1115, 1152, 1116, 1107,
+     1114, 1811, 1111, 1116, 1114, 1164, 1165, 1110, 1811, 1125,
+     1811, 1115, 1127, 1128, 1171, 1115, 1123, 1117, 1125, 1138,
+     1811, 1137, 1127, 1126, 1129, 1141, 1132, 1141, 1143, 1147,
+     1811, 1811, 1186, 1131, 1147, 1189, 1190, 1811, 1186, 1150,
+     1147, 1152, 1139, 1134, 1197, 1156, 1199, 1158, 1159, 1202,
+     1161, 1164, 1811, 1205, 1168, 1811, 1811, 1150, 1208, 1157,
+     1210, 1155, 1172, 1811, 1158, 1811, 1158, 1160, 1811, 1165,
+     1175, 1811, 1161, 1173, 1811, 1169, 1811, 1179, 1173, 1177,
+     1168, 1220, 1169, 1177, 1186, 1179, 1174, 1175, 1190, 1181,
+
+     1188, 1175, 1190, 1195, 1238, 1197, 1240, 1241, 1186, 1202,
+     1193, 1207, 1203, 1196, 1811, 1248, 1811, 1811, 1249, 1250,
+     1207, 1206, 1207, 1197, 1811, 1811, 1811, 1255, 1199, 1215,
+     1258, 1811, 1254, 1205, 1811, 1204, 1206, 1217, 1264, 1215,
+     1811, 1224, 1267, 1811, 1811, 1273, 1278, 1283, 1288, 1293,
+     1298, 1303, 1306, 1280, 1285, 1287, 1300
     } ;
 
-static yyconst flex_int16_t yy_def[1432] =
+static yyconst flex_int16_t yy_def[1458] =
     {   0,
-     1420, 1420, 1421, 1421, 1420, 1420, 1420, 1420, 1420, 1420,
-     1419, 1419, 1419, 1419, 1419, 1422, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1423,
-     1419, 1419, 1419, 1424,   15, 1419,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1425,   45,   45,
+     1446, 1446, 1447, 1447, 1446, 1446, 1446, 1446, 1446, 1446,
+     1445, 1445, 1445, 1445, 1445, 1448, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1449,
+     1445, 1445, 1445, 1450,   15, 1445,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1451,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1422, 1419,
-     1419, 1419, 1419, 1419, 1419, 1426, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1423, 1419, 1424,
+       45,   45,   45,   45,   45,   45,   45,   45, 1448, 1445,
+     1445, 1445, 1445, 1445, 1445, 1452, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1449, 1445, 1450,
 
-     1419, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1427,   45, 1425,   45,   45,
+     1445, 1445,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1453,   45, 1451,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1426, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1428,   45,   45,   45, 1419,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1452, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1454,   45,   45,   45,
+     1445,   45,   45, 1445,   45,   45,   45,   45,   45,   45,
 
-     1427, 1419, 1425,   45,   45,   45,   45,   45,   45,   45,
+       45, 1453, 1445, 1451,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1445,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1429,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1455,   45,   45,
 
-     1419,   45,   45, 1419,   45, 1419,   45, 1425, 1419,   45,
-       45,   45,   45,   45,   45,   45, 1419,   45,   45,   45,
+       45,   45,   45, 1445,   45,   45, 1445,   45, 1445,   45,
+     1451, 1445,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1419,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1419, 1419, 1419, 1430,
 
-       45,   45,   45,   45,   45,   45, 1419,   45,   45, 1419,
-       45, 1425,   45,   45,   45, 1419,   45,   45,   45,   45,
-       45, 1419,   45,   45,   45,   45,   45,   45, 1419,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1419,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1445, 1445, 1445, 1456,   45,   45,   45,   45,   45,
+       45, 1445,   45,   45, 1445,   45, 1451,   45,   45,   45,
+       45, 1445,   45,   45,   45,   45,   45, 1445,   45,   45,
+       45,   45,   45,   45, 1445,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1445,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1419,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1419,   45, 1419,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1445,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445,   45, 1445,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45, 1419, 1419, 1419,   45, 1419,   45,   45,
-     1419, 1431,   45,   45, 1419, 1419,   45, 1419,   45, 1419,
-       45,   45,   45, 1419,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
-     1419,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1419,   45,   45, 1419,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1419,
+       45, 1445, 1445, 1445,   45, 1445,   45,   45, 1445, 1457,
+       45,   45, 1445, 1445,   45, 1445,   45, 1445,   45,   45,
+       45, 1445, 1445,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1445,   45,   45,   45,   45,   45,   45,   45, 1445,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1445,   45,   45, 1445,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45, 1419,   45,   45,   45,   45,   45,
-       45, 1419, 1419,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1445,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45, 1445,   45,   45,   45,   45,
+       45,   45, 1445, 1445,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1419,   45,
-       45,   45,   45,   45,   45, 1419,   45,   45,   45,   45,
-       45,   45,   45,   45, 1419,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
+       45,   45,   45,   45,   45,   45, 1445,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1445,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1419,   45,   45,
 
-       45,   45,   45,   45,   45,   45, 1419,   45,   45,   45,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1419,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1419, 1419,   45,   45,   45,   45,
-     1419, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
+     1445,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
+       45,   45,   45,   45,   45, 1445,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45, 1445,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1445, 1445,   45,
+       45,   45,   45, 1445, 1445,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1445,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1419,   45,   45,   45,   45,   45,   45, 1419,   45,   45,
-
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1419,   45,   45,   45,   45,   45,   45,
-     1419,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1419, 1419,   45,
-       45,   45, 1419,   45,   45,   45, 1419,   45,   45,   45,
+
+       45,   45,   45,   45,   45, 1445,   45,   45,   45,   45,
+       45,   45, 1445,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45, 1445,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1445,   45,
+       45,   45,   45,   45,   45, 1445,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1419,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1445, 1445,   45,   45,   45, 1445,   45,
+       45,   45,   45, 1445,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1419,   45,   45,   45,   45,
+     1445,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1445,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1445,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1445,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45, 1445,   45,
+     1445, 1445,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445, 1445,   45,   45,   45,   45,   45,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45, 1445, 1445,   45,
+     1445,   45, 1445,   45,   45,   45,   45,   45,   45,   45,
+       45, 1445,   45,   45,   45, 1445,   45,   45,   45,   45,
+       45, 1445, 1445,   45, 1445,   45, 1445,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1419,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1419,
-       45, 1419, 1419,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1419, 1419,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1419, 1419,
-       45, 1419,   45, 1419,   45,   45,   45,   45,   45,   45,
+       45,   45,   45, 1445,   45,   45,   45,   45,   45,   45,
+       45,   45, 1445,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
+       45,   45,   45,   45,   45, 1445, 1445,   45,   45,   45,
+
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
+       45,   45,   45,   45,   45,   45, 1445, 1445,   45, 1445,
+     1445,   45, 1445,   45,   45,   45,   45,   45, 1445,   45,
+     1445,   45,   45,   45,   45,   45,   45, 1445,   45,   45,
+       45,   45,   45,   45,   45,   45,   45,   45,   45, 1445,
+       45, 1445, 1445,   45, 1445,   45,   45,   45,   45, 1445,
+       45,   45,   45,   45,   45,   45,   45, 1445, 1445,   45,
+       45, 1445,   45,   45,   45,   45,   45, 1445,   45,   45,
+       45,   45, 1445,   45, 1445,   45,   45,   45,   45,   45,
+       45,   45, 1445,   45, 1445,   45,   45,   45,   45,   45,
 
-       45,   45, 1419,   45,   45,   45, 1419,   45,   45,   45,
-       45, 1419, 1419,   45, 1419,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1419,   45,
-       45,   45,   45,   45, 1419, 1419,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1419,   45,   45,
-       45,   45,   45,   45, 1419, 1419,   45, 1419, 1419,   45,
-
-     1419,   45,   45,   45,   45,   45, 1419,   45, 1419,   45,
-       45,   45,   45,   45,   45, 1419,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1419,   45, 1419,
-     1419,   45, 1419,   45,   45,   45,   45, 1419,   45,   45,
-       45,   45,   45,   45, 1419, 1419,   45,   45, 1419,   45,
-       45,   45,   45,   45, 1419,   45,   45,   45,   45, 1419,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45, 1419,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1445,   45, 1445,   45,   45,   45,
+       45, 1445,   45, 1445, 1445,   45, 1445,   45,   45,   45,
+       45,   45,   45,   45,   45,   45, 1445,   45,   45, 1445,
+     1445,   45,   45,   45,   45, 1445,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445,   45,   45, 1445,   45, 1445,   45,   45,   45,   45,
+       45, 1445,   45,   45,   45, 1445,   45,   45,   45,   45,
+       45, 1445,   45,   45,   45,   45,   45,   45,   45,   45,
+
+     1445,   45,   45, 1445,   45, 1445,   45,   45,   45,   45,
+       45, 1445,   45,   45,   45,   45,   45,   45, 1445,   45,
+     1445,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+     1445, 1445,   45,   45,   45,   45,   45, 1445,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1419,   45, 1419,   45,   45,   45,   45, 1419,   45, 1419,
-     1419,   45, 1419,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1419,   45,   45, 1419, 1419,   45,   45,   45,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1419,   45,   45, 1419,   45,
-     1419,   45,   45,   45,   45,   45, 1419,   45,   45,   45,
-     1419,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1419,   45,   45, 1419,   45, 1419,
-       45,   45,   45,   45,   45, 1419,   45,   45,   45,   45,
-       45,   45, 1419,   45, 1419,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45, 1419,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1419, 1419,   45,   45,   45,   45,
-       45, 1419,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1419,   45,   45, 1419,
-     1419,   45,   45,   45,   45,   45,   45, 1419,   45, 1419,
-       45,   45, 1419,   45,   45, 1419,   45,   45, 1419,   45,
-     1419,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45, 1445,   45,   45, 1445, 1445,   45,   45,   45,
+       45,   45,   45, 1445,   45, 1445,   45,   45, 1445,   45,
+       45, 1445,   45,   45, 1445,   45, 1445,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1419,   45,
-     1419, 1419,   45,   45,   45,   45,   45,   45, 1419, 1419,
 
-     1419,   45,   45,   45,   45, 1419,   45,   45, 1419,   45,
-       45,   45,   45,   45, 1419,   45,   45, 1419,    0, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419
+       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
+       45,   45,   45,   45, 1445,   45, 1445, 1445,   45,   45,
+       45,   45,   45,   45, 1445, 1445, 1445,   45,   45,   45,
+       45, 1445,   45,   45, 1445,   45,   45,   45,   45,   45,
+     1445,   45,   45, 1445,    0, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445
     } ;
 
-static yyconst flex_int16_t yy_nxt[1857] =
+static yyconst flex_int16_t yy_nxt[1883] =
     {   0,
-     1419,   13,   14,   13, 1419,   15,   16, 1419,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   85,  359,
-       37,   14,   37,   86,   25,   26,   38, 1419, 1419,   27,
+     1445,   13,   14,   13, 1445,   15,   16, 1445,   17,   18,
+       19,   20,   21,   22,   22,   22,   23,   24,   85,  363,
+       37,   14,   37,   86,   25,   26,   38, 1445, 1445,   27,
        37,   14,   37,   42,   28,   42,   38,   91,   92,   29,
       115,   30,   13,   14,   13,   90,   91,   25,   31,   92,
-       13,   14,   13,   13,   14,   13,   32,   40,  818,   13,
-       14,   13,   33,   40,  115,   91,   92,  360,   90,   34,
+       13,   14,   13,   13,   14,   13,   32,   40,  823,   13,
+       14,   13,   33,   40,  115,   91,   92,  364,   90,   34,
        35,   13,   14,   13,   94,   15,   16,   95,   17,   18,
        19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
        13,  108,   39,   90,   25,   26,   13,   14,   13,   27,
 
        39,   84,   84,   84,   28,   42,   41,   42,   42,   29,
        42,   30,   82,  107,   41,  111,   93,   25,   31,  108,
-      130,  137,   88,  819,   88,  820,   32,   89,   89,   89,
-      131,  138,   33,  139,  375,   82,  107,  376,  111,   34,
+      131,  138,   88,  824,   88,  825,   32,   89,   89,   89,
+      132,  139,   33,  140,  380,   82,  107,  381,  111,   34,
        35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
        45,   47,   45,   48,   49,   50,   51,   45,   52,   53,
@@ -1028,106 +1035,106 @@ static yyconst flex_int16_t yy_nxt[1857] =
 
        73,   74,   75,   76,   77,   78,   57,   45,   45,   45,
        45,   45,   80,  103,   81,   81,   81,   80,  109,   83,
-       83,   83,  101,  114,   80,   82,   83,   83,   83,  121,
-       82,  145,  122,  112,  123,  146,  124,   82,  162,  103,
-      821,  103,  163,  113,  134,  223,  114,  110,   82,  135,
-      192,  107,  136,   82,  193,  147,  112,  102,  224,  502,
-       82,   45,  503,   45,   45,   45,   45,  119,   45,   45,
-       45,  113,  117,  120,  107,   45,   45,  192,   45,   45,
-       89,   89,   89,  194,   45,  132,   45,   45,   45,   45,
+       83,   83,  101,  114,   80,   82,   83,   83,   83,  122,
+       82,  146,  123,  112,  124,  147,  125,   82,  163,  103,
+      468,  103,  164,  113,  135,  225,  114,  110,   82,  136,
+      469,  179,  137,   82,  180,  148,  112,  102,  226,  826,
+       82,   45,  111,   45,   45,   45,   45,  119,   45,   45,
+       45,  113,  117,  120,  121,   45,   45,  179,   45,   45,
+      180,  149,  181,  150,   45,  151,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   45,   89,   89,
-       89,   45,  125,  426,  111,   45,  126,  427,  180,  127,
-      128,  141,  142,   45,  178,  143,  151,   45,  180,   45,
-      118,  144,  129,  148,  152,  149,  153,  150,  112,  114,
-      156,  154,  155,  157,  158,  164,  180,  315,  113,  165,
-      178,  783,  166,  316,  159,  179,  183,  160,  784,  167,
-      168,  170,  114,  171,  101,  169,  822,  172,   84,   84,
-       84,   80,  174,   81,   81,   81,  113,  175,  187,   82,
-       88,  179,   88,  173,   82,   89,   89,   89,   80,  178,
-       83,   83,   83,   84,   84,   84,  179,  191,  100,  102,
-
-      196,   82,   82,  197,   82,  100,  187,   82,  198,  200,
-      208,  199,  187,  289,  242,  181,  214,  215,  225,  209,
-      210,  233,  182,  191,   82,  197,  216,   82,  196,  204,
-      197,  823,  200,  100,  226,  243,  198,  100,  199,  289,
-      205,  100,  220,  228,  221,  196,  229,  254,  255,  100,
-      230,  264,  281,  100,  288,  100,  186,  203,  203,  203,
-      290,  222,  348,  234,  203,  203,  203,  203,  203,  203,
-      288,  258,  274,  248,  259,  260,  275,  289,  290,  299,
-      276,  296,  288,  290,  265,  266,  267,  203,  203,  203,
-      203,  203,  203,  300,  303,  268,  305,  269,  291,  270,
-
-      271,  293,  272,  292,  296,  307,  296,  299,  303,  304,
-      401,  419,  826,  349,  390,  397,  350,  303,  474,  305,
-      300,  403,  404,  397,  406,  409,  401,  827,  420,  310,
-      405,  355,  307,  308,  308,  308,  455,  456,  397,  401,
-      308,  308,  308,  308,  308,  308,  398,  406,  462,  650,
-      651,  828,  698,  409,  440,  413,  409,  478,  463,  441,
-      513,  479,  699,  308,  308,  308,  308,  308,  308,  412,
-      412,  412,  666,  829,  475,  830,  412,  412,  412,  412,
-      412,  412,  486,  491,  464,  508,  487,  492,  513,  521,
-      509,  522,  543,  592,  513,  831,  617,  544,  593,  412,
-
-      412,  412,  412,  412,  412,  442,  618,  613,  708,  667,
-      443,  789,  619,  800,  710,  709,  521,  790,  522,   45,
-       45,   45,  523,  617,  711,  832,   45,   45,   45,   45,
-       45,   45,  675,  785,  618,  833,  708,  676,  709,  749,
-      786,  800,  750,  824,  834,  835,  836,  837,  825,   45,
-       45,   45,   45,   45,   45,  838,  839,  840,  841,  842,
-      844,  845,  846,  843,  847,  848,  849,  850,  851,  852,
-      853,  854,  855,  856,  677,  857,  858,  859,  860,  861,
+       45,   45,   45,   45,   45,   45,   45,   45,  107,  181,
+      181,   45,  126,  827,  230,   45,  127,  231,  179,  128,
+      129,  232,  828,   45,  142,  143,  180,   45,  144,   45,
+      118,  107,  130,  152,  145,  112,  157,  184,  193,  158,
+      159,  153,  133,  154,  182,  113,  114,  165,  155,  156,
+      160,  166,  183,  161,  167,   84,   84,   84,  171,  101,
+      172,  168,  169,  829,  173,  193,   82,  170,   80,  114,
+       81,   81,   81,  113,  830,   84,   84,   84,  194,  175,
+      174,   82,  188,  197,  176,   88,   82,   88,  192,   82,
+       89,   89,   89,   80,  102,   83,   83,   83,   89,   89,
+
+       89,   89,   89,   89,   82,  100,   82,  195,  198,   82,
+      188,  197,  100,  199,  192,  200,  201,  188,  210,  235,
+      216,  217,  227,  197,  222,  244,  223,  211,  212,   82,
+      218,  256,  257,  260,  205,  198,  261,  262,  228,  201,
+      100,  199,  200,  224,  100,  206,  245,  293,  100,  264,
+      277,  250,  198,  265,  278,  291,  100,  267,  279,  292,
+      100,  236,  100,  187,  204,  204,  204,  292,  461,  462,
+      293,  204,  204,  204,  204,  204,  204,  293,  352,  284,
+      831,  291,  302,  291,  299,  292,  303,  310,  306,  308,
+      268,  269,  270,  295,  204,  204,  204,  204,  204,  204,
+
+      296,  271,  406,  272,  832,  273,  274,  299,  275,  294,
+      302,  306,  308,  303,  310,  311,  311,  311,  299,  306,
+      402,  402,  311,  311,  311,  311,  311,  311,  319,  353,
+      307,  406,  354,  411,  320,  395,  414,  425,  481,  406,
+      833,  313,  359,  402,  403,  311,  311,  311,  311,  311,
+      311,  408,  409,  432,  426,  414,  411,  433,  446,  475,
+      410,  628,  521,  447,  414,  417,  417,  417,  418,  661,
+      662,  476,  417,  417,  417,  417,  417,  417,  485,  521,
+      494,  499,  486,  470,  495,  500,  510,  516,  628,  511,
+      521,  529,  517,  530,  482,  417,  417,  417,  417,  417,
+
+      417,  552,  677,  603,  722,  711,  553,  531,  604,  448,
+      629,  624,  721,  834,  449,  712,  630,  815,  529,  687,
+      530,   45,   45,   45,  688,  723,  835,  722,   45,   45,
+       45,   45,   45,   45,  762,  724,  798,  763,  629,  678,
+      721,  800,  836,  799,  804,  815,  837,  838,  801,  841,
+      805,   45,   45,   45,   45,   45,   45,  839,  842,  843,
+      844,  689,  840,  845,  846,  847,  848,  849,  850,  851,
+      852,  853,  854,  855,  856,  857,  859,  860,  861,  858,
       862,  863,  864,  865,  866,  867,  868,  869,  870,  871,
-      873,  874,  875,  876,  877,  878,  879,  880,  881,  882,
-
-      883,  872,  884,  885,  886,  887,  888,  889,  890,  891,
-      892,  893,  894,  895,  896,  897,  898,  899,  900,  901,
-      902,  903,  904,  905,  906,  907,  885,  908,  909,  884,
-      910,  911,  912,  915,  916,  917,  918,  913,  919,  920,
-      921,  922,  923,  924,  925,  926,  927,  928,  929,  930,
-      932,  933,  934,  935,  936,  937,  938,  939,  940,  941,
-      931,  942,  943,  944,  945,  946,  947,  948,  949,  950,
-      951,  952,  953,  954,  955,  956,  957,  958,  959,  960,
-      961,  962,  963,  964,  966,  965,  967,  968,  914,  969,
-      970,  971,  972,  973,  974,  975,  976,  977,  978,  979,
-
-      980,  981,  982,  983,  984,  985,  986,  987,  988,  989,
-      990,  964,  965,  991,  992,  994,  996,  997,  998,  993,
-      999, 1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008,
-     1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+      872,  873,  874,  875,  876,  877,  878,  879,  880,  881,
+
+      882,  883,  884,  885,  886,  887,  888,  890,  891,  892,
+      893,  894,  895,  896,  897,  898,  899,  900,  889,  901,
+      902,  903,  904,  905,  906,  907,  908,  909,  910,  911,
+      912,  913,  914,  915,  916,  917,  918,  919,  920,  921,
+      922,  923,  924,  902,  925,  926,  901,  927,  928,  929,
+      932,  933,  934,  935,  930,  936,  937,  938,  939,  940,
+      941,  942,  943,  944,  945,  946,  947,  948,  950,  951,
+      952,  953,  954,  955,  956,  957,  958,  959,  949,  960,
+      961,  962,  963,  964,  965,  966,  967,  968,  969,  970,
+      971,  972,  973,  974,  975,  976,  977,  978,  979,  980,
+
+      981,  982,  983,  985,  984,  931,  986,  987,  988,  989,
+      990,  991,  992,  993,  994,  995,  996,  997,  998,  999,
+     1000, 1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009,
+      983,  984, 1010, 1011, 1013, 1015, 1016, 1017, 1012, 1018,
      1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028,
-     1029, 1030, 1031, 1032, 1033, 1034, 1035,  995, 1036, 1037,
-     1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047,
-     1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057,
-     1058, 1059, 1060, 1061, 1062, 1040, 1063, 1064, 1065, 1066,
-     1067, 1041, 1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075,
-
-     1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084, 1085,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1094, 1095, 1096,
-     1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105, 1106,
-     1107, 1108, 1109, 1111, 1112, 1113, 1114, 1115, 1116, 1117,
-     1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127,
-     1128, 1129, 1130, 1131, 1132, 1133, 1134, 1106, 1135, 1137,
-     1138, 1139, 1140, 1141, 1142, 1143, 1136, 1093, 1144, 1145,
-     1146, 1147, 1148, 1149, 1110, 1150, 1151, 1152, 1153, 1154,
-     1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
-     1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173, 1174,
+     1029, 1030, 1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038,
+     1039, 1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048,
+     1049, 1050, 1051, 1052, 1053, 1054, 1014, 1055, 1056, 1057,
+     1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065, 1066, 1067,
+     1068, 1069, 1070, 1071, 1072, 1073, 1074, 1075, 1076, 1077,
+
+     1078, 1079, 1080, 1081, 1082, 1083, 1061, 1084, 1085, 1086,
+     1087, 1088, 1062, 1089, 1090, 1091, 1092, 1093, 1094, 1095,
+     1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104, 1105,
+     1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1116,
+     1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126,
+     1127, 1128, 1129, 1130, 1131, 1133, 1134, 1135, 1136, 1137,
+     1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147,
+     1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155, 1156, 1128,
+     1157, 1159, 1160, 1161, 1162, 1163, 1164, 1165, 1158, 1115,
+     1166, 1167, 1168, 1169, 1170, 1171, 1132, 1172, 1173, 1174,
 
      1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183, 1184,
-     1185, 1163, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193,
-     1194, 1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203,
-     1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213,
+     1185, 1186, 1187, 1188, 1189, 1190, 1191, 1192, 1193, 1194,
+     1195, 1196, 1197, 1198, 1199, 1200, 1201, 1202, 1203, 1204,
+     1205, 1206, 1207, 1208, 1186, 1209, 1210, 1211, 1212, 1213,
      1214, 1215, 1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223,
-     1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233, 1206,
+     1224, 1225, 1226, 1227, 1228, 1229, 1230, 1231, 1232, 1233,
      1234, 1235, 1236, 1237, 1238, 1239, 1240, 1241, 1242, 1243,
-     1244, 1245, 1246, 1247, 1248, 1249, 1250, 1251, 1253, 1254,
-     1255, 1256, 1252, 1257, 1258, 1259, 1260, 1261, 1262, 1263,
+     1244, 1245, 1246, 1247, 1249, 1250, 1251, 1252, 1253, 1254,
+     1255, 1256, 1257, 1230, 1258, 1259, 1260, 1261, 1262, 1263,
      1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273,
 
-     1274, 1247, 1275, 1276, 1277, 1224, 1278, 1279, 1280, 1281,
-     1282, 1283, 1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291,
-     1292, 1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1301,
+     1274, 1275, 1276, 1278, 1279, 1280, 1281, 1277, 1282, 1283,
+     1284, 1285, 1286, 1287, 1288, 1289, 1290, 1291, 1292, 1293,
+     1294, 1295, 1296, 1297, 1298, 1299, 1272, 1300, 1301, 1248,
      1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 1311,
      1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321,
      1322, 1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331,
@@ -1140,93 +1147,96 @@ static yyconst flex_int16_t yy_nxt[1857] =
      1382, 1383, 1384, 1385, 1386, 1387, 1388, 1389, 1390, 1391,
      1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
      1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
-     1412, 1413, 1414, 1415, 1416, 1417, 1418,   12,   12,   12,
-       12,   12,   36,   36,   36,   36,   36,   79,  295,   79,
-       79,   79,   98,  400,   98,  512,   98,  100,  100,  100,
-      100,  100,  116,  116,  116,  116,  116,  177,  100,  177,
-      177,  177,  201,  201,  201,  817,  816,  815,  814,  813,
-      812,  811,  810,  809,  808,  807,  806,  805,  804,  803,
-
-      802,  801,  799,  798,  797,  796,  795,  794,  793,  792,
-      791,  788,  787,  782,  781,  780,  779,  778,  777,  776,
-      775,  774,  773,  772,  771,  770,  769,  768,  767,  766,
-      765,  764,  763,  762,  761,  760,  759,  758,  757,  756,
-      755,  754,  753,  752,  751,  748,  747,  746,  745,  744,
-      743,  742,  741,  740,  739,  738,  737,  736,  735,  734,
-      733,  732,  731,  730,  729,  728,  727,  726,  725,  724,
-      723,  722,  721,  720,  719,  718,  717,  716,  715,  714,
-      713,  712,  707,  706,  705,  704,  703,  702,  701,  700,
-      697,  696,  695,  694,  693,  692,  691,  690,  689,  688,
-
-      687,  686,  685,  684,  683,  682,  681,  680,  679,  678,
-      674,  673,  672,  671,  670,  669,  668,  665,  664,  663,
-      662,  661,  660,  659,  658,  657,  656,  655,  654,  653,
-      652,  649,  648,  647,  646,  645,  644,  643,  642,  641,
-      640,  639,  638,  637,  636,  635,  634,  633,  632,  631,
-      630,  629,  628,  627,  626,  625,  624,  623,  622,  621,
-      620,  616,  615,  614,  613,  612,  611,  610,  609,  608,
-      607,  606,  605,  604,  603,  602,  601,  600,  599,  598,
-      597,  596,  595,  594,  591,  590,  589,  588,  587,  586,
-      585,  584,  583,  582,  581,  580,  579,  578,  577,  576,
-
-      575,  574,  573,  572,  571,  570,  569,  568,  567,  566,
-      565,  564,  563,  562,  561,  560,  559,  558,  557,  556,
-      555,  554,  553,  552,  551,  550,  549,  548,  547,  546,
-      545,  542,  541,  540,  539,  538,  537,  536,  535,  534,
-      533,  532,  531,  530,  529,  528,  527,  526,  525,  524,
-      520,  519,  518,  517,  516,  515,  514,  511,  510,  507,
-      506,  505,  504,  501,  500,  499,  498,  497,  496,  495,
-      494,  493,  490,  489,  488,  485,  484,  483,  482,  481,
-      480,  477,  476,  473,  472,  471,  470,  469,  468,  467,
-      466,  465,  461,  460,  459,  458,  457,  454,  453,  452,
-
-      451,  450,  449,  448,  447,  446,  445,  444,  439,  438,
-      437,  436,  435,  434,  433,  432,  431,  430,  429,  428,
-      425,  424,  423,  422,  421,  418,  417,  416,  415,  414,
-      411,  410,  408,  407,  402,  399,  396,  395,  394,  393,
-      392,  391,  389,  388,  387,  386,  385,  384,  383,  382,
-      381,  380,  379,  378,  377,  374,  373,  372,  371,  370,
-      369,  368,  367,  366,  365,  364,  363,  362,  361,  358,
-      357,  356,  354,  353,  352,  351,  347,  346,  345,  344,
-      343,  342,  341,  340,  339,  338,  337,  336,  335,  334,
-      333,  332,  331,  330,  329,  328,  327,  326,  325,  324,
-
-      323,  322,  321,  320,  319,  318,  317,  314,  313,  312,
-      311,  309,  202,  306,  304,  302,  301,  298,  297,  294,
-      287,  286,  285,  284,  283,  282,  280,  279,  278,  277,
-      273,  263,  262,  261,  257,  256,  253,  252,  251,  250,
-      249,  247,  246,  245,  244,  241,  240,  239,  238,  237,
-      236,  235,  232,  231,  227,  219,  218,  217,  213,  212,
-      211,  207,  206,  202,  195,  190,  189,  188,  185,  184,
-      176,  161,  140,  133,  106,  105,  104,   43,   99,   97,
-       96,   87,   43, 1419,   11, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419
+     1412, 1413, 1414, 1415, 1416, 1417, 1418, 1419, 1420, 1421,
+     1422, 1423, 1424, 1425, 1426, 1427, 1428, 1429, 1430, 1431,
+     1432, 1433, 1434, 1435, 1436, 1437, 1438, 1439, 1440, 1441,
+     1442, 1443, 1444,   12,   12,   12,   12,   12,   36,   36,
+       36,   36,   36,   79,  298,   79,   79,   79,   98,  405,
+       98,  520,   98,  100,  100,  100,  100,  100,  116,  116,
+
+      116,  116,  116,  178,  100,  178,  178,  178,  202,  202,
+      202,  822,  821,  820,  819,  818,  817,  816,  814,  813,
+      812,  811,  810,  809,  808,  807,  806,  803,  802,  797,
+      796,  795,  794,  793,  792,  791,  790,  789,  788,  787,
+      786,  785,  784,  783,  782,  781,  780,  779,  778,  777,
+      776,  775,  774,  773,  772,  771,  770,  769,  768,  767,
+      766,  765,  764,  761,  760,  759,  758,  757,  756,  755,
+      754,  753,  752,  751,  750,  749,  748,  747,  746,  745,
+      744,  743,  742,  741,  740,  739,  738,  737,  736,  735,
+      734,  733,  732,  731,  730,  729,  728,  727,  726,  725,
+
+      720,  719,  718,  717,  716,  715,  714,  713,  710,  709,
+      708,  707,  706,  705,  704,  703,  702,  701,  700,  699,
+      698,  697,  696,  695,  694,  693,  692,  691,  690,  686,
+      685,  684,  683,  682,  681,  680,  679,  676,  675,  674,
+      673,  672,  671,  670,  669,  668,  667,  666,  665,  664,
+      663,  660,  659,  658,  657,  656,  655,  654,  653,  652,
+      651,  650,  649,  648,  647,  646,  645,  644,  643,  642,
+      641,  640,  639,  638,  637,  636,  635,  634,  633,  632,
+      631,  627,  626,  625,  624,  623,  622,  621,  620,  619,
+      618,  617,  616,  615,  614,  613,  612,  611,  610,  609,
+
+      608,  607,  606,  605,  602,  601,  600,  599,  598,  597,
+      596,  595,  594,  593,  592,  591,  590,  589,  588,  587,
+      586,  585,  584,  583,  582,  581,  580,  579,  578,  577,
+      576,  575,  574,  573,  572,  571,  570,  569,  568,  567,
+      566,  565,  564,  563,  562,  561,  560,  559,  558,  557,
+      556,  555,  554,  551,  550,  549,  548,  547,  546,  545,
+      544,  543,  542,  541,  540,  539,  538,  537,  536,  535,
+      534,  533,  532,  528,  527,  526,  525,  524,  523,  522,
+      519,  518,  515,  514,  513,  512,  509,  508,  507,  506,
+      505,  504,  503,  502,  501,  498,  497,  496,  493,  492,
+
+      491,  490,  489,  488,  487,  484,  483,  480,  479,  478,
+      477,  474,  473,  472,  471,  467,  466,  465,  464,  463,
+      460,  459,  458,  457,  456,  455,  454,  453,  452,  451,
+      450,  445,  444,  443,  442,  441,  440,  439,  438,  437,
+      436,  435,  434,  431,  430,  429,  428,  427,  424,  423,
+      422,  421,  420,  419,  416,  415,  413,  412,  407,  404,
+      401,  400,  399,  398,  397,  396,  394,  393,  392,  391,
+      390,  389,  388,  387,  386,  385,  384,  383,  382,  379,
+      378,  377,  376,  375,  374,  373,  372,  371,  370,  369,
+      368,  367,  366,  365,  362,  361,  360,  358,  357,  356,
+
+      355,  351,  350,  349,  348,  347,  346,  345,  344,  343,
+      342,  341,  340,  339,  338,  337,  336,  335,  334,  333,
+      332,  331,  330,  329,  328,  327,  326,  325,  324,  323,
+      322,  321,  318,  317,  316,  315,  314,  312,  203,  309,
+      307,  305,  304,  301,  300,  297,  290,  289,  288,  287,
+      286,  285,  283,  282,  281,  280,  276,  266,  263,  259,
+      258,  255,  254,  253,  252,  251,  249,  248,  247,  246,
+      243,  242,  241,  240,  239,  238,  237,  234,  233,  229,
+      221,  220,  219,  215,  214,  213,  209,  208,  207,  203,
+      196,  191,  190,  189,  186,  185,  177,  162,  141,  134,
+
+      106,  105,  104,   43,   99,   97,   96,   87,   43, 1445,
+       11, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445
     } ;
 
-static yyconst flex_int16_t yy_chk[1857] =
+static yyconst flex_int16_t yy_chk[1883] =
     {   0,
         0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  252,
+        1,    1,    1,    1,    1,    1,    1,    1,   21,  254,
         3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
         4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
        57,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  728,    8,
-        8,    8,    1,    8,   57,   27,   28,  252,   26,    1,
+        6,    6,    6,    7,    7,    7,    1,    7,  731,    8,
+        8,    8,    1,    8,   57,   27,   28,  254,   26,    1,
         1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
         2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
         9,   52,    5,   31,    2,    2,   10,   10,   10,    2,
 
         6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
        42,    2,   20,   51,   10,   54,   31,    2,    2,   52,
-       62,   66,   25,  730,   25,  731,    2,   25,   25,   25,
-       62,   66,    2,   66,  267,   20,   51,  267,   54,    2,
+       62,   66,   25,  732,   25,  733,    2,   25,   25,   25,
+       62,   66,    2,   66,  270,   20,   51,  270,   54,    2,
         2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
@@ -1238,184 +1248,187 @@ static yyconst flex_int16_t yy_chk[1857] =
        15,   15,   17,   47,   17,   17,   17,   19,   53,   19,
        19,   19,   44,   56,   22,   17,   22,   22,   22,   60,
        19,   69,   60,   55,   60,   69,   60,   22,   74,   47,
-      732,   59,   74,   55,   65,  131,   56,   53,   17,   65,
-      108,   63,   65,   19,  109,   69,   55,   44,  131,  390,
-       22,   45,  390,   45,   45,   45,   45,   59,   45,   45,
-       45,   55,   58,   59,   63,   45,   45,  108,   45,   58,
-       88,   88,   88,  109,   45,   63,   45,   45,   45,   45,
+      358,   59,   74,   55,   65,  132,   56,   53,   17,   65,
+      358,   90,   65,   19,   91,   69,   55,   44,  132,  734,
+       22,   45,   70,   45,   45,   45,   45,   59,   45,   45,
+       45,   55,   58,   59,   59,   45,   45,   90,   45,   58,
+       91,   70,   92,   70,   45,   70,   45,   45,   45,   45,
        45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
 
-       45,   45,   45,   45,   45,   45,   45,   58,   89,   89,
-       89,   58,   61,  323,   70,   58,   61,  323,   92,   61,
-       61,   68,   68,   58,   90,   68,   71,   58,   95,   58,
-       58,   68,   61,   70,   71,   70,   71,   70,   76,   77,
-       72,   71,   71,   72,   72,   75,   92,  210,   76,   75,
-       90,  693,   75,  210,   72,   91,   95,   72,  693,   75,
-       75,   76,   77,   76,  100,   75,  733,   76,   80,   80,
-       80,   81,   77,   81,   81,   81,   76,   77,  103,   80,
-       82,   91,   82,   76,   81,   82,   82,   82,   83,   93,
-       83,   83,   83,   84,   84,   84,   94,  107,  102,  100,
-
-      111,   83,   80,  112,   84,  102,  103,   81,  113,  115,
-      122,  114,  119,  179,  145,   93,  126,  126,  132,  122,
-      122,  137,   94,  107,   83,  170,  126,   84,  111,  119,
-      112,  734,  115,  102,  132,  145,  113,  102,  114,  179,
-      119,  102,  130,  134,  130,  150,  134,  156,  156,  102,
-      134,  163,  170,  102,  178,  102,  102,  118,  118,  118,
-      180,  130,  243,  137,  118,  118,  118,  118,  118,  118,
-      181,  159,  165,  150,  159,  159,  165,  182,  183,  191,
-      165,  187,  178,  180,  163,  163,  163,  118,  118,  118,
-      118,  118,  118,  192,  196,  163,  198,  163,  181,  163,
-
-      163,  183,  163,  182,  187,  200,  205,  191,  248,  281,
-      296,  316,  736,  243,  281,  288,  243,  196,  366,  198,
-      192,  298,  298,  291,  299,  303,  310,  737,  316,  205,
-      298,  248,  200,  203,  203,  203,  348,  348,  288,  296,
-      203,  203,  203,  203,  203,  203,  291,  299,  354,  557,
-      557,  738,  606,  303,  336,  310,  355,  369,  354,  336,
-      401,  369,  606,  203,  203,  203,  203,  203,  203,  308,
-      308,  308,  574,  739,  366,  740,  308,  308,  308,  308,
-      308,  308,  376,  380,  355,  395,  376,  380,  401,  411,
-      395,  411,  436,  488,  413,  741,  521,  436,  488,  308,
-
-      308,  308,  308,  308,  308,  336,  522,  523,  617,  574,
-      336,  697,  523,  709,  619,  618,  411,  697,  411,  412,
-      412,  412,  413,  521,  619,  742,  412,  412,  412,  412,
-      412,  412,  583,  694,  522,  743,  617,  583,  618,  657,
-      694,  709,  657,  735,  744,  747,  748,  749,  735,  412,
-      412,  412,  412,  412,  412,  750,  753,  754,  755,  756,
-      757,  758,  759,  756,  760,  761,  762,  764,  765,  766,
-      767,  768,  769,  770,  583,  771,  772,  773,  774,  775,
-      776,  777,  778,  779,  780,  781,  782,  783,  784,  785,
-      786,  787,  788,  789,  790,  792,  793,  794,  795,  796,
-
-      797,  785,  799,  800,  801,  802,  803,  804,  805,  806,
-      807,  808,  809,  810,  811,  812,  814,  815,  816,  817,
-      818,  819,  820,  821,  822,  823,  800,  825,  826,  799,
-      827,  828,  829,  830,  832,  833,  834,  829,  835,  836,
-      837,  838,  839,  840,  841,  842,  843,  844,  845,  846,
-      847,  850,  851,  852,  854,  855,  856,  858,  859,  860,
-      846,  861,  862,  863,  864,  865,  866,  867,  868,  869,
-      870,  871,  872,  873,  875,  876,  877,  878,  879,  880,
-      881,  882,  883,  884,  886,  885,  887,  888,  829,  889,
-      890,  891,  892,  893,  894,  895,  897,  898,  899,  900,
-
-      901,  902,  903,  904,  905,  906,  907,  908,  909,  910,
-      911,  884,  885,  913,  914,  915,  916,  917,  918,  914,
+       45,   45,   45,   45,   45,   45,   45,   58,   63,   95,
+       92,   58,   61,  735,  135,   58,   61,  135,   93,   61,
+       61,  135,  736,   58,   68,   68,   94,   58,   68,   58,
+       58,   63,   61,   71,   68,   76,   72,   95,  108,   72,
+       72,   71,   63,   71,   93,   76,   77,   75,   71,   71,
+       72,   75,   94,   72,   75,   80,   80,   80,   76,  100,
+       76,   75,   75,  737,   76,  108,   80,   75,   81,   77,
+       81,   81,   81,   76,  738,   84,   84,   84,  109,   77,
+       76,   81,  103,  111,   77,   82,   84,   82,  107,   80,
+       82,   82,   82,   83,  100,   83,   83,   83,   88,   88,
+
+       88,   89,   89,   89,   81,  102,   83,  109,  112,   84,
+      103,  111,  102,  113,  107,  114,  115,  119,  123,  138,
+      127,  127,  133,  151,  131,  146,  131,  123,  123,   83,
+      127,  157,  157,  160,  119,  112,  160,  160,  133,  115,
+      102,  113,  114,  131,  102,  119,  146,  181,  102,  162,
+      166,  151,  171,  162,  166,  179,  102,  164,  166,  180,
+      102,  138,  102,  102,  118,  118,  118,  183,  352,  352,
+      181,  118,  118,  118,  118,  118,  118,  184,  245,  171,
+      739,  182,  192,  179,  188,  180,  193,  201,  197,  199,
+      164,  164,  164,  183,  118,  118,  118,  118,  118,  118,
+
+      184,  164,  299,  164,  740,  164,  164,  188,  164,  182,
+      192,  197,  199,  193,  201,  204,  204,  204,  206,  250,
+      291,  294,  204,  204,  204,  204,  204,  204,  212,  245,
+      284,  299,  245,  302,  212,  284,  306,  320,  370,  313,
+      741,  206,  250,  291,  294,  204,  204,  204,  204,  204,
+      204,  301,  301,  327,  320,  359,  302,  327,  340,  365,
+      301,  529,  406,  340,  306,  311,  311,  311,  313,  566,
+      566,  365,  311,  311,  311,  311,  311,  311,  373,  418,
+      381,  385,  373,  359,  381,  385,  395,  400,  529,  395,
+      406,  416,  400,  416,  370,  311,  311,  311,  311,  311,
+
+      311,  442,  583,  496,  629,  617,  442,  418,  496,  340,
+      530,  531,  628,  743,  340,  617,  531,  722,  416,  593,
+      416,  417,  417,  417,  593,  630,  744,  629,  417,  417,
+      417,  417,  417,  417,  668,  630,  706,  668,  530,  583,
+      628,  707,  745,  706,  710,  722,  746,  747,  707,  749,
+      710,  417,  417,  417,  417,  417,  417,  748,  750,  751,
+      752,  593,  748,  753,  754,  755,  756,  757,  760,  761,
+      762,  763,  766,  767,  768,  769,  770,  771,  772,  769,
+      773,  774,  775,  776,  778,  779,  780,  781,  782,  783,
+      784,  785,  786,  787,  788,  789,  790,  791,  792,  793,
+
+      794,  795,  796,  797,  798,  799,  800,  801,  802,  803,
+      804,  805,  807,  808,  809,  810,  811,  812,  800,  814,
+      815,  816,  817,  818,  819,  820,  821,  822,  823,  824,
+      825,  826,  827,  829,  830,  831,  832,  833,  834,  835,
+      836,  837,  838,  815,  840,  841,  814,  842,  843,  844,
+      845,  847,  848,  849,  844,  850,  851,  852,  853,  854,
+      855,  856,  857,  858,  859,  860,  861,  862,  863,  866,
+      867,  868,  870,  871,  872,  873,  875,  876,  862,  877,
+      878,  879,  880,  881,  882,  883,  884,  885,  886,  887,
+      888,  889,  890,  892,  893,  894,  895,  896,  897,  898,
+
+      899,  900,  901,  903,  902,  844,  904,  905,  906,  907,
+      908,  909,  910,  911,  912,  914,  915,  916,  917,  918,
       919,  920,  921,  922,  923,  924,  925,  926,  927,  928,
-      929,  930,  931,  932,  933,  934,  935,  936,  937,  939,
-      940,  941,  942,  943,  944,  945,  946,  947,  948,  949,
-      951,  954,  955,  956,  957,  958,  959,  915,  960,  961,
-      962,  963,  964,  965,  966,  967,  968,  969,  970,  971,
-      974,  975,  976,  977,  978,  979,  980,  981,  982,  983,
-      984,  985,  986,  987,  988,  964,  991,  993,  995,  996,
-      997,  965,  998,  999, 1000, 1001, 1002, 1004, 1005, 1006,
-
-     1008, 1009, 1010, 1011, 1014, 1016, 1017, 1018, 1019, 1020,
-     1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 1029, 1030,
-     1031, 1032, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
-     1041, 1042, 1044, 1045, 1046, 1047, 1048, 1049, 1050, 1051,
-     1053, 1054, 1055, 1056, 1057, 1058, 1059, 1060, 1061, 1062,
-     1063, 1064, 1065, 1066, 1067, 1068, 1070, 1040, 1071, 1072,
-     1073, 1074, 1077, 1078, 1079, 1080, 1071, 1027, 1081, 1082,
-     1083, 1084, 1085, 1086, 1044, 1087, 1089, 1090, 1091, 1092,
-     1093, 1094, 1097, 1100, 1102, 1103, 1104, 1105, 1106, 1108,
-     1110, 1111, 1112, 1113, 1114, 1115, 1117, 1118, 1119, 1120,
-
-     1121, 1122, 1123, 1124, 1125, 1126, 1127, 1129, 1132, 1134,
-     1135, 1106, 1136, 1137, 1139, 1140, 1141, 1142, 1143, 1144,
-     1147, 1148, 1150, 1151, 1152, 1153, 1154, 1156, 1157, 1158,
-     1159, 1161, 1163, 1164, 1165, 1166, 1167, 1168, 1169, 1171,
-     1173, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1180, 1181,
-     1182, 1183, 1184, 1185, 1186, 1187, 1188, 1189, 1190, 1163,
-     1191, 1192, 1193, 1194, 1195, 1196, 1197, 1198, 1199, 1200,
-     1202, 1204, 1205, 1206, 1207, 1209, 1212, 1214, 1215, 1216,
-     1217, 1218, 1214, 1219, 1220, 1221, 1222, 1224, 1225, 1228,
-     1229, 1230, 1231, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
-
-     1240, 1206, 1241, 1242, 1243, 1181, 1244, 1245, 1247, 1248,
-     1250, 1252, 1253, 1254, 1255, 1256, 1258, 1259, 1260, 1262,
-     1263, 1264, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272,
-     1273, 1274, 1276, 1277, 1279, 1281, 1282, 1283, 1284, 1285,
-     1287, 1288, 1289, 1290, 1291, 1292, 1294, 1296, 1297, 1298,
-     1299, 1300, 1301, 1302, 1303, 1304, 1306, 1307, 1308, 1309,
-     1310, 1311, 1312, 1313, 1314, 1317, 1318, 1319, 1320, 1321,
-     1323, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332,
-     1333, 1334, 1335, 1336, 1338, 1339, 1342, 1343, 1344, 1345,
-     1346, 1347, 1349, 1351, 1352, 1354, 1355, 1357, 1358, 1360,
+      901,  902,  930,  931,  932,  933,  934,  935,  931,  936,
+      937,  938,  939,  940,  941,  942,  943,  944,  945,  946,
+      947,  948,  949,  950,  951,  952,  953,  954,  955,  956,
+      958,  959,  960,  961,  962,  963,  964,  965,  966,  967,
+      968,  970,  973,  974,  975,  976,  932,  977,  978,  979,
+      980,  981,  982,  983,  984,  985,  986,  987,  988,  989,
+      990,  993,  994,  995,  996,  997,  998,  999, 1000, 1001,
+
+     1002, 1003, 1004, 1005, 1006, 1007,  983, 1010, 1012, 1014,
+     1015, 1016,  984, 1017, 1018, 1019, 1020, 1021, 1023, 1024,
+     1025, 1027, 1028, 1029, 1030, 1031, 1034, 1036, 1038, 1039,
+     1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1049,
+     1050, 1051, 1052, 1053, 1054, 1055, 1056, 1057, 1058, 1059,
+     1060, 1061, 1062, 1063, 1065, 1066, 1067, 1068, 1069, 1070,
+     1071, 1072, 1074, 1075, 1076, 1077, 1078, 1079, 1080, 1081,
+     1082, 1083, 1084, 1085, 1086, 1087, 1088, 1089, 1091, 1061,
+     1092, 1093, 1094, 1095, 1098, 1099, 1100, 1101, 1092, 1048,
+     1102, 1103, 1104, 1105, 1106, 1107, 1065, 1108, 1109, 1111,
+
+     1112, 1113, 1114, 1115, 1116, 1119, 1122, 1124, 1125, 1126,
+     1127, 1128, 1130, 1132, 1133, 1134, 1135, 1136, 1137, 1139,
+     1140, 1141, 1142, 1143, 1144, 1145, 1146, 1147, 1148, 1149,
+     1151, 1154, 1156, 1157, 1128, 1158, 1159, 1161, 1162, 1163,
+     1164, 1165, 1166, 1167, 1170, 1171, 1173, 1174, 1175, 1176,
+     1177, 1179, 1180, 1181, 1182, 1184, 1186, 1187, 1188, 1189,
+     1190, 1191, 1192, 1194, 1196, 1197, 1198, 1199, 1200, 1201,
+     1202, 1203, 1203, 1204, 1205, 1206, 1207, 1208, 1209, 1210,
+     1211, 1212, 1213, 1186, 1214, 1215, 1216, 1217, 1218, 1219,
+     1220, 1221, 1222, 1223, 1224, 1226, 1228, 1229, 1230, 1231,
+
+     1233, 1236, 1238, 1239, 1240, 1241, 1242, 1238, 1243, 1244,
+     1245, 1246, 1248, 1249, 1252, 1253, 1254, 1255, 1257, 1258,
+     1259, 1260, 1261, 1262, 1263, 1264, 1230, 1265, 1266, 1204,
+     1267, 1268, 1269, 1270, 1272, 1273, 1275, 1277, 1278, 1279,
+     1280, 1281, 1283, 1284, 1285, 1287, 1288, 1289, 1290, 1291,
+     1293, 1294, 1295, 1296, 1297, 1298, 1299, 1300, 1302, 1303,
+     1305, 1307, 1308, 1309, 1310, 1311, 1313, 1314, 1315, 1316,
+     1317, 1318, 1320, 1322, 1323, 1324, 1325, 1326, 1327, 1328,
+     1329, 1330, 1332, 1333, 1334, 1335, 1336, 1337, 1338, 1339,
+     1340, 1343, 1344, 1345, 1346, 1347, 1349, 1350, 1351, 1352,
+
+     1353, 1354, 1355, 1356, 1357, 1358, 1359, 1360, 1361, 1362,
+     1364, 1365, 1368, 1369, 1370, 1371, 1372, 1373, 1375, 1377,
+     1378, 1380, 1381, 1383, 1384, 1386, 1388, 1389, 1390, 1391,
+     1392, 1393, 1394, 1395, 1396, 1397, 1398, 1399, 1400, 1401,
+     1402, 1403, 1404, 1405, 1406, 1407, 1408, 1409, 1410, 1411,
+     1412, 1413, 1414, 1416, 1419, 1420, 1421, 1422, 1423, 1424,
+     1428, 1429, 1430, 1431, 1433, 1434, 1436, 1437, 1438, 1439,
+     1440, 1442, 1443, 1446, 1446, 1446, 1446, 1446, 1447, 1447,
+     1447, 1447, 1447, 1448, 1454, 1448, 1448, 1448, 1449, 1455,
+     1449, 1456, 1449, 1450, 1450, 1450, 1450, 1450, 1451, 1451,
+
+     1451, 1451, 1451, 1452, 1457, 1452, 1452, 1452, 1453, 1453,
+     1453,  730,  729,  728,  727,  725,  724,  723,  721,  719,
+      718,  717,  716,  715,  714,  713,  712,  709,  708,  705,
+      704,  703,  702,  701,  700,  699,  698,  697,  696,  695,
+      694,  693,  692,  691,  690,  689,  688,  686,  685,  684,
+      683,  682,  681,  680,  679,  678,  676,  675,  674,  673,
+      672,  671,  669,  667,  666,  665,  664,  663,  662,  661,
+      660,  659,  658,  657,  656,  655,  654,  653,  652,  651,
+      650,  649,  648,  647,  646,  645,  644,  643,  642,  641,
+      640,  639,  638,  637,  636,  635,  634,  633,  632,  631,
 
-     1362, 1363, 1364, 1365, 1366, 1367, 1368, 1369, 1370, 1371,
-     1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381,
-     1382, 1383, 1384, 1385, 1386, 1387, 1388, 1390, 1393, 1394,
-     1395, 1396, 1397, 1398, 1402, 1403, 1404, 1405, 1407, 1408,
-     1410, 1411, 1412, 1413, 1414, 1416, 1417, 1420, 1420, 1420,
-     1420, 1420, 1421, 1421, 1421, 1421, 1421, 1422, 1428, 1422,
-     1422, 1422, 1423, 1429, 1423, 1430, 1423, 1424, 1424, 1424,
-     1424, 1424, 1425, 1425, 1425, 1425, 1425, 1426, 1431, 1426,
-     1426, 1426, 1427, 1427, 1427,  727,  726,  725,  724,  723,
-      722,  721,  720,  719,  718,  717,  716,  715,  714,  712,
-
-      711,  710,  708,  706,  705,  704,  703,  702,  701,  700,
-      699,  696,  695,  692,  691,  690,  689,  688,  687,  686,
-      685,  684,  683,  682,  681,  680,  679,  678,  677,  676,
-      674,  673,  672,  671,  670,  669,  668,  667,  665,  664,
-      663,  662,  661,  660,  658,  656,  655,  654,  653,  652,
-      651,  650,  649,  648,  647,  646,  645,  644,  643,  642,
-      641,  640,  639,  638,  637,  636,  635,  634,  633,  632,
-      631,  630,  629,  628,  627,  626,  625,  624,  623,  622,
-      621,  620,  616,  615,  614,  611,  610,  609,  608,  607,
-      604,  603,  602,  601,  600,  599,  598,  597,  596,  595,
-
-      594,  593,  591,  590,  589,  588,  587,  586,  585,  584,
-      582,  581,  579,  578,  577,  576,  575,  573,  572,  571,
-      569,  568,  566,  565,  564,  563,  562,  561,  560,  559,
-      558,  556,  555,  554,  553,  552,  550,  549,  548,  547,
-      546,  545,  544,  542,  541,  540,  539,  538,  537,  536,
-      535,  534,  533,  532,  531,  530,  529,  528,  527,  526,
-      525,  519,  517,  514,  513,  511,  510,  509,  507,  503,
-      502,  501,  500,  499,  498,  497,  496,  495,  494,  493,
-      492,  491,  490,  489,  487,  486,  485,  484,  483,  482,
-      481,  480,  479,  478,  477,  475,  473,  472,  471,  470,
-
-      469,  468,  467,  466,  465,  464,  463,  462,  460,  459,
-      458,  457,  456,  455,  454,  453,  452,  451,  450,  449,
-      448,  447,  446,  445,  444,  443,  442,  441,  439,  438,
-      437,  435,  434,  433,  432,  431,  430,  428,  427,  426,
-      425,  424,  423,  421,  420,  419,  418,  417,  415,  414,
-      409,  408,  406,  405,  404,  403,  402,  399,  396,  394,
-      393,  392,  391,  389,  388,  387,  386,  385,  384,  383,
-      382,  381,  379,  378,  377,  375,  374,  373,  372,  371,
-      370,  368,  367,  365,  364,  363,  362,  361,  360,  359,
-      358,  357,  353,  352,  351,  350,  349,  347,  346,  345,
-
-      344,  343,  342,  341,  340,  339,  338,  337,  335,  334,
-      333,  332,  331,  330,  329,  328,  327,  326,  325,  324,
-      322,  321,  320,  319,  318,  315,  314,  313,  312,  311,
-      307,  305,  302,  300,  297,  294,  287,  286,  285,  284,
-      283,  282,  280,  279,  278,  277,  276,  275,  274,  273,
-      272,  271,  270,  269,  268,  266,  265,  264,  263,  262,
-      261,  260,  259,  258,  257,  256,  255,  254,  253,  251,
-      250,  249,  247,  246,  245,  244,  242,  241,  240,  239,
-      238,  237,  236,  235,  234,  232,  231,  230,  229,  228,
-      227,  226,  225,  224,  223,  222,  221,  220,  219,  218,
-
-      217,  216,  215,  214,  213,  212,  211,  209,  208,  207,
-      206,  204,  201,  199,  197,  195,  194,  189,  188,  184,
-      176,  175,  174,  173,  172,  171,  169,  168,  167,  166,
-      164,  162,  161,  160,  158,  157,  155,  154,  153,  152,
-      151,  149,  148,  147,  146,  144,  143,  142,  141,  140,
-      139,  138,  136,  135,  133,  129,  128,  127,  125,  124,
-      123,  121,  120,  116,  110,  106,  105,  104,   98,   97,
-       78,   73,   67,   64,   50,   49,   48,   43,   41,   39,
-       38,   24,   14,   11, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419, 1419,
-     1419, 1419, 1419, 1419, 1419, 1419
+      627,  626,  625,  622,  621,  620,  619,  618,  615,  614,
+      613,  612,  611,  610,  609,  608,  607,  606,  605,  604,
+      602,  601,  600,  599,  598,  597,  596,  595,  594,  592,
+      591,  589,  588,  587,  586,  585,  584,  582,  581,  580,
+      578,  577,  575,  574,  573,  572,  571,  570,  569,  568,
+      567,  565,  564,  563,  562,  561,  559,  558,  557,  556,
+      555,  554,  553,  551,  550,  549,  548,  547,  546,  545,
+      544,  543,  542,  541,  540,  539,  538,  537,  536,  535,
+      534,  527,  525,  522,  521,  519,  518,  517,  515,  511,
+      510,  509,  508,  507,  506,  505,  504,  503,  502,  501,
+
+      500,  499,  498,  497,  495,  494,  493,  492,  491,  490,
+      489,  488,  487,  486,  485,  484,  482,  480,  479,  478,
+      477,  476,  475,  474,  473,  472,  471,  470,  469,  468,
+      466,  465,  464,  463,  462,  461,  460,  459,  458,  457,
+      456,  455,  454,  453,  452,  451,  450,  449,  448,  447,
+      445,  444,  443,  441,  440,  439,  438,  437,  436,  434,
+      433,  432,  431,  430,  429,  427,  426,  425,  424,  423,
+      421,  420,  419,  414,  413,  411,  410,  409,  408,  407,
+      404,  401,  399,  398,  397,  396,  394,  393,  392,  391,
+      390,  389,  388,  387,  386,  384,  383,  382,  380,  379,
+
+      378,  377,  376,  375,  374,  372,  371,  369,  368,  367,
+      366,  364,  363,  362,  361,  357,  356,  355,  354,  353,
+      351,  350,  349,  348,  347,  346,  345,  344,  343,  342,
+      341,  339,  338,  337,  336,  335,  334,  333,  332,  331,
+      330,  329,  328,  326,  325,  324,  323,  322,  319,  318,
+      317,  316,  315,  314,  310,  308,  305,  303,  300,  297,
+      290,  289,  288,  287,  286,  285,  283,  282,  281,  280,
+      279,  278,  277,  276,  275,  274,  273,  272,  271,  269,
+      268,  267,  266,  265,  264,  263,  262,  261,  260,  259,
+      258,  257,  256,  255,  253,  252,  251,  249,  248,  247,
+
+      246,  244,  243,  242,  241,  240,  239,  238,  237,  236,
+      234,  233,  232,  231,  230,  229,  228,  227,  226,  225,
+      224,  223,  222,  221,  220,  219,  218,  217,  216,  215,
+      214,  213,  211,  210,  209,  208,  207,  205,  202,  200,
+      198,  196,  195,  190,  189,  185,  177,  176,  175,  174,
+      173,  172,  170,  169,  168,  167,  165,  163,  161,  159,
+      158,  156,  155,  154,  153,  152,  150,  149,  148,  147,
+      145,  144,  143,  142,  141,  140,  139,  137,  136,  134,
+      130,  129,  128,  126,  125,  124,  122,  121,  120,  116,
+      110,  106,  105,  104,   98,   97,   78,   73,   67,   64,
+
+       50,   49,   48,   43,   41,   39,   38,   24,   14,   11,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445, 1445,
+     1445, 1445
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1424,7 +1437,7 @@ static char *yy_last_accepting_cpos;
 extern int parser6__flex_debug;
 int parser6__flex_debug = 1;
 
-static yyconst flex_int16_t yy_rule_linenum[175] =
+static yyconst flex_int16_t yy_rule_linenum[178] =
     {   0,
       146,  148,  150,  155,  156,  161,  162,  163,  175,  178,
       183,  190,  199,  208,  217,  226,  235,  244,  253,  262,
@@ -1437,14 +1450,14 @@ static yyconst flex_int16_t yy_rule_linenum[175] =
       859,  868,  877,  886,  895,  904,  913,  935,  957,  966,
       976,  986,  995, 1005, 1015, 1024, 1033, 1042, 1051, 1061,
 
-     1070, 1079, 1088, 1097, 1106, 1115, 1124, 1133, 1142, 1152,
-     1161, 1170, 1180, 1192, 1205, 1214, 1223, 1233, 1243, 1252,
-     1263, 1273, 1282, 1292, 1302, 1311, 1320, 1329, 1338, 1348,
-     1357, 1367, 1376, 1385, 1394, 1403, 1412, 1421, 1430, 1439,
+     1070, 1079, 1088, 1097, 1106, 1115, 1124, 1133, 1142, 1151,
+     1160, 1169, 1179, 1188, 1197, 1207, 1219, 1232, 1241, 1250,
+     1260, 1270, 1279, 1290, 1300, 1309, 1319, 1329, 1338, 1347,
+     1356, 1365, 1375, 1384, 1394, 1403, 1412, 1421, 1430, 1439,
      1448, 1457, 1466, 1475, 1484, 1493, 1502, 1511, 1520, 1529,
-     1538, 1547, 1556, 1565, 1574, 1583, 1593, 1692, 1697, 1702,
-     1707, 1708, 1709, 1710, 1711, 1712, 1714, 1732, 1745, 1750,
-     1754, 1756, 1758, 1760
+     1538, 1547, 1556, 1565, 1574, 1583, 1592, 1601, 1610, 1620,
+     1719, 1724, 1729, 1734, 1735, 1736, 1737, 1738, 1739, 1741,
+     1759, 1772, 1777, 1781, 1783, 1785, 1787
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1523,7 +1536,7 @@ using namespace isc::dhcp;
    by moving it ahead by parser6_leng bytes. parser6_leng specifies the length of the
    currently matched token. */
 #define YY_USER_ACTION  driver.loc_.columns(parser6_leng);
-#line 1527 "dhcp6_lexer.cc"
+#line 1540 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1814,7 +1827,7 @@ YY_DECL
     }
 
 
-#line 1818 "dhcp6_lexer.cc"
+#line 1831 "dhcp6_lexer.cc"
 
 	if ( !(yy_init) )
 		{
@@ -1877,13 +1890,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1420 )
+				if ( yy_current_state >= 1446 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1419 );
+		while ( yy_current_state != 1445 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1902,13 +1915,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 175 )
+			else if ( yy_act < 178 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], parser6_text );
-			else if ( yy_act == 175 )
+			else if ( yy_act == 178 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         parser6_text );
-			else if ( yy_act == 176 )
+			else if ( yy_act == 179 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -3269,7 +3282,43 @@ YY_RULE_SETUP
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
-#line 1152 "dhcp6_lexer.ll"
+#line 1151 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_ASYNC(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("async", driver.loc_);
+    }
+}
+	YY_BREAK
+case 111:
+YY_RULE_SETUP
+#line 1160 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_QUEUE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("queue-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 112:
+YY_RULE_SETUP
+#line 1169 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
+        return isc::dhcp::Dhcp6Parser::make_OVERFLOW_POLICY(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("overflow-policy", driver.loc_);
+    }
+}
+	YY_BREAK
+case 113:
+YY_RULE_SETUP
+#line 1179 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3279,9 +3328,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 114:
 YY_RULE_SETUP
-#line 1161 "dhcp6_lexer.ll"
+#line 1188 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -3291,9 +3340,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 115:
 YY_RULE_SETUP
-#line 1170 "dhcp6_lexer.ll"
+#line 1197 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3304,9 +3353,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 116:
 YY_RULE_SETUP
-#line 1180 "dhcp6_lexer.ll"
+#line 1207 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3319,9 +3368,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 117:
 YY_RULE_SETUP
-#line 1192 "dhcp6_lexer.ll"
+#line 1219 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3335,9 +3384,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 118:
 YY_RULE_SETUP
-#line 1205 "dhcp6_lexer.ll"
+#line 1232 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3347,9 +3396,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 119:
 YY_RULE_SETUP
-#line 1214 "dhcp6_lexer.ll"
+#line 1241 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -3359,9 +3408,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 120:
 YY_RULE_SETUP
-#line 1223 "dhcp6_lexer.ll"
+#line 1250 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3372,9 +3421,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 121:
 YY_RULE_SETUP
-#line 1233 "dhcp6_lexer.ll"
+#line 1260 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3385,9 +3434,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 122:
 YY_RULE_SETUP
-#line 1243 "dhcp6_lexer.ll"
+#line 1270 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3397,9 +3446,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 123:
 YY_RULE_SETUP
-#line 1252 "dhcp6_lexer.ll"
+#line 1279 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -3411,9 +3460,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 124:
 YY_RULE_SETUP
-#line 1263 "dhcp6_lexer.ll"
+#line 1290 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3424,9 +3473,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 125:
 YY_RULE_SETUP
-#line 1273 "dhcp6_lexer.ll"
+#line 1300 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3436,9 +3485,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 126:
 YY_RULE_SETUP
-#line 1282 "dhcp6_lexer.ll"
+#line 1309 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3449,9 +3498,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 127:
 YY_RULE_SETUP
-#line 1292 "dhcp6_lexer.ll"
+#line 1319 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3462,9 +3511,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 128:
 YY_RULE_SETUP
-#line 1302 "dhcp6_lexer.ll"
+#line 1329 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3474,9 +3523,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 129:
 YY_RULE_SETUP
-#line 1311 "dhcp6_lexer.ll"
+#line 1338 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3486,9 +3535,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 130:
 YY_RULE_SETUP
-#line 1320 "dhcp6_lexer.ll"
+#line 1347 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3498,9 +3547,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 131:
 YY_RULE_SETUP
-#line 1329 "dhcp6_lexer.ll"
+#line 1356 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3510,9 +3559,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 132:
 YY_RULE_SETUP
-#line 1338 "dhcp6_lexer.ll"
+#line 1365 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3523,9 +3572,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 133:
 YY_RULE_SETUP
-#line 1348 "dhcp6_lexer.ll"
+#line 1375 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3535,9 +3584,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 134:
 YY_RULE_SETUP
-#line 1357 "dhcp6_lexer.ll"
+#line 1384 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3547,9 +3596,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 132:
+case 135:
 YY_RULE_SETUP
-#line 1367 "dhcp6_lexer.ll"
+#line 1394 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3559,9 +3608,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 133:
+case 136:
 YY_RULE_SETUP
-#line 1376 "dhcp6_lexer.ll"
+#line 1403 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3571,9 +3620,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 134:
+case 137:
 YY_RULE_SETUP
-#line 1385 "dhcp6_lexer.ll"
+#line 1412 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3583,9 +3632,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 135:
+case 138:
 YY_RULE_SETUP
-#line 1394 "dhcp6_lexer.ll"
+#line 1421 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3595,9 +3644,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 136:
+case 139:
 YY_RULE_SETUP
-#line 1403 "dhcp6_lexer.ll"
+#line 1430 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3607,9 +3656,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 137:
+case 140:
 YY_RULE_SETUP
-#line 1412 "dhcp6_lexer.ll"
+#line 1439 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3619,9 +3668,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 138:
+case 141:
 YY_RULE_SETUP
-#line 1421 "dhcp6_lexer.ll"
+#line 1448 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3631,9 +3680,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 139:
+case 142:
 YY_RULE_SETUP
-#line 1430 "dhcp6_lexer.ll"
+#line 1457 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3643,9 +3692,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 140:
+case 143:
 YY_RULE_SETUP
-#line 1439 "dhcp6_lexer.ll"
+#line 1466 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3655,9 +3704,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 141:
+case 144:
 YY_RULE_SETUP
-#line 1448 "dhcp6_lexer.ll"
+#line 1475 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3667,9 +3716,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 142:
+case 145:
 YY_RULE_SETUP
-#line 1457 "dhcp6_lexer.ll"
+#line 1484 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3679,9 +3728,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 143:
+case 146:
 YY_RULE_SETUP
-#line 1466 "dhcp6_lexer.ll"
+#line 1493 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3691,9 +3740,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 144:
+case 147:
 YY_RULE_SETUP
-#line 1475 "dhcp6_lexer.ll"
+#line 1502 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3703,9 +3752,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 145:
+case 148:
 YY_RULE_SETUP
-#line 1484 "dhcp6_lexer.ll"
+#line 1511 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3715,9 +3764,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 146:
+case 149:
 YY_RULE_SETUP
-#line 1493 "dhcp6_lexer.ll"
+#line 1520 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3727,9 +3776,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 147:
+case 150:
 YY_RULE_SETUP
-#line 1502 "dhcp6_lexer.ll"
+#line 1529 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3739,9 +3788,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 148:
+case 151:
 YY_RULE_SETUP
-#line 1511 "dhcp6_lexer.ll"
+#line 1538 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3751,9 +3800,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 149:
+case 152:
 YY_RULE_SETUP
-#line 1520 "dhcp6_lexer.ll"
+#line 1547 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3763,9 +3812,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 150:
+case 153:
 YY_RULE_SETUP
-#line 1529 "dhcp6_lexer.ll"
+#line 1556 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3775,9 +3824,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 151:
+case 154:
 YY_RULE_SETUP
-#line 1538 "dhcp6_lexer.ll"
+#line 1565 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3787,9 +3836,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 152:
+case 155:
 YY_RULE_SETUP
-#line 1547 "dhcp6_lexer.ll"
+#line 1574 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3799,9 +3848,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 153:
+case 156:
 YY_RULE_SETUP
-#line 1556 "dhcp6_lexer.ll"
+#line 1583 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3811,9 +3860,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 154:
+case 157:
 YY_RULE_SETUP
-#line 1565 "dhcp6_lexer.ll"
+#line 1592 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3823,9 +3872,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 155:
+case 158:
 YY_RULE_SETUP
-#line 1574 "dhcp6_lexer.ll"
+#line 1601 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3835,9 +3884,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 156:
+case 159:
 YY_RULE_SETUP
-#line 1583 "dhcp6_lexer.ll"
+#line 1610 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3847,9 +3896,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 157:
+case 160:
 YY_RULE_SETUP
-#line 1593 "dhcp6_lexer.ll"
+#line 1620 "dhcp6_lexer.ll"
 {
     /* A string has been matched. It contains the actual string and single quotes.
        We need to get those quotes out of the way and just use its content, e.g.
@@ -3949,65 +3998,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 158:
-/* rule 158 can match eol */
+case 161:
+/* rule 161 can match eol */
 YY_RULE_SETUP
-#line 1692 "dhcp6_lexer.ll"
+#line 1719 "dhcp6_lexer.ll"
 {
     /* Bad string with a forbidden control character inside */
     driver.error(driver.loc_, "Invalid control in " + std::string(parser6_text));
 }
 	YY_BREAK
-case 159:
-/* rule 159 can match eol */
+case 162:
+/* rule 162 can match eol */
 YY_RULE_SETUP
-#line 1697 "dhcp6_lexer.ll"
+#line 1724 "dhcp6_lexer.ll"
 {
     /* Bad string with a bad escape inside */
     driver.error(driver.loc_, "Bad escape in " + std::string(parser6_text));
 }
 	YY_BREAK
-case 160:
+case 163:
 YY_RULE_SETUP
-#line 1702 "dhcp6_lexer.ll"
+#line 1729 "dhcp6_lexer.ll"
 {
     /* Bad string with an open escape at the end */
     driver.error(driver.loc_, "Overflow escape in " + std::string(parser6_text));
 }
 	YY_BREAK
-case 161:
+case 164:
 YY_RULE_SETUP
-#line 1707 "dhcp6_lexer.ll"
+#line 1734 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 162:
+case 165:
 YY_RULE_SETUP
-#line 1708 "dhcp6_lexer.ll"
+#line 1735 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 163:
+case 166:
 YY_RULE_SETUP
-#line 1709 "dhcp6_lexer.ll"
+#line 1736 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 164:
+case 167:
 YY_RULE_SETUP
-#line 1710 "dhcp6_lexer.ll"
+#line 1737 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 165:
+case 168:
 YY_RULE_SETUP
-#line 1711 "dhcp6_lexer.ll"
+#line 1738 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 166:
+case 169:
 YY_RULE_SETUP
-#line 1712 "dhcp6_lexer.ll"
+#line 1739 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 167:
+case 170:
 YY_RULE_SETUP
-#line 1714 "dhcp6_lexer.ll"
+#line 1741 "dhcp6_lexer.ll"
 {
     /* An integer was found. */
     std::string tmp(parser6_text);
@@ -4026,9 +4075,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 168:
+case 171:
 YY_RULE_SETUP
-#line 1732 "dhcp6_lexer.ll"
+#line 1759 "dhcp6_lexer.ll"
 {
     /* A floating point was found. */
     std::string tmp(parser6_text);
@@ -4042,43 +4091,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 169:
+case 172:
 YY_RULE_SETUP
-#line 1745 "dhcp6_lexer.ll"
+#line 1772 "dhcp6_lexer.ll"
 {
     string tmp(parser6_text);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 170:
+case 173:
 YY_RULE_SETUP
-#line 1750 "dhcp6_lexer.ll"
+#line 1777 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 171:
+case 174:
 YY_RULE_SETUP
-#line 1754 "dhcp6_lexer.ll"
+#line 1781 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 172:
+case 175:
 YY_RULE_SETUP
-#line 1756 "dhcp6_lexer.ll"
+#line 1783 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 173:
+case 176:
 YY_RULE_SETUP
-#line 1758 "dhcp6_lexer.ll"
+#line 1785 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 174:
+case 177:
 YY_RULE_SETUP
-#line 1760 "dhcp6_lexer.ll"
+#line 1787 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(parser6_text));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1762 "dhcp6_lexer.ll"
+#line 1789 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -4102,12 +4151,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 175:
+case 178:
 YY_RULE_SETUP
-#line 1785 "dhcp6_lexer.ll"
+#line 1812 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 4111 "dhcp6_lexer.cc"
+#line 4160 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4419,7 +4468,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1420 )
+			if ( yy_current_state >= 1446 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
@@ -4452,11 +4501,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1420 )
+		if ( yy_current_state >= 1446 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (unsigned int) yy_c];
-	yy_is_jam = (yy_current_state == 1419);
+	yy_is_jam = (yy_current_state == 1445);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5187,7 +5236,7 @@ void parser6_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1785 "dhcp6_lexer.ll"
+#line 1812 "dhcp6_lexer.ll"
 
 
 
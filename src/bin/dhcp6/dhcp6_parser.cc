@@ -253,29 +253,29 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -294,29 +294,29 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -356,79 +356,79 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 165: // "constant string"
+            case 168: // "constant string"
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 364 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 371 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 378 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 385 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 185: // value
+      case 188: // value
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 392 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 189: // map_value
+      case 192: // map_value
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 399 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 239: // db_type
+      case 242: // db_type
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 406 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 328: // hr_mode
+      case 331: // hr_mode
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 413 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 464: // duid_type
+      case 467: // duid_type
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 420 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 497: // ncr_protocol_value
+      case 500: // ncr_protocol_value
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 427 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 505: // replace_client_name_value
+      case 508: // replace_client_name_value
 
-#line 242 "dhcp6_parser.yy" // lalr1.cc:636
+#line 245 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 434 "dhcp6_parser.cc" // lalr1.cc:636
         break;
@@ -630,29 +630,29 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -674,133 +674,133 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 251 "dhcp6_parser.yy" // lalr1.cc:859
+#line 254 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 680 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 252 "dhcp6_parser.yy" // lalr1.cc:859
+#line 255 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 686 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 253 "dhcp6_parser.yy" // lalr1.cc:859
+#line 256 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 692 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 254 "dhcp6_parser.yy" // lalr1.cc:859
+#line 257 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 698 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 255 "dhcp6_parser.yy" // lalr1.cc:859
+#line 258 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET6; }
 #line 704 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 256 "dhcp6_parser.yy" // lalr1.cc:859
+#line 259 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 710 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 257 "dhcp6_parser.yy" // lalr1.cc:859
+#line 260 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.PD_POOLS; }
 #line 716 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 258 "dhcp6_parser.yy" // lalr1.cc:859
+#line 261 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 722 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 259 "dhcp6_parser.yy" // lalr1.cc:859
+#line 262 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 728 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 260 "dhcp6_parser.yy" // lalr1.cc:859
+#line 263 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 734 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 261 "dhcp6_parser.yy" // lalr1.cc:859
+#line 264 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 740 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 262 "dhcp6_parser.yy" // lalr1.cc:859
+#line 265 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 746 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 263 "dhcp6_parser.yy" // lalr1.cc:859
+#line 266 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 752 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 264 "dhcp6_parser.yy" // lalr1.cc:859
+#line 267 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.LOGGING; }
 #line 758 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 272 "dhcp6_parser.yy" // lalr1.cc:859
+#line 275 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 764 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 31:
-#line 273 "dhcp6_parser.yy" // lalr1.cc:859
+#line 276 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 770 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 274 "dhcp6_parser.yy" // lalr1.cc:859
+#line 277 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 776 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 275 "dhcp6_parser.yy" // lalr1.cc:859
+#line 278 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 782 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 34:
-#line 276 "dhcp6_parser.yy" // lalr1.cc:859
+#line 279 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 788 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 35:
-#line 277 "dhcp6_parser.yy" // lalr1.cc:859
+#line 280 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 794 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 36:
-#line 278 "dhcp6_parser.yy" // lalr1.cc:859
+#line 281 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 800 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 37:
-#line 281 "dhcp6_parser.yy" // lalr1.cc:859
+#line 284 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -809,7 +809,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 38:
-#line 286 "dhcp6_parser.yy" // lalr1.cc:859
+#line 289 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -820,7 +820,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 39:
-#line 291 "dhcp6_parser.yy" // lalr1.cc:859
+#line 294 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -830,13 +830,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 297 "dhcp6_parser.yy" // lalr1.cc:859
+#line 300 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 836 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 43:
-#line 304 "dhcp6_parser.yy" // lalr1.cc:859
+#line 307 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -845,7 +845,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 44:
-#line 308 "dhcp6_parser.yy" // lalr1.cc:859
+#line 311 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -855,7 +855,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 45:
-#line 315 "dhcp6_parser.yy" // lalr1.cc:859
+#line 318 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -864,7 +864,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 318 "dhcp6_parser.yy" // lalr1.cc:859
+#line 321 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -872,7 +872,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 49:
-#line 326 "dhcp6_parser.yy" // lalr1.cc:859
+#line 329 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -881,7 +881,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 50:
-#line 330 "dhcp6_parser.yy" // lalr1.cc:859
+#line 333 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -890,7 +890,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 337 "dhcp6_parser.yy" // lalr1.cc:859
+#line 340 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -898,7 +898,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 339 "dhcp6_parser.yy" // lalr1.cc:859
+#line 342 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -907,7 +907,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 348 "dhcp6_parser.yy" // lalr1.cc:859
+#line 351 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -916,7 +916,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 56:
-#line 352 "dhcp6_parser.yy" // lalr1.cc:859
+#line 355 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -925,7 +925,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 57:
-#line 363 "dhcp6_parser.yy" // lalr1.cc:859
+#line 366 "dhcp6_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -936,7 +936,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 58:
-#line 373 "dhcp6_parser.yy" // lalr1.cc:859
+#line 376 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -947,7 +947,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 59:
-#line 378 "dhcp6_parser.yy" // lalr1.cc:859
+#line 381 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -960,7 +960,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 68:
-#line 401 "dhcp6_parser.yy" // lalr1.cc:859
+#line 404 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -973,7 +973,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 69:
-#line 408 "dhcp6_parser.yy" // lalr1.cc:859
+#line 411 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     ctx.stack_.pop_back();
@@ -983,7 +983,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 70:
-#line 416 "dhcp6_parser.yy" // lalr1.cc:859
+#line 419 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -993,7 +993,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 71:
-#line 420 "dhcp6_parser.yy" // lalr1.cc:859
+#line 423 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No global parameter is required
     // parsing completed
@@ -1002,7 +1002,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 102:
-#line 461 "dhcp6_parser.yy" // lalr1.cc:859
+#line 464 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
@@ -1011,7 +1011,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 103:
-#line 466 "dhcp6_parser.yy" // lalr1.cc:859
+#line 469 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -1020,7 +1020,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 104:
-#line 471 "dhcp6_parser.yy" // lalr1.cc:859
+#line 474 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1029,7 +1029,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 105:
-#line 476 "dhcp6_parser.yy" // lalr1.cc:859
+#line 479 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1038,7 +1038,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 106:
-#line 481 "dhcp6_parser.yy" // lalr1.cc:859
+#line 484 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1047,7 +1047,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 107:
-#line 486 "dhcp6_parser.yy" // lalr1.cc:859
+#line 489 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1058,7 +1058,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 108:
-#line 491 "dhcp6_parser.yy" // lalr1.cc:859
+#line 494 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     ctx.stack_.pop_back();
@@ -1068,7 +1068,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 109:
-#line 497 "dhcp6_parser.yy" // lalr1.cc:859
+#line 500 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1078,7 +1078,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 110:
-#line 501 "dhcp6_parser.yy" // lalr1.cc:859
+#line 504 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No interfaces config param is required
     // parsing completed
@@ -1087,7 +1087,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 118:
-#line 517 "dhcp6_parser.yy" // lalr1.cc:859
+#line 520 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1098,7 +1098,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 119:
-#line 522 "dhcp6_parser.yy" // lalr1.cc:859
+#line 525 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1107,7 +1107,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 120:
-#line 527 "dhcp6_parser.yy" // lalr1.cc:859
+#line 530 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("re-detect", b);
@@ -1116,7 +1116,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 121:
-#line 533 "dhcp6_parser.yy" // lalr1.cc:859
+#line 536 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1127,7 +1127,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 122:
-#line 538 "dhcp6_parser.yy" // lalr1.cc:859
+#line 541 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1138,7 +1138,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 123:
-#line 545 "dhcp6_parser.yy" // lalr1.cc:859
+#line 548 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -1149,7 +1149,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 124:
-#line 550 "dhcp6_parser.yy" // lalr1.cc:859
+#line 553 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -1160,7 +1160,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 125:
-#line 557 "dhcp6_parser.yy" // lalr1.cc:859
+#line 560 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-databases", l);
@@ -1171,7 +1171,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 126:
-#line 562 "dhcp6_parser.yy" // lalr1.cc:859
+#line 565 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1180,7 +1180,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 131:
-#line 575 "dhcp6_parser.yy" // lalr1.cc:859
+#line 578 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1190,7 +1190,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 132:
-#line 579 "dhcp6_parser.yy" // lalr1.cc:859
+#line 582 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required
     ctx.require("type", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1200,7 +1200,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 153:
-#line 609 "dhcp6_parser.yy" // lalr1.cc:859
+#line 612 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
@@ -1208,7 +1208,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 154:
-#line 611 "dhcp6_parser.yy" // lalr1.cc:859
+#line 614 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1217,31 +1217,31 @@ namespace isc { namespace dhcp {
     break;
 
   case 155:
-#line 616 "dhcp6_parser.yy" // lalr1.cc:859
+#line 619 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
 #line 1223 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 156:
-#line 617 "dhcp6_parser.yy" // lalr1.cc:859
+#line 620 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
 #line 1229 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 157:
-#line 618 "dhcp6_parser.yy" // lalr1.cc:859
+#line 621 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
 #line 1235 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 158:
-#line 619 "dhcp6_parser.yy" // lalr1.cc:859
+#line 622 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
 #line 1241 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 159:
-#line 622 "dhcp6_parser.yy" // lalr1.cc:859
+#line 625 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1249,7 +1249,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 160:
-#line 624 "dhcp6_parser.yy" // lalr1.cc:859
+#line 627 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
@@ -1259,7 +1259,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 161:
-#line 630 "dhcp6_parser.yy" // lalr1.cc:859
+#line 633 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1267,7 +1267,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 162:
-#line 632 "dhcp6_parser.yy" // lalr1.cc:859
+#line 635 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
@@ -1277,7 +1277,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 163:
-#line 638 "dhcp6_parser.yy" // lalr1.cc:859
+#line 641 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1285,7 +1285,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 164:
-#line 640 "dhcp6_parser.yy" // lalr1.cc:859
+#line 643 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
@@ -1295,7 +1295,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 165:
-#line 646 "dhcp6_parser.yy" // lalr1.cc:859
+#line 649 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
@@ -1304,7 +1304,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 166:
-#line 651 "dhcp6_parser.yy" // lalr1.cc:859
+#line 654 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1312,7 +1312,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 167:
-#line 653 "dhcp6_parser.yy" // lalr1.cc:859
+#line 656 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1322,7 +1322,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 168:
-#line 659 "dhcp6_parser.yy" // lalr1.cc:859
+#line 662 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
@@ -1331,7 +1331,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 169:
-#line 664 "dhcp6_parser.yy" // lalr1.cc:859
+#line 667 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1340,7 +1340,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 170:
-#line 669 "dhcp6_parser.yy" // lalr1.cc:859
+#line 672 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
@@ -1349,7 +1349,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 171:
-#line 674 "dhcp6_parser.yy" // lalr1.cc:859
+#line 677 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1358,7 +1358,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 172:
-#line 679 "dhcp6_parser.yy" // lalr1.cc:859
+#line 682 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reconnect-wait-time", n);
@@ -1367,7 +1367,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 173:
-#line 684 "dhcp6_parser.yy" // lalr1.cc:859
+#line 687 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("request-timeout", n);
@@ -1376,7 +1376,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 174:
-#line 689 "dhcp6_parser.yy" // lalr1.cc:859
+#line 692 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-keepalive", n);
@@ -1385,7 +1385,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 175:
-#line 694 "dhcp6_parser.yy" // lalr1.cc:859
+#line 697 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("tcp-nodelay", n);
@@ -1394,7 +1394,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 176:
-#line 699 "dhcp6_parser.yy" // lalr1.cc:859
+#line 702 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1402,7 +1402,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 177:
-#line 701 "dhcp6_parser.yy" // lalr1.cc:859
+#line 704 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
@@ -1412,7 +1412,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 178:
-#line 707 "dhcp6_parser.yy" // lalr1.cc:859
+#line 710 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reconnect-tries", n);
@@ -1421,7 +1421,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 179:
-#line 712 "dhcp6_parser.yy" // lalr1.cc:859
+#line 715 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1429,7 +1429,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 180:
-#line 714 "dhcp6_parser.yy" // lalr1.cc:859
+#line 717 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
@@ -1439,7 +1439,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 181:
-#line 720 "dhcp6_parser.yy" // lalr1.cc:859
+#line 723 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sanity-checks", m);
@@ -1450,7 +1450,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 182:
-#line 725 "dhcp6_parser.yy" // lalr1.cc:859
+#line 728 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1459,7 +1459,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 186:
-#line 735 "dhcp6_parser.yy" // lalr1.cc:859
+#line 738 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1467,7 +1467,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 187:
-#line 737 "dhcp6_parser.yy" // lalr1.cc:859
+#line 740 "dhcp6_parser.yy" // lalr1.cc:859
     {
 
     if ( (string(yystack_[0].value.as< std::string > ()) == "none") ||
@@ -1487,7 +1487,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 188:
-#line 753 "dhcp6_parser.yy" // lalr1.cc:859
+#line 756 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
@@ -1498,7 +1498,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 189:
-#line 758 "dhcp6_parser.yy" // lalr1.cc:859
+#line 761 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1507,7 +1507,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 194:
-#line 771 "dhcp6_parser.yy" // lalr1.cc:859
+#line 774 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
@@ -1516,7 +1516,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 195:
-#line 776 "dhcp6_parser.yy" // lalr1.cc:859
+#line 779 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
@@ -1525,7 +1525,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 196:
-#line 781 "dhcp6_parser.yy" // lalr1.cc:859
+#line 784 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
@@ -1536,7 +1536,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 197:
-#line 786 "dhcp6_parser.yy" // lalr1.cc:859
+#line 789 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1545,7 +1545,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 203:
-#line 800 "dhcp6_parser.yy" // lalr1.cc:859
+#line 803 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
@@ -1554,7 +1554,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 204:
-#line 805 "dhcp6_parser.yy" // lalr1.cc:859
+#line 808 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr flex_id(new StringElement("flex-id", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(flex_id);
@@ -1563,7 +1563,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 205:
-#line 812 "dhcp6_parser.yy" // lalr1.cc:859
+#line 815 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
@@ -1574,7 +1574,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 206:
-#line 817 "dhcp6_parser.yy" // lalr1.cc:859
+#line 820 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1583,7 +1583,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 207:
-#line 822 "dhcp6_parser.yy" // lalr1.cc:859
+#line 825 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
@@ -1594,7 +1594,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 208:
-#line 827 "dhcp6_parser.yy" // lalr1.cc:859
+#line 830 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1603,7 +1603,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 213:
-#line 840 "dhcp6_parser.yy" // lalr1.cc:859
+#line 843 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1613,7 +1613,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 214:
-#line 844 "dhcp6_parser.yy" // lalr1.cc:859
+#line 847 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1623,7 +1623,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 215:
-#line 850 "dhcp6_parser.yy" // lalr1.cc:859
+#line 853 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1633,7 +1633,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 216:
-#line 854 "dhcp6_parser.yy" // lalr1.cc:859
+#line 857 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The library hooks parameter is required
     ctx.require("library", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1643,7 +1643,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 222:
-#line 869 "dhcp6_parser.yy" // lalr1.cc:859
+#line 872 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1651,7 +1651,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 223:
-#line 871 "dhcp6_parser.yy" // lalr1.cc:859
+#line 874 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
@@ -1661,7 +1661,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 224:
-#line 877 "dhcp6_parser.yy" // lalr1.cc:859
+#line 880 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1669,7 +1669,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 225:
-#line 879 "dhcp6_parser.yy" // lalr1.cc:859
+#line 882 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1678,7 +1678,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 226:
-#line 885 "dhcp6_parser.yy" // lalr1.cc:859
+#line 888 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
@@ -1689,7 +1689,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 227:
-#line 890 "dhcp6_parser.yy" // lalr1.cc:859
+#line 893 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // No expired lease parameter is required
     ctx.stack_.pop_back();
@@ -1699,7 +1699,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 236:
-#line 908 "dhcp6_parser.yy" // lalr1.cc:859
+#line 911 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
@@ -1708,7 +1708,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 237:
-#line 913 "dhcp6_parser.yy" // lalr1.cc:859
+#line 916 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
@@ -1717,7 +1717,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 238:
-#line 918 "dhcp6_parser.yy" // lalr1.cc:859
+#line 921 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
@@ -1726,7 +1726,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 239:
-#line 923 "dhcp6_parser.yy" // lalr1.cc:859
+#line 926 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
@@ -1735,7 +1735,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 240:
-#line 928 "dhcp6_parser.yy" // lalr1.cc:859
+#line 931 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
@@ -1744,7 +1744,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 241:
-#line 933 "dhcp6_parser.yy" // lalr1.cc:859
+#line 936 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
@@ -1753,7 +1753,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 242:
-#line 941 "dhcp6_parser.yy" // lalr1.cc:859
+#line 944 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
@@ -1764,7 +1764,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 243:
-#line 946 "dhcp6_parser.yy" // lalr1.cc:859
+#line 949 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1773,7 +1773,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 248:
-#line 966 "dhcp6_parser.yy" // lalr1.cc:859
+#line 969 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -1783,7 +1783,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 249:
-#line 970 "dhcp6_parser.yy" // lalr1.cc:859
+#line 973 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -1809,7 +1809,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 250:
-#line 992 "dhcp6_parser.yy" // lalr1.cc:859
+#line 995 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1819,7 +1819,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 251:
-#line 996 "dhcp6_parser.yy" // lalr1.cc:859
+#line 999 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The subnet subnet6 parameter is required
     ctx.require("subnet", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -1829,7 +1829,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 274:
-#line 1030 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1033 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1837,7 +1837,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 275:
-#line 1032 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1035 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
@@ -1847,7 +1847,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 276:
-#line 1038 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1041 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1855,7 +1855,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 277:
-#line 1040 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1043 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
@@ -1865,7 +1865,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 278:
-#line 1046 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1049 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1873,7 +1873,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 279:
-#line 1048 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1051 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
@@ -1883,7 +1883,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 280:
-#line 1054 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1057 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -1891,7 +1891,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 281:
-#line 1056 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1059 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
@@ -1901,7 +1901,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 282:
-#line 1062 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1065 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("require-client-classes", c);
@@ -1912,7 +1912,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 283:
-#line 1067 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1070 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1921,7 +1921,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 284:
-#line 1072 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1075 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.RESERVATION_MODE);
 }
@@ -1929,7 +1929,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 285:
-#line 1074 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1077 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("reservation-mode", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1938,25 +1938,25 @@ namespace isc { namespace dhcp {
     break;
 
   case 286:
-#line 1079 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1082 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("disabled", ctx.loc2pos(yystack_[0].location))); }
 #line 1944 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 287:
-#line 1080 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1083 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("out-of-pool", ctx.loc2pos(yystack_[0].location))); }
 #line 1950 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 288:
-#line 1081 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1084 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("all", ctx.loc2pos(yystack_[0].location))); }
 #line 1956 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 289:
-#line 1084 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1087 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
@@ -1965,7 +1965,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 290:
-#line 1089 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1092 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
@@ -1974,7 +1974,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 291:
-#line 1097 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1100 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("shared-networks", l);
@@ -1985,7 +1985,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 292:
-#line 1102 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1105 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1994,7 +1994,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 297:
-#line 1117 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1120 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2004,7 +2004,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 298:
-#line 1121 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1124 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
@@ -2012,7 +2012,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 318:
-#line 1152 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1155 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
@@ -2023,7 +2023,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 319:
-#line 1157 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1160 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2032,7 +2032,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 320:
-#line 1165 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1168 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
@@ -2041,7 +2041,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 321:
-#line 1168 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1171 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -2049,7 +2049,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 326:
-#line 1184 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1187 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2059,7 +2059,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 327:
-#line 1188 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1191 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2071,7 +2071,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 328:
-#line 1199 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1202 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -2081,7 +2081,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 329:
-#line 1203 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1206 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name, code and type option def parameters are required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2093,7 +2093,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 345:
-#line 1235 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1238 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
@@ -2102,7 +2102,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 347:
-#line 1242 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1245 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2110,7 +2110,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 348:
-#line 1244 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1247 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
@@ -2120,7 +2120,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 349:
-#line 1250 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1253 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2128,7 +2128,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 350:
-#line 1252 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1255 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
@@ -2138,7 +2138,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 351:
-#line 1258 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1261 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2146,7 +2146,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 352:
-#line 1260 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1263 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
@@ -2156,7 +2156,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 354:
-#line 1268 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1271 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2164,7 +2164,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 355:
-#line 1270 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1273 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
@@ -2174,7 +2174,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 356:
-#line 1276 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1279 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
@@ -2183,7 +2183,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 357:
-#line 1285 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1288 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
@@ -2194,7 +2194,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 358:
-#line 1290 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1293 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2203,7 +2203,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 363:
-#line 1309 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1312 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2213,7 +2213,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 364:
-#line 1313 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1316 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     ctx.stack_.pop_back();
@@ -2222,7 +2222,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 365:
-#line 1321 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1324 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -2232,7 +2232,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 366:
-#line 1325 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1328 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: the code or name parameters are required.
     // parsing completed
@@ -2241,7 +2241,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 381:
-#line 1358 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1361 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2249,7 +2249,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 382:
-#line 1360 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1363 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
@@ -2259,7 +2259,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 385:
-#line 1370 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1373 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
@@ -2268,7 +2268,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 386:
-#line 1375 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1378 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr persist(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-send", persist);
@@ -2277,7 +2277,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 387:
-#line 1383 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1386 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
@@ -2288,7 +2288,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 388:
-#line 1388 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1391 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2297,7 +2297,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 393:
-#line 1403 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1406 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2307,7 +2307,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 394:
-#line 1407 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1410 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2317,7 +2317,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 395:
-#line 1413 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1416 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -2327,7 +2327,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 396:
-#line 1417 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1420 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The pool parameter is required.
     ctx.require("pool", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2336,7 +2336,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 406:
-#line 1435 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1438 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2344,7 +2344,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 407:
-#line 1437 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1440 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
@@ -2354,7 +2354,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 408:
-#line 1443 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1446 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2362,7 +2362,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 409:
-#line 1445 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1448 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context = yystack_[0].value.as< ElementPtr > ();
@@ -2389,7 +2389,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 410:
-#line 1468 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1471 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2397,7 +2397,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 411:
-#line 1470 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1473 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr parent = ctx.stack_.back();
     ElementPtr user_context(new MapElement(ctx.loc2pos(yystack_[3].location)));
@@ -2426,7 +2426,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 412:
-#line 1498 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1501 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
@@ -2437,7 +2437,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 413:
-#line 1503 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1506 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2446,7 +2446,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 418:
-#line 1518 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1521 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2456,7 +2456,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 419:
-#line 1522 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1525 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2468,7 +2468,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 420:
-#line 1530 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1533 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -2478,7 +2478,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 421:
-#line 1534 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1537 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The prefix, prefix len and delegated len parameters are required.
     ctx.require("prefix", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2490,7 +2490,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 435:
-#line 1559 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1562 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2498,7 +2498,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 436:
-#line 1561 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1564 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
@@ -2508,7 +2508,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 437:
-#line 1567 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1570 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
@@ -2517,7 +2517,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 438:
-#line 1572 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1575 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2525,7 +2525,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 439:
-#line 1574 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1577 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
@@ -2535,7 +2535,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 440:
-#line 1580 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1583 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
@@ -2544,7 +2544,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 441:
-#line 1585 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1588 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
@@ -2553,7 +2553,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 442:
-#line 1593 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1596 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
@@ -2564,7 +2564,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 443:
-#line 1598 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1601 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2573,7 +2573,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 448:
-#line 1611 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1614 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2583,7 +2583,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 449:
-#line 1615 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1618 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     ctx.stack_.pop_back();
@@ -2592,7 +2592,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 450:
-#line 1620 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1623 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -2602,7 +2602,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 451:
-#line 1624 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1627 "dhcp6_parser.yy" // lalr1.cc:859
     {
     /// @todo: an identifier parameter is required.
     // parsing completed
@@ -2611,7 +2611,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 467:
-#line 1651 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1654 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
@@ -2622,7 +2622,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 468:
-#line 1656 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1659 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2631,7 +2631,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 469:
-#line 1661 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1664 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
@@ -2642,7 +2642,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 470:
-#line 1666 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1669 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2651,7 +2651,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 471:
-#line 1671 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1674 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2659,7 +2659,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 472:
-#line 1673 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1676 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
@@ -2669,7 +2669,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 473:
-#line 1679 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1682 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2677,7 +2677,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 474:
-#line 1681 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1684 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
@@ -2687,7 +2687,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 475:
-#line 1687 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1690 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2695,7 +2695,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 476:
-#line 1689 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1692 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
@@ -2705,7 +2705,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 477:
-#line 1695 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1698 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2713,7 +2713,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 478:
-#line 1697 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1700 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flex-id", hw);
@@ -2723,7 +2723,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 479:
-#line 1703 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1706 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
@@ -2734,7 +2734,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 480:
-#line 1708 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1711 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2743,7 +2743,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 481:
-#line 1716 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1719 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
@@ -2754,7 +2754,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 482:
-#line 1721 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1724 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2763,7 +2763,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 485:
-#line 1730 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1733 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2771,7 +2771,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 486:
-#line 1732 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1735 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr addr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", addr);
@@ -2781,7 +2781,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 487:
-#line 1741 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1744 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
@@ -2792,7 +2792,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 488:
-#line 1746 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1749 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2801,7 +2801,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 491:
-#line 1755 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1758 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -2811,7 +2811,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 492:
-#line 1759 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1762 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The name client class parameter is required.
     ctx.require("name", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -2821,7 +2821,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 505:
-#line 1784 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1787 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2829,7 +2829,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 506:
-#line 1786 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1789 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
@@ -2839,7 +2839,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 507:
-#line 1792 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1795 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("only-if-required", b);
@@ -2848,7 +2848,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 508:
-#line 1800 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1803 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
@@ -2859,7 +2859,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 509:
-#line 1805 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1808 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The type parameter is required.
     ctx.require("type", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -2870,7 +2870,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 521:
-#line 1827 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1830 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DUID_TYPE);
 }
@@ -2878,7 +2878,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 522:
-#line 1829 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1832 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -2887,25 +2887,25 @@ namespace isc { namespace dhcp {
     break;
 
   case 523:
-#line 1834 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1837 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
 #line 2893 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 524:
-#line 1835 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1838 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
 #line 2899 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 525:
-#line 1836 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1839 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
 #line 2905 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 526:
-#line 1839 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1842 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
@@ -2914,7 +2914,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 527:
-#line 1844 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1847 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2922,7 +2922,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 528:
-#line 1846 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1849 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
@@ -2932,7 +2932,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 529:
-#line 1852 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1855 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
@@ -2941,7 +2941,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 530:
-#line 1857 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1860 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
@@ -2950,7 +2950,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 531:
-#line 1864 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1867 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
@@ -2959,7 +2959,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 532:
-#line 1871 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1874 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
@@ -2970,7 +2970,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 533:
-#line 1876 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1879 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -2979,7 +2979,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 541:
-#line 1892 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1895 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -2987,7 +2987,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 542:
-#line 1894 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1897 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
@@ -2997,7 +2997,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 543:
-#line 1900 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1903 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3005,7 +3005,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 544:
-#line 1902 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1905 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
@@ -3015,7 +3015,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 545:
-#line 1910 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1913 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
@@ -3026,7 +3026,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 546:
-#line 1915 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1918 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[2].location), ctx.loc2pos(yystack_[0].location));
@@ -3037,7 +3037,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 547:
-#line 1922 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1925 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -3047,7 +3047,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 548:
-#line 1926 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1929 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // The enable updates DHCP DDNS parameter is required.
     ctx.require("enable-updates", ctx.loc2pos(yystack_[3].location), ctx.loc2pos(yystack_[0].location));
@@ -3057,7 +3057,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 570:
-#line 1957 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1960 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
@@ -3066,7 +3066,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 571:
-#line 1962 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1965 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3074,7 +3074,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 572:
-#line 1964 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1967 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
@@ -3084,7 +3084,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 573:
-#line 1970 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1973 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3092,7 +3092,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 574:
-#line 1972 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1975 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
@@ -3102,7 +3102,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 575:
-#line 1978 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1981 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
@@ -3111,7 +3111,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 576:
-#line 1983 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1986 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3119,7 +3119,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 577:
-#line 1985 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1988 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
@@ -3129,7 +3129,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 578:
-#line 1991 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1994 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
@@ -3138,7 +3138,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 579:
-#line 1996 "dhcp6_parser.yy" // lalr1.cc:859
+#line 1999 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
@@ -3147,7 +3147,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 580:
-#line 2001 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2004 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
@@ -3155,7 +3155,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 581:
-#line 2003 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2006 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -3164,19 +3164,19 @@ namespace isc { namespace dhcp {
     break;
 
   case 582:
-#line 2009 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2012 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
 #line 3170 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 583:
-#line 2010 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2013 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
 #line 3176 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 584:
-#line 2013 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2016 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
@@ -3184,7 +3184,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 585:
-#line 2015 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2018 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
@@ -3194,7 +3194,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 586:
-#line 2021 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2024 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
@@ -3203,7 +3203,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 587:
-#line 2026 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2029 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
@@ -3212,7 +3212,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 588:
-#line 2031 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2034 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
@@ -3221,7 +3221,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 589:
-#line 2036 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2039 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
@@ -3229,7 +3229,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 590:
-#line 2038 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2041 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -3238,7 +3238,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 591:
-#line 2044 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2047 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location)));
       }
@@ -3246,7 +3246,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 592:
-#line 2047 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2050 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
@@ -3254,7 +3254,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 593:
-#line 2050 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2053 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
@@ -3262,7 +3262,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 594:
-#line 2053 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2056 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
@@ -3270,7 +3270,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 595:
-#line 2056 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2059 "dhcp6_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
@@ -3279,7 +3279,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 596:
-#line 2062 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2065 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3287,7 +3287,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 597:
-#line 2064 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2067 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
@@ -3297,7 +3297,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 598:
-#line 2070 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2073 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3305,7 +3305,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 599:
-#line 2072 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2075 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-set", s);
@@ -3315,7 +3315,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 600:
-#line 2078 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2081 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3323,7 +3323,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 601:
-#line 2080 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2083 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname-char-replacement", s);
@@ -3333,7 +3333,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 602:
-#line 2088 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2091 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3341,7 +3341,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 603:
-#line 2090 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2093 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -3350,7 +3350,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 604:
-#line 2095 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2098 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3358,7 +3358,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 605:
-#line 2097 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2100 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -3367,7 +3367,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 606:
-#line 2102 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2105 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3375,7 +3375,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 607:
-#line 2104 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2107 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Control-agent", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -3384,7 +3384,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 608:
-#line 2115 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2118 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
@@ -3395,7 +3395,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 609:
-#line 2120 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2123 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -3404,7 +3404,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 610:
-#line 2125 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2128 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the Logging map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -3414,7 +3414,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 611:
-#line 2129 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2132 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -3422,7 +3422,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 615:
-#line 2145 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2148 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
@@ -3433,7 +3433,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 616:
-#line 2150 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2153 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -3442,7 +3442,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 619:
-#line 2162 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2165 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
@@ -3452,7 +3452,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 620:
-#line 2166 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2169 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
@@ -3460,7 +3460,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 630:
-#line 2183 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2186 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
@@ -3469,7 +3469,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 631:
-#line 2188 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2191 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
@@ -3477,7 +3477,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 632:
-#line 2190 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2193 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
@@ -3487,7 +3487,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 633:
-#line 2196 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2199 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
@@ -3498,7 +3498,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 634:
-#line 2201 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2204 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -3507,7 +3507,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 637:
-#line 2210 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2213 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
@@ -3517,23 +3517,23 @@ namespace isc { namespace dhcp {
     break;
 
   case 638:
-#line 2214 "dhcp6_parser.yy" // lalr1.cc:859
+#line 2217 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
 #line 3525 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 645:
-#line 2228 "dhcp6_parser.yy" // lalr1.cc:859
+  case 648:
+#line 2234 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 3533 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 646:
-#line 2230 "dhcp6_parser.yy" // lalr1.cc:859
+  case 649:
+#line 2236 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
@@ -3542,8 +3542,8 @@ namespace isc { namespace dhcp {
 #line 3543 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 647:
-#line 2236 "dhcp6_parser.yy" // lalr1.cc:859
+  case 650:
+#line 2242 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr flush(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush", flush);
@@ -3551,8 +3551,8 @@ namespace isc { namespace dhcp {
 #line 3552 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 648:
-#line 2241 "dhcp6_parser.yy" // lalr1.cc:859
+  case 651:
+#line 2247 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxsize(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxsize", maxsize);
@@ -3560,8 +3560,8 @@ namespace isc { namespace dhcp {
 #line 3561 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 649:
-#line 2246 "dhcp6_parser.yy" // lalr1.cc:859
+  case 652:
+#line 2252 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr maxver(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("maxver", maxver);
@@ -3569,8 +3569,44 @@ namespace isc { namespace dhcp {
 #line 3570 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
+  case 653:
+#line 2257 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr async(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("async", async);
+}
+#line 3579 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 654:
+#line 2262 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr qs(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("queue-size", qs);
+}
+#line 3588 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 655:
+#line 2267 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ctx.enter(ctx.NO_KEYWORD);
+}
+#line 3596 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 656:
+#line 2269 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr policy(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("overflow-policy", policy);
+    ctx.leave();
+}
+#line 3606 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
 
-#line 3574 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3610 "dhcp6_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -3832,112 +3868,113 @@ namespace isc { namespace dhcp {
   const short int
   Dhcp6Parser::yypact_[] =
   {
-     308,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,    51,    47,    46,    64,    68,
-      72,    86,   108,   152,   161,   211,   217,   233,   234,   249,
+     288,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,   118,    44,    50,   119,   129,
+     141,   155,   157,   158,   183,   184,   193,   221,   222,   235,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,    47,  -110,
-      39,    58,    45,   229,    94,    26,   355,   104,    77,    14,
-     -13,   357,   132,  -794,   274,   285,   302,   300,   307,  -794,
-    -794,  -794,  -794,  -794,   329,  -794,   115,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,   342,   345,   347,
-     349,   350,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,   352,  -794,  -794,
-    -794,   133,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,    44,    53,
+      42,    48,    57,   200,   226,   354,    68,   216,    54,   185,
+     -39,   303,   103,  -794,   254,   272,   283,   278,   315,  -794,
+    -794,  -794,  -794,  -794,   322,  -794,    72,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,   329,   331,   341,
+     355,   375,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,   377,  -794,  -794,
+    -794,    73,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,   353,  -794,   140,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,   361,   362,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,   147,  -794,  -794,  -794,  -794,
+    -794,   381,  -794,    76,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,   385,   388,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,   101,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,   157,  -794,  -794,
-    -794,  -794,  -794,   365,  -794,   370,   375,  -794,  -794,  -794,
-    -794,  -794,  -794,   164,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,   105,  -794,  -794,
+    -794,  -794,  -794,   399,  -794,   401,   403,  -794,  -794,  -794,
+    -794,  -794,  -794,   134,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,   351,   334,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,   373,  -794,  -794,   379,  -794,  -794,  -794,   381,  -794,
-    -794,   380,   358,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,   385,   388,  -794,  -794,
-    -794,  -794,   390,   418,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,   168,  -794,  -794,  -794,
-     419,  -794,  -794,   420,  -794,   421,   422,  -794,  -794,   423,
-     424,   427,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   172,
+    -794,   349,   406,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,   410,  -794,  -794,   429,  -794,  -794,  -794,   431,  -794,
+    -794,   428,   435,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,   465,   466,  -794,  -794,
+    -794,  -794,   464,   436,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,   135,  -794,  -794,  -794,
+     469,  -794,  -794,   470,  -794,   471,   472,  -794,  -794,   473,
+     474,   475,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   189,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   178,  -794,
-    -794,  -794,    47,    47,  -794,   272,   434,   435,   442,   444,
-     445,  -794,    39,  -794,   447,   448,   449,   450,   256,   289,
-     290,   291,   321,   484,   485,   486,   487,   489,   492,   497,
-     498,   499,   500,   501,   502,   503,   504,   506,   346,   507,
-     509,    58,  -794,   510,   356,    45,  -794,   511,   515,   519,
-     521,   522,   368,   359,   527,   529,   531,   532,   229,  -794,
-     533,    94,  -794,   534,   377,   535,   378,   382,    26,  -794,
-     541,   542,   543,   545,   546,   547,   548,  -794,   355,  -794,
-     549,   550,   389,   552,   553,   554,   391,  -794,    77,   556,
-     393,   394,  -794,    14,   559,   560,    10,  -794,   397,   562,
-     563,   402,   565,   404,   405,   568,   569,   407,   408,   409,
-     574,   575,   576,   577,   357,  -794,   578,   132,  -794,  -794,
-    -794,   579,   580,   581,    47,    47,    47,  -794,   582,   583,
-     584,   587,  -794,  -794,  -794,  -794,  -794,   588,   589,   591,
-     590,   433,   594,   595,   596,   597,   598,   599,   601,   602,
-     603,   604,  -794,   605,   606,  -794,   609,  -794,  -794,   610,
-     611,   438,   443,   452,  -794,  -794,   331,   609,   453,   612,
-    -794,   455,  -794,   456,  -794,   457,  -794,  -794,  -794,   609,
-     609,   609,   458,   459,   460,   461,  -794,   462,   463,  -794,
-     464,   465,   466,  -794,  -794,   467,  -794,  -794,  -794,   468,
-      47,  -794,  -794,   469,   470,  -794,   471,  -794,  -794,    76,
-     454,  -794,  -794,  -794,   -22,   472,   473,   474,  -794,   635,
-    -794,    47,    58,   132,  -794,  -794,  -794,    45,   203,   203,
-     634,   636,   637,   638,  -794,  -794,  -794,   639,    -7,    47,
-      29,   564,   640,   641,   642,   224,   136,   138,   357,  -794,
-    -794,   643,   644,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,    18,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   195,  -794,
+    -794,  -794,    44,    44,  -794,   312,   477,   478,   479,   480,
+     481,  -794,    42,  -794,   482,   483,   484,   485,   321,   324,
+     325,   327,   332,   487,   491,   498,   499,   500,   501,   502,
+     503,   504,   506,   507,   508,   509,   510,   511,   350,   516,
+     519,    48,  -794,   520,   356,    57,  -794,   521,   522,   527,
+     528,   529,   365,   364,   532,   533,   534,   535,   200,  -794,
+     539,   226,  -794,   540,   376,   542,   378,   379,   354,  -794,
+     545,   546,   547,   548,   549,   550,   551,  -794,    68,  -794,
+     552,   553,   389,   555,   556,   557,   391,  -794,    54,   559,
+     393,   394,  -794,   185,   562,   563,     3,  -794,   397,   565,
+     566,   402,   568,   404,   407,   571,   573,   408,   409,   411,
+     574,   577,   579,   580,   303,  -794,   581,   103,  -794,  -794,
+    -794,   582,   583,   584,    44,    44,    44,  -794,   585,   586,
+     587,   591,  -794,  -794,  -794,  -794,  -794,   592,   593,   594,
+     595,   419,   596,   598,   599,   600,   601,   602,   604,   605,
+     606,   607,  -794,   608,   609,  -794,   612,  -794,  -794,   613,
+     614,   420,   421,   432,  -794,  -794,   136,   612,   438,   615,
+    -794,   443,  -794,   452,  -794,   453,  -794,  -794,  -794,   612,
+     612,   612,   455,   456,   457,   458,  -794,   459,   460,  -794,
+     461,   462,   463,  -794,  -794,   467,  -794,  -794,  -794,   468,
+      44,  -794,  -794,   476,   486,  -794,   488,  -794,  -794,    52,
+     505,  -794,  -794,  -794,   159,   489,   490,   492,  -794,   627,
+    -794,    44,    48,   103,  -794,  -794,  -794,    57,   144,   144,
+     626,   631,   632,   633,  -794,  -794,  -794,   634,   -33,    44,
+      62,   564,   636,   638,   639,   359,    77,    20,   303,  -794,
+    -794,   640,   641,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,     8,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,   645,  -794,   189,
-     200,   213,  -794,  -794,  -794,  -794,   649,   650,   651,   652,
-     653,  -794,   654,   655,  -794,   656,   657,   658,  -794,   214,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,   642,  -794,   196,
+     215,   238,  -794,  -794,  -794,  -794,   630,   646,   647,   648,
+     649,  -794,   651,   655,  -794,   657,   658,   659,  -794,   247,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   246,  -794,
-     659,   660,  -794,  -794,   661,   663,  -794,  -794,   662,   666,
-    -794,  -794,   664,   668,  -794,  -794,   667,   669,  -794,  -794,
-    -794,   179,  -794,  -794,  -794,   670,  -794,  -794,  -794,   257,
-    -794,  -794,  -794,  -794,   247,  -794,  -794,  -794,   275,  -794,
-    -794,   671,   672,  -794,  -794,   673,   675,  -794,   676,   677,
-     678,   679,   680,   681,   250,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,   682,   683,   684,  -794,  -794,  -794,
-    -794,   267,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,   268,  -794,  -794,  -794,   271,   524,  -794,
-     685,   687,  -794,  -794,   686,   690,  -794,  -794,  -794,   688,
-    -794,  -794,   284,  -794,  -794,  -794,  -794,   691,   693,   694,
-     695,   508,   416,   528,   417,   536,   696,   537,   538,   697,
-     539,   540,   441,   203,  -794,  -794,   203,  -794,   634,   229,
-    -794,   636,    77,  -794,   637,    14,  -794,   638,   367,  -794,
-     639,    -7,  -794,  -794,    29,  -794,   703,   564,  -794,    82,
-     640,  -794,   355,  -794,   641,   -13,  -794,   642,   544,   551,
-     555,   557,   558,   561,   224,  -794,   704,   705,   566,   567,
-     570,   136,  -794,   707,   708,   138,  -794,  -794,  -794,   709,
-     710,    94,  -794,   643,    26,  -794,   644,   712,  -794,   121,
-     645,  -794,   395,   572,   573,   585,  -794,  -794,  -794,  -794,
-    -794,   615,  -794,  -794,   617,  -794,  -794,  -794,  -794,   281,
-    -794,   296,  -794,   706,  -794,   711,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   250,  -794,
+     660,   661,  -794,  -794,   662,   664,  -794,  -794,   663,   667,
+    -794,  -794,   665,   669,  -794,  -794,   668,   670,  -794,  -794,
+    -794,    55,  -794,  -794,  -794,   671,  -794,  -794,  -794,   214,
+    -794,  -794,  -794,  -794,   282,  -794,  -794,  -794,   246,  -794,
+    -794,   672,   673,  -794,  -794,   674,   676,  -794,   677,   678,
+     679,   680,   681,   682,   302,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,   683,   684,   685,  -794,  -794,  -794,
+    -794,   305,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,   326,  -794,  -794,  -794,   333,   497,  -794,
+     686,   687,  -794,  -794,   688,   690,  -794,  -794,  -794,   689,
+    -794,  -794,   295,  -794,  -794,  -794,  -794,   691,   692,   694,
+     695,   531,   441,   536,   530,   537,   698,   538,   541,   699,
+     543,   544,   554,   144,  -794,  -794,   144,  -794,   626,   200,
+    -794,   631,    54,  -794,   632,   185,  -794,   633,   234,  -794,
+     634,   -33,  -794,  -794,    62,  -794,   700,   564,  -794,    33,
+     636,  -794,    68,  -794,   638,   -39,  -794,   639,   558,   560,
+     561,   567,   569,   572,   359,  -794,   704,   705,   575,   578,
+     611,    77,  -794,   707,   710,    20,  -794,  -794,  -794,   709,
+     713,   226,  -794,   640,   354,  -794,   641,   714,  -794,    83,
+     642,  -794,   444,   523,   588,   621,  -794,  -794,  -794,  -794,
+    -794,   624,  -794,  -794,   628,  -794,  -794,  -794,  -794,   334,
+    -794,   343,  -794,   711,  -794,   712,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-     297,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   624,
-    -794,  -794,   714,  -794,  -794,  -794,  -794,  -794,   717,   719,
-    -794,  -794,  -794,  -794,  -794,   718,  -794,   299,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,   212,   627,  -794,  -794,
-    -794,  -794,   630,   631,  -794,  -794,   633,   311,  -794,   326,
-    -794,   647,  -794,   716,  -794,  -794,  -794,  -794,  -794,   327,
+     346,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   644,
+    -794,  -794,   717,  -794,  -794,  -794,  -794,  -794,   715,   719,
+    -794,  -794,  -794,  -794,  -794,   716,  -794,   353,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,   362,   645,  -794,  -794,
+    -794,  -794,   652,   654,  -794,  -794,   675,   366,  -794,   380,
+    -794,   693,  -794,   722,  -794,  -794,  -794,  -794,  -794,   396,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   367,
-    -794,  -794,   724,   496,  -794,    82,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   725,
-     648,   726,   121,  -794,  -794,   665,  -794,  -794,   729,  -794,
-     674,  -794,  -794,   728,  -794,  -794,   339,  -794,    48,   728,
-    -794,  -794,   727,   736,   737,   333,  -794,  -794,  -794,  -794,
-    -794,  -794,   740,   593,   689,   692,    48,  -794,   698,  -794,
-    -794,  -794,  -794,  -794
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   234,
+    -794,  -794,   724,   590,  -794,    33,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   727,
+     629,   728,    83,  -794,  -794,   696,  -794,  -794,   729,  -794,
+     697,  -794,  -794,   726,  -794,  -794,   301,  -794,   174,   726,
+    -794,  -794,   731,   733,   736,   742,   745,  -794,   398,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   746,   597,
+     635,   650,   637,   656,   749,   174,  -794,   701,  -794,  -794,
+    -794,  -794,  -794,   702,  -794,  -794,  -794
   };
 
   const unsigned short int
@@ -4046,52 +4083,54 @@ namespace isc { namespace dhcp {
      525,   522,   528,   542,   544,    56,   394,   419,   486,     0,
        0,     0,     0,   620,   300,     0,   507,   496,     0,   630,
        0,   622,   506,     0,   632,   637,     0,   635,     0,     0,
-     634,   645,     0,     0,     0,     0,   639,   641,   642,   643,
-     644,   636,     0,     0,     0,     0,     0,   638,     0,   647,
-     648,   649,   640,   646
+     634,   648,     0,     0,     0,     0,     0,   655,     0,   639,
+     641,   642,   643,   644,   645,   646,   647,   636,     0,     0,
+       0,     0,     0,     0,     0,     0,   638,     0,   650,   651,
+     652,   653,   654,     0,   640,   649,   656
   };
 
   const short int
   Dhcp6Parser::yypgoto_[] =
   {
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,    34,  -794,   266,  -794,
-    -794,  -794,  -794,  -794,  -794,   170,  -794,  -429,  -794,  -794,
-    -794,   -70,  -794,  -794,  -794,   401,  -794,  -794,  -794,  -794,
-     185,   387,   -66,   -54,   -51,   -34,  -794,  -794,  -794,  -794,
-    -794,   235,   371,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,    -4,  -794,  -545,    -3,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,    34,  -794,   237,  -794,
+    -794,  -794,  -794,  -794,  -794,    96,  -794,  -447,  -794,  -794,
+    -794,   -70,  -794,  -794,  -794,   430,  -794,  -794,  -794,  -794,
+     233,   426,   -66,   -54,   -51,   -34,  -794,  -794,  -794,  -794,
+    -794,   249,   415,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,    -6,  -794,  -545,    11,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   -42,  -794,
     -574,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,   -20,  -794,  -794,  -794,
-    -794,  -794,    -5,  -567,  -794,  -794,  -794,  -794,   -16,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,   -24,  -794,  -794,
-    -794,   -18,   383,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-     -19,  -794,  -794,  -794,  -794,  -794,  -794,  -793,  -794,  -794,
-    -794,     9,  -794,  -794,  -794,    13,   428,  -794,  -794,  -787,
+    -794,  -794,  -794,  -794,  -794,  -794,   -10,  -794,  -794,  -794,
+    -794,  -794,     5,  -567,  -794,  -794,  -794,  -794,     4,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,    -7,  -794,  -794,
+    -794,    -3,   405,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+     -15,  -794,  -794,  -794,  -794,  -794,  -794,  -793,  -794,  -794,
+    -794,    24,  -794,  -794,  -794,    28,   440,  -794,  -794,  -787,
     -794,  -784,  -794,   -30,  -794,   -28,  -794,  -780,  -794,  -794,
-    -794,  -778,  -794,  -794,  -794,  -794,     8,  -794,  -794,  -160,
-     755,  -794,  -794,  -794,  -794,  -794,    21,  -794,  -794,  -794,
-      25,  -794,   410,  -794,   -38,  -794,  -794,  -794,  -794,  -794,
+    -794,  -778,  -794,  -794,  -794,  -794,    19,  -794,  -794,  -149,
+     765,  -794,  -794,  -794,  -794,  -794,    30,  -794,  -794,  -794,
+      35,  -794,   417,  -794,   -38,  -794,  -794,  -794,  -794,  -794,
      -36,  -794,  -794,  -794,  -794,  -794,    -8,  -794,  -794,  -794,
-      23,  -794,  -794,  -794,    27,  -794,   411,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   -17,  -794,
-    -794,  -794,   -14,   440,  -794,  -794,   -58,  -794,   -46,  -794,
-    -794,  -794,  -794,  -794,   -23,  -794,  -794,  -794,   -15,   437,
+      29,  -794,  -794,  -794,    36,  -794,   416,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,   -13,  -794,
+    -794,  -794,    -9,   447,  -794,  -794,   -58,  -794,   -46,  -794,
+    -794,  -794,  -794,  -794,   -12,  -794,  -794,  -794,    -5,   449,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,   -31,  -794,  -794,
-    -794,    16,  -794,  -794,  -794,    19,  -794,   430,   252,  -794,
+    -794,    21,  -794,  -794,  -794,    26,  -794,   442,   260,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -770,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-      22,  -794,  -794,  -794,  -138,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,    11,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,  -794,     4,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,  -794,   273,   406,  -794,  -794,  -794,  -794,
+      37,  -794,  -794,  -794,  -132,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,    15,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,  -794,    13,  -794,  -794,  -794,  -794,
+    -794,  -794,  -794,  -794,   284,   422,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
     -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
-    -794,  -794,  -794,   301,   412,  -794,  -794,  -794,    -2,  -794,
-    -794,  -147,  -794,  -794,  -794,  -794,  -794,  -794,  -163,  -794,
-    -794,  -179,  -794,  -794,  -794,  -794,  -794
+    -794,  -794,  -794,   308,   418,  -794,  -794,  -794,     7,  -794,
+    -794,  -139,  -794,  -794,  -794,  -794,  -794,  -794,  -155,  -794,
+    -794,  -177,  -794,  -794,  -794,  -794,  -794,  -794,  -794,  -794,
+    -794
   };
 
   const short int
@@ -4134,7 +4173,8 @@ namespace isc { namespace dhcp {
      452,   336,   453,    99,   348,   100,   349,   101,   350,   102,
      347,    67,    82,   338,   339,   340,   456,   782,   783,   869,
      969,   970,   971,   972,  1011,   973,  1009,  1026,  1027,  1028,
-    1035,  1036,  1037,  1042,  1038,  1039,  1040
+    1038,  1039,  1040,  1048,  1041,  1042,  1043,  1044,  1045,  1046,
+    1054
   };
 
   const unsigned short int
@@ -4144,90 +4184,90 @@ namespace isc { namespace dhcp {
      295,   316,   748,   708,   167,   197,   210,   221,   239,   182,
      273,   291,   183,   317,   678,   903,   168,   198,   211,   222,
      240,   904,   274,   292,   905,   318,   260,   279,   908,   184,
-     909,   280,   200,   281,   204,   218,   205,   219,   915,    89,
-      38,    30,    31,    42,    32,    86,    33,   160,   161,   253,
-     275,   254,   255,   276,   277,   195,   206,   220,   238,   103,
-     114,    44,   104,   105,   106,    46,   115,   116,   600,    48,
-     699,   293,   294,   212,   213,   214,   215,   216,   115,   116,
-     606,   607,   608,    50,   252,   107,   108,   109,   110,   111,
-     112,   113,   114,   231,   293,   294,   177,   115,   116,   178,
-     777,   628,   629,   630,   631,    52,   699,   706,   352,   707,
-     115,   116,   253,   353,   254,   255,   114,   253,   256,   257,
-     258,   117,   118,   119,   120,   121,   381,   122,   114,   115,
-     116,   382,   123,   385,   115,   116,   632,   113,   386,   202,
-     398,   124,    94,   742,   125,   399,   115,   116,   700,    54,
-     401,   126,   647,   921,   922,   402,   253,   408,    56,   127,
-     128,   436,   409,   129,   177,   454,   437,   178,    90,    94,
-     455,   457,   821,   115,   116,   822,   458,    91,    92,    93,
-    1031,    94,   381,  1032,  1033,  1034,   903,   784,   115,   116,
-     115,   116,   904,   457,    94,   905,   624,   625,   785,   908,
-      94,   909,    34,    35,    36,    37,   385,   803,    58,   915,
-     642,   786,   804,    94,    60,   643,   644,   645,   646,   647,
-     648,   649,   650,   651,   652,   653,   654,   655,   656,   657,
-      62,    64,    94,   743,   744,   745,   746,    94,   253,   803,
-     827,   758,   759,   844,   805,   828,    66,   708,   845,    94,
-     824,   889,   962,   825,   963,   964,   107,   108,   109,   110,
-     851,   855,   337,   114,   454,   852,   856,   748,   830,   857,
-     341,   831,    95,   169,   803,   170,    94,   870,   342,   985,
-     871,   115,   116,   171,   172,   173,   174,   175,   176,   398,
-     989,    94,   436,    94,   986,   990,   343,   997,   344,   177,
-     345,   130,   178,   123,   401,   162,   998,   999,  1000,  1006,
-     179,   728,   729,   730,   731,   732,   733,   167,   180,   408,
-    1012,   203,   181,   351,  1007,  1013,  1046,   418,   217,   168,
-     197,  1047,  1029,   210,   182,  1030,   358,   183,   237,   359,
-     221,   360,   198,   361,   362,   211,   378,   384,   259,   417,
-     239,   428,   222,   278,   184,   392,   393,   200,    94,   404,
-     273,   204,   240,   205,   406,   291,   459,   460,   218,   407,
-     219,   419,   274,   422,   316,   426,   260,   292,   427,   430,
-     195,   279,   431,   206,    94,   280,   317,   281,   432,   114,
-     220,   596,   597,   598,   107,   108,   109,   110,   318,   112,
-     238,   114,   253,   975,   976,   977,   978,   115,   116,   115,
-     116,   433,   472,   438,   441,   443,   444,   447,   448,   115,
-     116,   449,   172,   173,   230,   175,   176,   461,   462,   463,
-     231,   232,   233,   234,   235,   236,   464,   177,   465,   466,
-     178,   468,   469,   470,   471,   473,   474,   475,   179,     1,
-       2,     3,     4,     5,     6,     7,     8,     9,    10,    11,
-      12,    13,    14,   300,   301,   302,   303,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   476,   477,   478,
-     479,   480,   130,   481,   314,   315,   482,   162,   564,   565,
-     566,   483,   484,   485,   486,   487,   488,   489,   490,   167,
-     491,   493,   492,   494,   496,   499,   747,   760,   316,   500,
-      94,   168,    94,   501,   497,   502,   503,   505,   749,   761,
-     317,   506,    94,   507,   504,   508,   509,   511,   513,   515,
-     750,   762,   318,   514,   516,   519,   520,   521,   517,   522,
-     523,   524,   525,   527,   528,   529,   530,   531,   532,   533,
-     535,   536,   537,   539,   540,   542,   543,   544,   545,   546,
-     547,   548,   549,   550,   620,   551,   552,   553,   554,   555,
-     556,   557,   559,   561,   877,   879,   627,   562,   563,   567,
-     568,   569,   570,   571,   572,   638,   573,    32,   576,   577,
-     578,   579,   580,   593,   582,   581,   583,   584,   594,   887,
-     585,   586,   587,   588,   589,   591,   592,   595,   601,   602,
-     603,   604,   605,   609,   610,   611,   612,   613,   614,   615,
-     616,   617,   618,   619,   621,   622,   623,   634,   635,   636,
-     637,   679,   713,   683,   687,   691,   695,   717,   720,   724,
-     769,   773,   781,   791,   792,   793,   794,   795,   797,   798,
-     800,   801,   802,   808,  1016,   807,   811,   810,   813,   814,
-     816,   817,   820,   819,   876,   834,   823,   833,   837,   836,
-     838,   839,   840,   841,   842,   843,   848,   849,   850,   858,
-     863,   862,   865,   866,   878,   872,   868,   873,   874,   875,
-     881,   884,   880,   882,   883,   885,   886,   919,   946,   947,
-     939,   952,   953,   956,   987,   955,   961,   940,   993,   988,
-    1010,   941,   995,   942,   943,   994,   996,   944,  1015,  1018,
-    1020,  1043,   948,   949,  1023,  1025,   950,   980,   981,   180,
-    1044,  1045,   259,   181,  1048,   278,   574,   639,   897,   705,
-     982,   197,   898,   467,   273,   182,   498,   291,   183,   923,
-     913,  1049,   237,   198,   899,   295,   274,   900,   495,   292,
+     909,   280,   200,   281,   204,   218,   205,   219,   915,    31,
+      38,    32,    89,    33,   699,   293,   294,    42,   821,   103,
+     600,   822,   104,   105,   106,   195,   206,   220,   238,   160,
+     161,   252,   606,   607,   608,   352,   381,   114,   253,   385,
+     353,   382,   115,   116,   386,   107,   108,   109,   110,   111,
+     112,   113,   114,   231,   742,   115,   116,   293,   294,   253,
+     777,   254,   255,   647,   398,   256,   257,   258,   401,   399,
+     115,   116,   114,   402,   921,   922,   115,   116,    30,   115,
+     116,   117,   118,   119,   120,   121,    44,   122,   253,    94,
+     115,   116,   123,   758,   759,   700,    46,   408,   436,   115,
+     116,   124,   409,   437,   125,   115,   116,   230,    48,   699,
+     706,   126,   707,   231,   232,   233,   234,   235,   236,   127,
+     128,   642,    50,   129,    52,    54,   643,   644,   645,   646,
+     647,   648,   649,   650,   651,   652,   653,   654,   655,   656,
+     657,    90,   624,   625,   743,   744,   745,   746,    94,   253,
+      56,    58,   454,    91,    92,    93,   903,   455,   457,   381,
+      60,    94,   904,   458,   784,   905,   596,   597,   598,   908,
+      94,   909,    34,    35,    36,    37,    94,   824,   457,   915,
+     825,    86,    94,   785,   962,    94,   963,   964,    62,    64,
+     253,   275,   254,   255,   276,   277,    94,   107,   108,   109,
+     110,   385,    66,   337,   114,    94,   786,   115,   116,   830,
+     803,    94,   831,   803,   169,   804,   170,   708,   805,   113,
+     341,   889,   115,   116,   171,   172,   173,   174,   175,   176,
+     114,   107,   108,   109,   110,   342,   112,   748,   114,   253,
+     177,   202,    95,   178,   123,   827,   344,   343,   115,   116,
+     828,   179,   628,   629,   630,   631,   115,   116,   870,   172,
+     173,   871,   175,   176,  1029,   844,   177,  1030,   851,   178,
+     845,   130,    94,   852,   177,   162,  1031,   178,   345,  1032,
+    1033,  1034,  1035,  1036,  1037,   179,   351,   167,   180,   855,
+     632,   203,   181,   358,   856,   359,   454,   803,   217,   168,
+     197,   857,   985,   210,   182,   360,   398,   183,   237,   989,
+     221,   986,   198,    94,   990,   211,   436,   417,   259,   361,
+     239,   997,   222,   278,   184,   115,   116,   200,    94,   401,
+     273,   204,   240,   205,  1006,   291,   459,   460,   218,   362,
+     219,   378,   274,   408,   316,   384,   260,   292,  1007,   392,
+     195,   279,   393,   206,    94,   280,   317,   281,   114,  1012,
+     220,  1055,    94,   404,  1013,   406,  1056,   407,   318,   418,
+     238,   212,   213,   214,   215,   216,   115,   116,   419,   300,
+     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
+     311,   312,   313,   422,   177,   426,   427,   178,   428,   433,
+     314,   315,     1,     2,     3,     4,     5,     6,     7,     8,
+       9,    10,    11,    12,    13,    14,   728,   729,   730,   731,
+     732,   733,   975,   976,   977,   978,   998,   999,  1000,   430,
+     431,    94,   432,   438,   441,   443,   444,   447,   448,   449,
+     461,   462,   463,   464,   465,   466,   468,   469,   470,   471,
+     472,   477,   130,   473,   474,   478,   475,   162,   564,   565,
+     566,   476,   479,   480,   481,   482,   483,   484,   485,   167,
+     486,   487,   488,   489,   490,   491,   747,   760,   316,   492,
+     493,   168,    94,   494,   496,   499,   500,   497,   749,   761,
+     317,   501,   502,   503,   504,   505,   506,   507,   508,   509,
+     750,   762,   318,   511,   513,   514,   515,   516,   517,   519,
+     520,   521,   522,   523,   524,   525,   527,   528,   529,   530,
+     531,   532,   533,   535,   536,   537,   539,   540,   542,   543,
+     544,   545,   546,   547,   620,   549,   548,   550,   554,   551,
+     552,   555,   553,   556,   557,   559,   561,   576,   593,   594,
+     562,   563,   567,   568,   569,   638,   570,   571,   572,   573,
+     595,   577,    32,   578,   579,   580,   601,   582,   581,   583,
+     584,   603,   877,   585,   586,   587,   588,   589,   591,   592,
+     604,   605,   602,   609,   610,   611,   612,   613,   614,   615,
+     616,   617,   637,   679,   791,   618,   619,   627,   683,   687,
+     691,   695,   713,   717,   621,   720,   724,   769,   773,   781,
+     792,   793,   794,   795,   622,   797,   623,   634,   635,   798,
+     636,   800,   801,   802,   808,   858,   807,   811,   810,   813,
+     814,   816,   817,   820,   819,   705,   834,   823,   833,   837,
+     836,   838,   839,   840,   841,   842,   843,   848,   849,   850,
+     863,   980,   862,   866,   865,   872,   873,   868,   874,   875,
+     876,   879,   881,   884,   919,   878,   880,   882,   946,   947,
+     883,   952,   885,   886,   953,   955,   956,   574,   961,   987,
+     988,   993,   995,   994,   996,   887,  1010,   939,  1015,   940,
+     941,  1018,  1020,  1025,  1023,  1049,   942,  1050,   943,   180,
+    1051,   944,   259,   181,   948,   278,  1052,   949,   897,  1053,
+    1057,   197,   898,  1063,   273,   182,   981,   291,   183,   923,
+     913,  1016,   237,   198,   899,   295,   274,   900,  1058,   292,
      260,   926,   914,   279,   239,   184,   902,   280,   200,   281,
-     983,   747,   984,   927,   901,   760,   240,   924,   906,   991,
-     907,   203,  1002,   749,   217,  1003,  1004,   761,  1005,   965,
-     888,   195,   641,   210,   890,   750,   221,   920,   918,   762,
-     912,   967,  1008,   938,  1019,   211,   917,   937,   222,   541,
-     892,   925,   891,   968,   238,   945,   510,   966,   916,  1014,
-    1022,   204,   251,   205,   218,   894,   219,   893,   534,  1024,
-     896,   512,   895,   960,   538,   518,   958,   957,   526,   959,
-     936,   935,   934,   206,   778,  1050,   220,  1017,  1051,   954,
-     558,   767,   951,  1053,   640,  1021,  1041,  1052,   974,   560,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+     950,   747,   467,   927,   901,   760,   240,   924,   906,   982,
+     907,   203,   983,   749,   217,   639,   984,   761,  1019,   965,
+     498,   195,   890,   210,  1059,   750,   221,   495,  1061,   762,
+     912,   967,   991,  1002,   888,   211,   641,   920,   222,  1060,
+    1003,   925,  1004,   968,   238,  1062,   917,   966,   918,   945,
+     938,   204,   937,   205,   218,   892,   219,   891,   510,   916,
+    1014,   541,   251,  1005,   894,   534,   896,   893,   512,   538,
+     958,   895,   957,   206,   960,   936,   220,   518,   935,   959,
+     526,  1008,   778,  1017,  1022,  1024,   951,   934,   954,  1065,
+    1066,   640,   767,  1021,  1047,   560,   558,   974,  1064,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -4248,90 +4288,90 @@ namespace isc { namespace dhcp {
       80,    81,   586,   580,    72,    73,    74,    75,    76,    73,
       78,    79,    73,    81,   569,   818,    72,    73,    74,    75,
       76,   818,    78,    79,   818,    81,    78,    79,   818,    73,
-     818,    79,    73,    79,    74,    75,    74,    75,   818,    10,
-      16,     0,     5,     7,     7,   165,     9,    12,    13,    45,
-      46,    47,    48,    49,    50,    73,    74,    75,    76,    11,
-      44,     7,    14,    15,    16,     7,    62,    63,   507,     7,
-      87,    94,    95,    57,    58,    59,    60,    61,    62,    63,
-     519,   520,   521,     7,    17,    37,    38,    39,    40,    41,
-      42,    43,    44,    85,    94,    95,    80,    62,    63,    83,
-      92,   133,   134,   135,   136,     7,    87,    88,     3,    90,
-      62,    63,    45,     8,    47,    48,    44,    45,    51,    52,
-      53,    73,    74,    75,    76,    77,     3,    79,    44,    62,
-      63,     8,    84,     3,    62,    63,   168,    43,     8,    55,
-       3,    93,   165,    17,    96,     8,    62,    63,   165,     7,
-       3,   103,    26,    81,    82,     8,    45,     3,     7,   111,
-     112,     3,     8,   115,    80,     3,     8,    83,   139,   165,
-       8,     3,     3,    62,    63,     6,     8,   148,   149,   150,
-     142,   165,     3,   145,   146,   147,   989,     8,    62,    63,
-      62,    63,   989,     3,   165,   989,   130,   131,     8,   989,
-     165,   989,   165,   166,   167,   168,     3,     3,     7,   989,
-      17,     8,     8,   165,     7,    22,    23,    24,    25,    26,
-      27,    28,    29,    30,    31,    32,    33,    34,    35,    36,
-       7,     7,   165,   107,   108,   109,   110,   165,    45,     3,
-       3,   113,   114,     3,     8,     8,     7,   824,     8,   165,
-       3,   806,   141,     6,   143,   144,    37,    38,    39,    40,
-       3,     3,   140,    44,     3,     8,     8,   851,     3,     8,
-       6,     6,   352,    54,     3,    56,   165,     3,     3,     8,
-       6,    62,    63,    64,    65,    66,    67,    68,    69,     3,
-       3,   165,     3,   165,     8,     8,     4,     8,     8,    80,
-       3,   381,    83,    84,     3,   385,   104,   105,   106,     8,
-      91,    97,    98,    99,   100,   101,   102,   385,   398,     3,
-       3,   401,   398,     4,     8,     8,     3,     3,   408,   385,
-     398,     8,     3,   401,   398,     6,     4,   398,   418,     4,
-     408,     4,   398,     4,     4,   401,     4,     4,   428,     8,
-     418,     3,   408,   433,   398,     4,     4,   398,   165,     4,
-     428,   401,   418,   401,     4,   433,   342,   343,   408,     4,
-     408,     8,   428,     4,   454,     4,   428,   433,     8,     4,
-     398,   433,     4,   401,   165,   433,   454,   433,     8,    44,
-     408,    70,    71,    72,    37,    38,    39,    40,   454,    42,
-     418,    44,    45,    18,    19,    20,    21,    62,    63,    62,
-      63,     3,   166,     4,     4,     4,     4,     4,     4,    62,
-      63,     4,    65,    66,    79,    68,    69,   165,     4,     4,
-      85,    86,    87,    88,    89,    90,     4,    80,     4,     4,
-      83,     4,     4,     4,     4,   166,   166,   166,    91,   151,
-     152,   153,   154,   155,   156,   157,   158,   159,   160,   161,
-     162,   163,   164,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   166,     4,     4,
-       4,     4,   562,     4,   137,   138,     4,   567,   464,   465,
-     466,     4,     4,     4,     4,     4,     4,     4,     4,   567,
-       4,     4,   166,     4,     4,     4,   586,   587,   588,     4,
-     165,   567,   165,     4,   168,     4,     4,   168,   586,   587,
-     588,     4,   165,     4,   166,     4,     4,     4,     4,     4,
-     586,   587,   588,   166,   166,     4,     4,     4,   166,     4,
-       4,     4,     4,     4,     4,   166,     4,     4,     4,   168,
-       4,   168,   168,     4,     4,   168,     4,     4,   166,     4,
-     166,   166,     4,     4,   540,   168,   168,   168,     4,     4,
-       4,     4,     4,     4,   168,   168,   132,     7,     7,     7,
-       7,     7,     5,     5,     5,   561,     5,     7,   165,     5,
-       5,     5,     5,   165,     5,     7,     5,     5,   165,   168,
-       7,     7,     7,     7,     5,     5,     5,   165,   165,     7,
-     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
-     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
-       5,     7,    78,     7,     7,     7,     7,     7,     7,     7,
-       7,     7,     7,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     3,   168,     6,     3,     6,     6,     3,
-       6,     3,     3,     6,   166,     3,     6,     6,     3,     6,
-       4,     4,     4,     4,     4,     4,     4,     4,     4,   165,
-       3,     6,     6,     3,   166,     4,     8,     4,     4,     4,
-       4,     4,   166,   166,   166,   166,   166,     4,     4,     4,
-     166,     4,     4,     3,     8,     6,     4,   166,     4,     8,
-       4,   166,     3,   166,   166,     8,     8,   166,     4,     4,
-       4,     4,   166,   166,     5,     7,   166,   165,   165,   809,
-       4,     4,   812,   809,     4,   815,   480,   562,   818,   579,
-     165,   809,   818,   352,   812,   809,   385,   815,   809,   829,
-     818,   168,   832,   809,   818,   835,   812,   818,   381,   815,
+     818,    79,    73,    79,    74,    75,    74,    75,   818,     5,
+      16,     7,    10,     9,    87,    94,    95,     7,     3,    11,
+     507,     6,    14,    15,    16,    73,    74,    75,    76,    12,
+      13,    17,   519,   520,   521,     3,     3,    44,    45,     3,
+       8,     8,    62,    63,     8,    37,    38,    39,    40,    41,
+      42,    43,    44,    85,    17,    62,    63,    94,    95,    45,
+      92,    47,    48,    26,     3,    51,    52,    53,     3,     8,
+      62,    63,    44,     8,    81,    82,    62,    63,     0,    62,
+      63,    73,    74,    75,    76,    77,     7,    79,    45,   168,
+      62,    63,    84,   113,   114,   168,     7,     3,     3,    62,
+      63,    93,     8,     8,    96,    62,    63,    79,     7,    87,
+      88,   103,    90,    85,    86,    87,    88,    89,    90,   111,
+     112,    17,     7,   115,     7,     7,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,    32,    33,    34,    35,
+      36,   139,   130,   131,   107,   108,   109,   110,   168,    45,
+       7,     7,     3,   151,   152,   153,   989,     8,     3,     3,
+       7,   168,   989,     8,     8,   989,    70,    71,    72,   989,
+     168,   989,   168,   169,   170,   171,   168,     3,     3,   989,
+       6,   168,   168,     8,   141,   168,   143,   144,     7,     7,
+      45,    46,    47,    48,    49,    50,   168,    37,    38,    39,
+      40,     3,     7,   140,    44,   168,     8,    62,    63,     3,
+       3,   168,     6,     3,    54,     8,    56,   824,     8,    43,
+       6,   806,    62,    63,    64,    65,    66,    67,    68,    69,
+      44,    37,    38,    39,    40,     3,    42,   851,    44,    45,
+      80,    55,   352,    83,    84,     3,     8,     4,    62,    63,
+       8,    91,   133,   134,   135,   136,    62,    63,     3,    65,
+      66,     6,    68,    69,     3,     3,    80,     6,     3,    83,
+       8,   381,   168,     8,    80,   385,   142,    83,     3,   145,
+     146,   147,   148,   149,   150,    91,     4,   385,   398,     3,
+     171,   401,   398,     4,     8,     4,     3,     3,   408,   385,
+     398,     8,     8,   401,   398,     4,     3,   398,   418,     3,
+     408,     8,   398,   168,     8,   401,     3,     8,   428,     4,
+     418,     8,   408,   433,   398,    62,    63,   398,   168,     3,
+     428,   401,   418,   401,     8,   433,   342,   343,   408,     4,
+     408,     4,   428,     3,   454,     4,   428,   433,     8,     4,
+     398,   433,     4,   401,   168,   433,   454,   433,    44,     3,
+     408,     3,   168,     4,     8,     4,     8,     4,   454,     3,
+     418,    57,    58,    59,    60,    61,    62,    63,     8,   116,
+     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
+     127,   128,   129,     4,    80,     4,     8,    83,     3,     3,
+     137,   138,   154,   155,   156,   157,   158,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,    97,    98,    99,   100,
+     101,   102,    18,    19,    20,    21,   104,   105,   106,     4,
+       4,   168,     8,     4,     4,     4,     4,     4,     4,     4,
+     168,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+     169,     4,   562,   169,   169,     4,   169,   567,   464,   465,
+     466,   169,     4,     4,     4,     4,     4,     4,     4,   567,
+       4,     4,     4,     4,     4,     4,   586,   587,   588,   169,
+       4,   567,   168,     4,     4,     4,     4,   171,   586,   587,
+     588,     4,     4,     4,   169,   171,     4,     4,     4,     4,
+     586,   587,   588,     4,     4,   169,     4,   169,   169,     4,
+       4,     4,     4,     4,     4,     4,     4,     4,   169,     4,
+       4,     4,   171,     4,   171,   171,     4,     4,   171,     4,
+       4,   169,     4,   169,   540,     4,   169,     4,     4,   171,
+     171,     4,   171,     4,     4,     4,     4,   168,   168,   168,
+       7,     7,     7,     7,     7,   561,     5,     5,     5,     5,
+     168,     5,     7,     5,     5,     5,   168,     5,     7,     5,
+       5,   168,   171,     7,     7,     7,     7,     5,     5,     5,
+     168,   168,     7,   168,   168,   168,   168,   168,   168,   168,
+     168,   168,     5,     7,     4,   168,   168,   132,     7,     7,
+       7,     7,    78,     7,   168,     7,     7,     7,     7,     7,
+       4,     4,     4,     4,   168,     4,   168,   168,   168,     4,
+     168,     4,     4,     4,     3,   168,     6,     3,     6,     6,
+       3,     6,     3,     3,     6,   579,     3,     6,     6,     3,
+       6,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       3,   168,     6,     3,     6,     4,     4,     8,     4,     4,
+     169,   171,     4,     4,     4,   169,   169,   169,     4,     4,
+     169,     4,   169,   169,     4,     6,     3,   480,     4,     8,
+       8,     4,     3,     8,     8,   171,     4,   169,     4,   169,
+     169,     4,     4,     7,     5,     4,   169,     4,   169,   809,
+       4,   169,   812,   809,   169,   815,     4,   169,   818,     4,
+       4,   809,   818,     4,   812,   809,   168,   815,   809,   829,
+     818,   171,   832,   809,   818,   835,   812,   818,   171,   815,
      812,   829,   818,   815,   832,   809,   818,   815,   809,   815,
-     165,   851,   165,   829,   818,   855,   832,   829,   818,   165,
-     818,   861,   165,   851,   864,   165,   165,   855,   165,   869,
-     803,   809,   567,   861,   808,   851,   864,   827,   824,   855,
-     818,   869,   165,   837,   166,   861,   821,   835,   864,   436,
-     811,   829,   809,   869,   832,   844,   398,   869,   820,   989,
-     165,   861,    77,   861,   864,   814,   864,   812,   428,   165,
-     817,   401,   815,   866,   433,   408,   863,   861,   418,   864,
-     834,   832,   830,   861,   602,   166,   864,   995,   166,   855,
-     454,   588,   851,   165,   563,  1012,  1029,  1046,   870,   457,
-      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+     169,   851,   352,   829,   818,   855,   832,   829,   818,   168,
+     818,   861,   168,   851,   864,   562,   168,   855,   169,   869,
+     385,   809,   808,   861,   169,   851,   864,   381,   171,   855,
+     818,   869,   168,   168,   803,   861,   567,   827,   864,   169,
+     168,   829,   168,   869,   832,   169,   821,   869,   824,   844,
+     837,   861,   835,   861,   864,   811,   864,   809,   398,   820,
+     989,   436,    77,   168,   814,   428,   817,   812,   401,   433,
+     863,   815,   861,   861,   866,   834,   864,   408,   832,   864,
+     418,   168,   602,   995,   168,   168,   851,   830,   855,   168,
+     168,   563,   588,  1012,  1029,   457,   454,   870,  1055,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
@@ -4348,182 +4388,184 @@ namespace isc { namespace dhcp {
   const unsigned short int
   Dhcp6Parser::yystos_[] =
   {
-       0,   151,   152,   153,   154,   155,   156,   157,   158,   159,
-     160,   161,   162,   163,   164,   170,   171,   172,   173,   174,
-     175,   176,   177,   178,   179,   180,   181,   182,   183,   184,
-       0,     5,     7,     9,   165,   166,   167,   168,   185,   186,
-     187,   192,     7,   201,     7,   207,     7,   218,     7,   312,
-       7,   389,     7,   405,     7,   422,     7,   341,     7,   347,
-       7,   371,     7,   288,     7,   481,     7,   520,   193,   188,
-     202,   208,   219,   313,   390,   406,   423,   342,   348,   372,
-     289,   482,   521,   185,   194,   195,   165,   190,   191,    10,
-     139,   148,   149,   150,   165,   200,   203,   204,   205,   512,
-     514,   516,   518,    11,    14,    15,    16,    37,    38,    39,
+       0,   154,   155,   156,   157,   158,   159,   160,   161,   162,
+     163,   164,   165,   166,   167,   173,   174,   175,   176,   177,
+     178,   179,   180,   181,   182,   183,   184,   185,   186,   187,
+       0,     5,     7,     9,   168,   169,   170,   171,   188,   189,
+     190,   195,     7,   204,     7,   210,     7,   221,     7,   315,
+       7,   392,     7,   408,     7,   425,     7,   344,     7,   350,
+       7,   374,     7,   291,     7,   484,     7,   523,   196,   191,
+     205,   211,   222,   316,   393,   409,   426,   345,   351,   375,
+     292,   485,   524,   188,   197,   198,   168,   193,   194,    10,
+     139,   151,   152,   153,   168,   203,   206,   207,   208,   515,
+     517,   519,   521,    11,    14,    15,    16,    37,    38,    39,
       40,    41,    42,    43,    44,    62,    63,    73,    74,    75,
       76,    77,    79,    84,    93,    96,   103,   111,   112,   115,
-     200,   209,   210,   211,   212,   213,   214,   215,   216,   225,
-     227,   229,   262,   268,   274,   280,   282,   296,   306,   331,
-     339,   365,   395,   397,   416,   446,   458,   470,   471,   479,
-      12,    13,   200,   220,   221,   222,   224,   395,   397,    54,
+     203,   212,   213,   214,   215,   216,   217,   218,   219,   228,
+     230,   232,   265,   271,   277,   283,   285,   299,   309,   334,
+     342,   368,   398,   400,   419,   449,   461,   473,   474,   482,
+      12,    13,   203,   223,   224,   225,   227,   398,   400,    54,
       56,    64,    65,    66,    67,    68,    69,    80,    83,    91,
-     200,   211,   212,   213,   214,   314,   315,   316,   318,   320,
-     322,   324,   326,   329,   330,   365,   383,   395,   397,   399,
-     416,   441,    55,   200,   322,   324,   365,   391,   392,   393,
-     395,   397,    57,    58,    59,    60,    61,   200,   322,   324,
-     365,   395,   397,   407,   408,   409,   411,   412,   414,   415,
-      79,    85,    86,    87,    88,    89,    90,   200,   365,   395,
-     397,   424,   425,   426,   427,   429,   431,   433,   435,   437,
-     439,   339,    17,    45,    47,    48,    51,    52,    53,   200,
-     247,   349,   350,   351,   352,   353,   354,   355,   357,   359,
-     361,   362,   364,   395,   397,    46,    49,    50,   200,   247,
-     353,   359,   373,   374,   375,   376,   377,   379,   380,   381,
-     382,   395,   397,    94,    95,   200,   290,   291,   292,   294,
+     203,   214,   215,   216,   217,   317,   318,   319,   321,   323,
+     325,   327,   329,   332,   333,   368,   386,   398,   400,   402,
+     419,   444,    55,   203,   325,   327,   368,   394,   395,   396,
+     398,   400,    57,    58,    59,    60,    61,   203,   325,   327,
+     368,   398,   400,   410,   411,   412,   414,   415,   417,   418,
+      79,    85,    86,    87,    88,    89,    90,   203,   368,   398,
+     400,   427,   428,   429,   430,   432,   434,   436,   438,   440,
+     442,   342,    17,    45,    47,    48,    51,    52,    53,   203,
+     250,   352,   353,   354,   355,   356,   357,   358,   360,   362,
+     364,   365,   367,   398,   400,    46,    49,    50,   203,   250,
+     356,   362,   376,   377,   378,   379,   380,   382,   383,   384,
+     385,   398,   400,    94,    95,   203,   293,   294,   295,   297,
      116,   117,   118,   119,   120,   121,   122,   123,   124,   125,
-     126,   127,   128,   129,   137,   138,   200,   395,   397,   483,
-     484,   485,   486,   488,   490,   491,   493,   494,   495,   498,
-     500,   501,   502,   503,   506,   508,   510,   140,   522,   523,
-     524,     6,     3,     4,     8,     3,   206,   519,   513,   515,
-     517,     4,     3,     8,   217,   226,   228,   230,     4,     4,
-       4,     4,     4,   307,   340,   366,   396,   398,   332,   269,
-     281,   275,   263,   447,   417,   283,   297,   459,     4,   472,
-     480,     3,     8,   223,     4,     3,     8,   384,   400,   317,
-     319,   321,     4,     4,   327,   325,   323,   442,     3,     8,
-     394,     3,     8,   410,     4,   413,     4,     4,     3,     8,
-     440,   428,   430,   432,   434,   436,   438,     8,     3,     8,
-     356,   248,     4,   360,   358,   363,     4,     8,     3,   378,
-       4,     4,     8,     3,   293,   295,     3,     8,     4,   487,
-     489,     4,   492,     4,     4,   496,   499,     4,     4,     4,
-     504,   507,   509,   511,     3,     8,   525,     3,     8,   185,
-     185,   165,     4,     4,     4,     4,     4,   204,     4,     4,
-       4,     4,   166,   166,   166,   166,   166,     4,     4,     4,
+     126,   127,   128,   129,   137,   138,   203,   398,   400,   486,
+     487,   488,   489,   491,   493,   494,   496,   497,   498,   501,
+     503,   504,   505,   506,   509,   511,   513,   140,   525,   526,
+     527,     6,     3,     4,     8,     3,   209,   522,   516,   518,
+     520,     4,     3,     8,   220,   229,   231,   233,     4,     4,
+       4,     4,     4,   310,   343,   369,   399,   401,   335,   272,
+     284,   278,   266,   450,   420,   286,   300,   462,     4,   475,
+     483,     3,     8,   226,     4,     3,     8,   387,   403,   320,
+     322,   324,     4,     4,   330,   328,   326,   445,     3,     8,
+     397,     3,     8,   413,     4,   416,     4,     4,     3,     8,
+     443,   431,   433,   435,   437,   439,   441,     8,     3,     8,
+     359,   251,     4,   363,   361,   366,     4,     8,     3,   381,
+       4,     4,     8,     3,   296,   298,     3,     8,     4,   490,
+     492,     4,   495,     4,     4,   499,   502,     4,     4,     4,
+     507,   510,   512,   514,     3,     8,   528,     3,     8,   188,
+     188,   168,     4,     4,     4,     4,     4,   207,     4,     4,
+       4,     4,   169,   169,   169,   169,   169,     4,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,     4,   166,     4,     4,   210,     4,   168,   221,     4,
-       4,     4,     4,     4,   166,   168,     4,     4,     4,     4,
-     315,     4,   392,     4,   166,     4,   166,   166,   408,     4,
-       4,     4,     4,     4,     4,     4,   426,     4,     4,   166,
-       4,     4,     4,   168,   351,     4,   168,   168,   375,     4,
-       4,   291,   168,     4,     4,   166,     4,   166,   166,     4,
-       4,   168,   168,   168,     4,     4,     4,     4,   484,     4,
-     523,     4,     7,     7,   185,   185,   185,     7,     7,     7,
-       5,     5,     5,     5,   187,   189,   165,     5,     5,     5,
+       4,     4,   169,     4,     4,   213,     4,   171,   224,     4,
+       4,     4,     4,     4,   169,   171,     4,     4,     4,     4,
+     318,     4,   395,     4,   169,     4,   169,   169,   411,     4,
+       4,     4,     4,     4,     4,     4,   429,     4,     4,   169,
+       4,     4,     4,   171,   354,     4,   171,   171,   378,     4,
+       4,   294,   171,     4,     4,   169,     4,   169,   169,     4,
+       4,   171,   171,   171,     4,     4,     4,     4,   487,     4,
+     526,     4,     7,     7,   188,   188,   188,     7,     7,     7,
+       5,     5,     5,     5,   190,   192,   168,     5,     5,     5,
        5,     7,     5,     5,     5,     7,     7,     7,     7,     5,
-     196,     5,     5,   165,   165,   165,    70,    71,    72,   328,
-     196,   165,     7,   165,   165,   165,   196,   196,   196,   165,
-     165,   165,   165,   165,   165,   165,   165,   165,   165,   165,
-     185,   165,   165,   165,   130,   131,   497,   132,   133,   134,
-     135,   136,   168,   505,   165,   165,   165,     5,   185,   209,
-     522,   220,    17,    22,    23,    24,    25,    26,    27,    28,
-      29,    30,    31,    32,    33,    34,    35,    36,   200,   235,
-     236,   237,   240,   242,   244,   246,   247,   249,   250,   251,
-     252,   253,   254,   255,   256,   257,   259,   260,   235,     7,
-     231,   232,   233,     7,   308,   309,   310,     7,   343,   344,
-     345,     7,   367,   368,   369,     7,   333,   334,   335,    87,
-     165,   270,   271,   272,   273,   194,    88,    90,   272,   276,
-     277,   278,   279,    78,   264,   265,   266,     7,   448,   449,
-       7,   418,   419,   420,     7,   284,   285,   286,    97,    98,
-      99,   100,   101,   102,   298,   299,   300,   301,   302,   303,
-     304,   305,    17,   107,   108,   109,   110,   200,   249,   395,
-     397,   460,   461,   462,   465,   466,   468,   469,   113,   114,
-     200,   395,   397,   473,   474,   475,   477,   483,   197,     7,
-     385,   386,   387,     7,   401,   402,   403,    92,   427,   443,
-     444,     7,   526,   527,     8,     8,     8,   238,   241,   243,
-     245,     4,     4,     4,     4,     4,   258,     4,     4,   261,
-       4,     4,     4,     3,     8,     8,   234,     6,     3,   311,
-       6,     3,   346,     6,     3,   370,     6,     3,   336,     6,
-       3,     3,     6,     6,     3,     6,   267,     3,     8,   450,
-       3,     6,   421,     6,     3,   287,     6,     3,     4,     4,
-       4,     4,     4,     4,     3,     8,   463,   467,     4,     4,
-       4,     3,     8,   476,   478,     3,     8,     8,   165,   198,
-     199,   388,     6,     3,   404,     6,     3,   445,     8,   528,
-       3,     6,     4,     4,     4,     4,   166,   168,   166,   168,
-     166,     4,   166,   166,     4,   166,   166,   168,   236,   235,
-     233,   314,   310,   349,   345,   373,   369,   200,   211,   212,
-     213,   214,   247,   306,   318,   320,   322,   324,   326,   330,
-     337,   338,   365,   395,   397,   441,   335,   271,   277,     4,
-     265,    81,    82,   200,   247,   365,   395,   397,   451,   452,
-     453,   454,   455,   457,   449,   424,   420,   290,   286,   166,
-     166,   166,   166,   166,   166,   299,     4,     4,   166,   166,
-     166,   461,     4,     4,   474,     6,     3,   391,   387,   407,
-     403,     4,   141,   143,   144,   200,   247,   395,   397,   529,
-     530,   531,   532,   534,   527,    18,    19,    20,    21,   239,
-     165,   165,   165,   165,   165,     8,     8,     8,     8,     3,
-       8,   165,   456,     4,     8,     3,     8,     8,   104,   105,
-     106,   464,   165,   165,   165,   165,     8,     8,   165,   535,
-       4,   533,     3,     8,   338,     4,   168,   453,     4,   166,
-       4,   530,   165,     5,   165,     7,   536,   537,   538,     3,
-       6,   142,   145,   146,   147,   539,   540,   541,   543,   544,
-     545,   537,   542,     4,     4,     4,     3,     8,     4,   168,
-     166,   166,   540,   165
+     199,     5,     5,   168,   168,   168,    70,    71,    72,   331,
+     199,   168,     7,   168,   168,   168,   199,   199,   199,   168,
+     168,   168,   168,   168,   168,   168,   168,   168,   168,   168,
+     188,   168,   168,   168,   130,   131,   500,   132,   133,   134,
+     135,   136,   171,   508,   168,   168,   168,     5,   188,   212,
+     525,   223,    17,    22,    23,    24,    25,    26,    27,    28,
+      29,    30,    31,    32,    33,    34,    35,    36,   203,   238,
+     239,   240,   243,   245,   247,   249,   250,   252,   253,   254,
+     255,   256,   257,   258,   259,   260,   262,   263,   238,     7,
+     234,   235,   236,     7,   311,   312,   313,     7,   346,   347,
+     348,     7,   370,   371,   372,     7,   336,   337,   338,    87,
+     168,   273,   274,   275,   276,   197,    88,    90,   275,   279,
+     280,   281,   282,    78,   267,   268,   269,     7,   451,   452,
+       7,   421,   422,   423,     7,   287,   288,   289,    97,    98,
+      99,   100,   101,   102,   301,   302,   303,   304,   305,   306,
+     307,   308,    17,   107,   108,   109,   110,   203,   252,   398,
+     400,   463,   464,   465,   468,   469,   471,   472,   113,   114,
+     203,   398,   400,   476,   477,   478,   480,   486,   200,     7,
+     388,   389,   390,     7,   404,   405,   406,    92,   430,   446,
+     447,     7,   529,   530,     8,     8,     8,   241,   244,   246,
+     248,     4,     4,     4,     4,     4,   261,     4,     4,   264,
+       4,     4,     4,     3,     8,     8,   237,     6,     3,   314,
+       6,     3,   349,     6,     3,   373,     6,     3,   339,     6,
+       3,     3,     6,     6,     3,     6,   270,     3,     8,   453,
+       3,     6,   424,     6,     3,   290,     6,     3,     4,     4,
+       4,     4,     4,     4,     3,     8,   466,   470,     4,     4,
+       4,     3,     8,   479,   481,     3,     8,     8,   168,   201,
+     202,   391,     6,     3,   407,     6,     3,   448,     8,   531,
+       3,     6,     4,     4,     4,     4,   169,   171,   169,   171,
+     169,     4,   169,   169,     4,   169,   169,   171,   239,   238,
+     236,   317,   313,   352,   348,   376,   372,   203,   214,   215,
+     216,   217,   250,   309,   321,   323,   325,   327,   329,   333,
+     340,   341,   368,   398,   400,   444,   338,   274,   280,     4,
+     268,    81,    82,   203,   250,   368,   398,   400,   454,   455,
+     456,   457,   458,   460,   452,   427,   423,   293,   289,   169,
+     169,   169,   169,   169,   169,   302,     4,     4,   169,   169,
+     169,   464,     4,     4,   477,     6,     3,   394,   390,   410,
+     406,     4,   141,   143,   144,   203,   250,   398,   400,   532,
+     533,   534,   535,   537,   530,    18,    19,    20,    21,   242,
+     168,   168,   168,   168,   168,     8,     8,     8,     8,     3,
+       8,   168,   459,     4,     8,     3,     8,     8,   104,   105,
+     106,   467,   168,   168,   168,   168,     8,     8,   168,   538,
+       4,   536,     3,     8,   341,     4,   171,   456,     4,   169,
+       4,   533,   168,     5,   168,     7,   539,   540,   541,     3,
+       6,   142,   145,   146,   147,   148,   149,   150,   542,   543,
+     544,   546,   547,   548,   549,   550,   551,   540,   545,     4,
+       4,     4,     4,     4,   552,     3,     8,     4,   171,   169,
+     169,   171,   169,     4,   543,   168,   168
   };
 
   const unsigned short int
   Dhcp6Parser::yyr1_[] =
   {
-       0,   169,   171,   170,   172,   170,   173,   170,   174,   170,
-     175,   170,   176,   170,   177,   170,   178,   170,   179,   170,
-     180,   170,   181,   170,   182,   170,   183,   170,   184,   170,
-     185,   185,   185,   185,   185,   185,   185,   186,   188,   187,
-     189,   190,   190,   191,   191,   193,   192,   194,   194,   195,
-     195,   197,   196,   198,   198,   199,   199,   200,   202,   201,
-     203,   203,   204,   204,   204,   204,   204,   204,   206,   205,
-     208,   207,   209,   209,   210,   210,   210,   210,   210,   210,
-     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
-     210,   210,   210,   210,   210,   210,   210,   210,   210,   210,
-     210,   210,   211,   212,   213,   214,   215,   217,   216,   219,
-     218,   220,   220,   221,   221,   221,   221,   221,   223,   222,
-     224,   226,   225,   228,   227,   230,   229,   231,   231,   232,
-     232,   234,   233,   235,   235,   236,   236,   236,   236,   236,
-     236,   236,   236,   236,   236,   236,   236,   236,   236,   236,
-     236,   236,   236,   238,   237,   239,   239,   239,   239,   241,
-     240,   243,   242,   245,   244,   246,   248,   247,   249,   250,
-     251,   252,   253,   254,   255,   256,   258,   257,   259,   261,
-     260,   263,   262,   264,   264,   265,   267,   266,   269,   268,
-     270,   270,   271,   271,   272,   273,   275,   274,   276,   276,
-     277,   277,   277,   278,   279,   281,   280,   283,   282,   284,
-     284,   285,   285,   287,   286,   289,   288,   290,   290,   290,
-     291,   291,   293,   292,   295,   294,   297,   296,   298,   298,
-     299,   299,   299,   299,   299,   299,   300,   301,   302,   303,
-     304,   305,   307,   306,   308,   308,   309,   309,   311,   310,
-     313,   312,   314,   314,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   315,   315,   315,   315,   315,   315,
-     315,   315,   315,   315,   317,   316,   319,   318,   321,   320,
-     323,   322,   325,   324,   327,   326,   328,   328,   328,   329,
-     330,   332,   331,   333,   333,   334,   334,   336,   335,   337,
-     337,   338,   338,   338,   338,   338,   338,   338,   338,   338,
-     338,   338,   338,   338,   338,   338,   338,   338,   340,   339,
-     342,   341,   343,   343,   344,   344,   346,   345,   348,   347,
-     349,   349,   350,   350,   351,   351,   351,   351,   351,   351,
-     351,   351,   351,   351,   352,   353,   354,   356,   355,   358,
-     357,   360,   359,   361,   363,   362,   364,   366,   365,   367,
-     367,   368,   368,   370,   369,   372,   371,   373,   373,   374,
-     374,   375,   375,   375,   375,   375,   375,   375,   375,   375,
-     376,   378,   377,   379,   380,   381,   382,   384,   383,   385,
-     385,   386,   386,   388,   387,   390,   389,   391,   391,   392,
-     392,   392,   392,   392,   392,   392,   394,   393,   396,   395,
-     398,   397,   400,   399,   401,   401,   402,   402,   404,   403,
-     406,   405,   407,   407,   408,   408,   408,   408,   408,   408,
-     408,   408,   408,   408,   408,   410,   409,   411,   413,   412,
-     414,   415,   417,   416,   418,   418,   419,   419,   421,   420,
-     423,   422,   424,   424,   425,   425,   426,   426,   426,   426,
-     426,   426,   426,   426,   426,   426,   426,   428,   427,   430,
-     429,   432,   431,   434,   433,   436,   435,   438,   437,   440,
-     439,   442,   441,   443,   443,   445,   444,   447,   446,   448,
-     448,   450,   449,   451,   451,   452,   452,   453,   453,   453,
-     453,   453,   453,   453,   454,   456,   455,   457,   459,   458,
-     460,   460,   461,   461,   461,   461,   461,   461,   461,   461,
-     461,   463,   462,   464,   464,   464,   465,   467,   466,   468,
-     469,   470,   472,   471,   473,   473,   474,   474,   474,   474,
-     474,   476,   475,   478,   477,   480,   479,   482,   481,   483,
-     483,   484,   484,   484,   484,   484,   484,   484,   484,   484,
-     484,   484,   484,   484,   484,   484,   484,   484,   484,   484,
-     485,   487,   486,   489,   488,   490,   492,   491,   493,   494,
-     496,   495,   497,   497,   499,   498,   500,   501,   502,   504,
-     503,   505,   505,   505,   505,   505,   507,   506,   509,   508,
-     511,   510,   513,   512,   515,   514,   517,   516,   519,   518,
-     521,   520,   522,   522,   523,   525,   524,   526,   526,   528,
-     527,   529,   529,   530,   530,   530,   530,   530,   530,   530,
-     531,   533,   532,   535,   534,   536,   536,   538,   537,   539,
-     539,   540,   540,   540,   540,   542,   541,   543,   544,   545
+       0,   172,   174,   173,   175,   173,   176,   173,   177,   173,
+     178,   173,   179,   173,   180,   173,   181,   173,   182,   173,
+     183,   173,   184,   173,   185,   173,   186,   173,   187,   173,
+     188,   188,   188,   188,   188,   188,   188,   189,   191,   190,
+     192,   193,   193,   194,   194,   196,   195,   197,   197,   198,
+     198,   200,   199,   201,   201,   202,   202,   203,   205,   204,
+     206,   206,   207,   207,   207,   207,   207,   207,   209,   208,
+     211,   210,   212,   212,   213,   213,   213,   213,   213,   213,
+     213,   213,   213,   213,   213,   213,   213,   213,   213,   213,
+     213,   213,   213,   213,   213,   213,   213,   213,   213,   213,
+     213,   213,   214,   215,   216,   217,   218,   220,   219,   222,
+     221,   223,   223,   224,   224,   224,   224,   224,   226,   225,
+     227,   229,   228,   231,   230,   233,   232,   234,   234,   235,
+     235,   237,   236,   238,   238,   239,   239,   239,   239,   239,
+     239,   239,   239,   239,   239,   239,   239,   239,   239,   239,
+     239,   239,   239,   241,   240,   242,   242,   242,   242,   244,
+     243,   246,   245,   248,   247,   249,   251,   250,   252,   253,
+     254,   255,   256,   257,   258,   259,   261,   260,   262,   264,
+     263,   266,   265,   267,   267,   268,   270,   269,   272,   271,
+     273,   273,   274,   274,   275,   276,   278,   277,   279,   279,
+     280,   280,   280,   281,   282,   284,   283,   286,   285,   287,
+     287,   288,   288,   290,   289,   292,   291,   293,   293,   293,
+     294,   294,   296,   295,   298,   297,   300,   299,   301,   301,
+     302,   302,   302,   302,   302,   302,   303,   304,   305,   306,
+     307,   308,   310,   309,   311,   311,   312,   312,   314,   313,
+     316,   315,   317,   317,   318,   318,   318,   318,   318,   318,
+     318,   318,   318,   318,   318,   318,   318,   318,   318,   318,
+     318,   318,   318,   318,   320,   319,   322,   321,   324,   323,
+     326,   325,   328,   327,   330,   329,   331,   331,   331,   332,
+     333,   335,   334,   336,   336,   337,   337,   339,   338,   340,
+     340,   341,   341,   341,   341,   341,   341,   341,   341,   341,
+     341,   341,   341,   341,   341,   341,   341,   341,   343,   342,
+     345,   344,   346,   346,   347,   347,   349,   348,   351,   350,
+     352,   352,   353,   353,   354,   354,   354,   354,   354,   354,
+     354,   354,   354,   354,   355,   356,   357,   359,   358,   361,
+     360,   363,   362,   364,   366,   365,   367,   369,   368,   370,
+     370,   371,   371,   373,   372,   375,   374,   376,   376,   377,
+     377,   378,   378,   378,   378,   378,   378,   378,   378,   378,
+     379,   381,   380,   382,   383,   384,   385,   387,   386,   388,
+     388,   389,   389,   391,   390,   393,   392,   394,   394,   395,
+     395,   395,   395,   395,   395,   395,   397,   396,   399,   398,
+     401,   400,   403,   402,   404,   404,   405,   405,   407,   406,
+     409,   408,   410,   410,   411,   411,   411,   411,   411,   411,
+     411,   411,   411,   411,   411,   413,   412,   414,   416,   415,
+     417,   418,   420,   419,   421,   421,   422,   422,   424,   423,
+     426,   425,   427,   427,   428,   428,   429,   429,   429,   429,
+     429,   429,   429,   429,   429,   429,   429,   431,   430,   433,
+     432,   435,   434,   437,   436,   439,   438,   441,   440,   443,
+     442,   445,   444,   446,   446,   448,   447,   450,   449,   451,
+     451,   453,   452,   454,   454,   455,   455,   456,   456,   456,
+     456,   456,   456,   456,   457,   459,   458,   460,   462,   461,
+     463,   463,   464,   464,   464,   464,   464,   464,   464,   464,
+     464,   466,   465,   467,   467,   467,   468,   470,   469,   471,
+     472,   473,   475,   474,   476,   476,   477,   477,   477,   477,
+     477,   479,   478,   481,   480,   483,   482,   485,   484,   486,
+     486,   487,   487,   487,   487,   487,   487,   487,   487,   487,
+     487,   487,   487,   487,   487,   487,   487,   487,   487,   487,
+     488,   490,   489,   492,   491,   493,   495,   494,   496,   497,
+     499,   498,   500,   500,   502,   501,   503,   504,   505,   507,
+     506,   508,   508,   508,   508,   508,   510,   509,   512,   511,
+     514,   513,   516,   515,   518,   517,   520,   519,   522,   521,
+     524,   523,   525,   525,   526,   528,   527,   529,   529,   531,
+     530,   532,   532,   533,   533,   533,   533,   533,   533,   533,
+     534,   536,   535,   538,   537,   539,   539,   541,   540,   542,
+     542,   543,   543,   543,   543,   543,   543,   543,   545,   544,
+     546,   547,   548,   549,   550,   552,   551
   };
 
   const unsigned char
@@ -4593,7 +4635,8 @@ namespace isc { namespace dhcp {
        0,     4,     1,     3,     1,     0,     6,     1,     3,     0,
        4,     1,     3,     1,     1,     1,     1,     1,     1,     1,
        3,     0,     4,     0,     6,     1,     3,     0,     4,     1,
-       3,     1,     1,     1,     1,     0,     4,     3,     3,     3
+       3,     1,     1,     1,     1,     1,     1,     1,     0,     4,
+       3,     3,     3,     3,     3,     0,     4
   };
 
 
@@ -4645,10 +4688,11 @@ namespace isc { namespace dhcp {
   "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
   "\"hostname-char-set\"", "\"hostname-char-replacement\"", "\"Logging\"",
   "\"loggers\"", "\"output_options\"", "\"output\"", "\"debuglevel\"",
-  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"Dhcp4\"",
-  "\"DhcpDdns\"", "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6",
-  "SUB_DHCP6", "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6",
-  "SUB_PD_POOL", "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
+  "\"severity\"", "\"flush\"", "\"maxsize\"", "\"maxver\"", "\"async\"",
+  "\"queue-size\"", "\"overflow-policy\"", "\"Dhcp4\"", "\"DhcpDdns\"",
+  "\"Control-agent\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6",
+  "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL",
+  "SUB_RESERVATION", "SUB_OPTION_DEFS", "SUB_OPTION_DEF",
   "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "SUB_LOGGING",
   "\"constant string\"", "\"integer\"", "\"floating point\"",
   "\"boolean\"", "$accept", "start", "$@1", "$@2", "$@3", "$@4", "$@5",
@@ -4740,78 +4784,80 @@ namespace isc { namespace dhcp {
   "$@118", "logger_params", "logger_param", "debuglevel", "severity",
   "$@119", "output_options_list", "$@120", "output_options_list_content",
   "output_entry", "$@121", "output_params_list", "output_params", "output",
-  "$@122", "flush", "maxsize", "maxver", YY_NULLPTR
+  "$@122", "flush", "maxsize", "maxver", "async", "queue_size",
+  "overflow_policy", "$@123", YY_NULLPTR
   };
 
 #if PARSER6_DEBUG
   const unsigned short int
   Dhcp6Parser::yyrline_[] =
   {
-       0,   251,   251,   251,   252,   252,   253,   253,   254,   254,
-     255,   255,   256,   256,   257,   257,   258,   258,   259,   259,
-     260,   260,   261,   261,   262,   262,   263,   263,   264,   264,
-     272,   273,   274,   275,   276,   277,   278,   281,   286,   286,
-     297,   300,   301,   304,   308,   315,   315,   322,   323,   326,
-     330,   337,   337,   344,   345,   348,   352,   363,   373,   373,
-     388,   389,   393,   394,   395,   396,   397,   398,   401,   401,
-     416,   416,   425,   426,   431,   432,   433,   434,   435,   436,
-     437,   438,   439,   440,   441,   442,   443,   444,   445,   446,
-     447,   448,   449,   450,   451,   452,   453,   454,   455,   456,
-     457,   458,   461,   466,   471,   476,   481,   486,   486,   497,
-     497,   506,   507,   510,   511,   512,   513,   514,   517,   517,
-     527,   533,   533,   545,   545,   557,   557,   567,   568,   571,
-     572,   575,   575,   585,   586,   589,   590,   591,   592,   593,
-     594,   595,   596,   597,   598,   599,   600,   601,   602,   603,
-     604,   605,   606,   609,   609,   616,   617,   618,   619,   622,
-     622,   630,   630,   638,   638,   646,   651,   651,   659,   664,
-     669,   674,   679,   684,   689,   694,   699,   699,   707,   712,
-     712,   720,   720,   730,   731,   733,   735,   735,   753,   753,
-     763,   764,   767,   768,   771,   776,   781,   781,   791,   792,
-     795,   796,   797,   800,   805,   812,   812,   822,   822,   832,
-     833,   836,   837,   840,   840,   850,   850,   860,   861,   862,
-     865,   866,   869,   869,   877,   877,   885,   885,   896,   897,
-     900,   901,   902,   903,   904,   905,   908,   913,   918,   923,
-     928,   933,   941,   941,   954,   955,   958,   959,   966,   966,
-     992,   992,  1003,  1004,  1008,  1009,  1010,  1011,  1012,  1013,
-    1014,  1015,  1016,  1017,  1018,  1019,  1020,  1021,  1022,  1023,
-    1024,  1025,  1026,  1027,  1030,  1030,  1038,  1038,  1046,  1046,
-    1054,  1054,  1062,  1062,  1072,  1072,  1079,  1080,  1081,  1084,
-    1089,  1097,  1097,  1108,  1109,  1113,  1114,  1117,  1117,  1125,
-    1126,  1129,  1130,  1131,  1132,  1133,  1134,  1135,  1136,  1137,
-    1138,  1139,  1140,  1141,  1142,  1143,  1144,  1145,  1152,  1152,
-    1165,  1165,  1174,  1175,  1178,  1179,  1184,  1184,  1199,  1199,
-    1213,  1214,  1217,  1218,  1221,  1222,  1223,  1224,  1225,  1226,
-    1227,  1228,  1229,  1230,  1233,  1235,  1240,  1242,  1242,  1250,
-    1250,  1258,  1258,  1266,  1268,  1268,  1276,  1285,  1285,  1297,
-    1298,  1303,  1304,  1309,  1309,  1321,  1321,  1333,  1334,  1339,
-    1340,  1345,  1346,  1347,  1348,  1349,  1350,  1351,  1352,  1353,
-    1356,  1358,  1358,  1366,  1368,  1370,  1375,  1383,  1383,  1395,
-    1396,  1399,  1400,  1403,  1403,  1413,  1413,  1422,  1423,  1426,
-    1427,  1428,  1429,  1430,  1431,  1432,  1435,  1435,  1443,  1443,
-    1468,  1468,  1498,  1498,  1510,  1511,  1514,  1515,  1518,  1518,
-    1530,  1530,  1542,  1543,  1546,  1547,  1548,  1549,  1550,  1551,
-    1552,  1553,  1554,  1555,  1556,  1559,  1559,  1567,  1572,  1572,
-    1580,  1585,  1593,  1593,  1603,  1604,  1607,  1608,  1611,  1611,
-    1620,  1620,  1629,  1630,  1633,  1634,  1638,  1639,  1640,  1641,
-    1642,  1643,  1644,  1645,  1646,  1647,  1648,  1651,  1651,  1661,
-    1661,  1671,  1671,  1679,  1679,  1687,  1687,  1695,  1695,  1703,
-    1703,  1716,  1716,  1726,  1727,  1730,  1730,  1741,  1741,  1751,
-    1752,  1755,  1755,  1765,  1766,  1769,  1770,  1773,  1774,  1775,
-    1776,  1777,  1778,  1779,  1782,  1784,  1784,  1792,  1800,  1800,
-    1812,  1813,  1816,  1817,  1818,  1819,  1820,  1821,  1822,  1823,
-    1824,  1827,  1827,  1834,  1835,  1836,  1839,  1844,  1844,  1852,
-    1857,  1864,  1871,  1871,  1881,  1882,  1885,  1886,  1887,  1888,
-    1889,  1892,  1892,  1900,  1900,  1910,  1910,  1922,  1922,  1932,
-    1933,  1936,  1937,  1938,  1939,  1940,  1941,  1942,  1943,  1944,
-    1945,  1946,  1947,  1948,  1949,  1950,  1951,  1952,  1953,  1954,
-    1957,  1962,  1962,  1970,  1970,  1978,  1983,  1983,  1991,  1996,
-    2001,  2001,  2009,  2010,  2013,  2013,  2021,  2026,  2031,  2036,
-    2036,  2044,  2047,  2050,  2053,  2056,  2062,  2062,  2070,  2070,
-    2078,  2078,  2088,  2088,  2095,  2095,  2102,  2102,  2115,  2115,
-    2125,  2125,  2136,  2137,  2141,  2145,  2145,  2157,  2158,  2162,
-    2162,  2170,  2171,  2174,  2175,  2176,  2177,  2178,  2179,  2180,
-    2183,  2188,  2188,  2196,  2196,  2206,  2207,  2210,  2210,  2218,
-    2219,  2222,  2223,  2224,  2225,  2228,  2228,  2236,  2241,  2246
+       0,   254,   254,   254,   255,   255,   256,   256,   257,   257,
+     258,   258,   259,   259,   260,   260,   261,   261,   262,   262,
+     263,   263,   264,   264,   265,   265,   266,   266,   267,   267,
+     275,   276,   277,   278,   279,   280,   281,   284,   289,   289,
+     300,   303,   304,   307,   311,   318,   318,   325,   326,   329,
+     333,   340,   340,   347,   348,   351,   355,   366,   376,   376,
+     391,   392,   396,   397,   398,   399,   400,   401,   404,   404,
+     419,   419,   428,   429,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
+     460,   461,   464,   469,   474,   479,   484,   489,   489,   500,
+     500,   509,   510,   513,   514,   515,   516,   517,   520,   520,
+     530,   536,   536,   548,   548,   560,   560,   570,   571,   574,
+     575,   578,   578,   588,   589,   592,   593,   594,   595,   596,
+     597,   598,   599,   600,   601,   602,   603,   604,   605,   606,
+     607,   608,   609,   612,   612,   619,   620,   621,   622,   625,
+     625,   633,   633,   641,   641,   649,   654,   654,   662,   667,
+     672,   677,   682,   687,   692,   697,   702,   702,   710,   715,
+     715,   723,   723,   733,   734,   736,   738,   738,   756,   756,
+     766,   767,   770,   771,   774,   779,   784,   784,   794,   795,
+     798,   799,   800,   803,   808,   815,   815,   825,   825,   835,
+     836,   839,   840,   843,   843,   853,   853,   863,   864,   865,
+     868,   869,   872,   872,   880,   880,   888,   888,   899,   900,
+     903,   904,   905,   906,   907,   908,   911,   916,   921,   926,
+     931,   936,   944,   944,   957,   958,   961,   962,   969,   969,
+     995,   995,  1006,  1007,  1011,  1012,  1013,  1014,  1015,  1016,
+    1017,  1018,  1019,  1020,  1021,  1022,  1023,  1024,  1025,  1026,
+    1027,  1028,  1029,  1030,  1033,  1033,  1041,  1041,  1049,  1049,
+    1057,  1057,  1065,  1065,  1075,  1075,  1082,  1083,  1084,  1087,
+    1092,  1100,  1100,  1111,  1112,  1116,  1117,  1120,  1120,  1128,
+    1129,  1132,  1133,  1134,  1135,  1136,  1137,  1138,  1139,  1140,
+    1141,  1142,  1143,  1144,  1145,  1146,  1147,  1148,  1155,  1155,
+    1168,  1168,  1177,  1178,  1181,  1182,  1187,  1187,  1202,  1202,
+    1216,  1217,  1220,  1221,  1224,  1225,  1226,  1227,  1228,  1229,
+    1230,  1231,  1232,  1233,  1236,  1238,  1243,  1245,  1245,  1253,
+    1253,  1261,  1261,  1269,  1271,  1271,  1279,  1288,  1288,  1300,
+    1301,  1306,  1307,  1312,  1312,  1324,  1324,  1336,  1337,  1342,
+    1343,  1348,  1349,  1350,  1351,  1352,  1353,  1354,  1355,  1356,
+    1359,  1361,  1361,  1369,  1371,  1373,  1378,  1386,  1386,  1398,
+    1399,  1402,  1403,  1406,  1406,  1416,  1416,  1425,  1426,  1429,
+    1430,  1431,  1432,  1433,  1434,  1435,  1438,  1438,  1446,  1446,
+    1471,  1471,  1501,  1501,  1513,  1514,  1517,  1518,  1521,  1521,
+    1533,  1533,  1545,  1546,  1549,  1550,  1551,  1552,  1553,  1554,
+    1555,  1556,  1557,  1558,  1559,  1562,  1562,  1570,  1575,  1575,
+    1583,  1588,  1596,  1596,  1606,  1607,  1610,  1611,  1614,  1614,
+    1623,  1623,  1632,  1633,  1636,  1637,  1641,  1642,  1643,  1644,
+    1645,  1646,  1647,  1648,  1649,  1650,  1651,  1654,  1654,  1664,
+    1664,  1674,  1674,  1682,  1682,  1690,  1690,  1698,  1698,  1706,
+    1706,  1719,  1719,  1729,  1730,  1733,  1733,  1744,  1744,  1754,
+    1755,  1758,  1758,  1768,  1769,  1772,  1773,  1776,  1777,  1778,
+    1779,  1780,  1781,  1782,  1785,  1787,  1787,  1795,  1803,  1803,
+    1815,  1816,  1819,  1820,  1821,  1822,  1823,  1824,  1825,  1826,
+    1827,  1830,  1830,  1837,  1838,  1839,  1842,  1847,  1847,  1855,
+    1860,  1867,  1874,  1874,  1884,  1885,  1888,  1889,  1890,  1891,
+    1892,  1895,  1895,  1903,  1903,  1913,  1913,  1925,  1925,  1935,
+    1936,  1939,  1940,  1941,  1942,  1943,  1944,  1945,  1946,  1947,
+    1948,  1949,  1950,  1951,  1952,  1953,  1954,  1955,  1956,  1957,
+    1960,  1965,  1965,  1973,  1973,  1981,  1986,  1986,  1994,  1999,
+    2004,  2004,  2012,  2013,  2016,  2016,  2024,  2029,  2034,  2039,
+    2039,  2047,  2050,  2053,  2056,  2059,  2065,  2065,  2073,  2073,
+    2081,  2081,  2091,  2091,  2098,  2098,  2105,  2105,  2118,  2118,
+    2128,  2128,  2139,  2140,  2144,  2148,  2148,  2160,  2161,  2165,
+    2165,  2173,  2174,  2177,  2178,  2179,  2180,  2181,  2182,  2183,
+    2186,  2191,  2191,  2199,  2199,  2209,  2210,  2213,  2213,  2221,
+    2222,  2225,  2226,  2227,  2228,  2229,  2230,  2231,  2234,  2234,
+    2242,  2247,  2252,  2257,  2262,  2267,  2267
   };
 
   // Print the state stack on the debug stream.
@@ -4846,8 +4892,8 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 4850 "dhcp6_parser.cc" // lalr1.cc:1167
-#line 2251 "dhcp6_parser.yy" // lalr1.cc:1168
+#line 4896 "dhcp6_parser.cc" // lalr1.cc:1167
+#line 2275 "dhcp6_parser.yy" // lalr1.cc:1168
 
 
 void
@@ -492,27 +492,30 @@ namespace isc { namespace dhcp {
         TOKEN_FLUSH = 400,
         TOKEN_MAXSIZE = 401,
         TOKEN_MAXVER = 402,
-        TOKEN_DHCP4 = 403,
-        TOKEN_DHCPDDNS = 404,
-        TOKEN_CONTROL_AGENT = 405,
-        TOKEN_TOPLEVEL_JSON = 406,
-        TOKEN_TOPLEVEL_DHCP6 = 407,
-        TOKEN_SUB_DHCP6 = 408,
-        TOKEN_SUB_INTERFACES6 = 409,
-        TOKEN_SUB_SUBNET6 = 410,
-        TOKEN_SUB_POOL6 = 411,
-        TOKEN_SUB_PD_POOL = 412,
-        TOKEN_SUB_RESERVATION = 413,
-        TOKEN_SUB_OPTION_DEFS = 414,
-        TOKEN_SUB_OPTION_DEF = 415,
-        TOKEN_SUB_OPTION_DATA = 416,
-        TOKEN_SUB_HOOKS_LIBRARY = 417,
-        TOKEN_SUB_DHCP_DDNS = 418,
-        TOKEN_SUB_LOGGING = 419,
-        TOKEN_STRING = 420,
-        TOKEN_INTEGER = 421,
-        TOKEN_FLOAT = 422,
-        TOKEN_BOOLEAN = 423
+        TOKEN_ASYNC = 403,
+        TOKEN_QUEUE_SIZE = 404,
+        TOKEN_OVERFLOW_POLICY = 405,
+        TOKEN_DHCP4 = 406,
+        TOKEN_DHCPDDNS = 407,
+        TOKEN_CONTROL_AGENT = 408,
+        TOKEN_TOPLEVEL_JSON = 409,
+        TOKEN_TOPLEVEL_DHCP6 = 410,
+        TOKEN_SUB_DHCP6 = 411,
+        TOKEN_SUB_INTERFACES6 = 412,
+        TOKEN_SUB_SUBNET6 = 413,
+        TOKEN_SUB_POOL6 = 414,
+        TOKEN_SUB_PD_POOL = 415,
+        TOKEN_SUB_RESERVATION = 416,
+        TOKEN_SUB_OPTION_DEFS = 417,
+        TOKEN_SUB_OPTION_DEF = 418,
+        TOKEN_SUB_OPTION_DATA = 419,
+        TOKEN_SUB_HOOKS_LIBRARY = 420,
+        TOKEN_SUB_DHCP_DDNS = 421,
+        TOKEN_SUB_LOGGING = 422,
+        TOKEN_STRING = 423,
+        TOKEN_INTEGER = 424,
+        TOKEN_FLOAT = 425,
+        TOKEN_BOOLEAN = 426
       };
     };
 
@@ -1211,6 +1214,18 @@ namespace isc { namespace dhcp {
     symbol_type
     make_MAXVER (const location_type& l);
 
+    static inline
+    symbol_type
+    make_ASYNC (const location_type& l);
+
+    static inline
+    symbol_type
+    make_QUEUE_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_OVERFLOW_POLICY (const location_type& l);
+
     static inline
     symbol_type
     make_DHCP4 (const location_type& l);
@@ -1501,11 +1516,11 @@ namespace isc { namespace dhcp {
     {
       yyeof_ = 0,
       yylast_ = 987,     ///< Last index in yytable_.
-      yynnts_ = 377,  ///< Number of nonterminal symbols.
+      yynnts_ = 381,  ///< Number of nonterminal symbols.
       yyfinal_ = 30, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 169  ///< Number of tokens.
+      yyntokens_ = 172  ///< Number of tokens.
     };
 
 
@@ -1564,9 +1579,9 @@ namespace isc { namespace dhcp {
      135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
      145,   146,   147,   148,   149,   150,   151,   152,   153,   154,
      155,   156,   157,   158,   159,   160,   161,   162,   163,   164,
-     165,   166,   167,   168
+     165,   166,   167,   168,   169,   170,   171
     };
-    const unsigned int user_token_number_max_ = 423;
+    const unsigned int user_token_number_max_ = 426;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1599,29 +1614,29 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1642,29 +1657,29 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1744,29 +1759,29 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1793,29 +1808,29 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 185: // value
-      case 189: // map_value
-      case 239: // db_type
-      case 328: // hr_mode
-      case 464: // duid_type
-      case 497: // ncr_protocol_value
-      case 505: // replace_client_name_value
+      case 188: // value
+      case 192: // map_value
+      case 242: // db_type
+      case 331: // hr_mode
+      case 467: // duid_type
+      case 500: // ncr_protocol_value
+      case 508: // replace_client_name_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 168: // "boolean"
+      case 171: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 167: // "floating point"
+      case 170: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 166: // "integer"
+      case 169: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 165: // "constant string"
+      case 168: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1890,7 +1905,8 @@ namespace isc { namespace dhcp {
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
      395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
      405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423
+     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
+     425,   426
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -2771,6 +2787,24 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_MAXVER, l);
   }
 
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_ASYNC (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_ASYNC, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_QUEUE_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_QUEUE_SIZE, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_OVERFLOW_POLICY (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_OVERFLOW_POLICY, l);
+  }
+
   Dhcp6Parser::symbol_type
   Dhcp6Parser::make_DHCP4 (const location_type& l)
   {
@@ -2900,7 +2934,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 2904 "dhcp6_parser.h" // lalr1.cc:377
+#line 2938 "dhcp6_parser.h" // lalr1.cc:377
 
 
 
@@ -171,6 +171,29 @@ createStatusCode(const Pkt6& pkt, const Option6IA& ia, const uint16_t status_cod
     return (option_status);
 }
 
+/// @brief Drops the query which failed to be parsed.
+///
+/// Logs the failure and increases the statistics of parse failures
+/// and dropped packets.
+///
+/// @param query Query which failed to be parsed.
+/// @param reason Description of the failure.
+void
+dropUnparsableQuery(const Pkt6Ptr& query, const std::string& reason) {
+    LOG_DEBUG(bad_packet6_logger, DBG_DHCP6_DETAIL,
+              DHCP6_PACKET_DROP_PARSE_FAIL)
+        .arg(query->getRemoteAddr().toText())
+        .arg(query->getLocalAddr().toText())
+        .arg(query->getIface())
+        .arg(reason);
+
+    // Increase the statistics of parse failures and dropped packets.
+    StatsMgr::instance().addValue("pkt6-parse-failed",
+                                  static_cast<int64_t>(1));
+    StatsMgr::instance().addValue("pkt6-receive-drop",
+                                  static_cast<int64_t>(1));
+}
+
 }; // anonymous namespace
 
 namespace isc {
@@ -181,7 +204,8 @@ const std::string Dhcpv6Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv6Srv::Dhcpv6Srv(uint16_t port)
     : io_service_(new IOService()), port_(port), serverid_(), shutdown_(true),
       alloc_engine_(), name_change_reqs_(),
-      network_state_(new NetworkState(NetworkState::DHCPv6))
+      network_state_(new NetworkState(NetworkState::DHCPv6)),
+      latency_stats_("pkt6")
 {
 
     LOG_DEBUG(dhcp6_logger, DBG_DHCP6_START, DHCP6_OPEN_SOCKET).arg(port);
@@ -303,6 +327,7 @@ Dhcpv6Srv::initContext(const Pkt6Ptr& pkt,
                        AllocEngine::ClientContext6& ctx,
                        bool& drop) {
     ctx.subnet_ = selectSubnet(pkt, drop);
+    latency_stats_.mark(PktLatencyStats::SUBNET_SELECT);
     ctx.duid_ = pkt->getClientId(),
     ctx.fwd_dns_update_ = false;
     ctx.rev_dns_update_ = false;
@@ -503,19 +528,38 @@ void Dhcpv6Srv::run_one() {
             .arg(query->getLabel());
         return;
     } else {
+        // Time the processing phases of the packet. The timing of the
+        // parked packets ends when they are parked.
+        latency_stats_.start(*query);
         processPacket(query, rsp);
     }
 
     if (!rsp) {
+        latency_stats_.finish();
         return;
     }
 
     CalloutHandlePtr callout_handle = getCalloutHandle(query);
     processPacketBufferSend(callout_handle, rsp);
+    latency_stats_.mark(PktLatencyStats::BUFFER_SEND);
+    latency_stats_.finish();
 }
 
 void
 Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
+    try {
+        processQuery(query, rsp);
+
+    } catch (const LazyOptionUnpackError& e) {
+        // An option decoded after the packet was unpacked is malformed.
+        // Drop the packet as if it failed to be unpacked.
+        dropUnparsableQuery(query, e.what());
+        rsp.reset();
+    }
+}
+
+void
+Dhcpv6Srv::processQuery(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     bool skip_unpack = false;
 
     // The packet has just been received so contains the uninterpreted wire
@@ -566,6 +610,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         }
 
         callout_handle->getArgument("query6", query);
+        latency_stats_.mark(PktLatencyStats::BUFFER_RECEIVE);
     }
 
     // Unpack the packet information unless the buffer6_receive callouts
@@ -576,6 +621,9 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            // Options are decoded when they are first retrieved, so the
+            // options the server doesn't look at are never decoded.
+            query->setLazyOptionUnpack(true);
             query->unpack();
         } catch (const SkipRemainingOptionsError& e) {
             // An option failed to unpack but we are to attempt to process it
@@ -585,20 +633,10 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
                 .arg(e.what());
         } catch (const std::exception &e) {
             // Failed to parse the packet.
-            LOG_DEBUG(bad_packet6_logger, DBG_DHCP6_DETAIL,
-                      DHCP6_PACKET_DROP_PARSE_FAIL)
-                .arg(query->getRemoteAddr().toText())
-                .arg(query->getLocalAddr().toText())
-                .arg(query->getIface())
-                .arg(e.what());
-
-            // Increase the statistics of parse failures and dropped packets.
-            StatsMgr::instance().addValue("pkt6-parse-failed",
-                                          static_cast<int64_t>(1));
-            StatsMgr::instance().addValue("pkt6-receive-drop",
-                                          static_cast<int64_t>(1));
+            dropUnparsableQuery(query, e.what());
             return;
         }
+        latency_stats_.mark(PktLatencyStats::UNPACK);
     }
 
     // Update statistics accordingly for received packet.
@@ -625,6 +663,8 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
     // Assign this packet to a class, if possible
     classifyPacket(query);
+    latency_stats_.mark(PktLatencyStats::CLASSIFY);
+    latency_stats_.setMessageType(query->getType(), query->getName());
 
     LOG_DEBUG(packet6_logger, DBG_DHCP6_BASIC_DATA, DHCP6_PACKET_RECEIVED)
         .arg(query->getLabel())
@@ -672,6 +712,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         }
 
         callout_handle->getArgument("query6", query);
+        latency_stats_.mark(PktLatencyStats::PKT_RECEIVE);
     }
 
     // Reject the message if it doesn't pass the sanity check.
@@ -690,6 +731,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     AllocEngine::ClientContext6 ctx;
     bool drop = false;
     initContext(query, ctx, drop);
+    latency_stats_.mark(PktLatencyStats::HOST_LOOKUP);
 
     // Stop here if initContext decided to drop the packet.
     if (drop) {
@@ -722,10 +764,12 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
         case DHCPV6_RELEASE:
             rsp = processRelease(ctx);
+            latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
             break;
 
         case DHCPV6_DECLINE:
             rsp = processDecline(ctx);
+            latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
             break;
 
         case DHCPV6_INFORMATION_REQUEST:
@@ -736,6 +780,10 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
             return;
         }
 
+    } catch (const LazyOptionUnpackError&) {
+        // Malformed options are handled like the parse failures.
+        throw;
+
     } catch (const std::exception& e) {
 
         // Catch-all exception (at least for ones based on the isc Exception
@@ -785,6 +833,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
     rsp->setLocalPort(DHCP6_SERVER_PORT);
     rsp->setIndex(query->getIndex());
     rsp->setIface(query->getIface());
+    latency_stats_.mark(PktLatencyStats::BUILD_RESPONSE);
 
     bool packet_park = false;
 
@@ -850,6 +899,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
         } else if (callout_handle->getStatus() == CalloutHandle::NEXT_STEP_PARK) {
             packet_park = true;
         }
+        latency_stats_.mark(PktLatencyStats::LEASES_COMMITTED);
     }
 
     if (!rsp) {
@@ -878,6 +928,7 @@ Dhcpv6Srv::processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp) {
 
     } else {
         processPacketPktSend(callout_handle, query, rsp);
+        latency_stats_.mark(PktLatencyStats::PKT_SEND);
     }
 }
 
@@ -2743,7 +2794,9 @@ Dhcpv6Srv::processSolicit(AllocEngine::ClientContext6& ctx) {
     ctx.fake_allocation_ = (response->getType() != DHCPV6_REPLY);
 
     processClientFqdn(solicit, response, ctx);
+    latency_stats_.mark(PktLatencyStats::DDNS);
     assignLeases(solicit, response, ctx);
+    latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
 
     setReservedClientClasses(solicit, ctx);
     requiredClassify(solicit, ctx);
@@ -2773,7 +2826,9 @@ Dhcpv6Srv::processRequest(AllocEngine::ClientContext6& ctx) {
     Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, request->getTransid()));
 
     processClientFqdn(request, reply, ctx);
+    latency_stats_.mark(PktLatencyStats::DDNS);
     assignLeases(request, reply, ctx);
+    latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
 
     setReservedClientClasses(request, ctx);
     requiredClassify(request, ctx);
@@ -2799,7 +2854,9 @@ Dhcpv6Srv::processRenew(AllocEngine::ClientContext6& ctx) {
     Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, renew->getTransid()));
 
     processClientFqdn(renew, reply, ctx);
+    latency_stats_.mark(PktLatencyStats::DDNS);
     extendLeases(renew, reply, ctx);
+    latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
 
     setReservedClientClasses(renew, ctx);
     requiredClassify(renew, ctx);
@@ -2825,7 +2882,9 @@ Dhcpv6Srv::processRebind(AllocEngine::ClientContext6& ctx) {
     Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, rebind->getTransid()));
 
     processClientFqdn(rebind, reply, ctx);
+    latency_stats_.mark(PktLatencyStats::DDNS);
     extendLeases(rebind, reply, ctx);
+    latency_stats_.mark(PktLatencyStats::LEASE_ALLOC);
 
     setReservedClientClasses(rebind, ctx);
     requiredClassify(rebind, ctx);
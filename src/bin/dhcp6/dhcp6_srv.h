@@ -21,6 +21,7 @@
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/d2_client_mgr.h>
 #include <dhcpsrv/network_state.h>
+#include <dhcpsrv/pkt_latency_stats.h>
 #include <dhcpsrv/subnet.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
@@ -96,6 +97,11 @@ public:
         return (network_state_);
     }
 
+    /// @brief Returns the latency statistics of the packet processing.
+    PktLatencyStats& getLatencyStats() {
+        return (latency_stats_);
+    }
+
     /// @brief returns Kea version on stdout and exit.
     /// redeclaration/redefinition. @ref Daemon::getVersion()
     static std::string getVersion(bool extended);
@@ -125,6 +131,9 @@ public:
     /// It verifies correctness of the passed packet, call per-type processXXX
     /// methods, generates appropriate answer.
     ///
+    /// The packet is dropped as if it failed to be unpacked when one of
+    /// the options decoded lazily during the processing is malformed.
+    ///
     /// @param query A pointer to the packet to be processed.
     /// @param rsp A pointer to the response
     void processPacket(Pkt6Ptr& query, Pkt6Ptr& rsp);
@@ -181,6 +190,16 @@ public:
 
 protected:
 
+    /// @brief Processes a single incoming DHCPv6 packet.
+    ///
+    /// This method implements the @ref processPacket. It is called by
+    /// the @ref processPacket which drops the packet when this method
+    /// throws @ref LazyOptionUnpackError.
+    ///
+    /// @param query A pointer to the packet to be processed.
+    /// @param rsp A pointer to the response
+    void processQuery(Pkt6Ptr& query, Pkt6Ptr& rsp);
+
     /// @brief Compare received server id with our server id
     ///
     /// Checks if the server id carried in a query from a client matches
@@ -969,6 +988,9 @@ protected:
     /// disabled subnet/network scopes.
     NetworkStatePtr network_state_;
 
+    /// @brief Latency statistics of the packet processing phases.
+    PktLatencyStats latency_stats_;
+
 };
 
 }; // namespace isc::dhcp
@@ -433,6 +433,17 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
         const std::map<std::string, ConstElementPtr>& values_map =
             mutable_cfg->mapValue();
 
+        // The subnets, client classes and host reservations which are
+        // configured exactly as in the current configuration are reused
+        // rather than parsed again, unless the option definitions or the
+        // host identifiers they depend on have changed.
+        SrvConfigPtr current = CfgMgr::instance().getCurrentCfg();
+        if (!current->isParsedParameterUnchanged(mutable_cfg, "option-def") ||
+            !current->isParsedParameterUnchanged(mutable_cfg,
+                                                 "host-reservation-identifiers")) {
+            current.reset();
+        }
+
         // We need definitions first
         ConstElementPtr option_defs = mutable_cfg->get("option-def");
         if (option_defs) {
@@ -533,6 +544,13 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
             }
 
             if (config_pair.first =="client-classes") {
+                if (current &&
+                    current->isParsedParameterUnchanged(mutable_cfg,
+                                                        config_pair.first)) {
+                    srv_config->setClientClassDictionary(current->
+                                                         getClientClassDictionary());
+                    continue;
+                }
                 ClientClassDefListParser parser;
                 ClientClassDictionaryPtr dictionary =
                     parser.parse(config_pair.second, AF_INET6);
@@ -568,7 +586,7 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
             if (config_pair.first == "subnet6") {
                 Subnets6ListConfigParser subnets_parser;
                 // parse() returns number of subnets parsed. We may log it one day.
-                subnets_parser.parse(srv_config, config_pair.second);
+                subnets_parser.parse(srv_config, config_pair.second, current);
                 continue;
             }
 
@@ -591,8 +609,14 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
 
             if (config_pair.first == "reservations") {
                 HostCollection hosts;
-                HostReservationsListParser<HostReservationParser6> parser;
-                parser.parse(SUBNET_ID_GLOBAL, config_pair.second, hosts);
+                if (current &&
+                    current->isParsedParameterUnchanged(mutable_cfg,
+                                                        config_pair.first)) {
+                    hosts = current->getCfgHosts()->getAll6(SUBNET_ID_GLOBAL);
+                } else {
+                    HostReservationsListParser<HostReservationParser6> parser;
+                    parser.parse(SUBNET_ID_GLOBAL, config_pair.second, hosts);
+                }
                 for (auto h = hosts.begin(); h != hosts.end(); ++h) {
                     srv_config->getCfgHosts()->add(*h);
                 }
@@ -635,6 +659,11 @@ configureDhcp6Server(Dhcpv6Srv& server, isc::data::ConstElementPtr config_set,
         // defined as part of shared networks.
         global_parser.sanityChecks(srv_config, mutable_cfg);
 
+        // Remember the configuration so the next configuration can reuse
+        // the parts which haven't changed. The caller may modify the
+        // configuration afterwards, so a copy is stored.
+        srv_config->setParsedConfig(isc::data::copy(mutable_cfg));
+
     } catch (const isc::Exception& ex) {
         LOG_ERROR(dhcp6_logger, DHCP6_PARSER_FAIL)
                   .arg(config_pair.first).arg(ex.what());
@@ -1128,6 +1128,63 @@ TEST_F(Dhcp6ParserTest, multipleSubnetsExplicitIDs) {
     } while (++cnt < 3);
 }
 
+// Check that the unchanged subnets having explicit ids are reused along
+// with their reservations by the new configuration, unless the subnet
+// configuration has changed.
+TEST_F(Dhcp6ParserTest, reuseUnchangedSubnets) {
+    const std::string subnet1 =
+        "{ \"pools\": [ { \"pool\": \"2001:db8:1::/80\" } ],"
+        "  \"subnet\": \"2001:db8:1::/64\", "
+        "  \"id\": 1024, "
+        "  \"reservations\": [ { "
+        "      \"duid\": \"01:02:03:04:05:06\", "
+        "      \"ip-addresses\": [ \"2001:db8:1::cafe\" ] } ] }";
+    std::string config = "{ " + genIfaceConfig() + ","
+        "\"preferred-lifetime\": 3000,"
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"subnet6\": [ " + subnet1 + ", "
+        "{ \"pools\": [ { \"pool\": \"2001:db8:2::/80\" } ],"
+        "  \"subnet\": \"2001:db8:2::/64\", "
+        "  \"id\": 100 } ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+    ConstElementPtr x;
+    EXPECT_NO_THROW(x = configureDhcp6Server(srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    CfgSubnets6Ptr cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets6();
+    Subnet6Ptr subnet = cfg->getSubnet(1024);
+    Subnet6Ptr other_subnet = cfg->getSubnet(100);
+    ASSERT_TRUE(subnet);
+    ASSERT_TRUE(other_subnet);
+
+    // The second subnet is changed and the first one is not.
+    config = "{ " + genIfaceConfig() + ","
+        "\"preferred-lifetime\": 3000,"
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"subnet6\": [ " + subnet1 + ", "
+        "{ \"pools\": [ { \"pool\": \"2001:db8:2::/96\" } ],"
+        "  \"subnet\": \"2001:db8:2::/64\", "
+        "  \"id\": 100 } ],"
+        "\"valid-lifetime\": 4000 }";
+    ASSERT_NO_THROW(json = parseDHCP6(config));
+    EXPECT_NO_THROW(x = configureDhcp6Server(srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    cfg = CfgMgr::instance().getCurrentCfg()->getCfgSubnets6();
+    EXPECT_TRUE(cfg->getSubnet(1024) == subnet);
+    ASSERT_TRUE(cfg->getSubnet(100));
+    EXPECT_FALSE(cfg->getSubnet(100) == other_subnet);
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgHosts()->
+              getAll6(SubnetID(1024)).size());
+}
+
 // CHeck that the configuration with two subnets having the same id is rejected.
 TEST_F(Dhcp6ParserTest, multipleSubnetsOverlappingIDs) {
     ConstElementPtr x;
@@ -1015,10 +1015,13 @@ TEST_F(CtrlChannelDhcpv6SrvTest, commandsList) {
 
     // We expect the server to report at least the following commands:
     checkListCommands(rsp, "build-report");
+    checkListCommands(rsp, "callout-timing-disable");
+    checkListCommands(rsp, "callout-timing-enable");
     checkListCommands(rsp, "config-get");
     checkListCommands(rsp, "config-set");
     checkListCommands(rsp, "config-test");
     checkListCommands(rsp, "config-write");
+    checkListCommands(rsp, "list-callout-timings");
     checkListCommands(rsp, "list-commands");
     checkListCommands(rsp, "leases-reclaim");
     checkListCommands(rsp, "libreload");
@@ -2566,6 +2566,43 @@ TEST_F(Dhcpv6SrvTest, receiveParseFailedStat) {
     EXPECT_EQ(1, recv_drop->getInteger().first);
 }
 
+// Test checks that reception of a packet carrying a malformed option, which
+// is decoded only when the server retrieves it, increases pkt6-parse-failed
+// and pkt6-receive-drop
+TEST_F(Dhcpv6SrvTest, receiveMalformedOptionStat) {
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    NakedDhcpv6Srv srv(0);
+
+    // Let's get a simple SOLICIT...
+    Pkt6Ptr pkt = PktCaptures::captureSimpleSolicit();
+
+    // And append a truncated vendor class option. This option is retrieved
+    // by the classification so it is decoded by the server.
+    const uint8_t vendor_class[] = {
+        0, 16, // option type 16 (vendor-class)
+        0, 2,  // option length 2
+        0, 0   // truncated enterprise-id
+    };
+    pkt->data_.insert(pkt->data_.end(), vendor_class,
+                      vendor_class + sizeof(vendor_class));
+
+    // Simulate that we have received that traffic
+    srv.fakeReceive(pkt);
+    srv.run();
+
+    // The packet must have been dropped as a parse failure.
+    ObservationPtr parse_fail = mgr.getObservation("pkt6-parse-failed");
+    ObservationPtr recv_drop = mgr.getObservation("pkt6-receive-drop");
+    ASSERT_TRUE(parse_fail);
+    ASSERT_TRUE(recv_drop);
+    EXPECT_EQ(1, parse_fail->getInteger().first);
+    EXPECT_EQ(1, recv_drop->getInteger().first);
+
+    // No response must have been sent.
+    EXPECT_TRUE(srv.fake_sent_.empty());
+}
+
 // This test verifies that the server is able to handle an empty DUID (client-id)
 // in incoming client message.
 TEST_F(Dhcpv6SrvTest, emptyClientId) {
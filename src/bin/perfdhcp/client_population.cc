@@ -0,0 +1,132 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include "client_population.h"
+
+using namespace boost::posix_time;
+
+namespace isc {
+namespace perfdhcp {
+
+ClientPopulation::Client::Client()
+    : state_(INIT), lease_(), rebind_time_(not_a_date_time),
+      expire_time_(not_a_date_time), queued_(false), has_timer_(false),
+      timer_() {
+}
+
+ClientPopulation::ClientPopulation(const uint32_t size)
+    : clients_(size), timers_(), idle_(), state_counts_(STATES_NUM, 0) {
+    for (uint32_t i = 0; i < size; ++i) {
+        idle_.push_back(i);
+        clients_[i].queued_ = true;
+    }
+    state_counts_[INIT] = size;
+}
+
+ClientPopulation::State
+ClientPopulation::getState(const uint32_t client) const {
+    return (getClient(client).state_);
+}
+
+uint32_t
+ClientPopulation::getStateCount(const State state) const {
+    return (state_counts_.at(state));
+}
+
+void
+ClientPopulation::setState(const uint32_t client, const State state,
+                           const ptime& due) {
+    Client& c = getClient(client);
+    if (c.has_timer_) {
+        timers_.erase(c.timer_);
+        c.has_timer_ = false;
+    }
+    if ((state == INIT) && !c.queued_) {
+        idle_.push_back(client);
+        c.queued_ = true;
+    }
+    --state_counts_[c.state_];
+    ++state_counts_[state];
+    c.state_ = state;
+    if (!due.is_not_a_date_time()) {
+        c.timer_ = timers_.insert(Timers::value_type(due, client));
+        c.has_timer_ = true;
+    }
+}
+
+dhcp::PktPtr
+ClientPopulation::getLease(const uint32_t client) const {
+    return (getClient(client).lease_);
+}
+
+void
+ClientPopulation::setLease(const uint32_t client, const dhcp::PktPtr& lease,
+                           const ptime& rebind_time, const ptime& expire_time) {
+    Client& c = getClient(client);
+    c.lease_ = lease;
+    c.rebind_time_ = rebind_time;
+    c.expire_time_ = expire_time;
+}
+
+ptime
+ClientPopulation::getRebindTime(const uint32_t client) const {
+    return (getClient(client).rebind_time_);
+}
+
+ptime
+ClientPopulation::getExpireTime(const uint32_t client) const {
+    return (getClient(client).expire_time_);
+}
+
+bool
+ClientPopulation::getNextIdle(uint32_t& client) {
+    // The clients which left the INIT state before being taken from
+    // the queue are skipped.
+    while (!idle_.empty()) {
+        client = idle_.front();
+        idle_.pop_front();
+        clients_[client].queued_ = false;
+        if (clients_[client].state_ == INIT) {
+            return (true);
+        }
+    }
+    return (false);
+}
+
+bool
+ClientPopulation::getNextExpired(const ptime& now, uint32_t& client) {
+    if (timers_.empty() || (timers_.begin()->first > now)) {
+        return (false);
+    }
+    client = timers_.begin()->second;
+    timers_.erase(timers_.begin());
+    clients_[client].has_timer_ = false;
+    return (true);
+}
+
+ClientPopulation::Client&
+ClientPopulation::getClient(const uint32_t client) {
+    if (client >= clients_.size()) {
+        isc_throw(OutOfRange, "client " << client << " is out of range of"
+                  " the population of " << clients_.size() << " clients");
+    }
+    return (clients_[client]);
+}
+
+const ClientPopulation::Client&
+ClientPopulation::getClient(const uint32_t client) const {
+    if (client >= clients_.size()) {
+        isc_throw(OutOfRange, "client " << client << " is out of range of"
+                  " the population of " << clients_.size() << " clients");
+    }
+    return (clients_[client]);
+}
+
+}
+}
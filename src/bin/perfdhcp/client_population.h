@@ -0,0 +1,206 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CLIENT_POPULATION_H
+#define CLIENT_POPULATION_H
+
+#include <dhcp/pkt.h>
+
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <deque>
+#include <map>
+#include <vector>
+
+namespace isc {
+namespace perfdhcp {
+
+/// \brief Population of the simulated DHCP clients.
+///
+/// This class holds the state of each client simulated by perfdhcp in
+/// the lifecycle and avalanche scenarios. The clients are identified by
+/// their numbers, starting from 0. The \c TestControl maps these numbers
+/// to the client's MAC address and DUID, sends the messages and moves
+/// the clients between the states.
+///
+/// A client may have a timer, e.g. the renewal time of its lease or the
+/// time after which the server's response is considered lost. The
+/// clients which timers have expired are returned by \c getNextExpired
+/// in the order of the expiration times. The clients in the INIT state
+/// wait in the queue for acquiring new leases and are returned by
+/// \c getNextIdle, so as the \c TestControl can initiate the new
+/// exchanges at the desired rate.
+class ClientPopulation {
+public:
+
+    /// \brief States of the simulated client.
+    ///
+    /// They correspond to the states of the client defined in RFC 2131
+    /// which are also used for the DHCPv6 clients.
+    enum State {
+        INIT,       ///< No lease, waiting to send Discover or Solicit.
+        SELECTING,  ///< Discover or Solicit sent.
+        REQUESTING, ///< Request sent.
+        BOUND,      ///< Lease acquired.
+        RENEWING,   ///< Renewal time passed, Renew sent.
+        REBINDING,  ///< Rebinding time passed, Rebind sent.
+        REBOOTING,  ///< Returned after an outage, INIT-REBOOT or Rebind sent.
+        STATES_NUM  ///< Number of states.
+    };
+
+    /// \brief Constructor.
+    ///
+    /// All clients are initially in the INIT state.
+    ///
+    /// \param size number of clients.
+    explicit ClientPopulation(const uint32_t size);
+
+    /// \brief Returns number of clients.
+    uint32_t size() const {
+        return (static_cast<uint32_t>(clients_.size()));
+    }
+
+    /// \brief Returns state of the client.
+    ///
+    /// \param client client number.
+    /// \throw isc::OutOfRange if there is no such client.
+    State getState(const uint32_t client) const;
+
+    /// \brief Returns number of clients in the specified state.
+    ///
+    /// \param state state of the clients.
+    uint32_t getStateCount(const State state) const;
+
+    /// \brief Moves the client to the specified state.
+    ///
+    /// The client's timer is cancelled and a new one is scheduled if
+    /// the due time is specified. The client moved to the INIT state
+    /// is appended to the queue of clients acquiring the leases.
+    ///
+    /// \param client client number.
+    /// \param state new state of the client.
+    /// \param due time of the next action of the client or
+    /// not-a-date-time if the client has no timer.
+    /// \throw isc::OutOfRange if there is no such client.
+    void setState(const uint32_t client, const State state,
+                  const boost::posix_time::ptime& due =
+                  boost::posix_time::ptime(boost::posix_time::not_a_date_time));
+
+    /// \brief Returns the server's response carrying the client's lease.
+    ///
+    /// \param client client number.
+    /// \throw isc::OutOfRange if there is no such client.
+    dhcp::PktPtr getLease(const uint32_t client) const;
+
+    /// \brief Sets the client's lease and the lease timers.
+    ///
+    /// \param client client number.
+    /// \param lease server's response carrying the lease.
+    /// \param rebind_time time when the client starts rebinding.
+    /// \param expire_time time when the lease expires.
+    /// \throw isc::OutOfRange if there is no such client.
+    void setLease(const uint32_t client, const dhcp::PktPtr& lease,
+                  const boost::posix_time::ptime& rebind_time,
+                  const boost::posix_time::ptime& expire_time);
+
+    /// \brief Returns time when the client starts rebinding its lease.
+    ///
+    /// \param client client number.
+    /// \throw isc::OutOfRange if there is no such client.
+    boost::posix_time::ptime getRebindTime(const uint32_t client) const;
+
+    /// \brief Returns time when the client's lease expires.
+    ///
+    /// \param client client number.
+    /// \throw isc::OutOfRange if there is no such client.
+    boost::posix_time::ptime getExpireTime(const uint32_t client) const;
+
+    /// \brief Returns the next client acquiring a lease.
+    ///
+    /// The client is removed from the queue, so the caller is expected
+    /// to move it to another state.
+    ///
+    /// \param [out] client number of the client.
+    /// \return true if a client was found, false if the queue is empty.
+    bool getNextIdle(uint32_t& client);
+
+    /// \brief Returns the next client which timer has expired.
+    ///
+    /// The client's timer is removed, so the caller is expected to move
+    /// the client to another state.
+    ///
+    /// \param now current time.
+    /// \param [out] client number of the client.
+    /// \return true if a client was found, false otherwise.
+    bool getNextExpired(const boost::posix_time::ptime& now,
+                        uint32_t& client);
+
+private:
+
+    /// \brief Container holding the timers of the clients.
+    typedef std::multimap<boost::posix_time::ptime, uint32_t> Timers;
+
+    /// \brief State of the single client.
+    struct Client {
+        /// \brief Constructor.
+        Client();
+
+        /// \brief Current state.
+        State state_;
+
+        /// \brief Server's response carrying the lease.
+        dhcp::PktPtr lease_;
+
+        /// \brief Time when the client starts rebinding the lease.
+        boost::posix_time::ptime rebind_time_;
+
+        /// \brief Time when the lease expires.
+        boost::posix_time::ptime expire_time_;
+
+        /// \brief Indicates if the client is in the queue of clients
+        /// acquiring the leases.
+        bool queued_;
+
+        /// \brief Indicates if the client has a timer.
+        bool has_timer_;
+
+        /// \brief Position of the client's timer.
+        Timers::iterator timer_;
+    };
+
+    /// \brief Returns the client.
+    ///
+    /// \param client client number.
+    /// \throw isc::OutOfRange if there is no such client.
+    Client& getClient(const uint32_t client);
+
+    /// \brief Returns the client.
+    ///
+    /// \param client client number.
+    /// \throw isc::OutOfRange if there is no such client.
+    const Client& getClient(const uint32_t client) const;
+
+    /// \brief Simulated clients.
+    std::vector<Client> clients_;
+
+    /// \brief Timers of the clients ordered by the expiration time.
+    Timers timers_;
+
+    /// \brief Clients in the INIT state waiting to acquire leases.
+    std::deque<uint32_t> idle_;
+
+    /// \brief Number of clients in each state.
+    std::vector<uint32_t> state_counts_;
+};
+
+/// \brief Pointer to the population of clients.
+typedef boost::shared_ptr<ClientPopulation> ClientPopulationPtr;
+
+}
+}
+
+#endif // CLIENT_POPULATION_H
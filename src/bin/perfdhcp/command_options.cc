@@ -115,6 +115,13 @@ CommandOptions::reset() {
     // will need to reset all members many times to perform unit tests
     ipversion_ = 0;
     exchange_mode_ = DORA_SARR;
+    scenario_ = BASIC;
+    output_format_ = TEXT_OUTPUT;
+    lifecycle_params_set_ = false;
+    release_percentage_ = 0;
+    decline_percentage_ = 0;
+    rebind_percentage_ = 0;
+    time_scale_ = 1;
     lease_type_.set(LeaseType::ADDRESS);
     rate_ = 0;
     renew_rate_ = 0;
@@ -138,6 +145,7 @@ CommandOptions::reset() {
     preload_ = 0;
     aggressivity_ = 1;
     local_port_ = 0;
+    threads_num_ = 1;
     seeded_ = false;
     seed_ = 0;
     broadcast_ = false;
@@ -222,7 +230,7 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
     // In this section we collect argument values from command line
     // they will be tuned and validated elsewhere
     while((opt = getopt(argc, argv, "hv46A:r:t:R:b:n:p:d:D:l:P:a:L:M:"
-                        "s:iBc1T:X:O:o:E:S:I:x:W:w:e:f:F:")) != -1) {
+                        "s:iBc1T:X:O:o:E:S:I:x:W:w:e:f:F:g:Y:j:J:")) != -1) {
         stream << " -" << static_cast<char>(opt);
         if (optarg) {
             stream << " " << optarg;
@@ -337,6 +345,12 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
                                             " positive integer");
             break;
 
+        case 'g':
+            threads_num_ = positiveInteger("value of the number of threads:"
+                                           " -g<threads> must be a positive"
+                                           " integer");
+            break;
+
         case 'h':
             usage();
             return (true);
@@ -345,6 +359,12 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             exchange_mode_ = DO_SA;
             break;
 
+        case 'j':
+            decodeLifecycleParam(nonEmptyString("client lifecycle parameter:"
+                                                " -j<param>=<value> must be"
+                                                " specified"));
+            break;
+
         case 'I':
             rip_offset_ = positiveInteger("value of ip address offset:"
                                           " -I<value> must be a"
@@ -522,6 +542,14 @@ CommandOptions::initialize(int argc, char** argv, bool print_cmd_line) {
             xid_offset_.push_back(offset_arg);
             break;
 
+        case 'Y':
+            initScenario();
+            break;
+
+        case 'J':
+            initOutputFormat();
+            break;
+
         default:
             isc_throw(isc::InvalidParameter, "unknown command line option");
         }
@@ -866,6 +894,54 @@ CommandOptions::validate() const {
           "use -I<ip-offset>");
     check((!getMacListFile().empty() && base_.size() > 0),
           "Can't use -b with -M option");
+    if (getThreadsNum() > 1) {
+        const int threads_num = getThreadsNum();
+        check((getIpVersion() == 6) && !isUseRelayedV6(),
+              "-A1 must be used with -6 to use -g<threads>");
+        check(!getTemplateFiles().empty(),
+              "-T<template-file> is not compatible with -g<threads>");
+        check(diags_.find('t') != std::string::npos,
+              "-x t is not compatible with -g<threads>");
+        check((getRate() != 0) && (getRate() < threads_num),
+              "-r<rate> must not be lower than -g<threads>");
+        check((getRenewRate() != 0) && (getRenewRate() < threads_num),
+              "-f<renew-rate> must not be lower than -g<threads>");
+        check((getReleaseRate() != 0) && (getReleaseRate() < threads_num),
+              "-F<release-rate> must not be lower than -g<threads>");
+        check((getClientsNum() > 1) &&
+              (getClientsNum() < static_cast<uint32_t>(threads_num)),
+              "-R<range> must not be lower than -g<threads>");
+        for (size_t i = 0; i < getMaxDrop().size(); ++i) {
+            check(getMaxDrop()[i] < threads_num,
+                  "-D<max-drop> must not be lower than -g<threads>");
+        }
+        check(getLocalPort() + threads_num - 1 >
+              static_cast<int>(std::numeric_limits<uint16_t>::max()),
+              "-L<local-port> is too high for -g<threads>");
+    }
+    check((getScenario() == BASIC) && lifecycle_params_set_,
+          "-Y lifecycle or -Y avalanche must be set to use"
+          " -j<lifecycle-parameter>");
+    if (getScenario() != BASIC) {
+        check(getExchangeMode() == DO_SA,
+              "-i is not compatible with -Y<scenario>");
+        check((getRenewRate() != 0) || (getReleaseRate() != 0),
+              "-f<renew-rate> and -F<release-rate> are not compatible with"
+              " -Y<scenario>, the clients renew and release the leases"
+              " on their own");
+        check(getPreload() != 0, "-P<preload> is not compatible with"
+              " -Y<scenario>");
+        check(!getTemplateFiles().empty(),
+              "-T<template-file> is not compatible with -Y<scenario>");
+        check(!getMacListFile().empty(),
+              "-M<mac-list-file> is not compatible with -Y<scenario>");
+        check(getClientsNum() < static_cast<uint32_t>(getThreadsNum()),
+              "-R<range> must be set to the number of clients and must"
+              " not be lower than -g<threads> to use -Y<scenario>");
+        check(getReleasePercentage() + getRebindPercentage() > 100,
+              "the sum of the -j release=<value> and -j rebind=<value>"
+              " percentages must not be greater than 100");
+    }
 }
 
 void
@@ -916,6 +992,77 @@ CommandOptions::initLeaseType() {
     lease_type_.fromCommandLine(lease_type_arg);
 }
 
+void
+CommandOptions::initScenario() {
+    std::string scenario(optarg);
+    boost::algorithm::to_lower(scenario);
+    if (scenario == "basic") {
+        scenario_ = BASIC;
+    } else if (scenario == "lifecycle") {
+        scenario_ = LIFECYCLE;
+    } else if (scenario == "avalanche") {
+        scenario_ = AVALANCHE;
+    } else {
+        isc_throw(isc::InvalidParameter, "invalid scenario: -Y<scenario>"
+                  " must be one of: basic, lifecycle, avalanche");
+    }
+}
+
+void
+CommandOptions::initOutputFormat() {
+    std::string format(optarg);
+    boost::algorithm::to_lower(format);
+    if (format == "text") {
+        output_format_ = TEXT_OUTPUT;
+    } else if (format == "json") {
+        output_format_ = JSON_OUTPUT;
+    } else if (format == "csv") {
+        output_format_ = CSV_OUTPUT;
+    } else {
+        isc_throw(isc::InvalidParameter, "invalid output format:"
+                  " -J<output-format> must be one of: text, json, csv");
+    }
+}
+
+void
+CommandOptions::decodeLifecycleParam(const std::string& param) {
+    static const char* errmsg = "expected -j<param>=<value> format for"
+        " client lifecycle parameter, e.g. -j release=10";
+    size_t found = param.find('=');
+    check(found == std::string::npos, errmsg);
+    std::string name = param.substr(0, found);
+    boost::algorithm::to_lower(name);
+    int value = 0;
+    try {
+        value = boost::lexical_cast<int>(param.substr(found + 1));
+    } catch (const boost::bad_lexical_cast&) {
+        isc_throw(isc::InvalidParameter, errmsg);
+    }
+
+    if (name == "time-scale") {
+        check(value <= 0, "value of the time scale: -j time-scale=<value>"
+              " must be a positive integer");
+        time_scale_ = value;
+
+    } else {
+        check((value < 0) || (value > 100), "value of the client lifecycle"
+              " parameter: -j " + name + "=<value> must be a percentage"
+              " in the range of 0 to 100");
+        if (name == "release") {
+            release_percentage_ = value;
+        } else if (name == "decline") {
+            decline_percentage_ = value;
+        } else if (name == "rebind") {
+            rebind_percentage_ = value;
+        } else {
+            isc_throw(isc::InvalidParameter, "unknown client lifecycle"
+                      " parameter: -j " << name << ", expected one of:"
+                      " release, decline, rebind, time-scale");
+        }
+    }
+    lifecycle_params_set_ = true;
+}
+
 void
 CommandOptions::printCommandLine() const {
     std::cout << "IPv" << static_cast<int>(ipversion_) << std::endl;
@@ -927,6 +1074,28 @@ CommandOptions::printCommandLine() const {
         }
     }
     std::cout << "lease-type=" << getLeaseType().toText() << std::endl;
+    if (output_format_ != TEXT_OUTPUT) {
+        std::cout << "output-format="
+                  << (output_format_ == JSON_OUTPUT ? "json" : "csv")
+                  << std::endl;
+    }
+    if (scenario_ != BASIC) {
+        std::cout << "scenario="
+                  << (scenario_ == LIFECYCLE ? "lifecycle" : "avalanche")
+                  << std::endl;
+        if (release_percentage_ != 0) {
+            std::cout << "release[%]=" << release_percentage_ << std::endl;
+        }
+        if (decline_percentage_ != 0) {
+            std::cout << "decline[%]=" << decline_percentage_ << std::endl;
+        }
+        if (rebind_percentage_ != 0) {
+            std::cout << "rebind[%]=" << rebind_percentage_ << std::endl;
+        }
+        if (time_scale_ != 1) {
+            std::cout << "time-scale=" << time_scale_ << std::endl;
+        }
+    }
     if (rate_ != 0) {
         std::cout << "rate[1/s]=" << rate_ <<  std::endl;
     }
@@ -967,6 +1136,9 @@ CommandOptions::printCommandLine() const {
     if (getLocalPort() != 0) {
         std::cout << "local-port=" << local_port_ <<  std::endl;
     }
+    if (threads_num_ > 1) {
+        std::cout << "threads=" << threads_num_ << std::endl;
+    }
     if (seeded_) {
         std::cout << "seed=" << seed_ << std::endl;
     }
@@ -1026,7 +1198,10 @@ CommandOptions::usage() const {
         "         [-F<release-rate>] [-t<report>] [-R<range>] [-b<base>]\n"
         "         [-n<num-request>] [-p<test-period>] [-d<drop-time>]\n"
         "         [-D<max-drop>] [-l<local-addr|interface>] [-P<preload>]\n"
-        "         [-a<aggressivity>] [-L<local-port>] [-s<seed>] [-i] [-B]\n"
+        "         [-a<aggressivity>] [-L<local-port>] [-g<threads>]\n"
+        "         [-Y<scenario>] [-j<lifecycle-parameter>]\n"
+        "         [-J<output-format>]\n"
+        "         [-s<seed>] [-i] [-B]\n"
         "         [-W<late-exit-delay>]\n"
         "         [-c] [-1] [-M<mac-list-file>] [-T<template-file>]\n"
         "         [-X<xid-offset>] [-O<random-offset] [-E<time-offset>]\n"
@@ -1079,11 +1254,38 @@ CommandOptions::usage() const {
         "    with the exchange rate (given by -r<rate>).  Furthermore the sum of\n"
         "    this value and the release-rate (given by -F<rate) must be equal\n"
         "    to or less than the exchange rate.\n"
+        "-g<threads>: Number of threads sending and receiving packets.  Each\n"
+        "    thread uses its own socket bound to the next local port, starting\n"
+        "    from the one given by -L<local-port> or the default, and adds the\n"
+        "    relay port option to the packets so as the server sends responses\n"
+        "    to this port.  The simulated clients, the rates, the number of\n"
+        "    requests, the preload and the maximum drops are divided between\n"
+        "    the threads.  The default is 1.\n"
         "-h: Print this help.\n"
         "-i: Do only the initial part of an exchange: DO or SA, depending on\n"
         "    whether -6 is given.\n"
         "-I<ip-offset>: Offset of the (DHCPv4) IP address in the requested-IP\n"
         "    option / (DHCPv6) IA_NA option in the (second/request) template.\n"
+        "-j<lifecycle-parameter>: A parameter of the simulated clients used\n"
+        "    with -Y lifecycle or -Y avalanche, in the <name>=<value> form.\n"
+        "    This can be specified multiple times.  The parameters are:\n"
+        "   * release=<percentage>: percentage of the clients releasing their\n"
+        "     leases at the renewal time instead of renewing them\n"
+        "   * decline=<percentage>: percentage of the clients declining the\n"
+        "     acquired leases\n"
+        "   * rebind=<percentage>: percentage of the clients which don't\n"
+        "     renew their leases, e.g. because the server is unreachable,\n"
+        "     and rebind them\n"
+        "   * time-scale=<factor>: the lease timers received from the\n"
+        "     server are divided by this factor (default 1)\n"
+        "-J<output-format>: The format of the intermediate reports (given by\n"
+        "    -t) and the final report.  It may be one of the following: text\n"
+        "    (default), json or csv.  In the json format each report is\n"
+        "    printed as a single line holding a JSON map.  In the csv format\n"
+        "    the header line is printed first, followed by one line for each\n"
+        "    exchange type in each report.  The intermediate reports hold the\n"
+        "    statistics of the packets sent and received since the previous\n"
+        "    report.  The delays are given in milliseconds.\n"
         "-l<local-addr|interface>: For DHCPv4 operation, specify the local\n"
         "    hostname/address to use when communicating with the server.  By\n"
         "    default, the interface address through which traffic would\n"
@@ -1128,6 +1330,17 @@ CommandOptions::usage() const {
         "   * 't': when finished, print timers of all successful exchanges\n"
         "   * 'T': when finished, print templates\n"
         "-X<xid-offset>: Transaction ID (aka. xid) offset in the template.\n"
+        "-Y<scenario>: The traffic scenario.  It may be one of the following:\n"
+        "    basic (default), lifecycle or avalanche.  In the lifecycle\n"
+        "    scenario a population of <range> clients (given by -R) acquire\n"
+        "    leases at the exchange rate and keep them: they renew at T1,\n"
+        "    rebind at T2, go back to the initial state when the lease\n"
+        "    expires, and release or decline the leases as specified with\n"
+        "    -j.  In the avalanche scenario all clients acquire leases and\n"
+        "    then return at once as after an outage, using DHCPv4\n"
+        "    INIT-REBOOT or DHCPv6 Rebind, and the test ends when all of them\n"
+        "    are bound again.  The statistics are reported separately for\n"
+        "    each exchange type.\n"
         "\n"
         "DHCPv4 only options:\n"
         "-B: Force broadcast handling.\n"
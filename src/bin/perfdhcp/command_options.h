@@ -106,6 +106,20 @@ public:
         DORA_SARR
     };
 
+    /// Traffic scenario (cmd line param -Y)
+    enum Scenario {
+        BASIC,     ///< Exchanges initiated at the specified rates.
+        LIFECYCLE, ///< Clients renewing, rebinding and releasing leases.
+        AVALANCHE  ///< All clients returning at once after an outage.
+    };
+
+    /// Format of the reports (cmd line param -J)
+    enum OutputFormat {
+        TEXT_OUTPUT, ///< Human readable reports.
+        JSON_OUTPUT, ///< One JSON map per report.
+        CSV_OUTPUT   ///< One CSV row per exchange in each report.
+    };
+
     /// CommandOptions is a singleton class. This method returns reference
     /// to its sole instance.
     ///
@@ -141,6 +155,16 @@ public:
     /// \return packet exchange mode.
     ExchangeMode getExchangeMode() const { return exchange_mode_; }
 
+    /// \brief Returns traffic scenario.
+    ///
+    /// \return traffic scenario.
+    Scenario getScenario() const { return scenario_; }
+
+    /// \brief Returns format of the reports.
+    ///
+    /// \return format of the reports.
+    OutputFormat getOutputFormat() const { return output_format_; }
+
     /// \ brief Returns the type of lease being requested.
     ///
     /// \return type of lease being requested by perfdhcp.
@@ -248,6 +272,33 @@ public:
     /// \return local port number.
     int getLocalPort() const { return local_port_; }
 
+    /// \brief Returns number of threads sending and receiving packets.
+    ///
+    /// \return number of threads.
+    int getThreadsNum() const { return threads_num_; }
+
+    /// \brief Returns percentage of clients releasing their leases.
+    ///
+    /// \return percentage of bound clients which release their leases
+    /// instead of renewing them.
+    int getReleasePercentage() const { return release_percentage_; }
+
+    /// \brief Returns percentage of clients declining their leases.
+    ///
+    /// \return percentage of clients which decline the acquired leases.
+    int getDeclinePercentage() const { return decline_percentage_; }
+
+    /// \brief Returns percentage of clients failing to renew.
+    ///
+    /// \return percentage of bound clients which don't send Renew and
+    /// rebind their leases.
+    int getRebindPercentage() const { return rebind_percentage_; }
+
+    /// \brief Returns the factor by which the lease timers are shortened.
+    ///
+    /// \return factor by which the lease timers are divided.
+    int getTimeScale() const { return time_scale_; }
+
     /// @brief Returns the time in microseconds to delay the program by.
     ///
     /// @return the time in microseconds to delay the program by.
@@ -420,6 +471,30 @@ private:
     /// \throw InvalidParameter if lease type value specified is invalid.
     void initLeaseType();
 
+    /// \brief Decodes the traffic scenario from optarg.
+    ///
+    /// \throw InvalidParameter if scenario value specified is invalid.
+    void initScenario();
+
+    /// \brief Decodes the format of the reports from optarg.
+    ///
+    /// \throw InvalidParameter if format value specified is invalid.
+    void initOutputFormat();
+
+    /// \brief Decodes the client lifecycle parameter.
+    ///
+    /// Function decodes the parameter specified with -j<param>=<value>
+    /// and sets the corresponding member. The following parameters are
+    /// supported:
+    /// - release=<percentage> percentage of clients releasing leases,
+    /// - decline=<percentage> percentage of clients declining leases,
+    /// - rebind=<percentage> percentage of clients failing to renew,
+    /// - time-scale=<factor> factor by which lease timers are divided.
+    ///
+    /// \param param parameter in string format.
+    /// \throw isc::InvalidParameter if parameter is invalid.
+    void decodeLifecycleParam(const std::string& param);
+
     /// \brief Set number of clients.
     ///
     /// Interprets the getopt() "opt" global variable as the number of clients
@@ -503,6 +578,30 @@ private:
     /// Packet exchange mode (e.g. DORA/SARR)
     ExchangeMode exchange_mode_;
 
+    /// Traffic scenario.
+    Scenario scenario_;
+
+    /// Format of the reports.
+    OutputFormat output_format_;
+
+    /// Indicates that client lifecycle parameters have been specified.
+    bool lifecycle_params_set_;
+
+    /// Percentage of bound clients releasing their leases when the
+    /// renewal time comes.
+    int release_percentage_;
+
+    /// Percentage of clients declining the acquired leases.
+    int decline_percentage_;
+
+    /// Percentage of bound clients which don't renew the leases and
+    /// rebind them.
+    int rebind_percentage_;
+
+    /// Factor by which the lease timers received from the server are
+    /// divided.
+    int time_scale_;
+
     /// Lease Type to be obtained: address only, IPv6 prefix only.
     LeaseType lease_type_;
 
@@ -580,6 +679,10 @@ private:
     /// Local port number (host endian)
     int local_port_;
 
+    /// Number of threads sending and receiving packets. Each thread
+    /// uses its own socket.
+    int threads_num_;
+
     /// Randomization seed.
     uint32_t seed_;
 
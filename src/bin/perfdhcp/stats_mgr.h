@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,9 +7,11 @@
 #ifndef STATS_MGR_H
 #define STATS_MGR_H
 
+#include <cc/data.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
 #include <exceptions/exceptions.h>
+#include <stats/latency_histogram.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
@@ -20,14 +22,29 @@
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <algorithm>
+#include <iomanip>
 #include <iostream>
 #include <map>
 #include <queue>
+#include <sstream>
 
 
 namespace isc {
 namespace perfdhcp {
 
+/// \brief Percentiles of the packet delays included in the JSON and
+/// CSV reports.
+const double DELAY_PERCENTILES[] = { 50, 90, 99, 99.9 };
+
+/// \brief Number of the percentiles included in the reports.
+const size_t DELAY_PERCENTILES_NUM =
+    sizeof(DELAY_PERCENTILES) / sizeof(DELAY_PERCENTILES[0]);
+
+/// \brief Number of bits determining the precision of the histogram of
+/// the packet delays, i.e. a relative error of the percentiles below 1/64.
+const unsigned DELAY_HISTOGRAM_BITS = 7;
+
 /// \brief Statistics Manager
 ///
 /// This class template is a storage for various performance statistics
@@ -79,7 +96,7 @@ public:
             return (this_counter);
         }
 
-        const CustomCounter& operator+=(int val) {
+        const CustomCounter& operator+=(const uint64_t val) {
             counter_ += val;
             return (*this);
         }
@@ -116,10 +133,14 @@ public:
         XCHG_DO,  ///< DHCPv4 DISCOVER-OFFER
         XCHG_RA,  ///< DHCPv4 REQUEST-ACK
         XCHG_RNA, ///< DHCPv4 REQUEST-ACK (renewal)
+        XCHG_RBA, ///< DHCPv4 REQUEST-ACK (rebinding)
+        XCHG_IRA, ///< DHCPv4 REQUEST-ACK (init-reboot)
         XCHG_SA,  ///< DHCPv6 SOLICIT-ADVERTISE
         XCHG_RR,  ///< DHCPv6 REQUEST-REPLY
         XCHG_RN,  ///< DHCPv6 RENEW-REPLY
-        XCHG_RL   ///< DHCPv6 RELEASE-REPLY
+        XCHG_RL,  ///< DHCPv6 RELEASE-REPLY
+        XCHG_RB,  ///< DHCPv6 REBIND-REPLY
+        XCHG_DR   ///< DHCPv6 DECLINE-REPLY
     };
 
     /// \brief Exchange Statistics.
@@ -278,8 +299,11 @@ public:
               drop_time_(drop_time),
               min_delay_(std::numeric_limits<double>::max()),
               max_delay_(0.),
+              interval_min_delay_(std::numeric_limits<double>::max()),
+              interval_max_delay_(0.),
               sum_delay_(0.),
               sum_delay_squared_(0.),
+              delay_histogram_(DELAY_HISTOGRAM_BITS),
               orphans_(0),
               collected_(0),
               unordered_lookup_size_sum_(0),
@@ -366,10 +390,16 @@ public:
             if (delta > max_delay_) {
                 max_delay_ = delta;
             }
+            // Record the extreme delays of the current interval.
+            interval_min_delay_ = std::min(interval_min_delay_, delta);
+            interval_max_delay_ = std::max(interval_max_delay_, delta);
             // Update delay sum and square sum. That will be used to calculate
             // mean delays.
             sum_delay_ += delta;
             sum_delay_squared_ += delta * delta;
+            // Record the delay in microseconds for the percentiles.
+            delay_histogram_.record(static_cast<uint64_t>(
+                period.length().total_microseconds()));
         }
 
         /// \brief Match received packet with the corresponding sent packet.
@@ -578,8 +608,41 @@ public:
             if (rcvd_packets_num_ == 0) {
                 isc_throw(InvalidOperation, "no packets received");
             }
-            return(sqrt(sum_delay_squared_ / rcvd_packets_num_ -
-                        getAvgDelay() * getAvgDelay()));
+            // The variance may be slightly negative due to the rounding
+            // errors when the statistics have been subtracted.
+            return(sqrt(std::max(0., sum_delay_squared_ / rcvd_packets_num_ -
+                                 getAvgDelay() * getAvgDelay())));
+        }
+
+        /// \brief Return packet delay at the specified percentile.
+        ///
+        /// Method returns the delay which is not exceeded by the specified
+        /// percentage of the received packets. The delays are recorded in
+        /// the histogram, so the returned value has a relative error lower
+        /// than 1/64. If no packets have been received for this exchange,
+        /// the percentile can't be calculated and thus method throws
+        /// exception.
+        ///
+        /// \param percentile percentile in the range of 0 to 100.
+        /// \throw isc::InvalidOperation if number of received packets
+        /// for the exchange is equal to zero.
+        /// \throw isc::BadValue if the percentile is out of range.
+        /// \return packet delay at the percentile.
+        double getDelayPercentile(const double percentile) const {
+            if ((percentile < 0) || (percentile > 100)) {
+                isc_throw(BadValue, "percentile " << percentile << " is out"
+                          " of range of 0 to 100");
+            }
+            if (delay_histogram_.getCount() == 0) {
+                isc_throw(InvalidOperation, "no packets received");
+            }
+            return (static_cast<double>(
+                delay_histogram_.getPercentile(percentile)) / 1e6);
+        }
+
+        /// \brief Return histogram of the packet delays.
+        const isc::stats::LatencyHistogram& getDelayHistogram() const {
+            return (delay_histogram_);
         }
 
         /// \brief Return number of orphan packets.
@@ -667,6 +730,159 @@ public:
             return(drops);
         }
 
+        /// \brief Add statistics collected by another object.
+        ///
+        /// Method adds the packet counters and the delays collected
+        /// by another object to this object. It is used to combine the
+        /// statistics collected by multiple threads. The packets held by
+        /// the other object are not copied.
+        ///
+        /// \param other statistics to be added.
+        void merge(const ExchangeStats& other) {
+            min_delay_ = std::min(min_delay_, other.min_delay_);
+            max_delay_ = std::max(max_delay_, other.max_delay_);
+            mergeIntervalDelays(other);
+            sum_delay_ += other.sum_delay_;
+            sum_delay_squared_ += other.sum_delay_squared_;
+            delay_histogram_.merge(other.delay_histogram_);
+            orphans_ += other.orphans_;
+            collected_ += other.collected_;
+            unordered_lookup_size_sum_ += other.unordered_lookup_size_sum_;
+            unordered_lookups_ += other.unordered_lookups_;
+            ordered_lookups_ += other.ordered_lookups_;
+            sent_packets_num_ += other.sent_packets_num_;
+            rcvd_packets_num_ += other.rcvd_packets_num_;
+        }
+
+        /// \brief Add the extreme delays of the interval recorded by
+        /// another object.
+        ///
+        /// \param other statistics which interval delays are added.
+        void mergeIntervalDelays(const ExchangeStats& other) {
+            interval_min_delay_ = std::min(interval_min_delay_,
+                                           other.interval_min_delay_);
+            interval_max_delay_ = std::max(interval_max_delay_,
+                                           other.interval_max_delay_);
+        }
+
+        /// \brief Start a new interval.
+        ///
+        /// Method resets the minimum and maximum delays recorded since
+        /// the start of the current interval. These delays are used by
+        /// \ref subtract, so this method must be called when the copy
+        /// later subtracted from this object is made.
+        void startInterval() {
+            interval_min_delay_ = std::numeric_limits<double>::max();
+            interval_max_delay_ = 0.;
+        }
+
+        /// \brief Subtract statistics collected by an earlier copy.
+        ///
+        /// Method removes the packet counters and the delays collected
+        /// by an earlier copy of this object, so as this object holds
+        /// the statistics of the period between the two copies. It is
+        /// used for the intermediate reports. The minimum and maximum
+        /// delays of this period are the ones recorded since the last
+        /// call to \ref startInterval.
+        ///
+        /// \param earlier statistics collected by an earlier copy.
+        void subtract(const ExchangeStats& earlier) {
+            delay_histogram_.subtract(earlier.delay_histogram_);
+            sum_delay_ -= earlier.sum_delay_;
+            sum_delay_squared_ -= earlier.sum_delay_squared_;
+            orphans_ -= earlier.orphans_;
+            collected_ -= earlier.collected_;
+            unordered_lookup_size_sum_ -= earlier.unordered_lookup_size_sum_;
+            unordered_lookups_ -= earlier.unordered_lookups_;
+            ordered_lookups_ -= earlier.ordered_lookups_;
+            sent_packets_num_ -= earlier.sent_packets_num_;
+            rcvd_packets_num_ -= earlier.rcvd_packets_num_;
+            if (delay_histogram_.getCount() > 0) {
+                min_delay_ = interval_min_delay_;
+                max_delay_ = interval_max_delay_;
+            } else {
+                min_delay_ = std::numeric_limits<double>::max();
+                max_delay_ = 0.;
+            }
+        }
+
+        /// \brief Return statistics for packet exchange as an element.
+        ///
+        /// Method returns the map holding the name of the exchange, the
+        /// packet counters and the delays in milliseconds. The delays
+        /// are null if no packets have been received.
+        ///
+        /// \return map holding the statistics.
+        isc::data::ElementPtr toElement() const {
+            using namespace isc::data;
+            typedef long long int Counter;
+            ElementPtr stats = Element::createMap();
+            stats->set("exchange",
+                       Element::create(exchangeToString(xchg_type_)));
+            stats->set("sent", Element::create(Counter(getSentPacketsNum())));
+            stats->set("received",
+                       Element::create(Counter(getRcvdPacketsNum())));
+            stats->set("drops",
+                       Element::create(Counter(getDroppedPacketsNum())));
+            stats->set("collected",
+                       Element::create(Counter(getCollectedNum())));
+            if (getRcvdPacketsNum() == 0) {
+                stats->set("min-delay", Element::create());
+                stats->set("avg-delay", Element::create());
+                stats->set("max-delay", Element::create());
+                stats->set("std-deviation", Element::create());
+            } else {
+                stats->set("min-delay", Element::create(getMinDelay() * 1e3));
+                stats->set("avg-delay", Element::create(getAvgDelay() * 1e3));
+                stats->set("max-delay", Element::create(getMaxDelay() * 1e3));
+                stats->set("std-deviation",
+                           Element::create(getStdDevDelay() * 1e3));
+            }
+            for (size_t i = 0; i < DELAY_PERCENTILES_NUM; ++i) {
+                std::ostringstream name;
+                name << "p" << DELAY_PERCENTILES[i] << "-delay";
+                if (getRcvdPacketsNum() == 0) {
+                    stats->set(name.str(), Element::create());
+                } else {
+                    stats->set(name.str(), Element::create(
+                        getDelayPercentile(DELAY_PERCENTILES[i]) * 1e3));
+                }
+            }
+            return (stats);
+        }
+
+        /// \brief Print statistics for packet exchange as CSV row.
+        ///
+        /// Method prints the packet counters and the delays in the order
+        /// of the columns printed by \ref StatsMgr::printCSVHeader. The
+        /// delays are empty if no packets have been received.
+        ///
+        /// \param prefix values of the leading columns, including the
+        /// trailing separator.
+        void printCSV(const std::string& prefix) const {
+            using namespace std;
+            ostringstream s;
+            s << prefix << exchangeToString(xchg_type_) << ","
+              << getSentPacketsNum() << "," << getRcvdPacketsNum() << ","
+              << getDroppedPacketsNum() << "," << getCollectedNum();
+            if (getRcvdPacketsNum() > 0) {
+                s << fixed << setprecision(3)
+                  << "," << getMinDelay() * 1e3
+                  << "," << getAvgDelay() * 1e3
+                  << "," << getMaxDelay() * 1e3
+                  << "," << getStdDevDelay() * 1e3;
+                for (size_t i = 0; i < DELAY_PERCENTILES_NUM; ++i) {
+                    s << "," << getDelayPercentile(DELAY_PERCENTILES[i]) * 1e3;
+                }
+            } else {
+                s << ",,,,";
+                for (size_t i = 0; i < DELAY_PERCENTILES_NUM; ++i) {
+                    s << ",";
+                }
+            }
+            cout << s.str() << endl;
+        }
+
         /// \brief Print main statistics for packet exchange.
         ///
         /// Method prints main statistics for particular exchange.
@@ -704,6 +920,14 @@ public:
                      << "max delay: " << getMaxDelay() * 1e3 << " ms" << endl
                      << "std deviation: " << getStdDevDelay() * 1e3 << " ms"
                      << endl
+                     << "p50 delay: " << getDelayPercentile(50) * 1e3 << " ms"
+                     << endl
+                     << "p90 delay: " << getDelayPercentile(90) * 1e3 << " ms"
+                     << endl
+                     << "p99 delay: " << getDelayPercentile(99) * 1e3 << " ms"
+                     << endl
+                     << "p99.9 delay: " << getDelayPercentile(99.9) * 1e3
+                     << " ms" << endl
                      << "collected packets: " << getCollectedNum() << endl;
             } catch (const Exception&) {
                 cout << "Delay summary unavailable! No packets received." << endl;
@@ -841,11 +1065,18 @@ public:
                                        ///< and received packets.
         double max_delay_;             ///< Maximum delay between sent
                                        ///< and received packets.
+        double interval_min_delay_;    ///< Minimum delay since the start
+                                       ///< of the current interval.
+        double interval_max_delay_;    ///< Maximum delay since the start
+                                       ///< of the current interval.
         double sum_delay_;             ///< Sum of delays between sent
                                        ///< and received packets.
         double sum_delay_squared_;     ///< Squared sum of delays between
                                        ///< sent and received packets.
 
+        /// Histogram of delays between sent and received packets.
+        isc::stats::LatencyHistogram delay_histogram_;
+
         uint64_t orphans_;   ///< Number of orphan received packets.
 
         uint64_t collected_; ///< Number of garbage collected packets.
@@ -994,6 +1225,83 @@ public:
         return (*counter);
     }
 
+    /// \brief Add statistics collected by another Statistics Manager.
+    ///
+    /// Method adds the statistics of all exchange types and the custom
+    /// counters of the other object to this object. Exchange types and
+    /// counters which haven't been added to this object are added. The
+    /// packets held by the other object are not copied, so its timestamps
+    /// are not available in this object.
+    ///
+    /// \param other Statistics Manager which statistics are added.
+    void merge(const StatsMgr& other) {
+        for (ExchangesMapIterator it = other.exchanges_.begin();
+             it != other.exchanges_.end(); ++it) {
+            if (!hasExchangeStats(it->first)) {
+                addExchangeStats(it->first);
+            }
+            getExchangeStats(it->first)->merge(*it->second);
+        }
+        for (CustomCountersMapIterator it = other.custom_counters_.begin();
+             it != other.custom_counters_.end(); ++it) {
+            if (custom_counters_.find(it->first) == custom_counters_.end()) {
+                addCustomCounter(it->first, it->second->getName());
+            }
+            incrementCounter(it->first, it->second->getValue());
+        }
+    }
+
+    /// \brief Add the extreme delays of the interval recorded by another
+    /// Statistics Manager.
+    ///
+    /// Method adds the minimum and maximum delays recorded since the start
+    /// of the current interval by the other object. The other statistics
+    /// are left unchanged. Exchange types which haven't been added to this
+    /// object are ignored.
+    ///
+    /// \param other Statistics Manager which interval delays are added.
+    void mergeIntervalDelays(const StatsMgr& other) {
+        for (ExchangesMapIterator it = other.exchanges_.begin();
+             it != other.exchanges_.end(); ++it) {
+            if (hasExchangeStats(it->first)) {
+                getExchangeStats(it->first)->mergeIntervalDelays(*it->second);
+            }
+        }
+    }
+
+    /// \brief Start a new interval.
+    ///
+    /// Method resets the minimum and maximum delays recorded since the
+    /// start of the current interval for all exchange types. It is called
+    /// when the copy used for the next intermediate report is made.
+    void startInterval() {
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            it->second->startInterval();
+        }
+    }
+
+    /// \brief Subtract statistics collected by an earlier copy.
+    ///
+    /// Method subtracts the statistics of the exchanges collected by an
+    /// earlier copy of this object, which is created with \ref merge.
+    /// It leaves the statistics collected between the two copies, which
+    /// are used for the intermediate reports. The minimum and maximum
+    /// delays are the ones recorded since the last call to
+    /// \ref startInterval, which is made with the earlier copy. The
+    /// exchanges which are not present in the earlier copy and the custom
+    /// counters are left unchanged.
+    ///
+    /// \param earlier earlier copy of this Statistics Manager.
+    void subtract(const StatsMgr& earlier) {
+        for (ExchangesMapIterator it = earlier.exchanges_.begin();
+             it != earlier.exchanges_.end(); ++it) {
+            if (hasExchangeStats(it->first)) {
+                getExchangeStats(it->first)->subtract(*it->second);
+            }
+        }
+    }
+
     /// \brief Adds new packet to the sent packets list.
     ///
     /// Method adds new packet to the sent packets list.
@@ -1087,6 +1395,20 @@ public:
         return(xchg_stats->getStdDevDelay());
     }
 
+    /// \brief Return packet delay at the specified percentile.
+    ///
+    /// Method returns packet delay at the specified percentile
+    /// for specified exchange type.
+    ///
+    /// \param xchg_type exchange type.
+    /// \param percentile percentile in the range of 0 to 100.
+    /// \return packet delay at the percentile.
+    double getDelayPercentile(const ExchangeType xchg_type,
+                              const double percentile) const {
+        ExchangeStatsPtr xchg_stats = getExchangeStats(xchg_type);
+        return(xchg_stats->getDelayPercentile(percentile));
+    }
+
     /// \brief Return number of orphan packets.
     ///
     /// Method returns number of orphan packets for specified
@@ -1229,6 +1551,10 @@ public:
             return("REQUEST-ACK");
         case XCHG_RNA:
             return("REQUEST-ACK (renewal)");
+        case XCHG_RBA:
+            return("REQUEST-ACK (rebinding)");
+        case XCHG_IRA:
+            return("REQUEST-ACK (init-reboot)");
         case XCHG_SA:
             return("SOLICIT-ADVERTISE");
         case XCHG_RR:
@@ -1237,6 +1563,10 @@ public:
             return("RENEW-REPLY");
         case XCHG_RL:
             return("RELEASE-REPLY");
+        case XCHG_RB:
+            return("REBIND-REPLY");
+        case XCHG_DR:
+            return("DECLINE-REPLY");
         default:
             return("Unknown exchange type");
         }
@@ -1277,11 +1607,18 @@ public:
     ///
     /// Method prints intermediate statistics for all exchanges.
     /// Statistics includes sent, received and dropped packets
-    /// counters.
-    void printIntermediateStats() const {
+    /// counters and the median and 99th percentile of the delays
+    /// of the packets received since the previous report.
+    ///
+    /// \param interval statistics collected since the previous report.
+    void printIntermediateStats(const StatsMgr& interval) const {
         std::ostringstream stream_sent;
         std::ostringstream stream_rcvd;
         std::ostringstream stream_drops;
+        std::ostringstream stream_p50;
+        std::ostringstream stream_p99;
+        stream_p50 << std::fixed << std::setprecision(3);
+        stream_p99 << std::fixed << std::setprecision(3);
         std::string sep("");
         for (ExchangesMapIterator it = exchanges_.begin();
              it != exchanges_.end(); ++it) {
@@ -1292,13 +1629,91 @@ public:
             stream_sent << sep << it->second->getSentPacketsNum();
             stream_rcvd << sep << it->second->getRcvdPacketsNum();
             stream_drops << sep << it->second->getDroppedPacketsNum();
+            ExchangesMapIterator interval_it =
+                interval.exchanges_.find(it->first);
+            if ((interval_it != interval.exchanges_.end()) &&
+                (interval_it->second->getRcvdPacketsNum() > 0)) {
+                stream_p50 << sep
+                           << interval_it->second->getDelayPercentile(50) * 1e3;
+                stream_p99 << sep
+                           << interval_it->second->getDelayPercentile(99) * 1e3;
+            } else {
+                stream_p50 << sep << "-";
+                stream_p99 << sep << "-";
+            }
         }
         std::cout << "sent: " << stream_sent.str()
                   << "; received: " << stream_rcvd.str()
                   << "; drops: " << stream_drops.str()
+                  << "; p50 delay: " << stream_p50.str() << " ms"
+                  << "; p99 delay: " << stream_p99.str() << " ms"
                   << std::endl;
     }
 
+    /// \brief Print names of the columns of the CSV report.
+    ///
+    /// The report and elapsed columns hold the values passed to the
+    /// \ref printStatsCSV. The delays are in milliseconds.
+    static void printCSVHeader() {
+        std::cout << "report,elapsed,exchange,sent,received,drops,collected,"
+                  << "min-delay,avg-delay,max-delay,std-deviation";
+        for (size_t i = 0; i < DELAY_PERCENTILES_NUM; ++i) {
+            std::cout << ",p" << DELAY_PERCENTILES[i] << "-delay";
+        }
+        std::cout << std::endl;
+    }
+
+    /// \brief Print statistics of all exchanges as CSV rows.
+    ///
+    /// Method prints one row for each exchange. The custom counters are
+    /// not printed.
+    ///
+    /// \param report name of the report, e.g. "interval" or "summary".
+    /// \param elapsed number of seconds since the start of the test.
+    void printStatsCSV(const std::string& report, const double elapsed) const {
+        std::ostringstream prefix;
+        prefix << report << "," << std::fixed << std::setprecision(3)
+               << elapsed << ",";
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            it->second->printCSV(prefix.str());
+        }
+    }
+
+    /// \brief Print statistics of all exchanges as JSON.
+    ///
+    /// Method prints a single line holding the JSON map with the name
+    /// of the report, the number of seconds since the start of the test,
+    /// the list of the statistics of all exchanges and, optionally, the
+    /// values of the custom counters.
+    ///
+    /// \param report name of the report, e.g. "interval" or "summary".
+    /// \param elapsed number of seconds since the start of the test.
+    /// \param counters indicates if the custom counters are included.
+    void printStatsJSON(const std::string& report, const double elapsed,
+                        const bool counters = false) const {
+        using namespace isc::data;
+        ElementPtr stats = Element::createMap();
+        stats->set("report", Element::create(report));
+        stats->set("elapsed", Element::create(elapsed));
+        ElementPtr exchanges = Element::createList();
+        for (ExchangesMapIterator it = exchanges_.begin();
+             it != exchanges_.end(); ++it) {
+            exchanges->add(it->second->toElement());
+        }
+        stats->set("exchanges", exchanges);
+        if (counters) {
+            ElementPtr values = Element::createMap();
+            for (CustomCountersMapIterator it = custom_counters_.begin();
+                 it != custom_counters_.end(); ++it) {
+                const long long int value = it->second->getValue();
+                values->set(it->first, Element::create(value));
+            }
+            stats->set("counters", values);
+        }
+        std::cout << stats->str() << std::endl;
+    }
+
     /// \brief Print timestamps of all packets.
     ///
     /// Method prints timestamps of all sent and received
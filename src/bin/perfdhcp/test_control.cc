@@ -12,16 +12,24 @@
 #include <dhcp/iface_mgr.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
+#include <dhcp/option_int.h>
+#include <dhcp/pkt_filter_inet.h>
+#include <dhcp/pkt_filter_inet6.h>
+#include <util/threads/thread.h>
 #include <util/unittests/check_valgrind.h>
 #include "test_control.h"
 #include "command_options.h"
 #include "perf_pkt4.h"
 #include "perf_pkt6.h"
 
+#include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/foreach.hpp>
 
 #include <algorithm>
+#include <cerrno>
+#include <cstring>
 #include <fstream>
 #include <stdio.h>
 #include <stdlib.h>
@@ -29,6 +37,7 @@
 #include <unistd.h>
 #include <signal.h>
 #include <sstream>
+#include <sys/select.h>
 #include <sys/wait.h>
 
 using namespace std;
@@ -36,14 +45,91 @@ using namespace boost::posix_time;
 using namespace isc;
 using namespace isc::dhcp;
 using namespace isc::asiolink;
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Returns the time shifted by the specified number of seconds.
+///
+/// \param time time to be shifted.
+/// \param seconds number of seconds.
+ptime
+addSeconds(const ptime& time, const double seconds) {
+    return (time + microseconds(static_cast<int64_t>(seconds * 1000000)));
+}
+
+/// \brief Reads the value of the DHCPv4 option carrying the lease time.
+///
+/// \param option lease time, renewal time or rebinding time option.
+/// \param [out] value value of the option in seconds.
+/// \return false if the option is missing or malformed.
+bool
+getTimeOption(const OptionPtr& option, uint32_t& value) {
+    if (!option) {
+        return (false);
+    }
+    OptionUint32Ptr option_uint32 =
+        boost::dynamic_pointer_cast<OptionUint32>(option);
+    if (option_uint32) {
+        value = option_uint32->getValue();
+        return (true);
+    }
+    if (option->getData().size() < sizeof(uint32_t)) {
+        return (false);
+    }
+    value = option->getUint32();
+    return (true);
+}
+
+}
 
 namespace isc {
 namespace perfdhcp {
 
-bool TestControl::interrupted_ = false;
+std::atomic<bool> TestControl::interrupted_(false);
 
 ptime late_exit_target_time_ = ptime(not_a_date_time);
 
+namespace {
+
+/// Interval in milliseconds between copies of the worker statistics made
+/// for the intermediate reports.
+const long STATS_PUBLISH_INTERVAL = 100;
+
+/// Interval in microseconds between checks whether the worker threads
+/// are still running.
+const useconds_t WORKERS_POLL_INTERVAL = 100000;
+
+/// \brief Waits until a packet can be read from the socket.
+///
+/// \param sockfd socket descriptor.
+/// \param timeout timeout in microseconds.
+/// \throw isc::dhcp::SocketReadError if select() failed.
+/// \return true if a packet can be read, false if the timeout occurred.
+bool
+waitForPacket(const int sockfd, const uint32_t timeout) {
+    fd_set sockets;
+    FD_ZERO(&sockets);
+    FD_SET(sockfd, &sockets);
+
+    struct timeval select_timeout;
+    select_timeout.tv_sec = timeout / 1000000;
+    select_timeout.tv_usec = timeout % 1000000;
+
+    int result = select(sockfd + 1, &sockets, NULL, NULL, &select_timeout);
+    if (result < 0) {
+        // The signal interrupting the test also interrupts select().
+        if (errno == EINTR) {
+            return (false);
+        }
+        isc_throw(SocketReadError, "failed to wait for a packet on socket "
+                  << sockfd << ": " << strerror(errno));
+    }
+    return (result > 0);
+}
+
+}
+
 bool
 TestControl::hasLateExitCommenced() const {
     return !late_exit_target_time_.is_not_a_date_time();
@@ -51,7 +137,6 @@ TestControl::hasLateExitCommenced() const {
 
 bool
 TestControl::waitToExit() const {
-    static ptime exit_time = ptime(not_a_date_time);
     CommandOptions& options = CommandOptions::instance();
     uint32_t wait_time = options.getExitWaitTime();
 
@@ -60,12 +145,12 @@ TestControl::waitToExit() const {
         const ptime now = microsec_clock::universal_time();
 
         // Init the end time if it hasn't started yet
-        if (exit_time.is_not_a_date_time()) {
-            exit_time = now + time_duration(microseconds(wait_time));
+        if (exit_time_.is_not_a_date_time()) {
+            exit_time_ = now + time_duration(microseconds(wait_time));
         }
 
         // If we're not at end time yet, return true
-        return (now < exit_time);
+        return (now < exit_time_);
     }
 
     // No need to wait, return false;
@@ -84,9 +169,9 @@ TestControl::haveAllPacketsBeenReceived() const {
     }
 
     uint32_t responses = 0;
-    uint32_t requests = num_request[0];
+    uint32_t requests = getWorkerShare(num_request[0]);
     if (num_request_size >= 2) {
-        requests += num_request[1];
+        requests += getWorkerShare(num_request[1]);
     }
 
     if (ipversion == 4) {
@@ -139,10 +224,38 @@ TestControl::instance() {
 }
 
 TestControl::TestControl()
-    : number_generator_(0, CommandOptions::instance().getMacsFromFile().size()) {
+    : number_generator_(0, CommandOptions::instance().getMacsFromFile().size()),
+      worker_index_(0), workers_num_(0), published_stats_reported_(false),
+      worker_running_(false), avalanche_started_(false) {
   reset();
 }
 
+TestControl::TestControl(const unsigned int worker_index,
+                         const unsigned int workers_num)
+    : number_generator_(0, CommandOptions::instance().getMacsFromFile().size()),
+      worker_index_(worker_index), workers_num_(workers_num),
+      published_stats_reported_(false), worker_running_(false),
+      avalanche_started_(false) {
+    reset();
+    CommandOptions& options = CommandOptions::instance();
+    if (options.getIpVersion() == 4) {
+        setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator()));
+        packet_filter4_.reset(new PktFilterInet());
+    } else {
+        setTransidGenerator(NumberGeneratorPtr(new SequentialGenerator(0x00FFFFFF)));
+        packet_filter6_.reset(new PktFilterInet6());
+    }
+
+    // Each worker simulates its own range of clients.
+    const uint32_t clients_num = options.getClientsNum();
+    if (clients_num < 2) {
+        setMacAddrGenerator(NumberGeneratorPtr(new SequentialGenerator(1)));
+    } else {
+        setMacAddrGenerator(NumberGeneratorPtr(new SequentialGenerator(
+            getWorkerShare(clients_num), getWorkerOffset(clients_num))));
+    }
+}
+
 void
 TestControl::checkLateMessages(RateControl& rate_control) {
     // If diagnostics is disabled, there is no need to log late sent messages.
@@ -229,11 +342,96 @@ TestControl::byte2Hex(const uint8_t b) const {
     return (stream.str());
 }
 
+bool
+TestControl::bindClient(const uint32_t client, const Pkt4Ptr& ack) {
+    if (ack->getYiaddr().isV4Zero()) {
+        return (false);
+    }
+    uint32_t valid = 0;
+    uint32_t t1 = 0;
+    uint32_t t2 = 0;
+    if (getTimeOption(ack->getOption(DHO_DHCP_LEASE_TIME), valid)) {
+        // Use the default renewal and rebinding times (RFC 2131, section
+        // 4.4.5) unless the server has sent them.
+        t1 = valid / 2;
+        t2 = static_cast<uint32_t>(static_cast<uint64_t>(valid) * 7 / 8);
+        getTimeOption(ack->getOption(DHO_DHCP_RENEWAL_TIME), t1);
+        getTimeOption(ack->getOption(DHO_DHCP_REBINDING_TIME), t2);
+    }
+    setClientBound(client, ack, t1, t2, valid);
+    return (true);
+}
+
+bool
+TestControl::bindClient(const uint32_t client, const Pkt6Ptr& reply) {
+    bool has_lease = false;
+    uint32_t preferred = 0;
+    uint32_t valid = 0;
+    uint32_t t1 = 0;
+    uint32_t t2 = 0;
+    // The client renews all its leases at the earliest time set by the
+    // server in any of the IA options.
+    for (OptionCollection::const_iterator opt = reply->options_.begin();
+         opt != reply->options_.end(); ++opt) {
+        Option6IAPtr ia = boost::dynamic_pointer_cast<Option6IA>(opt->second);
+        if (!ia) {
+            continue;
+        }
+        const OptionCollection& ia_options = ia->getOptions();
+        for (OptionCollection::const_iterator ia_opt = ia_options.begin();
+             ia_opt != ia_options.end(); ++ia_opt) {
+            // The prefix option derives from the address option.
+            Option6IAAddrPtr lease =
+                boost::dynamic_pointer_cast<Option6IAAddr>(ia_opt->second);
+            // The lease with the valid lifetime of 0 has been removed.
+            if (!lease || (lease->getValid() == 0)) {
+                continue;
+            }
+            if (!has_lease || (lease->getPreferred() < preferred)) {
+                preferred = lease->getPreferred();
+            }
+            if (!has_lease || (lease->getValid() < valid)) {
+                valid = lease->getValid();
+            }
+            has_lease = true;
+        }
+        // Zero renewal and rebinding times are left to the client.
+        if ((ia->getT1() > 0) && ((t1 == 0) || (ia->getT1() < t1))) {
+            t1 = ia->getT1();
+        }
+        if ((ia->getT2() > 0) && ((t2 == 0) || (ia->getT2() < t2))) {
+            t2 = ia->getT2();
+        }
+    }
+    if (!has_lease) {
+        return (false);
+    }
+    // Use the renewal and rebinding times recommended in RFC 8415,
+    // section 21.4.
+    if (t1 == 0) {
+        t1 = preferred / 2;
+    }
+    if (t2 == 0) {
+        t2 = static_cast<uint32_t>(static_cast<uint64_t>(preferred) * 4 / 5);
+    }
+    setClientBound(client, reply, t1, t2, valid);
+    return (true);
+}
+
 bool
 TestControl::checkExitConditions() const {
     if (interrupted_) {
         return (true);
     }
+    // The avalanche ends when all clients have returned.
+    if (avalanche_started_ &&
+        (population_->getStateCount(ClientPopulation::BOUND) ==
+         population_->size())) {
+        if (testDiags('e')) {
+            std::cout << "all clients returned." << std::endl;
+        }
+        return (true);
+    }
     CommandOptions& options = CommandOptions::instance();
     bool test_period_reached = false;
     // Check if test period passed.
@@ -264,12 +462,12 @@ TestControl::checkExitConditions() const {
     if (options.getNumRequests().size() > 0) {
         if (options.getIpVersion() == 4) {
             if (getSentPacketsNum(StatsMgr4::XCHG_DO) >=
-                options.getNumRequests()[0]) {
+                getWorkerShare(options.getNumRequests()[0])) {
                 max_requests = true;
             }
         } else if (options.getIpVersion() == 6) {
             if (stats_mgr6_->getSentPacketsNum(StatsMgr6::XCHG_SA) >=
-                options.getNumRequests()[0]) {
+                getWorkerShare(options.getNumRequests()[0])) {
                 max_requests = true;
             }
         }
@@ -278,12 +476,12 @@ TestControl::checkExitConditions() const {
     if (options.getNumRequests().size() > 1) {
         if (options.getIpVersion() == 4) {
             if (stats_mgr4_->getSentPacketsNum(StatsMgr4::XCHG_RA) >=
-                options.getNumRequests()[1]) {
+                getWorkerShare(options.getNumRequests()[1])) {
                 max_requests = true;
             }
         } else if (options.getIpVersion() == 6) {
             if (stats_mgr6_->getSentPacketsNum(StatsMgr6::XCHG_RR) >=
-                options.getNumRequests()[1]) {
+                getWorkerShare(options.getNumRequests()[1])) {
                 max_requests = true;
             }
         }
@@ -302,12 +500,12 @@ TestControl::checkExitConditions() const {
     if (options.getMaxDrop().size() > 0) {
         if (options.getIpVersion() == 4) {
             if (stats_mgr4_->getDroppedPacketsNum(StatsMgr4::XCHG_DO) >=
-                options.getMaxDrop()[0]) {
+                getWorkerShare(options.getMaxDrop()[0])) {
                 max_drops = true;
             }
         } else if (options.getIpVersion() == 6) {
             if (stats_mgr6_->getDroppedPacketsNum(StatsMgr6::XCHG_SA) >=
-                options.getMaxDrop()[0]) {
+                getWorkerShare(options.getMaxDrop()[0])) {
                 max_drops = true;
             }
         }
@@ -316,12 +514,12 @@ TestControl::checkExitConditions() const {
     if (options.getMaxDrop().size() > 1) {
         if (options.getIpVersion() == 4) {
             if (stats_mgr4_->getDroppedPacketsNum(StatsMgr4::XCHG_RA) >=
-                options.getMaxDrop()[1]) {
+                getWorkerShare(options.getMaxDrop()[1])) {
                 max_drops = true;
             }
         } else if (options.getIpVersion() == 6) {
             if (stats_mgr6_->getDroppedPacketsNum(StatsMgr6::XCHG_RR) >=
-                options.getMaxDrop()[1]) {
+                getWorkerShare(options.getMaxDrop()[1])) {
                 max_drops = true;
             }
         }
@@ -386,15 +584,49 @@ TestControl::checkExitConditions() const {
 
 Pkt4Ptr
 TestControl::createRequestFromAck(const dhcp::Pkt4Ptr& ack) {
+    return (createMessageFromAck(DHCPREQUEST, ack));
+}
+
+Pkt4Ptr
+TestControl::createMessageFromAck(const uint16_t msg_type,
+                                  const dhcp::Pkt4Ptr& ack) {
+    // Restrict messages to Request, Release and Decline.
+    if ((msg_type != DHCPREQUEST) && (msg_type != DHCPRELEASE) &&
+        (msg_type != DHCPDECLINE)) {
+        isc_throw(isc::BadValue, "invalid message type " << msg_type
+                  << " to be created from DHCPACK, expected DHCPREQUEST,"
+                  " DHCPRELEASE or DHCPDECLINE");
+    }
     if (!ack) {
-        isc_throw(isc::BadValue, "Unable to create DHCPREQUEST from a"
+        isc_throw(isc::BadValue, "Unable to create message from a"
                   " null DHCPACK message");
     } else if (ack->getYiaddr().isV4Zero()) {
-        isc_throw(isc::BadValue, "Unable to create DHCPREQUEST from a"
+        isc_throw(isc::BadValue, "Unable to create message from a"
                   " DHCPACK message containing yiaddr of 0");
     }
-    Pkt4Ptr msg(new Pkt4(DHCPREQUEST, generateTransid()));
-    msg->setCiaddr(ack->getYiaddr());
+    Pkt4Ptr msg(new Pkt4(msg_type, generateTransid()));
+    if (msg_type == DHCPDECLINE) {
+        // The declined address is carried in the Requested IP Address
+        // option and the ciaddr is 0 (RFC 2131, section 4.4.4).
+        OptionPtr opt_requested_address =
+            OptionPtr(new Option(Option::V4, DHO_DHCP_REQUESTED_ADDRESS,
+                                 OptionBuffer()));
+        opt_requested_address->setUint32(ack->getYiaddr().toUint32());
+        msg->addOption(opt_requested_address);
+    } else {
+        msg->setCiaddr(ack->getYiaddr());
+    }
+    // DHCPRELEASE and DHCPDECLINE are sent to the server which has
+    // allocated the lease.
+    if (msg_type != DHCPREQUEST) {
+        OptionPtr opt_serverid = ack->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+        if (!opt_serverid) {
+            isc_throw(isc::Unexpected, "failed to create message because"
+                      " server id option has not been found in the"
+                      " DHCPACK message");
+        }
+        msg->addOption(opt_serverid);
+    }
     msg->setHWAddr(ack->getHWAddr());
     msg->addOption(generateClientId(msg->getHWAddr()));
     return (msg);
@@ -403,15 +635,28 @@ TestControl::createRequestFromAck(const dhcp::Pkt4Ptr& ack) {
 Pkt6Ptr
 TestControl::createMessageFromReply(const uint16_t msg_type,
                                     const dhcp::Pkt6Ptr& reply) {
-    // Restrict messages to Release and Renew.
-    if (msg_type != DHCPV6_RENEW && msg_type != DHCPV6_RELEASE) {
+    // Get the string representation of the message - to be used for error
+    // logging purposes. Restrict messages to Renew, Rebind, Release and
+    // Decline.
+    const char* msg_type_str = NULL;
+    switch (msg_type) {
+    case DHCPV6_RENEW:
+        msg_type_str = "Renew";
+        break;
+    case DHCPV6_REBIND:
+        msg_type_str = "Rebind";
+        break;
+    case DHCPV6_RELEASE:
+        msg_type_str = "Release";
+        break;
+    case DHCPV6_DECLINE:
+        msg_type_str = "Decline";
+        break;
+    default:
         isc_throw(isc::BadValue, "invalid message type " << msg_type
-                  << " to be created from Reply, expected DHCPV6_RENEW or"
-                  " DHCPV6_RELEASE");
+                  << " to be created from Reply, expected DHCPV6_RENEW,"
+                  " DHCPV6_REBIND, DHCPV6_RELEASE or DHCPV6_DECLINE");
     }
-    // Get the string representation of the message - to be used for error
-    // logging purposes.
-    const char* msg_type_str = (msg_type == DHCPV6_RENEW ? "Renew" : "Release");
     // Reply message must be specified.
     if (!reply) {
         isc_throw(isc::BadValue, "Unable to create " << msg_type_str
@@ -428,14 +673,16 @@ TestControl::createMessageFromReply(const uint16_t msg_type,
                   " in the Reply message");
     }
     msg->addOption(opt_clientid);
-    // Server id.
-    OptionPtr opt_serverid = reply->getOption(D6O_SERVERID);
-    if (!opt_serverid) {
-        isc_throw(isc::Unexpected, "failed to create " << msg_type_str
-                  << " because server id option has not been found in the"
-                  " Reply message");
+    // Server id. The Rebind is sent to any available server.
+    if (msg_type != DHCPV6_REBIND) {
+        OptionPtr opt_serverid = reply->getOption(D6O_SERVERID);
+        if (!opt_serverid) {
+            isc_throw(isc::Unexpected, "failed to create " << msg_type_str
+                      << " because server id option has not been found in"
+                      " the Reply message");
+        }
+        msg->addOption(opt_serverid);
     }
-    msg->addOption(opt_serverid);
     copyIaOptions(reply, msg);
     return (msg);
 }
@@ -550,33 +797,39 @@ TestControl::generateMacAddress(uint8_t& randomized) {
       if (clients_num < 2) {
           return (options.getMacTemplate());
       }
-      // Get the base MAC address. We are going to randomize part of it.
-      std::vector<uint8_t> mac_addr(options.getMacTemplate());
-      if (mac_addr.size() != HW_ETHER_LEN) {
-          isc_throw(BadValue, "invalid MAC address template specified");
-      }
-      uint32_t r = macaddr_gen_->generate();
-      randomized = 0;
-      // Randomize MAC address octets.
-      for (std::vector<uint8_t>::iterator it = mac_addr.end() - 1;
-           it >= mac_addr.begin();
-           --it) {
-          // Add the random value to the current octet.
-          (*it) += r;
-          ++randomized;
-          if (r < 256) {
-              // If we are here it means that there is no sense
-              // to randomize the remaining octets of MAC address
-              // because the following bytes of random value
-              // are zero and it will have no effect.
-              break;
-          }
-          // Randomize the next octet with the following
-          // byte of random value.
-          r >>= 8;
-      }
-      return (mac_addr);
+      return (generateMacAddress(macaddr_gen_->generate(), randomized));
+    }
+}
+
+std::vector<uint8_t>
+TestControl::generateMacAddress(const uint32_t number,
+                                uint8_t& randomized) const {
+    // Get the base MAC address. We are going to randomize part of it.
+    std::vector<uint8_t> mac_addr(CommandOptions::instance().getMacTemplate());
+    if (mac_addr.size() != HW_ETHER_LEN) {
+        isc_throw(BadValue, "invalid MAC address template specified");
+    }
+    uint32_t r = number;
+    randomized = 0;
+    // Randomize MAC address octets.
+    for (std::vector<uint8_t>::iterator it = mac_addr.end() - 1;
+         it >= mac_addr.begin();
+         --it) {
+        // Add the random value to the current octet.
+        (*it) += r;
+        ++randomized;
+        if (r < 256) {
+            // If we are here it means that there is no sense
+            // to randomize the remaining octets of MAC address
+            // because the following bytes of random value
+            // are zero and it will have no effect.
+            break;
+        }
+        // Randomize the next octet with the following
+        // byte of random value.
+        r >>= 8;
     }
+    return (mac_addr);
 }
 
 OptionPtr
@@ -625,14 +878,50 @@ TestControl::generateDuid(uint8_t& randomized) {
       if ((clients_num == 0) || (clients_num == 1)) {
           return (options.getDuidTemplate());
       }
-      // Get the base DUID. We are going to randomize part of it.
-      std::vector<uint8_t> duid(options.getDuidTemplate());
-      // @todo: add support for DUIDs of different sizes.
-      duid.resize(duid.size());
-      std::copy(mac_addr.begin(), mac_addr.end(),
-                duid.begin() + duid.size() - mac_addr.size());
-      return (duid);
+      return (generateDuid(mac_addr));
+    }
+}
+
+std::vector<uint8_t>
+TestControl::generateDuid(const std::vector<uint8_t>& mac_addr) const {
+    // Get the base DUID. We are going to randomize part of it.
+    std::vector<uint8_t> duid(CommandOptions::instance().getDuidTemplate());
+    // @todo: add support for DUIDs of different sizes.
+    duid.resize(duid.size());
+    std::copy(mac_addr.begin(), mac_addr.end(),
+              duid.begin() + duid.size() - mac_addr.size());
+    return (duid);
+}
+
+bool
+TestControl::getClientNumber(const std::vector<uint8_t>& mac_addr,
+                             uint32_t& client) const {
+    if (!population_) {
+        return (false);
+    }
+    CommandOptions& options = CommandOptions::instance();
+    const std::vector<uint8_t>& mac_template = options.getMacTemplate();
+    if ((mac_addr.size() != HW_ETHER_LEN) ||
+        (mac_template.size() != HW_ETHER_LEN) ||
+        !std::equal(mac_addr.begin(), mac_addr.begin() + 2,
+                    mac_template.begin())) {
+        return (false);
+    }
+    // The octets of the client number have been added to the last four
+    // octets of the MAC address template.
+    uint32_t number = 0;
+    for (size_t i = 0; i < sizeof(number); ++i) {
+        const uint8_t octet = mac_addr[HW_ETHER_LEN - 1 - i] -
+            mac_template[HW_ETHER_LEN - 1 - i];
+        number |= static_cast<uint32_t>(octet) << (8 * i);
+    }
+    const uint64_t offset =
+        getWorkerOffset(std::max(options.getClientsNum(), 1U));
+    if ((number < offset) || (number - offset >= population_->size())) {
+        return (false);
     }
+    client = static_cast<uint32_t>(number - offset);
+    return (true);
 }
 
 uint32_t
@@ -758,6 +1047,28 @@ TestControl::getTransactionIdOffset(const int arg_idx) const {
     return (xid_offset);
 }
 
+uint64_t
+TestControl::getWorkerShare(const uint64_t total) const {
+    if (workers_num_ == 0) {
+        return (total);
+    }
+    uint64_t share = total / workers_num_;
+    if (worker_index_ < total % workers_num_) {
+        ++share;
+    }
+    return (share);
+}
+
+uint64_t
+TestControl::getWorkerOffset(const uint64_t total) const {
+    if (workers_num_ == 0) {
+        return (0);
+    }
+    return (worker_index_ * (total / workers_num_) +
+            std::min(static_cast<uint64_t>(worker_index_),
+                     total % workers_num_));
+}
+
 void
 TestControl::handleChild(int) {
     int status = 0;
@@ -803,6 +1114,19 @@ TestControl::initializeStatsMgr() {
         if (options.getRenewRate() != 0) {
             stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_RNA);
         }
+        if (options.getScenario() != CommandOptions::BASIC) {
+            stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_RNA,
+                                          options.getDropTime()[1]);
+            stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_RBA,
+                                          options.getDropTime()[1]);
+            // The server doesn't respond to DHCPRELEASE and DHCPDECLINE.
+            stats_mgr4_->addCustomCounter("release", "Leases released");
+            stats_mgr4_->addCustomCounter("decline", "Leases declined");
+        }
+        if (options.getScenario() == CommandOptions::AVALANCHE) {
+            stats_mgr4_->addExchangeStats(StatsMgr4::XCHG_IRA,
+                                          options.getDropTime()[1]);
+        }
 
     } else if (options.getIpVersion() == 6) {
         stats_mgr6_.reset();
@@ -819,6 +1143,29 @@ TestControl::initializeStatsMgr() {
         if (options.getReleaseRate() != 0) {
             stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RL);
         }
+        if (options.getScenario() != CommandOptions::BASIC) {
+            stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RN,
+                                          options.getDropTime()[1]);
+            stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RB,
+                                          options.getDropTime()[1]);
+            if (options.getReleasePercentage() > 0) {
+                stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_RL,
+                                              options.getDropTime()[1]);
+            }
+            if (options.getDeclinePercentage() > 0) {
+                stats_mgr6_->addExchangeStats(StatsMgr6::XCHG_DR,
+                                              options.getDropTime()[1]);
+            }
+        }
+    }
+    if (options.getScenario() != CommandOptions::BASIC) {
+        if (options.getIpVersion() == 4) {
+            stats_mgr4_->addCustomCounter("expire", "Leases expired");
+            stats_mgr4_->addCustomCounter("nak", "Leases refused");
+        } else if (options.getIpVersion() == 6) {
+            stats_mgr6_->addCustomCounter("expire", "Leases expired");
+            stats_mgr6_->addCustomCounter("nak", "Leases refused");
+        }
     }
     if (testDiags('i')) {
         if (options.getIpVersion() == 4) {
@@ -835,6 +1182,27 @@ TestControl::initializeStatsMgr() {
     }
 }
 
+void
+TestControl::mergeWorkerStats(const TestControl& worker) {
+    CommandOptions& options = CommandOptions::instance();
+    if (options.getIpVersion() == 4) {
+        if (worker.stats_mgr4_) {
+            stats_mgr4_->merge(*worker.stats_mgr4_);
+        }
+        template_packets_v4_.insert(worker.template_packets_v4_.begin(),
+                                    worker.template_packets_v4_.end());
+    } else if (options.getIpVersion() == 6) {
+        if (worker.stats_mgr6_) {
+            stats_mgr6_->merge(*worker.stats_mgr6_);
+        }
+        template_packets_v6_.insert(worker.template_packets_v6_.begin(),
+                                    worker.template_packets_v6_.end());
+    }
+    if (first_packet_serverid_.empty()) {
+        first_packet_serverid_ = worker.first_packet_serverid_;
+    }
+}
+
 int
 TestControl::openSocket() const {
     CommandOptions& options = CommandOptions::instance();
@@ -866,6 +1234,8 @@ TestControl::openSocket() const {
             port = 67; //  TODO: find out why port 68 is wrong here.
         }
     }
+    // Each worker thread uses its own port.
+    port += worker_index_;
 
     // Local name is specified along with '-l' option.
     // It may point to interface name or local address.
@@ -935,6 +1305,32 @@ TestControl::openSocket() const {
     return (sock);
 }
 
+void
+TestControl::sendPacket(const TestControlSocket& socket, const Pkt4Ptr& pkt) {
+    if (!packet_filter4_) {
+        IfaceMgr::instance().send(pkt);
+        return;
+    }
+    IfacePtr iface = IfaceMgr::instance().getIface(socket.ifindex_);
+    if (!iface) {
+        isc_throw(BadValue, "unable to find interface with given index");
+    }
+    packet_filter4_->send(*iface, socket.sockfd_, pkt);
+}
+
+void
+TestControl::sendPacket(const TestControlSocket& socket, const Pkt6Ptr& pkt) {
+    if (!packet_filter6_) {
+        IfaceMgr::instance().send(pkt);
+        return;
+    }
+    IfacePtr iface = IfaceMgr::instance().getIface(socket.ifindex_);
+    if (!iface) {
+        isc_throw(BadValue, "unable to find interface with given index");
+    }
+    packet_filter6_->send(*iface, socket.sockfd_, pkt);
+}
+
 void
 TestControl::sendPackets(const TestControlSocket& socket,
                          const uint64_t packets_num,
@@ -976,6 +1372,162 @@ TestControl::sendPackets(const TestControlSocket& socket,
     }
 }
 
+void
+TestControl::sendLifecycleMessages(const TestControlSocket& socket,
+                                   const uint64_t packets_num) {
+    CommandOptions& options = CommandOptions::instance();
+    const ptime now = microsec_clock::universal_time();
+
+    // Send the messages of the clients which timers have expired.
+    uint32_t client = 0;
+    while (population_->getNextExpired(now, client)) {
+        processClientTimer(socket, client);
+    }
+
+    // In the avalanche scenario all clients return at once, e.g. after
+    // the power outage, when the last of them has acquired the lease.
+    if ((options.getScenario() == CommandOptions::AVALANCHE) &&
+        !avalanche_started_ &&
+        (population_->getStateCount(ClientPopulation::BOUND) ==
+         population_->size())) {
+        if (testDiags('e')) {
+            std::cout << "all clients bound, starting avalanche." << std::endl;
+        }
+        avalanche_started_ = true;
+        for (client = 0; client < population_->size(); ++client) {
+            sendLeaseMessage(socket, client, LEASE_REBOOT);
+            population_->setState(client, ClientPopulation::REBOOTING,
+                                  addSeconds(now, options.getDropTime()[1]));
+        }
+    }
+
+    // Initiate the new exchanges for the clients without leases.
+    for (uint64_t i = 0; (i < packets_num) && population_->getNextIdle(client);
+         ++i) {
+        sendClientDiscover(socket, client);
+    }
+}
+
+void
+TestControl::sendClientDiscover(const TestControlSocket& socket,
+                                const uint32_t client) {
+    CommandOptions& options = CommandOptions::instance();
+    basic_rate_control_.updateSendTime();
+    uint8_t randomized = 0;
+    const uint64_t offset =
+        getWorkerOffset(std::max(options.getClientsNum(), 1U));
+    std::vector<uint8_t> mac_address =
+        generateMacAddress(static_cast<uint32_t>(offset + client), randomized);
+    if (options.getIpVersion() == 4) {
+        Pkt4Ptr pkt4 = createDiscover4(mac_address);
+        setDefaults4(socket, pkt4);
+        addExtraOpts(pkt4);
+        pkt4->pack();
+        sendPacket(socket, pkt4);
+        stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO, pkt4);
+        saveFirstPacket(pkt4);
+    } else {
+        Pkt6Ptr pkt6 = createSolicit6(generateDuid(mac_address));
+        setDefaults6(socket, pkt6);
+        addExtraOpts(pkt6);
+        pkt6->pack();
+        sendPacket(socket, pkt6);
+        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6);
+        saveFirstPacket(pkt6);
+    }
+    population_->setState(client, ClientPopulation::SELECTING,
+                          addSeconds(microsec_clock::universal_time(),
+                                     options.getDropTime()[0]));
+}
+
+void
+TestControl::sendLeaseMessage(const TestControlSocket& socket,
+                              const uint32_t client,
+                              const LeaseMessage message) {
+    if (CommandOptions::instance().getIpVersion() == 4) {
+        Pkt4Ptr ack =
+            boost::dynamic_pointer_cast<Pkt4>(population_->getLease(client));
+        if (!ack) {
+            isc_throw(Unexpected, "client " << client << " has no lease");
+        }
+        Pkt4Ptr msg;
+        switch (message) {
+        case LEASE_RELEASE:
+            msg = createMessageFromAck(DHCPRELEASE, ack);
+            break;
+        case LEASE_DECLINE:
+            msg = createMessageFromAck(DHCPDECLINE, ack);
+            break;
+        default:
+            msg = createMessageFromAck(DHCPREQUEST, ack);
+        }
+        if (message == LEASE_REBOOT) {
+            // The client in the INIT-REBOOT state requests the address
+            // with the Requested IP Address option and leaves the ciaddr
+            // zero (RFC 2131, section 4.3.2).
+            msg->setCiaddr(IOAddress::IPV4_ZERO_ADDRESS());
+            OptionPtr opt_requested_address =
+                OptionPtr(new Option(Option::V4, DHO_DHCP_REQUESTED_ADDRESS,
+                                     OptionBuffer()));
+            opt_requested_address->setUint32(ack->getYiaddr().toUint32());
+            msg->addOption(opt_requested_address);
+        }
+        setDefaults4(socket, msg);
+        addExtraOpts(msg);
+        msg->pack();
+        sendPacket(socket, msg);
+        switch (message) {
+        case LEASE_RENEW:
+            stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RNA, msg);
+            break;
+        case LEASE_REBIND:
+            stats_mgr4_->passSentPacket(StatsMgr4::XCHG_RBA, msg);
+            break;
+        case LEASE_REBOOT:
+            stats_mgr4_->passSentPacket(StatsMgr4::XCHG_IRA, msg);
+            break;
+        case LEASE_RELEASE:
+            stats_mgr4_->incrementCounter("release");
+            break;
+        case LEASE_DECLINE:
+            stats_mgr4_->incrementCounter("decline");
+        }
+
+    } else {
+        Pkt6Ptr reply =
+            boost::dynamic_pointer_cast<Pkt6>(population_->getLease(client));
+        if (!reply) {
+            isc_throw(Unexpected, "client " << client << " has no lease");
+        }
+        // The client returning after the outage sends Rebind to confirm
+        // its leases (RFC 8415, section 18.2.12).
+        uint16_t msg_type = DHCPV6_REBIND;
+        StatsMgr6::ExchangeType xchg_type = StatsMgr6::XCHG_RB;
+        switch (message) {
+        case LEASE_RENEW:
+            msg_type = DHCPV6_RENEW;
+            xchg_type = StatsMgr6::XCHG_RN;
+            break;
+        case LEASE_RELEASE:
+            msg_type = DHCPV6_RELEASE;
+            xchg_type = StatsMgr6::XCHG_RL;
+            break;
+        case LEASE_DECLINE:
+            msg_type = DHCPV6_DECLINE;
+            xchg_type = StatsMgr6::XCHG_DR;
+            break;
+        default:
+            ;
+        }
+        Pkt6Ptr msg = createMessageFromReply(msg_type, reply);
+        setDefaults6(socket, msg);
+        addExtraOpts(msg);
+        msg->pack();
+        sendPacket(socket, msg);
+        stats_mgr6_->passSentPacket(xchg_type, msg);
+    }
+}
+
 uint64_t
 TestControl::sendMultipleRequests(const TestControlSocket& socket,
                                   const uint64_t msg_num) {
@@ -1128,39 +1680,163 @@ TestControl::printIntermediateStats() {
     time_period time_since_report(last_report_, now);
     if (time_since_report.length().total_seconds() >= delay) {
         if (options.getIpVersion() == 4) {
-            stats_mgr4_->printIntermediateStats();
+            printIntermediateReport(*stats_mgr4_, reported_stats4_);
+            stats_mgr4_->startInterval();
         } else if (options.getIpVersion() == 6) {
-            stats_mgr6_->printIntermediateStats();
+            printIntermediateReport(*stats_mgr6_, reported_stats6_);
+            stats_mgr6_->startInterval();
+        }
+        last_report_ = now;
+    }
+}
+
+template<typename T>
+void
+TestControl::printIntermediateReport(const StatsMgr<T>& stats,
+                                     boost::shared_ptr<StatsMgr<T> >& reported) {
+    StatsMgr<T> interval;
+    interval.merge(stats);
+    if (reported) {
+        interval.subtract(*reported);
+    }
+    switch (CommandOptions::instance().getOutputFormat()) {
+    case CommandOptions::JSON_OUTPUT:
+        interval.printStatsJSON("interval", getElapsedTime());
+        break;
+    case CommandOptions::CSV_OUTPUT:
+        interval.printStatsCSV("interval", getElapsedTime());
+        break;
+    default:
+        stats.printIntermediateStats(interval);
+    }
+    reported.reset(new StatsMgr<T>());
+    reported->merge(stats);
+}
+
+void
+TestControl::printWorkersIntermediateStats(const std::vector<TestControlPtr>& workers) {
+    CommandOptions& options = CommandOptions::instance();
+    ptime now = microsec_clock::universal_time();
+    time_period time_since_report(last_report_, now);
+    if (time_since_report.length().total_seconds() < options.getReportDelay()) {
+        return;
+    }
+
+    // The published statistics are never modified, so it is enough to
+    // hold the lock while the pointers are copied. The statistics which
+    // were already reported hold no delays for this interval.
+    bool published = false;
+    if (options.getIpVersion() == 4) {
+        StatsMgr4 stats;
+        BOOST_FOREACH(TestControlPtr worker, workers) {
+            StatsMgr4Ptr worker_stats;
+            bool reported = false;
+            {
+                Mutex::Locker lock(worker->worker_mutex_);
+                worker_stats = worker->published_stats4_;
+                reported = worker->published_stats_reported_;
+                worker->published_stats_reported_ = true;
+            }
+            if (worker_stats) {
+                StatsMgr4 copy;
+                copy.merge(*worker_stats);
+                if (reported) {
+                    copy.startInterval();
+                }
+                stats.merge(copy);
+                published = true;
+            }
+        }
+        if (published) {
+            printIntermediateReport(stats, reported_stats4_);
         }
+    } else if (options.getIpVersion() == 6) {
+        StatsMgr6 stats;
+        BOOST_FOREACH(TestControlPtr worker, workers) {
+            StatsMgr6Ptr worker_stats;
+            bool reported = false;
+            {
+                Mutex::Locker lock(worker->worker_mutex_);
+                worker_stats = worker->published_stats6_;
+                reported = worker->published_stats_reported_;
+                worker->published_stats_reported_ = true;
+            }
+            if (worker_stats) {
+                StatsMgr6 copy;
+                copy.merge(*worker_stats);
+                if (reported) {
+                    copy.startInterval();
+                }
+                stats.merge(copy);
+                published = true;
+            }
+        }
+        if (published) {
+            printIntermediateReport(stats, reported_stats6_);
+        }
+    }
+    if (published) {
         last_report_ = now;
     }
 }
 
 void
 TestControl::printStats() const {
-    printRate();
     CommandOptions& options = CommandOptions::instance();
     if (options.getIpVersion() == 4) {
         if (!stats_mgr4_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                       "hasn't been initialized");
         }
-        stats_mgr4_->printStats();
-        if (testDiags('i')) {
-            stats_mgr4_->printCustomCounters();
+        switch (options.getOutputFormat()) {
+        case CommandOptions::JSON_OUTPUT:
+            stats_mgr4_->printStatsJSON("summary", getElapsedTime(), true);
+            break;
+        case CommandOptions::CSV_OUTPUT:
+            stats_mgr4_->printStatsCSV("summary", getElapsedTime());
+            break;
+        default:
+            printRate();
+            stats_mgr4_->printStats();
+            if (testDiags('i')) {
+                stats_mgr4_->printCustomCounters();
+            }
         }
     } else if (options.getIpVersion() == 6) {
         if (!stats_mgr6_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                       "hasn't been initialized");
         }
-        stats_mgr6_->printStats();
-        if (testDiags('i')) {
-            stats_mgr6_->printCustomCounters();
+        switch (options.getOutputFormat()) {
+        case CommandOptions::JSON_OUTPUT:
+            stats_mgr6_->printStatsJSON("summary", getElapsedTime(), true);
+            break;
+        case CommandOptions::CSV_OUTPUT:
+            stats_mgr6_->printStatsCSV("summary", getElapsedTime());
+            break;
+        default:
+            printRate();
+            stats_mgr6_->printStats();
+            if (testDiags('i')) {
+                stats_mgr6_->printCustomCounters();
+            }
         }
     }
 }
 
+double
+TestControl::getElapsedTime() const {
+    CommandOptions& options = CommandOptions::instance();
+    if ((options.getIpVersion() == 4) && stats_mgr4_) {
+        return (stats_mgr4_->getTestPeriod().length().total_nanoseconds() /
+                1e9);
+    } else if ((options.getIpVersion() == 6) && stats_mgr6_) {
+        return (stats_mgr6_->getTestPeriod().length().total_nanoseconds() /
+                1e9);
+    }
+    isc_throw(InvalidOperation, "Statistics Manager hasn't been initialized");
+}
+
 std::string
 TestControl::vector2Hex(const std::vector<uint8_t>& vec,
                         const std::string& separator /* ="" */) const {
@@ -1226,19 +1902,209 @@ TestControl::readPacketTemplate(const std::string& file_name) {
 }
 
 void
-TestControl::processReceivedPacket4(const TestControlSocket& socket,
-                            const Pkt4Ptr& pkt4) {
-    if (pkt4->getType() == DHCPOFFER) {
-        Pkt4Ptr discover_pkt4(stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_DO,
-                                                          pkt4));
-        CommandOptions::ExchangeMode xchg_mode =
-            CommandOptions::instance().getExchangeMode();
-        if ((xchg_mode == CommandOptions::DORA_SARR) && discover_pkt4) {
-            if (template_buffers_.size() < 2) {
-                sendRequest4(socket, discover_pkt4, pkt4);
-            } else {
-                // @todo add defines for packet type index that can be
-                // used to access template_buffers_.
+TestControl::processClientTimer(const TestControlSocket& socket,
+                                const uint32_t client) {
+    CommandOptions& options = CommandOptions::instance();
+    switch (population_->getState(client)) {
+    case ClientPopulation::BOUND:
+    {
+        // The client releases the lease, renews it or, as if the server
+        // was unreachable, waits for the rebinding time.
+        const int choice = rand() % 100;
+        if (choice < options.getReleasePercentage()) {
+            sendLeaseMessage(socket, client, LEASE_RELEASE);
+            population_->setState(client, ClientPopulation::INIT);
+            break;
+        }
+        if (choice >= options.getReleasePercentage() +
+            options.getRebindPercentage()) {
+            sendLeaseMessage(socket, client, LEASE_RENEW);
+        }
+        population_->setState(client, ClientPopulation::RENEWING,
+                              population_->getRebindTime(client));
+        break;
+    }
+    case ClientPopulation::RENEWING:
+        sendLeaseMessage(socket, client, LEASE_REBIND);
+        population_->setState(client, ClientPopulation::REBINDING,
+                              population_->getExpireTime(client));
+        break;
+    case ClientPopulation::REBINDING:
+        // The lease has expired.
+        if (options.getIpVersion() == 4) {
+            stats_mgr4_->incrementCounter("expire");
+        } else if (options.getIpVersion() == 6) {
+            stats_mgr6_->incrementCounter("expire");
+        }
+        population_->setState(client, ClientPopulation::INIT);
+        break;
+    default:
+        // The server hasn't responded, so the client starts over.
+        population_->setState(client, ClientPopulation::INIT);
+    }
+}
+
+void
+TestControl::processLifecyclePacket4(const TestControlSocket& socket,
+                                     const Pkt4Ptr& pkt4) {
+    CommandOptions& options = CommandOptions::instance();
+    uint32_t client = 0;
+    HWAddrPtr hwaddr = pkt4->getHWAddr();
+    if (!hwaddr || !getClientNumber(hwaddr->hwaddr_, client)) {
+        return;
+    }
+    const ClientPopulation::State state = population_->getState(client);
+    if (pkt4->getType() == DHCPOFFER) {
+        if (state != ClientPopulation::SELECTING) {
+            return;
+        }
+        Pkt4Ptr discover_pkt4(stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_DO,
+                                                          pkt4));
+        if (discover_pkt4) {
+            sendRequest4(socket, discover_pkt4, pkt4);
+            population_->setState(client, ClientPopulation::REQUESTING,
+                                  addSeconds(microsec_clock::universal_time(),
+                                             options.getDropTime()[1]));
+        }
+        return;
+    }
+    if ((pkt4->getType() != DHCPACK) && (pkt4->getType() != DHCPNAK)) {
+        return;
+    }
+
+    // Match the response with the request sent in the current state.
+    StatsMgr4::ExchangeType xchg_type;
+    switch (state) {
+    case ClientPopulation::REQUESTING:
+        xchg_type = StatsMgr4::XCHG_RA;
+        break;
+    case ClientPopulation::RENEWING:
+        xchg_type = StatsMgr4::XCHG_RNA;
+        break;
+    case ClientPopulation::REBINDING:
+        xchg_type = StatsMgr4::XCHG_RBA;
+        break;
+    case ClientPopulation::REBOOTING:
+        xchg_type = StatsMgr4::XCHG_IRA;
+        break;
+    default:
+        return;
+    }
+    if (!stats_mgr4_->passRcvdPacket(xchg_type, pkt4)) {
+        return;
+    }
+
+    if ((pkt4->getType() == DHCPACK) && bindClient(client, pkt4)) {
+        // Some clients find out that the new address is in use.
+        if ((state == ClientPopulation::REQUESTING) &&
+            (rand() % 100 < options.getDeclinePercentage())) {
+            sendLeaseMessage(socket, client, LEASE_DECLINE);
+            population_->setState(client, ClientPopulation::INIT);
+        }
+    } else {
+        stats_mgr4_->incrementCounter("nak");
+        population_->setState(client, ClientPopulation::INIT);
+    }
+}
+
+void
+TestControl::processLifecyclePacket6(const TestControlSocket& socket,
+                                     const Pkt6Ptr& pkt6) {
+    CommandOptions& options = CommandOptions::instance();
+    // The last octets of the DUID hold the client's MAC address.
+    uint32_t client = 0;
+    OptionPtr opt_clientid = pkt6->getOption(D6O_CLIENTID);
+    if (!opt_clientid) {
+        return;
+    }
+    const OptionBuffer& duid = opt_clientid->getData();
+    if ((duid.size() < HW_ETHER_LEN) ||
+        !getClientNumber(std::vector<uint8_t>(duid.end() - HW_ETHER_LEN,
+                                              duid.end()), client)) {
+        return;
+    }
+    const ClientPopulation::State state = population_->getState(client);
+    if (pkt6->getType() == DHCPV6_ADVERTISE) {
+        if (state != ClientPopulation::SELECTING) {
+            return;
+        }
+        if (stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_SA, pkt6)) {
+            sendRequest6(socket, pkt6);
+            population_->setState(client, ClientPopulation::REQUESTING,
+                                  addSeconds(microsec_clock::universal_time(),
+                                             options.getDropTime()[1]));
+        }
+        return;
+    }
+    if (pkt6->getType() != DHCPV6_REPLY) {
+        return;
+    }
+
+    // Match the Reply with the message sent in the current state.
+    StatsMgr6::ExchangeType xchg_type;
+    switch (state) {
+    case ClientPopulation::INIT:
+        // The client which has released or declined its lease doesn't
+        // wait for the Reply.
+        if (!(stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_RL) &&
+              stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_RL, pkt6)) &&
+            stats_mgr6_->hasExchangeStats(StatsMgr6::XCHG_DR)) {
+            stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_DR, pkt6);
+        }
+        return;
+    case ClientPopulation::SELECTING:
+        // Rapid commit.
+        xchg_type = StatsMgr6::XCHG_SA;
+        break;
+    case ClientPopulation::REQUESTING:
+        xchg_type = StatsMgr6::XCHG_RR;
+        break;
+    case ClientPopulation::RENEWING:
+        xchg_type = StatsMgr6::XCHG_RN;
+        break;
+    case ClientPopulation::REBINDING:
+    case ClientPopulation::REBOOTING:
+        xchg_type = StatsMgr6::XCHG_RB;
+        break;
+    default:
+        return;
+    }
+    if (!stats_mgr6_->passRcvdPacket(xchg_type, pkt6)) {
+        return;
+    }
+
+    if (bindClient(client, pkt6)) {
+        // Some clients find out that the new address is in use.
+        if (((state == ClientPopulation::SELECTING) ||
+             (state == ClientPopulation::REQUESTING)) &&
+            (rand() % 100 < options.getDeclinePercentage())) {
+            sendLeaseMessage(socket, client, LEASE_DECLINE);
+            population_->setState(client, ClientPopulation::INIT);
+        }
+    } else {
+        stats_mgr6_->incrementCounter("nak");
+        population_->setState(client, ClientPopulation::INIT);
+    }
+}
+
+void
+TestControl::processReceivedPacket4(const TestControlSocket& socket,
+                            const Pkt4Ptr& pkt4) {
+    if (population_) {
+        processLifecyclePacket4(socket, pkt4);
+        return;
+    }
+    if (pkt4->getType() == DHCPOFFER) {
+        Pkt4Ptr discover_pkt4(stats_mgr4_->passRcvdPacket(StatsMgr4::XCHG_DO,
+                                                          pkt4));
+        CommandOptions::ExchangeMode xchg_mode =
+            CommandOptions::instance().getExchangeMode();
+        if ((xchg_mode == CommandOptions::DORA_SARR) && discover_pkt4) {
+            if (template_buffers_.size() < 2) {
+                sendRequest4(socket, discover_pkt4, pkt4);
+            } else {
+                // @todo add defines for packet type index that can be
+                // used to access template_buffers_.
                 sendRequest4(socket, template_buffers_[1], discover_pkt4, pkt4);
             }
         }
@@ -1271,6 +2137,10 @@ TestControl::processReceivedPacket4(const TestControlSocket& socket,
 void
 TestControl::processReceivedPacket6(const TestControlSocket& socket,
                             const Pkt6Ptr& pkt6) {
+    if (population_) {
+        processLifecyclePacket6(socket, pkt6);
+        return;
+    }
     uint8_t packet_type = pkt6->getType();
     if (packet_type == DHCPV6_ADVERTISE) {
         Pkt6Ptr solicit_pkt6(stats_mgr6_->passRcvdPacket(StatsMgr6::XCHG_SA,
@@ -1324,6 +2194,68 @@ TestControl::processReceivedPacket6(const TestControlSocket& socket,
     }
 }
 
+void
+TestControl::publishIntermediateStats() {
+    ptime now = microsec_clock::universal_time();
+    time_period time_since_publish(last_report_, now);
+    if (time_since_publish.length().total_milliseconds() <
+        STATS_PUBLISH_INTERVAL) {
+        return;
+    }
+    // The delays recorded since the previous publication are added to
+    // the ones of the previous statistics unless they have been reported.
+    if (CommandOptions::instance().getIpVersion() == 4) {
+        StatsMgr4Ptr stats(new StatsMgr4());
+        stats->merge(*stats_mgr4_);
+        stats_mgr4_->startInterval();
+        Mutex::Locker lock(worker_mutex_);
+        if (published_stats4_ && !published_stats_reported_) {
+            stats->mergeIntervalDelays(*published_stats4_);
+        }
+        published_stats4_ = stats;
+        published_stats_reported_ = false;
+    } else if (CommandOptions::instance().getIpVersion() == 6) {
+        StatsMgr6Ptr stats(new StatsMgr6());
+        stats->merge(*stats_mgr6_);
+        stats_mgr6_->startInterval();
+        Mutex::Locker lock(worker_mutex_);
+        if (published_stats6_ && !published_stats_reported_) {
+            stats->mergeIntervalDelays(*published_stats6_);
+        }
+        published_stats6_ = stats;
+        published_stats_reported_ = false;
+    }
+    last_report_ = now;
+}
+
+Pkt4Ptr
+TestControl::receivePacket4(const TestControlSocket& socket,
+                            const uint32_t timeout) {
+    if (!packet_filter4_) {
+        return (IfaceMgr::instance().receive4(0, timeout));
+    }
+    if (!waitForPacket(socket.sockfd_, timeout)) {
+        return (Pkt4Ptr());
+    }
+    IfacePtr iface = IfaceMgr::instance().getIface(socket.ifindex_);
+    if (!iface) {
+        isc_throw(BadValue, "unable to find interface with given index");
+    }
+    return (packet_filter4_->receive(*iface, socket));
+}
+
+Pkt6Ptr
+TestControl::receivePacket6(const TestControlSocket& socket,
+                            const uint32_t timeout) {
+    if (!packet_filter6_) {
+        return (IfaceMgr::instance().receive6(0, timeout));
+    }
+    if (!waitForPacket(socket.sockfd_, timeout)) {
+        return (Pkt6Ptr());
+    }
+    return (packet_filter6_->receive(socket));
+}
+
 uint64_t
 TestControl::receivePackets(const TestControlSocket& socket) {
     bool receiving = true;
@@ -1332,7 +2264,7 @@ TestControl::receivePackets(const TestControlSocket& socket) {
         if (CommandOptions::instance().getIpVersion() == 4) {
             Pkt4Ptr pkt4;
             try {
-                pkt4 = IfaceMgr::instance().receive4(0, getCurrentTimeout());
+                pkt4 = receivePacket4(socket, getCurrentTimeout());
             } catch (const Exception& e) {
                 std::cerr << "Failed to receive DHCPv4 packet: "
                           << e.what() <<  std::endl;
@@ -1353,7 +2285,7 @@ TestControl::receivePackets(const TestControlSocket& socket) {
         } else if (CommandOptions::instance().getIpVersion() == 6) {
             Pkt6Ptr pkt6;
             try {
-                pkt6 = IfaceMgr::instance().receive6(0, getCurrentTimeout());
+                pkt6 = receivePacket6(socket, getCurrentTimeout());
             } catch (const Exception& e) {
                 std::cerr << "Failed to receive DHCPv6 packet: "
                           << e.what() << std::endl;
@@ -1455,11 +2387,11 @@ void
 TestControl::reset() {
     CommandOptions& options = CommandOptions::instance();
     basic_rate_control_.setAggressivity(options.getAggressivity());
-    basic_rate_control_.setRate(options.getRate());
+    basic_rate_control_.setRate(getWorkerShare(options.getRate()));
     renew_rate_control_.setAggressivity(options.getAggressivity());
-    renew_rate_control_.setRate(options.getRenewRate());
+    renew_rate_control_.setRate(getWorkerShare(options.getRenewRate()));
     release_rate_control_.setAggressivity(options.getAggressivity());
-    release_rate_control_.setRate(options.getReleaseRate());
+    release_rate_control_.setRate(getWorkerShare(options.getReleaseRate()));
 
     transid_gen_.reset();
     last_report_ = microsec_clock::universal_time();
@@ -1468,6 +2400,11 @@ TestControl::reset() {
     setTransidGenerator(NumberGeneratorPtr());
     setMacAddrGenerator(NumberGeneratorPtr());
     first_packet_serverid_.clear();
+    exit_time_ = ptime(not_a_date_time);
+    population_.reset();
+    avalanche_started_ = false;
+    reported_stats4_.reset();
+    reported_stats6_.reset();
     interrupted_ = false;
 }
 
@@ -1498,10 +2435,6 @@ TestControl::run() {
     printDiagnostics();
     // Option factories have to be registered.
     registerOptionFactories();
-    TestControlSocket socket(openSocket());
-    if (!socket.valid_) {
-        isc_throw(Unexpected, "invalid socket descriptor");
-    }
     // Initialize packet templates.
     initPacketTemplates();
     // Initialize randomization seed.
@@ -1517,16 +2450,83 @@ TestControl::run() {
     // If user interrupts the program we will exit gracefully.
     signal(SIGINT, TestControl::handleInterrupt);
 
-    // Preload server with the number of packets.
-    sendPackets(socket, options.getPreload(), true);
+    // The CSV header precedes the intermediate and final reports.
+    if (options.getOutputFormat() == CommandOptions::CSV_OUTPUT) {
+        StatsMgr4::printCSVHeader();
+    }
+
+    if (options.getThreadsNum() > 1) {
+        // The workers open their sockets and run the main loop. Their
+        // statistics are merged when all of them finish.
+        runThreads();
+
+    } else {
+        TestControlSocket socket(openSocket());
+        if (!socket.valid_) {
+            isc_throw(Unexpected, "invalid socket descriptor");
+        }
+
+        // Preload server with the number of packets.
+        sendPackets(socket, options.getPreload(), true);
+
+        // Fork and run command specified with -w<wrapped-command>
+        if (!options.getWrapped().empty()) {
+            runWrapped();
+        }
+
+        // Initialize Statistics Manager. Release previous if any.
+        initializeStatsMgr();
+        runLoop(socket);
+    }
+    printStats();
 
-    // Fork and run command specified with -w<wrapped-command>
     if (!options.getWrapped().empty()) {
-        runWrapped();
+        // true means that we execute wrapped command with 'stop' argument.
+        runWrapped(true);
     }
 
-    // Initialize Statistics Manager. Release previous if any.
-    initializeStatsMgr();
+    // Print packet timestamps
+    if (testDiags('t')) {
+        if (options.getIpVersion() == 4) {
+            stats_mgr4_->printTimestamps();
+        } else if (options.getIpVersion() == 6) {
+            stats_mgr6_->printTimestamps();
+        }
+    }
+
+    // Print server id.
+    if (testDiags('s') && (first_packet_serverid_.size() > 0)) {
+        std::cout << "Server id: " << vector2Hex(first_packet_serverid_) << std::endl;
+    }
+
+    // Diagnostics flag 'e' means show exit reason.
+    if (testDiags('e')) {
+        std::cout << "Interrupted" << std::endl;
+    }
+    // Print packet templates. Even if -T options have not been specified the
+    // dynamically build packet will be printed if at least one has been sent.
+    if (testDiags('T')) {
+        printTemplates();
+    }
+
+    int ret_code = 0;
+    // Check if any packet drops occurred.
+    if (options.getIpVersion() == 4) {
+        ret_code = stats_mgr4_->droppedPackets() ? 3 : 0;
+    } else if (options.getIpVersion() == 6)  {
+        ret_code = stats_mgr6_->droppedPackets() ? 3 : 0;
+    }
+    return (ret_code);
+}
+
+void
+TestControl::runLoop(const TestControlSocket& socket) {
+    CommandOptions& options = CommandOptions::instance();
+    // Each worker simulates its own range of clients.
+    if (options.getScenario() != CommandOptions::BASIC) {
+        population_.reset(new ClientPopulation(
+            getWorkerShare(std::max(options.getClientsNum(), 1U))));
+    }
     for (;;) {
         // Calculate number of packets to be sent to stay
         // catch up with rate.
@@ -1553,7 +2553,11 @@ TestControl::run() {
 
         if (!hasLateExitCommenced()) {
             // Initiate new DHCP packet exchanges.
-            sendPackets(socket, packets_due);
+            if (population_) {
+                sendLifecycleMessages(socket, packets_due);
+            } else {
+                sendPackets(socket, packets_due);
+            }
         }
 
         // If -f<renew-rate> option was specified we have to check how many
@@ -1584,7 +2588,11 @@ TestControl::run() {
         // Report delay means that user requested printing number
         // of sent/received/dropped packets repeatedly.
         if (options.getReportDelay() > 0) {
-            printIntermediateStats();
+            if (workers_num_ > 0) {
+                publishIntermediateStats();
+            } else {
+                printIntermediateStats();
+            }
         }
 
         // If we are sending Renews to the server, the Reply packets are cached
@@ -1595,45 +2603,109 @@ TestControl::run() {
         // searches in the long list of Reply packets increases CPU utilization.
         cleanCachedPackets();
     }
-    printStats();
+}
+
+void
+TestControl::runThreads() {
+    CommandOptions& options = CommandOptions::instance();
+    const unsigned int threads_num = options.getThreadsNum();
 
+    // The sockets are opened before any thread is started because opening
+    // a socket modifies the interfaces held by the IfaceMgr.
+    std::vector<TestControlPtr> workers;
+    std::vector<TestControlSocketPtr> sockets;
+    for (unsigned int i = 0; i < threads_num; ++i) {
+        TestControlPtr worker(new TestControl(i, threads_num));
+        TestControlSocketPtr socket(new TestControlSocket(worker->openSocket()));
+        if (!socket->valid_) {
+            isc_throw(Unexpected, "invalid socket descriptor");
+        }
+        workers.push_back(worker);
+        sockets.push_back(socket);
+    }
+
+    // Fork and run command specified with -w<wrapped-command>
     if (!options.getWrapped().empty()) {
-        // true means that we execute wrapped command with 'stop' argument.
-        runWrapped(true);
+        runWrapped();
     }
 
-    // Print packet timestamps
-    if (testDiags('t')) {
-        if (options.getIpVersion() == 4) {
-            stats_mgr4_->printTimestamps();
-        } else if (options.getIpVersion() == 6) {
-            stats_mgr6_->printTimestamps();
+    // The statistics of the workers are merged into this Statistics
+    // Manager, so the test period is measured from this point.
+    initializeStatsMgr();
+
+    std::vector<boost::shared_ptr<Thread> > threads;
+    try {
+        for (unsigned int i = 0; i < threads_num; ++i) {
+            workers[i]->worker_running_ = true;
+            threads.push_back(boost::shared_ptr<Thread>
+                (new Thread(boost::bind(&TestControl::runWorker, workers[i],
+                                        boost::cref(*sockets[i])))));
+        }
+    } catch (...) {
+        // The sockets must not be closed while the workers use them.
+        interrupted_ = true;
+        BOOST_FOREACH(boost::shared_ptr<Thread> thread, threads) {
+            thread->wait();
         }
+        throw;
     }
 
-    // Print server id.
-    if (testDiags('s') && (first_packet_serverid_.size() > 0)) {
-        std::cout << "Server id: " << vector2Hex(first_packet_serverid_) << std::endl;
+    // Report delay means that user requested printing number
+    // of sent/received/dropped packets repeatedly.
+    if (options.getReportDelay() > 0) {
+        while (workersRunning(workers)) {
+            usleep(WORKERS_POLL_INTERVAL);
+            printWorkersIntermediateStats(workers);
+        }
     }
 
-    // Diagnostics flag 'e' means show exit reason.
-    if (testDiags('e')) {
-        std::cout << "Interrupted" << std::endl;
+    BOOST_FOREACH(boost::shared_ptr<Thread> thread, threads) {
+        thread->wait();
     }
-    // Print packet templates. Even if -T options have not been specified the
-    // dynamically build packet will be printed if at least one has been sent.
-    if (testDiags('T')) {
-        printTemplates();
+
+    std::string error;
+    BOOST_FOREACH(TestControlPtr worker, workers) {
+        mergeWorkerStats(*worker);
+        if (error.empty()) {
+            error = worker->worker_error_;
+        }
+    }
+    if (!error.empty()) {
+        isc_throw(Unexpected, "worker thread failed: " << error);
     }
+}
 
-    int ret_code = 0;
-    // Check if any packet drops occurred.
-    if (options.getIpVersion() == 4) {
-        ret_code = stats_mgr4_->droppedPackets() ? 3 : 0;
-    } else if (options.getIpVersion() == 6)  {
-        ret_code = stats_mgr6_->droppedPackets() ? 3 : 0;
+void
+TestControl::runWorker(const TestControlSocket& socket) {
+    try {
+        // Preload server with the share of packets of this worker.
+        sendPackets(socket,
+                    getWorkerShare(CommandOptions::instance().getPreload()),
+                    true);
+        initializeStatsMgr();
+        runLoop(socket);
+
+    } catch (const std::exception& ex) {
+        {
+            Mutex::Locker lock(worker_mutex_);
+            worker_error_ = ex.what();
+        }
+        // There is no point to continue the test with the other workers.
+        interrupted_ = true;
     }
-    return (ret_code);
+    Mutex::Locker lock(worker_mutex_);
+    worker_running_ = false;
+}
+
+bool
+TestControl::workersRunning(const std::vector<TestControlPtr>& workers) {
+    BOOST_FOREACH(TestControlPtr worker, workers) {
+        Mutex::Locker lock(worker->worker_mutex_);
+        if (worker->worker_running_) {
+            return (true);
+        }
+    }
+    return (false);
 }
 
 void
@@ -1678,6 +2750,29 @@ TestControl::sendDiscover4(const TestControlSocket& socket,
     // Generate the MAC address to be passed in the packet.
     uint8_t randomized = 0;
     std::vector<uint8_t> mac_address = generateMacAddress(randomized);
+    Pkt4Ptr pkt4 = createDiscover4(mac_address);
+
+    // Set client's and server's ports as well as server's address,
+    // and local (relay) address.
+    setDefaults4(socket, pkt4);
+
+    // Add any extra options that user may have specified.
+    addExtraOpts(pkt4);
+
+    pkt4->pack();
+    sendPacket(socket, pkt4);
+    if (!preload) {
+        if (!stats_mgr4_) {
+            isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
+                      "hasn't been initialized");
+        }
+        stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO, pkt4);
+    }
+    saveFirstPacket(pkt4);
+}
+
+Pkt4Ptr
+TestControl::createDiscover4(const std::vector<uint8_t>& mac_address) {
     // Generate transaction id to be set for the new exchange.
     const uint32_t transid = generateTransid();
     Pkt4Ptr pkt4(new Pkt4(DHCPDISCOVER, transid));
@@ -1696,29 +2791,12 @@ TestControl::sendDiscover4(const TestControlSocket& socket,
     pkt4->addOption(Option::factory(Option::V4,
                                     DHO_DHCP_PARAMETER_REQUEST_LIST));
 
-    // Set client's and server's ports as well as server's address,
-    // and local (relay) address.
-    setDefaults4(socket, pkt4);
-
     // Set hardware address
     pkt4->setHWAddr(HTYPE_ETHER, mac_address.size(), mac_address);
 
     // Set client identifier
     pkt4->addOption(generateClientId(pkt4->getHWAddr()));
-
-    // Add any extra options that user may have specified.
-    addExtraOpts(pkt4);
-
-    pkt4->pack();
-    IfaceMgr::instance().send(pkt4);
-    if (!preload) {
-        if (!stats_mgr4_) {
-            isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
-                      "hasn't been initialized");
-        }
-        stats_mgr4_->passSentPacket(StatsMgr4::XCHG_DO, pkt4);
-    }
-    saveFirstPacket(pkt4);
+    return (pkt4);
 }
 
 void
@@ -1760,7 +2838,7 @@ TestControl::sendDiscover4(const TestControlSocket& socket,
     // Pack the input packet buffer to output buffer so as it can
     // be sent to server.
     pkt4->rawPack();
-    IfaceMgr::instance().send(boost::static_pointer_cast<Pkt4>(pkt4));
+    sendPacket(socket, boost::static_pointer_cast<Pkt4>(pkt4));
     if (!preload) {
         if (!stats_mgr4_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
@@ -1793,7 +2871,7 @@ TestControl::sendRequestFromAck(const TestControlSocket& socket) {
 
     msg->pack();
     // And send it.
-    IfaceMgr::instance().send(msg);
+    sendPacket(socket, msg);
     if (!stats_mgr4_) {
         isc_throw(Unexpected, "Statistics Manager for DHCPv4 "
                   "hasn't been initialized");
@@ -1830,7 +2908,7 @@ TestControl::sendMessageFromReply(const uint16_t msg_type,
 
     msg->pack();
     // And send it.
-    IfaceMgr::instance().send(msg);
+    sendPacket(socket, msg);
     if (!stats_mgr6_) {
         isc_throw(Unexpected, "Statistics Manager for DHCPv6 "
                   "hasn't been initialized");
@@ -1897,7 +2975,7 @@ TestControl::sendRequest4(const TestControlSocket& socket,
     pkt4->setSecs(static_cast<uint16_t>(elapsed_time / 1000));
     // Prepare on wire data to send.
     pkt4->pack();
-    IfaceMgr::instance().send(pkt4);
+    sendPacket(socket, pkt4);
     if (!stats_mgr4_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                   "hasn't been initialized");
@@ -2009,7 +3087,7 @@ TestControl::sendRequest4(const TestControlSocket& socket,
 
     // Prepare on-wire data.
     pkt4->rawPack();
-    IfaceMgr::instance().send(boost::static_pointer_cast<Pkt4>(pkt4));
+    sendPacket(socket, boost::static_pointer_cast<Pkt4>(pkt4));
     if (!stats_mgr4_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv4 "
                   "hasn't been initialized");
@@ -2068,7 +3146,7 @@ TestControl::sendRequest6(const TestControlSocket& socket,
 
     // Prepare on-wire data.
     pkt6->pack();
-    IfaceMgr::instance().send(pkt6);
+    sendPacket(socket, pkt6);
     if (!stats_mgr6_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                   "hasn't been initialized");
@@ -2177,7 +3255,7 @@ TestControl::sendRequest6(const TestControlSocket& socket,
     // Prepare on wire data.
     pkt6->rawPack();
     // Send packet.
-    IfaceMgr::instance().send(pkt6);
+    sendPacket(socket, pkt6);
     if (!stats_mgr6_) {
         isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
                   "hasn't been initialized");
@@ -2203,6 +3281,28 @@ TestControl::sendSolicit6(const TestControlSocket& socket,
     // Generate DUID to be passed to the packet
     uint8_t randomized = 0;
     std::vector<uint8_t> duid = generateDuid(randomized);
+    Pkt6Ptr pkt6 = createSolicit6(duid);
+
+    setDefaults6(socket, pkt6);
+
+    // Add any extra options that user may have specified.
+    addExtraOpts(pkt6);
+
+    pkt6->pack();
+    sendPacket(socket, pkt6);
+    if (!preload) {
+        if (!stats_mgr6_) {
+            isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
+                      "hasn't been initialized");
+        }
+        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6);
+    }
+
+    saveFirstPacket(pkt6);
+}
+
+Pkt6Ptr
+TestControl::createSolicit6(const std::vector<uint8_t>& duid) {
     // Generate transaction id to be set for the new exchange.
     const uint32_t transid = generateTransid();
     Pkt6Ptr pkt6(new Pkt6(DHCPV6_SOLICIT, transid));
@@ -2229,23 +3329,7 @@ TestControl::sendSolicit6(const TestControlSocket& socket,
         .includes(CommandOptions::LeaseType::PREFIX)) {
         pkt6->addOption(Option::factory(Option::V6, D6O_IA_PD));
     }
-
-    setDefaults6(socket, pkt6);
-
-    // Add any extra options that user may have specified.
-    addExtraOpts(pkt6);
-
-    pkt6->pack();
-    IfaceMgr::instance().send(pkt6);
-    if (!preload) {
-        if (!stats_mgr6_) {
-            isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
-                      "hasn't been initialized");
-        }
-        stats_mgr6_->passSentPacket(StatsMgr6::XCHG_SA, pkt6);
-    }
-
-    saveFirstPacket(pkt6);
+    return (pkt6);
 }
 
 void
@@ -2285,7 +3369,7 @@ TestControl::sendSolicit6(const TestControlSocket& socket,
     addExtraOpts(pkt6);
 
     // Send solicit packet.
-    IfaceMgr::instance().send(pkt6);
+    sendPacket(socket, pkt6);
     if (!preload) {
         if (!stats_mgr6_) {
             isc_throw(InvalidOperation, "Statistics Manager for DHCPv6 "
@@ -2322,6 +3406,14 @@ TestControl::setDefaults4(const TestControlSocket& socket,
     pkt->setGiaddr(IOAddress(socket.addr_));
     // Pretend that we have one relay (which is us).
     pkt->setHops(1);
+    // The worker threads use different local ports. The relay port
+    // sub-option makes the server send the responses to the port from
+    // which the packet was sent (RFC 8357).
+    if ((workers_num_ > 0) && !pkt->getOption(DHO_DHCP_AGENT_OPTIONS)) {
+        OptionPtr rai(new Option(Option::V4, DHO_DHCP_AGENT_OPTIONS));
+        rai->addOption(OptionPtr(new Option(Option::V4, RAI_OPTION_RELAY_PORT)));
+        pkt->addOption(rai);
+    }
 }
 
 void
@@ -2354,6 +3446,15 @@ TestControl::setDefaults6(const TestControlSocket& socket,
       relay_info.hop_count_ = 1;
       relay_info.linkaddr_ = IOAddress(socket.addr_);
       relay_info.peeraddr_ = IOAddress(socket.addr_);
+      // The worker threads use different local ports. The relay source
+      // port option makes the server send the responses to the port from
+      // which the packet was sent (RFC 8357).
+      if (workers_num_ > 0) {
+          OptionPtr relay_port(new Option(Option::V6, D6O_RELAY_SOURCE_PORT,
+                                          OptionBuffer(2, 0)));
+          relay_info.options_.insert(std::make_pair(relay_port->getType(),
+                                                    relay_port));
+      }
       pkt->addRelayInfo(relay_info);
     }
 }
@@ -2378,6 +3479,28 @@ TestControl::addExtraOpts(const Pkt6Ptr& pkt) {
     }
 }
 
+void
+TestControl::setClientBound(const uint32_t client, const PktPtr& lease,
+                            const uint32_t t1, const uint32_t t2,
+                            const uint32_t valid) {
+    CommandOptions& options = CommandOptions::instance();
+    ptime renew_time(not_a_date_time);
+    ptime rebind_time(not_a_date_time);
+    ptime expire_time(not_a_date_time);
+    // The clients return at once in the avalanche scenario, so they
+    // don't renew the leases. The lease time of 0xFFFFFFFF is infinite.
+    if ((options.getScenario() != CommandOptions::AVALANCHE) &&
+        (valid > 0) && (valid != 0xFFFFFFFF)) {
+        const ptime now = microsec_clock::universal_time();
+        const double scale = options.getTimeScale();
+        renew_time = addSeconds(now, t1 / scale);
+        rebind_time = addSeconds(now, t2 / scale);
+        expire_time = addSeconds(now, valid / scale);
+    }
+    population_->setLease(client, lease, rebind_time, expire_time);
+    population_->setState(client, ClientPopulation::BOUND, renew_time);
+}
+
 bool
 TestControl::testDiags(const char diag) const {
     std::string diags(CommandOptions::instance().getDiags());
@@ -7,6 +7,7 @@
 #ifndef TEST_CONTROL_H
 #define TEST_CONTROL_H
 
+#include "client_population.h"
 #include "packet_storage.h"
 #include "rate_control.h"
 #include "stats_mgr.h"
@@ -15,13 +16,17 @@
 #include <dhcp/dhcp6.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt6.h>
+#include <dhcp/pkt_filter.h>
+#include <dhcp/pkt_filter6.h>
 #include <util/random/random_number_generator.h>
+#include <util/threads/sync.h>
 
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/function.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 
+#include <atomic>
 #include <string>
 #include <vector>
 
@@ -93,6 +98,17 @@ public:
 /// - print statistics, e.g. achieved rate,
 /// - optionally print some diagnostics.
 ///
+/// If the number of threads is specified with the '-g' command line option,
+/// the main loop is executed by multiple worker threads, each using its own
+/// instance of this class (created with the protected constructor), its own
+/// socket and its own range of the simulated clients. The instance returned
+/// by \ref TestControl::instance starts the workers, prints intermediate
+/// reports combining the statistics of all workers and merges the worker
+/// statistics when the test ends. Each worker sends and receives packets
+/// over its socket directly, using its own packet filter, because
+/// \ref dhcp::IfaceMgr is not thread safe and it doesn't distinguish the
+/// sockets bound to the same address and different ports.
+///
 /// With the '-w' command line option user may specify the external application
 /// or script to be executed. This is executed twice, first when the test starts
 /// and second time when the test ends. This external script or application must
@@ -218,10 +234,13 @@ public:
         ///
         /// \param range maximum number generated. If 0 is given then
         /// range defaults to maximum uint32_t value.
-        SequentialGenerator(uint32_t range = 0xFFFFFFFF) :
+        /// \param offset value added to the generated numbers.
+        SequentialGenerator(uint32_t range = 0xFFFFFFFF,
+                            uint32_t offset = 0) :
             NumberGenerator(),
             num_(0),
-            range_(range) {
+            range_(range),
+            offset_(offset) {
             if (range_ == 0) {
                 range_ = 0xFFFFFFFF;
             }
@@ -233,11 +252,12 @@ public:
         virtual uint32_t generate() {
             uint32_t num = num_;
             num_ = (num_ + 1) % range_;
-            return (num);
+            return (offset_ + num);
         }
     private:
-        uint32_t num_;   ///< Current number.
-        uint32_t range_; ///< Number of unique numbers generated.
+        uint32_t num_;    ///< Current number.
+        uint32_t range_;  ///< Number of unique numbers generated.
+        uint32_t offset_; ///< Value added to the generated numbers.
     };
 
     /// \brief Length of the Ethernet HW address (MAC) in bytes.
@@ -288,12 +308,25 @@ public:
     // solution is to make this class friend of test class but this is not
     // what's followed in other classes.
 protected:
+    /// Pointer to the Test Control object used by a worker thread.
+    typedef boost::shared_ptr<TestControl> TestControlPtr;
+
+    /// Pointer to the socket used by a worker thread.
+    typedef boost::shared_ptr<TestControlSocket> TestControlSocketPtr;
+
     /// \brief Default constructor.
     ///
     /// Default constructor is protected as the object can be created
     /// only via \ref instance method.
     TestControl();
 
+    /// \brief Constructor of the object used by a worker thread.
+    ///
+    /// \param worker_index index of the worker thread, starting from 0.
+    /// \param workers_num number of worker threads.
+    TestControl(const unsigned int worker_index,
+                const unsigned int workers_num);
+
     /// Generate uniformly distributed integers in range of [min, max]
     isc::util::random::UniformRandomIntegerGenerator number_generator_;
 
@@ -330,19 +363,42 @@ protected:
     /// \return Pointer to the created message.
     dhcp::Pkt4Ptr createRequestFromAck(const dhcp::Pkt4Ptr& ack);
 
+    /// \brief Creates DHCPv4 message from a DHCPACK message.
+    ///
+    /// This function creates DHCPREQUEST (renewing or rebinding),
+    /// DHCPRELEASE or DHCPDECLINE for the lease carried in the DHCPACK.
+    /// The DHCPREQUEST and DHCPRELEASE carry the leased address in the
+    /// ciaddr field. The DHCPDECLINE carries it in the Requested IP
+    /// Address option. The DHCPRELEASE and DHCPDECLINE also carry the
+    /// Server Identifier copied from the DHCPACK.
+    ///
+    /// \param msg_type A type of the message to be created.
+    /// \param ack An instance of the DHCPACK message to be used to
+    /// create a new message.
+    ///
+    /// \return Pointer to the created message.
+    /// \throw isc::BadValue if the msg_type is invalid, the ack is NULL
+    /// or it contains yiaddr of 0.
+    /// \throw isc::Unexpected if the Server Identifier is missing in the
+    /// DHCPACK message.
+    dhcp::Pkt4Ptr createMessageFromAck(const uint16_t msg_type,
+                                       const dhcp::Pkt4Ptr& ack);
+
     /// \brief Creates DHCPv6 message from the Reply packet.
     ///
-    /// This function creates DHCPv6 Renew or Release message using the
-    /// data from the Reply message by copying options from the Reply
-    /// message.
+    /// This function creates DHCPv6 Renew, Rebind, Release or Decline
+    /// message using the data from the Reply message by copying options
+    /// from the Reply message. The Rebind message doesn't include the
+    /// server id.
     ///
     /// \param msg_type A type of the message to be created.
     /// \param reply An instance of the Reply packet which contents should
     /// be used to create an instance of the new message.
     ///
-    /// \return created Release or Renew message
-    /// \throw isc::BadValue if the msg_type is neither DHCPV6_RENEW nor
-    /// DHCPV6_RELEASE or if the reply is NULL.
+    /// \return created message
+    /// \throw isc::BadValue if the msg_type is none of DHCPV6_RENEW,
+    /// DHCPV6_REBIND, DHCPV6_RELEASE and DHCPV6_DECLINE or if the reply
+    /// is NULL.
     /// \throw isc::Unexpected if mandatory options are missing in the
     /// Reply message.
     dhcp::Pkt6Ptr createMessageFromReply(const uint16_t msg_type,
@@ -483,6 +539,16 @@ protected:
     /// \return vector representing DUID.
     std::vector<uint8_t> generateDuid(uint8_t& randomized);
 
+    /// \brief Generate DUID from the MAC address.
+    ///
+    /// The last octets of the DUID template are replaced with the
+    /// MAC address.
+    ///
+    /// \param mac_addr MAC address of the client.
+    /// \return vector representing DUID.
+    std::vector<uint8_t>
+    generateDuid(const std::vector<uint8_t>& mac_addr) const;
+
     /// \brief Generate MAC address.
     ///
     /// This method generates MAC address. The number of unique
@@ -499,6 +565,32 @@ protected:
     /// \return generated MAC address.
     std::vector<uint8_t> generateMacAddress(uint8_t& randomized);
 
+    /// \brief Generate MAC address of the client with the given number.
+    ///
+    /// The octets of the number are added to the octets of the MAC
+    /// address template, starting from the last one.
+    ///
+    /// \param number number of the client.
+    /// \param [out] randomized number of bytes randomized (initial
+    /// value is ignored).
+    /// \throw isc::BadValue if MAC address template has invalid size.
+    /// \return generated MAC address.
+    std::vector<uint8_t> generateMacAddress(const uint32_t number,
+                                            uint8_t& randomized) const;
+
+    /// \brief Return the number of the simulated client.
+    ///
+    /// This is the reverse of \ref generateMacAddress. The number is
+    /// relative to the first client of this worker, so it can be used
+    /// as an index of the client in the \ref ClientPopulation.
+    ///
+    /// \param mac_addr MAC address of the client.
+    /// \param [out] client number of the client.
+    /// \return true if the MAC address belongs to one of the clients
+    /// of the population, false otherwise.
+    bool getClientNumber(const std::vector<uint8_t>& mac_addr,
+                         uint32_t& client) const;
+
     /// \brief generate transaction id.
     ///
     /// Generate transaction id value (32-bit for DHCPv4,
@@ -527,6 +619,33 @@ protected:
     /// \return reference to template buffer.
     TemplateBuffer getTemplateBuffer(const size_t idx) const;
 
+    /// \brief Return the share of the limit applying to this worker.
+    ///
+    /// The limits specified in the command line, e.g. the rate or the
+    /// number of requests, are divided equally between the worker threads.
+    /// The remainder of the division is distributed among the workers with
+    /// the lowest indexes.
+    ///
+    /// \param total limit specified in the command line.
+    /// \return the share of this worker or the total if the object is not
+    /// used by a worker thread.
+    uint64_t getWorkerShare(const uint64_t total) const;
+
+    /// \brief Return the sum of the shares of the preceding workers.
+    ///
+    /// This is used to find the first simulated client of this worker,
+    /// so as the ranges of clients of the workers don't overlap.
+    ///
+    /// \param total limit specified in the command line.
+    /// \return the sum of the shares of the workers with lower indexes
+    /// or 0 if the object is not used by a worker thread.
+    uint64_t getWorkerOffset(const uint64_t total) const;
+
+    /// \brief Add the statistics collected by a worker.
+    ///
+    /// \param worker object used by a worker thread which has finished.
+    void mergeWorkerStats(const TestControl& worker);
+
     /// \brief Reads packet templates from files.
     ///
     /// Method iterates through all specified template files, reads
@@ -568,7 +687,10 @@ protected:
     /// \brief Print intermediate statistics.
     ///
     /// Print brief statistics regarding number of sent packets,
-    /// received packets and dropped packets so far.
+    /// received packets and dropped packets so far, and the delays
+    /// of the packets received since the previous report. With
+    /// -J json or -J csv the statistics of the packets sent and
+    /// received since the previous report are printed in this format.
     void printIntermediateStats();
 
     /// \brief Print rate statistics.
@@ -578,11 +700,18 @@ protected:
 
     /// \brief Print performance statistics.
     ///
-    /// Method prints performance statistics.
+    /// Method prints performance statistics in the format selected
+    /// with -J.
     /// \throws isc::InvalidOperation if Statistics Manager was
     /// not initialized.
     void printStats() const;
 
+    /// \brief Returns number of seconds since the start of the test.
+    ///
+    /// \throws isc::InvalidOperation if Statistics Manager was
+    /// not initialized.
+    double getElapsedTime() const;
+
     /// \brief Process received DHCPv4 packet.
     ///
     /// Method performs processing of the received DHCPv4 packet,
@@ -617,6 +746,52 @@ protected:
     void processReceivedPacket6(const TestControlSocket& socket,
                                 const dhcp::Pkt6Ptr& pkt6);
 
+    /// \brief Process DHCPv4 packet received by the simulated client.
+    ///
+    /// This function is used instead of \ref processReceivedPacket4
+    /// in the lifecycle and avalanche scenarios. The packet is matched
+    /// with the exchange expected in the current state of the client
+    /// and the client moves to the next state, e.g. the client receiving
+    /// DHCPACK in the RENEWING state becomes BOUND. The packets which
+    /// don't belong to the population or don't match the state of the
+    /// client are ignored.
+    ///
+    /// \param [in] socket socket to be used.
+    /// \param [in] pkt4 object representing DHCPv4 packet received.
+    void processLifecyclePacket4(const TestControlSocket& socket,
+                                 const dhcp::Pkt4Ptr& pkt4);
+
+    /// \brief Process DHCPv6 packet received by the simulated client.
+    ///
+    /// This is the DHCPv6 counterpart of \ref processLifecyclePacket4.
+    /// The Reply received by the client in the INIT state is matched
+    /// with the Release or Decline sent by this client.
+    ///
+    /// \param [in] socket socket to be used.
+    /// \param [in] pkt6 object representing DHCPv6 packet received.
+    void processLifecyclePacket6(const TestControlSocket& socket,
+                                 const dhcp::Pkt6Ptr& pkt6);
+
+    /// \brief Receive DHCPv4 packet from the server.
+    ///
+    /// The packet is received over the specified socket when the object
+    /// is used by a worker thread. Otherwise, it is received by the
+    /// \ref dhcp::IfaceMgr over any open socket.
+    ///
+    /// \param socket socket to be used.
+    /// \param timeout timeout in microseconds.
+    /// \return received packet or null pointer if timeout occurred.
+    dhcp::Pkt4Ptr receivePacket4(const TestControlSocket& socket,
+                                 const uint32_t timeout);
+
+    /// \brief Receive DHCPv6 packet from the server.
+    ///
+    /// \param socket socket to be used.
+    /// \param timeout timeout in microseconds.
+    /// \return received packet or null pointer if timeout occurred.
+    dhcp::Pkt6Ptr receivePacket6(const TestControlSocket& socket,
+                                 const uint32_t timeout);
+
     /// \brief Receive DHCPv4 or DHCPv6 packets from the server.
     ///
     /// Method receives DHCPv4 or DHCPv6 packets from the server.
@@ -716,6 +891,15 @@ protected:
     void sendDiscover4(const TestControlSocket& socket,
                        const bool preload = false);
 
+    /// \brief Create DHCPv4 DISCOVER message.
+    ///
+    /// The message includes the options described in \ref sendDiscover4
+    /// except the options specified in the command line.
+    ///
+    /// \param mac_address MAC address of the client.
+    /// \return created message.
+    dhcp::Pkt4Ptr createDiscover4(const std::vector<uint8_t>& mac_address);
+
     /// \brief Send DHCPv4 DISCOVER message from template.
     ///
     /// Method sends DHCPv4 DISCOVER message from template. The
@@ -760,6 +944,102 @@ protected:
                      const uint64_t packets_num,
                      const bool preload = false);
 
+    /// \brief Send messages of the simulated clients.
+    ///
+    /// This function is used instead of \ref sendPackets in the
+    /// lifecycle and avalanche scenarios. It sends the messages of the
+    /// clients which timers have expired, e.g. Renew when the renewal
+    /// time has come, and initiates new exchanges for at most
+    /// packets_num clients without leases. In the avalanche scenario
+    /// it also makes all clients return at once when the last of them
+    /// has acquired the lease.
+    ///
+    /// \param socket socket to be used to send packets.
+    /// \param packets_num maximum number of the new exchanges.
+    void sendLifecycleMessages(const TestControlSocket& socket,
+                               const uint64_t packets_num);
+
+    /// \brief Send DISCOVER or SOLICIT for the simulated client.
+    ///
+    /// The client moves to the SELECTING state.
+    ///
+    /// \param socket socket to be used to send the message.
+    /// \param client number of the client.
+    void sendClientDiscover(const TestControlSocket& socket,
+                            const uint32_t client);
+
+    /// \brief Messages concerning the lease of the simulated client.
+    enum LeaseMessage {
+        LEASE_RENEW,   ///< DHCPREQUEST in RENEWING state or Renew.
+        LEASE_REBIND,  ///< DHCPREQUEST in REBINDING state or Rebind.
+        LEASE_REBOOT,  ///< DHCPREQUEST in INIT-REBOOT state or Rebind.
+        LEASE_RELEASE, ///< DHCPRELEASE or Release.
+        LEASE_DECLINE  ///< DHCPDECLINE or Decline.
+    };
+
+    /// \brief Send the message concerning the client's lease.
+    ///
+    /// The message is created from the last response of the server
+    /// stored for the client. The client's state is not changed.
+    ///
+    /// \param socket socket to be used to send the message.
+    /// \param client number of the client.
+    /// \param message message to be sent.
+    /// \throw isc::Unexpected if the client has no lease.
+    void sendLeaseMessage(const TestControlSocket& socket,
+                          const uint32_t client,
+                          const LeaseMessage message);
+
+    /// \brief Handle the expiration of the client's timer.
+    ///
+    /// The client which hasn't received the response from the server
+    /// starts over. The client which lease reaches the renewal time
+    /// releases the lease, renews it or, to simulate the server outage,
+    /// waits for the rebinding time without sending anything. The
+    /// client rebinds the lease at the rebinding time and starts over
+    /// when the lease expires.
+    ///
+    /// \param socket socket to be used to send the messages.
+    /// \param client number of the client.
+    void processClientTimer(const TestControlSocket& socket,
+                            const uint32_t client);
+
+    /// \brief Moves the client which acquired the lease to BOUND state.
+    ///
+    /// The lease times are read from the DHCPACK message. The renewal
+    /// and rebinding times default to 1/2 and 7/8 of the lease time.
+    ///
+    /// \param client number of the client.
+    /// \param ack DHCPACK carrying the lease.
+    /// \return false if the DHCPACK doesn't carry the lease.
+    bool bindClient(const uint32_t client, const dhcp::Pkt4Ptr& ack);
+
+    /// \brief Moves the client which acquired the leases to BOUND state.
+    ///
+    /// The lease times are read from the IA options in the Reply. The
+    /// renewal and rebinding times default to 1/2 and 4/5 of the
+    /// shortest preferred lifetime.
+    ///
+    /// \param client number of the client.
+    /// \param reply Reply carrying the leases.
+    /// \return false if the Reply doesn't carry any lease.
+    bool bindClient(const uint32_t client, const dhcp::Pkt6Ptr& reply);
+
+    /// \brief Moves the client to BOUND state and sets its timers.
+    ///
+    /// The lease times are divided by the time scale specified in the
+    /// command line. The client has no timers in the avalanche scenario
+    /// or if the lease time is 0 (unknown) or infinite.
+    ///
+    /// \param client number of the client.
+    /// \param lease server's response carrying the lease.
+    /// \param t1 renewal time in seconds.
+    /// \param t2 rebinding time in seconds.
+    /// \param valid lease time in seconds.
+    void setClientBound(const uint32_t client, const dhcp::PktPtr& lease,
+                        const uint32_t t1, const uint32_t t2,
+                        const uint32_t valid);
+
     /// \brief Send number of DHCPREQUEST (renew) messages to a server.
     ///
     /// \param socket An object representing socket to be used to send packets.
@@ -894,6 +1174,15 @@ protected:
     void sendSolicit6(const TestControlSocket& socket,
                       const bool preload = false);
 
+    /// \brief Create DHCPv6 SOLICIT message.
+    ///
+    /// The message includes the options described in \ref sendSolicit6
+    /// except the options specified in the command line.
+    ///
+    /// \param duid DUID of the client.
+    /// \return created message.
+    dhcp::Pkt6Ptr createSolicit6(const std::vector<uint8_t>& duid);
+
     /// \brief Send DHCPv6 SOLICIT message from template.
     ///
     /// Method sends DHCPv6 SOLICIT message from template.
@@ -909,6 +1198,22 @@ protected:
                       const std::vector<uint8_t>& template_buf,
                       const bool preload = false);
 
+    /// \brief Send DHCPv4 packet to the server.
+    ///
+    /// The packet is sent over the specified socket when the object
+    /// is used by a worker thread. Otherwise, the socket is selected by
+    /// the \ref dhcp::IfaceMgr.
+    ///
+    /// \param socket socket to be used.
+    /// \param pkt packet to be sent.
+    void sendPacket(const TestControlSocket& socket, const dhcp::Pkt4Ptr& pkt);
+
+    /// \brief Send DHCPv6 packet to the server.
+    ///
+    /// \param socket socket to be used.
+    /// \param pkt packet to be sent.
+    void sendPacket(const TestControlSocket& socket, const dhcp::Pkt6Ptr& pkt);
+
     /// \brief Set default DHCPv4 packet parameters.
     ///
     /// This method sets default parameters on the DHCPv4 packet:
@@ -918,6 +1223,8 @@ protected:
     /// - server's address,
     /// - GIADDR = local address where socket is bound to,
     /// - hops = 1 (pretending that we are a relay)
+    /// - relay port sub-option of the relay agent information option
+    ///   if the object is used by a worker thread.
     ///
     /// \param socket socket used to send the packet.
     /// \param pkt reference to packet to be configured.
@@ -932,7 +1239,9 @@ protected:
     /// - local port,
     /// - remote port,
     /// - local address,
-    /// - remote address (server).
+    /// - remote address (server),
+    /// - relay source port option if the object is used by a worker
+    ///   thread.
     ///
     /// \param socket socket used to send the packet.
     /// \param pkt reference to packet to be configured.
@@ -1122,6 +1431,67 @@ protected:
     /// spaces or hexadecimal digits.
     void readPacketTemplate(const std::string& file_name);
 
+    /// \brief Print intermediate statistics of the worker threads.
+    ///
+    /// The statistics last published by the workers are combined.
+    ///
+    /// \param workers objects used by the worker threads.
+    void printWorkersIntermediateStats(const std::vector<TestControlPtr>& workers);
+
+    /// \brief Print intermediate report.
+    ///
+    /// The statistics collected since the previous report are obtained
+    /// by subtracting the copy of the statistics made for the previous
+    /// report from the current statistics. The copy is then replaced
+    /// with the copy of the current statistics.
+    ///
+    /// \param stats current statistics.
+    /// \param [in,out] reported copy of the statistics made for the
+    /// previous report or null if this is the first report.
+    template<typename T>
+    void printIntermediateReport(const StatsMgr<T>& stats,
+                                 boost::shared_ptr<StatsMgr<T> >& reported);
+
+    /// \brief Publish statistics for the intermediate report.
+    ///
+    /// This is called by the worker threads instead of printing the
+    /// intermediate statistics. The copy of the statistics is stored
+    /// so as it can be safely accessed by the main thread which prints
+    /// the report.
+    void publishIntermediateStats();
+
+    /// \brief Run the main loop of the test.
+    ///
+    /// \param socket socket used to send and receive packets.
+    void runLoop(const TestControlSocket& socket);
+
+    /// \brief Run the test in multiple worker threads.
+    ///
+    /// Creates the worker objects, opens their sockets and starts the
+    /// threads. While the threads are running, it prints intermediate
+    /// reports if requested. When all threads finish, the statistics
+    /// collected by the workers are merged into the statistics of this
+    /// object.
+    ///
+    /// \throw isc::Unexpected if a worker socket is invalid or a worker
+    /// thread has failed.
+    void runThreads();
+
+    /// \brief Body of the worker thread.
+    ///
+    /// Sends the preload packets and runs the main loop. An exception
+    /// thrown by the worker interrupts all the workers. Its message is
+    /// stored so as it can be reported by the main thread.
+    ///
+    /// \param socket socket used by the worker.
+    void runWorker(const TestControlSocket& socket);
+
+    /// \brief Checks if any of the worker threads is running.
+    ///
+    /// \param workers objects used by the worker threads.
+    /// \return true if at least one worker thread is running.
+    bool workersRunning(const std::vector<TestControlPtr>& workers);
+
     /// \brief Run wrapped command.
     ///
     /// \param do_stop execute wrapped command with "stop" argument.
@@ -1145,6 +1515,10 @@ protected:
 
     boost::posix_time::ptime last_report_; ///< Last intermediate report time.
 
+    /// Copies of the statistics made for the last intermediate report.
+    StatsMgr4Ptr reported_stats4_;
+    StatsMgr6Ptr reported_stats6_;
+
     StatsMgr4Ptr stats_mgr4_;  ///< Statistics Manager 4.
     StatsMgr6Ptr stats_mgr6_;  ///< Statistics Manager 6.
 
@@ -1165,7 +1539,41 @@ protected:
     std::map<uint8_t, dhcp::Pkt4Ptr> template_packets_v4_;
     std::map<uint8_t, dhcp::Pkt6Ptr> template_packets_v6_;
 
-    static bool interrupted_;  ///< Is program interrupted.
+    /// Time when the test ends if it waits for the packets after an exit
+    /// condition has been met.
+    mutable boost::posix_time::ptime exit_time_;
+
+    unsigned int worker_index_; ///< Index of the worker thread.
+    unsigned int workers_num_;  ///< Number of worker threads (0 if none).
+
+    /// Packet filters used by the worker to send and receive packets
+    /// over its socket.
+    dhcp::PktFilterPtr packet_filter4_;
+    dhcp::PktFilter6Ptr packet_filter6_;
+
+    /// Mutex protecting the statistics published by the worker
+    /// and the worker state.
+    isc::util::thread::Mutex worker_mutex_;
+
+    /// Copies of the worker statistics for the intermediate reports.
+    StatsMgr4Ptr published_stats4_;
+    StatsMgr6Ptr published_stats6_;
+
+    /// Were the published statistics used by an intermediate report.
+    bool published_stats_reported_;
+
+    bool worker_running_;      ///< Is the worker thread running.
+    std::string worker_error_; ///< Error which stopped the worker thread.
+
+    /// Simulated clients in the lifecycle and avalanche scenarios.
+    ClientPopulationPtr population_;
+
+    /// Have all clients returned at once in the avalanche scenario.
+    bool avalanche_started_;
+
+    /// Is program interrupted. It is set by the signal handler and by
+    /// the failed workers and read by all workers without a lock.
+    static std::atomic<bool> interrupted_;
 };
 
 }  // namespace perfdhcp
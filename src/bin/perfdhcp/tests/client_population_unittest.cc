@@ -0,0 +1,103 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include "client_population.h"
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::perfdhcp;
+using namespace boost::posix_time;
+
+namespace {
+
+// Test that all clients are initially waiting for the leases.
+TEST(ClientPopulation, constructor) {
+    ClientPopulation population(3);
+    EXPECT_EQ(3, population.size());
+    EXPECT_EQ(3, population.getStateCount(ClientPopulation::INIT));
+    EXPECT_EQ(0, population.getStateCount(ClientPopulation::BOUND));
+
+    uint32_t client = 0;
+    for (uint32_t i = 0; i < 3; ++i) {
+        ASSERT_TRUE(population.getNextIdle(client));
+        EXPECT_EQ(i, client);
+        EXPECT_EQ(ClientPopulation::INIT, population.getState(client));
+    }
+    EXPECT_FALSE(population.getNextIdle(client));
+}
+
+// Test that the state of the clients is tracked.
+TEST(ClientPopulation, setState) {
+    ClientPopulation population(2);
+    population.setState(0, ClientPopulation::SELECTING);
+    population.setState(1, ClientPopulation::BOUND);
+    EXPECT_EQ(ClientPopulation::SELECTING, population.getState(0));
+    EXPECT_EQ(ClientPopulation::BOUND, population.getState(1));
+    EXPECT_EQ(0, population.getStateCount(ClientPopulation::INIT));
+    EXPECT_EQ(1, population.getStateCount(ClientPopulation::SELECTING));
+    EXPECT_EQ(1, population.getStateCount(ClientPopulation::BOUND));
+
+    // Both clients left the INIT state before they were taken from the
+    // queue, so they are skipped.
+    uint32_t client = 0;
+    EXPECT_FALSE(population.getNextIdle(client));
+
+    // The client returning to the INIT state is queued again.
+    population.setState(1, ClientPopulation::INIT);
+    ASSERT_TRUE(population.getNextIdle(client));
+    EXPECT_EQ(1, client);
+    EXPECT_FALSE(population.getNextIdle(client));
+
+    EXPECT_THROW(population.setState(2, ClientPopulation::BOUND),
+                 isc::OutOfRange);
+    EXPECT_THROW(population.getState(2), isc::OutOfRange);
+}
+
+// Test that the timers expire in order and can be cancelled.
+TEST(ClientPopulation, timers) {
+    ClientPopulation population(3);
+    const ptime now = microsec_clock::universal_time();
+    population.setState(0, ClientPopulation::BOUND, now + seconds(20));
+    population.setState(1, ClientPopulation::BOUND, now + seconds(10));
+    population.setState(2, ClientPopulation::SELECTING, now + seconds(5));
+
+    uint32_t client = 0;
+    EXPECT_FALSE(population.getNextExpired(now, client));
+
+    // Moving the client to another state cancels its timer.
+    population.setState(2, ClientPopulation::REQUESTING);
+
+    ASSERT_TRUE(population.getNextExpired(now + seconds(30), client));
+    EXPECT_EQ(1, client);
+    ASSERT_TRUE(population.getNextExpired(now + seconds(30), client));
+    EXPECT_EQ(0, client);
+    EXPECT_FALSE(population.getNextExpired(now + seconds(30), client));
+}
+
+// Test that the lease and the lease times are stored.
+TEST(ClientPopulation, lease) {
+    ClientPopulation population(1);
+    EXPECT_FALSE(population.getLease(0));
+    EXPECT_TRUE(population.getRebindTime(0).is_not_a_date_time());
+    EXPECT_TRUE(population.getExpireTime(0).is_not_a_date_time());
+
+    Pkt4Ptr ack(new Pkt4(DHCPACK, 1234));
+    const ptime now = microsec_clock::universal_time();
+    population.setLease(0, ack, now + seconds(10), now + seconds(20));
+    EXPECT_TRUE(population.getLease(0) == ack);
+    EXPECT_EQ(now + seconds(10), population.getRebindTime(0));
+    EXPECT_EQ(now + seconds(20), population.getExpireTime(0));
+
+    EXPECT_THROW(population.getLease(1), isc::OutOfRange);
+}
+
+}
@@ -237,6 +237,7 @@ protected:
         EXPECT_EQ(0, opt.getPreload());
         EXPECT_EQ(1, opt.getAggressivity());
         EXPECT_EQ(0, opt.getLocalPort());
+        EXPECT_EQ(1, opt.getThreadsNum());
         EXPECT_FALSE(opt.isSeeded());
         EXPECT_EQ(0, opt.getSeed());
         EXPECT_FALSE(opt.isBroadcast());
@@ -624,6 +625,112 @@ TEST_F(CommandOptionsTest, LocalPort) {
                  isc::InvalidParameter);
 }
 
+TEST_F(CommandOptionsTest, Threads) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -g 4 -r 100 all"));
+    EXPECT_EQ(4, opt.getThreadsNum());
+    EXPECT_NO_THROW(process("perfdhcp -6 -A1 -l ethx -g 2 -L 547 all"));
+    EXPECT_EQ(2, opt.getThreadsNum());
+
+    // Negative test cases
+    // Number of threads must be a positive integer
+    EXPECT_THROW(process("perfdhcp -l ethx -g 0 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -g -2 all"),
+                 isc::InvalidParameter);
+    // The DHCPv6 workers require the relay source port option
+    EXPECT_THROW(process("perfdhcp -6 -l ethx -g 2 all"),
+                 isc::InvalidParameter);
+    // Each worker must get a share of the rate and the clients
+    EXPECT_THROW(process("perfdhcp -l ethx -g 4 -r 3 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -g 4 -R 2 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -g 4 -D 3 all"),
+                 isc::InvalidParameter);
+    // Templates and transaction id diagnostics are not supported
+    EXPECT_THROW(process("perfdhcp -l ethx -g 2 -T file.hex all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -g 2 -x t all"),
+                 isc::InvalidParameter);
+    // The workers' local ports must not exceed 65535
+    EXPECT_THROW(process("perfdhcp -l ethx -g 4 -L 65534 all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, OutputFormat) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -r 10 -t 1 all"));
+    EXPECT_EQ(CommandOptions::TEXT_OUTPUT, opt.getOutputFormat());
+
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -r 10 -t 1 -J json all"));
+    EXPECT_EQ(CommandOptions::JSON_OUTPUT, opt.getOutputFormat());
+
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -r 10 -t 1 -J CSV all"));
+    EXPECT_EQ(CommandOptions::CSV_OUTPUT, opt.getOutputFormat());
+
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -r 10 -t 1 -J text all"));
+    EXPECT_EQ(CommandOptions::TEXT_OUTPUT, opt.getOutputFormat());
+
+    // Unknown format
+    EXPECT_THROW(process("perfdhcp -l ethx -r 10 -J xml all"),
+                 isc::InvalidParameter);
+}
+
+TEST_F(CommandOptionsTest, Scenario) {
+    CommandOptions& opt = CommandOptions::instance();
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -r 10 all"));
+    EXPECT_EQ(CommandOptions::BASIC, opt.getScenario());
+    EXPECT_EQ(0, opt.getReleasePercentage());
+    EXPECT_EQ(0, opt.getDeclinePercentage());
+    EXPECT_EQ(0, opt.getRebindPercentage());
+    EXPECT_EQ(1, opt.getTimeScale());
+
+    EXPECT_NO_THROW(process("perfdhcp -l ethx -r 10 -R 100 -Y lifecycle"
+                            " -j release=10 -j decline=5 -j rebind=20"
+                            " -j time-scale=60 all"));
+    EXPECT_EQ(CommandOptions::LIFECYCLE, opt.getScenario());
+    EXPECT_EQ(10, opt.getReleasePercentage());
+    EXPECT_EQ(5, opt.getDeclinePercentage());
+    EXPECT_EQ(20, opt.getRebindPercentage());
+    EXPECT_EQ(60, opt.getTimeScale());
+
+    EXPECT_NO_THROW(process("perfdhcp -6 -l ethx -r 10 -R 100 -Y avalanche"
+                            " all"));
+    EXPECT_EQ(CommandOptions::AVALANCHE, opt.getScenario());
+
+    // Negative test cases
+    // Unknown scenario
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y storm all"),
+                 isc::InvalidParameter);
+    // Malformed or out of range lifecycle parameters
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -j release"
+                         " all"), isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -j release=101"
+                         " all"), isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -j time-scale=0"
+                         " all"), isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -j renew=10"
+                         " all"), isc::InvalidParameter);
+    // The releasing and rebinding clients must not exceed 100%
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -j release=60"
+                         " -j rebind=50 all"), isc::InvalidParameter);
+    // Lifecycle parameters require the scenario
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -j release=10 all"),
+                 isc::InvalidParameter);
+    // The scenarios don't work with the two-way exchanges, renew and
+    // release rates, templates and preload
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -i all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -6 -l ethx -R 100 -Y lifecycle -f 10 all"),
+                 isc::InvalidParameter);
+    EXPECT_THROW(process("perfdhcp -l ethx -R 100 -Y lifecycle -P 10 all"),
+                 isc::InvalidParameter);
+    // Each worker must simulate at least one client
+    EXPECT_THROW(process("perfdhcp -l ethx -g 4 -r 100 -R 2 -Y lifecycle"
+                         " all"), isc::InvalidParameter);
+}
+
 TEST_F(CommandOptionsTest, Preload) {
     CommandOptions& opt = CommandOptions::instance();
     EXPECT_NO_THROW(process("perfdhcp -1 -P 3 -l ethx all"));
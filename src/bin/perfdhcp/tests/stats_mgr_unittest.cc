@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <cc/data.h>
 #include <exceptions/exceptions.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/dhcp6.h>
@@ -22,6 +23,7 @@
 
 using namespace std;
 using namespace isc;
+using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::perfdhcp;
 
@@ -510,6 +512,173 @@ TEST_F(StatsMgrTest, Delays) {
     EXPECT_GT(stats_mgr->getStdDevDelay(StatsMgr4::XCHG_DO), 0);
 }
 
+TEST_F(StatsMgrTest, DelayPercentiles) {
+    boost::shared_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_DO, 5);
+
+    // There are no delays recorded yet.
+    EXPECT_THROW(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 50),
+                 isc::InvalidOperation);
+
+    // Send DISCOVER, wait 1s and receive OFFER.
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid);
+
+    // The only delay is at any percentile. It is reported in seconds
+    // with the error of the histogram.
+    double delay = 0;
+    ASSERT_NO_THROW(delay = stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO,
+                                                          50));
+    EXPECT_GT(delay, 0.9);
+    EXPECT_LT(delay, 1.5);
+    EXPECT_DOUBLE_EQ(delay,
+                     stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 99.9));
+    EXPECT_LE(delay, stats_mgr->getMaxDelay(StatsMgr4::XCHG_DO));
+
+    // Percentile out of range is rejected.
+    EXPECT_THROW(stats_mgr->getDelayPercentile(StatsMgr4::XCHG_DO, 101),
+                 isc::BadValue);
+}
+
+TEST_F(StatsMgrTest, IntervalStats) {
+    boost::shared_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_DO, 5);
+
+    // Two exchanges are completed and one DISCOVER is not answered
+    // before the first report.
+    passDOPacketsWithDelay(stats_mgr, 0, common_transid);
+    passDOPacketsWithDelay(stats_mgr, 0, common_transid + 1);
+    boost::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPDISCOVER,
+                                                      common_transid + 2));
+    stats_mgr->passSentPacket(StatsMgr4::XCHG_DO, sent_packet);
+    StatsMgr4 reported;
+    reported.merge(*stats_mgr);
+    stats_mgr->startInterval();
+
+    // One exchange with a longer delay is completed before the second
+    // report.
+    passDOPacketsWithDelay(stats_mgr, 1, common_transid + 3);
+    StatsMgr4 interval;
+    interval.merge(*stats_mgr);
+    interval.subtract(reported);
+
+    EXPECT_EQ(4, stats_mgr->getSentPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(3, stats_mgr->getRcvdPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(1, interval.getSentPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(1, interval.getRcvdPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(0, interval.getDroppedPacketsNum(StatsMgr4::XCHG_DO));
+
+    // The delays of the interval are exact: the only delay of the
+    // interval is the highest delay and it is not lower than 1s.
+    EXPECT_DOUBLE_EQ(stats_mgr->getMaxDelay(StatsMgr4::XCHG_DO),
+                     interval.getMinDelay(StatsMgr4::XCHG_DO));
+    EXPECT_DOUBLE_EQ(stats_mgr->getMaxDelay(StatsMgr4::XCHG_DO),
+                     interval.getMaxDelay(StatsMgr4::XCHG_DO));
+    EXPECT_GT(interval.getMinDelay(StatsMgr4::XCHG_DO), 1);
+    EXPECT_LT(stats_mgr->getMinDelay(StatsMgr4::XCHG_DO), 1);
+    EXPECT_NO_THROW(interval.getDelayPercentile(StatsMgr4::XCHG_DO, 99));
+    EXPECT_GE(interval.getStdDevDelay(StatsMgr4::XCHG_DO), 0);
+
+    // The earlier copy holding more packets can't be subtracted.
+    EXPECT_THROW(reported.subtract(*stats_mgr), isc::BadValue);
+}
+
+TEST_F(StatsMgrTest, ExchangeToElement) {
+    StatsMgr4::ExchangeStats xchg_stats(StatsMgr4::XCHG_DO, 5, false,
+        boost::posix_time::microsec_clock::universal_time());
+
+    // The delays are null if no packets have been received.
+    boost::shared_ptr<Pkt4> sent_packet(createPacket4(DHCPDISCOVER,
+                                                      common_transid));
+    xchg_stats.appendSent(sent_packet);
+    ConstElementPtr stats = xchg_stats.toElement();
+    ASSERT_TRUE(stats);
+    ASSERT_EQ(Element::map, stats->getType());
+    EXPECT_EQ("DISCOVER-OFFER", stats->get("exchange")->stringValue());
+    EXPECT_EQ(1, stats->get("sent")->intValue());
+    EXPECT_EQ(0, stats->get("received")->intValue());
+    EXPECT_EQ(1, stats->get("drops")->intValue());
+    ASSERT_TRUE(stats->get("p99.9-delay"));
+    EXPECT_EQ(Element::null, stats->get("p99.9-delay")->getType());
+    EXPECT_EQ(Element::null, stats->get("avg-delay")->getType());
+
+    // The delays are reported in milliseconds.
+    boost::shared_ptr<Pkt4> rcvd_packet(createPacket4(DHCPOFFER,
+                                                      common_transid));
+    ASSERT_TRUE(xchg_stats.matchPackets(rcvd_packet));
+    xchg_stats.updateDelays(sent_packet, rcvd_packet);
+    stats = xchg_stats.toElement();
+    EXPECT_EQ(1, stats->get("received")->intValue());
+    EXPECT_EQ(0, stats->get("drops")->intValue());
+    const char* delays[] = { "min-delay", "avg-delay", "max-delay",
+                             "std-deviation", "p50-delay", "p90-delay",
+                             "p99-delay", "p99.9-delay" };
+    for (size_t i = 0; i < sizeof(delays) / sizeof(delays[0]); ++i) {
+        ASSERT_TRUE(stats->get(delays[i])) << delays[i];
+        EXPECT_EQ(Element::real, stats->get(delays[i])->getType())
+            << delays[i];
+    }
+}
+
+TEST_F(StatsMgrTest, PrintStatsJSON) {
+    boost::shared_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_DO);
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_RA);
+    stats_mgr->addCustomCounter("shortwait", "Short waits for packets");
+    passDOPacketsWithDelay(stats_mgr, 0, common_transid);
+
+    // Capture the report printed on the standard output.
+    std::ostringstream output;
+    std::streambuf* cout_buf = std::cout.rdbuf(output.rdbuf());
+    stats_mgr->printStatsJSON("summary", 1.5, true);
+    std::cout.rdbuf(cout_buf);
+
+    // The report is a single line holding the JSON map.
+    std::string report = output.str();
+    ASSERT_FALSE(report.empty());
+    EXPECT_EQ(report.size() - 1, report.find('\n'));
+    ConstElementPtr stats;
+    ASSERT_NO_THROW(stats = Element::fromJSON(report));
+    EXPECT_EQ("summary", stats->get("report")->stringValue());
+    EXPECT_DOUBLE_EQ(1.5, stats->get("elapsed")->doubleValue());
+    ASSERT_TRUE(stats->get("exchanges"));
+    ASSERT_EQ(2, stats->get("exchanges")->size());
+    EXPECT_EQ("DISCOVER-OFFER",
+              stats->get("exchanges")->get(0)->get("exchange")->stringValue());
+    EXPECT_EQ("REQUEST-ACK",
+              stats->get("exchanges")->get(1)->get("exchange")->stringValue());
+    ASSERT_TRUE(stats->get("counters"));
+    EXPECT_EQ(0, stats->get("counters")->get("shortwait")->intValue());
+}
+
+TEST_F(StatsMgrTest, PrintStatsCSV) {
+    boost::shared_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_DO);
+    stats_mgr->addExchangeStats(StatsMgr4::XCHG_RA);
+    passDOPacketsWithDelay(stats_mgr, 0, common_transid);
+
+    std::ostringstream output;
+    std::streambuf* cout_buf = std::cout.rdbuf(output.rdbuf());
+    StatsMgr4::printCSVHeader();
+    stats_mgr->printStatsCSV("interval", 2);
+    std::cout.rdbuf(cout_buf);
+
+    // The header is followed by one row for each exchange and all
+    // rows have the same number of columns.
+    std::istringstream input(output.str());
+    std::vector<std::string> lines;
+    std::string line;
+    while (std::getline(input, line)) {
+        lines.push_back(line);
+    }
+    ASSERT_EQ(3, lines.size());
+    EXPECT_EQ(0, lines[0].find("report,elapsed,exchange,sent,received,drops"));
+    EXPECT_EQ(0, lines[1].find("interval,2.000,DISCOVER-OFFER,1,1,0,0,"));
+    EXPECT_EQ(0, lines[2].find("interval,2.000,REQUEST-ACK,0,0,0,0,"));
+    const size_t columns = std::count(lines[0].begin(), lines[0].end(), ',');
+    EXPECT_EQ(columns, std::count(lines[1].begin(), lines[1].end(), ','));
+    EXPECT_EQ(columns, std::count(lines[2].begin(), lines[2].end(), ','));
+}
+
 TEST_F(StatsMgrTest, CustomCounters) {
     boost::scoped_ptr<StatsMgr4> stats_mgr(new StatsMgr4());
 
@@ -549,6 +718,75 @@ TEST_F(StatsMgrTest, CustomCounters) {
 
 }
 
+// This test verifies that the statistics gathered by the worker threads
+// are merged into a single Statistics Manager.
+TEST_F(StatsMgrTest, Merge) {
+    StatsMgr4 stats_mgr1;
+    stats_mgr1.addExchangeStats(StatsMgr4::XCHG_DO);
+    stats_mgr1.addCustomCounter("shortwait", "Short waits for packets");
+
+    StatsMgr4 stats_mgr2;
+    stats_mgr2.addExchangeStats(StatsMgr4::XCHG_DO);
+    stats_mgr2.addExchangeStats(StatsMgr4::XCHG_RA);
+    stats_mgr2.addCustomCounter("shortwait", "Short waits for packets");
+    stats_mgr2.addCustomCounter("latesend", "Rejected packets");
+
+    // The first manager gets two exchanges with a delay of 2s and a
+    // packet which is never answered.
+    for (uint32_t transid = 1; transid <= 3; ++transid) {
+        Pkt4ModifiablePtr sent_packet(createPacket4(DHCPDISCOVER, transid));
+        sent_packet->modifyTimestamp(-2);
+        ASSERT_NO_THROW(
+            stats_mgr1.passSentPacket(StatsMgr4::XCHG_DO, sent_packet)
+        );
+        if (transid < 3) {
+            ASSERT_NO_THROW(
+                stats_mgr1.passRcvdPacket(StatsMgr4::XCHG_DO,
+                    Pkt4Ptr(createPacket4(DHCPOFFER, transid)))
+            );
+        }
+    }
+    stats_mgr1.incrementCounter("shortwait", 3);
+
+    // The second manager gets one exchange with a delay of 5s.
+    Pkt4ModifiablePtr sent_packet(createPacket4(DHCPDISCOVER, 10));
+    sent_packet->modifyTimestamp(-5);
+    ASSERT_NO_THROW(
+        stats_mgr2.passSentPacket(StatsMgr4::XCHG_DO, sent_packet)
+    );
+    ASSERT_NO_THROW(
+        stats_mgr2.passRcvdPacket(StatsMgr4::XCHG_DO,
+                                  Pkt4Ptr(createPacket4(DHCPOFFER, 10)))
+    );
+    stats_mgr2.incrementCounter("shortwait", 2);
+    stats_mgr2.incrementCounter("latesend");
+
+    StatsMgr4 merged;
+    ASSERT_NO_THROW(merged.merge(stats_mgr1));
+    ASSERT_NO_THROW(merged.merge(stats_mgr2));
+
+    // The exchanges and counters of both managers are present.
+    ASSERT_TRUE(merged.hasExchangeStats(StatsMgr4::XCHG_DO));
+    ASSERT_TRUE(merged.hasExchangeStats(StatsMgr4::XCHG_RA));
+    EXPECT_EQ(4, merged.getSentPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(3, merged.getRcvdPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(1, merged.getDroppedPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(0, merged.getSentPacketsNum(StatsMgr4::XCHG_RA));
+    EXPECT_EQ(5, merged.getCounter("shortwait")->getValue());
+    EXPECT_EQ(1, merged.getCounter("latesend")->getValue());
+
+    // The delays cover the exchanges of both managers.
+    EXPECT_GE(merged.getMinDelay(StatsMgr4::XCHG_DO), 2);
+    EXPECT_LT(merged.getMinDelay(StatsMgr4::XCHG_DO), 5);
+    EXPECT_GE(merged.getMaxDelay(StatsMgr4::XCHG_DO), 5);
+    EXPECT_GT(merged.getAvgDelay(StatsMgr4::XCHG_DO), 2);
+    EXPECT_LT(merged.getAvgDelay(StatsMgr4::XCHG_DO), 5);
+
+    // The merged managers are not modified.
+    EXPECT_EQ(3, stats_mgr1.getSentPacketsNum(StatsMgr4::XCHG_DO));
+    EXPECT_EQ(3, stats_mgr1.getCounter("shortwait")->getValue());
+}
+
 TEST_F(StatsMgrTest, PrintStats) {
     std::cout << "This unit test is checking statistics printing "
               << "capabilities. It is expected that some counters "
@@ -12,6 +12,9 @@
 #include <asiolink/io_address.h>
 #include <exceptions/exceptions.h>
 #include <dhcp/dhcp4.h>
+#include <dhcp/option_int.h>
+#include <dhcp/option6_ia.h>
+#include <dhcp/option6_iaaddr.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/iface_mgr.h>
 
@@ -100,7 +103,9 @@ public:
 
     }
 
+    using TestControl::bindClient;
     using TestControl::checkExitConditions;
+    using TestControl::createMessageFromAck;
     using TestControl::createMessageFromReply;
     using TestControl::createRequestFromAck;
     using TestControl::factoryElapsedTime6;
@@ -112,8 +117,12 @@ public:
     using TestControl::generateClientId;
     using TestControl::generateDuid;
     using TestControl::generateMacAddress;
+    using TestControl::getClientNumber;
     using TestControl::getCurrentTimeout;
+    using TestControl::getSentPacketsNum;
     using TestControl::getTemplateBuffer;
+    using TestControl::getWorkerOffset;
+    using TestControl::getWorkerShare;
     using TestControl::initPacketTemplates;
     using TestControl::initializeStatsMgr;
     using TestControl::openSocket;
@@ -121,7 +130,9 @@ public:
     using TestControl::processReceivedPacket6;
     using TestControl::registerOptionFactories;
     using TestControl::reset;
+    using TestControl::processClientTimer;
     using TestControl::sendDiscover4;
+    using TestControl::sendLifecycleMessages;
     using TestControl::sendRequest4;
     using TestControl::sendPackets;
     using TestControl::sendMultipleRequests;
@@ -143,6 +154,7 @@ public:
     using TestControl::template_packets_v6_;
     using TestControl::ack_storage_;
     using TestControl::sendRequestFromAck;
+    using TestControl::population_;
 
     NakedTestControl() : TestControl() {
         uint32_t clients_num = CommandOptions::instance().getClientsNum() == 0 ?
@@ -150,6 +162,15 @@ public:
         setMacAddrGenerator(NumberGeneratorPtr(new TestControl::SequentialGenerator(clients_num)));
     };
 
+    /// \brief Constructor of the worker.
+    ///
+    /// \param worker_index index of the worker.
+    /// \param workers_num total number of workers.
+    NakedTestControl(const unsigned int worker_index,
+                     const unsigned int workers_num)
+        : TestControl(worker_index, workers_num) {
+    }
+
 };
 
 /// \brief Test Fixture Class
@@ -805,11 +826,66 @@ public:
         ack->setYiaddr(yiaddr);
     }
 
+    /// \brief Test that the DHCPRELEASE or DHCPDECLINE message is created
+    /// correctly and comprises expected values.
+    ///
+    /// \param msg_type A type of the message to be tested: DHCPRELEASE
+    /// or DHCPDECLINE.
+    void testCreateMessageFromAck(const uint16_t msg_type) {
+        ASSERT_NO_THROW(processCmdLine("perfdhcp -4 -l lo -r 10 -R 10"
+                                       " -L 10067 -n 10 127.0.0.1"));
+        NakedTestControl tc;
+        boost::shared_ptr<NakedTestControl::IncrementalGenerator>
+            generator(new NakedTestControl::IncrementalGenerator());
+        tc.setTransidGenerator(generator);
+
+        Pkt4Ptr ack = createAckPkt4(1);
+
+        Pkt4Ptr msg;
+        ASSERT_NO_THROW(msg = tc.createMessageFromAck(msg_type, ack));
+        ASSERT_TRUE(msg);
+        EXPECT_EQ(msg_type, msg->getType());
+        EXPECT_EQ(1, msg->getTransid());
+
+        // The DHCPRELEASE carries the address in ciaddr and the DHCPDECLINE
+        // in the Requested IP Address option.
+        OptionPtr opt_requested_address =
+            msg->getOption(DHO_DHCP_REQUESTED_ADDRESS);
+        if (msg_type == DHCPRELEASE) {
+            EXPECT_EQ("127.0.0.1", msg->getCiaddr().toText());
+            EXPECT_FALSE(opt_requested_address);
+        } else {
+            EXPECT_TRUE(msg->getCiaddr().isV4Zero());
+            ASSERT_TRUE(opt_requested_address);
+            EXPECT_EQ(asiolink::IOAddress("127.0.0.1").toUint32(),
+                      opt_requested_address->getUint32());
+        }
+
+        // Server identifier.
+        OptionPtr opt_serverid = msg->getOption(DHO_DHCP_SERVER_IDENTIFIER);
+        ASSERT_TRUE(opt_serverid);
+        EXPECT_TRUE(ack->getOption(DHO_DHCP_SERVER_IDENTIFIER)->getData() ==
+                    opt_serverid->getData());
+
+        // HW address.
+        HWAddrPtr hwaddr_msg = msg->getHWAddr();
+        ASSERT_TRUE(hwaddr_msg);
+        EXPECT_TRUE(ack->getHWAddr()->hwaddr_ == hwaddr_msg->hwaddr_);
+
+        // The server identifier is mandatory.
+        ack->delOption(DHO_DHCP_SERVER_IDENTIFIER);
+        EXPECT_THROW(tc.createMessageFromAck(msg_type, ack), isc::Unexpected);
+
+        // Other messages are not created from DHCPACK.
+        EXPECT_THROW(tc.createMessageFromAck(DHCPDISCOVER, ack),
+                     isc::BadValue);
+    }
+
     /// \brief Test that the DHCPv6 Release or Renew message is created
     /// correctly and comprises expected options.
     ///
-    /// \param msg_type A type of the message to be tested: DHCPV6_RELEASE
-    /// or DHCPV6_RENEW.
+    /// \param msg_type A type of the message to be tested: DHCPV6_RELEASE,
+    /// DHCPV6_RENEW, DHCPV6_REBIND or DHCPV6_DECLINE.
     void testCreateRenewRelease(const uint16_t msg_type) {
         // This command line specifies that the Release/Renew messages should
         // be sent with the same rate as the Solicit messages.
@@ -848,11 +924,15 @@ public:
         EXPECT_TRUE(reply->getOption(D6O_CLIENTID)->getData() ==
                     opt_clientid->getData());
 
-        // Server identifier
+        // Server identifier. The Rebind is sent to any server.
         OptionPtr opt_serverid = msg->getOption(D6O_SERVERID);
-        ASSERT_TRUE(opt_serverid);
-        EXPECT_TRUE(reply->getOption(D6O_SERVERID)->getData() ==
-                opt_serverid->getData());
+        if (msg_type == DHCPV6_REBIND) {
+            EXPECT_FALSE(opt_serverid);
+        } else {
+            ASSERT_TRUE(opt_serverid);
+            EXPECT_TRUE(reply->getOption(D6O_SERVERID)->getData() ==
+                        opt_serverid->getData());
+        }
 
         // IA_NA
         OptionPtr opt_ia_na = msg->getOption(D6O_IA_NA);
@@ -1124,6 +1204,42 @@ TEST_F(TestControlTest, reset) {
 
 }
 
+// This test verifies that the rates, the number of requests and the
+// clients are split between the workers.
+TEST_F(TestControlTest, workerShares) {
+    ASSERT_NO_THROW(processCmdLine("perfdhcp -l ethx -g 3 -r 100 -f 3"
+                                   " -R 10 -n 20 all"));
+    NakedTestControl w0(0, 3);
+    NakedTestControl w1(1, 3);
+    NakedTestControl w2(2, 3);
+
+    // The remainder goes to the workers with the lowest indexes.
+    EXPECT_EQ(4, w0.getWorkerShare(10));
+    EXPECT_EQ(3, w1.getWorkerShare(10));
+    EXPECT_EQ(3, w2.getWorkerShare(10));
+    EXPECT_EQ(0, w0.getWorkerOffset(10));
+    EXPECT_EQ(4, w1.getWorkerOffset(10));
+    EXPECT_EQ(7, w2.getWorkerOffset(10));
+
+    EXPECT_EQ(34, w0.basic_rate_control_.getRate());
+    EXPECT_EQ(33, w1.basic_rate_control_.getRate());
+    EXPECT_EQ(33, w2.basic_rate_control_.getRate());
+    EXPECT_EQ(1, w0.renew_rate_control_.getRate());
+    EXPECT_EQ(1, w2.renew_rate_control_.getRate());
+
+    // Each worker simulates its own range of clients.
+    ASSERT_TRUE(w1.macaddr_gen_);
+    EXPECT_EQ(4, w1.macaddr_gen_->generate());
+    EXPECT_EQ(5, w1.macaddr_gen_->generate());
+    EXPECT_EQ(6, w1.macaddr_gen_->generate());
+    EXPECT_EQ(4, w1.macaddr_gen_->generate());
+
+    // The default instance does all the work.
+    NakedTestControl tc;
+    EXPECT_EQ(10, tc.getWorkerShare(10));
+    EXPECT_EQ(0, tc.getWorkerOffset(10));
+}
+
 // This test verifies that the client id is generated from the HW address.
 TEST_F(TestControlTest, generateClientId) {
     // Generate HW address.
@@ -1425,6 +1541,29 @@ TEST_F(TestControlTest, Packet4) {
     }
 }
 
+TEST_F(TestControlTest, Packet4Worker) {
+    // Use Interface Manager to get the local loopback interface.
+    // If interface can't be found we don't want to fail test.
+    std::string loopback_iface(getLocalLoopback());
+    if (!loopback_iface.empty()) {
+        ASSERT_NO_THROW(processCmdLine("perfdhcp -l " + loopback_iface +
+                                       " -g 2 -L 10547 all"));
+        NakedTestControl tc(1, 2);
+        int sock_handle = 0;
+        ASSERT_NO_THROW(sock_handle = tc.openSocket());
+        TestControl::TestControlSocket sock(sock_handle);
+        boost::shared_ptr<Pkt4> pkt4(new Pkt4(DHCPDISCOVER, 123));
+        ASSERT_NO_THROW(tc.setDefaults4(sock, pkt4));
+        // The server is asked to respond to the relay source port.
+        OptionPtr rai = pkt4->getOption(DHO_DHCP_AGENT_OPTIONS);
+        ASSERT_TRUE(rai);
+        EXPECT_TRUE(rai->getOption(RAI_OPTION_RELAY_PORT));
+    } else {
+        std::cout << "Unable to find the loopback interface. Skip test. "
+                  << std::endl;
+    }
+}
+
 TEST_F(TestControlTest, Packet6) {
     // Use Interface Manager to get the local loopback interface.
     // If the interface can't be found we don't want to fail test.
@@ -1793,6 +1932,172 @@ TEST_F(TestControlTest, createRelease) {
     testCreateRenewRelease(DHCPV6_RELEASE);
 }
 
+// This test verifies that the DHCPv6 Rebind message is created correctly
+// and that it doesn't include the server identifier.
+TEST_F(TestControlTest, createRebind) {
+    testCreateRenewRelease(DHCPV6_REBIND);
+}
+
+// This test verifies that the DHCPv6 Decline message is created correctly
+// and that it comprises all required options.
+TEST_F(TestControlTest, createDecline) {
+    testCreateRenewRelease(DHCPV6_DECLINE);
+}
+
+// This test verifies that the DHCPRELEASE is created correctly from the
+// DHCPACK message.
+TEST_F(TestControlTest, createRelease4) {
+    testCreateMessageFromAck(DHCPRELEASE);
+}
+
+// This test verifies that the DHCPDECLINE is created correctly from the
+// DHCPACK message.
+TEST_F(TestControlTest, createDecline4) {
+    testCreateMessageFromAck(DHCPDECLINE);
+}
+
+// This test verifies that the simulated client is found by its MAC
+// address and that the clients of other workers are not.
+TEST_F(TestControlTest, getClientNumber) {
+    ASSERT_NO_THROW(processCmdLine("perfdhcp -l ethx -g 2 -r 100 -R 1000"
+                                   " -Y lifecycle all"));
+    // The second worker simulates the clients from 500 to 999.
+    NakedTestControl tc(1, 2);
+    uint32_t client = 0;
+    uint8_t randomized = 0;
+    std::vector<uint8_t> mac_addr = tc.generateMacAddress(623, randomized);
+    // There is no population, so there are no clients.
+    EXPECT_FALSE(tc.getClientNumber(mac_addr, client));
+
+    tc.population_.reset(new ClientPopulation(tc.getWorkerShare(1000)));
+    ASSERT_TRUE(tc.getClientNumber(mac_addr, client));
+    EXPECT_EQ(123, client);
+
+    // The last client of this worker.
+    mac_addr = tc.generateMacAddress(999, randomized);
+    ASSERT_TRUE(tc.getClientNumber(mac_addr, client));
+    EXPECT_EQ(499, client);
+
+    // The clients of the first worker.
+    mac_addr = tc.generateMacAddress(10, randomized);
+    EXPECT_FALSE(tc.getClientNumber(mac_addr, client));
+    mac_addr = tc.generateMacAddress(1000, randomized);
+    EXPECT_FALSE(tc.getClientNumber(mac_addr, client));
+
+    // The MAC address not generated from the template.
+    mac_addr = tc.generateMacAddress(623, randomized);
+    mac_addr[0] ^= 0xFF;
+    EXPECT_FALSE(tc.getClientNumber(mac_addr, client));
+}
+
+// This test verifies that the DHCPv6 client is bound with the timers
+// calculated from the lease lifetimes and the time scale.
+TEST_F(TestControlTest, bindClient6) {
+    ASSERT_NO_THROW(processCmdLine("perfdhcp -6 -l ethx -r 10 -R 1"
+                                   " -Y lifecycle -j time-scale=10 all"));
+    NakedTestControl tc;
+    tc.population_.reset(new ClientPopulation(1));
+
+    // The Reply without leases is refused.
+    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, 1));
+    Option6IAPtr ia(new Option6IA(D6O_IA_NA, 1));
+    reply->addOption(ia);
+    EXPECT_FALSE(tc.bindClient(0, reply));
+    EXPECT_EQ(ClientPopulation::INIT, tc.population_->getState(0));
+
+    // The renewal and rebinding times are not set by the server, so
+    // the defaults are derived from the preferred lifetime.
+    ia->addOption(OptionPtr(new Option6IAAddr(D6O_IAADDR,
+                                              asiolink::IOAddress("2001:db8::1"),
+                                              1000, 2000)));
+    const ptime now = microsec_clock::universal_time();
+    ASSERT_TRUE(tc.bindClient(0, reply));
+    EXPECT_EQ(ClientPopulation::BOUND, tc.population_->getState(0));
+    EXPECT_TRUE(tc.population_->getLease(0) == reply);
+    // The rebinding time is 800s and the lease expires after 2000s,
+    // divided by the time scale.
+    time_duration rebind = tc.population_->getRebindTime(0) - now;
+    EXPECT_NEAR(80, rebind.total_milliseconds() / 1000., 1);
+    time_duration expire = tc.population_->getExpireTime(0) - now;
+    EXPECT_NEAR(200, expire.total_milliseconds() / 1000., 1);
+
+    // The renewal time is the first timer of the client.
+    uint32_t client = 0;
+    EXPECT_FALSE(tc.population_->getNextExpired(now + seconds(49), client));
+    EXPECT_TRUE(tc.population_->getNextExpired(now + seconds(51), client));
+}
+
+// This test verifies that the simulated DHCPv4 client acquires the lease
+// and starts over when its request is refused.
+TEST_F(TestControlTest, Lifecycle4) {
+    std::string loopback_iface(getLocalLoopback());
+    if (loopback_iface.empty()) {
+        std::cout << "Unable to find the loopback interface. Skip test."
+                  << std::endl;
+        return;
+    }
+    processCmdLine("perfdhcp -l " + loopback_iface +
+                   " -r 100 -R 2 -Y lifecycle -L 10547 127.0.0.1");
+    NakedTestControl tc;
+    tc.initializeStatsMgr();
+    tc.population_.reset(new ClientPopulation(2));
+    NakedTestControl::IncrementalGeneratorPtr
+        generator(new NakedTestControl::IncrementalGenerator());
+    tc.setTransidGenerator(generator);
+    int sock_handle = 0;
+    ASSERT_NO_THROW(sock_handle = tc.openSocket());
+    TestControl::TestControlSocket sock(sock_handle);
+
+    // The first client sends DHCPDISCOVER.
+    ASSERT_NO_THROW(tc.sendLifecycleMessages(sock, 1));
+    EXPECT_EQ(ClientPopulation::SELECTING, tc.population_->getState(0));
+    EXPECT_EQ(ClientPopulation::INIT, tc.population_->getState(1));
+
+    uint8_t randomized = 0;
+    std::vector<uint8_t> mac_addr0 = tc.generateMacAddress(0, randomized);
+    std::vector<uint8_t> mac_addr1 = tc.generateMacAddress(1, randomized);
+
+    // The response to another client is ignored.
+    Pkt4Ptr offer = createOfferPkt4(1);
+    offer->setHWAddr(HTYPE_ETHER, mac_addr1.size(), mac_addr1);
+    ASSERT_NO_THROW(tc.processReceivedPacket4(sock, offer));
+    EXPECT_EQ(ClientPopulation::SELECTING, tc.population_->getState(0));
+
+    // DHCPOFFER makes the client send DHCPREQUEST.
+    offer->setHWAddr(HTYPE_ETHER, mac_addr0.size(), mac_addr0);
+    ASSERT_NO_THROW(tc.processReceivedPacket4(sock, offer));
+    EXPECT_EQ(ClientPopulation::REQUESTING, tc.population_->getState(0));
+
+    // DHCPACK binds the client.
+    Pkt4Ptr ack = createAckPkt4(1);
+    ack->setHWAddr(HTYPE_ETHER, mac_addr0.size(), mac_addr0);
+    ack->addOption(OptionPtr(new OptionUint32(Option::V4, DHO_DHCP_LEASE_TIME,
+                                              1000)));
+    const ptime now = microsec_clock::universal_time();
+    ASSERT_NO_THROW(tc.processReceivedPacket4(sock, ack));
+    EXPECT_EQ(ClientPopulation::BOUND, tc.population_->getState(0));
+    time_duration rebind = tc.population_->getRebindTime(0) - now;
+    EXPECT_NEAR(875, rebind.total_milliseconds() / 1000., 1);
+
+    // The client renews the lease at T1.
+    ASSERT_NO_THROW(tc.processClientTimer(sock, 0));
+    EXPECT_EQ(ClientPopulation::RENEWING, tc.population_->getState(0));
+    EXPECT_EQ(1, tc.getSentPacketsNum(TestControl::StatsMgr4::XCHG_RNA));
+
+    // The second client sends DHCPDISCOVER and its DHCPREQUEST is refused.
+    const uint32_t transid = generator->getNext();
+    ASSERT_NO_THROW(tc.sendLifecycleMessages(sock, 1));
+    EXPECT_EQ(ClientPopulation::SELECTING, tc.population_->getState(1));
+    offer = createOfferPkt4(transid);
+    offer->setHWAddr(HTYPE_ETHER, mac_addr1.size(), mac_addr1);
+    ASSERT_NO_THROW(tc.processReceivedPacket4(sock, offer));
+    EXPECT_EQ(ClientPopulation::REQUESTING, tc.population_->getState(1));
+    Pkt4Ptr nak = createResponsePkt4(DHCPNAK, transid);
+    nak->setHWAddr(HTYPE_ETHER, mac_addr1.size(), mac_addr1);
+    ASSERT_NO_THROW(tc.processReceivedPacket4(sock, nak));
+    EXPECT_EQ(ClientPopulation::INIT, tc.population_->getState(1));
+}
+
 // This test verifies that the current timeout value for waiting for
 // the server's responses is valid. The timeout value corresponds to the
 // time period between now and the next message to be sent from the
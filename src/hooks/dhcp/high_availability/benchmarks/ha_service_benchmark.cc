@@ -0,0 +1,341 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/asio_wrapper.h>
+#include <benchmark/benchmark.h>
+#include <ha_config.h>
+#include <ha_config_parser.h>
+#include <ha_service.h>
+#include <ha_service_states.h>
+#include <asiolink/io_address.h>
+#include <asiolink/io_service.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/hwaddr.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/network_state.h>
+#include <hooks/parking_lots.h>
+#include <http/listener.h>
+#include <http/post_request_json.h>
+#include <http/response_creator.h>
+#include <http/response_creator_factory.h>
+#include <http/response_json.h>
+
+#include <boost/pointer_cast.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::ha;
+using namespace isc::hooks;
+using namespace isc::http;
+
+namespace {
+
+/// @brief IP address to which the partner's HTTP service is bound.
+const char* PARTNER_ADDRESS = "127.0.0.1";
+
+/// @brief Port number to which the partner's HTTP service is bound.
+const unsigned short PARTNER_PORT = 18224;
+
+/// @brief Number of the queries which lease updates are sent in each
+/// iteration.
+const int QUERIES_PER_ITERATION = 100;
+
+/// @brief Request and idle timeout of the partner's HTTP service (ms).
+const long PARTNER_TIMEOUT = 10000;
+
+/// @brief Derivation of the @c HAService which provides access to
+/// protected methods and members.
+///
+/// The state machine is not run when the lease updates complete, so the
+/// service remains in the load balancing state.
+class BenchmarkHAService : public HAService {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param io_service Pointer to the IO service used by the DHCP server.
+    /// @param network_state Object holding state of the DHCP service
+    /// (enabled/disabled).
+    /// @param config Parsed HA hook library configuration.
+    BenchmarkHAService(const IOServicePtr& io_service,
+                       const NetworkStatePtr& network_state,
+                       const HAConfigPtr& config)
+        : HAService(io_service, network_state, config) {
+    }
+
+    /// @brief Does not run the state machine.
+    virtual void runModel(unsigned int) {
+    }
+
+    using HAService::transition;
+    using HAService::pending_requests_;
+};
+
+/// @brief HTTP response creator of the partner.
+///
+/// It answers all commands successfully and counts the received requests.
+class PartnerResponseCreator : public HttpResponseCreator {
+public:
+
+    /// @brief Constructor.
+    PartnerResponseCreator()
+        : requests_(0) {
+    }
+
+    /// @brief Returns the number of received requests.
+    uint64_t getRequests() const {
+        return (requests_);
+    }
+
+    /// @brief Create a new request.
+    ///
+    /// @return Pointer to the new instance of the @ref HttpRequest.
+    virtual HttpRequestPtr
+    createNewHttpRequest() const {
+        return (HttpRequestPtr(new PostHttpRequestJson()));
+    }
+
+    /// @brief Creates HTTP response.
+    ///
+    /// @param request Pointer to the HTTP request.
+    /// @param status_code Status code of the response.
+    /// @return Pointer to the generated HTTP response.
+    virtual HttpResponsePtr
+    createStockHttpResponse(const ConstHttpRequestPtr& request,
+                            const HttpStatusCode& status_code) const {
+        HttpVersion http_version(request->context()->http_version_major_,
+                                 request->context()->http_version_minor_);
+        HttpResponseJsonPtr response(new HttpResponseJson(http_version, status_code));
+        response->finalize();
+        return (response);
+    }
+
+protected:
+
+    /// @brief Creates HTTP response holding a successful answer.
+    ///
+    /// @param request Pointer to the HTTP request.
+    /// @return Pointer to the generated HTTP OK response.
+    virtual HttpResponsePtr
+    createDynamicHttpResponse(const ConstHttpRequestPtr& request) {
+        ++requests_;
+        HttpResponseJsonPtr response(new HttpResponseJson(request->getHttpVersion(),
+                                                          HttpStatusCode::OK));
+        ElementPtr response_body = Element::createList();
+        response_body->add(boost::const_pointer_cast<Element>
+                           (createAnswer(CONTROL_RESULT_SUCCESS, "applied")));
+        response->setBodyAsJson(response_body);
+        response->finalize();
+        return (response);
+    }
+
+private:
+
+    /// @brief Number of received requests.
+    uint64_t requests_;
+};
+
+/// @brief Pointer to the @c PartnerResponseCreator.
+typedef boost::shared_ptr<PartnerResponseCreator> PartnerResponseCreatorPtr;
+
+/// @brief Factory returning the same @c PartnerResponseCreator instance.
+class PartnerResponseCreatorFactory : public HttpResponseCreatorFactory {
+public:
+
+    /// @brief Constructor.
+    PartnerResponseCreatorFactory()
+        : creator_(new PartnerResponseCreator()) {
+    }
+
+    /// @brief Returns the response creator.
+    virtual HttpResponseCreatorPtr create() const {
+        return (creator_);
+    }
+
+    /// @brief Returns the response creator.
+    PartnerResponseCreatorPtr getResponseCreator() const {
+        return (creator_);
+    }
+
+private:
+
+    /// @brief Pointer to the response creator.
+    PartnerResponseCreatorPtr creator_;
+};
+
+/// @brief Pointer to the @c PartnerResponseCreatorFactory.
+typedef boost::shared_ptr<PartnerResponseCreatorFactory>
+PartnerResponseCreatorFactoryPtr;
+
+/// @brief Creates the HA configuration of the load balancing pair.
+///
+/// The heartbeats are disabled so as only the lease updates are sent
+/// to the partner.
+///
+/// @param batch_size Maximum number of leases in a batch or zero to send
+/// a command for each lease.
+ConstElementPtr
+createConfig(const int batch_size) {
+    std::ostringstream s;
+    s << "[ { \"this-server-name\": \"server1\","
+      << " \"mode\": \"load-balancing\","
+      << " \"heartbeat-delay\": 0,"
+      << " \"lease-updates-batch-size\": " << batch_size << ","
+      << " \"peers\": ["
+      << " { \"name\": \"server1\", \"url\": \"http://" << PARTNER_ADDRESS
+      << ":" << (PARTNER_PORT - 1) << "/\", \"role\": \"primary\" },"
+      << " { \"name\": \"server2\", \"url\": \"http://" << PARTNER_ADDRESS
+      << ":" << PARTNER_PORT << "/\", \"role\": \"secondary\" } ] } ]";
+    return (Element::fromJSON(s.str()));
+}
+
+/// @brief Fixture class benchmarking the HA lease updates.
+///
+/// The service sends the lease updates to the partner served by an HTTP
+/// listener running on the same IO service. The benchmark argument is
+/// the batch size, zero disabling the batching.
+class HAServiceBenchmark : public ::benchmark::Fixture {
+public:
+
+    /// @brief Creates the partner and the HA service.
+    ///
+    /// @param state Benchmark state, the first argument is the batch size.
+    void SetUp(::benchmark::State const& state) override {
+        io_service_.reset(new IOService());
+        factory_.reset(new PartnerResponseCreatorFactory());
+        listener_.reset(new HttpListener(*io_service_, IOAddress(PARTNER_ADDRESS),
+                                         PARTNER_PORT, factory_,
+                                         HttpListener::RequestTimeout(PARTNER_TIMEOUT),
+                                         HttpListener::IdleTimeout(PARTNER_TIMEOUT)));
+        listener_->start();
+
+        HAConfigPtr config(new HAConfig());
+        HAConfigParser parser;
+        parser.parse(config, createConfig(static_cast<int>(state.range(0))));
+
+        NetworkStatePtr network_state(new NetworkState(NetworkState::DHCPv4));
+        service_.reset(new BenchmarkHAService(io_service_, network_state, config));
+        service_->transition(HA_LOAD_BALANCING_ST, HAService::NOP_EVT);
+
+        createQueries();
+    }
+
+    /// @brief Destroys the service and stops the partner.
+    void TearDown(::benchmark::State const&) override {
+        queries_.clear();
+        leases_.clear();
+        service_.reset();
+        listener_->stop();
+        io_service_->get_io_service().reset();
+        io_service_->poll();
+        listener_.reset();
+        factory_.reset();
+        io_service_.reset();
+    }
+
+    /// @brief Creates the queries, each allocating a lease.
+    void createQueries() {
+        for (int i = 0; i < QUERIES_PER_ITERATION; ++i) {
+            queries_.push_back(Pkt4Ptr(new Pkt4(DHCPREQUEST, i)));
+            HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, i), HTYPE_ETHER));
+            Lease4CollectionPtr leases(new Lease4Collection());
+            leases->push_back(Lease4Ptr(new Lease4(IOAddress(0xC0000200 + i), hwaddr,
+                                                   static_cast<const uint8_t*>(0), 0,
+                                                   60, 30, 40, 0, 1)));
+            leases_.push_back(leases);
+        }
+    }
+
+    /// @brief Benchmarks the lease updates.
+    ///
+    /// Each iteration sends the lease updates of all queries and waits
+    /// until all queries are unparked. The items per second are the lease
+    /// updates acknowledged by the partner per second. The number of HTTP
+    /// requests per update is reported in the requests/update counter.
+    ///
+    /// @param state Benchmark state.
+    void benchUpdates(::benchmark::State& state) {
+        Lease4CollectionPtr deleted_leases(new Lease4Collection());
+        ParkingLotPtr parking_lot(new ParkingLot());
+        ParkingLotHandlePtr parking_lot_handle(new ParkingLotHandle(parking_lot));
+        uint64_t unparked = 0;
+        while (state.KeepRunning()) {
+            for (size_t i = 0; i < queries_.size(); ++i) {
+                if (service_->asyncSendLeaseUpdates(queries_[i], leases_[i],
+                                                    deleted_leases,
+                                                    parking_lot_handle) == 0) {
+                    state.SkipWithError("no lease updates sent");
+                    return;
+                }
+                parking_lot->reference(queries_[i]);
+                parking_lot->park(queries_[i], [&unparked] {
+                    ++unparked;
+                });
+            }
+            io_service_->get_io_service().reset();
+            while (!service_->pending_requests_.empty()) {
+                io_service_->run_one();
+            }
+        }
+        const uint64_t updates = state.iterations() * queries_.size();
+        if (unparked != updates) {
+            state.SkipWithError("some lease updates failed");
+            return;
+        }
+        state.SetItemsProcessed(updates);
+        state.counters["requests/update"] =
+            static_cast<double>(factory_->getResponseCreator()->getRequests()) /
+            updates;
+    }
+
+protected:
+
+    /// @brief IO service shared by the HA service and the partner.
+    IOServicePtr io_service_;
+
+    /// @brief Factory of the partner's response creator.
+    PartnerResponseCreatorFactoryPtr factory_;
+
+    /// @brief HTTP listener of the partner.
+    boost::scoped_ptr<HttpListener> listener_;
+
+    /// @brief Benchmarked HA service.
+    boost::scoped_ptr<BenchmarkHAService> service_;
+
+    /// @brief Queries which lease updates are sent.
+    std::vector<Pkt4Ptr> queries_;
+
+    /// @brief Leases allocated by the queries.
+    std::vector<Lease4CollectionPtr> leases_;
+};
+
+}
+
+/// @brief Benchmarks sending the DHCPv4 lease updates to the partner.
+///
+/// The argument is the batch size. With zero, a lease4-update command is
+/// sent for each lease. Otherwise, the leases are sent in lease4-bulk-apply
+/// commands.
+BENCHMARK_DEFINE_F(HAServiceBenchmark, leaseUpdates4)(::benchmark::State& state) {
+    benchUpdates(state);
+}
+
+BENCHMARK_REGISTER_F(HAServiceBenchmark, leaseUpdates4)->Arg(0)->Arg(10)->Arg(100)
+    ->Unit(::benchmark::kMicrosecond);
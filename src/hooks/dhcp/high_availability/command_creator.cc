@@ -11,6 +11,7 @@
 #include <exceptions/exceptions.h>
 #include <boost/pointer_cast.hpp>
 
+using namespace isc::asiolink;
 using namespace isc::data;
 using namespace isc::dhcp;
 
@@ -64,6 +65,17 @@ CommandCreator::createLease4Delete(const Lease4& lease4) {
     return (command);
 }
 
+ConstElementPtr
+CommandCreator::createLease4BulkApply(const Lease4Collection& leases,
+                                      const Lease4Collection& deleted_leases) {
+    ElementPtr args = Element::createMap();
+    args->set("leases", leasesToElement(leases));
+    args->set("deleted-leases", deletedLeasesToElement(deleted_leases));
+    ConstElementPtr command = config::createCommand("lease4-bulk-apply", args);
+    insertService(command, HAServerType::DHCPv4);
+    return (command);
+}
+
 ConstElementPtr
 CommandCreator::createLease4GetAll() {
     ConstElementPtr command = config::createCommand("lease4-get-all");
@@ -71,6 +83,16 @@ CommandCreator::createLease4GetAll() {
     return (command);
 }
 
+ConstElementPtr
+CommandCreator::createLease4GetPage(const IOAddress& from_address,
+                                    const uint32_t limit) {
+    ConstElementPtr command = config::createCommand("lease4-get-page",
+                                                    getPageArguments(from_address,
+                                                                     limit));
+    insertService(command, HAServerType::DHCPv4);
+    return (command);
+}
+
 ConstElementPtr
 CommandCreator::createLease6Update(const Lease6& lease6) {
     ElementPtr lease_as_json = lease6.toElement();
@@ -90,6 +112,17 @@ CommandCreator::createLease6Delete(const Lease6& lease6) {
     return (command);
 }
 
+ConstElementPtr
+CommandCreator::createLease6BulkApply(const Lease6Collection& leases,
+                                      const Lease6Collection& deleted_leases) {
+    ElementPtr args = Element::createMap();
+    args->set("leases", leasesToElement(leases));
+    args->set("deleted-leases", deletedLeasesToElement(deleted_leases));
+    ConstElementPtr command = config::createCommand("lease6-bulk-apply", args);
+    insertService(command, HAServerType::DHCPv6);
+    return (command);
+}
+
 ConstElementPtr
 CommandCreator::createLease6GetAll() {
     ConstElementPtr command = config::createCommand("lease6-get-all");
@@ -97,6 +130,56 @@ CommandCreator::createLease6GetAll() {
     return (command);
 }
 
+ConstElementPtr
+CommandCreator::createLease6GetPage(const IOAddress& from_address,
+                                    const uint32_t limit) {
+    ConstElementPtr command = config::createCommand("lease6-get-page",
+                                                    getPageArguments(from_address,
+                                                                     limit));
+    insertService(command, HAServerType::DHCPv6);
+    return (command);
+}
+
+ElementPtr
+CommandCreator::getPageArguments(const IOAddress& from_address,
+                                 const uint32_t limit) {
+    ElementPtr args = Element::createMap();
+    // The zero address denotes the first page.
+    if (from_address.isV4Zero() || from_address.isV6Zero()) {
+        args->set("from", Element::create("start"));
+
+    } else {
+        args->set("from", Element::create(from_address.toText()));
+    }
+    args->set("limit", Element::create(static_cast<long long int>(limit)));
+    return (args);
+}
+
+template<typename LeaseCollectionType>
+ElementPtr
+CommandCreator::leasesToElement(const LeaseCollectionType& leases) {
+    ElementPtr leases_as_json = Element::createList();
+    for (auto l = leases.begin(); l != leases.end(); ++l) {
+        ElementPtr lease_as_json = (*l)->toElement();
+        insertLeaseExpireTime(lease_as_json);
+        lease_as_json->set("force-create", Element::create(true));
+        leases_as_json->add(lease_as_json);
+    }
+    return (leases_as_json);
+}
+
+template<typename LeaseCollectionType>
+ElementPtr
+CommandCreator::deletedLeasesToElement(const LeaseCollectionType& leases) {
+    ElementPtr leases_as_json = Element::createList();
+    for (auto l = leases.begin(); l != leases.end(); ++l) {
+        ElementPtr lease_as_json = Element::createMap();
+        lease_as_json->set("ip-address", Element::create((*l)->addr_.toText()));
+        leases_as_json->add(lease_as_json);
+    }
+    return (leases_as_json);
+}
+
 void
 CommandCreator::insertLeaseExpireTime(ElementPtr& lease) {
     if ((lease->getType() != Element::map) ||
@@ -8,8 +8,10 @@
 #define HA_COMMAND_CREATOR_H
 
 #include <ha_server_type.h>
+#include <asiolink/io_address.h>
 #include <cc/data.h>
 #include <dhcpsrv/lease.h>
+#include <stdint.h>
 #include <string>
 
 namespace isc {
@@ -61,12 +63,37 @@ public:
     static data::ConstElementPtr
     createLease4Delete(const dhcp::Lease4& lease4);
 
+    /// @brief Creates lease4-bulk-apply command.
+    ///
+    /// The updated leases include the "force-create" parameter. The deleted
+    /// leases are specified by their addresses only.
+    ///
+    /// @param leases Collection of the new or updated leases.
+    /// @param deleted_leases Collection of the deleted leases.
+    ///
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease4BulkApply(const dhcp::Lease4Collection& leases,
+                          const dhcp::Lease4Collection& deleted_leases);
+
     /// @brief Creates lease4-get-all command.
     ///
     /// @return Pointer to the JSON representation of the command.
     static data::ConstElementPtr
     createLease4GetAll();
 
+    /// @brief Creates lease4-get-page command.
+    ///
+    /// @param from_address Address of the last lease fetched in the previous
+    /// page. The returned page starts after this address. If it is an
+    /// IPv4 zero address, the first page is fetched.
+    /// @param limit Maximum number of leases in the page.
+    ///
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease4GetPage(const asiolink::IOAddress& from_address,
+                        const uint32_t limit);
+
     /// @brief Creates lease6-update command.
     ///
     /// It adds "force-create" parameter to the lease information to force
@@ -89,14 +116,51 @@ public:
     static data::ConstElementPtr
     createLease6Delete(const dhcp::Lease6& lease6);
 
+    /// @brief Creates lease6-bulk-apply command.
+    ///
+    /// The updated leases include the "force-create" parameter. The deleted
+    /// leases are specified by their addresses only.
+    ///
+    /// @param leases Collection of the new or updated leases.
+    /// @param deleted_leases Collection of the deleted leases.
+    ///
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease6BulkApply(const dhcp::Lease6Collection& leases,
+                          const dhcp::Lease6Collection& deleted_leases);
+
     /// @brief Creates lease6-get-all command.
     ///
     /// @return Pointer to the JSON representation of the command.
     static data::ConstElementPtr
     createLease6GetAll();
 
+    /// @brief Creates lease6-get-page command.
+    ///
+    /// @param from_address Address of the last lease fetched in the previous
+    /// page. The returned page starts after this address. If it is an
+    /// IPv6 zero address, the first page is fetched.
+    /// @param limit Maximum number of leases in the page.
+    ///
+    /// @return Pointer to the JSON representation of the command.
+    static data::ConstElementPtr
+    createLease6GetPage(const asiolink::IOAddress& from_address,
+                        const uint32_t limit);
+
 private:
 
+    /// @brief Creates arguments of the lease4-get-page and lease6-get-page
+    /// commands.
+    ///
+    /// @param from_address Address of the last lease fetched in the previous
+    /// page or zero address to fetch the first page.
+    /// @param limit Maximum number of leases in the page.
+    ///
+    /// @return Pointer to the arguments map.
+    static data::ElementPtr
+    getPageArguments(const asiolink::IOAddress& from_address,
+                     const uint32_t limit);
+
     /// @brief Replaces "cltt" with "expire" value within the lease.
     ///
     /// The "lease_cmds" hooks library expects "expire" time to be provided
@@ -110,6 +174,27 @@ private:
     /// method.
     static void insertLeaseExpireTime(data::ElementPtr& lease);
 
+    /// @brief Converts the collection of leases to the list included in
+    /// the bulk apply command.
+    ///
+    /// @param leases Collection of the new or updated leases.
+    /// @tparam LeaseCollectionType Lease4Collection or Lease6Collection.
+    ///
+    /// @return List of leases in the JSON format with the "expire" time and
+    /// the "force-create" flag.
+    template<typename LeaseCollectionType>
+    static data::ElementPtr leasesToElement(const LeaseCollectionType& leases);
+
+    /// @brief Converts the collection of deleted leases to the list included
+    /// in the bulk apply command.
+    ///
+    /// @param leases Collection of the deleted leases.
+    /// @tparam LeaseCollectionType Lease4Collection or Lease6Collection.
+    ///
+    /// @return List of maps holding the addresses of the leases.
+    template<typename LeaseCollectionType>
+    static data::ElementPtr deletedLeasesToElement(const LeaseCollectionType& leases);
+
     /// @brief Sets "service" parameter for the command.
     ///
     /// Commands generated by the HA hooks library are always sent to
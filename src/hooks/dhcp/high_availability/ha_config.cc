@@ -139,7 +139,10 @@ HAConfig::StateMachineConfig::getStateConfig(const int state) {
 
 HAConfig::HAConfig()
     : this_server_name_(), ha_mode_(HOT_STANDBY), send_lease_updates_(true),
-      sync_leases_(true), sync_timeout_(60000), heartbeat_delay_(10000),
+      lease_updates_batch_size_(0), lease_updates_flush_interval_(10),
+      sync_leases_(true), sync_timeout_(60000), sync_page_limit_(10000),
+      http_max_connections_(1), http_idle_timeout_(25000),
+      heartbeat_delay_(10000),
       max_response_delay_(60000), max_ack_delay_(10000), max_unacked_clients_(10),
       peers_(), state_machine_(new StateMachineConfig()) {
 }
@@ -247,6 +250,22 @@ HAConfig::validate() const {
                   << getThisServerName() << "'");
     }
 
+    // Lease updates can't be held in a batch indefinitely.
+    if ((lease_updates_batch_size_ > 0) && (lease_updates_flush_interval_ == 0)) {
+        isc_throw(HAConfigValidationError, "'lease-updates-flush-interval' must"
+                  " be greater than 0 when lease updates batching is enabled");
+    }
+
+    // Leases are fetched from the partner in pages.
+    if (sync_page_limit_ == 0) {
+        isc_throw(HAConfigValidationError, "'sync-page-limit' must be greater than 0");
+    }
+
+    // At least one connection to each peer is required.
+    if (http_max_connections_ == 0) {
+        isc_throw(HAConfigValidationError, "'http-max-connections' must be greater than 0");
+    }
+
     // Gather all the roles and see how many occurrences of each role we get.
     std::map<PeerConfig::Role, unsigned> peers_cnt;
     for (auto p = peers_.begin(); p != peers_.end(); ++p) {
@@ -315,6 +315,42 @@ public:
         send_lease_updates_ = send_lease_updates;
     }
 
+    /// @brief Returns maximum number of leases sent to a peer in a single
+    /// lease update command.
+    ///
+    /// A value of zero disables batching, i.e. a separate command is sent
+    /// for each lease.
+    uint32_t getLeaseUpdatesBatchSize() const {
+        return (lease_updates_batch_size_);
+    }
+
+    /// @brief Sets maximum number of leases sent to a peer in a single
+    /// lease update command.
+    ///
+    /// When batching is enabled, the lease updates resulting from processing
+    /// multiple DHCP queries are coalesced into a single bulk apply command.
+    /// The command is sent when the number of leases reaches this value or
+    /// when the flush interval elapses, whichever comes first.
+    ///
+    /// @param batch_size new batch size or zero to disable batching.
+    void setLeaseUpdatesBatchSize(const uint32_t batch_size) {
+        lease_updates_batch_size_ = batch_size;
+    }
+
+    /// @brief Returns maximum time in milliseconds for which the lease
+    /// updates are held before they are sent to a peer in a batch.
+    uint32_t getLeaseUpdatesFlushInterval() const {
+        return (lease_updates_flush_interval_);
+    }
+
+    /// @brief Sets maximum time in milliseconds for which the lease
+    /// updates are held before they are sent to a peer in a batch.
+    ///
+    /// @param flush_interval new flush interval in milliseconds.
+    void setLeaseUpdatesFlushInterval(const uint32_t flush_interval) {
+        lease_updates_flush_interval_ = flush_interval;
+    }
+
     /// @brief Returns boolean flag indicating whether the active servers
     /// should synchronize their lease databases upon startup.
     bool amSyncingLeases() const {
@@ -348,6 +384,57 @@ public:
         sync_timeout_ = sync_timeout;
     }
 
+    /// @brief Returns maximum number of leases fetched from the partner
+    /// in a single page during lease database synchronization.
+    ///
+    /// @return Maximum number of leases in a page.
+    uint32_t getSyncPageLimit() const {
+        return (sync_page_limit_);
+    }
+
+    /// @brief Sets new maximum number of leases fetched from the partner
+    /// in a single page during lease database synchronization.
+    ///
+    /// @param sync_page_limit new page size.
+    void setSyncPageLimit(const uint32_t sync_page_limit) {
+        sync_page_limit_ = sync_page_limit;
+    }
+
+    /// @brief Returns maximum number of simultaneous connections to each
+    /// peer.
+    ///
+    /// The lease updates are sent over multiple connections in parallel.
+    ///
+    /// @return Maximum number of connections.
+    uint16_t getHttpMaxConnections() const {
+        return (http_max_connections_);
+    }
+
+    /// @brief Sets new maximum number of simultaneous connections to each
+    /// peer.
+    ///
+    /// @param http_max_connections new maximum number of connections.
+    void setHttpMaxConnections(const uint16_t http_max_connections) {
+        http_max_connections_ = http_max_connections;
+    }
+
+    /// @brief Returns timeout after which an idle connection to a peer
+    /// is closed.
+    ///
+    /// @return Timeout in milliseconds. The value of 0 means that the idle
+    /// connections are not closed by this server.
+    uint32_t getHttpIdleTimeout() const {
+        return (http_idle_timeout_);
+    }
+
+    /// @brief Sets new timeout after which an idle connection to a peer
+    /// is closed.
+    ///
+    /// @param http_idle_timeout new timeout in milliseconds.
+    void setHttpIdleTimeout(const uint32_t http_idle_timeout) {
+        http_idle_timeout_ = http_idle_timeout;
+    }
+
     /// @brief Returns heartbeat delay in milliseconds.
     ///
     /// This value indicates the delay in sending a heartbeat command after
@@ -477,8 +564,13 @@ public:
     std::string this_server_name_;        ///< This server name.
     HAMode ha_mode_;                      ///< Mode of operation.
     bool send_lease_updates_;             ///< Send lease updates to partner?
+    uint32_t lease_updates_batch_size_;   ///< Max number of leases in a batch.
+    uint32_t lease_updates_flush_interval_; ///< Max batching delay (ms).
     bool sync_leases_;                    ///< Synchronize databases on startup?
     uint32_t sync_timeout_;               ///< Timeout for syncing lease database (ms)
+    uint32_t sync_page_limit_;            ///< Leases fetched in a single page.
+    uint16_t http_max_connections_;       ///< Max connections to each peer.
+    uint32_t http_idle_timeout_;          ///< Idle connection timeout (ms).
     uint32_t heartbeat_delay_;            ///< Heartbeat delay in milliseconds.
     uint32_t max_response_delay_;         ///< Max delay in response to heartbeats.
     uint32_t max_ack_delay_;              ///< Maximum DHCP message ack delay.
@@ -21,8 +21,13 @@ namespace {
 /// @brief Default values for HA configuration.
 const SimpleDefaults HA_CONFIG_DEFAULTS = {
     { "send-lease-updates", Element::boolean, "true" },
+    { "lease-updates-batch-size", Element::integer, "0" },
+    { "lease-updates-flush-interval", Element::integer, "10" },
     { "sync-leases", Element::boolean, "true" },
     { "sync-timeout", Element::integer, "60000" },
+    { "sync-page-limit", Element::integer, "10000" },
+    { "http-max-connections", Element::integer, "1" },
+    { "http-idle-timeout", Element::integer, "25000" },
     { "heartbeat-delay", Element::integer, "10000" },
     { "max-response-delay", Element::integer, "60000" },
     { "max-ack-delay", Element::integer, "10000" },
@@ -129,6 +134,14 @@ HAConfigParser::parseInternal(const HAConfigPtr& config_storage,
     // Get 'send-lease-updates'.
     config_storage->setSendLeaseUpdates(getBoolean(c, "send-lease-updates"));
 
+    // Get 'lease-updates-batch-size'.
+    uint32_t batch_size = getAndValidateInteger<uint32_t>(c, "lease-updates-batch-size");
+    config_storage->setLeaseUpdatesBatchSize(batch_size);
+
+    // Get 'lease-updates-flush-interval'.
+    uint32_t flush_interval = getAndValidateInteger<uint32_t>(c, "lease-updates-flush-interval");
+    config_storage->setLeaseUpdatesFlushInterval(flush_interval);
+
     // Get 'sync-leases'.
     config_storage->setSyncLeases(getBoolean(c, "sync-leases"));
 
@@ -136,6 +149,18 @@ HAConfigParser::parseInternal(const HAConfigPtr& config_storage,
     uint32_t sync_timeout = getAndValidateInteger<uint32_t>(c, "sync-timeout");
     config_storage->setSyncTimeout(sync_timeout);
 
+    // Get 'sync-page-limit'.
+    uint32_t sync_page_limit = getAndValidateInteger<uint32_t>(c, "sync-page-limit");
+    config_storage->setSyncPageLimit(sync_page_limit);
+
+    // Get 'http-max-connections'.
+    uint16_t http_max_connections = getAndValidateInteger<uint16_t>(c, "http-max-connections");
+    config_storage->setHttpMaxConnections(http_max_connections);
+
+    // Get 'http-idle-timeout'.
+    uint32_t http_idle_timeout = getAndValidateInteger<uint32_t>(c, "http-idle-timeout");
+    config_storage->setHttpIdleTimeout(http_idle_timeout);
+
     // Get 'heartbeat-delay'.
     uint16_t heartbeat_delay = getAndValidateInteger<uint16_t>(c, "heartbeat-delay");
     config_storage->setHeartbeatDelay(heartbeat_delay);
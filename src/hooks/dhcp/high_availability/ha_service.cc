@@ -17,11 +17,13 @@
 #include <http/date_time.h>
 #include <http/response_json.h>
 #include <http/post_request_json.h>
+#include <stats/stats_mgr.h>
 #include <util/stopwatch.h>
 #include <boost/pointer_cast.hpp>
 #include <boost/bind.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/weak_ptr.hpp>
+#include <set>
 #include <sstream>
 
 using namespace isc::asiolink;
@@ -31,8 +33,105 @@ using namespace isc::dhcp;
 using namespace isc::hooks;
 using namespace isc::http;
 using namespace isc::log;
+using namespace isc::stats;
 using namespace isc::util;
 
+namespace {
+
+/// @brief Returns the addresses of the leases.
+///
+/// @param leases Collection of the new or updated leases.
+/// @param deleted_leases Collection of the deleted leases.
+/// @tparam LeaseCollectionPtrType Lease4CollectionPtr or Lease6CollectionPtr.
+///
+/// @return Addresses of the leases in the textual form.
+template<typename LeaseCollectionPtrType>
+std::vector<std::string>
+getLeasesAddresses(const LeaseCollectionPtrType& leases,
+                   const LeaseCollectionPtrType& deleted_leases) {
+    std::vector<std::string> addresses;
+    addresses.reserve(leases->size() + deleted_leases->size());
+    for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
+        addresses.push_back((*l)->addr_.toText());
+    }
+    for (auto l = leases->begin(); l != leases->end(); ++l) {
+        addresses.push_back((*l)->addr_.toText());
+    }
+    return (addresses);
+}
+
+/// @brief Adds the lease updates resulting from processing a query to
+/// a batch.
+///
+/// The batch holds only the last operation for each address, so an
+/// update replaces an earlier deletion of the same lease and vice versa.
+///
+/// @param leases Collection of the new or updated leases.
+/// @param deleted_leases Collection of the deleted leases.
+/// @param [out] batch_leases Updated leases in the batch by addresses.
+/// @param [out] batch_deleted_leases Deleted leases in the batch by addresses.
+template<typename LeaseCollectionPtrType, typename LeaseMapType>
+void
+batchLeaseUpdates(const LeaseCollectionPtrType& leases,
+                  const LeaseCollectionPtrType& deleted_leases,
+                  LeaseMapType& batch_leases,
+                  LeaseMapType& batch_deleted_leases) {
+    // The leases are deleted before the new leases are applied, as
+    // when the lease updates are sent one by one.
+    for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
+        const std::string address = (*l)->addr_.toText();
+        batch_leases.erase(address);
+        batch_deleted_leases[address] = *l;
+    }
+    for (auto l = leases->begin(); l != leases->end(); ++l) {
+        const std::string address = (*l)->addr_.toText();
+        batch_deleted_leases.erase(address);
+        batch_leases[address] = *l;
+    }
+}
+
+/// @brief Returns a collection of the leases held in a batch.
+///
+/// @param batch_leases Leases in the batch by addresses.
+/// @return Collection of the leases.
+template<typename LeaseCollectionType, typename LeaseMapType>
+LeaseCollectionType
+getBatchedLeases(const LeaseMapType& batch_leases) {
+    LeaseCollectionType leases;
+    leases.reserve(batch_leases.size());
+    for (auto l = batch_leases.begin(); l != batch_leases.end(); ++l) {
+        leases.push_back(l->second);
+    }
+    return (leases);
+}
+
+/// @brief Returns the addresses of the leases held in a batch.
+///
+/// @param batch_leases Updated leases in the batch by addresses.
+/// @param batch_deleted_leases Deleted leases in the batch by addresses.
+/// @return Addresses of the leases.
+template<typename LeaseMapType>
+std::vector<std::string>
+getBatchedAddresses(const LeaseMapType& batch_leases,
+                    const LeaseMapType& batch_deleted_leases) {
+    std::vector<std::string> addresses;
+    addresses.reserve(batch_leases.size() + batch_deleted_leases.size());
+    for (auto l = batch_deleted_leases.begin(); l != batch_deleted_leases.end();
+         ++l) {
+        addresses.push_back(l->first);
+    }
+    for (auto l = batch_leases.begin(); l != batch_leases.end(); ++l) {
+        addresses.push_back(l->first);
+    }
+    return (addresses);
+}
+
+/// @brief Maximum number of attempts to fetch a page of leases again
+/// after a failure during the lease database synchronization.
+const unsigned int SYNC_PAGE_MAX_RETRIES = 3;
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace ha {
 
@@ -44,8 +143,13 @@ const int HAService::HA_SYNCING_SUCCEEDED_EVT;
 HAService::HAService(const IOServicePtr& io_service, const NetworkStatePtr& network_state,
                      const HAConfigPtr& config, const HAServerType& server_type)
     : io_service_(io_service), network_state_(network_state), config_(config),
-      server_type_(server_type), client_(*io_service), communication_state_(),
-      query_filter_(config), pending_requests_() {
+      server_type_(server_type),
+      client_(*io_service, config->getHttpMaxConnections(),
+              config->getHttpIdleTimeout()),
+      communication_state_(),
+      query_filter_(config), pending_requests_(), peer_lease_updates_(),
+      lease_updates_batches_(),
+      lease_updates_timer_(), lease_updates_flush_scheduled_(false) {
 
     if (server_type == HAServerType::DHCPv4) {
         communication_state_.reset(new CommunicationState4(io_service_, config));
@@ -685,15 +789,28 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt4Ptr& query,
         // Count contacted servers.
         ++sent_num;
 
+        // If batching is enabled, the lease updates are held and sent to
+        // the peer along with the lease updates for other queries.
+        if (config_->getLeaseUpdatesBatchSize() > 0) {
+            LeaseUpdatesBatch& batch = lease_updates_batches_[conf->getName()];
+            batchLeaseUpdates(leases, deleted_leases, batch.leases4_,
+                              batch.deleted_leases4_);
+            queueLeaseUpdates(query, conf, getLeasesAddresses(leases, deleted_leases),
+                              parking_lot);
+            continue;
+        }
+
         // Lease updates for deleted leases.
         for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
-            asyncSendLeaseUpdate(query, conf, CommandCreator::createLease4Delete(**l),
+            asyncSendLeaseUpdate(query, conf, (*l)->addr_.toText(),
+                                 CommandCreator::createLease4Delete(**l),
                                  parking_lot);
         }
 
         // Lease updates for new allocations and updated leases.
         for (auto l = leases->begin(); l != leases->end(); ++l) {
-            asyncSendLeaseUpdate(query, conf, CommandCreator::createLease4Update(**l),
+            asyncSendLeaseUpdate(query, conf, (*l)->addr_.toText(),
+                                 CommandCreator::createLease4Update(**l),
                                  parking_lot);
         }
     }
@@ -725,15 +842,28 @@ HAService::asyncSendLeaseUpdates(const dhcp::Pkt6Ptr& query,
         // Count contacted servers.
         ++sent_num;
 
+        // If batching is enabled, the lease updates are held and sent to
+        // the peer along with the lease updates for other queries.
+        if (config_->getLeaseUpdatesBatchSize() > 0) {
+            LeaseUpdatesBatch& batch = lease_updates_batches_[conf->getName()];
+            batchLeaseUpdates(leases, deleted_leases, batch.leases6_,
+                              batch.deleted_leases6_);
+            queueLeaseUpdates(query, conf, getLeasesAddresses(leases, deleted_leases),
+                              parking_lot);
+            continue;
+        }
+
         // Lease updates for deleted leases.
         for (auto l = deleted_leases->begin(); l != deleted_leases->end(); ++l) {
-            asyncSendLeaseUpdate(query, conf, CommandCreator::createLease6Delete(**l),
+            asyncSendLeaseUpdate(query, conf, (*l)->addr_.toText(),
+                                 CommandCreator::createLease6Delete(**l),
                                  parking_lot);
         }
 
         // Lease updates for new allocations and updated leases.
         for (auto l = leases->begin(); l != leases->end(); ++l) {
-            asyncSendLeaseUpdate(query, conf, CommandCreator::createLease6Update(**l),
+            asyncSendLeaseUpdate(query, conf, (*l)->addr_.toText(),
+                                 CommandCreator::createLease6Update(**l),
                                  parking_lot);
         }
     }
@@ -745,6 +875,7 @@ template<typename QueryPtrType>
 void
 HAService::asyncSendLeaseUpdate(const QueryPtrType& query,
                           const HAConfig::PeerConfigPtr& config,
+                          const std::string& address,
                           const ConstElementPtr& command,
                           const ParkingLotHandlePtr& parking_lot) {
     // Create HTTP/1.1 request including our command.
@@ -763,7 +894,8 @@ HAService::asyncSendLeaseUpdate(const QueryPtrType& query,
     boost::weak_ptr<typename QueryPtrType::element_type> weak_query(query);
 
     // Schedule asynchronous HTTP request.
-    client_.asyncSendRequest(config->getUrl(), request, response,
+    asyncSendOrderedLeaseUpdate(config, std::vector<std::string>(1, address),
+                                request, response,
         [this, weak_query, parking_lot, config]
             (const boost::system::error_code& ec,
              const HttpResponsePtr& response,
@@ -813,51 +945,323 @@ HAService::asyncSendLeaseUpdate(const QueryPtrType& query,
                 }
             }
 
-            // We don't care about the result of the lease update to the backup server.
-            // It is a best effort update.
-            if (config->getRole() != HAConfig::PeerConfig::BACKUP) {
-                if (lease_update_success) {
-                    // If the lease update was successful and we have sent it to the server
-                    // to which we also send heartbeats (primary, secondary or standby) we
-                    // can assume that the server is online and we can defer next heartbeat.
-                    communication_state_->poke();
+            leaseUpdateComplete(query, config, parking_lot, lease_update_success);
+        });
 
-                } else {
-                    // Lease update was unsuccessful, so drop the parked DHCP packet.
-                    parking_lot->drop(query);
-                    communication_state_->setPartnerState("unavailable");
-                }
-            }
+    // Request scheduled, so update the request counters for the query.
+    if (pending_requests_.count(query) == 0) {
+        pending_requests_[query] = 1;
+
+    } else {
+        ++pending_requests_[query];
+    }
+}
+
+void
+HAService::asyncSendOrderedLeaseUpdate(const HAConfig::PeerConfigPtr& config,
+                                       const std::vector<std::string>& addresses,
+                                       const HttpRequestPtr& request,
+                                       const HttpResponsePtr& response,
+                                       const HttpClient::RequestHandler& handler) {
+    OrderedLeaseUpdate update;
+    update.addresses_ = addresses;
+    update.request_ = request;
+    update.response_ = response;
+    update.handler_ = handler;
+
+    PeerLeaseUpdates& updates = peer_lease_updates_[config->getName()];
+
+    // Hold the request if any of its leases is being updated or waits to be
+    // updated by an earlier request.
+    std::set<std::string> held_addresses;
+    for (auto h = updates.held_.begin(); h != updates.held_.end(); ++h) {
+        held_addresses.insert(h->addresses_.begin(), h->addresses_.end());
+    }
+    for (auto a = addresses.begin(); a != addresses.end(); ++a) {
+        if ((updates.sent_.count(*a) > 0) || (held_addresses.count(*a) > 0)) {
+            updates.held_.push_back(update);
+            return;
+        }
+    }
+
+    sendOrderedLeaseUpdate(config, update);
+}
 
-            auto it = pending_requests_.find(query);
+void
+HAService::sendOrderedLeaseUpdate(const HAConfig::PeerConfigPtr& config,
+                                  const OrderedLeaseUpdate& update) {
+    PeerLeaseUpdates& updates = peer_lease_updates_[config->getName()];
+    for (auto a = update.addresses_.begin(); a != update.addresses_.end(); ++a) {
+        ++updates.sent_[*a];
+    }
 
-            // If there are no more pending requests for this query, let's unpark
-            // the DHCP packet.
-            if (it == pending_requests_.end() || (--pending_requests_[query] <= 0)) {
-                parking_lot->unpark(query);
+    client_.asyncSendRequest(config->getUrl(), update.request_, update.response_,
+        [this, config, update]
+            (const boost::system::error_code& ec,
+             const HttpResponsePtr& response,
+             const std::string& error_str) {
+            PeerLeaseUpdates& updates = peer_lease_updates_[config->getName()];
+            for (auto a = update.addresses_.begin(); a != update.addresses_.end();
+                 ++a) {
+                auto sent = updates.sent_.find(*a);
+                if ((sent != updates.sent_.end()) && (--sent->second == 0)) {
+                    updates.sent_.erase(sent);
+                }
+            }
 
-                // If we have unparked the packet we can clear pending requests for
-                // this query.
-                if (it != pending_requests_.end()) {
-                    pending_requests_.erase(it);
+            // Send the held requests which no longer wait for other requests,
+            // keeping the order of the requests for each lease.
+            std::vector<OrderedLeaseUpdate> held;
+            held.swap(updates.held_);
+            std::set<std::string> held_addresses;
+            for (auto h = held.begin(); h != held.end(); ++h) {
+                bool ready = true;
+                for (auto a = h->addresses_.begin(); a != h->addresses_.end();
+                     ++a) {
+                    if ((updates.sent_.count(*a) > 0) ||
+                        (held_addresses.count(*a) > 0)) {
+                        ready = false;
+                        break;
+                    }
                 }
+                if (ready) {
+                    sendOrderedLeaseUpdate(config, *h);
 
-                // If we have finished sending the lease updates we need to run the
-                // state machine until the state machine finds that additional events
-                // are required, such as next heartbeat or a lease update. The runModel()
-                // may transition to another state, schedule asynchronous tasks etc.
-                // Then it returns control to the DHCP server.
-                runModel(HA_LEASE_UPDATES_COMPLETE_EVT);
+                } else {
+                    held_addresses.insert(h->addresses_.begin(),
+                                          h->addresses_.end());
+                    updates.held_.push_back(*h);
+                }
             }
+
+            update.handler_(ec, response, error_str);
         });
+}
 
-    // Request scheduled, so update the request counters for the query.
+template<typename QueryPtrType>
+void
+HAService::leaseUpdateComplete(const QueryPtrType& query,
+                               const HAConfig::PeerConfigPtr& config,
+                               const ParkingLotHandlePtr& parking_lot,
+                               const bool success) {
+    // We don't care about the result of the lease update to the backup server.
+    // It is a best effort update.
+    if (config->getRole() != HAConfig::PeerConfig::BACKUP) {
+        if (success) {
+            // If the lease update was successful and we have sent it to the server
+            // to which we also send heartbeats (primary, secondary or standby) we
+            // can assume that the server is online and we can defer next heartbeat.
+            communication_state_->poke();
+
+        } else {
+            // Lease update was unsuccessful, so drop the parked DHCP packet.
+            parking_lot->drop(query);
+            communication_state_->setPartnerState("unavailable");
+        }
+    }
+
+    auto it = pending_requests_.find(query);
+
+    // If there are no more pending requests for this query, let's unpark
+    // the DHCP packet.
+    if (it == pending_requests_.end() || (--pending_requests_[query] <= 0)) {
+        parking_lot->unpark(query);
+
+        // If we have unparked the packet we can clear pending requests for
+        // this query.
+        if (it != pending_requests_.end()) {
+            pending_requests_.erase(it);
+        }
+
+        // If we have finished sending the lease updates we need to run the
+        // state machine until the state machine finds that additional events
+        // are required, such as next heartbeat or a lease update. The runModel()
+        // may transition to another state, schedule asynchronous tasks etc.
+        // Then it returns control to the DHCP server.
+        runModel(HA_LEASE_UPDATES_COMPLETE_EVT);
+    }
+}
+
+template<typename QueryPtrType>
+void
+HAService::queueLeaseUpdates(const QueryPtrType& query,
+                             const HAConfig::PeerConfigPtr& config,
+                             const std::vector<std::string>& addresses,
+                             const ParkingLotHandlePtr& parking_lot) {
+    LeaseUpdatesBatch& batch = lease_updates_batches_[config->getName()];
+
+    // See asyncSendLeaseUpdate for the reasons to use the weak pointer.
+    boost::weak_ptr<typename QueryPtrType::element_type> weak_query(query);
+
+    BatchedQuery batched_query;
+    batched_query.addresses_ = addresses;
+    batched_query.complete_ = [this, weak_query, parking_lot, config]
+        (const bool success) {
+        QueryPtrType query = weak_query.lock();
+        if (!query) {
+            isc_throw(Unexpected, "query is null while receiving response from"
+                      " HA peer. This is programmatic error");
+        }
+        leaseUpdateComplete(query, config, parking_lot, success);
+    };
+    batch.queries_.push_back(batched_query);
+    batch.size_ += addresses.size();
+
+    // The whole batch is a single request for each query in it.
     if (pending_requests_.count(query) == 0) {
         pending_requests_[query] = 1;
 
     } else {
         ++pending_requests_[query];
     }
+
+    // Send the batch if it is full. Otherwise, make sure that it is sent
+    // when the flush interval elapses.
+    if (batch.size_ >= config_->getLeaseUpdatesBatchSize()) {
+        asyncSendLeaseUpdatesBatch(config->getName());
+
+    } else if (!lease_updates_flush_scheduled_) {
+        if (!lease_updates_timer_) {
+            lease_updates_timer_.reset(new IntervalTimer(*io_service_));
+        }
+        lease_updates_timer_->setup(boost::bind(&HAService::flushLeaseUpdates, this),
+                                    config_->getLeaseUpdatesFlushInterval(),
+                                    IntervalTimer::ONE_SHOT);
+        lease_updates_flush_scheduled_ = true;
+    }
+}
+
+void
+HAService::asyncSendLeaseUpdatesBatch(const std::string& peer_name) {
+    auto batch_it = lease_updates_batches_.find(peer_name);
+    if ((batch_it == lease_updates_batches_.end()) ||
+        batch_it->second.queries_.empty()) {
+        return;
+    }
+
+    // Take the batch out of the map. New lease updates will be held in
+    // a new batch.
+    boost::shared_ptr<LeaseUpdatesBatch> batch(new LeaseUpdatesBatch());
+    std::swap(*batch, batch_it->second);
+    lease_updates_batches_.erase(batch_it);
+
+    HAConfig::PeerConfigPtr config = config_->getPeerConfig(peer_name);
+
+    ConstElementPtr command;
+    std::vector<std::string> addresses;
+    if (server_type_ == HAServerType::DHCPv4) {
+        addresses = getBatchedAddresses(batch->leases4_, batch->deleted_leases4_);
+        command = CommandCreator::createLease4BulkApply
+            (getBatchedLeases<Lease4Collection>(batch->leases4_),
+             getBatchedLeases<Lease4Collection>(batch->deleted_leases4_));
+    } else {
+        addresses = getBatchedAddresses(batch->leases6_, batch->deleted_leases6_);
+        command = CommandCreator::createLease6BulkApply
+            (getBatchedLeases<Lease6Collection>(batch->leases6_),
+             getBatchedLeases<Lease6Collection>(batch->deleted_leases6_));
+    }
+
+    // Create HTTP/1.1 request including our command.
+    PostHttpRequestJsonPtr request = boost::make_shared<PostHttpRequestJson>
+        (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11());
+    request->setBodyAsJson(command);
+    request->finalize();
+
+    // Response object should also be created because the HTTP client needs
+    // to know the type of the expected response.
+    HttpResponseJsonPtr response = boost::make_shared<HttpResponseJson>();
+
+    // Schedule asynchronous HTTP request.
+    asyncSendOrderedLeaseUpdate(config, addresses,
+                                request, response,
+        [this, batch, config]
+            (const boost::system::error_code& ec,
+             const HttpResponsePtr& response,
+             const std::string& error_str) {
+
+            bool batch_success = true;
+
+            // Addresses of the leases which the peer failed to apply.
+            std::set<std::string> failed_addresses;
+
+            if (ec || !error_str.empty()) {
+                LOG_WARN(ha_logger, HA_LEASE_UPDATES_BATCH_COMMUNICATIONS_FAILED)
+                    .arg(batch->size_)
+                    .arg(batch->queries_.size())
+                    .arg(config->getLogLabel())
+                    .arg(ec ? ec.message() : error_str);
+                batch_success = false;
+
+            } else {
+                try {
+                    ConstElementPtr args = verifyAsyncResponse(response);
+
+                    // The peer lists the leases it failed to apply. The
+                    // deleted leases which were not found are fine.
+                    if (args && (args->getType() == Element::map)) {
+                        const char* lists[] = { "failed-deleted-leases",
+                                                "failed-leases" };
+                        for (auto list_name : lists) {
+                            ConstElementPtr failed = args->get(list_name);
+                            if (!failed || (failed->getType() != Element::list)) {
+                                continue;
+                            }
+                            for (auto lease : failed->listValue()) {
+                                ConstElementPtr result = lease->get("result");
+                                ConstElementPtr address = lease->get("ip-address");
+                                if (!address || (address->getType() != Element::string) ||
+                                    (result && (result->getType() == Element::integer) &&
+                                     (result->intValue() == CONTROL_RESULT_EMPTY))) {
+                                    continue;
+                                }
+                                ConstElementPtr error = lease->get("error-message");
+                                LOG_WARN(ha_logger, HA_LEASE_UPDATE_REJECTED)
+                                    .arg(address->stringValue())
+                                    .arg(config->getLogLabel())
+                                    .arg((error && (error->getType() == Element::string)) ?
+                                         error->stringValue() : "unknown error");
+                                failed_addresses.insert(address->stringValue());
+                            }
+                        }
+                    }
+
+                } catch (const std::exception& ex) {
+                    LOG_WARN(ha_logger, HA_LEASE_UPDATES_BATCH_FAILED)
+                        .arg(batch->size_)
+                        .arg(batch->queries_.size())
+                        .arg(config->getLogLabel())
+                        .arg(ex.what());
+                    batch_success = false;
+                }
+            }
+
+            // Complete the lease updates of each query in the batch.
+            for (auto q = batch->queries_.begin(); q != batch->queries_.end(); ++q) {
+                bool success = batch_success;
+                for (auto a = q->addresses_.begin(); success && (a != q->addresses_.end());
+                     ++a) {
+                    success = (failed_addresses.count(*a) == 0);
+                }
+                q->complete_(success);
+            }
+        });
+}
+
+void
+HAService::flushLeaseUpdates() {
+    lease_updates_flush_scheduled_ = false;
+
+    // Collect the names first because sending the batch removes it from
+    // the map.
+    std::vector<std::string> peer_names;
+    for (auto b = lease_updates_batches_.begin(); b != lease_updates_batches_.end();
+         ++b) {
+        peer_names.push_back(b->first);
+    }
+
+    for (auto name = peer_names.begin(); name != peer_names.end(); ++name) {
+        asyncSendLeaseUpdatesBatch(*name);
+    }
 }
 
 bool
@@ -993,11 +1397,39 @@ HAService::asyncSendHeartbeat() {
             // finds that some new events are required, i.e. next heartbeat or
             // lease update.  The runModel() may transition to another state, schedule
             // asynchronous tasks etc. Then it returns control to the DHCP server.
+            publishHttpStatistics();
+
             startHeartbeat();
             runModel(HA_HEARTBEAT_COMPLETE_EVT);
       });
 }
 
+void
+HAService::publishHttpStatistics() const {
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    HAConfig::PeerConfigMap peers = config_->getOtherServersConfig();
+    for (auto peer = peers.begin(); peer != peers.end(); ++peer) {
+        HttpClient::Statistics stats = client_.getStatistics(peer->second->getUrl());
+        const std::string prefix = "ha-peer[" + peer->first + "].http-";
+        stats_mgr.setValue(prefix + "connections-opened",
+                           static_cast<int64_t>(stats.connections_opened_));
+        stats_mgr.setValue(prefix + "connections-reused",
+                           static_cast<int64_t>(stats.connections_reused_));
+        stats_mgr.setValue(prefix + "connections-idle-closed",
+                           static_cast<int64_t>(stats.connections_idle_closed_));
+        stats_mgr.setValue(prefix + "requests-completed",
+                           static_cast<int64_t>(stats.requests_completed_));
+        stats_mgr.setValue(prefix + "requests-failed",
+                           static_cast<int64_t>(stats.requests_failed_));
+        stats_mgr.setValue(prefix + "requests-queued",
+                           static_cast<int64_t>(stats.requests_queued_));
+        stats_mgr.setValue(prefix + "latency-mean",
+                           static_cast<int64_t>(stats.getMeanLatency()));
+        stats_mgr.setValue(prefix + "latency-max",
+                           static_cast<int64_t>(stats.max_latency_));
+    }
+}
+
 void
 HAService::scheduleHeartbeat() {
     if (!communication_state_->isHeartbeatRunning()) {
@@ -1166,16 +1598,33 @@ HAService::asyncSyncLeases() {
 void
 HAService::asyncSyncLeases(http::HttpClient& http_client,
                            const PostRequestCallback& post_sync_action) {
+    // Start with the first page of leases.
+    asyncSyncLeasesPage(http_client,
+                        (server_type_ == HAServerType::DHCPv4 ?
+                         IOAddress::IPV4_ZERO_ADDRESS() :
+                         IOAddress::IPV6_ZERO_ADDRESS()),
+                        0, 0, post_sync_action);
+}
+
+void
+HAService::asyncSyncLeasesPage(http::HttpClient& http_client,
+                               const IOAddress& from_address,
+                               const uint64_t synced_leases,
+                               const unsigned int retries,
+                               const PostRequestCallback& post_sync_action) {
     HAConfig::PeerConfigPtr partner_config = config_->getFailoverPeerConfig();
+    const uint32_t page_limit = config_->getSyncPageLimit();
 
     // Create HTTP/1.1 request including our command.
     PostHttpRequestJsonPtr request = boost::make_shared<PostHttpRequestJson>
         (HttpRequest::Method::HTTP_POST, "/", HttpVersion::HTTP_11());
     if (server_type_ == HAServerType::DHCPv4) {
-        request->setBodyAsJson(CommandCreator::createLease4GetAll());
+        request->setBodyAsJson(CommandCreator::createLease4GetPage(from_address,
+                                                                   page_limit));
 
     } else {
-        request->setBodyAsJson(CommandCreator::createLease6GetAll());
+        request->setBodyAsJson(CommandCreator::createLease6GetPage(from_address,
+                                                                   page_limit));
     }
     request->finalize();
 
@@ -1185,7 +1634,8 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
 
     // Schedule asynchronous HTTP request.
     http_client.asyncSendRequest(partner_config->getUrl(), request, response,
-        [this, partner_config, post_sync_action]
+        [this, &http_client, partner_config, from_address, synced_leases,
+         retries, page_limit, post_sync_action]
             (const boost::system::error_code& ec,
              const HttpResponsePtr& response,
              const std::string& error_str) {
@@ -1198,6 +1648,11 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
 
             std::string error_message;
 
+            // Number of leases in the received page and the address of the
+            // last of them, from which the next page starts.
+            size_t page_size = 0;
+            IOAddress last_address = from_address;
+
             // Handle first two groups of errors.
             if (ec || !error_str.empty()) {
                 error_message = (ec ? ec.message() : error_str);
@@ -1223,8 +1678,21 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
                                   " argument is not a list");
                     }
 
-                    // Iterate over the leases and update the database as appropriate.
                     const auto& leases_element = leases->listValue();
+                    page_size = leases_element.size();
+
+                    // The next page starts after the last lease of this page.
+                    if (page_size > 0) {
+                        ConstElementPtr ip_address = leases_element.back()->get("ip-address");
+                        if (!ip_address || (ip_address->getType() != Element::string)) {
+                            isc_throw(CtrlChannelError,
+                                      "last lease in the received page does not"
+                                      " contain a valid ip-address");
+                        }
+                        last_address = IOAddress(ip_address->stringValue());
+                    }
+
+                    // Iterate over the leases and update the database as appropriate.
                     for (auto l = leases_element.begin(); l != leases_element.end(); ++l) {
                         try {
                             if (server_type_ == HAServerType::DHCPv4) {
@@ -1276,6 +1744,11 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
                         }
                     }
 
+                    LOG_INFO(ha_logger, HA_LEASES_SYNC_PAGE_RECEIVED)
+                        .arg(page_size)
+                        .arg(partner_config->getLogLabel())
+                        .arg(synced_leases + page_size);
+
                 } catch (const std::exception& ex) {
                     error_message = ex.what();
                     LOG_ERROR(ha_logger, HA_LEASES_SYNC_FAILED)
@@ -1284,11 +1757,30 @@ HAService::asyncSyncLeases(http::HttpClient& http_client,
                 }
             }
 
-             // If there was an error communicating with the partner, mark the
-             // partner as unavailable.
-             if (!error_message.empty()) {
-                 communication_state_->setPartnerState("unavailable");
-             }
+            if (!error_message.empty()) {
+                // The leases of the previous pages have been already stored,
+                // so let's resume from the page which failed.
+                if (retries < SYNC_PAGE_MAX_RETRIES) {
+                    LOG_WARN(ha_logger, HA_LEASES_SYNC_PAGE_RETRY)
+                        .arg(partner_config->getLogLabel())
+                        .arg(from_address.toText())
+                        .arg(retries + 1);
+                    asyncSyncLeasesPage(http_client, from_address, synced_leases,
+                                        retries + 1, post_sync_action);
+                    return;
+                }
+
+                // If there was an error communicating with the partner, mark the
+                // partner as unavailable.
+                communication_state_->setPartnerState("unavailable");
+
+            } else if (page_size >= page_limit) {
+                // The page is full, so there may be more leases to fetch.
+                asyncSyncLeasesPage(http_client, last_address,
+                                    synced_leases + page_size, 0,
+                                    post_sync_action);
+                return;
+            }
 
             // Invoke post synchronization action if it was specified.
             if (post_sync_action) {
@@ -11,6 +11,8 @@
 #include <ha_config.h>
 #include <ha_server_type.h>
 #include <query_filter.h>
+#include <asiolink/interval_timer.h>
+#include <asiolink/io_address.h>
 #include <asiolink/io_service.h>
 #include <cc/data.h>
 #include <dhcp/pkt4.h>
@@ -25,6 +27,7 @@
 #include <boost/shared_ptr.hpp>
 #include <functional>
 #include <map>
+#include <string>
 #include <vector>
 
 namespace isc {
@@ -428,6 +431,7 @@ protected:
     /// @param query Pointer to the DHCP client's query.
     /// @param config Pointer to the configuration of the server to which the
     /// command should be sent.
+    /// @param address Address of the updated lease.
     /// @param command Pointer to the command to be sent.
     /// @param [out] parking_lot Parking lot where the query is parked.
     /// This method uses this handle to unpark the packet when all asynchronous
@@ -438,9 +442,90 @@ protected:
     template<typename QueryPtrType>
     void asyncSendLeaseUpdate(const QueryPtrType& query,
                               const HAConfig::PeerConfigPtr& config,
+                              const std::string& address,
                               const data::ConstElementPtr& command,
                               const hooks::ParkingLotHandlePtr& parking_lot);
 
+    /// @brief Asynchronously sends a request updating leases to the peer,
+    /// preserving the order of the updates of each lease.
+    ///
+    /// When multiple connections to the peer are allowed, the requests are
+    /// sent in parallel and may be applied by the peer in any order. The
+    /// request is therefore held until the requests previously sent or
+    /// held for any of its leases complete. The requests updating other
+    /// leases are sent immediately.
+    ///
+    /// @param config Pointer to the configuration of the server to which the
+    /// request should be sent.
+    /// @param addresses Addresses of the leases updated by the request.
+    /// @param request Pointer to the request.
+    /// @param response Pointer to the object where the response is stored.
+    /// @param handler Function called when the request completes.
+    void asyncSendOrderedLeaseUpdate(const HAConfig::PeerConfigPtr& config,
+                                     const std::vector<std::string>& addresses,
+                                     const http::HttpRequestPtr& request,
+                                     const http::HttpResponsePtr& response,
+                                     const http::HttpClient::RequestHandler& handler);
+
+    /// @brief Completes the lease update for a query.
+    ///
+    /// It is called when the response to the lease update sent for the query
+    /// has been received, or the communication with the peer failed. It
+    /// drops the parked query if the update failed and the peer is not a
+    /// backup server. It unparks the query when there are no more lease
+    /// updates pending for it.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param config Pointer to the configuration of the server to which the
+    /// lease update was sent.
+    /// @param [out] parking_lot Parking lot where the query is parked.
+    /// @param success Indicates if the lease update was successful.
+    /// @tparam QueryPtrType Type of the pointer to the DHCP client's message,
+    /// i.e. Pkt4Ptr or Pkt6Ptr.
+    template<typename QueryPtrType>
+    void leaseUpdateComplete(const QueryPtrType& query,
+                             const HAConfig::PeerConfigPtr& config,
+                             const hooks::ParkingLotHandlePtr& parking_lot,
+                             const bool success);
+
+    /// @brief Adds the lease updates for the query to the batch for the peer.
+    ///
+    /// The leases must have been already appended to the batch by the caller.
+    /// This method records the query so as it is unparked or dropped when
+    /// the response to the batch is received. The batch is sent immediately
+    /// when it has reached the configured size. Otherwise, it is sent when
+    /// the flush interval elapses.
+    ///
+    /// @param query Pointer to the DHCP client's query.
+    /// @param config Pointer to the configuration of the server to which the
+    /// lease updates are to be sent.
+    /// @param addresses Addresses of the query's leases appended to the batch.
+    /// @param [out] parking_lot Parking lot where the query is parked.
+    /// @tparam QueryPtrType Type of the pointer to the DHCP client's message,
+    /// i.e. Pkt4Ptr or Pkt6Ptr.
+    template<typename QueryPtrType>
+    void queueLeaseUpdates(const QueryPtrType& query,
+                           const HAConfig::PeerConfigPtr& config,
+                           const std::vector<std::string>& addresses,
+                           const hooks::ParkingLotHandlePtr& parking_lot);
+
+    /// @brief Asynchronously sends the batched lease updates to the peer.
+    ///
+    /// It sends a single lease4-bulk-apply or lease6-bulk-apply command
+    /// with all lease updates held for the peer. When the response is
+    /// received, the lease updates of each query are completed. A query is
+    /// considered failed when the whole command failed or when the peer
+    /// reported that any of the query's leases couldn't be applied.
+    ///
+    /// @param peer_name Name of the peer to which the updates should be
+    /// sent.
+    void asyncSendLeaseUpdatesBatch(const std::string& peer_name);
+
+    /// @brief Sends the batched lease updates to all peers.
+    ///
+    /// This method is invoked when the flush interval elapses.
+    void flushLeaseUpdates();
+
     /// @brief Checks if the lease updates should be sent as result of leases
     /// allocation or release.
     ///
@@ -485,6 +570,14 @@ protected:
     /// @brief Starts asynchronous heartbeat to a peer.
     void asyncSendHeartbeat();
 
+    /// @brief Publishes statistics of the communication with the peers.
+    ///
+    /// The statistics gathered by the HTTP client are published to the
+    /// @c StatsMgr as "ha-peer[<name>].http-<statistic>", e.g.
+    /// "ha-peer[server2].http-latency-max". The latencies are expressed
+    /// in microseconds. This method is called when the heartbeat completes.
+    void publishHttpStatistics() const;
+
     /// @brief Schedules asynchronous heartbeat to a peer if it is not scheduled.
     ///
     /// The heartbeat will be sent according to the value of the heartbeat-delay
@@ -533,12 +626,13 @@ protected:
     /// @brief Asynchronously reads leases from a peer and updates local
     /// lease database.
     ///
-    /// This method asynchronously sends lease4-get-all command to fetch all
-    /// leases from the HA peer database. When the response is received, the
-    /// callback function iterates over the returned leases and inserts those
-    /// that are not present in the local database and replaces any existing
-    /// leases if the fetched lease instance is newer (based on cltt) than
-    /// the instance in the local lease database.
+    /// This method asynchronously fetches leases from the HA peer database
+    /// page by page, using lease4-get-page or lease6-get-page commands. When
+    /// a page is received, the callback function iterates over the returned
+    /// leases and inserts those that are not present in the local database
+    /// and replaces any existing leases if the fetched lease instance is
+    /// newer (based on cltt) than the instance in the local lease database.
+    /// Then the next page is requested.
     ///
     /// If there is an error while inserting or updating any of the leases
     /// a warning message is logged and the process continues for the
@@ -550,16 +644,8 @@ protected:
     /// @brief Asynchronously reads leases from a peer and updates local
     /// lease database using a provided client instance.
     ///
-    /// This method asynchronously sends lease4-get-all command to fetch all
-    /// leases from the HA peer database. When the response is received, the
-    /// callback function iterates over the returned leases and inserts those
-    /// that are not present in the local database and replaces any existing
-    /// leases if the fetched lease instance is newer (based on cltt) than
-    /// the instance in the local lease database.
-    ///
-    /// If there is an error while inserting or updating any of the leases
-    /// a warning message is logged and the process continues for the
-    /// remaining leases.
+    /// This method starts fetching the leases from the first page. See
+    /// @c asyncSyncLeasesPage for details.
     ///
     /// @param http_client reference to the client to be used to communicate
     /// with the other server.
@@ -569,6 +655,37 @@ protected:
     void asyncSyncLeases(http::HttpClient& http_client,
                          const PostRequestCallback& post_sync_action);
 
+    /// @brief Asynchronously reads a page of leases from a peer and updates
+    /// local lease database.
+    ///
+    /// This method asynchronously sends lease4-get-page or lease6-get-page
+    /// command to fetch at most the configured number of leases following
+    /// the specified address. The fetched leases are inserted into or
+    /// updated in the local lease database as described for
+    /// @c asyncSyncLeases. Holding only a single page of leases at a time
+    /// bounds the memory used by both servers during the synchronization.
+    ///
+    /// If the page is full, the next page is requested, starting after the
+    /// last lease of this page. Otherwise, the synchronization is complete.
+    /// If fetching the page fails, it is requested again a few times before
+    /// the synchronization fails. The leases from the previous pages are
+    /// not fetched again.
+    ///
+    /// @param http_client reference to the client to be used to communicate
+    /// with the other server.
+    /// @param from_address address of the last lease fetched in the previous
+    /// page or zero address to fetch the first page.
+    /// @param synced_leases number of leases fetched in the previous pages.
+    /// @param retries number of retries of this page so far.
+    /// @param post_sync_action pointer to the function to be executed when
+    /// lease database synchronization is complete. If this is null, no
+    /// post synchronization action is invoked.
+    void asyncSyncLeasesPage(http::HttpClient& http_client,
+                             const asiolink::IOAddress& from_address,
+                             const uint64_t synced_leases,
+                             const unsigned int retries,
+                             const PostRequestCallback& post_sync_action);
+
 public:
 
     /// @brief Processes ha-sync command and returns a response.
@@ -587,7 +704,7 @@ public:
     /// @param server_name name of the server to fetch leases from.
     /// @param max_period maximum number of seconds to disable DHCP service
     /// of the peer. This value is used in dhcp-disable command issued to
-    /// the peer before the lease4-get-all command.
+    /// the peer before fetching the leases.
     ///
     /// @return Pointer to the response to the ha-sync command.
     data::ConstElementPtr processSynchronize(const std::string& server_name,
@@ -604,7 +721,7 @@ protected:
     /// @param server_name name of the server to fetch leases from.
     /// @param max_period maximum number of seconds to disable DHCP service
     /// of the peer. This value is used in dhcp-disable command issued to
-    /// the peer before the lease4-get-all command.
+    /// the peer before fetching the leases.
     ///
     /// @return Synchronization result according to the status codes returned
     /// in responses to control commands.
@@ -668,6 +785,100 @@ protected:
     /// the number of responses received so far and unpark the packet when
     /// all responses have been received. That's what this map is used for.
     std::map<boost::shared_ptr<dhcp::Pkt>, int> pending_requests_;
+
+    /// @brief Lease updates of a query held in a batch.
+    struct BatchedQuery {
+        /// @brief Addresses of the query's leases.
+        std::vector<std::string> addresses_;
+
+        /// @brief Function completing the lease update of the query.
+        ///
+        /// It takes a boolean value indicating if the lease updates were
+        /// successful.
+        std::function<void(const bool)> complete_;
+    };
+
+    /// @brief Lease updates held for a peer until they are sent in a single
+    /// bulk apply command.
+    ///
+    /// Only the collections matching the server type are used. The leases
+    /// are indexed by their addresses and the batch holds only the last
+    /// operation for each address, e.g. a lease allocated and then released
+    /// by the queries in the same batch is only sent as deleted. Therefore,
+    /// the peer gets the same result regardless of the order in which it
+    /// applies the updated and deleted leases.
+    struct LeaseUpdatesBatch {
+        /// @brief Constructor.
+        LeaseUpdatesBatch()
+            : leases4_(), deleted_leases4_(), leases6_(), deleted_leases6_(),
+              size_(0), queries_() {
+        }
+
+        /// @brief New or updated IPv4 leases by addresses.
+        std::map<std::string, dhcp::Lease4Ptr> leases4_;
+
+        /// @brief Deleted IPv4 leases by addresses.
+        std::map<std::string, dhcp::Lease4Ptr> deleted_leases4_;
+
+        /// @brief New or updated IPv6 leases by addresses.
+        std::map<std::string, dhcp::Lease6Ptr> leases6_;
+
+        /// @brief Deleted IPv6 leases by addresses.
+        std::map<std::string, dhcp::Lease6Ptr> deleted_leases6_;
+
+        /// @brief Total number of leases in the batch.
+        size_t size_;
+
+        /// @brief Queries whose leases are held in the batch.
+        std::vector<BatchedQuery> queries_;
+    };
+
+    /// @brief Request updating leases sent to a peer or held until the
+    /// earlier requests for the same leases complete.
+    struct OrderedLeaseUpdate {
+        /// @brief Addresses of the leases updated by the request.
+        std::vector<std::string> addresses_;
+
+        /// @brief Pointer to the request.
+        http::HttpRequestPtr request_;
+
+        /// @brief Pointer to the object where the response is stored.
+        http::HttpResponsePtr response_;
+
+        /// @brief Function called when the request completes.
+        http::HttpClient::RequestHandler handler_;
+    };
+
+    /// @brief Requests updating leases of a peer which are in progress.
+    struct PeerLeaseUpdates {
+        /// @brief Number of requests sent and not completed by lease
+        /// addresses.
+        std::map<std::string, unsigned int> sent_;
+
+        /// @brief Requests held in the order in which they were made.
+        std::vector<OrderedLeaseUpdate> held_;
+    };
+
+    /// @brief Sends a request updating leases to the peer and records its
+    /// addresses until it completes.
+    ///
+    /// @param config Pointer to the configuration of the peer.
+    /// @param update Request to be sent.
+    void sendOrderedLeaseUpdate(const HAConfig::PeerConfigPtr& config,
+                                const OrderedLeaseUpdate& update);
+
+    /// @brief Requests updating leases in progress by peer names.
+    std::map<std::string, PeerLeaseUpdates> peer_lease_updates_;
+
+    /// @brief Lease updates batches by peer names.
+    std::map<std::string, LeaseUpdatesBatch> lease_updates_batches_;
+
+    /// @brief Timer triggering sending the batched lease updates.
+    asiolink::IntervalTimerPtr lease_updates_timer_;
+
+    /// @brief Indicates if the batched lease updates are scheduled to be
+    /// sent by the timer.
+    bool lease_updates_flush_scheduled_;
 };
 
 /// @brief Pointer to the @c HAService class.
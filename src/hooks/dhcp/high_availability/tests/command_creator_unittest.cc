@@ -198,12 +198,72 @@ TEST(CommandCreatorTest, createLease4Delete) {
     EXPECT_EQ(lease_as_json->str(), arguments->str());
 }
 
+// This test verifies that the command generated for the batch of lease
+// updates is correct.
+TEST(CommandCreatorTest, createLease4BulkApply) {
+    Lease4Collection leases;
+    leases.push_back(createLease4());
+    Lease4Collection deleted_leases;
+    deleted_leases.push_back(createLease4());
+    deleted_leases.back()->addr_ = IOAddress("192.1.2.4");
+
+    ConstElementPtr command = CommandCreator::createLease4BulkApply(leases,
+                                                                   deleted_leases);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-bulk-apply", "dhcp4",
+                                              arguments));
+
+    // The updated leases are complete and include the "force-create" parameter.
+    ConstElementPtr leases_json = arguments->get("leases");
+    ASSERT_TRUE(leases_json);
+    ASSERT_EQ(Element::list, leases_json->getType());
+    ASSERT_EQ(1, leases_json->size());
+    ElementPtr lease_as_json = leaseAsJson(createLease4());
+    lease_as_json->set("force-create", Element::create(true));
+    EXPECT_EQ(lease_as_json->str(), leases_json->get(0)->str());
+
+    // The deleted leases are specified by address.
+    ConstElementPtr deleted_leases_json = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted_leases_json);
+    ASSERT_EQ(Element::list, deleted_leases_json->getType());
+    ASSERT_EQ(1, deleted_leases_json->size());
+    EXPECT_EQ("{ \"ip-address\": \"192.1.2.4\" }",
+              deleted_leases_json->get(0)->str());
+}
+
 // This test verifies that the lease4-get-all command is correct.
 TEST(CommandCreatorTest, createLease4GetAll) {
     ConstElementPtr command = CommandCreator::createLease4GetAll();
     ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-get-all", "dhcp4"));
 }
 
+// This test verifies that the lease4-get-page command is correct.
+TEST(CommandCreatorTest, createLease4GetPage) {
+    // The first page is fetched with the "start" keyword.
+    ConstElementPtr command =
+        CommandCreator::createLease4GetPage(IOAddress::IPV4_ZERO_ADDRESS(), 15);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-get-page", "dhcp4",
+                                              arguments));
+    ConstElementPtr from = arguments->get("from");
+    ASSERT_TRUE(from);
+    ASSERT_EQ(Element::string, from->getType());
+    EXPECT_EQ("start", from->stringValue());
+    ConstElementPtr limit = arguments->get("limit");
+    ASSERT_TRUE(limit);
+    ASSERT_EQ(Element::integer, limit->getType());
+    EXPECT_EQ(15, limit->intValue());
+
+    // The next pages start after the last fetched lease.
+    command = CommandCreator::createLease4GetPage(IOAddress("192.1.2.3"), 15);
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease4-get-page", "dhcp4",
+                                              arguments));
+    from = arguments->get("from");
+    ASSERT_TRUE(from);
+    ASSERT_EQ(Element::string, from->getType());
+    EXPECT_EQ("192.1.2.3", from->stringValue());
+}
+
 // This test verifies that the dhcp-disable command (DHCPv6 case) is
 // correct.
 TEST(CommandCreatorTest, createDHCPDisable6) {
@@ -252,11 +312,62 @@ TEST(CommandCreatorTest, createLease6Delete) {
     EXPECT_EQ(lease_as_json->str(), arguments->str());
 }
 
+// This test verifies that the command generated for the batch of IPv6
+// lease updates is correct.
+TEST(CommandCreatorTest, createLease6BulkApply) {
+    Lease6Collection leases;
+    leases.push_back(createLease6());
+
+    ConstElementPtr command = CommandCreator::createLease6BulkApply(leases,
+                                                                   Lease6Collection());
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-bulk-apply", "dhcp6",
+                                              arguments));
+
+    ConstElementPtr leases_json = arguments->get("leases");
+    ASSERT_TRUE(leases_json);
+    ASSERT_EQ(1, leases_json->size());
+    ElementPtr lease_as_json = leaseAsJson(createLease6());
+    lease_as_json->set("force-create", Element::create(true));
+    EXPECT_EQ(lease_as_json->str(), leases_json->get(0)->str());
+
+    ConstElementPtr deleted_leases_json = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted_leases_json);
+    EXPECT_EQ(0, deleted_leases_json->size());
+}
+
 // This test verifies that the lease6-get-all command is correct.
 TEST(CommandCreatorTest, createLease6GetAll) {
     ConstElementPtr command = CommandCreator::createLease6GetAll();
     ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-get-all", "dhcp6"));
 }
 
+// This test verifies that the lease6-get-page command is correct.
+TEST(CommandCreatorTest, createLease6GetPage) {
+    // The first page is fetched with the "start" keyword.
+    ConstElementPtr command =
+        CommandCreator::createLease6GetPage(IOAddress::IPV6_ZERO_ADDRESS(), 20);
+    ConstElementPtr arguments;
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-get-page", "dhcp6",
+                                              arguments));
+    ConstElementPtr from = arguments->get("from");
+    ASSERT_TRUE(from);
+    ASSERT_EQ(Element::string, from->getType());
+    EXPECT_EQ("start", from->stringValue());
+    ConstElementPtr limit = arguments->get("limit");
+    ASSERT_TRUE(limit);
+    ASSERT_EQ(Element::integer, limit->getType());
+    EXPECT_EQ(20, limit->intValue());
+
+    // The next pages start after the last fetched lease.
+    command = CommandCreator::createLease6GetPage(IOAddress("2001:db8:1::10"), 20);
+    ASSERT_NO_FATAL_FAILURE(testCommandBasics(command, "lease6-get-page", "dhcp6",
+                                              arguments));
+    from = arguments->get("from");
+    ASSERT_TRUE(from);
+    ASSERT_EQ(Element::string, from->getType());
+    EXPECT_EQ("2001:db8:1::10", from->stringValue());
+}
+
 
 }
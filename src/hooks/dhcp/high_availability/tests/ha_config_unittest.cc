@@ -66,8 +66,13 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
         "        \"this-server-name\": \"server1\","
         "        \"mode\": \"load-balancing\","
         "        \"send-lease-updates\": false,"
+        "        \"lease-updates-batch-size\": 100,"
+        "        \"lease-updates-flush-interval\": 5,"
         "        \"sync-leases\": false,"
         "        \"sync-timeout\": 20000,"
+        "        \"sync-page-limit\": 500,"
+        "        \"http-max-connections\": 4,"
+        "        \"http-idle-timeout\": 5000,"
         "        \"heartbeat-delay\": 8,"
         "        \"max-response-delay\": 11,"
         "        \"max-ack-delay\": 5,"
@@ -115,8 +120,13 @@ TEST_F(HAConfigTest, configureLoadBalancing) {
     EXPECT_EQ("server1", impl->getConfig()->getThisServerName());
     EXPECT_EQ(HAConfig::LOAD_BALANCING, impl->getConfig()->getHAMode());
     EXPECT_FALSE(impl->getConfig()->amSendingLeaseUpdates());
+    EXPECT_EQ(100, impl->getConfig()->getLeaseUpdatesBatchSize());
+    EXPECT_EQ(5, impl->getConfig()->getLeaseUpdatesFlushInterval());
     EXPECT_FALSE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(20000, impl->getConfig()->getSyncTimeout());
+    EXPECT_EQ(500, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(4, impl->getConfig()->getHttpMaxConnections());
+    EXPECT_EQ(5000, impl->getConfig()->getHttpIdleTimeout());
     EXPECT_EQ(8, impl->getConfig()->getHeartbeatDelay());
     EXPECT_EQ(11, impl->getConfig()->getMaxResponseDelay());
     EXPECT_EQ(5, impl->getConfig()->getMaxAckDelay());
@@ -220,8 +230,13 @@ TEST_F(HAConfigTest, configureHotStandby) {
     EXPECT_EQ("server1", impl->getConfig()->getThisServerName());
     EXPECT_EQ(HAConfig::HOT_STANDBY, impl->getConfig()->getHAMode());
     EXPECT_TRUE(impl->getConfig()->amSendingLeaseUpdates());
+    EXPECT_EQ(0, impl->getConfig()->getLeaseUpdatesBatchSize());
+    EXPECT_EQ(10, impl->getConfig()->getLeaseUpdatesFlushInterval());
     EXPECT_TRUE(impl->getConfig()->amSyncingLeases());
     EXPECT_EQ(60000, impl->getConfig()->getSyncTimeout());
+    EXPECT_EQ(10000, impl->getConfig()->getSyncPageLimit());
+    EXPECT_EQ(1, impl->getConfig()->getHttpMaxConnections());
+    EXPECT_EQ(25000, impl->getConfig()->getHttpIdleTimeout());
     EXPECT_EQ(10000, impl->getConfig()->getHeartbeatDelay());
     EXPECT_EQ(10000, impl->getConfig()->getMaxAckDelay());
     EXPECT_EQ(10, impl->getConfig()->getMaxUnackedClients());
@@ -389,6 +404,90 @@ TEST_F(HAConfigTest, negativeHeartbeatDelay) {
         "'heartbeat-delay' must not be negative");
 }
 
+// Error should be returned when lease updates batching is enabled
+// and the flush interval is 0.
+TEST_F(HAConfigTest, zeroLeaseUpdatesFlushInterval) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"lease-updates-batch-size\": 100,"
+        "        \"lease-updates-flush-interval\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'lease-updates-flush-interval' must be greater than 0 when lease"
+        " updates batching is enabled");
+}
+
+// Error should be returned when sync-page-limit is 0.
+TEST_F(HAConfigTest, zeroSyncPageLimit) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"sync-page-limit\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'sync-page-limit' must be greater than 0");
+}
+
+// Error should be returned when http-max-connections is 0.
+TEST_F(HAConfigTest, zeroHttpMaxConnections) {
+    testInvalidConfig(
+        "["
+        "    {"
+        "        \"this-server-name\": \"server1\","
+        "        \"mode\": \"load-balancing\","
+        "        \"http-max-connections\": 0,"
+        "        \"peers\": ["
+        "            {"
+        "                \"name\": \"server1\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"primary\","
+        "                \"auto-failover\": false"
+        "            },"
+        "            {"
+        "                \"name\": \"server2\","
+        "                \"url\": \"http://127.0.0.1:8080/\","
+        "                \"role\": \"secondary\","
+        "                \"auto-failover\": true"
+        "            }"
+        "        ]"
+        "    }"
+        "]",
+        "'http-max-connections' must be greater than 0");
+}
+
 // Error should be returned when heartbeat-delay is too large.
 TEST_F(HAConfigTest, largeHeartbeatDelay) {
     testInvalidConfig(
@@ -33,12 +33,15 @@
 #include <http/response_creator.h>
 #include <http/response_creator_factory.h>
 #include <http/response_json.h>
+#include <stats/stats_mgr.h>
 #include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
 #include <functional>
+#include <list>
+#include <map>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -51,6 +54,7 @@ using namespace isc::ha;
 using namespace isc::ha::test;
 using namespace isc::hooks;
 using namespace isc::http;
+using namespace isc::stats;
 
 namespace {
 
@@ -184,6 +188,7 @@ public:
 
     using HAService::asyncSendHeartbeat;
     using HAService::asyncSyncLeases;
+    using HAService::client_;
     using HAService::postNextEvent;
     using HAService::transition;
     using HAService::verboseTransition;
@@ -209,7 +214,7 @@ public:
     TestHttpResponseCreator() :
         requests_(), control_result_(CONTROL_RESULT_SUCCESS),
         arguments_(), per_request_control_result_(),
-        per_request_arguments_() {
+        queued_control_results_(), per_request_arguments_() {
     }
 
     /// @brief Removes all received requests.
@@ -260,6 +265,20 @@ public:
         per_request_control_result_[command_name] = control_result;
     }
 
+    /// @brief Queues control result to be returned for the next request
+    /// carrying the particular command.
+    ///
+    /// The queued control results are returned in the order in which they
+    /// have been queued and take precedence over the control results set
+    /// with @c setControlResult.
+    ///
+    /// @param command_name command name.
+    /// @param control_result control result value.
+    void queueControlResult(const std::string& command_name,
+                            const int control_result) {
+        queued_control_results_[command_name].push_back(control_result);
+    }
+
     /// @brief Sets arguments to be included in the responses.
     ///
     /// @param arguments pointer to the arguments.
@@ -338,7 +357,11 @@ private:
 
                 // Check if there is specific error code to be returned for this
                 // command.
-                if (per_request_control_result_.count(command_name) > 0) {
+                if (!queued_control_results_[command_name].empty()) {
+                    control_result = queued_control_results_[command_name].front();
+                    queued_control_results_[command_name].pop_front();
+
+                } else if (per_request_control_result_.count(command_name) > 0) {
                     control_result = per_request_control_result_[command_name];
                 }
 
@@ -346,6 +369,12 @@ private:
                 // command.
                 if (per_request_arguments_.count(command_name) > 0) {
                     arguments = per_request_arguments_[command_name];
+
+                    // Return only the requested page of the leases.
+                    if ((command_name == "lease4-get-page") ||
+                        (command_name == "lease6-get-page")) {
+                        arguments = getLeasesPage(arguments, body->get("arguments"));
+                    }
                 }
             }
         }
@@ -379,6 +408,40 @@ private:
         return (response);
     }
 
+    /// @brief Returns a page of leases requested with the lease4-get-page
+    /// or lease6-get-page command.
+    ///
+    /// The leases must be ordered by their addresses.
+    ///
+    /// @param arguments arguments holding all leases.
+    /// @param command_arguments arguments of the received command.
+    ///
+    /// @return Pointer to the arguments holding the requested page of leases.
+    static ElementPtr getLeasesPage(const ElementPtr& arguments,
+                                    const ConstElementPtr& command_arguments) {
+        ConstElementPtr leases = arguments->get("leases");
+        if (!leases || (leases->getType() != Element::list) || !command_arguments) {
+            return (arguments);
+        }
+
+        const std::string from = command_arguments->get("from")->stringValue();
+        const size_t limit = static_cast<size_t>(command_arguments->get("limit")->intValue());
+
+        ElementPtr page = Element::createList();
+        const auto& leases_vec = leases->listValue();
+        for (auto l = leases_vec.begin();
+             (l != leases_vec.end()) && (page->size() < limit); ++l) {
+            IOAddress address((*l)->get("ip-address")->stringValue());
+            if ((from == "start") || (IOAddress(from) < address)) {
+                page->add(*l);
+            }
+        }
+
+        ElementPtr page_arguments = Element::createMap();
+        page_arguments->set("leases", page);
+        return (page_arguments);
+    }
+
     /// @brief Holds received HTTP requests.
     std::vector<ConstPostHttpRequestJsonPtr> requests_;
 
@@ -391,6 +454,9 @@ private:
     /// @brief Command specific control results.
     std::map<std::string, int> per_request_control_result_;
 
+    /// @brief Command specific control results for the next requests.
+    std::map<std::string, std::list<int> > queued_control_results_;
+
     /// @brief Command specific response arguments.
     std::map<std::string, ElementPtr> per_request_arguments_;
 };
@@ -698,6 +764,68 @@ public:
         }
     }
 
+    /// @brief Tests scenarios when lease updates for two queries are sent
+    /// to the partners in a single batch.
+    ///
+    /// The first query allocates the 192.1.2.3 lease and the second query
+    /// allocates the 192.1.2.4 lease.
+    ///
+    /// @param [out] unparked1 set to true when the first query is unparked.
+    /// @param [out] unparked2 set to true when the second query is unparked.
+    void testSendLeaseUpdatesBatch(bool& unparked1, bool& unparked2) {
+        // Create HA configuration for 3 servers. This server is
+        // server 1. The batch is large enough to hold all the leases,
+        // so it is sent when the flush interval elapses.
+        HAConfigPtr config_storage = createValidConfiguration();
+        config_storage->setLeaseUpdatesBatchSize(100);
+        config_storage->setLeaseUpdatesFlushInterval(10);
+
+        // Create parking lot where the queries are going to be parked.
+        ParkingLotPtr parking_lot(new ParkingLot());
+        ParkingLotHandlePtr parking_lot_handle(new ParkingLotHandle(parking_lot));
+
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+        Lease4CollectionPtr deleted_leases4(new Lease4Collection());
+
+        Pkt4Ptr query1(new Pkt4(DHCPREQUEST, 1234));
+        Lease4CollectionPtr leases1(new Lease4Collection());
+        leases1->push_back(Lease4Ptr(new Lease4(IOAddress("192.1.2.3"), hwaddr,
+                                                static_cast<const uint8_t*>(0), 0,
+                                                60, 30, 40, 0, 1)));
+
+        Pkt4Ptr query2(new Pkt4(DHCPREQUEST, 2345));
+        Lease4CollectionPtr leases2(new Lease4Collection());
+        leases2->push_back(Lease4Ptr(new Lease4(IOAddress("192.1.2.4"), hwaddr,
+                                                static_cast<const uint8_t*>(0), 0,
+                                                60, 30, 40, 0, 1)));
+
+        TestHAService service(io_service_, network_state_, config_storage);
+        service.transition(HA_LOAD_BALANCING_ST, HAService::NOP_EVT);
+
+        EXPECT_EQ(2, service.asyncSendLeaseUpdates(query1, leases1, deleted_leases4,
+                                                   parking_lot_handle));
+        EXPECT_EQ(2, service.asyncSendLeaseUpdates(query2, leases2, deleted_leases4,
+                                                   parking_lot_handle));
+
+        ASSERT_NO_THROW(parking_lot->reference(query1));
+        ASSERT_NO_THROW(parking_lot->park(query1, [&unparked1] {
+            unparked1 = true;
+        }));
+        ASSERT_NO_THROW(parking_lot->reference(query2));
+        ASSERT_NO_THROW(parking_lot->park(query2, [&unparked2] {
+            unparked2 = true;
+        }));
+
+        // Nothing has been sent yet.
+        EXPECT_TRUE(factory2_->getResponseCreator()->getReceivedRequests().empty());
+
+        // Actually perform the lease updates.
+        ASSERT_NO_THROW(runIOService(TEST_TIMEOUT, [&service]() {
+            // Finish running IO service when there are no more pending requests.
+            return (service.pending_requests_.empty());
+        }));
+    }
+
     /// @brief Tests scenarios when recurring heartbeat has been enabled
     /// and the partner is online or offline.
     ///
@@ -786,8 +914,8 @@ public:
         ElementPtr response_arguments = Element::createMap();
         response_arguments->set("leases", getTestLeases4AsJson());
 
-        factory2_->getResponseCreator()->setArguments("lease4-get-all", response_arguments);
-        factory3_->getResponseCreator()->setArguments("lease4-get-all", response_arguments);
+        factory2_->getResponseCreator()->setArguments("lease4-get-page", response_arguments);
+        factory3_->getResponseCreator()->setArguments("lease4-get-page", response_arguments);
 
         // Start the servers.
         ASSERT_NO_THROW({
@@ -838,8 +966,8 @@ public:
         ElementPtr response_arguments = Element::createMap();
         response_arguments->set("leases", getTestLeases6AsJson());
 
-        factory2_->getResponseCreator()->setArguments("lease6-get-all", response_arguments);
-        factory3_->getResponseCreator()->setArguments("lease6-get-all", response_arguments);
+        factory2_->getResponseCreator()->setArguments("lease6-get-page", response_arguments);
+        factory3_->getResponseCreator()->setArguments("lease6-get-page", response_arguments);
 
         // Start the servers.
         ASSERT_NO_THROW({
@@ -1035,6 +1163,225 @@ TEST_F(HAServiceTest, sendSuccessfulUpdates) {
     EXPECT_TRUE(delete_request3);
 }
 
+// Test scenario when lease updates for multiple queries are sent in a batch.
+TEST_F(HAServiceTest, sendSuccessfulUpdatesBatch) {
+    // Start HTTP servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    bool unparked1 = false;
+    bool unparked2 = false;
+    testSendLeaseUpdatesBatch(unparked1, unparked2);
+
+    // Both queries should be unparked.
+    EXPECT_TRUE(unparked1);
+    EXPECT_TRUE(unparked2);
+
+    // Each peer should have received a single command with both leases.
+    ASSERT_EQ(1, factory2_->getResponseCreator()->getReceivedRequests().size());
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                             "192.1.2.3"));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                             "192.1.2.4"));
+    ASSERT_EQ(1, factory3_->getResponseCreator()->getReceivedRequests().size());
+    EXPECT_TRUE(factory3_->getResponseCreator()->findRequest("lease4-bulk-apply",
+                                                             "192.1.2.4"));
+}
+
+// Test scenario when the partner fails to apply one of the leases sent in
+// a batch. Only the query to which the lease belongs should be dropped.
+TEST_F(HAServiceTest, sendUpdatesBatchLeaseFailed) {
+    // Start HTTP servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    // Server 2 fails to apply the first query's lease.
+    ElementPtr failed_lease = Element::createMap();
+    failed_lease->set("ip-address", Element::create("192.1.2.3"));
+    failed_lease->set("result", Element::create(CONTROL_RESULT_ERROR));
+    failed_lease->set("error-message", Element::create("error"));
+    ElementPtr failed_leases = Element::createList();
+    failed_leases->add(failed_lease);
+    ElementPtr arguments = Element::createMap();
+    arguments->set("failed-leases", failed_leases);
+    factory2_->getResponseCreator()->setArguments("lease4-bulk-apply", arguments);
+
+    bool unparked1 = false;
+    bool unparked2 = false;
+    testSendLeaseUpdatesBatch(unparked1, unparked2);
+
+    EXPECT_FALSE(unparked1);
+    EXPECT_TRUE(unparked2);
+}
+
+// Test scenario when the partner returns an error for the batch of lease
+// updates. All queries should be dropped.
+TEST_F(HAServiceTest, sendUpdatesBatchFailed) {
+    // Start HTTP servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    factory2_->getResponseCreator()->setControlResult("lease4-bulk-apply",
+                                                      CONTROL_RESULT_ERROR);
+
+    bool unparked1 = false;
+    bool unparked2 = false;
+    testSendLeaseUpdatesBatch(unparked1, unparked2);
+
+    EXPECT_FALSE(unparked1);
+    EXPECT_FALSE(unparked2);
+}
+
+// Test that the batch holds only the last operation for each lease, so the
+// lease allocated and then released by the queries in the same batch is
+// only sent as deleted.
+TEST_F(HAServiceTest, sendUpdatesBatchLastOperation) {
+    // Start HTTP servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setLeaseUpdatesBatchSize(100);
+    config_storage->setLeaseUpdatesFlushInterval(10);
+
+    ParkingLotPtr parking_lot(new ParkingLot());
+    ParkingLotHandlePtr parking_lot_handle(new ParkingLotHandle(parking_lot));
+
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    Lease4Ptr lease(new Lease4(IOAddress("192.1.2.3"), hwaddr,
+                               static_cast<const uint8_t*>(0), 0,
+                               60, 30, 40, 0, 1));
+    Lease4CollectionPtr no_leases(new Lease4Collection());
+
+    // The first query allocates the lease.
+    Pkt4Ptr query1(new Pkt4(DHCPREQUEST, 1234));
+    Lease4CollectionPtr leases1(new Lease4Collection());
+    leases1->push_back(lease);
+
+    // The second query releases it.
+    Pkt4Ptr query2(new Pkt4(DHCPRELEASE, 2345));
+    Lease4CollectionPtr deleted_leases2(new Lease4Collection());
+    deleted_leases2->push_back(lease);
+
+    TestHAService service(io_service_, network_state_, config_storage);
+    service.transition(HA_LOAD_BALANCING_ST, HAService::NOP_EVT);
+
+    EXPECT_EQ(2, service.asyncSendLeaseUpdates(query1, leases1, no_leases,
+                                               parking_lot_handle));
+    EXPECT_EQ(2, service.asyncSendLeaseUpdates(query2, no_leases, deleted_leases2,
+                                               parking_lot_handle));
+
+    bool unparked1 = false;
+    bool unparked2 = false;
+    ASSERT_NO_THROW(parking_lot->reference(query1));
+    ASSERT_NO_THROW(parking_lot->park(query1, [&unparked1] {
+        unparked1 = true;
+    }));
+    ASSERT_NO_THROW(parking_lot->reference(query2));
+    ASSERT_NO_THROW(parking_lot->park(query2, [&unparked2] {
+        unparked2 = true;
+    }));
+
+    ASSERT_NO_THROW(runIOService(TEST_TIMEOUT, [&service]() {
+        return (service.pending_requests_.empty());
+    }));
+
+    EXPECT_TRUE(unparked1);
+    EXPECT_TRUE(unparked2);
+
+    // The peer should have received the lease only as deleted.
+    auto requests = factory2_->getResponseCreator()->getReceivedRequests();
+    ASSERT_EQ(1, requests.size());
+    ConstElementPtr arguments = requests[0]->getBodyAsJson()->get("arguments");
+    ASSERT_TRUE(arguments);
+    ASSERT_TRUE(arguments->get("leases"));
+    EXPECT_TRUE(arguments->get("leases")->empty());
+    ConstElementPtr deleted_leases = arguments->get("deleted-leases");
+    ASSERT_TRUE(deleted_leases);
+    ASSERT_EQ(1, deleted_leases->size());
+    EXPECT_EQ("192.1.2.3",
+              deleted_leases->get(0)->get("ip-address")->stringValue());
+}
+
+// Test that the updates of the same lease are sent to the peer one after
+// another when multiple connections to the peer are allowed.
+TEST_F(HAServiceTest, sendUpdatesSameLeaseInOrder) {
+    // Start HTTP servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setHttpMaxConnections(4);
+
+    ParkingLotPtr parking_lot(new ParkingLot());
+    ParkingLotHandlePtr parking_lot_handle(new ParkingLotHandle(parking_lot));
+
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    Lease4Ptr lease(new Lease4(IOAddress("192.1.2.3"), hwaddr,
+                               static_cast<const uint8_t*>(0), 0,
+                               60, 30, 40, 0, 1));
+    Lease4CollectionPtr no_leases(new Lease4Collection());
+
+    // The first query allocates the lease.
+    Pkt4Ptr query1(new Pkt4(DHCPREQUEST, 1234));
+    Lease4CollectionPtr leases1(new Lease4Collection());
+    leases1->push_back(lease);
+
+    // The second query releases it.
+    Pkt4Ptr query2(new Pkt4(DHCPRELEASE, 2345));
+    Lease4CollectionPtr deleted_leases2(new Lease4Collection());
+    deleted_leases2->push_back(lease);
+
+    TestHAService service(io_service_, network_state_, config_storage);
+    service.transition(HA_LOAD_BALANCING_ST, HAService::NOP_EVT);
+
+    EXPECT_EQ(2, service.asyncSendLeaseUpdates(query1, leases1, no_leases,
+                                               parking_lot_handle));
+    EXPECT_EQ(2, service.asyncSendLeaseUpdates(query2, no_leases, deleted_leases2,
+                                               parking_lot_handle));
+
+    bool unparked1 = false;
+    bool unparked2 = false;
+    ASSERT_NO_THROW(parking_lot->reference(query1));
+    ASSERT_NO_THROW(parking_lot->park(query1, [&unparked1] {
+        unparked1 = true;
+    }));
+    ASSERT_NO_THROW(parking_lot->reference(query2));
+    ASSERT_NO_THROW(parking_lot->park(query2, [&unparked2] {
+        unparked2 = true;
+    }));
+
+    ASSERT_NO_THROW(runIOService(TEST_TIMEOUT, [&service]() {
+        return (service.pending_requests_.empty());
+    }));
+
+    EXPECT_TRUE(unparked1);
+    EXPECT_TRUE(unparked2);
+
+    // The peer should have received the update before the deletion.
+    auto requests = factory2_->getResponseCreator()->getReceivedRequests();
+    ASSERT_EQ(2, requests.size());
+    EXPECT_EQ("lease4-update",
+              requests[0]->getBodyAsJson()->get("command")->stringValue());
+    EXPECT_EQ("lease4-del",
+              requests[1]->getBodyAsJson()->get("command")->stringValue());
+}
+
 // Test scenario when lease updates are sent successfully to the backup server
 // and not sent to the failover peer when this server is in patrtner-down state.
 TEST_F(HAServiceTest, sendUpdatesPartnerDown) {
@@ -1527,6 +1874,15 @@ TEST_F(HAServiceTest, recurringHeartbeat) {
 
     // Server 2 should have received the heartbeat
     EXPECT_GE(factory2_->getResponseCreator()->getReceivedRequests().size(), 0);
+
+    // The statistics of the communication with the partner should have
+    // been published.
+    ObservationPtr completed =
+        StatsMgr::instance().getObservation("ha-peer[server2].http-requests-completed");
+    ASSERT_TRUE(completed);
+    EXPECT_GT(completed->getInteger().first, 0);
+    EXPECT_TRUE(StatsMgr::instance().getObservation("ha-peer[server2].http-latency-max"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("ha-peer[server3].http-connections-opened"));
 }
 
 // This test verifies that the heartbeat is considered being unsuccessful if the
@@ -1737,6 +2093,85 @@ TEST_F(HAServiceTest, asyncSyncLeasesServerOffline) {
     ASSERT_NO_THROW(runIOService(1000));
 }
 
+// This test verifies that IPv4 leases are fetched from the peer in pages
+// and that the page which failed is fetched again.
+TEST_F(HAServiceTest, asyncSyncLeasesPaged) {
+    // Create lease manager.
+    ASSERT_NO_THROW(LeaseMgrFactory::create("universe=4 type=memfile persist=false"));
+
+    // Create IPv4 leases which will be fetched from the other server.
+    ASSERT_NO_THROW(generateTestLeases4());
+
+    // Create HA configuration with the page size smaller than the number
+    // of leases.
+    HAConfigPtr config_storage = createValidConfiguration();
+    config_storage->setHeartbeatDelay(0);
+    config_storage->setSyncPageLimit(3);
+
+    ElementPtr response_arguments = Element::createMap();
+    response_arguments->set("leases", getTestLeases4AsJson());
+
+    factory2_->getResponseCreator()->setArguments("lease4-get-page", response_arguments);
+
+    // The first page is returned successfully but the second page fails
+    // at the first attempt.
+    factory2_->getResponseCreator()->queueControlResult("lease4-get-page",
+                                                        CONTROL_RESULT_SUCCESS);
+    factory2_->getResponseCreator()->queueControlResult("lease4-get-page",
+                                                        CONTROL_RESULT_ERROR);
+
+    // Start the servers.
+    ASSERT_NO_THROW({
+        listener_->start();
+        listener2_->start();
+        listener3_->start();
+    });
+
+    TestHAService service(io_service_, network_state_, config_storage);
+
+    bool sync_complete = false;
+    bool sync_success = false;
+    ASSERT_NO_THROW(service.asyncSyncLeases(service.client_,
+                                            [&](const bool success,
+                                                const std::string&) {
+        sync_complete = true;
+        sync_success = success;
+    }));
+
+    // Run IO service to actually perform the transaction.
+    ASSERT_NO_THROW(runIOService(TEST_TIMEOUT, [&sync_complete]() {
+        return (sync_complete);
+    }));
+
+    EXPECT_TRUE(sync_success);
+
+    // All leases should have been stored in the local database.
+    for (size_t i = 0; i < leases4_.size(); ++i) {
+        EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(leases4_[i]->addr_))
+            << "lease " << leases4_[i]->addr_.toText()
+            << " not in the lease database";
+    }
+
+    // There should be four pages (3, 3, 3 and 1 lease) and the second page
+    // should have been requested twice.
+    std::vector<std::string> from_addresses;
+    auto requests = factory2_->getResponseCreator()->getReceivedRequests();
+    for (auto r = requests.begin(); r != requests.end(); ++r) {
+        ConstElementPtr body = (*r)->getBodyAsJson();
+        ASSERT_TRUE(body);
+        if (body->get("command")->stringValue() == "lease4-get-page") {
+            from_addresses.push_back(body->get("arguments")->get("from")->stringValue());
+            EXPECT_EQ(3, body->get("arguments")->get("limit")->intValue());
+        }
+    }
+    ASSERT_EQ(5, from_addresses.size());
+    EXPECT_EQ("start", from_addresses[0]);
+    EXPECT_EQ(leases4_[2]->addr_.toText(), from_addresses[1]);
+    EXPECT_EQ(leases4_[2]->addr_.toText(), from_addresses[2]);
+    EXPECT_EQ(leases4_[5]->addr_.toText(), from_addresses[3]);
+    EXPECT_EQ(leases4_[8]->addr_.toText(), from_addresses[4]);
+}
+
 // This test verifies that IPv6 leases can be fetched from the peer and inserted
 // or updated in the local lease database.
 TEST_F(HAServiceTest, asyncSyncLeases6) {
@@ -1934,9 +2369,9 @@ TEST_F(HAServiceTest, processSynchronize4) {
     }
 
     // The following commands should have been sent to the server2: dhcp-disable,
-    // lease4-get-all and dhcp-enable.
+    // lease4-get-page and dhcp-enable.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-all",""));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-page",""));
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
@@ -1958,15 +2393,15 @@ TEST_F(HAServiceTest, processSynchronizeDisableError) {
     // The server2 should only receive dhcp-disable commands. Remaining two should
     // not be sent.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("lease4-get-all",""));
+    EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("lease4-get-page",""));
     EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
-// This test verifies that an error is reported when sending a lease4-get-all
+// This test verifies that an error is reported when sending a lease4-get-page
 // command causes an error.
-TEST_F(HAServiceTest, processSynchronizeLease4GetAllError) {
+TEST_F(HAServiceTest, processSynchronizeLease4GetPageError) {
     // Setup the server2 to return an error to dhcp-disable commands.
-    factory2_->getResponseCreator()->setControlResult("lease4-get-all",
+    factory2_->getResponseCreator()->setControlResult("lease4-get-page",
                                                       CONTROL_RESULT_ERROR);
 
     // Run HAService::processSynchronize and gather a response.
@@ -1980,7 +2415,7 @@ TEST_F(HAServiceTest, processSynchronizeLease4GetAllError) {
     // The server2 should receive all commands. The dhcp-disable was successful, so
     // the dhcp-enable command must be sent to re-enable the service after failure.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-all",""));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-page",""));
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
@@ -2001,7 +2436,7 @@ TEST_F(HAServiceTest, processSynchronizeEnableError) {
 
     // The server2 should receive all commands.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-all",""));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease4-get-page",""));
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
@@ -2027,9 +2462,9 @@ TEST_F(HAServiceTest, processSynchronize6) {
     }
 
     // The following commands should have been sent to the server2: dhcp-disable,
-    // lease6-get-all and dhcp-enable.
+    // lease6-get-page and dhcp-enable.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease6-get-all",""));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease6-get-page",""));
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
@@ -2051,15 +2486,15 @@ TEST_F(HAServiceTest, processSynchronize6DisableError) {
     // The server2 should only receive dhcp-disable commands. Remaining two should
     // not be sent.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("lease6-get-all",""));
+    EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("lease6-get-page",""));
     EXPECT_FALSE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
-// This test verifies that an error is reported when sending a lease6-get-all
+// This test verifies that an error is reported when sending a lease6-get-page
 // command causes an error.
-TEST_F(HAServiceTest, processSynchronizeLease6GetAllError) {
+TEST_F(HAServiceTest, processSynchronizeLease6GetPageError) {
     // Setup the server2 to return an error to dhcp-disable commands.
-    factory2_->getResponseCreator()->setControlResult("lease6-get-all",
+    factory2_->getResponseCreator()->setControlResult("lease6-get-page",
                                                       CONTROL_RESULT_ERROR);
 
     // Run HAService::processSynchronize and gather a response.
@@ -2073,7 +2508,7 @@ TEST_F(HAServiceTest, processSynchronizeLease6GetAllError) {
     // The server2 should receive all commands. The dhcp-disable was successful, so
     // the dhcp-enable command must be sent to re-enable the service after failure.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease6-get-all",""));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease6-get-page",""));
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
@@ -2094,7 +2529,7 @@ TEST_F(HAServiceTest, processSynchronize6EnableError) {
 
     // The server2 should receive all commands.
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-disable","20"));
-    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease6-get-all",""));
+    EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("lease6-get-page",""));
     EXPECT_TRUE(factory2_->getResponseCreator()->findRequest("dhcp-enable",""));
 }
 
@@ -2412,7 +2847,7 @@ public:
 
     /// @brief Enable response to commands required for leases synchronization.
     ///
-    /// Enables dhcp-disable, dhcp-enable and lease4-get-all commands. The last
+    /// Enables dhcp-disable, dhcp-enable and lease4-get-page commands. The last
     /// of them returns a bunch of test leases.
     void enableRespondLeaseFetching() {
         // Create IPv4 leases which will be fetched from the other server.
@@ -2425,7 +2860,7 @@ public:
         ElementPtr response_arguments = Element::createMap();
         response_arguments->set("leases", getLeasesAsJson(leases4));
 
-        factory_->getResponseCreator()->setArguments("lease4-get-all", response_arguments);
+        factory_->getResponseCreator()->setArguments("lease4-get-page", response_arguments);
     }
 
     /// @brief Starts up the partner.
@@ -3063,7 +3498,7 @@ TEST_F(HAServiceStateMachineTest, waitingSyncingReadyLoadBalancing) {
     // the partner's IO service in thread (in background).
     testSynchronousCommands([this, &partner]() {
 
-        // SYNCING state: the partner is up but it won't respond to the lease4-get-all
+        // SYNCING state: the partner is up but it won't respond to the lease4-get-page
         // command correctly. This should leave us in the SYNCING state until we finally
         // can synchronize.
         service_->runModel(HAService::NOP_EVT);
@@ -9,6 +9,7 @@
 #include <config/cmds_impl.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <cc/json_stream.h>
 #include <asiolink/io_address.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/lease_mgr.h>
@@ -202,6 +203,16 @@ public:
     int
     lease6UpdateHandler(CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply, lease6-bulk-apply commands handler
+    ///
+    /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::leaseBulkApplyHandler
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// bulk apply command JSON text in the "command" argument
+    /// @return 0 upon success, non-zero otherwise
+    int
+    leaseBulkApplyHandler(CalloutHandle& handle);
+
     /// @brief lease4-wipe handler
     ///
     /// Provides the implementation for @ref isc::lease_cmds::LeaseCmds::lease4WipeHandler
@@ -232,6 +243,16 @@ public:
     /// @return parsed parameters
     /// @throw BadValue if input arguments don't make sense.
     Parameters getParameters(bool v6, const ConstElementPtr& args);
+
+    /// @brief Appends a lease which couldn't be applied to the list
+    /// returned in the response to the bulk apply command.
+    ///
+    /// @param [out] failed_leases list to which the lease is appended.
+    /// @param lease lease in the JSON format as received in the command.
+    /// @param result control result indicating the reason of the failure.
+    /// @param error_message error message.
+    void addFailedLease(ElementPtr& failed_leases, const ConstElementPtr& lease,
+                        const int result, const std::string& error_message) const;
 };
 
 int
@@ -505,7 +526,10 @@ LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
         extractCommand(handle);
         v4 = (cmd_name_ == "lease4-get-all");
 
-        ElementPtr leases_json = Element::createList();
+        // The leases are converted to JSON while the response is being
+        // sent, so as the whole list is never held as Element tree.
+        boost::shared_ptr<std::vector<LeasePtr> >
+            leases(new std::vector<LeasePtr>());
 
         // The argument may contain a list of subnets for which leases should
         // be returned.
@@ -527,39 +551,34 @@ LeaseCmdsImpl::leaseGetAllHandler(CalloutHandle& handle) {
                 }
 
                 if (v4) {
-                    Lease4Collection leases =
+                    Lease4Collection subnet_leases =
                         LeaseMgrFactory::instance().getLeases4((*subnet_id)->intValue());
-                    for (auto lease : leases) {
-                        ElementPtr lease_json = lease->toElement();
-                        leases_json->add(lease_json);
-                    }
+                    leases->insert(leases->end(), subnet_leases.begin(),
+                                   subnet_leases.end());
                 } else {
-                    Lease6Collection leases =
+                    Lease6Collection subnet_leases =
                         LeaseMgrFactory::instance().getLeases6((*subnet_id)->intValue());
-                    for (auto lease : leases) {
-                        ElementPtr lease_json = lease->toElement();
-                        leases_json->add(lease_json);
-                    }
+                    leases->insert(leases->end(), subnet_leases.begin(),
+                                   subnet_leases.end());
                 }
             }
 
         } else {
             // There is no 'subnets' argument so let's return all leases.
             if (v4) {
-                Lease4Collection leases = LeaseMgrFactory::instance().getLeases4();
-                for (auto lease : leases) {
-                    ElementPtr lease_json = lease->toElement();
-                    leases_json->add(lease_json);
-                }
+                Lease4Collection all_leases = LeaseMgrFactory::instance().getLeases4();
+                leases->assign(all_leases.begin(), all_leases.end());
             } else {
-                Lease6Collection leases = LeaseMgrFactory::instance().getLeases6();
-                for (auto lease : leases) {
-                    ElementPtr lease_json = lease->toElement();
-                    leases_json->add(lease_json);
-                }
+                Lease6Collection all_leases = LeaseMgrFactory::instance().getLeases6();
+                leases->assign(all_leases.begin(), all_leases.end());
             }
         }
 
+        ElementPtr leases_json(new StreamedListElement(leases->size(),
+            [leases](const size_t i) {
+                return ((*leases)[i]->toElement());
+            }));
+
         std::ostringstream s;
         s << leases_json->size()
           << " IPv" << (v4 ? "4" : "6")
@@ -761,6 +780,9 @@ LeaseCmdsImpl::lease4DelHandler(CalloutHandle& handle) {
         }
 
         if (LeaseMgrFactory::instance().deleteLease(addr)) {
+            // The address can be allocated again.
+            CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+                resetPoolExhausted(addr);
             setSuccessResponse(handle, "IPv4 lease deleted.");
         } else {
             setErrorResponse (handle, "IPv4 lease not found.", CONTROL_RESULT_EMPTY);
@@ -900,6 +922,142 @@ LeaseCmdsImpl::lease6UpdateHandler(CalloutHandle& handle) {
     return (0);
 }
 
+int
+LeaseCmdsImpl::leaseBulkApplyHandler(CalloutHandle& handle) {
+    bool v4 = true;
+    try {
+        extractCommand(handle);
+        v4 = (cmd_name_ == "lease4-bulk-apply");
+
+        if (!cmd_args_ || (cmd_args_->getType() != Element::map)) {
+            isc_throw(BadValue, "no parameters specified for the " << cmd_name_
+                      << " command");
+        }
+
+        ConstElementPtr deleted_leases = cmd_args_->get("deleted-leases");
+        ConstElementPtr leases = cmd_args_->get("leases");
+        if (!deleted_leases && !leases) {
+            isc_throw(BadValue, "neither 'deleted-leases' nor 'leases' parameter"
+                      " specified for the " << cmd_name_ << " command");
+        }
+        if (deleted_leases && (deleted_leases->getType() != Element::list)) {
+            isc_throw(BadValue, "'deleted-leases' parameter must be a list");
+        }
+        if (leases && (leases->getType() != Element::list)) {
+            isc_throw(BadValue, "'leases' parameter must be a list");
+        }
+
+        ElementPtr failed_deleted_leases = Element::createList();
+        ElementPtr failed_leases = Element::createList();
+        size_t applied = 0;
+
+        // Delete the leases by address.
+        if (deleted_leases) {
+            for (auto lease : deleted_leases->listValue()) {
+                try {
+                    if (lease->getType() != Element::map) {
+                        isc_throw(BadValue, "lease must be a map");
+                    }
+                    ConstElementPtr address = lease->get("ip-address");
+                    if (!address || (address->getType() != Element::string)) {
+                        isc_throw(BadValue, "'ip-address' parameter is missing");
+                    }
+                    IOAddress addr(address->stringValue());
+                    if (addr.isV4() != v4) {
+                        isc_throw(BadValue, "invalid address " << addr.toText()
+                                  << " for the " << cmd_name_ << " command");
+                    }
+                    if (LeaseMgrFactory::instance().deleteLease(addr)) {
+                        if (v4) {
+                            CfgMgr::instance().getCurrentCfg()->
+                                getCfgSubnets4()->resetPoolExhausted(addr);
+                        }
+                        ++applied;
+                    } else {
+                        addFailedLease(failed_deleted_leases, lease,
+                                       CONTROL_RESULT_EMPTY, "lease not found");
+                    }
+
+                } catch (const std::exception& ex) {
+                    addFailedLease(failed_deleted_leases, lease,
+                                   CONTROL_RESULT_ERROR, ex.what());
+                }
+            }
+        }
+
+        // Update the leases or create them if they don't exist and
+        // the creation is forced.
+        if (leases) {
+            ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
+            for (auto lease : leases->listValue()) {
+                try {
+                    bool force_create = false;
+                    if (v4) {
+                        Lease4Parser parser;
+                        Lease4Ptr lease4 = parser.parse(config, lease, force_create);
+                        if (force_create &&
+                            !LeaseMgrFactory::instance().getLease4(lease4->addr_)) {
+                            LeaseMgrFactory::instance().addLease(lease4);
+                        } else {
+                            LeaseMgrFactory::instance().updateLease4(lease4);
+                        }
+
+                    } else {
+                        Lease6Parser parser;
+                        Lease6Ptr lease6 = parser.parse(config, lease, force_create);
+                        if (force_create &&
+                            !LeaseMgrFactory::instance().getLease6(lease6->type_,
+                                                                   lease6->addr_)) {
+                            LeaseMgrFactory::instance().addLease(lease6);
+                        } else {
+                            LeaseMgrFactory::instance().updateLease6(lease6);
+                        }
+                    }
+                    ++applied;
+
+                } catch (const std::exception& ex) {
+                    addFailedLease(failed_leases, lease, CONTROL_RESULT_ERROR,
+                                   ex.what());
+                }
+            }
+        }
+
+        std::ostringstream s;
+        s << "Bulk apply of " << applied << " IPv" << (v4 ? "4" : "6")
+          << " lease(s) completed.";
+
+        ElementPtr args;
+        if (!failed_deleted_leases->empty() || !failed_leases->empty()) {
+            args = Element::createMap();
+            args->set("failed-deleted-leases", failed_deleted_leases);
+            args->set("failed-leases", failed_leases);
+        }
+        ConstElementPtr response = createAnswer(CONTROL_RESULT_SUCCESS, s.str(), args);
+        setResponse(handle, response);
+
+    } catch (const std::exception& ex) {
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    return (0);
+}
+
+void
+LeaseCmdsImpl::addFailedLease(ElementPtr& failed_leases,
+                              const ConstElementPtr& lease,
+                              const int result,
+                              const std::string& error_message) const {
+    ElementPtr failed_lease = Element::createMap();
+    if (lease && (lease->getType() == Element::map) &&
+        lease->contains("ip-address")) {
+        failed_lease->set("ip-address", lease->get("ip-address"));
+    }
+    failed_lease->set("result", Element::create(result));
+    failed_lease->set("error-message", Element::create(error_message));
+    failed_leases->add(failed_lease);
+}
+
 int
 LeaseCmdsImpl::lease4WipeHandler(CalloutHandle& handle) {
     try {
@@ -920,6 +1078,11 @@ LeaseCmdsImpl::lease4WipeHandler(CalloutHandle& handle) {
             // Wipe a single subnet
             num = LeaseMgrFactory::instance().wipeLeases4(id);
             ids << " " << id;
+            Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+                getCfgSubnets4()->getSubnet(id);
+            if (subnet) {
+                subnet->resetPoolsExhausted(Lease::TYPE_V4);
+            }
         } else {
             // Wipe them all!
             ConstSrvConfigPtr config = CfgMgr::instance().getCurrentCfg();
@@ -930,6 +1093,7 @@ LeaseCmdsImpl::lease4WipeHandler(CalloutHandle& handle) {
             for (auto sub : *subs) {
                 num += LeaseMgrFactory::instance().wipeLeases4(sub->getID());
                 ids << " " << sub->getID();
+                sub->resetPoolsExhausted(Lease::TYPE_V4);
             }
         }
 
@@ -1038,6 +1202,11 @@ LeaseCmds::lease6UpdateHandler(CalloutHandle& handle) {
     return(impl_->lease6UpdateHandler(handle));
 }
 
+int
+LeaseCmds::leaseBulkApplyHandler(CalloutHandle& handle) {
+    return (impl_->leaseBulkApplyHandler(handle));
+}
+
 int
 LeaseCmds::lease4WipeHandler(CalloutHandle& handle) {
    return(impl_->lease4WipeHandler(handle));
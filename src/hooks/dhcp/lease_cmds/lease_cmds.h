@@ -314,6 +314,46 @@ public:
     int
     lease6UpdateHandler(hooks::CalloutHandle& handle);
 
+    /// @brief lease4-bulk-apply, lease6-bulk-apply commands handler
+    ///
+    /// These commands update or delete multiple leases in a single call.
+    /// They are mostly used by the High Availability hooks library to
+    /// send lease updates to the partner in batches, rather than sending
+    /// a separate command for each lease. The leases listed in the
+    /// "leases" parameter are updated, or created if they don't exist and
+    /// the "force-create" parameter is set for them. The leases listed in
+    /// the "deleted-leases" parameter are deleted by address.
+    ///
+    /// The failure to apply one of the leases doesn't prevent the other
+    /// leases from being applied. The leases which couldn't be applied are
+    /// listed in the response with the result and error message.
+    ///
+    /// Example command:
+    /// {
+    ///     "command": "lease4-bulk-apply",
+    ///     "arguments": {
+    ///         "deleted-leases": [
+    ///             {
+    ///                 "ip-address": "192.0.2.202"
+    ///             }
+    ///         ],
+    ///         "leases": [
+    ///             {
+    ///                 "subnet-id": 44,
+    ///                 "ip-address": "192.0.2.1",
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f",
+    ///                 "force-create": true
+    ///             }
+    ///         ]
+    ///     }
+    /// }
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// bulk apply command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    leaseBulkApplyHandler(hooks::CalloutHandle& handle);
+
     /// @brief lease4-wipe handler
     ///
     /// This commands attempts to remove all IPv4 leases from a specific
@@ -154,6 +154,28 @@ int lease6_update(CalloutHandle& handle) {
     return(lease_cmds.lease6UpdateHandler(handle));
 }
 
+/// @brief This is a command callout for 'lease4-bulk-apply' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease4_bulk_apply(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return (lease_cmds.leaseBulkApplyHandler(handle));
+}
+
+/// @brief This is a command callout for 'lease6-bulk-apply' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int lease6_bulk_apply(CalloutHandle& handle) {
+    LeaseCmds lease_cmds;
+    return (lease_cmds.leaseBulkApplyHandler(handle));
+}
+
 /// @brief This is a command callout for 'lease4-wipe' command.
 ///
 /// @param handle Callout handle used to retrieve a command and
@@ -193,6 +215,8 @@ int load(LibraryHandle& handle) {
     handle.registerCommandCallout("lease6-del", lease6_del);
     handle.registerCommandCallout("lease4-update", lease4_update);
     handle.registerCommandCallout("lease6-update", lease6_update);
+    handle.registerCommandCallout("lease4-bulk-apply", lease4_bulk_apply);
+    handle.registerCommandCallout("lease6-bulk-apply", lease6_bulk_apply);
     handle.registerCommandCallout("lease4-wipe", lease4_wipe);
     handle.registerCommandCallout("lease6-wipe", lease6_wipe);
 
@@ -14,6 +14,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <cc/command_interpreter.h>
 #include <cc/data.h>
+#include <cc/json_stream.h>
 #include <testutils/user_context_utils.h>
 #include <gtest/gtest.h>
 #include <errno.h>
@@ -485,6 +486,7 @@ TEST_F(LeaseCmdsTest, commands) {
                             "lease4-get-page", "lease6-get-page",
                             "lease4-del",      "lease6-del",
                             "lease4-update",   "lease6-update",
+                            "lease4-bulk-apply", "lease6-bulk-apply",
                             "lease4-wipe",     "lease6-wipe" };
     testCommands(cmds);
 }
@@ -1678,6 +1680,9 @@ TEST_F(LeaseCmdsTest, Lease4GetAll) {
     ASSERT_TRUE(leases);
     ASSERT_EQ(Element::list, leases->getType());
 
+    // The leases are converted to JSON while the response is being sent.
+    EXPECT_TRUE(boost::dynamic_pointer_cast<const StreamedListElement>(leases));
+
     // Let's check if the response contains desired leases.
     checkLease4(leases, "192.0.2.1", 44, "08:08:08:08:08:08", true);
     checkLease4(leases, "192.0.2.2", 44, "09:09:09:09:09:09", true);
@@ -3573,6 +3578,153 @@ TEST_F(LeaseCmdsTest, Lease6DelByDUID) {
     EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1")));
 }
 
+// Checks that lease4-bulk-apply updates, creates and deletes multiple
+// leases and reports those which couldn't be applied.
+TEST_F(LeaseCmdsTest, Lease4BulkApply) {
+    // Initialize lease manager (false = v4, true = add leases)
+    initLeaseMgr(false, true);
+
+    // Check that the lease manager pointer is there.
+    ASSERT_TRUE(lmptr_);
+
+    // Update an existing lease, create a new one, fail to create a lease
+    // in non-existing subnet, delete an existing lease and a non-existing
+    // lease.
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            { \"ip-address\": \"192.0.2.2\" },"
+        "            { \"ip-address\": \"192.0.2.200\" }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.1\",\n"
+        "                \"hw-address\": \"1a:1b:1c:1d:1e:1f\",\n"
+        "                \"hostname\": \"newhostname.example.org\""
+        "            },"
+        "            {"
+        "                \"subnet-id\": 44,\n"
+        "                \"ip-address\": \"192.0.2.10\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\",\n"
+        "                \"force-create\": true"
+        "            },"
+        "            {"
+        "                \"subnet-id\": 123,\n"
+        "                \"ip-address\": \"192.0.5.1\",\n"
+        "                \"hw-address\": \"2a:2b:2c:2d:2e:2f\",\n"
+        "                \"force-create\": true"
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    string exp_rsp = "Bulk apply of 3 IPv4 lease(s) completed.";
+    ConstElementPtr rsp = testCommand(txt, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ASSERT_TRUE(rsp);
+
+    // The leases which couldn't be applied are listed in the response.
+    ConstElementPtr args = rsp->get("arguments");
+    ASSERT_TRUE(args);
+    ConstElementPtr failed = args->get("failed-deleted-leases");
+    ASSERT_TRUE(failed);
+    ASSERT_EQ(1, failed->size());
+    EXPECT_EQ("192.0.2.200", failed->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ(CONTROL_RESULT_EMPTY, failed->get(0)->get("result")->intValue());
+
+    failed = args->get("failed-leases");
+    ASSERT_TRUE(failed);
+    ASSERT_EQ(1, failed->size());
+    EXPECT_EQ("192.0.5.1", failed->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ(CONTROL_RESULT_ERROR, failed->get(0)->get("result")->intValue());
+
+    // Check the leases.
+    Lease4Ptr l = lmptr_->getLease4(IOAddress("192.0.2.1"));
+    ASSERT_TRUE(l);
+    EXPECT_EQ("newhostname.example.org", l->hostname_);
+    l = lmptr_->getLease4(IOAddress("192.0.2.10"));
+    ASSERT_TRUE(l);
+    ASSERT_TRUE(l->hwaddr_);
+    EXPECT_EQ("2a:2b:2c:2d:2e:2f", l->hwaddr_->toText(false));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.2.2")));
+    EXPECT_FALSE(lmptr_->getLease4(IOAddress("192.0.5.1")));
+}
+
+// Checks that lease6-bulk-apply updates and deletes multiple leases.
+TEST_F(LeaseCmdsTest, Lease6BulkApply) {
+    // Initialize lease manager (true = v6, true = add leases)
+    initLeaseMgr(true, true);
+
+    // Check that the lease manager pointer is there.
+    ASSERT_TRUE(lmptr_);
+
+    string txt =
+        "{\n"
+        "    \"command\": \"lease6-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"deleted-leases\": ["
+        "            { \"ip-address\": \"2001:db8:1::2\" }"
+        "        ],"
+        "        \"leases\": ["
+        "            {"
+        "                \"subnet-id\": 66,\n"
+        "                \"ip-address\": \"2001:db8:1::1\",\n"
+        "                \"iaid\": 7654321,\n"
+        "                \"duid\": \"88:88:88:88:88:88:88:88\",\n"
+        "                \"hostname\": \"newhostname.example.org\""
+        "            }"
+        "        ]"
+        "    }\n"
+        "}";
+    string exp_rsp = "Bulk apply of 2 IPv6 lease(s) completed.";
+    ConstElementPtr rsp = testCommand(txt, CONTROL_RESULT_SUCCESS, exp_rsp);
+    ASSERT_TRUE(rsp);
+
+    // All leases have been applied, so there are no arguments.
+    EXPECT_FALSE(rsp->get("arguments"));
+
+    Lease6Ptr l = lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::1"));
+    ASSERT_TRUE(l);
+    EXPECT_EQ("newhostname.example.org", l->hostname_);
+    EXPECT_FALSE(lmptr_->getLease6(Lease::TYPE_NA, IOAddress("2001:db8:1::2")));
+}
+
+// Checks that lease4-bulk-apply and lease6-bulk-apply reject malformed
+// arguments.
+TEST_F(LeaseCmdsTest, LeaseBulkApplyBadParams) {
+    // Initialize lease manager (false = v4, false = don't add leases)
+    initLeaseMgr(false, false);
+
+    // No arguments.
+    string txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\"\n"
+        "}";
+    testCommand(txt, CONTROL_RESULT_ERROR,
+                "no parameters specified for the lease4-bulk-apply command");
+
+    // No leases.
+    txt =
+        "{\n"
+        "    \"command\": \"lease4-bulk-apply\",\n"
+        "    \"arguments\": { }"
+        "}";
+    testCommand(txt, CONTROL_RESULT_ERROR,
+                "neither 'deleted-leases' nor 'leases' parameter specified"
+                " for the lease4-bulk-apply command");
+
+    // Leases not in a list.
+    txt =
+        "{\n"
+        "    \"command\": \"lease6-bulk-apply\",\n"
+        "    \"arguments\": {"
+        "        \"leases\": { }"
+        "    }"
+        "}";
+    testCommand(txt, CONTROL_RESULT_ERROR, "'leases' parameter must be a list");
+}
+
 // Checks that lease4-wipe can remove leases.
 TEST_F(LeaseCmdsTest, Lease4Wipe) {
 
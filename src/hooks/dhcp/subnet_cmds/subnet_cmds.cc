@@ -0,0 +1,804 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <config/command_mgr.h>
+#include <config/cmds_impl.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <cc/simple_parser.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/host.h>
+#include <dhcpsrv/shared_network.h>
+#include <dhcpsrv/subnet.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/host_reservation_parser.h>
+#include <dhcpsrv/parsers/host_reservations_list_parser.h>
+#include <dhcpsrv/parsers/simple_parser4.h>
+#include <dhcpsrv/parsers/simple_parser6.h>
+#include <exceptions/exceptions.h>
+#include <hooks/hooks.h>
+#include <subnet_cmds.h>
+#include <subnet_cmds_log.h>
+
+#include <boost/pointer_cast.hpp>
+#include <limits>
+#include <sstream>
+#include <string>
+
+using namespace isc::dhcp;
+using namespace isc::data;
+using namespace isc::config;
+using namespace isc::asiolink;
+using namespace isc::hooks;
+using namespace std;
+
+namespace isc {
+namespace subnet_cmds {
+
+/// @brief Wrapper class around the implementation of the subnet commands.
+class SubnetCmdsImpl : private CmdsImpl {
+public:
+
+    /// @brief Parsed subnet along with its host reservations.
+    class Parameters {
+    public:
+
+        /// @brief Default constructor.
+        Parameters()
+            : subnet_(), hosts_(), has_reservations_(false) {
+        }
+
+        /// @brief Parsed subnet.
+        SubnetPtr subnet_;
+
+        /// @brief Parsed host reservations belonging to the subnet.
+        HostCollection hosts_;
+
+        /// @brief Indicates if the "reservations" list was specified.
+        bool has_reservations_;
+    };
+
+    /// @brief subnet4-add, subnet6-add command handler
+    ///
+    /// @param handle Callout context.
+    /// @return 0 upon success, non-zero otherwise
+    int subnetAddHandler(CalloutHandle& handle);
+
+    /// @brief subnet4-update, subnet6-update command handler
+    ///
+    /// @param handle Callout context.
+    /// @return 0 upon success, non-zero otherwise
+    int subnetUpdateHandler(CalloutHandle& handle);
+
+    /// @brief subnet4-del, subnet6-del command handler
+    ///
+    /// @param handle Callout context.
+    /// @return 0 upon success, non-zero otherwise
+    int subnetDelHandler(CalloutHandle& handle);
+
+    /// @brief reservation-add command handler
+    ///
+    /// @param handle Callout context.
+    /// @return 0 upon success, non-zero otherwise
+    int reservationAddHandler(CalloutHandle& handle);
+
+    /// @brief reservation-del command handler
+    ///
+    /// @param handle Callout context.
+    /// @return 0 upon success, non-zero otherwise
+    int reservationDelHandler(CalloutHandle& handle);
+
+private:
+
+    /// @brief Extracts and parses the subnet from the command arguments.
+    ///
+    /// The subnet is parsed by the same parsers as used during the server
+    /// configuration. The parameters not specified for the subnet are
+    /// derived from the global parameters of the current configuration.
+    /// The option definitions of the current configuration are used to
+    /// parse the options.
+    ///
+    /// @param v6 Boolean value indicating if this is IPv6 subnet.
+    /// @param cmd_args Command arguments holding the subnet list.
+    /// @return Parsed subnet along with its host reservations.
+    /// @throw BadValue if the arguments are invalid.
+    Parameters getParameters(const bool v6, const ConstElementPtr& cmd_args);
+
+    /// @brief Extracts the subnet identifier from the command arguments.
+    ///
+    /// @param cmd_args Command arguments.
+    /// @param name Name of the parameter holding the subnet identifier.
+    /// @return Subnet identifier.
+    /// @throw BadValue if the identifier is missing or invalid.
+    SubnetID getSubnetId(const ConstElementPtr& cmd_args,
+                         const std::string& name) const;
+
+    /// @brief Returns the parameters of the shared network to which the
+    /// subnet belongs in the current configuration.
+    ///
+    /// @param v6 Boolean value indicating if this is IPv6 subnet.
+    /// @param subnet_id Subnet identifier.
+    /// @return Shared network parameters or null pointer if the subnet
+    /// doesn't exist or doesn't belong to a shared network.
+    ConstElementPtr getSharedNetworkParameters(const bool v6,
+                                               const SubnetID& subnet_id) const;
+
+    /// @brief Checks if the subnet with the specified identifier exists
+    /// in the current configuration.
+    ///
+    /// @param v6 Boolean value indicating if this is IPv6 subnet.
+    /// @param subnet_id Subnet identifier.
+    /// @return true if the subnet exists, false otherwise.
+    bool subnetExists(const bool v6, const SubnetID& subnet_id) const;
+
+    /// @brief Adds host reservations to the current configuration.
+    ///
+    /// @param hosts Host reservations to be added.
+    void addHosts(const HostCollection& hosts) const;
+
+    /// @brief Invalidates the configuration data derived from subnets.
+    ///
+    /// The options resolved for the configured option lists are cached
+    /// until the next configuration is committed. This cache must be
+    /// cleared when the configuration is modified in place. The parsed
+    /// configuration is reset too, so the next configuration doesn't
+    /// reuse the subnets and reservations which no longer match it.
+    void configModified() const;
+};
+
+SubnetCmdsImpl::Parameters
+SubnetCmdsImpl::getParameters(const bool v6, const ConstElementPtr& cmd_args) {
+    const std::string list_name = (v6 ? "subnet6" : "subnet4");
+
+    if (!cmd_args || (cmd_args->getType() != Element::map)) {
+        isc_throw(BadValue, "Parameters missing or are not a map.");
+    }
+
+    ConstElementPtr subnets = cmd_args->get(list_name);
+    if (!subnets || (subnets->getType() != Element::list) ||
+        (subnets->size() != 1)) {
+        isc_throw(BadValue, "'" << list_name << "' parameter must be a list"
+                  " holding exactly one subnet");
+    }
+
+    ConstElementPtr subnet = subnets->get(0);
+    if (subnet->getType() != Element::map) {
+        isc_throw(BadValue, "subnet specified in the '" << list_name
+                  << "' list is not a map");
+    }
+
+    // The subnet identifier is used to locate the subnet in the current
+    // configuration so it can't be generated.
+    SubnetID subnet_id = getSubnetId(subnet, "id");
+
+    // Do not modify the arguments of the command.
+    ElementPtr subnet_copy = copy(subnet);
+
+    // The reservations are parsed separately, so as they don't go to the
+    // staging configuration.
+    Parameters params;
+    ConstElementPtr reservations = subnet_copy->get("reservations");
+    if (reservations) {
+        params.has_reservations_ = true;
+        subnet_copy->remove("reservations");
+    }
+
+    // Derive the parameters not specified for the subnet.
+    ElementPtr globals = Element::createMap();
+    ConstElementPtr configured_globals =
+        CfgMgr::instance().getCurrentCfg()->getConfiguredGlobals();
+    if (configured_globals) {
+        globals = copy(configured_globals);
+    }
+    // The subnet belonging to a shared network inherits the parameters
+    // of the shared network first, as during the server configuration.
+    ConstElementPtr network = getSharedNetworkParameters(v6, subnet_id);
+    if (v6) {
+        SimpleParser::setDefaults(subnet_copy, SimpleParser6::SUBNET6_DEFAULTS);
+        if (network) {
+            SimpleParser::deriveParams(network, subnet_copy,
+                                       SimpleParser6::INHERIT_TO_SUBNET6);
+        }
+        SimpleParser::setDefaults(globals, SimpleParser6::GLOBAL6_DEFAULTS);
+        SimpleParser::deriveParams(globals, subnet_copy,
+                                   SimpleParser6::INHERIT_TO_SUBNET6);
+    } else {
+        SimpleParser::setDefaults(subnet_copy, SimpleParser4::SUBNET4_DEFAULTS);
+        if (network) {
+            SimpleParser::deriveParams(network, subnet_copy,
+                                       SimpleParser4::INHERIT_TO_SUBNET4);
+        }
+        SimpleParser::setDefaults(globals, SimpleParser4::GLOBAL4_DEFAULTS);
+        SimpleParser::deriveParams(globals, subnet_copy,
+                                   SimpleParser4::INHERIT_TO_SUBNET4);
+    }
+
+    // The parsers look up the option definitions in the staging
+    // configuration. Use a fresh staging configuration holding the option
+    // definitions of the current configuration and discard it afterwards.
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    cfg_mgr.rollback();
+    try {
+        cfg_mgr.getCurrentCfg()->getCfgOptionDef()->
+            copyTo(*cfg_mgr.getStagingCfg()->getCfgOptionDef());
+
+        if (v6) {
+            Subnet6ConfigParser parser;
+            params.subnet_ = parser.parse(subnet_copy);
+        } else {
+            Subnet4ConfigParser parser;
+            params.subnet_ = parser.parse(subnet_copy);
+        }
+
+        if (reservations) {
+            if (v6) {
+                HostReservationsListParser<HostReservationParser6> parser;
+                parser.parse(params.subnet_->getID(), reservations,
+                             params.hosts_);
+            } else {
+                HostReservationsListParser<HostReservationParser4> parser;
+                parser.parse(params.subnet_->getID(), reservations,
+                             params.hosts_);
+            }
+        }
+
+    } catch (...) {
+        cfg_mgr.rollback();
+        throw;
+    }
+    cfg_mgr.rollback();
+
+    return (params);
+}
+
+SubnetID
+SubnetCmdsImpl::getSubnetId(const ConstElementPtr& cmd_args,
+                            const std::string& name) const {
+    if (!cmd_args || (cmd_args->getType() != Element::map)) {
+        isc_throw(BadValue, "Parameters missing or are not a map.");
+    }
+
+    ConstElementPtr id = cmd_args->get(name);
+    if (!id) {
+        isc_throw(BadValue, "'" << name << "' parameter is mandatory");
+    }
+
+    if (id->getType() != Element::integer) {
+        isc_throw(BadValue, "'" << name << "' parameter must be an integer");
+    }
+
+    if ((id->intValue() <= 0) ||
+        (id->intValue() > std::numeric_limits<SubnetID>::max())) {
+        isc_throw(BadValue, "'" << name << "' parameter value "
+                  << id->intValue() << " is out of range");
+    }
+
+    return (static_cast<SubnetID>(id->intValue()));
+}
+
+ConstElementPtr
+SubnetCmdsImpl::getSharedNetworkParameters(const bool v6,
+                                           const SubnetID& subnet_id) const {
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    if (v6) {
+        Subnet6Ptr subnet = cfg->getCfgSubnets6()->getSubnet(subnet_id);
+        SharedNetwork6Ptr network;
+        if (subnet) {
+            subnet->getSharedNetwork(network);
+        }
+        return (network ? network->toElement() : ConstElementPtr());
+    }
+
+    Subnet4Ptr subnet = cfg->getCfgSubnets4()->getSubnet(subnet_id);
+    SharedNetwork4Ptr network;
+    if (subnet) {
+        subnet->getSharedNetwork(network);
+    }
+    return (network ? network->toElement() : ConstElementPtr());
+}
+
+bool
+SubnetCmdsImpl::subnetExists(const bool v6, const SubnetID& subnet_id) const {
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    if (v6) {
+        return (static_cast<bool>(cfg->getCfgSubnets6()->getSubnet(subnet_id)));
+    }
+    return (static_cast<bool>(cfg->getCfgSubnets4()->getSubnet(subnet_id)));
+}
+
+void
+SubnetCmdsImpl::addHosts(const HostCollection& hosts) const {
+    CfgHostsPtr cfg_hosts = CfgMgr::instance().getCurrentCfg()->getCfgHosts();
+    for (HostCollection::const_iterator host = hosts.begin();
+         host != hosts.end(); ++host) {
+        cfg_hosts->add(*host);
+    }
+}
+
+void
+SubnetCmdsImpl::configModified() const {
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    cfg->getCfgOptionListCache()->clear();
+    cfg->setParsedConfig(ConstElementPtr());
+}
+
+int
+SubnetCmdsImpl::subnetAddHandler(CalloutHandle& handle) {
+    bool v6 = false;
+    string txt = "malformed command";
+
+    stringstream resp;
+    try {
+        extractCommand(handle);
+        v6 = (cmd_name_ == "subnet6-add");
+
+        txt = "(missing parameters)";
+        if (!cmd_args_) {
+            isc_throw(isc::BadValue, "no parameters specified for the command");
+        }
+
+        txt = cmd_args_->str();
+
+        Parameters params = getParameters(v6, cmd_args_);
+        SubnetID subnet_id = params.subnet_->getID();
+        SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+        CfgHostsPtr cfg_hosts = cfg->getCfgHosts();
+
+        if (v6) {
+            Subnet6Ptr subnet = boost::dynamic_pointer_cast<Subnet6>(params.subnet_);
+            cfg->getCfgSubnets6()->add(subnet);
+            try {
+                addHosts(params.hosts_);
+            } catch (...) {
+                cfg_hosts->delAll6(subnet_id);
+                cfg->getCfgSubnets6()->del(subnet);
+                throw;
+            }
+            CfgSubnets6::updateStatistics(subnet, true);
+
+        } else {
+            Subnet4Ptr subnet = boost::dynamic_pointer_cast<Subnet4>(params.subnet_);
+            cfg->getCfgSubnets4()->add(subnet);
+            try {
+                addHosts(params.hosts_);
+            } catch (...) {
+                cfg_hosts->delAll4(subnet_id);
+                cfg->getCfgSubnets4()->del(subnet);
+                throw;
+            }
+            CfgSubnets4::updateStatistics(subnet, true);
+        }
+
+        configModified();
+
+        resp << "IPv" << (v6 ? "6" : "4") << " subnet " << subnet_id
+             << " (" << params.subnet_->toText() << ") added";
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger, v6 ? SUBNET_CMDS_ADD6_FAILED :
+                  SUBNET_CMDS_ADD4_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    LOG_INFO(subnet_cmds_logger, v6 ? SUBNET_CMDS_ADD6 : SUBNET_CMDS_ADD4)
+        .arg(resp.str());
+    setSuccessResponse(handle, resp.str());
+    return (0);
+}
+
+int
+SubnetCmdsImpl::subnetUpdateHandler(CalloutHandle& handle) {
+    bool v6 = false;
+    string txt = "malformed command";
+
+    stringstream resp;
+    try {
+        extractCommand(handle);
+        v6 = (cmd_name_ == "subnet6-update");
+
+        txt = "(missing parameters)";
+        if (!cmd_args_) {
+            isc_throw(isc::BadValue, "no parameters specified for the command");
+        }
+
+        txt = cmd_args_->str();
+
+        Parameters params = getParameters(v6, cmd_args_);
+        SubnetID subnet_id = params.subnet_->getID();
+        if (!subnetExists(v6, subnet_id)) {
+            resp << "IPv" << (v6 ? "6" : "4") << " subnet " << subnet_id
+                 << " not found";
+            ConstElementPtr response = createAnswer(CONTROL_RESULT_EMPTY,
+                                                    resp.str());
+            setResponse(handle, response);
+            return (0);
+        }
+
+        SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+        CfgHostsPtr cfg_hosts = cfg->getCfgHosts();
+
+        if (v6) {
+            Subnet6Ptr subnet = boost::dynamic_pointer_cast<Subnet6>(params.subnet_);
+            Subnet6Ptr old_subnet = cfg->getCfgSubnets6()->replace(subnet);
+            SharedNetwork6Ptr network;
+            old_subnet->getSharedNetwork(network);
+            HostCollection old_hosts;
+            if (params.has_reservations_) {
+                old_hosts = cfg_hosts->getAll6(subnet_id);
+            }
+
+            try {
+                // The new subnet belongs to the same shared network.
+                if (network) {
+                    network->del(subnet_id);
+                    network->add(subnet);
+                }
+
+                if (params.has_reservations_) {
+                    cfg_hosts->delAll6(subnet_id);
+                    addHosts(params.hosts_);
+                }
+
+            } catch (...) {
+                // Restore the old subnet along with its host reservations,
+                // e.g. when the new reservations conflict with each other.
+                if (params.has_reservations_) {
+                    cfg_hosts->delAll6(subnet_id);
+                    addHosts(old_hosts);
+                }
+                if (network && (network->getSubnet(subnet_id) != old_subnet)) {
+                    if (network->getSubnet(subnet_id)) {
+                        network->del(subnet_id);
+                    }
+                    network->add(old_subnet);
+                }
+                cfg->getCfgSubnets6()->replace(old_subnet);
+                throw;
+            }
+            CfgSubnets6::updateStatistics(subnet, false);
+
+        } else {
+            Subnet4Ptr subnet = boost::dynamic_pointer_cast<Subnet4>(params.subnet_);
+            Subnet4Ptr old_subnet = cfg->getCfgSubnets4()->replace(subnet);
+            SharedNetwork4Ptr network;
+            old_subnet->getSharedNetwork(network);
+            HostCollection old_hosts;
+            if (params.has_reservations_) {
+                old_hosts = cfg_hosts->getAll4(subnet_id);
+            }
+
+            try {
+                // The new subnet belongs to the same shared network.
+                if (network) {
+                    network->del(subnet_id);
+                    network->add(subnet);
+                }
+
+                if (params.has_reservations_) {
+                    cfg_hosts->delAll4(subnet_id);
+                    addHosts(params.hosts_);
+                }
+
+            } catch (...) {
+                // Restore the old subnet along with its host reservations,
+                // e.g. when the new reservations conflict with each other.
+                if (params.has_reservations_) {
+                    cfg_hosts->delAll4(subnet_id);
+                    addHosts(old_hosts);
+                }
+                if (network && (network->getSubnet(subnet_id) != old_subnet)) {
+                    if (network->getSubnet(subnet_id)) {
+                        network->del(subnet_id);
+                    }
+                    network->add(old_subnet);
+                }
+                cfg->getCfgSubnets4()->replace(old_subnet);
+                throw;
+            }
+            CfgSubnets4::updateStatistics(subnet, false);
+        }
+
+        configModified();
+
+        resp << "IPv" << (v6 ? "6" : "4") << " subnet " << subnet_id
+             << " (" << params.subnet_->toText() << ") updated";
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger, v6 ? SUBNET_CMDS_UPDATE6_FAILED :
+                  SUBNET_CMDS_UPDATE4_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    LOG_INFO(subnet_cmds_logger, v6 ? SUBNET_CMDS_UPDATE6 : SUBNET_CMDS_UPDATE4)
+        .arg(resp.str());
+    setSuccessResponse(handle, resp.str());
+    return (0);
+}
+
+int
+SubnetCmdsImpl::subnetDelHandler(CalloutHandle& handle) {
+    bool v6 = false;
+    string txt = "malformed command";
+
+    stringstream resp;
+    try {
+        extractCommand(handle);
+        v6 = (cmd_name_ == "subnet6-del");
+
+        txt = "(missing parameters)";
+        if (!cmd_args_) {
+            isc_throw(isc::BadValue, "no parameters specified for the command");
+        }
+
+        txt = cmd_args_->str();
+
+        SubnetID subnet_id = getSubnetId(cmd_args_, "id");
+        SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+        CfgHostsPtr cfg_hosts = cfg->getCfgHosts();
+
+        bool found = false;
+        size_t hosts = 0;
+        if (v6) {
+            Subnet6Ptr subnet = cfg->getCfgSubnets6()->getSubnet(subnet_id);
+            if (subnet) {
+                found = true;
+                SharedNetwork6Ptr network;
+                subnet->getSharedNetwork(network);
+                if (network) {
+                    network->del(subnet_id);
+                }
+                cfg->getCfgSubnets6()->del(subnet);
+                hosts = cfg_hosts->delAll6(subnet_id);
+                CfgSubnets6::removeStatistics(subnet_id);
+            }
+
+        } else {
+            Subnet4Ptr subnet = cfg->getCfgSubnets4()->getSubnet(subnet_id);
+            if (subnet) {
+                found = true;
+                SharedNetwork4Ptr network;
+                subnet->getSharedNetwork(network);
+                if (network) {
+                    network->del(subnet_id);
+                }
+                cfg->getCfgSubnets4()->del(subnet);
+                hosts = cfg_hosts->delAll4(subnet_id);
+                CfgSubnets4::removeStatistics(subnet_id);
+            }
+        }
+
+        resp << "IPv" << (v6 ? "6" : "4") << " subnet " << subnet_id;
+        if (!found) {
+            resp << " not found";
+            ConstElementPtr response = createAnswer(CONTROL_RESULT_EMPTY,
+                                                    resp.str());
+            setResponse(handle, response);
+            return (0);
+        }
+
+        configModified();
+
+        resp << " deleted along with " << hosts << " host reservation(s)";
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger, v6 ? SUBNET_CMDS_DEL6_FAILED :
+                  SUBNET_CMDS_DEL4_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    LOG_INFO(subnet_cmds_logger, v6 ? SUBNET_CMDS_DEL6 : SUBNET_CMDS_DEL4)
+        .arg(resp.str());
+    setSuccessResponse(handle, resp.str());
+    return (0);
+}
+
+int
+SubnetCmdsImpl::reservationAddHandler(CalloutHandle& handle) {
+    bool v6 = (CfgMgr::instance().getFamily() == AF_INET6);
+    string txt = "malformed command";
+
+    stringstream resp;
+    try {
+        extractCommand(handle);
+
+        txt = "(missing parameters)";
+        if (!cmd_args_) {
+            isc_throw(isc::BadValue, "no parameters specified for the command");
+        }
+
+        txt = cmd_args_->str();
+
+        if (cmd_args_->getType() != Element::map) {
+            isc_throw(BadValue, "Parameters missing or are not a map.");
+        }
+
+        ConstElementPtr reservation = cmd_args_->get("reservation");
+        if (!reservation || (reservation->getType() != Element::map)) {
+            isc_throw(BadValue, "'reservation' parameter is mandatory and"
+                      " must be a map");
+        }
+
+        SubnetID subnet_id = getSubnetId(reservation, "subnet-id");
+        if (!subnetExists(v6, subnet_id)) {
+            isc_throw(BadValue, "IPv" << (v6 ? "6" : "4") << " subnet "
+                      << subnet_id << " not found");
+        }
+
+        // The host reservation parser doesn't accept the subnet identifier.
+        ElementPtr reservation_copy = copy(reservation);
+        reservation_copy->remove("subnet-id");
+
+        HostPtr host;
+        CfgMgr& cfg_mgr = CfgMgr::instance();
+        cfg_mgr.rollback();
+        try {
+            cfg_mgr.getCurrentCfg()->getCfgOptionDef()->
+                copyTo(*cfg_mgr.getStagingCfg()->getCfgOptionDef());
+            if (v6) {
+                HostReservationParser6 parser;
+                host = parser.parse(subnet_id, reservation_copy);
+            } else {
+                HostReservationParser4 parser;
+                host = parser.parse(subnet_id, reservation_copy);
+            }
+
+        } catch (...) {
+            cfg_mgr.rollback();
+            throw;
+        }
+        cfg_mgr.rollback();
+
+        cfg_mgr.getCurrentCfg()->getCfgHosts()->add(host);
+        configModified();
+
+        resp << "Host reservation for " << host->getIdentifierAsText()
+             << " added to subnet " << subnet_id;
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger, SUBNET_CMDS_RESERVATION_ADD_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    LOG_INFO(subnet_cmds_logger, SUBNET_CMDS_RESERVATION_ADD)
+        .arg(resp.str());
+    setSuccessResponse(handle, resp.str());
+    return (0);
+}
+
+int
+SubnetCmdsImpl::reservationDelHandler(CalloutHandle& handle) {
+    bool v6 = (CfgMgr::instance().getFamily() == AF_INET6);
+    string txt = "malformed command";
+
+    stringstream resp;
+    try {
+        extractCommand(handle);
+
+        txt = "(missing parameters)";
+        if (!cmd_args_) {
+            isc_throw(isc::BadValue, "no parameters specified for the command");
+        }
+
+        txt = cmd_args_->str();
+
+        SubnetID subnet_id = getSubnetId(cmd_args_, "subnet-id");
+        CfgHostsPtr cfg_hosts = CfgMgr::instance().getCurrentCfg()->getCfgHosts();
+
+        bool deleted = false;
+        ConstElementPtr address = cmd_args_->get("ip-address");
+        ConstElementPtr identifier_type = cmd_args_->get("identifier-type");
+        ConstElementPtr identifier = cmd_args_->get("identifier");
+        if (address) {
+            if (address->getType() != Element::string) {
+                isc_throw(BadValue, "'ip-address' parameter must be a string");
+            }
+            IOAddress addr(address->stringValue());
+            if (addr.isV6() != v6) {
+                isc_throw(BadValue, "'ip-address' parameter value "
+                          << addr.toText() << " is not an IPv" << (v6 ? "6" : "4")
+                          << " address");
+            }
+            deleted = cfg_hosts->del(subnet_id, addr);
+            resp << "Host reservation for " << addr.toText();
+
+        } else if (identifier_type && identifier) {
+            if ((identifier_type->getType() != Element::string) ||
+                (identifier->getType() != Element::string)) {
+                isc_throw(BadValue, "'identifier-type' and 'identifier'"
+                          " parameters must be strings");
+            }
+
+            // Use the host constructor to convert the identifier from
+            // the textual form.
+            Host host(identifier->stringValue(), identifier_type->stringValue(),
+                      SUBNET_ID_UNUSED, SUBNET_ID_UNUSED,
+                      IOAddress::IPV4_ZERO_ADDRESS());
+            const std::vector<uint8_t>& id = host.getIdentifier();
+            if (v6) {
+                deleted = cfg_hosts->del6(subnet_id, host.getIdentifierType(),
+                                          &id[0], id.size());
+            } else {
+                deleted = cfg_hosts->del4(subnet_id, host.getIdentifierType(),
+                                          &id[0], id.size());
+            }
+            resp << "Host reservation for " << host.getIdentifierAsText();
+
+        } else {
+            isc_throw(BadValue, "either 'ip-address' or 'identifier-type'"
+                      " and 'identifier' parameters are mandatory");
+        }
+
+        resp << " in subnet " << subnet_id;
+        if (!deleted) {
+            resp << " not found";
+            ConstElementPtr response = createAnswer(CONTROL_RESULT_EMPTY,
+                                                    resp.str());
+            setResponse(handle, response);
+            return (0);
+        }
+
+        configModified();
+
+        resp << " deleted";
+
+    } catch (const std::exception& ex) {
+        LOG_ERROR(subnet_cmds_logger, SUBNET_CMDS_RESERVATION_DEL_FAILED)
+            .arg(txt)
+            .arg(ex.what());
+        setErrorResponse(handle, ex.what());
+        return (1);
+    }
+
+    LOG_INFO(subnet_cmds_logger, SUBNET_CMDS_RESERVATION_DEL)
+        .arg(resp.str());
+    setSuccessResponse(handle, resp.str());
+    return (0);
+}
+
+int
+SubnetCmds::subnetAddHandler(CalloutHandle& handle) {
+    return (impl_->subnetAddHandler(handle));
+}
+
+int
+SubnetCmds::subnetUpdateHandler(CalloutHandle& handle) {
+    return (impl_->subnetUpdateHandler(handle));
+}
+
+int
+SubnetCmds::subnetDelHandler(CalloutHandle& handle) {
+    return (impl_->subnetDelHandler(handle));
+}
+
+int
+SubnetCmds::reservationAddHandler(CalloutHandle& handle) {
+    return (impl_->reservationAddHandler(handle));
+}
+
+int
+SubnetCmds::reservationDelHandler(CalloutHandle& handle) {
+    return (impl_->reservationDelHandler(handle));
+}
+
+SubnetCmds::SubnetCmds()
+    :impl_(new SubnetCmdsImpl()) {
+}
+
+} // end of namespace isc::subnet_cmds
+} // end of namespace isc
@@ -0,0 +1,153 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef SUBNET_CMDS_H
+#define SUBNET_CMDS_H
+
+#include <hooks/hooks.h>
+
+#include <boost/shared_ptr.hpp>
+
+namespace isc {
+namespace subnet_cmds {
+
+/// @brief Forward declaration of implementation class.
+class SubnetCmdsImpl;
+
+/// @brief Implements the logic for processing commands modifying subnets
+/// and host reservations.
+///
+/// This class is used by the callouts implementing command handlers for
+/// subnet and host reservation manipulations. The commands modify the
+/// current server configuration in place, i.e. the new configuration is
+/// not created and committed. Only the modified subnet and its host
+/// reservations are parsed and then added to, replaced or removed from
+/// the current configuration using its indexes.
+class SubnetCmds {
+public:
+    /// @brief Constructor.
+    ///
+    /// It creates an instance of the @c SubnetCmdsImpl.
+    SubnetCmds();
+
+    /// @brief subnet4-add, subnet6-add command handler
+    ///
+    /// This command adds a new subnet to the current configuration.
+    /// Example command for IPv4 subnet:
+    /// {
+    ///     "command": "subnet4-add",
+    ///     "arguments": {
+    ///         "subnet4": [ {
+    ///             "id": 10,
+    ///             "subnet": "192.0.2.0/24",
+    ///             "pools": [ { "pool": "192.0.2.10 - 192.0.2.100" } ],
+    ///             "reservations": [ {
+    ///                 "hw-address": "1a:1b:1c:1d:1e:1f",
+    ///                 "ip-address": "192.0.2.201"
+    ///             } ]
+    ///         } ]
+    ///     }
+    /// }
+    ///
+    /// The list must contain exactly one subnet which must include an
+    /// explicit subnet identifier. The parameters not specified for the
+    /// subnet are derived from the global scope of the current configuration.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// add command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    subnetAddHandler(hooks::CalloutHandle& handle);
+
+    /// @brief subnet4-update, subnet6-update command handler
+    ///
+    /// This command replaces the subnet having the specified identifier
+    /// in the current configuration. The arguments are the same as for
+    /// the subnet4-add and subnet6-add commands. The host reservations of
+    /// the subnet are replaced only if the "reservations" list is
+    /// specified for the subnet.
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// update command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    subnetUpdateHandler(hooks::CalloutHandle& handle);
+
+    /// @brief subnet4-del, subnet6-del command handler
+    ///
+    /// This command removes the subnet and its host reservations from
+    /// the current configuration. Example command:
+    /// {
+    ///     "command": "subnet4-del",
+    ///     "arguments": {
+    ///         "id": 10
+    ///     }
+    /// }
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// delete command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    subnetDelHandler(hooks::CalloutHandle& handle);
+
+    /// @brief reservation-add command handler
+    ///
+    /// This command adds the host reservation to the subnet in the
+    /// current configuration. Example command:
+    /// {
+    ///     "command": "reservation-add",
+    ///     "arguments": {
+    ///         "reservation": {
+    ///             "subnet-id": 10,
+    ///             "hw-address": "1a:1b:1c:1d:1e:1f",
+    ///             "ip-address": "192.0.2.201"
+    ///         }
+    ///     }
+    /// }
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// add command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    reservationAddHandler(hooks::CalloutHandle& handle);
+
+    /// @brief reservation-del command handler
+    ///
+    /// This command removes the host reservation from the subnet in the
+    /// current configuration. The reservation is specified by the
+    /// reserved address or by the host identifier. Example commands:
+    /// {
+    ///     "command": "reservation-del",
+    ///     "arguments": {
+    ///         "subnet-id": 10,
+    ///         "ip-address": "192.0.2.201"
+    ///     }
+    /// }
+    ///
+    /// {
+    ///     "command": "reservation-del",
+    ///     "arguments": {
+    ///         "subnet-id": 10,
+    ///         "identifier-type": "hw-address",
+    ///         "identifier": "1a:1b:1c:1d:1e:1f"
+    ///     }
+    /// }
+    ///
+    /// @param handle Callout context - which is expected to contain the
+    /// delete command JSON text in the "command" argument
+    /// @return result of the operation
+    int
+    reservationDelHandler(hooks::CalloutHandle& handle);
+
+private:
+    /// Pointer to the actual implementation
+    boost::shared_ptr<SubnetCmdsImpl> impl_;
+};
+
+};
+};
+
+#endif
@@ -0,0 +1,136 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+// Functions accessed by the hooks framework use C linkage to avoid the name
+// mangling that accompanies use of the C++ compiler as well as to avoid
+// issues related to namespaces.
+
+#include <config.h>
+
+#include <subnet_cmds.h>
+#include <subnet_cmds_log.h>
+#include <cc/command_interpreter.h>
+#include <hooks/hooks.h>
+
+using namespace isc::hooks;
+using namespace isc::subnet_cmds;
+
+extern "C" {
+
+/// @brief This is a command callout for 'subnet4-add' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int subnet4_add(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.subnetAddHandler(handle));
+}
+
+/// @brief This is a command callout for 'subnet6-add' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int subnet6_add(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.subnetAddHandler(handle));
+}
+
+/// @brief This is a command callout for 'subnet4-update' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int subnet4_update(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.subnetUpdateHandler(handle));
+}
+
+/// @brief This is a command callout for 'subnet6-update' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int subnet6_update(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.subnetUpdateHandler(handle));
+}
+
+/// @brief This is a command callout for 'subnet4-del' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int subnet4_del(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.subnetDelHandler(handle));
+}
+
+/// @brief This is a command callout for 'subnet6-del' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int subnet6_del(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.subnetDelHandler(handle));
+}
+
+/// @brief This is a command callout for 'reservation-add' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int reservation_add(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.reservationAddHandler(handle));
+}
+
+/// @brief This is a command callout for 'reservation-del' command.
+///
+/// @param handle Callout handle used to retrieve a command and
+/// provide a response.
+/// @return 0 if this callout has been invoked successfully,
+/// 1 otherwise.
+int reservation_del(CalloutHandle& handle) {
+    SubnetCmds subnet_cmds;
+    return (subnet_cmds.reservationDelHandler(handle));
+}
+
+/// @brief This function is called when the library is loaded.
+///
+/// @param handle library handle
+/// @return 0 when initialization is successful, 1 otherwise
+int load(LibraryHandle& handle) {
+    handle.registerCommandCallout("subnet4-add", subnet4_add);
+    handle.registerCommandCallout("subnet6-add", subnet6_add);
+    handle.registerCommandCallout("subnet4-update", subnet4_update);
+    handle.registerCommandCallout("subnet6-update", subnet6_update);
+    handle.registerCommandCallout("subnet4-del", subnet4_del);
+    handle.registerCommandCallout("subnet6-del", subnet6_del);
+    handle.registerCommandCallout("reservation-add", reservation_add);
+    handle.registerCommandCallout("reservation-del", reservation_del);
+    LOG_INFO(subnet_cmds_logger, SUBNET_CMDS_INIT_OK);
+    return (0);
+}
+
+/// @brief This function is called when the library is unloaded.
+///
+/// @return 0 if deregistration was successful, 1 otherwise
+int unload() {
+    LOG_INFO(subnet_cmds_logger, SUBNET_CMDS_DEINIT_OK);
+    return (0);
+}
+
+} // end extern "C"
@@ -0,0 +1,18 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <subnet_cmds_log.h>
+
+namespace isc {
+namespace subnet_cmds {
+
+isc::log::Logger subnet_cmds_logger("subnet-cmds-hooks");
+
+}
+}
+
@@ -0,0 +1,553 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <hooks/hooks_manager.h>
+#include <config/command_mgr.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/shared_network.h>
+#include <cc/command_interpreter.h>
+#include <cc/data.h>
+#include <stats/stats_mgr.h>
+
+#include <gtest/gtest.h>
+
+using namespace std;
+using namespace isc;
+using namespace isc::hooks;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::asiolink;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Test fixture for testing the subnet_cmds library.
+///
+/// The library is loaded with the hooks manager and the commands are
+/// sent with the command manager.
+class SubnetCmdsTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Clears the configuration, statistics and the lease manager.
+    SubnetCmdsTest()
+        : lib_name_(SUBNET_CMDS_LIB_SO) {
+        CommandMgr::instance();
+        unloadLibs();
+        StatsMgr::instance().removeAll();
+        LeaseMgrFactory::destroy();
+        CfgMgr::instance().clear();
+        CfgMgr::instance().setFamily(AF_INET);
+    }
+
+    /// @brief Destructor.
+    virtual ~SubnetCmdsTest() {
+        LeaseMgrFactory::destroy();
+        unloadLibs();
+        CfgMgr::instance().clear();
+        CfgMgr::instance().setFamily(AF_INET);
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Loads the library.
+    void loadLib() {
+        HookLibsCollection libraries;
+        libraries.push_back(make_pair(lib_name_, Element::createMap()));
+        ASSERT_TRUE(HooksManager::loadLibraries(libraries))
+            << "library loading failed";
+    }
+
+    /// @brief Unloads all libraries.
+    void unloadLibs() {
+        ASSERT_NO_THROW(HooksManager::unloadLibraries());
+    }
+
+    /// @brief Creates the configuration for the specified universe.
+    ///
+    /// The configuration holds a subnet with the identifier of 1 and
+    /// the lease database holding leases in memory.
+    ///
+    /// @param family Address family, AF_INET or AF_INET6.
+    void createConfig(const uint16_t family) {
+        CfgMgr& cfg_mgr = CfgMgr::instance();
+        cfg_mgr.setFamily(family);
+        SrvConfigPtr cfg = cfg_mgr.getStagingCfg();
+        cfg->addConfiguredGlobal("valid-lifetime", Element::create(4000));
+        if (family == AF_INET) {
+            Subnet4Ptr subnet(new Subnet4(IOAddress("192.0.2.0"), 24, 1, 2, 4000,
+                                          SubnetID(1)));
+            subnet->addPool(Pool4Ptr(new Pool4(IOAddress("192.0.2.10"),
+                                               IOAddress("192.0.2.19"))));
+            cfg->getCfgSubnets4()->add(subnet);
+            LeaseMgrFactory::create("type=memfile persist=false universe=4");
+
+        } else {
+            Subnet6Ptr subnet(new Subnet6(IOAddress("2001:db8:1::"), 64, 1, 2,
+                                          3, 4000, SubnetID(1)));
+            subnet->addPool(Pool6Ptr(new Pool6(Lease::TYPE_NA,
+                                               IOAddress("2001:db8:1::10"),
+                                               IOAddress("2001:db8:1::1f"))));
+            cfg->getCfgSubnets6()->add(subnet);
+            LeaseMgrFactory::create("type=memfile persist=false universe=6");
+        }
+        cfg_mgr.commit();
+    }
+
+    /// @brief Sends the command and checks the result.
+    ///
+    /// @param cmd_txt Command in the JSON format.
+    /// @param exp_result Expected result.
+    /// @param exp_txt Expected text, not checked if empty.
+    void testCommand(const std::string& cmd_txt, const int exp_result,
+                     const std::string& exp_txt = "") {
+        ConstElementPtr cmd;
+        ASSERT_NO_THROW(cmd = Element::fromJSON(cmd_txt))
+            << "command JSON invalid, test is broken";
+
+        ConstElementPtr rsp = CommandMgr::instance().processCommand(cmd);
+        ASSERT_TRUE(rsp);
+
+        int rcode = 0;
+        ConstElementPtr comment = parseAnswer(rcode, rsp);
+        EXPECT_EQ(exp_result, rcode) << rsp->str();
+        if (!exp_txt.empty()) {
+            ASSERT_TRUE(comment);
+            EXPECT_EQ(exp_txt, comment->stringValue());
+        }
+    }
+
+    /// @brief Returns the value of the subnet statistic.
+    ///
+    /// @param subnet_id Subnet identifier.
+    /// @param name Name of the statistic.
+    /// @return Value of the statistic or -1 if it doesn't exist.
+    int64_t getSubnetStat(const SubnetID& subnet_id, const std::string& name) {
+        ObservationPtr stat = StatsMgr::instance().
+            getObservation(StatsMgr::generateName("subnet", subnet_id, name));
+        return (stat ? stat->getInteger().first : -1);
+    }
+
+    /// @brief Path to the library.
+    std::string lib_name_;
+};
+
+// This test verifies that the library registers and deregisters the commands.
+TEST_F(SubnetCmdsTest, commands) {
+    const char* commands[] = {
+        "subnet4-add", "subnet6-add", "subnet4-update", "subnet6-update",
+        "subnet4-del", "subnet6-del", "reservation-add", "reservation-del"
+    };
+
+    loadLib();
+    for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); ++i) {
+        EXPECT_TRUE(HooksManager::commandHandlersPresent(commands[i]))
+            << commands[i];
+    }
+
+    unloadLibs();
+    for (size_t i = 0; i < sizeof(commands) / sizeof(commands[0]); ++i) {
+        EXPECT_FALSE(HooksManager::commandHandlersPresent(commands[i]))
+            << commands[i];
+    }
+}
+
+// This test verifies that the IPv4 subnet along with its reservations is
+// added to the current configuration.
+TEST_F(SubnetCmdsTest, subnet4Add) {
+    createConfig(AF_INET);
+    loadLib();
+
+    // The lease belonging to the added subnet is counted.
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.3.15"),
+                               HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))),
+                               ClientIdPtr(), 4000, 1000, 2000, time(0),
+                               SubnetID(2)));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 2,"
+                "        \"subnet\": \"192.0.3.0/24\","
+                "        \"pools\": [ { \"pool\": \"192.0.3.10 - 192.0.3.29\" } ],"
+                "        \"option-data\": [ { \"name\": \"routers\","
+                "                             \"data\": \"192.0.3.1\" } ],"
+                "        \"reservations\": [ {"
+                "            \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+                "            \"ip-address\": \"192.0.3.201\" } ]"
+                "    } ] } }", CONTROL_RESULT_SUCCESS,
+                "IPv4 subnet 2 (192.0.3.0/24) added");
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    Subnet4Ptr subnet = cfg->getCfgSubnets4()->getSubnet(SubnetID(2));
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(subnet, cfg->getCfgSubnets4()->getByPrefix("192.0.3.0/24"));
+    EXPECT_EQ(2, cfg->getCfgSubnets4()->getAll()->size());
+
+    // The valid lifetime is derived from the global scope.
+    EXPECT_EQ(4000, subnet->getValid().get());
+    EXPECT_TRUE(subnet->getCfgOption()->get(DHCP4_OPTION_SPACE,
+                                            DHO_ROUTERS).option_);
+
+    // The reservation is added.
+    EXPECT_TRUE(cfg->getCfgHosts()->get4(SubnetID(2), IOAddress("192.0.3.201")));
+
+    EXPECT_EQ(20, getSubnetStat(SubnetID(2), "total-addresses"));
+    EXPECT_EQ(1, getSubnetStat(SubnetID(2), "assigned-addresses"));
+
+    // The subnet with the same identifier can't be added again.
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 2,"
+                "        \"subnet\": \"192.0.4.0/24\""
+                "    } ] } }", CONTROL_RESULT_ERROR);
+    EXPECT_FALSE(cfg->getCfgSubnets4()->getByPrefix("192.0.4.0/24"));
+}
+
+// This test verifies that the subnet is not added when its reservations
+// can't be added.
+TEST_F(SubnetCmdsTest, subnet4AddInvalidReservation) {
+    createConfig(AF_INET);
+    loadLib();
+
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 2,"
+                "        \"subnet\": \"192.0.3.0/24\","
+                "        \"reservations\": ["
+                "            { \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+                "              \"ip-address\": \"192.0.3.201\" },"
+                "            { \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+                "              \"ip-address\": \"192.0.3.202\" } ]"
+                "    } ] } }", CONTROL_RESULT_ERROR);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    EXPECT_FALSE(cfg->getCfgSubnets4()->getSubnet(SubnetID(2)));
+    EXPECT_FALSE(cfg->getCfgHosts()->get4(SubnetID(2), IOAddress("192.0.3.201")));
+}
+
+// This test verifies that the malformed subnet4-add commands are rejected.
+TEST_F(SubnetCmdsTest, subnet4AddBadParams) {
+    createConfig(AF_INET);
+    loadLib();
+
+    // No arguments.
+    testCommand("{ \"command\": \"subnet4-add\" }", CONTROL_RESULT_ERROR);
+
+    // Empty list.
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ ] } }", CONTROL_RESULT_ERROR);
+
+    // Two subnets.
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.0.3.0/24\" },"
+                "                   { \"id\": 3, \"subnet\": \"192.0.4.0/24\" } ]"
+                "} }", CONTROL_RESULT_ERROR);
+
+    // Missing identifier.
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ { \"subnet\": \"192.0.3.0/24\" } ] } }",
+                CONTROL_RESULT_ERROR,
+                "'id' parameter is mandatory");
+
+    // Invalid pool.
+    testCommand("{ \"command\": \"subnet4-add\", \"arguments\": {"
+                "    \"subnet4\": [ { \"id\": 2, \"subnet\": \"192.0.3.0/24\","
+                "                     \"pools\": [ { \"pool\": \"foo\" } ] } ]"
+                "} }", CONTROL_RESULT_ERROR);
+
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+              getAll()->size());
+}
+
+// This test verifies that the IPv4 subnet is replaced in the current
+// configuration.
+TEST_F(SubnetCmdsTest, subnet4Update) {
+    createConfig(AF_INET);
+
+    // Put the subnet in the shared network.
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    network->add(cfg->getCfgSubnets4()->getSubnet(SubnetID(1)));
+    cfg->getCfgSharedNetworks4()->add(network);
+    cfg->getCfgHosts()->add(HostPtr(new Host("1a:1b:1c:1d:1e:1f", "hw-address",
+                                             SubnetID(1), SUBNET_ID_UNUSED,
+                                             IOAddress("192.0.2.201"))));
+    loadLib();
+
+    // The reservations are not modified when they are not specified.
+    testCommand("{ \"command\": \"subnet4-update\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 1,"
+                "        \"subnet\": \"192.0.2.0/24\","
+                "        \"valid-lifetime\": 5000,"
+                "        \"pools\": [ { \"pool\": \"192.0.2.10 - 192.0.2.59\" } ]"
+                "    } ] } }", CONTROL_RESULT_SUCCESS,
+                "IPv4 subnet 1 (192.0.2.0/24) updated");
+
+    Subnet4Ptr subnet = cfg->getCfgSubnets4()->getSubnet(SubnetID(1));
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(5000, subnet->getValid().get());
+    EXPECT_EQ(1, cfg->getCfgSubnets4()->getAll()->size());
+    EXPECT_EQ(50, getSubnetStat(SubnetID(1), "total-addresses"));
+    EXPECT_TRUE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.201")));
+
+    // The new subnet belongs to the shared network.
+    SharedNetwork4Ptr subnet_network;
+    subnet->getSharedNetwork(subnet_network);
+    EXPECT_EQ(network, subnet_network);
+    EXPECT_EQ(subnet, network->getSubnet(SubnetID(1)));
+
+    // The reservations are replaced when they are specified.
+    testCommand("{ \"command\": \"subnet4-update\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 1,"
+                "        \"subnet\": \"192.0.2.0/24\","
+                "        \"reservations\": [ {"
+                "            \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+                "            \"ip-address\": \"192.0.2.202\" } ]"
+                "    } ] } }", CONTROL_RESULT_SUCCESS);
+
+    EXPECT_FALSE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.201")));
+    EXPECT_TRUE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.202")));
+
+    // The subnet must exist.
+    testCommand("{ \"command\": \"subnet4-update\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 2,"
+                "        \"subnet\": \"192.0.3.0/24\""
+                "    } ] } }", CONTROL_RESULT_EMPTY,
+                "IPv4 subnet 2 not found");
+}
+
+// This test verifies that the IPv4 subnet and its reservations are left
+// unchanged when the update fails.
+TEST_F(SubnetCmdsTest, subnet4UpdateRollback) {
+    createConfig(AF_INET);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    Subnet4Ptr old_subnet = cfg->getCfgSubnets4()->getSubnet(SubnetID(1));
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    network->add(old_subnet);
+    cfg->getCfgSharedNetworks4()->add(network);
+    cfg->getCfgHosts()->add(HostPtr(new Host("1a:1b:1c:1d:1e:1f", "hw-address",
+                                             SubnetID(1), SUBNET_ID_UNUSED,
+                                             IOAddress("192.0.2.201"))));
+    loadLib();
+
+    // The new reservations can't be added because they use the same
+    // HW address.
+    testCommand("{ \"command\": \"subnet4-update\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 1,"
+                "        \"subnet\": \"192.0.2.0/24\","
+                "        \"valid-lifetime\": 5000,"
+                "        \"reservations\": [ {"
+                "            \"hw-address\": \"1a:1b:1c:1d:1e:20\","
+                "            \"ip-address\": \"192.0.2.202\" }, {"
+                "            \"hw-address\": \"1a:1b:1c:1d:1e:20\","
+                "            \"ip-address\": \"192.0.2.203\" } ]"
+                "    } ] } }", CONTROL_RESULT_ERROR);
+
+    // The old subnet and its reservation are restored.
+    EXPECT_EQ(old_subnet, cfg->getCfgSubnets4()->getSubnet(SubnetID(1)));
+    EXPECT_EQ(old_subnet, network->getSubnet(SubnetID(1)));
+    SharedNetwork4Ptr subnet_network;
+    old_subnet->getSharedNetwork(subnet_network);
+    EXPECT_EQ(network, subnet_network);
+    EXPECT_TRUE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.201")));
+    EXPECT_FALSE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.202")));
+}
+
+// This test verifies that the IPv4 subnet belonging to a shared network
+// inherits the parameters of the shared network.
+TEST_F(SubnetCmdsTest, subnet4UpdateSharedNetworkParameters) {
+    createConfig(AF_INET);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    SharedNetwork4Ptr network(new SharedNetwork4("frog"));
+    network->setValid(Triplet<uint32_t>(7000));
+    network->add(cfg->getCfgSubnets4()->getSubnet(SubnetID(1)));
+    cfg->getCfgSharedNetworks4()->add(network);
+    loadLib();
+
+    testCommand("{ \"command\": \"subnet4-update\", \"arguments\": {"
+                "    \"subnet4\": [ {"
+                "        \"id\": 1,"
+                "        \"subnet\": \"192.0.2.0/24\""
+                "    } ] } }", CONTROL_RESULT_SUCCESS);
+
+    // The valid lifetime comes from the shared network, not from the
+    // global parameters.
+    Subnet4Ptr subnet = cfg->getCfgSubnets4()->getSubnet(SubnetID(1));
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(7000, subnet->getValid().get());
+}
+
+// This test verifies that the IPv4 subnet along with its reservations is
+// removed from the current configuration.
+TEST_F(SubnetCmdsTest, subnet4Del) {
+    createConfig(AF_INET);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    cfg->getCfgHosts()->add(HostPtr(new Host("1a:1b:1c:1d:1e:1f", "hw-address",
+                                             SubnetID(1), SUBNET_ID_UNUSED,
+                                             IOAddress("192.0.2.201"))));
+
+    // Add a declined lease and count it.
+    HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, 1), HTYPE_ETHER));
+    Lease4Ptr lease(new Lease4(IOAddress("192.0.2.10"), hwaddr,
+                               static_cast<const uint8_t*>(0), 0,
+                               4000, 1, 2, time(NULL), SubnetID(1)));
+    lease->state_ = Lease::STATE_DECLINED;
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+    LeaseMgrFactory::instance().recountLeaseStats4();
+    EXPECT_EQ(1, StatsMgr::instance().getObservation("declined-addresses")->
+              getInteger().first);
+    loadLib();
+
+    testCommand("{ \"command\": \"subnet4-del\", \"arguments\": { \"id\": 1 } }",
+                CONTROL_RESULT_SUCCESS,
+                "IPv4 subnet 1 deleted along with 1 host reservation(s)");
+
+    EXPECT_FALSE(cfg->getCfgSubnets4()->getSubnet(SubnetID(1)));
+    EXPECT_FALSE(cfg->getCfgSubnets4()->getByPrefix("192.0.2.0/24"));
+    EXPECT_FALSE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.201")));
+    EXPECT_EQ(-1, getSubnetStat(SubnetID(1), "total-addresses"));
+
+    // The declined leases of the subnet are no longer counted globally.
+    ObservationPtr declined = StatsMgr::instance().
+        getObservation("declined-addresses");
+    ASSERT_TRUE(declined);
+    EXPECT_EQ(0, declined->getInteger().first);
+
+    testCommand("{ \"command\": \"subnet4-del\", \"arguments\": { \"id\": 1 } }",
+                CONTROL_RESULT_EMPTY, "IPv4 subnet 1 not found");
+
+    testCommand("{ \"command\": \"subnet4-del\", \"arguments\": { \"id\": \"1\" } }",
+                CONTROL_RESULT_ERROR, "'id' parameter must be an integer");
+}
+
+// This test verifies that the IPv6 subnets can be added, updated and
+// removed.
+TEST_F(SubnetCmdsTest, subnet6AddUpdateDel) {
+    createConfig(AF_INET6);
+    loadLib();
+
+    testCommand("{ \"command\": \"subnet6-add\", \"arguments\": {"
+                "    \"subnet6\": [ {"
+                "        \"id\": 2,"
+                "        \"subnet\": \"2001:db8:2::/64\","
+                "        \"pools\": [ { \"pool\": \"2001:db8:2::10 - 2001:db8:2::1f\" } ],"
+                "        \"pd-pools\": [ { \"prefix\": \"3000::\","
+                "                          \"prefix-len\": 48,"
+                "                          \"delegated-len\": 56 } ],"
+                "        \"reservations\": [ {"
+                "            \"duid\": \"01:02:03:04:05:06\","
+                "            \"ip-addresses\": [ \"2001:db8:2::100\" ] } ]"
+                "    } ] } }", CONTROL_RESULT_SUCCESS,
+                "IPv6 subnet 2 (2001:db8:2::/64) added");
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    Subnet6Ptr subnet = cfg->getCfgSubnets6()->getSubnet(SubnetID(2));
+    ASSERT_TRUE(subnet);
+    EXPECT_EQ(4000, subnet->getValid().get());
+    EXPECT_TRUE(cfg->getCfgHosts()->get6(SubnetID(2), IOAddress("2001:db8:2::100")));
+    EXPECT_EQ(16, getSubnetStat(SubnetID(2), "total-nas"));
+    EXPECT_EQ(256, getSubnetStat(SubnetID(2), "total-pds"));
+
+    testCommand("{ \"command\": \"subnet6-update\", \"arguments\": {"
+                "    \"subnet6\": [ {"
+                "        \"id\": 2,"
+                "        \"subnet\": \"2001:db8:3::/64\","
+                "        \"reservations\": [ ]"
+                "    } ] } }", CONTROL_RESULT_SUCCESS,
+                "IPv6 subnet 2 (2001:db8:3::/64) updated");
+
+    EXPECT_FALSE(cfg->getCfgSubnets6()->getByPrefix("2001:db8:2::/64"));
+    EXPECT_TRUE(cfg->getCfgSubnets6()->getByPrefix("2001:db8:3::/64"));
+    EXPECT_FALSE(cfg->getCfgHosts()->get6(SubnetID(2), IOAddress("2001:db8:2::100")));
+    EXPECT_EQ(0, getSubnetStat(SubnetID(2), "total-nas"));
+
+    testCommand("{ \"command\": \"subnet6-del\", \"arguments\": { \"id\": 2 } }",
+                CONTROL_RESULT_SUCCESS);
+    EXPECT_FALSE(cfg->getCfgSubnets6()->getSubnet(SubnetID(2)));
+    EXPECT_EQ(1, cfg->getCfgSubnets6()->getAll()->size());
+}
+
+// This test verifies that the host reservations can be added to and
+// removed from the current configuration.
+TEST_F(SubnetCmdsTest, reservation4AddDel) {
+    createConfig(AF_INET);
+    loadLib();
+
+    testCommand("{ \"command\": \"reservation-add\", \"arguments\": {"
+                "    \"reservation\": {"
+                "        \"subnet-id\": 1,"
+                "        \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+                "        \"ip-address\": \"192.0.2.201\","
+                "        \"hostname\": \"foo.example.org\" } } }",
+                CONTROL_RESULT_SUCCESS);
+
+    testCommand("{ \"command\": \"reservation-add\", \"arguments\": {"
+                "    \"reservation\": {"
+                "        \"subnet-id\": 1,"
+                "        \"hw-address\": \"2a:2b:2c:2d:2e:2f\","
+                "        \"ip-address\": \"192.0.2.202\" } } }",
+                CONTROL_RESULT_SUCCESS);
+
+    SrvConfigPtr cfg = CfgMgr::instance().getCurrentCfg();
+    ConstHostPtr host = cfg->getCfgHosts()->get4(SubnetID(1),
+                                                 IOAddress("192.0.2.201"));
+    ASSERT_TRUE(host);
+    EXPECT_EQ("foo.example.org", host->getHostname());
+
+    // The subnet must exist.
+    testCommand("{ \"command\": \"reservation-add\", \"arguments\": {"
+                "    \"reservation\": {"
+                "        \"subnet-id\": 2,"
+                "        \"hw-address\": \"3a:3b:3c:3d:3e:3f\","
+                "        \"ip-address\": \"192.0.3.201\" } } }",
+                CONTROL_RESULT_ERROR, "IPv4 subnet 2 not found");
+
+    // The address can't be reserved twice.
+    testCommand("{ \"command\": \"reservation-add\", \"arguments\": {"
+                "    \"reservation\": {"
+                "        \"subnet-id\": 1,"
+                "        \"hw-address\": \"3a:3b:3c:3d:3e:3f\","
+                "        \"ip-address\": \"192.0.2.201\" } } }",
+                CONTROL_RESULT_ERROR);
+
+    // Delete by address.
+    testCommand("{ \"command\": \"reservation-del\", \"arguments\": {"
+                "    \"subnet-id\": 1, \"ip-address\": \"192.0.2.201\" } }",
+                CONTROL_RESULT_SUCCESS);
+    EXPECT_FALSE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.201")));
+
+    // Delete by identifier.
+    testCommand("{ \"command\": \"reservation-del\", \"arguments\": {"
+                "    \"subnet-id\": 1, \"identifier-type\": \"hw-address\","
+                "    \"identifier\": \"2a:2b:2c:2d:2e:2f\" } }",
+                CONTROL_RESULT_SUCCESS);
+    EXPECT_FALSE(cfg->getCfgHosts()->get4(SubnetID(1), IOAddress("192.0.2.202")));
+
+    testCommand("{ \"command\": \"reservation-del\", \"arguments\": {"
+                "    \"subnet-id\": 1, \"ip-address\": \"192.0.2.202\" } }",
+                CONTROL_RESULT_EMPTY,
+                "Host reservation for 192.0.2.202 in subnet 1 not found");
+
+    // Neither address nor identifier.
+    testCommand("{ \"command\": \"reservation-del\", \"arguments\": {"
+                "    \"subnet-id\": 1 } }", CONTROL_RESULT_ERROR);
+}
+
+} // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2010-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2010-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <asiolink/io_error.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/static_assert.hpp>
 
 #include <unistd.h>             // for some IPC/network system calls
@@ -123,6 +124,16 @@ operator<<(std::ostream& os, const IOAddress& address) {
     return (os);
 }
 
+size_t
+hash_value(const IOAddress& address) {
+    if (address.isV4()) {
+        boost::hash<uint32_t> hasher;
+        return (hasher(address.toUint32()));
+    }
+    const std::vector<uint8_t> bytes = address.toBytes();
+    return (boost::hash_range(bytes.begin(), bytes.end()));
+}
+
 IOAddress
 IOAddress::subtract(const IOAddress& a, const IOAddress& b) {
     if (a.getFamily() != b.getFamily()) {
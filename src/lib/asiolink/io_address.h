@@ -339,6 +339,16 @@ private:
 std::ostream&
 operator<<(std::ostream& os, const IOAddress& address);
 
+/// \brief Computes the hash of the \c IOAddress.
+///
+/// This function is found by \c boost::hash, so the addresses may be
+/// used as keys of the hashed indexes and unordered containers.
+///
+/// \param address The \c IOAddress object to be hashed.
+/// \return Hash of the address.
+size_t
+hash_value(const IOAddress& address);
+
 } // namespace asiolink
 } // namespace isc
 #endif // IO_ADDRESS_H
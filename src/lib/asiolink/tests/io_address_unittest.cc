@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -11,6 +11,8 @@
 #include <asiolink/io_address.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <algorithm>
 #include <cstring>
 #include <vector>
@@ -321,6 +323,22 @@ TEST(IOAddressTest, subtract) {
     EXPECT_THROW(IOAddress::subtract(addr6, addr1), isc::BadValue);
 }
 
+// Test checks that equal addresses have equal hashes.
+TEST(IOAddressTest, hash) {
+    EXPECT_EQ(hash_value(IOAddress("192.0.2.1")),
+              hash_value(IOAddress("192.0.2.1")));
+    EXPECT_NE(hash_value(IOAddress("192.0.2.1")),
+              hash_value(IOAddress("192.0.2.2")));
+    EXPECT_EQ(hash_value(IOAddress("2001:db8::1")),
+              hash_value(IOAddress("2001:db8::1")));
+    EXPECT_NE(hash_value(IOAddress("2001:db8::1")),
+              hash_value(IOAddress("2001:db8::2")));
+
+    boost::hash<IOAddress> hasher;
+    EXPECT_EQ(hash_value(IOAddress("2001:db8::1")),
+              hasher(IOAddress("2001:db8::1")));
+}
+
 // Test checks whether an address can be increased.
 TEST(IOAddressTest, increaseAddr) {
     IOAddress addr1("192.0.2.12");
@@ -0,0 +1,137 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <benchmark/benchmark.h>
+#include <cc/data.h>
+
+#include <sstream>
+#include <string>
+
+using namespace isc::data;
+
+namespace {
+
+/// @brief Creates a DHCPv4 server configuration.
+///
+/// Each subnet has a pool, a few options and the specified number of
+/// host reservations, which resembles the configurations of the large
+/// deployments.
+///
+/// @param subnets Number of subnets.
+/// @param hosts Number of host reservations per subnet.
+std::string
+createConfig(const int subnets, const int hosts) {
+    std::ostringstream s;
+    s << "{ \"Dhcp4\": { \"interfaces-config\": { \"interfaces\": [ \"*\" ] },"
+      << " \"valid-lifetime\": 4000, \"renew-timer\": 1000,"
+      << " \"rebind-timer\": 2000,"
+      << " \"lease-database\": { \"type\": \"memfile\", \"lfc-interval\": 3600 },"
+      << " \"subnet4\": [";
+    for (int i = 0; i < subnets; ++i) {
+        const int a = (i >> 8) & 0xff;
+        const int b = i & 0xff;
+        s << (i > 0 ? "," : "") << "\n  {"
+          << " \"id\": " << (i + 1) << ","
+          << " \"subnet\": \"10." << a << "." << b << ".0/24\","
+          << " \"pools\": [ { \"pool\": \"10." << a << "." << b
+          << ".10 - 10." << a << "." << b << ".200\" } ],"
+          << " \"option-data\": ["
+          << " { \"name\": \"routers\", \"data\": \"10." << a << "." << b << ".1\" },"
+          << " { \"name\": \"domain-name-servers\","
+          << " \"data\": \"192.0.2.1, 192.0.2.2\" },"
+          << " { \"name\": \"domain-name\", \"data\": \"example.org\","
+          << " \"always-send\": true } ],"
+          << " \"reservations\": [";
+        for (int j = 0; j < hosts; ++j) {
+            s << (j > 0 ? "," : "") << "\n    {"
+              << " \"hw-address\": \"1a:1b:1c:" << std::hex
+              << ((i >> 8) & 0xff) << ":" << (i & 0xff) << ":" << j << std::dec
+              << "\", \"ip-address\": \"10." << a << "." << b << "."
+              << (201 + j) << "\", \"hostname\": \"host-" << i << "-" << j
+              << "\", \"user-context\": { \"rack\": " << j << ", \"lease-ratio\": 0.5 } }";
+        }
+        s << " ] }";
+    }
+    s << " ] } }";
+    return (s.str());
+}
+
+/// @brief Creates a command carrying the specified number of leases.
+///
+/// @param leases Number of leases.
+std::string
+createLeasesCommand(const int leases) {
+    std::ostringstream s;
+    s << "{ \"command\": \"lease4-update\", \"arguments\": { \"leases\": [";
+    for (int i = 0; i < leases; ++i) {
+        s << (i > 0 ? ", " : "") << "{ \"ip-address\": \"10." << ((i >> 16) & 0xff)
+          << "." << ((i >> 8) & 0xff) << "." << (i & 0xff) << "\","
+          << " \"hw-address\": \"1a:1b:1c:1d:1e:1f\","
+          << " \"client-id\": \"01:1a:1b:1c:1d:1e:1f\","
+          << " \"subnet-id\": " << ((i >> 8) + 1) << ", \"valid-lft\": 3600,"
+          << " \"expire\": 1530000000, \"fqdn-fwd\": false, \"fqdn-rev\": false,"
+          << " \"hostname\": \"client-" << i << ".example.org\", \"state\": 0 }";
+    }
+    s << " ] } }";
+    return (s.str());
+}
+
+/// @brief Benchmarks parsing the text with @c Element::fromJSON.
+///
+/// @param state Benchmark state.
+/// @param text Text to be parsed.
+void
+benchFromString(::benchmark::State& state, const std::string& text) {
+    while (state.KeepRunning()) {
+        ::benchmark::DoNotOptimize(Element::fromJSON(text));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * text.size());
+}
+
+/// @brief Benchmarks parsing the configuration from a string.
+void
+parseConfigString(::benchmark::State& state) {
+    const std::string config = createConfig(state.range(0), 4);
+    benchFromString(state, config);
+}
+
+/// @brief Benchmarks parsing the configuration from a stream.
+void
+parseConfigStream(::benchmark::State& state) {
+    const std::string config = createConfig(state.range(0), 4);
+    while (state.KeepRunning()) {
+        std::istringstream in(config);
+        ::benchmark::DoNotOptimize(Element::fromJSON(in));
+    }
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * config.size());
+}
+
+/// @brief Benchmarks parsing a command carrying leases.
+void
+parseLeasesCommand(::benchmark::State& state) {
+    const std::string command = createLeasesCommand(state.range(0));
+    benchFromString(state, command);
+}
+
+/// @brief Benchmarks converting the parsed configuration back to text.
+void
+configToJSON(::benchmark::State& state) {
+    ConstElementPtr config = Element::fromJSON(createConfig(state.range(0), 4));
+    while (state.KeepRunning()) {
+        ::benchmark::DoNotOptimize(config->str());
+    }
+}
+
+}
+
+BENCHMARK(parseConfigString)->Arg(10)->Arg(1000)->Arg(10000)
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK(parseConfigStream)->Arg(1000)->Unit(::benchmark::kMillisecond);
+BENCHMARK(parseLeasesCommand)->Arg(1000)->Arg(100000)
+    ->Unit(::benchmark::kMillisecond);
+BENCHMARK(configToJSON)->Arg(1000)->Unit(::benchmark::kMillisecond);
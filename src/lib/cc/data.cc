@@ -22,6 +22,7 @@
 #include <cerrno>
 
 #include <boost/lexical_cast.hpp>
+#include <boost/make_shared.hpp>
 
 #include <cmath>
 
@@ -221,12 +222,12 @@ bool operator!=(const Element& a, const Element& b) {
 //
 ElementPtr
 Element::create(const Position& pos) {
-    return (ElementPtr(new NullElement(pos)));
+    return (boost::make_shared<NullElement>(pos));
 }
 
 ElementPtr
 Element::create(const long long int i, const Position& pos) {
-    return (ElementPtr(new IntElement(static_cast<int64_t>(i), pos)));
+    return (boost::make_shared<IntElement>(static_cast<int64_t>(i), pos));
 }
 
 ElementPtr
@@ -241,17 +242,17 @@ Element::create(const long int i, const Position& pos) {
 
 ElementPtr
 Element::create(const double d, const Position& pos) {
-    return (ElementPtr(new DoubleElement(d, pos)));
+    return (boost::make_shared<DoubleElement>(d, pos));
 }
 
 ElementPtr
 Element::create(const bool b, const Position& pos) {
-    return (ElementPtr(new BoolElement(b, pos)));
+    return (boost::make_shared<BoolElement>(b, pos));
 }
 
 ElementPtr
 Element::create(const std::string& s, const Position& pos) {
-    return (ElementPtr(new StringElement(s, pos)));
+    return (boost::make_shared<StringElement>(s, pos));
 }
 
 ElementPtr
@@ -261,12 +262,12 @@ Element::create(const char *s, const Position& pos) {
 
 ElementPtr
 Element::createList(const Position& pos) {
-    return (ElementPtr(new ListElement(pos)));
+    return (boost::make_shared<ListElement>(pos));
 }
 
 ElementPtr
 Element::createMap(const Position& pos) {
-    return (ElementPtr(new MapElement(pos)));
+    return (boost::make_shared<MapElement>(pos));
 }
 
 
@@ -274,6 +275,75 @@ Element::createMap(const Position& pos) {
 // helper functions for fromJSON factory
 //
 namespace {
+
+/// @brief Input of the JSON parser reading from a memory buffer.
+///
+/// It provides the subset of the @c std::istream interface used by the
+/// parsing functions, which are templates over the input type. Parsing
+/// the strings and the files read into memory this way avoids the
+/// overhead of the stream calls for every character.
+class JSONBuffer {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the text to be parsed.
+    /// @param size Size of the text.
+    JSONBuffer(const char* data, const size_t size)
+        : cur_(data), end_(data + size) {
+    }
+
+    /// @brief Extracts the next character.
+    ///
+    /// @return The character or EOF if the end of the text is reached.
+    int get() {
+        return (cur_ != end_ ? static_cast<unsigned char>(*cur_++) : EOF);
+    }
+
+    /// @brief Returns the next character without extracting it.
+    ///
+    /// @return The character or EOF if the end of the text is reached.
+    int peek() const {
+        return (cur_ != end_ ? static_cast<unsigned char>(*cur_) : EOF);
+    }
+
+    /// @brief Skips the next character.
+    void ignore() {
+        if (cur_ != end_) {
+            ++cur_;
+        }
+    }
+
+    /// @brief Returns the last extracted character to the input.
+    void putback(char) {
+        --cur_;
+    }
+
+private:
+
+    /// @brief Pointer to the next character.
+    const char* cur_;
+
+    /// @brief Pointer past the end of the text.
+    const char* end_;
+};
+
+/// @brief Removes comment lines from the text.
+///
+/// @param text Text to be filtered.
+/// @return Text with the comment lines replaced with empty lines.
+std::string
+preprocessText(const std::string& text) {
+    std::istringstream in(text);
+    std::stringstream filtered;
+    Element::preprocess(in, filtered);
+    return (filtered.str());
+}
+
+template<typename Input>
+ElementPtr
+fromJSONInput(Input& in, const std::string& file, int& line, int& pos);
+
 bool
 charIn(const int c, const char* chars) {
     const size_t chars_len = std::strlen(chars);
@@ -285,8 +355,9 @@ charIn(const int c, const char* chars) {
     return (false);
 }
 
+template<typename Input>
 void
-skipChars(std::istream& in, const char* chars, int& line, int& pos) {
+skipChars(Input& in, const char* chars, int& line, int& pos) {
     int c = in.peek();
     while (charIn(c, chars) && c != EOF) {
         if (c == '\n') {
@@ -305,8 +376,9 @@ skipChars(std::istream& in, const char* chars, int& line, int& pos) {
 // unless that character is specified in the optional may_skip
 //
 // It returns the found character (as an int value).
+template<typename Input>
 int
-skipTo(std::istream& in, const std::string& file, int& line,
+skipTo(Input& in, const std::string& file, int& line,
        int& pos, const char* chars, const char* may_skip="")
 {
     int c = in.get();
@@ -340,11 +412,12 @@ skipTo(std::istream& in, const std::string& file, int& line,
 
 // TODO: Should we check for all other official escapes here (and
 // error on the rest)?
+template<typename Input>
 std::string
-strFromStringstream(std::istream& in, const std::string& file,
+strFromStringstream(Input& in, const std::string& file,
                     const int line, int& pos)
 {
-    std::stringstream ss;
+    std::string str;
     int c = in.get();
     ++pos;
     if (c == '"') {
@@ -389,43 +462,48 @@ strFromStringstream(std::istream& in, const std::string& file,
             in.ignore();
             ++pos;
         }
-        ss.put(c);
+        str.push_back(static_cast<char>(c));
         c = in.get();
         ++pos;
     }
     if (c == EOF) {
         throwJSONError("Unterminated string", file, line, pos);
     }
-    return (ss.str());
+    return (str);
 }
 
+template<typename Input>
 std::string
-wordFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+wordFromStringstream(Input& in, int& pos) {
+    std::string word;
     while (isalpha(in.peek())) {
-        ss << (char) in.get();
+        word.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += word.size();
+    return (word);
 }
 
+template<typename Input>
 std::string
-numberFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
-    while (isdigit(in.peek()) || in.peek() == '+' || in.peek() == '-' ||
-           in.peek() == '.' || in.peek() == 'e' || in.peek() == 'E') {
-        ss << (char) in.get();
+numberFromStringstream(Input& in, int& pos) {
+    std::string number;
+    int c = in.peek();
+    while (isdigit(c) || c == '+' || c == '-' ||
+           c == '.' || c == 'e' || c == 'E') {
+        number.push_back(static_cast<char>(in.get()));
+        c = in.peek();
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += number.size();
+    return (number);
 }
 
 // Should we change from IntElement and DoubleElement to NumberElement
 // that can also hold an e value? (and have specific getters if the
 // value is larger than an int can handle)
 //
+template<typename Input>
 ElementPtr
-fromStringstreamNumber(std::istream& in, const std::string& file,
+fromStringstreamNumber(Input& in, const std::string& file,
                        const int& line, int& pos) {
     // Remember position where the value starts. It will be set in the
     // Position structure of the Element to be created.
@@ -453,8 +531,9 @@ fromStringstreamNumber(std::istream& in, const std::string& file,
     return (ElementPtr());
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamBool(std::istream& in, const std::string& file,
+fromStringstreamBool(Input& in, const std::string& file,
                      const int line, int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -476,8 +555,9 @@ fromStringstreamBool(std::istream& in, const std::string& file,
     return (ElementPtr());
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamNull(std::istream& in, const std::string& file,
+fromStringstreamNull(Input& in, const std::string& file,
                      const int line, int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -494,8 +574,9 @@ fromStringstreamNull(std::istream& in, const std::string& file,
     }
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamString(std::istream& in, const std::string& file, int& line,
+fromStringstreamString(Input& in, const std::string& file, int& line,
                        int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -507,8 +588,9 @@ fromStringstreamString(std::istream& in, const std::string& file, int& line,
                                                             start_pos)));
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamList(std::istream& in, const std::string& file, int& line,
+fromStringstreamList(Input& in, const std::string& file, int& line,
                      int& pos)
 {
     int c = 0;
@@ -518,7 +600,7 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     skipChars(in, WHITESPACE, line, pos);
     while (c != EOF && c != ']') {
         if (in.peek() != ']') {
-            cur_list_element = Element::fromJSON(in, file, line, pos);
+            cur_list_element = fromJSONInput(in, file, line, pos);
             list->add(cur_list_element);
             c = skipTo(in, file, line, pos, ",]", WHITESPACE);
         } else {
@@ -529,8 +611,9 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     return (list);
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamMap(std::istream& in, const std::string& file, int& line,
+fromStringstreamMap(Input& in, const std::string& file, int& line,
                     int& pos)
 {
     ElementPtr map = Element::createMap(Element::Position(file, line, pos));
@@ -548,7 +631,7 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
             skipTo(in, file, line, pos, ":", WHITESPACE);
             // skip the :
 
-            ConstElementPtr value = Element::fromJSON(in, file, line, pos);
+            ConstElementPtr value = fromJSONInput(in, file, line, pos);
             map->set(key, value);
 
             c = skipTo(in, file, line, pos, ",}", WHITESPACE);
@@ -556,6 +639,76 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
     }
     return (map);
 }
+template<typename Input>
+ElementPtr
+fromJSONInput(Input& in, const std::string& file, int& line, int& pos) {
+    int c = 0;
+    ElementPtr element;
+    bool el_read = false;
+    skipChars(in, WHITESPACE, line, pos);
+    while (c != EOF && !el_read) {
+        c = in.get();
+        pos++;
+        switch(c) {
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+            case '0':
+            case '-':
+            case '+':
+            case '.':
+                in.putback(c);
+                --pos;
+                element = fromStringstreamNumber(in, file, line, pos);
+                el_read = true;
+                break;
+            case 't':
+            case 'f':
+                in.putback(c);
+                --pos;
+                element = fromStringstreamBool(in, file, line, pos);
+                el_read = true;
+                break;
+            case 'n':
+                in.putback(c);
+                --pos;
+                element = fromStringstreamNull(in, file, line, pos);
+                el_read = true;
+                break;
+            case '"':
+                in.putback('"');
+                --pos;
+                element = fromStringstreamString(in, file, line, pos);
+                el_read = true;
+                break;
+            case '[':
+                element = fromStringstreamList(in, file, line, pos);
+                el_read = true;
+                break;
+            case '{':
+                element = fromStringstreamMap(in, file, line, pos);
+                el_read = true;
+                break;
+            case EOF:
+                break;
+            default:
+                throwJSONError(std::string("error: unexpected character ") + std::string(1, c), file, line, pos);
+                break;
+        }
+    }
+    if (el_read) {
+        return (element);
+    } else {
+        isc_throw(JSONError, "nothing read");
+    }
+}
+
 } // unnamed namespace
 
 std::string
@@ -636,88 +789,28 @@ ElementPtr
 Element::fromJSON(std::istream& in, const std::string& file, int& line,
                   int& pos)
 {
-    int c = 0;
-    ElementPtr element;
-    bool el_read = false;
-    skipChars(in, WHITESPACE, line, pos);
-    while (c != EOF && !el_read) {
-        c = in.get();
-        pos++;
-        switch(c) {
-            case '1':
-            case '2':
-            case '3':
-            case '4':
-            case '5':
-            case '6':
-            case '7':
-            case '8':
-            case '9':
-            case '0':
-            case '-':
-            case '+':
-            case '.':
-                in.putback(c);
-                --pos;
-                element = fromStringstreamNumber(in, file, line, pos);
-                el_read = true;
-                break;
-            case 't':
-            case 'f':
-                in.putback(c);
-                --pos;
-                element = fromStringstreamBool(in, file, line, pos);
-                el_read = true;
-                break;
-            case 'n':
-                in.putback(c);
-                --pos;
-                element = fromStringstreamNull(in, file, line, pos);
-                el_read = true;
-                break;
-            case '"':
-                in.putback('"');
-                --pos;
-                element = fromStringstreamString(in, file, line, pos);
-                el_read = true;
-                break;
-            case '[':
-                element = fromStringstreamList(in, file, line, pos);
-                el_read = true;
-                break;
-            case '{':
-                element = fromStringstreamMap(in, file, line, pos);
-                el_read = true;
-                break;
-            case EOF:
-                break;
-            default:
-                throwJSONError(std::string("error: unexpected character ") + std::string(1, c), file, line, pos);
-                break;
-        }
-    }
-    if (el_read) {
-        return (element);
-    } else {
-        isc_throw(JSONError, "nothing read");
-    }
+    return (fromJSONInput(in, file, line, pos));
 }
 
 ElementPtr
 Element::fromJSON(const std::string& in, bool preproc) {
-    std::stringstream ss;
-    ss << in;
-
-    int line = 1, pos = 1;
-    stringstream filtered;
+    std::string filtered;
     if (preproc) {
-        preprocess(ss, filtered);
+        filtered = preprocessText(in);
     }
-    ElementPtr result(fromJSON(preproc ? filtered : ss, "<string>", line, pos));
-    skipChars(ss, WHITESPACE, line, pos);
-    // ss must now be at end
-    if (ss.peek() != EOF) {
-        throwJSONError("Extra data", "<string>", line, pos);
+    const std::string& text = preproc ? filtered : in;
+
+    int line = 1, pos = 1;
+    JSONBuffer buffer(text.data(), text.size());
+    ElementPtr result(fromJSONInput(buffer, "<string>", line, pos));
+    // Unless the comments are removed, the input must now be at end.
+    // The data following the element on its last line, e.g. a comment,
+    // are ignored when preprocessing.
+    if (!preproc) {
+        skipChars(buffer, WHITESPACE, line, pos);
+        if (buffer.peek() != EOF) {
+            throwJSONError("Extra data", "<string>", line, pos);
+        }
     }
     return result;
 }
@@ -736,7 +829,18 @@ Element::fromJSONFile(const std::string& file_name,
                   << "': " << error);
     }
 
-    return (fromJSON(infile, file_name, preproc));
+    // Parsing the text read into memory is much faster than parsing
+    // the stream.
+    std::ostringstream content;
+    content << infile.rdbuf();
+    std::string text = content.str();
+    if (preproc) {
+        text = preprocessText(text);
+    }
+
+    int line = 1, pos = 1;
+    JSONBuffer buffer(text.data(), text.size());
+    return (fromJSONInput(buffer, file_name, line, pos));
 }
 
 // to JSON format
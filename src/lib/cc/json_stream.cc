@@ -0,0 +1,382 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/json_stream.h>
+#include <exceptions/exceptions.h>
+#include <algorithm>
+#include <iterator>
+
+namespace isc {
+namespace data {
+
+StreamedListElement::StreamedListElement(const size_t size,
+                                         const Generator& generator,
+                                         const Position& pos)
+    : ListElement(pos), size_(size), generator_(generator),
+      materialized_(false) {
+    if (!generator_) {
+        isc_throw(BadValue, "generator of the streamed list must not be null");
+    }
+}
+
+ElementPtr
+StreamedListElement::generate(const size_t i) const {
+    if (materialized_) {
+        return (ListElement::getNonConst(i));
+    }
+    if (i >= size_) {
+        isc_throw(OutOfRange, "index " << i << " is out of range of the"
+                  " streamed list of " << size_ << " items");
+    }
+    return (generator_(i));
+}
+
+void
+StreamedListElement::materialize() const {
+    if (materialized_) {
+        return;
+    }
+    StreamedListElement* self = const_cast<StreamedListElement*>(this);
+    for (size_t i = 0; i < size_; ++i) {
+        self->ListElement::add(generator_(i));
+    }
+    materialized_ = true;
+}
+
+const std::vector<ElementPtr>&
+StreamedListElement::listValue() const {
+    materialize();
+    return (ListElement::listValue());
+}
+
+bool
+StreamedListElement::getValue(std::vector<ElementPtr>& t) const {
+    materialize();
+    return (ListElement::getValue(t));
+}
+
+bool
+StreamedListElement::setValue(const std::vector<ElementPtr>& v) {
+    materialized_ = true;
+    return (ListElement::setValue(v));
+}
+
+ConstElementPtr
+StreamedListElement::get(int i) const {
+    if (i < 0) {
+        isc_throw(OutOfRange, "negative index " << i << " of the streamed list");
+    }
+    return (generate(static_cast<size_t>(i)));
+}
+
+ElementPtr
+StreamedListElement::getNonConst(int i) const {
+    materialize();
+    return (ListElement::getNonConst(i));
+}
+
+void
+StreamedListElement::set(size_t i, ElementPtr e) {
+    materialize();
+    ListElement::set(i, e);
+}
+
+void
+StreamedListElement::add(ElementPtr e) {
+    materialize();
+    ListElement::add(e);
+}
+
+void
+StreamedListElement::remove(int i) {
+    materialize();
+    ListElement::remove(i);
+}
+
+void
+StreamedListElement::toJSON(std::ostream& ss) const {
+    if (materialized_) {
+        ListElement::toJSON(ss);
+        return;
+    }
+
+    ss << "[ ";
+    for (size_t i = 0; i < size_; ++i) {
+        if (i > 0) {
+            ss << ", ";
+        }
+        generate(i)->toJSON(ss);
+    }
+    ss << " ]";
+}
+
+size_t
+StreamedListElement::size() const {
+    return (materialized_ ? ListElement::size() : size_);
+}
+
+bool
+StreamedListElement::empty() const {
+    return (size() == 0);
+}
+
+StreamedMapElement::StreamedMapElement(const std::vector<std::string>& keys,
+                                       const Generator& generator,
+                                       const Position& pos)
+    : MapElement(pos), keys_(keys), generator_(generator),
+      materialized_(false) {
+    if (!generator_) {
+        isc_throw(BadValue, "generator of the streamed map must not be null");
+    }
+    for (size_t i = 1; i < keys_.size(); ++i) {
+        if (!(keys_[i - 1] < keys_[i])) {
+            isc_throw(BadValue, "keys of the streamed map must be unique and"
+                      " sorted, '" << keys_[i] << "' follows '"
+                      << keys_[i - 1] << "'");
+        }
+    }
+}
+
+const std::string&
+StreamedMapElement::key(const size_t i) const {
+    if (i >= size()) {
+        isc_throw(OutOfRange, "index " << i << " is out of range of the"
+                  " streamed map of " << size() << " items");
+    }
+    if (materialized_) {
+        return (std::next(MapElement::mapValue().begin(), i)->first);
+    }
+    return (keys_[i]);
+}
+
+ConstElementPtr
+StreamedMapElement::generate(const size_t i) const {
+    if (materialized_) {
+        return (MapElement::get(key(i)));
+    }
+    if (i >= keys_.size()) {
+        isc_throw(OutOfRange, "index " << i << " is out of range of the"
+                  " streamed map of " << keys_.size() << " items");
+    }
+    return (generator_(i));
+}
+
+size_t
+StreamedMapElement::indexOf(const std::string& s) const {
+    std::vector<std::string>::const_iterator it =
+        std::lower_bound(keys_.begin(), keys_.end(), s);
+    if ((it == keys_.end()) || (*it != s)) {
+        return (keys_.size());
+    }
+    return (static_cast<size_t>(it - keys_.begin()));
+}
+
+void
+StreamedMapElement::materialize() const {
+    if (materialized_) {
+        return;
+    }
+    StreamedMapElement* self = const_cast<StreamedMapElement*>(this);
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        self->MapElement::set(keys_[i], generator_(i));
+    }
+    self->keys_.clear();
+    materialized_ = true;
+}
+
+const std::map<std::string, ConstElementPtr>&
+StreamedMapElement::mapValue() const {
+    materialize();
+    return (MapElement::mapValue());
+}
+
+bool
+StreamedMapElement::getValue(std::map<std::string, ConstElementPtr>& t) const {
+    materialize();
+    return (MapElement::getValue(t));
+}
+
+bool
+StreamedMapElement::setValue(const std::map<std::string, ConstElementPtr>& v) {
+    materialized_ = true;
+    keys_.clear();
+    return (MapElement::setValue(v));
+}
+
+ConstElementPtr
+StreamedMapElement::get(const std::string& s) const {
+    if (materialized_) {
+        return (MapElement::get(s));
+    }
+    const size_t i = indexOf(s);
+    return (i < keys_.size() ? generator_(i) : ConstElementPtr());
+}
+
+void
+StreamedMapElement::set(const std::string& key, ConstElementPtr value) {
+    materialize();
+    MapElement::set(key, value);
+}
+
+void
+StreamedMapElement::remove(const std::string& s) {
+    materialize();
+    MapElement::remove(s);
+}
+
+bool
+StreamedMapElement::contains(const std::string& s) const {
+    if (materialized_) {
+        return (MapElement::contains(s));
+    }
+    return (indexOf(s) < keys_.size());
+}
+
+void
+StreamedMapElement::toJSON(std::ostream& ss) const {
+    if (materialized_) {
+        MapElement::toJSON(ss);
+        return;
+    }
+
+    ss << "{ ";
+    for (size_t i = 0; i < keys_.size(); ++i) {
+        if (i > 0) {
+            ss << ", ";
+        }
+        ss << "\"" << keys_[i] << "\": ";
+        ConstElementPtr value = generator_(i);
+        if (value) {
+            value->toJSON(ss);
+        } else {
+            ss << "None";
+        }
+    }
+    ss << " }";
+}
+
+size_t
+StreamedMapElement::size() const {
+    return (materialized_ ? MapElement::size() : keys_.size());
+}
+
+JSONChunkWriter::JSONChunkWriter(const ConstElementPtr& element)
+    : stack_(), element_(element), started_(false), done_(false),
+      scalar_() {
+}
+
+bool
+JSONChunkWriter::fill(std::string& output, const size_t size) {
+    if (!started_) {
+        started_ = true;
+        open(element_, output);
+    }
+
+    while (!stack_.empty() && (output.size() < size)) {
+        // Note that the reference is invalidated when a nested container
+        // is opened, so it must not be used after the call to open().
+        Frame& frame = stack_.back();
+
+        if (frame.element_->getType() == Element::list) {
+            if (frame.index_ < frame.element_->size()) {
+                if (frame.index_ > 0) {
+                    output += ", ";
+                }
+                ConstElementPtr item = frame.streamed_ ?
+                    frame.streamed_->generate(frame.index_) :
+                    frame.element_->get(frame.index_);
+                ++frame.index_;
+                open(item, output);
+
+            } else {
+                output += " ]";
+                stack_.pop_back();
+            }
+
+        } else if (frame.streamed_map_) {
+            if (frame.index_ < frame.streamed_map_->size()) {
+                if (frame.index_ > 0) {
+                    output += ", ";
+                }
+                output += "\"" + frame.streamed_map_->key(frame.index_) + "\": ";
+                ConstElementPtr value =
+                    frame.streamed_map_->generate(frame.index_);
+                ++frame.index_;
+                open(value, output);
+
+            } else {
+                output += " }";
+                stack_.pop_back();
+            }
+
+        } else if (frame.it_ != frame.element_->mapValue().end()) {
+            if (frame.index_ > 0) {
+                output += ", ";
+            }
+            output += "\"" + frame.it_->first + "\": ";
+            ConstElementPtr value = frame.it_->second;
+            ++frame.it_;
+            ++frame.index_;
+            open(value, output);
+
+        } else {
+            output += " }";
+            stack_.pop_back();
+        }
+    }
+
+    done_ = stack_.empty();
+    return (!done_);
+}
+
+void
+JSONChunkWriter::open(const ConstElementPtr& element, std::string& output) {
+    if (!element) {
+        output += "None";
+        return;
+    }
+
+    switch (element->getType()) {
+    case Element::list:
+    {
+        Frame frame;
+        frame.element_ = element;
+        frame.streamed_ = dynamic_cast<const StreamedListElement*>(element.get());
+        frame.streamed_map_ = 0;
+        frame.index_ = 0;
+        stack_.push_back(frame);
+        output += "[ ";
+        break;
+    }
+    case Element::map:
+    {
+        Frame frame;
+        frame.element_ = element;
+        frame.streamed_ = 0;
+        frame.streamed_map_ =
+            dynamic_cast<const StreamedMapElement*>(element.get());
+        frame.index_ = 0;
+        // The streamed map is iterated by index, so as its values are
+        // not materialized by a call to mapValue().
+        if (!frame.streamed_map_ || frame.streamed_map_->isMaterialized()) {
+            frame.streamed_map_ = 0;
+            frame.it_ = element->mapValue().begin();
+        }
+        stack_.push_back(frame);
+        output += "{ ";
+        break;
+    }
+    default:
+        scalar_.str("");
+        element->toJSON(scalar_);
+        output += scalar_.str();
+    }
+}
+
+} // end of namespace isc::data
+} // end of namespace isc
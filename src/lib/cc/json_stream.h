@@ -0,0 +1,276 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef JSON_STREAM_H
+#define JSON_STREAM_H
+
+#include <cc/data.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <functional>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace data {
+
+/// @brief List element which items are generated on demand.
+///
+/// Large lists returned in command responses, e.g. all leases, would
+/// otherwise require building an @c Element for each item, converting
+/// the whole tree to a string and copying this string to the send
+/// buffer. Instead, the streamed list holds the number of items and a
+/// generator which creates the item for the given index. The items are
+/// generated when the list is being serialized, one at a time, and
+/// discarded after they have been written out.
+///
+/// The accessors and modifiers inherited from the @c ListElement are
+/// supported as well. The first call to any of them, except @c get,
+/// @c size and @c empty, generates all items and stores them in the
+/// list, after which the list behaves as a regular list.
+class StreamedListElement : public ListElement {
+public:
+
+    /// @brief Type of the function generating the item for an index.
+    typedef std::function<ElementPtr(const size_t)> Generator;
+
+    /// @brief Constructor.
+    ///
+    /// @param size Number of items in the list.
+    /// @param generator Function generating the items.
+    /// @param pos Position of the list.
+    StreamedListElement(const size_t size, const Generator& generator,
+                        const Position& pos = ZERO_POSITION());
+
+    /// @brief Returns the item for the index.
+    ///
+    /// The item is generated unless the list has been materialized.
+    /// The generated item is not stored in the list.
+    ///
+    /// @param i Index of the item.
+    /// @throw OutOfRange if the index is out of range.
+    ElementPtr generate(const size_t i) const;
+
+    /// @brief Checks if all items have been generated and stored.
+    bool isMaterialized() const {
+        return (materialized_);
+    }
+
+    const std::vector<ElementPtr>& listValue() const;
+    using ListElement::getValue;
+    bool getValue(std::vector<ElementPtr>& t) const;
+    using ListElement::setValue;
+    bool setValue(const std::vector<ElementPtr>& v);
+    using ListElement::get;
+    ConstElementPtr get(int i) const;
+    ElementPtr getNonConst(int i) const;
+    using ListElement::set;
+    void set(size_t i, ElementPtr e);
+    void add(ElementPtr e);
+    using ListElement::remove;
+    void remove(int i);
+    void toJSON(std::ostream& ss) const;
+    size_t size() const;
+    bool empty() const;
+
+private:
+
+    /// @brief Generates all items and stores them in the list.
+    void materialize() const;
+
+    /// @brief Number of items to be generated.
+    size_t size_;
+
+    /// @brief Function generating the items.
+    Generator generator_;
+
+    /// @brief Indicates if the items have been generated and stored.
+    mutable bool materialized_;
+};
+
+/// @brief Pointer to the @c StreamedListElement.
+typedef boost::shared_ptr<StreamedListElement> StreamedListElementPtr;
+
+/// @brief Map element which values are generated on demand.
+///
+/// This is the counterpart of the @c StreamedListElement for the large
+/// maps returned in command responses, e.g. all statistics. The keys are
+/// known when the map is created and the generator creates the value for
+/// the index of a key. The values are generated when the map is being
+/// serialized, one at a time, and discarded after they have been written
+/// out.
+///
+/// The accessors and modifiers inherited from the @c MapElement are
+/// supported as well. The first call to any of them, except @c get,
+/// @c contains and @c size, generates all values and stores them in the
+/// map, after which the map behaves as a regular map.
+class StreamedMapElement : public MapElement {
+public:
+
+    /// @brief Type of the function generating the value for an index.
+    typedef std::function<ConstElementPtr(const size_t)> Generator;
+
+    /// @brief Constructor.
+    ///
+    /// @param keys Keys of the map in ascending order.
+    /// @param generator Function generating the value for the index of
+    /// a key.
+    /// @param pos Position of the map.
+    /// @throw BadValue if the generator is null or the keys are not
+    /// unique or not sorted.
+    StreamedMapElement(const std::vector<std::string>& keys,
+                       const Generator& generator,
+                       const Position& pos = ZERO_POSITION());
+
+    /// @brief Returns the key for the index.
+    ///
+    /// The keys of a materialized map are the keys of the stored values.
+    ///
+    /// @param i Index of the key.
+    /// @throw OutOfRange if the index is out of range.
+    const std::string& key(const size_t i) const;
+
+    /// @brief Returns the value for the index of a key.
+    ///
+    /// The value is generated unless the map has been materialized.
+    /// The generated value is not stored in the map.
+    ///
+    /// @param i Index of the key.
+    /// @throw OutOfRange if the index is out of range.
+    ConstElementPtr generate(const size_t i) const;
+
+    /// @brief Checks if all values have been generated and stored.
+    bool isMaterialized() const {
+        return (materialized_);
+    }
+
+    const std::map<std::string, ConstElementPtr>& mapValue() const;
+    using MapElement::getValue;
+    bool getValue(std::map<std::string, ConstElementPtr>& t) const;
+    using MapElement::setValue;
+    bool setValue(const std::map<std::string, ConstElementPtr>& v);
+    using MapElement::get;
+    ConstElementPtr get(const std::string& s) const;
+    using MapElement::set;
+    void set(const std::string& key, ConstElementPtr value);
+    using MapElement::remove;
+    void remove(const std::string& s);
+    bool contains(const std::string& s) const;
+    void toJSON(std::ostream& ss) const;
+    size_t size() const;
+
+private:
+
+    /// @brief Returns the index of a key or the number of keys if the
+    /// key is not found.
+    ///
+    /// @param s The key.
+    size_t indexOf(const std::string& s) const;
+
+    /// @brief Generates all values and stores them in the map.
+    void materialize() const;
+
+    /// @brief Keys of the map in ascending order.
+    std::vector<std::string> keys_;
+
+    /// @brief Function generating the values.
+    Generator generator_;
+
+    /// @brief Indicates if the values have been generated and stored.
+    mutable bool materialized_;
+};
+
+/// @brief Pointer to the @c StreamedMapElement.
+typedef boost::shared_ptr<StreamedMapElement> StreamedMapElementPtr;
+
+/// @brief Incrementally converts an @c Element tree to JSON text.
+///
+/// The text produced is the same as returned by @c Element::str. However,
+/// it is produced in chunks on demand, so as the caller, e.g. a
+/// connection sending the response over the control socket, can request
+/// more text as it manages to send the previous chunk. The items of the
+/// @c StreamedListElement and the values of the @c StreamedMapElement
+/// are generated while they are written out and they are never held in
+/// memory at the same time.
+///
+/// The tree must not be modified while it is being written.
+class JSONChunkWriter : public boost::noncopyable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param element Pointer to the element to be written.
+    explicit JSONChunkWriter(const ConstElementPtr& element);
+
+    /// @brief Appends the next part of the text to the output.
+    ///
+    /// The text is appended until the size of the output reaches the
+    /// specified size or the whole element has been written. The output
+    /// may exceed the specified size by the length of a single scalar
+    /// value.
+    ///
+    /// @param [out] output String to which the text is appended.
+    /// @param size Size of the output at which the writing stops.
+    ///
+    /// @return true if there is more text to be written, false otherwise.
+    bool fill(std::string& output, const size_t size);
+
+    /// @brief Checks if the whole element has been written.
+    bool done() const {
+        return (done_);
+    }
+
+private:
+
+    /// @brief Writes the element or opens it if it is a container.
+    ///
+    /// @param element Pointer to the element, possibly null.
+    /// @param [out] output String to which the text is appended.
+    void open(const ConstElementPtr& element, std::string& output);
+
+    /// @brief State of the container being written.
+    struct Frame {
+        /// @brief Pointer to the container.
+        ConstElementPtr element_;
+
+        /// @brief Pointer to the container if it is a streamed list.
+        const StreamedListElement* streamed_;
+
+        /// @brief Pointer to the container if it is a streamed map.
+        const StreamedMapElement* streamed_map_;
+
+        /// @brief Index of the next list or map item.
+        size_t index_;
+
+        /// @brief Iterator pointing to the next map item.
+        std::map<std::string, ConstElementPtr>::const_iterator it_;
+    };
+
+    /// @brief Containers being written, innermost at the back.
+    std::vector<Frame> stack_;
+
+    /// @brief Pointer to the element to be written.
+    ConstElementPtr element_;
+
+    /// @brief Indicates if the writing has started.
+    bool started_;
+
+    /// @brief Indicates if the whole element has been written.
+    bool done_;
+
+    /// @brief Stream used to convert the scalar values.
+    std::ostringstream scalar_;
+};
+
+/// @brief Pointer to the @c JSONChunkWriter.
+typedef boost::shared_ptr<JSONChunkWriter> JSONChunkWriterPtr;
+
+} // end of namespace isc::data
+} // end of namespace isc
+
+#endif // JSON_STREAM_H
@@ -0,0 +1,279 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <cc/data.h>
+#include <cc/json_stream.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::data;
+
+namespace {
+
+/// @brief Test fixture class for @ref StreamedListElement,
+/// @ref StreamedMapElement and @ref JSONChunkWriter.
+class JSONStreamTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    JSONStreamTest()
+        : generated_(0) {
+    }
+
+    /// @brief Generates a list item and counts the generated items.
+    ///
+    /// @param i Index of the item.
+    ElementPtr generate(const size_t i) {
+        ++generated_;
+        ElementPtr item = Element::createMap();
+        std::ostringstream s;
+        s << "192.0.2." << i;
+        item->set("ip-address", Element::create(s.str()));
+        item->set("subnet-id", Element::create(static_cast<int>(i)));
+        return (item);
+    }
+
+    /// @brief Creates a streamed list.
+    ///
+    /// @param size Number of items in the list.
+    StreamedListElementPtr createList(const size_t size) {
+        return (StreamedListElementPtr(new StreamedListElement(size,
+            std::bind(&JSONStreamTest::generate, this, std::placeholders::_1))));
+    }
+
+    /// @brief Creates a streamed map.
+    ///
+    /// The keys are "stat-000", "stat-001" etc. and the values are the
+    /// items generated for their index.
+    ///
+    /// @param size Number of items in the map.
+    StreamedMapElementPtr createMap(const size_t size) {
+        std::vector<std::string> keys;
+        for (size_t i = 0; i < size; ++i) {
+            std::ostringstream s;
+            s << "stat-" << std::setw(3) << std::setfill('0') << i;
+            keys.push_back(s.str());
+        }
+        return (StreamedMapElementPtr(new StreamedMapElement(keys,
+            std::bind(&JSONStreamTest::generate, this, std::placeholders::_1))));
+    }
+
+    /// @brief Creates a command response holding a streamed list and
+    /// a streamed map.
+    ///
+    /// @param size Number of items in the list and in the map.
+    ElementPtr createResponse(const size_t size) {
+        ElementPtr arguments = Element::createMap();
+        arguments->set("leases", createList(size));
+        arguments->set("statistics", createMap(size));
+        arguments->set("other", Element::fromJSON("[ 1, [ ], { }, \"x\" ]"));
+        ElementPtr response = Element::createMap();
+        response->set("arguments", arguments);
+        response->set("result", Element::create(0));
+        response->set("text", Element::create("leases found"));
+        return (response);
+    }
+
+    /// @brief Writes the element in chunks and concatenates the text.
+    ///
+    /// @param element Element to be written.
+    /// @param chunk_size Size of the chunks.
+    std::string writeChunks(const ConstElementPtr& element,
+                            const size_t chunk_size) {
+        JSONChunkWriter writer(element);
+        std::string text;
+        std::string chunk;
+        while (writer.fill(chunk, chunk_size)) {
+            // The chunk may only exceed the requested size by a scalar.
+            EXPECT_LT(chunk.size(), chunk_size + 64);
+            text += chunk;
+            chunk.clear();
+        }
+        EXPECT_TRUE(writer.done());
+        return (text + chunk);
+    }
+
+    /// @brief Number of generated items.
+    size_t generated_;
+};
+
+// This test verifies that the streamed list generates its items only
+// when they are accessed.
+TEST_F(JSONStreamTest, streamedList) {
+    StreamedListElementPtr list = createList(3);
+    EXPECT_EQ(0, generated_);
+    EXPECT_EQ(Element::list, list->getType());
+    EXPECT_EQ(3, list->size());
+    EXPECT_FALSE(list->empty());
+
+    ASSERT_TRUE(list->get(2));
+    EXPECT_EQ("192.0.2.2", list->get(2)->get("ip-address")->stringValue());
+    EXPECT_THROW(list->get(3), OutOfRange);
+    EXPECT_FALSE(list->isMaterialized());
+
+    // The serialization generates the items without storing them.
+    generated_ = 0;
+    ElementPtr copy = Element::fromJSON(list->str());
+    EXPECT_EQ(3, generated_);
+    EXPECT_FALSE(list->isMaterialized());
+    EXPECT_TRUE(list->equals(*copy));
+
+    // Accessing the vector of items stores them.
+    generated_ = 0;
+    EXPECT_EQ(3, list->listValue().size());
+    EXPECT_EQ(3, generated_);
+    EXPECT_TRUE(list->isMaterialized());
+    EXPECT_EQ(copy->str(), list->str());
+    EXPECT_EQ(3, generated_);
+
+    // From now on it behaves as a regular list.
+    list->add(Element::create("foo"));
+    EXPECT_EQ(4, list->size());
+    list->remove(0);
+    EXPECT_EQ(3, list->size());
+    EXPECT_EQ("foo", list->get(2)->stringValue());
+}
+
+// This test verifies that an empty streamed list is written as an empty
+// list.
+TEST_F(JSONStreamTest, emptyStreamedList) {
+    StreamedListElementPtr list = createList(0);
+    EXPECT_TRUE(list->empty());
+    EXPECT_EQ(Element::createList()->str(), list->str());
+    EXPECT_EQ(Element::createList()->str(), writeChunks(list, 1));
+}
+
+// This test verifies that the generator must be specified.
+TEST_F(JSONStreamTest, nullGenerator) {
+    EXPECT_THROW(StreamedListElement(1, StreamedListElement::Generator()),
+                 BadValue);
+}
+
+// This test verifies that the streamed map generates its values only
+// when they are accessed.
+TEST_F(JSONStreamTest, streamedMap) {
+    StreamedMapElementPtr map = createMap(3);
+    EXPECT_EQ(0, generated_);
+    EXPECT_EQ(Element::map, map->getType());
+    EXPECT_EQ(3, map->size());
+    EXPECT_EQ("stat-002", map->key(2));
+    EXPECT_THROW(map->key(3), OutOfRange);
+
+    EXPECT_TRUE(map->contains("stat-001"));
+    EXPECT_FALSE(map->contains("stat-003"));
+    EXPECT_FALSE(map->get("stat-003"));
+    ASSERT_TRUE(map->get("stat-001"));
+    EXPECT_EQ("192.0.2.1",
+              map->get("stat-001")->get("ip-address")->stringValue());
+    ASSERT_TRUE(map->find("stat-002/ip-address"));
+    EXPECT_EQ("192.0.2.2", map->find("stat-002/ip-address")->stringValue());
+    EXPECT_THROW(map->generate(3), OutOfRange);
+    EXPECT_FALSE(map->isMaterialized());
+
+    // The serialization generates the values without storing them.
+    generated_ = 0;
+    ElementPtr copy = Element::fromJSON(map->str());
+    EXPECT_EQ(3, generated_);
+    EXPECT_FALSE(map->isMaterialized());
+    EXPECT_EQ(3, copy->size());
+
+    // Accessing the map of values stores them.
+    generated_ = 0;
+    EXPECT_EQ(3, map->mapValue().size());
+    EXPECT_EQ(3, generated_);
+    EXPECT_TRUE(map->isMaterialized());
+    EXPECT_EQ(copy->str(), map->str());
+    EXPECT_TRUE(map->equals(*copy));
+    EXPECT_EQ(3, generated_);
+
+    // From now on it behaves as a regular map.
+    map->set("foo", Element::create("bar"));
+    EXPECT_EQ(4, map->size());
+    map->remove("stat-000");
+    EXPECT_EQ(3, map->size());
+    EXPECT_EQ("bar", map->get("foo")->stringValue());
+    EXPECT_EQ("foo", map->key(0));
+}
+
+// This test verifies that an empty streamed map is written as an empty
+// map.
+TEST_F(JSONStreamTest, emptyStreamedMap) {
+    StreamedMapElementPtr map = createMap(0);
+    EXPECT_EQ(0, map->size());
+    EXPECT_EQ(Element::createMap()->str(), map->str());
+    EXPECT_EQ(Element::createMap()->str(), writeChunks(map, 1));
+}
+
+// This test verifies that the keys of the streamed map must be sorted
+// and unique and that the generator must be specified.
+TEST_F(JSONStreamTest, invalidStreamedMap) {
+    std::vector<std::string> keys;
+    keys.push_back("a");
+    keys.push_back("b");
+    EXPECT_THROW(StreamedMapElement(keys, StreamedMapElement::Generator()),
+                 BadValue);
+    StreamedMapElement::Generator generator =
+        std::bind(&JSONStreamTest::generate, this, std::placeholders::_1);
+    EXPECT_NO_THROW(StreamedMapElement(keys, generator));
+    keys.push_back("b");
+    EXPECT_THROW(StreamedMapElement(keys, generator), BadValue);
+    keys.back() = "0";
+    EXPECT_THROW(StreamedMapElement(keys, generator), BadValue);
+}
+
+// This test verifies that the text written in chunks is the same as the
+// text returned by the Element::str for various chunk sizes.
+TEST_F(JSONStreamTest, writeChunks) {
+    ElementPtr response = createResponse(100);
+    const std::string expected = response->str();
+
+    const size_t sizes[] = { 1, 7, 64, 1000, 100000 };
+    for (size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i) {
+        SCOPED_TRACE(sizes[i]);
+        EXPECT_EQ(expected, writeChunks(response, sizes[i]));
+    }
+}
+
+// This test verifies that the scalars and null map values are written
+// in chunks.
+TEST_F(JSONStreamTest, writeScalars) {
+    EXPECT_EQ("5", writeChunks(Element::create(5), 1));
+    EXPECT_EQ("\"foo\"", writeChunks(Element::create("foo"), 1));
+
+    ElementPtr map = Element::createMap();
+    map->set("null", ConstElementPtr());
+    EXPECT_EQ(map->str(), writeChunks(map, 1));
+}
+
+// This test verifies that the items of a streamed list and the values
+// of a streamed map are generated while they are being written.
+TEST_F(JSONStreamTest, incrementalGeneration) {
+    ElementPtr response = createResponse(1000);
+    JSONChunkWriter writer(response);
+    std::string chunk;
+    EXPECT_TRUE(writer.fill(chunk, 1024));
+    EXPECT_FALSE(writer.done());
+    EXPECT_GT(generated_, 0);
+    EXPECT_LT(generated_, 1000);
+
+    // The map is written after the list.
+    while (generated_ < 1000) {
+        chunk.clear();
+        ASSERT_TRUE(writer.fill(chunk, 1024));
+    }
+    chunk.clear();
+    EXPECT_TRUE(writer.fill(chunk, 1024));
+    EXPECT_GT(generated_, 1000);
+    EXPECT_LT(generated_, 2000);
+}
+
+} // end of anonymous namespace
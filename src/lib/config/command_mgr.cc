@@ -16,6 +16,7 @@
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
 #include <cc/json_feed.h>
+#include <cc/json_stream.h>
 #include <dhcp/iface_mgr.h>
 #include <config/config_log.h>
 #include <config/timeouts.h>
@@ -66,7 +67,8 @@ public:
                ConnectionPool& connection_pool,
                const long timeout)
         : socket_(socket), timeout_timer_(*io_service), timeout_(timeout),
-          buf_(), response_(), connection_pool_(connection_pool), feed_(),
+          buf_(), response_(), writer_(), connection_pool_(connection_pool),
+          feed_(),
           response_in_progress_(false), watch_socket_(new util::WatchSocket()) {
 
         LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_CONNECTION_OPENED)
@@ -197,6 +199,14 @@ public:
     /// timeout has occurred.
     void timeoutHandler();
 
+    /// @brief Converts the next part of the response to text.
+    ///
+    /// Appends the text to the data to be sent until there is at least
+    /// BUF_SIZE bytes to be sent or the whole response has been converted.
+    ///
+    /// @return false if the conversion failed, true otherwise.
+    bool fillResponse();
+
 private:
 
     /// @brief Pointer to the socket used for transmission.
@@ -211,9 +221,16 @@ private:
     /// @brief Buffer used for received data.
     std::array<char, BUF_SIZE> buf_;
 
-    /// @brief Response created by the server.
+    /// @brief Part of the response which is to be sent.
     std::string response_;
 
+    /// @brief Writer converting the response to text as it is being sent.
+    ///
+    /// The response is converted in chunks which are appended to the
+    /// @c response_ when the previous chunk has been sent. Large responses,
+    /// e.g. all leases, are never held as text in memory as a whole.
+    JSONChunkWriterPtr writer_;
+
     /// @brief Reference to the pool of connections.
     ConnectionPool& connection_pool_;
 
@@ -374,12 +391,14 @@ Connection::receiveHandler(const boost::system::error_code& ec,
         // updated to not timeout before we manage to the send the reply.
         scheduleTimer();
 
-        // Let's convert JSON response to text. Note that at this stage
-        // the rsp pointer is always set.
-        response_ = rsp->str();
-
-        doSend();
-        return;
+        // Let's convert the first chunk of the JSON response to text.
+        // Note that at this stage the rsp pointer is always set.
+        writer_.reset(new JSONChunkWriter(rsp));
+        response_.clear();
+        if (fillResponse()) {
+            doSend();
+            return;
+        }
     }
 
     // Close the connection if we have sent the entire response.
@@ -421,7 +440,7 @@ Connection::sendHandler(const boost::system::error_code& ec,
             .arg(socket_->getNative());
 
         // Check if there is any data left to be sent and sent it.
-        if (!response_.empty()) {
+        if (fillResponse() && !response_.empty()) {
             doSend();
             return;
         }
@@ -457,10 +476,31 @@ Connection::timeoutHandler() {
     }
 
     ConstElementPtr rsp = createAnswer(CONTROL_RESULT_ERROR, os.str());
+    writer_.reset();
     response_ = rsp->str();
     doSend();
 }
 
+bool
+Connection::fillResponse() {
+    if (!writer_ || writer_->done() || (response_.size() >= BUF_SIZE)) {
+        return (true);
+    }
+
+    try {
+        writer_->fill(response_, BUF_SIZE);
+
+    } catch (const std::exception& ex) {
+        // The response is partially sent and can't be replaced with the
+        // error response, so the connection is closed.
+        LOG_ERROR(command_logger, COMMAND_RESPONSE_WRITE_FAIL)
+            .arg(socket_->getNative()).arg(ex.what());
+        writer_.reset();
+        return (false);
+    }
+    return (true);
+}
+
 
 }
 
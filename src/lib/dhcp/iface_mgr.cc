@@ -35,6 +35,44 @@ using namespace isc::asiolink;
 using namespace isc::util;
 using namespace isc::util::io::internal;
 
+namespace {
+
+/// @brief Checks if two interfaces have been detected with the same
+/// properties.
+///
+/// @param iface First interface.
+/// @param other Second interface.
+/// @return true if the interfaces have the same name, index, flags,
+/// link-layer address and addresses.
+bool
+sameIface(const isc::dhcp::Iface& iface, const isc::dhcp::Iface& other) {
+    if ((iface.getName() != other.getName()) ||
+        (iface.getIndex() != other.getIndex()) ||
+        (iface.flags_ != other.flags_) ||
+        (iface.getHWType() != other.getHWType()) ||
+        (iface.getMacLen() != other.getMacLen()) ||
+        (memcmp(iface.getMac(), other.getMac(), iface.getMacLen()) != 0)) {
+        return (false);
+    }
+
+    const isc::dhcp::Iface::AddressCollection& addrs = iface.getAddresses();
+    const isc::dhcp::Iface::AddressCollection& other_addrs = other.getAddresses();
+    if (addrs.size() != other_addrs.size()) {
+        return (false);
+    }
+    isc::dhcp::Iface::AddressCollection::const_iterator other_addr =
+        other_addrs.begin();
+    for (isc::dhcp::Iface::AddressCollection::const_iterator addr =
+             addrs.begin(); addr != addrs.end(); ++addr, ++other_addr) {
+        if (addr->get() != other_addr->get()) {
+            return (false);
+        }
+    }
+    return (true);
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -172,6 +210,10 @@ IfaceMgr::IfaceMgr()
      control_buf_(new char[control_buf_len_]),
      packet_filter_(new PktFilterInet()),
      packet_filter6_(new PktFilterInet6()),
+     pkt4_pool_hits_(0),
+     pkt4_pool_misses_(0),
+     pkt6_pool_hits_(0),
+     pkt6_pool_misses_(0),
      test_mode_(false),
      allow_loopback_(false)
 {
@@ -346,7 +388,12 @@ IfaceMgr::setPacketFilter(const PktFilterPtr& packet_filter) {
                   << " filter when there are open IPv4 sockets - need"
                   << " to close them first");
     }
-    // Everything is fine, so replace packet filter.
+    // Everything is fine, so replace packet filter. Retain the counters
+    // of the packet pool of the replaced filter.
+    if (packet_filter != packet_filter_) {
+        pkt4_pool_hits_ += packet_filter_->getPacketPool().getHits();
+        pkt4_pool_misses_ += packet_filter_->getPacketPool().getMisses();
+    }
     packet_filter_ = packet_filter;
 }
 
@@ -365,9 +412,33 @@ IfaceMgr::setPacketFilter(const PktFilter6Ptr& packet_filter) {
                   << " to close them first");
     }
 
+    if (packet_filter != packet_filter6_) {
+        pkt6_pool_hits_ += packet_filter6_->getPacketPool().getHits();
+        pkt6_pool_misses_ += packet_filter6_->getPacketPool().getMisses();
+    }
     packet_filter6_ = packet_filter;
 }
 
+uint64_t
+IfaceMgr::getPacketPoolHits4() const {
+    return (pkt4_pool_hits_ + packet_filter_->getPacketPool().getHits());
+}
+
+uint64_t
+IfaceMgr::getPacketPoolMisses4() const {
+    return (pkt4_pool_misses_ + packet_filter_->getPacketPool().getMisses());
+}
+
+uint64_t
+IfaceMgr::getPacketPoolHits6() const {
+    return (pkt6_pool_hits_ + packet_filter6_->getPacketPool().getHits());
+}
+
+uint64_t
+IfaceMgr::getPacketPoolMisses6() const {
+    return (pkt6_pool_misses_ + packet_filter6_->getPacketPool().getMisses());
+}
+
 bool
 IfaceMgr::hasOpenSocket(const uint16_t family) const {
     // Iterate over all interfaces and search for open sockets.
@@ -685,6 +756,34 @@ IfaceMgr::clearIfaces() {
     ifaces_.clear();
 }
 
+bool
+IfaceMgr::redetectIfaces() {
+    IfaceCollection previous;
+    previous.swap(ifaces_);
+    try {
+        detectIfaces();
+    } catch (...) {
+        ifaces_.swap(previous);
+        throw;
+    }
+
+    bool changed = (ifaces_.size() != previous.size());
+    for (IfaceCollection::const_iterator iface = ifaces_.begin(),
+             prev = previous.begin();
+         !changed && (iface != ifaces_.end()); ++iface, ++prev) {
+        changed = !sameIface(**iface, **prev);
+    }
+
+    if (changed) {
+        BOOST_FOREACH(IfacePtr iface, previous) {
+            iface->closeSockets();
+        }
+    } else {
+        ifaces_.swap(previous);
+    }
+    return (changed);
+}
+
 void
 IfaceMgr::clearUnicasts() {
     BOOST_FOREACH(IfacePtr iface, ifaces_) {
@@ -655,6 +655,19 @@ public:
     /// IPv6 address is read from interfaces.txt file.
     void detectIfaces();
 
+    /// @brief Detects network interfaces again.
+    ///
+    /// This method is used during the server reconfiguration. It detects
+    /// the interfaces and compares them with the interfaces detected
+    /// previously, including their indexes, flags, link-layer addresses
+    /// and addresses. If nothing has changed, the previously detected
+    /// interfaces are kept along with their open sockets. Otherwise, the
+    /// sockets are closed and the newly detected interfaces replace the
+    /// previous ones.
+    ///
+    /// @return true if the interfaces have changed, false otherwise.
+    bool redetectIfaces();
+
     /// @brief Clears unicast addresses on all interfaces.
     void clearUnicasts();
 
@@ -1059,6 +1072,32 @@ public:
     /// not having address assigned.
     void setMatchingPacketFilter(const bool direct_response_desired = false);
 
+    /// @brief Returns the number of received DHCPv4 packets which reused
+    /// a packet object from the pool.
+    ///
+    /// The counters of the packet filters replaced with
+    /// @c setPacketFilter are included, so the returned value doesn't
+    /// decrease when the server is reconfigured.
+    uint64_t getPacketPoolHits4() const;
+
+    /// @brief Returns the number of received DHCPv4 packets for which
+    /// a new packet object was created because the pool was empty.
+    ///
+    /// @see getPacketPoolHits4 for the counters of the replaced filters.
+    uint64_t getPacketPoolMisses4() const;
+
+    /// @brief Returns the number of received DHCPv6 packets which reused
+    /// a packet object from the pool.
+    ///
+    /// @see getPacketPoolHits4 for the counters of the replaced filters.
+    uint64_t getPacketPoolHits6() const;
+
+    /// @brief Returns the number of received DHCPv6 packets for which
+    /// a new packet object was created because the pool was empty.
+    ///
+    /// @see getPacketPoolHits4 for the counters of the replaced filters.
+    uint64_t getPacketPoolMisses6() const;
+
     /// @brief Adds an interface to list of known interfaces.
     ///
     /// @param iface reference to Iface object.
@@ -1221,6 +1260,18 @@ private:
     /// setPacketFilter method.
     PktFilter6Ptr packet_filter6_;
 
+    /// @brief Pool hits of the replaced DHCPv4 packet filters.
+    uint64_t pkt4_pool_hits_;
+
+    /// @brief Pool misses of the replaced DHCPv4 packet filters.
+    uint64_t pkt4_pool_misses_;
+
+    /// @brief Pool hits of the replaced DHCPv6 packet filters.
+    uint64_t pkt6_pool_hits_;
+
+    /// @brief Pool misses of the replaced DHCPv6 packet filters.
+    uint64_t pkt6_pool_misses_;
+
     /// @brief Contains list of callbacks for external sockets
     SocketCallbackInfoContainer callbacks_;
 
@@ -329,7 +329,8 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
                                const std::string& option_space,
                                isc::dhcp::OptionCollection& options,
                                size_t* relay_msg_offset /* = 0 */,
-                               size_t* relay_msg_len /* = 0 */) {
+                               size_t* relay_msg_len /* = 0 */,
+                               std::set<uint16_t>* lazy /* = 0 */) {
     size_t offset = 0;
     size_t length = buf.size();
     size_t last_offset = 0;
@@ -398,9 +399,19 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
                 return (last_offset);
             }
 
-            // Parse this as vendor option
-            OptionPtr vendor_opt(new OptionVendor(Option::V6, buf.begin() + offset,
+            OptionPtr vendor_opt;
+            if (lazy) {
+                // Keep the payload until the vendor option is requested.
+                vendor_opt.reset(new Option(Option::V6, opt_type,
+                                            buf.begin() + offset,
+                                            buf.begin() + offset + opt_len));
+                lazy->insert(opt_type);
+
+            } else {
+                // Parse this as vendor option
+                vendor_opt.reset(new OptionVendor(Option::V6, buf.begin() + offset,
                                                   buf.begin() + offset + opt_len));
+            }
             options.insert(std::make_pair(opt_type, vendor_opt));
 
             offset += opt_len;
@@ -429,6 +440,14 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
             num_defs = distance(range.first, range.second);
         }
 
+        // The server walks over the IA options directly rather than
+        // retrieving them by code, so these are never left unparsed.
+        if (lazy && (num_defs > 0) && (opt_type != D6O_IA_NA) &&
+            (opt_type != D6O_IA_TA) && (opt_type != D6O_IA_PD)) {
+            num_defs = 0;
+            lazy->insert(opt_type);
+        }
+
         OptionPtr opt;
         if (num_defs > 1) {
             // Multiple options of the same code are not supported right now!
@@ -465,10 +484,33 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
     return (last_offset);
 }
 
+OptionPtr
+LibDHCP::unpackLazyOption(const std::string& option_space,
+                          const OptionPtr& option) {
+    const Option::Universe u = option->getUniverse();
+    const uint16_t type = option->getType();
+    const OptionBuffer& data = option->getData();
+
+    if ((u == Option::V6) && (type == D6O_VENDOR_OPTS)) {
+        return (OptionPtr(new OptionVendor(Option::V6, data.begin(),
+                                           data.end())));
+    }
+
+    OptionDefinitionPtr def = getOptionDef(option_space, type);
+    if (!def) {
+        def = getRuntimeOptionDef(option_space, type);
+    }
+    if (!def) {
+        return (option);
+    }
+    return (def->optionFactory(u, type, data.begin(), data.end()));
+}
+
 size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
                                const std::string& option_space,
                                isc::dhcp::OptionCollection& options,
-                               std::list<uint16_t>& deferred) {
+                               std::list<uint16_t>& deferred,
+                               std::set<uint16_t>* lazy /* = 0 */) {
     size_t offset = 0;
     size_t last_offset = 0;
 
@@ -552,6 +594,11 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
         if (shouldDeferOptionUnpack(option_space, opt_type)) {
             num_defs = 0;
             deferred.push_back(opt_type);
+
+        } else if (lazy && (num_defs > 0)) {
+            // Decoding is postponed until the option is requested.
+            num_defs = 0;
+            lazy->insert(opt_type);
         }
 
         OptionPtr opt;
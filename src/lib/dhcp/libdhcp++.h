@@ -15,6 +15,7 @@
 #include <util/staged_value.h>
 
 #include <iostream>
+#include <set>
 #include <stdint.h>
 #include <string>
 
@@ -225,6 +226,11 @@ public:
     ///        offset to beginning of relay_msg option will be stored in it.
     /// @param relay_msg_len reference to a size_t structure. If specified,
     ///        length of the relay_msg option will be stored in it.
+    /// @param lazy Pointer to a set of option codes. If specified, options
+    ///        which have a definition are not decoded but stored as generic
+    ///        options holding the raw option payload, and their codes are
+    ///        inserted into this set (see @ref unpackLazyOption). The IA_NA,
+    ///        IA_TA and IA_PD options are always decoded.
     /// @return offset to the first byte after the last successfully
     /// parsed option
     ///
@@ -236,7 +242,8 @@ public:
                                  const std::string& option_space,
                                  isc::dhcp::OptionCollection& options,
                                  size_t* relay_msg_offset = 0,
-                                 size_t* relay_msg_len = 0);
+                                 size_t* relay_msg_len = 0,
+                                 std::set<uint16_t>* lazy = 0);
 
     /// @brief Parses provided buffer as DHCPv4 options and creates
     /// Option objects.
@@ -251,6 +258,10 @@ public:
     ///        put here.
     /// @param deferred Reference to an option code list. Options which
     ///        processing is deferred will be put here.
+    /// @param lazy Pointer to a set of option codes. If specified, options
+    ///        which have a definition are not decoded but stored as generic
+    ///        options holding the raw option payload, and their codes are
+    ///        inserted into this set (see @ref unpackLazyOption).
     /// @return offset to the first byte after the last successfully
     /// parsed option or the offset of the DHO_END option type.
     ///
@@ -258,7 +269,26 @@ public:
     static size_t unpackOptions4(const OptionBuffer& buf,
                                  const std::string& option_space,
                                  isc::dhcp::OptionCollection& options,
-                                 std::list<uint16_t>& deferred);
+                                 std::list<uint16_t>& deferred,
+                                 std::set<uint16_t>* lazy = 0);
+
+    /// @brief Decodes an option left unparsed by the lazy unpacking.
+    ///
+    /// The @ref unpackOptions4 and @ref unpackOptions6 functions store
+    /// options as instances of the generic @c Option class when the lazy
+    /// unpacking is requested. This function uses the option definition
+    /// (standard or runtime) to create the option instance of the
+    /// appropriate type from the payload held in the generic option.
+    ///
+    /// @param option_space Name of the option space the option belongs to.
+    /// @param option Pointer to the generic option.
+    ///
+    /// @return Pointer to the decoded option or the original option if
+    /// there is no definition for it.
+    /// @throw isc::OutOfRange and other exceptions thrown by the option
+    /// building routines if the option is malformed.
+    static OptionPtr unpackLazyOption(const std::string& option_space,
+                                      const OptionPtr& option);
 
     /// Registers factory method that produces options of specific option types.
     ///
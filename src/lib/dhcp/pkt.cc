@@ -9,6 +9,8 @@
 #include <dhcp/pkt.h>
 #include <dhcp/iface_mgr.h>
 #include <dhcp/hwaddr.h>
+#include <dhcp/libdhcp++.h>
+#include <dhcp/option_space.h>
 #include <vector>
 
 namespace isc {
@@ -25,7 +27,8 @@ Pkt::Pkt(uint32_t transid, const isc::asiolink::IOAddress& local_addr,
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     lazy_option_unpack_(false)
 {
 }
 
@@ -40,7 +43,8 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     lazy_option_unpack_(false)
 {
 
     if (len != 0) {
@@ -52,13 +56,42 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
     }
 }
 
+void
+Pkt::setData(const uint8_t* buf, uint32_t len) {
+    if ((len != 0) && (buf == NULL)) {
+        isc_throw(InvalidParameter, "data buffer passed to Pkt is NULL");
+    }
+    data_.assign(buf, buf + len);
+}
+
+void
+Pkt::clear() {
+    data_.clear();
+    buffer_out_.clear();
+    options_.clear();
+    lazy_options_.clear();
+    classes_ = ClientClasses();
+    required_classes_ = ClientClasses();
+    transid_ = 0;
+    iface_.clear();
+    ifindex_ = -1;
+    copy_retrieved_options_ = false;
+    lazy_option_unpack_ = false;
+    timestamp_ = boost::posix_time::ptime();
+    remote_hwaddr_.reset();
+    callout_handle_.reset();
+}
+
 void
 Pkt::addOption(const OptionPtr& opt) {
+    // Decode options of the same type before a new one gets mixed with them.
+    unpackLazyOptions(opt->getType());
     options_.insert(std::pair<int, OptionPtr>(opt->getType(), opt));
 }
 
 OptionPtr
 Pkt::getNonCopiedOption(const uint16_t type) const {
+    unpackLazyOptions(type);
     OptionCollection::const_iterator x = options_.find(type);
     if (x != options_.end()) {
         return (x->second);
@@ -68,6 +101,7 @@ Pkt::getNonCopiedOption(const uint16_t type) const {
 
 OptionPtr
 Pkt::getOption(const uint16_t type) {
+    unpackLazyOptions(type);
     OptionCollection::iterator x = options_.find(type);
     if (x != options_.end()) {
         if (copy_retrieved_options_) {
@@ -85,12 +119,74 @@ Pkt::delOption(uint16_t type) {
     isc::dhcp::OptionCollection::iterator x = options_.find(type);
     if (x!=options_.end()) {
         options_.erase(x);
+        // The options added later with this code are decoded already.
+        if (options_.count(type) == 0) {
+            lazy_options_.erase(type);
+        }
         return (true); // delete successful
     } else {
         return (false); // can't find option to be deleted
     }
 }
 
+void
+Pkt::unpackLazyOptions(const uint16_t type) const {
+    std::set<uint16_t>::iterator lazy = lazy_options_.find(type);
+    if (lazy == lazy_options_.end()) {
+        return;
+    }
+
+    // Replacing the generic options with the decoded ones doesn't change
+    // the content of the packet.
+    OptionCollection& options = const_cast<OptionCollection&>(options_);
+    std::pair<OptionCollection::iterator,
+              OptionCollection::iterator> range = options.equal_range(type);
+
+    // Decode all options before replacing any of them, so as the collection
+    // is left unchanged when one of them is malformed.
+    std::vector<OptionPtr> decoded;
+    for (OptionCollection::iterator opt_it = range.first;
+         opt_it != range.second; ++opt_it) {
+        const std::string space = (opt_it->second->getUniverse() == Option::V4 ?
+                                   DHCP4_OPTION_SPACE : DHCP6_OPTION_SPACE);
+        try {
+            decoded.push_back(LibDHCP::unpackLazyOption(space, opt_it->second));
+
+        } catch (const SkipRemainingOptionsError&) {
+            // The eager unpacking processes the packet without this option
+            // and the following ones. Keep the options undecoded instead.
+            lazy_options_.erase(lazy);
+            return;
+
+        } catch (const std::exception& ex) {
+            isc_throw(LazyOptionUnpackError, "failed to decode option "
+                      << type << ": " << ex.what());
+        }
+    }
+
+    std::vector<OptionPtr>::const_iterator dec_it = decoded.begin();
+    for (OptionCollection::iterator opt_it = range.first;
+         opt_it != range.second; ++opt_it, ++dec_it) {
+        opt_it->second = *dec_it;
+    }
+    lazy_options_.erase(lazy);
+}
+
+void
+Pkt::unpackAllLazyOptions() const {
+    // Iterate over a copy because the decoded options are removed from
+    // the set.
+    const std::set<uint16_t> lazy_options(lazy_options_);
+    for (std::set<uint16_t>::const_iterator type = lazy_options.begin();
+         type != lazy_options.end(); ++type) {
+        try {
+            unpackLazyOptions(*type);
+        } catch (const std::exception&) {
+            // Keep the malformed option undecoded.
+        }
+    }
+}
+
 bool
 Pkt::inClass(const std::string& client_class) {
     return (classes_.contains(client_class));
@@ -17,12 +17,25 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <set>
 #include <utility>
 
 namespace isc {
 
 namespace dhcp {
 
+/// @brief Exception thrown when an option decoded lazily is malformed.
+///
+/// The options left undecoded by the lazy unpacking are decoded when
+/// they are first retrieved from the packet, i.e. after the packet has
+/// been unpacked. This exception is thrown in this case, so as the
+/// server can drop the packet as if it failed to be unpacked.
+class LazyOptionUnpackError : public Exception {
+public:
+    LazyOptionUnpackError(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
 /// @brief RAII object enabling copying options retrieved from the
 /// packet.
 ///
@@ -159,6 +172,30 @@ public:
     /// @throw tbd
     virtual void unpack() = 0;
 
+    /// @brief Replaces the on-wire data of the packet.
+    ///
+    /// This is used to reuse a packet object for a newly received
+    /// message. The data is copied into @ref data_, which retains its
+    /// capacity from the previous use. The caller is responsible for
+    /// calling @ref clear beforehand.
+    ///
+    /// @param buf pointer to a buffer that contains on-wire data
+    /// @param len length of the pointer specified in buf
+    ///
+    /// @throw InvalidParameter if the buffer is NULL and the length is
+    /// non-zero.
+    virtual void setData(const uint8_t* buf, uint32_t len);
+
+    /// @brief Resets the packet to the state of a newly created packet.
+    ///
+    /// The on-wire data, options, classes, hardware address and the
+    /// associated callout handle are dropped. The input and output
+    /// buffers keep their allocated capacity, so this is cheaper than
+    /// creating a new packet. See @ref PktPool.
+    ///
+    /// Derived classes must call this method from their implementations.
+    virtual void clear();
+
     /// @brief Returns reference to output buffer.
     ///
     /// Returned buffer will contain reasonable data only for
@@ -318,7 +355,8 @@ protected:
     /// This method is internally used by the @ref Pkt class and derived
     /// classes to retrieve a pointer to the specified option. This
     /// method doesn't copy the option before returning it to the
-    /// caller.
+    /// caller. Options left undecoded by the lazy unpacking are decoded
+    /// before they are returned.
     ///
     /// @param type Option type.
     ///
@@ -378,6 +416,38 @@ public:
         return (copy_retrieved_options_);
     }
 
+    /// @brief Controls whether options are decoded lazily.
+    ///
+    /// When the lazy unpacking is enabled, the @c unpack method doesn't
+    /// decode options using their definitions. Such options are stored
+    /// in the @ref options_ collection as instances of the generic
+    /// @c Option class holding the raw payload. An option is decoded
+    /// into the specialized type (e.g. @c OptionCustom) when it is
+    /// first retrieved with any of the option accessors, e.g.
+    /// @ref Pkt::getOption or @c Pkt6::getOptions. This saves the decoding
+    /// work for the options which are never used by the server.
+    ///
+    /// @note This setting must be set before calling @c unpack.
+    /// Malformed options which are decoded lazily cause the
+    /// @ref LazyOptionUnpackError to be thrown when they are retrieved
+    /// rather than an exception during unpack. Options whose decoding
+    /// ends with the @ref SkipRemainingOptionsError are left undecoded,
+    /// like the options following them when they are unpacked eagerly.
+    ///
+    /// @param lazy Indicates if the options should be decoded lazily.
+    void setLazyOptionUnpack(const bool lazy) {
+        lazy_option_unpack_ = lazy;
+    }
+
+    /// @brief Returns whether the lazy unpacking of options is enabled.
+    ///
+    /// Also see @ref setLazyOptionUnpack.
+    ///
+    /// @return true if options are decoded lazily.
+    bool isLazyOptionUnpack() const {
+        return (lazy_option_unpack_);
+    }
+
     /// @brief Update packet timestamp.
     ///
     /// Updates packet timestamp. This method is invoked
@@ -688,6 +758,28 @@ protected:
     HWAddrPtr
     getMACFromIPv6(const isc::asiolink::IOAddress& addr);
 
+    /// @brief Decodes options of the specified type left unparsed by the
+    /// lazy unpacking.
+    ///
+    /// The generic options of the specified type are replaced in the
+    /// @ref options_ collection with the decoded options. This is no-op
+    /// if the options of this type have been decoded already.
+    ///
+    /// The method is const because decoding doesn't change the content
+    /// of the packet, only the representation of its options, so the
+    /// const accessors can decode options too.
+    ///
+    /// @param type Option type.
+    /// @throw LazyOptionUnpackError if an option is malformed. The options
+    /// are left undecoded in this case.
+    void unpackLazyOptions(const uint16_t type) const;
+
+    /// @brief Decodes all options left unparsed by the lazy unpacking.
+    ///
+    /// It is used when the whole packet is printed. Malformed options
+    /// are left undecoded and they are printed as raw data.
+    void unpackAllLazyOptions() const;
+
     /// @brief Attempts to extract MAC/Hardware address from DOCSIS options
     ///        inserted by the modem itself.
     ///
@@ -761,6 +853,14 @@ protected:
     /// @see the documentation for @ref Pkt::setCopyRetrievedOptions.
     bool copy_retrieved_options_;
 
+    /// @brief Indicates if options should be decoded on first retrieval.
+    ///
+    /// @see the documentation for @ref Pkt::setLazyOptionUnpack.
+    bool lazy_option_unpack_;
+
+    /// @brief Codes of the options which haven't been decoded yet.
+    mutable std::set<uint16_t> lazy_options_;
+
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
@@ -785,6 +885,9 @@ private:
                                  HWAddrPtr& storage);
 };
 
+/// @brief A pointer to either Pkt4 or Pkt6 packet
+typedef boost::shared_ptr<isc::dhcp::Pkt> PktPtr;
+
 }; // namespace isc::dhcp
 }; // namespace isc
 
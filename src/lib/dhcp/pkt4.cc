@@ -71,6 +71,40 @@ Pkt4::Pkt4(const uint8_t* data, size_t len)
     memset(file_, 0, MAX_FILE_LEN);
 }
 
+void
+Pkt4::setData(const uint8_t* data, uint32_t len) {
+    if (len < DHCPV4_PKT_HDR_LEN) {
+        isc_throw(OutOfRange, "Truncated DHCPv4 packet (len=" << len
+                  << ") received, at least " << DHCPV4_PKT_HDR_LEN
+                  << " is expected.");
+    }
+    Pkt::setData(data, len);
+}
+
+void
+Pkt4::clear() {
+    Pkt::clear();
+    local_addr_ = DEFAULT_ADDRESS;
+    remote_addr_ = DEFAULT_ADDRESS;
+    local_port_ = DHCP4_SERVER_PORT;
+    remote_port_ = DHCP4_CLIENT_PORT;
+    op_ = BOOTREQUEST;
+    // The previous hardware address may still be referenced elsewhere,
+    // so it must not be modified in place.
+    hwaddr_.reset(new HWAddr());
+    local_hwaddr_.reset();
+    hops_ = 0;
+    secs_ = 0;
+    flags_ = 0;
+    ciaddr_ = DEFAULT_ADDRESS;
+    yiaddr_ = DEFAULT_ADDRESS;
+    siaddr_ = DEFAULT_ADDRESS;
+    giaddr_ = DEFAULT_ADDRESS;
+    memset(sname_, 0, MAX_SNAME_LEN);
+    memset(file_, 0, MAX_FILE_LEN);
+    deferred_options_.clear();
+}
+
 size_t
 Pkt4::len() {
     size_t length = DHCPV4_PKT_HDR_LEN; // DHCPv4 header
@@ -203,7 +237,10 @@ Pkt4::unpack() {
     // a vector as an input.
     buffer_in.readVector(opts_buffer, opts_len);
 
-    size_t offset = LibDHCP::unpackOptions4(opts_buffer, DHCP4_OPTION_SPACE, options_, deferred_options_);
+    size_t offset = LibDHCP::unpackOptions4(opts_buffer, DHCP4_OPTION_SPACE,
+                                            options_, deferred_options_,
+                                            lazy_option_unpack_ ?
+                                            &lazy_options_ : 0);
 
     // If offset is not equal to the size and there is no DHO_END,
     // then something is wrong here. We either parsed past input
@@ -397,6 +434,7 @@ Pkt4::toText() const {
 
     output << ", transid=0x" << hex << transid_ << dec;
 
+    unpackAllLazyOptions();
     if (!options_.empty()) {
         output << "," << std::endl << "options:";
         for (isc::dhcp::OptionCollection::const_iterator opt = options_.begin();
@@ -89,6 +89,19 @@ public:
     /// Method with throw exception if packet parsing fails.
     virtual void unpack();
 
+    /// @brief Replaces the on-wire data of the packet.
+    ///
+    /// @param data pointer to received data
+    /// @param len size of buffer to be allocated for this packet.
+    ///
+    /// @throw OutOfRange if the data is shorter than the DHCPv4 header.
+    virtual void setData(const uint8_t* data, uint32_t len);
+
+    /// @brief Resets the packet to the state of a newly created packet.
+    ///
+    /// See @ref Pkt::clear.
+    virtual void clear();
+
     /// @brief Returns text representation of the primary packet identifiers
     ///
     /// This method is intended to be used to provide a consistent way to
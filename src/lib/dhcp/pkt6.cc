@@ -60,6 +60,17 @@ Pkt6::Pkt6(uint8_t msg_type, uint32_t transid, DHCPv6Proto proto /*= UDP*/)
     msg_type_(msg_type) {
 }
 
+void
+Pkt6::clear() {
+    Pkt::clear();
+    local_addr_ = DEFAULT_ADDRESS6;
+    remote_addr_ = DEFAULT_ADDRESS6;
+    local_port_ = 0;
+    remote_port_ = 0;
+    msg_type_ = 0;
+    relay_info_.clear();
+}
+
 size_t Pkt6::len() {
     if (relay_info_.empty()) {
         return (directLen());
@@ -417,7 +428,10 @@ Pkt6::unpackMsg(OptionBuffer::const_iterator begin,
 
     // If custom option parsing function has been set, use this function
     // to parse options. Otherwise, use standard function from libdhcp.
-    size_t offset = LibDHCP::unpackOptions6(opt_buffer, DHCP6_OPTION_SPACE, options_);
+    size_t offset = LibDHCP::unpackOptions6(opt_buffer, DHCP6_OPTION_SPACE,
+                                            options_, 0, 0,
+                                            lazy_option_unpack_ ?
+                                            &lazy_options_ : 0);
 
     // If offset is not equal to the size, then something is wrong here. We
     // either parsed past input buffer (bug in our code) or we haven't parsed
@@ -632,6 +646,7 @@ Pkt6::toText() const {
         hex << transid_ << dec << endl;
 
     // Then print the options
+    unpackAllLazyOptions();
     for (isc::dhcp::OptionCollection::const_iterator opt=options_.begin();
          opt != options_.end();
          ++opt) {
@@ -670,6 +685,7 @@ Pkt6::getClientId() const {
 
 isc::dhcp::OptionCollection
 Pkt6::getNonCopiedOptions(const uint16_t opt_type) const {
+    unpackLazyOptions(opt_type);
     std::pair<OptionCollection::const_iterator,
               OptionCollection::const_iterator> range = options_.equal_range(opt_type);
     return (OptionCollection(range.first, range.second));
@@ -677,6 +693,7 @@ Pkt6::getNonCopiedOptions(const uint16_t opt_type) const {
 
 isc::dhcp::OptionCollection
 Pkt6::getOptions(const uint16_t opt_type) {
+    unpackLazyOptions(opt_type);
     OptionCollection options_copy;
 
     std::pair<OptionCollection::iterator,
@@ -143,6 +143,11 @@ public:
     /// @throw tbd
     virtual void unpack();
 
+    /// @brief Resets the packet to the state of a newly created packet.
+    ///
+    /// The protocol of the packet is retained. See @ref Pkt::clear.
+    virtual void clear();
+
     /// @brief Returns protocol of this packet (UDP or TCP).
     ///
     /// @return protocol type
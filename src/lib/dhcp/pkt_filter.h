@@ -8,6 +8,7 @@
 #define PKT_FILTER_H
 
 #include <dhcp/pkt4.h>
+#include <dhcp/pkt_pool.h>
 #include <asiolink/io_address.h>
 #include <boost/shared_ptr.hpp>
 
@@ -103,6 +104,14 @@ public:
     virtual int send(const Iface& iface, uint16_t sockfd,
                      const Pkt4Ptr& pkt) = 0;
 
+    /// @brief Returns the pool of received packets.
+    ///
+    /// The pool provides the counters indicating how often the packet
+    /// objects are reused.
+    const PktPool<Pkt4>& getPacketPool() const {
+        return (pkt_pool_);
+    }
+
 protected:
 
     /// @brief Default implementation to open a fallback socket.
@@ -128,6 +137,11 @@ protected:
     /// configuration fails.
     virtual int openFallbackSocket(const isc::asiolink::IOAddress& addr,
                                    const uint16_t port);
+
+    /// @brief Pool of packet objects reused for received messages.
+    ///
+    /// The derived classes create the received packets from this pool.
+    PktPool<Pkt4> pkt_pool_;
 };
 
 /// Pointer to a PktFilter object.
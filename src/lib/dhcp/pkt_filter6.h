@@ -9,6 +9,7 @@
 
 #include <asiolink/io_address.h>
 #include <dhcp/pkt6.h>
+#include <dhcp/pkt_pool.h>
 
 namespace isc {
 namespace dhcp {
@@ -129,6 +130,20 @@ public:
     static bool joinMulticast(int sock, const std::string& ifname,
                               const std::string & mcast);
 
+    /// @brief Returns the pool of received packets.
+    ///
+    /// The pool provides the counters indicating how often the packet
+    /// objects are reused.
+    const PktPool<Pkt6>& getPacketPool() const {
+        return (pkt_pool_);
+    }
+
+protected:
+
+    /// @brief Pool of packet objects reused for received messages.
+    ///
+    /// The derived classes create the received packets from this pool.
+    PktPool<Pkt6> pkt_pool_;
 };
 
 
@@ -470,8 +470,8 @@ PktFilterBPF::receive(Iface& iface, const SocketInfo& socket_info) {
     }
 
     // Skip the BPF header and create the buffer holding a frame.
-    InputBuffer buf(iface.getReadBuffer() + offset + bpfh.bh_hdrlen,
-                    datalen - bpfh.bh_hdrlen - offset);
+    const uint8_t* frame = iface.getReadBuffer() + offset + bpfh.bh_hdrlen;
+    InputBuffer buf(frame, datalen - bpfh.bh_hdrlen - offset);
 
 
     // @todo: This is awkward way to solve the chicken and egg problem
@@ -519,12 +519,10 @@ PktFilterBPF::receive(Iface& iface, const SocketInfo& socket_info) {
     // Decode IP/UDP headers.
     decodeIpUdpHeader(buf, dummy_pkt);
 
-    // Read the DHCP data.
-    std::vector<uint8_t> dhcp_buf;
-    buf.readVector(dhcp_buf, buf.getLength() - buf.getPosition());
-
-    // Decode DHCP data into the Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
+    // Decode DHCP data into the Pkt4 object taken from the pool. The data
+    // is copied directly from the receive buffer.
+    Pkt4Ptr pkt = pkt_pool_.create(frame + buf.getPosition(),
+                                   buf.getLength() - buf.getPosition());
 
     // Set the appropriate packet members using data collected from
     // the decoded headers.
@@ -144,7 +144,7 @@ PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
     }
 
     // We have all data let's create Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(buf, result));
+    Pkt4Ptr pkt = pkt_pool_.create(buf, result);
 
     pkt->updateTimestamp();
 
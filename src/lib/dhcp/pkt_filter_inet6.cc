@@ -216,7 +216,7 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     // Let's create a packet.
     Pkt6Ptr pkt;
     try {
-        pkt = Pkt6Ptr(new Pkt6(buf, result));
+        pkt = pkt_pool_.create(buf, result);
     } catch (const std::exception& ex) {
         isc_throw(SocketReadError, "failed to create new packet");
     }
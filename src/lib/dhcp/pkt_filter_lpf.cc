@@ -255,12 +255,10 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
     decodeEthernetHeader(buf, dummy_pkt);
     decodeIpUdpHeader(buf, dummy_pkt);
 
-    // Read the DHCP data.
-    std::vector<uint8_t> dhcp_buf;
-    buf.readVector(dhcp_buf, buf.getLength() - buf.getPosition());
-
-    // Decode DHCP data into the Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
+    // Decode DHCP data into the Pkt4 object taken from the pool. The data
+    // is copied directly from the receive buffer.
+    Pkt4Ptr pkt = pkt_pool_.create(raw_buf + buf.getPosition(),
+                                   buf.getLength() - buf.getPosition());
 
     // Set the appropriate packet members using data collected from
     // the decoded headers.
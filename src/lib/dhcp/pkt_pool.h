@@ -0,0 +1,179 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PKT_POOL_H
+#define PKT_POOL_H
+
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Pool of reusable packet objects.
+///
+/// Creating a packet object for each received datagram involves
+/// allocating the object itself and the buffer holding the on-wire
+/// data. This class keeps the packets which are no longer in use
+/// and hands them out again for the subsequent datagrams, so the
+/// allocated objects and the capacity of their buffers are reused.
+///
+/// Packets are returned to the pool when the last shared pointer
+/// to them goes out of scope. At this time the packet is cleared
+/// with @c PktType::clear(), which drops its options, classes and
+/// the associated callout handle. The pool storage is shared with
+/// the pointers it returns, so the packets may safely outlive the
+/// pool object.
+///
+/// @note This class is not thread safe.
+///
+/// @tparam PktType Type of the packet, i.e. @c Pkt4 or @c Pkt6.
+template<typename PktType>
+class PktPool : public boost::noncopyable {
+public:
+
+    /// @brief Pointer to the packet.
+    typedef boost::shared_ptr<PktType> PktTypePtr;
+
+    /// @brief Default maximum number of packets held in the pool.
+    static const size_t DEFAULT_CAPACITY = 256;
+
+    /// @brief Constructor.
+    ///
+    /// @param capacity Maximum number of unused packets held in the pool.
+    /// Packets released when the pool is full are destroyed.
+    explicit PktPool(const size_t capacity = DEFAULT_CAPACITY)
+        : storage_(new Storage(capacity)) {
+    }
+
+    /// @brief Returns a packet holding the specified on-wire data.
+    ///
+    /// If there is an unused packet in the pool it is reused. Otherwise,
+    /// a new packet is created.
+    ///
+    /// @param buf Pointer to the on-wire data.
+    /// @param len Length of the on-wire data.
+    ///
+    /// @return Pointer to the packet.
+    /// @throw Exceptions thrown by the packet constructor or the
+    /// @c PktType::setData when the data is invalid.
+    PktTypePtr create(const uint8_t* buf, const uint32_t len) {
+        if (storage_->free_.empty()) {
+            ++storage_->misses_;
+            return (PktTypePtr(new PktType(buf, len), Releaser(storage_)));
+        }
+
+        PktType* pkt = storage_->free_.back();
+        storage_->free_.pop_back();
+        PktTypePtr pkt_ptr(pkt, Releaser(storage_));
+        // If setting the data fails, the releaser puts the packet back.
+        pkt->setData(buf, len);
+        ++storage_->hits_;
+        return (pkt_ptr);
+    }
+
+    /// @brief Returns the maximum number of unused packets in the pool.
+    size_t getCapacity() const {
+        return (storage_->capacity_);
+    }
+
+    /// @brief Returns the number of unused packets currently in the pool.
+    size_t getSize() const {
+        return (storage_->free_.size());
+    }
+
+    /// @brief Returns the number of packets served from the pool.
+    uint64_t getHits() const {
+        return (storage_->hits_);
+    }
+
+    /// @brief Returns the number of packets which had to be created
+    /// because the pool was empty.
+    uint64_t getMisses() const {
+        return (storage_->misses_);
+    }
+
+private:
+
+    /// @brief Holds unused packets and the counters.
+    struct Storage {
+
+        /// @brief Constructor.
+        ///
+        /// @param capacity Maximum number of unused packets.
+        explicit Storage(const size_t capacity)
+            : capacity_(capacity), free_(), hits_(0), misses_(0) {
+            free_.reserve(capacity);
+        }
+
+        /// @brief Destructor.
+        ///
+        /// Destroys all unused packets.
+        ~Storage() {
+            for (typename std::vector<PktType*>::iterator pkt = free_.begin();
+                 pkt != free_.end(); ++pkt) {
+                delete *pkt;
+            }
+        }
+
+        /// @brief Maximum number of unused packets.
+        size_t capacity_;
+
+        /// @brief Unused packets.
+        std::vector<PktType*> free_;
+
+        /// @brief Number of packets served from the pool.
+        uint64_t hits_;
+
+        /// @brief Number of packets created because the pool was empty.
+        uint64_t misses_;
+    };
+
+    /// @brief Deleter returning packets to the pool.
+    class Releaser {
+    public:
+
+        /// @brief Constructor.
+        ///
+        /// @param storage Pointer to the pool storage.
+        explicit Releaser(const boost::shared_ptr<Storage>& storage)
+            : storage_(storage) {
+        }
+
+        /// @brief Clears the packet and puts it into the pool or destroys
+        /// it when the pool is full.
+        ///
+        /// @param pkt Pointer to the packet being released.
+        void operator()(PktType* pkt) {
+            if (storage_->free_.size() < storage_->capacity_) {
+                try {
+                    pkt->clear();
+                    storage_->free_.push_back(pkt);
+                    return;
+                } catch (...) {
+                    // Destroy the packet which can't be reused.
+                }
+            }
+            delete pkt;
+        }
+
+    private:
+
+        /// @brief Pointer to the pool storage.
+        boost::shared_ptr<Storage> storage_;
+    };
+
+    /// @brief Pool storage shared with the released packets.
+    boost::shared_ptr<Storage> storage_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // PKT_POOL_H
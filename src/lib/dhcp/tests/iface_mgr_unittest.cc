@@ -699,6 +699,36 @@ TEST_F(IfaceMgrTest, clearIfaces) {
     EXPECT_EQ(0, ifacemgr.countIfaces());
 }
 
+// This test verifies that the re-detected interfaces replace the previous
+// ones only if they have changed and that the sockets are kept otherwise.
+TEST_F(IfaceMgrTest, redetectIfaces) {
+    NakedIfaceMgr ifacemgr;
+    IfacePtr lo_iface = ifacemgr.getIface(LOOPBACK);
+    ASSERT_TRUE(lo_iface);
+
+    boost::shared_ptr<TestPktFilter> custom_packet_filter(new TestPktFilter());
+    ASSERT_NO_THROW(ifacemgr.setPacketFilter(custom_packet_filter));
+    ASSERT_NO_THROW(ifacemgr.openSocket(LOOPBACK, IOAddress("127.0.0.1"),
+                                        DHCP4_SERVER_PORT));
+    ASSERT_EQ(1, lo_iface->getSockets().size());
+
+    // Nothing has changed, so the interfaces and their sockets are kept.
+    EXPECT_FALSE(ifacemgr.redetectIfaces());
+    EXPECT_TRUE(ifacemgr.getIface(LOOPBACK) == lo_iface);
+    EXPECT_EQ(1, lo_iface->getSockets().size());
+
+    // Pretend that an interface has disappeared.
+    IfacePtr fake_iface(new Iface("eth9999", 9999));
+    ifacemgr.getIfacesLst().push_back(fake_iface);
+    EXPECT_TRUE(ifacemgr.redetectIfaces());
+    EXPECT_FALSE(ifacemgr.getIface("eth9999"));
+    IfacePtr new_lo_iface = ifacemgr.getIface(LOOPBACK);
+    ASSERT_TRUE(new_lo_iface);
+    EXPECT_TRUE(new_lo_iface != lo_iface);
+    EXPECT_TRUE(lo_iface->getSockets().empty());
+    EXPECT_TRUE(new_lo_iface->getSockets().empty());
+}
+
 TEST_F(IfaceMgrTest, receiveTimeout6) {
     using namespace boost::posix_time;
     std::cout << "Testing DHCPv6 packet reception timeouts."
@@ -1276,6 +1306,45 @@ TEST_F(IfaceMgrTest, setPacketFilter) {
     EXPECT_NO_THROW(iface_mgr->setPacketFilter(custom_packet_filter));
 }
 
+/// @brief Packet filter creating the packets from its pool.
+class PoolPktFilter : public TestPktFilter {
+public:
+
+    /// @brief Creates a packet using the pool of the filter.
+    Pkt4Ptr createPacket() {
+        std::vector<uint8_t> buf(Pkt4::DHCPV4_PKT_HDR_LEN, 0);
+        return (pkt_pool_.create(&buf[0], buf.size()));
+    }
+};
+
+// This test checks that the counters of the packet pool are retained when
+// the packet filter is replaced.
+TEST_F(IfaceMgrTest, packetPoolCounters) {
+    boost::scoped_ptr<NakedIfaceMgr> iface_mgr(new NakedIfaceMgr());
+
+    boost::shared_ptr<PoolPktFilter> filter(new PoolPktFilter());
+    ASSERT_NO_THROW(iface_mgr->setPacketFilter(filter));
+    EXPECT_EQ(0, iface_mgr->getPacketPoolHits4());
+    EXPECT_EQ(0, iface_mgr->getPacketPoolMisses4());
+
+    // The first packet is created, the second one reuses it.
+    filter->createPacket();
+    filter->createPacket();
+    EXPECT_EQ(1, iface_mgr->getPacketPoolHits4());
+    EXPECT_EQ(1, iface_mgr->getPacketPoolMisses4());
+
+    // Setting the same filter doesn't count its packets twice.
+    ASSERT_NO_THROW(iface_mgr->setPacketFilter(filter));
+    EXPECT_EQ(1, iface_mgr->getPacketPoolHits4());
+
+    // The counters of the replaced filter are retained.
+    boost::shared_ptr<PoolPktFilter> new_filter(new PoolPktFilter());
+    ASSERT_NO_THROW(iface_mgr->setPacketFilter(new_filter));
+    new_filter->createPacket();
+    EXPECT_EQ(1, iface_mgr->getPacketPoolHits4());
+    EXPECT_EQ(2, iface_mgr->getPacketPoolMisses4());
+}
+
 // This test checks that the default packet filter for DHCPv6 can be replaced
 // with the custom one.
 TEST_F(IfaceMgrTest, setPacketFilter6) {
@@ -677,6 +677,85 @@ TEST_F(Pkt4Test, unpackOptions) {
     verifyParsedOptions(pkt);
 }
 
+// This test verifies that the options are decoded on first retrieval
+// when the lazy unpacking is enabled.
+TEST_F(Pkt4Test, unpackOptionsLazy) {
+
+    vector<uint8_t> expectedFormat = generateTestPacket2();
+
+    expectedFormat.push_back(0x63);
+    expectedFormat.push_back(0x82);
+    expectedFormat.push_back(0x53);
+    expectedFormat.push_back(0x63);
+
+    for (size_t i = 0; i < sizeof(v4_opts); i++) {
+        expectedFormat.push_back(v4_opts[i]);
+    }
+
+    Pkt4Ptr pkt(new Pkt4(&expectedFormat[0], expectedFormat.size()));
+    pkt->setLazyOptionUnpack(true);
+    EXPECT_TRUE(pkt->isLazyOptionUnpack());
+    ASSERT_NO_THROW(pkt->unpack());
+
+    // The message type is available without decoding the option.
+    EXPECT_EQ(DHCPOFFER, pkt->getType());
+
+    // The hostname option has a definition but it should be held as
+    // a generic option until it is retrieved.
+    OptionCollection::const_iterator hostname = pkt->options_.find(12);
+    ASSERT_TRUE(hostname != pkt->options_.end());
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionString>(hostname->second));
+
+    // Retrieving the option decodes it and replaces the generic instance.
+    OptionPtr opt = pkt->getOption(12);
+    ASSERT_TRUE(opt);
+    EXPECT_TRUE(boost::dynamic_pointer_cast<OptionString>(opt));
+    EXPECT_TRUE(opt == pkt->options_.find(12)->second);
+
+    // Subsequent retrieval returns the same instance.
+    EXPECT_TRUE(opt == pkt->getOption(12));
+
+    // The decoded options must be the same as in the non-lazy mode.
+    verifyParsedOptions(pkt);
+}
+
+// This test verifies that the option replacing a deleted option which
+// wasn't decoded by the lazy unpacking is not decoded again and that
+// malformed options are reported when they are retrieved.
+TEST_F(Pkt4Test, unpackOptionsLazyReplaced) {
+    vector<uint8_t> expectedFormat = generateTestPacket2();
+
+    expectedFormat.push_back(0x63);
+    expectedFormat.push_back(0x82);
+    expectedFormat.push_back(0x53);
+    expectedFormat.push_back(0x63);
+
+    for (size_t i = 0; i < sizeof(v4_opts); i++) {
+        expectedFormat.push_back(v4_opts[i]);
+    }
+
+    Pkt4Ptr pkt(new Pkt4(&expectedFormat[0], expectedFormat.size()));
+    pkt->setLazyOptionUnpack(true);
+    ASSERT_NO_THROW(pkt->unpack());
+
+    // Replace the hostname before it is decoded.
+    EXPECT_TRUE(pkt->delOption(12));
+    OptionPtr hostname(new OptionString(Option::V4, 12, "foo"));
+    pkt->addOption(hostname);
+    EXPECT_TRUE(hostname == pkt->getOption(12));
+
+    // A malformed option is rejected when it is retrieved and it is left
+    // undecoded. The hostname must not be empty.
+    pkt.reset(new Pkt4(&expectedFormat[0], expectedFormat.size()));
+    pkt->setLazyOptionUnpack(true);
+    ASSERT_NO_THROW(pkt->unpack());
+    OptionBuffer empty;
+    pkt->options_.find(12)->second->setData(empty.begin(), empty.end());
+    EXPECT_THROW(pkt->getOption(12), LazyOptionUnpackError);
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionString>
+                 (pkt->options_.find(12)->second));
+}
+
 // Checks if the code is able to handle a malformed option
 TEST_F(Pkt4Test, unpackMalformed) {
 
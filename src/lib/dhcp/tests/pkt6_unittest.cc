@@ -272,6 +272,66 @@ TEST_F(Pkt6Test, unpack_solicit1) {
     EXPECT_FALSE(sol->getOption(D6O_IAADDR));
 }
 
+// Checks that options are decoded on first retrieval when the lazy
+// unpacking is enabled.
+TEST_F(Pkt6Test, unpackLazy) {
+    Pkt6Ptr sol(capture1());
+    sol->setLazyOptionUnpack(true);
+
+    ASSERT_NO_THROW(sol->unpack());
+    EXPECT_EQ(DHCPV6_SOLICIT, sol->getType());
+
+    // IA_NA options are always decoded because the server iterates
+    // over them directly.
+    OptionCollection::const_iterator ia = sol->options_.find(D6O_IA_NA);
+    ASSERT_TRUE(ia != sol->options_.end());
+    EXPECT_TRUE(boost::dynamic_pointer_cast<Option6IA>(ia->second));
+
+    // The ORO is held as a generic option until it is retrieved.
+    OptionCollection::const_iterator oro = sol->options_.find(D6O_ORO);
+    ASSERT_TRUE(oro != sol->options_.end());
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionUint16Array>(oro->second));
+
+    OptionCollection oros = sol->getOptions(D6O_ORO);
+    ASSERT_EQ(1, oros.size());
+    OptionUint16ArrayPtr oro_decoded =
+        boost::dynamic_pointer_cast<OptionUint16Array>(oros.begin()->second);
+    ASSERT_TRUE(oro_decoded);
+    EXPECT_FALSE(oro_decoded->getValues().empty());
+    EXPECT_TRUE(oro_decoded == sol->getOption(D6O_ORO));
+
+    // The elapsed time option is decoded by getOption.
+    EXPECT_TRUE(boost::dynamic_pointer_cast<OptionInt<uint16_t> >
+                (sol->getOption(D6O_ELAPSED_TIME)));
+
+    // The client identifier is available regardless of the decoding.
+    EXPECT_TRUE(sol->getClientId());
+}
+
+// Checks that the options retrieved without copying and the options
+// printed by toText are decoded when the lazy unpacking is enabled.
+TEST_F(Pkt6Test, unpackLazyNonCopied) {
+    Pkt6Ptr donor(capture1());
+    NakedPkt6Ptr sol(new NakedPkt6(&donor->data_[0], donor->data_.size()));
+    sol->setLazyOptionUnpack(true);
+    ASSERT_NO_THROW(sol->unpack());
+
+    OptionCollection oros = sol->getNonCopiedOptions(D6O_ORO);
+    ASSERT_EQ(1, oros.size());
+    EXPECT_TRUE(boost::dynamic_pointer_cast<OptionUint16Array>(oros.begin()->second));
+    EXPECT_TRUE(oros.begin()->second == sol->options_.find(D6O_ORO)->second);
+
+    // The elapsed time option is still held as a generic option but it
+    // is printed as decoded.
+    OptionCollection::const_iterator elapsed =
+        sol->options_.find(D6O_ELAPSED_TIME);
+    ASSERT_TRUE(elapsed != sol->options_.end());
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionInt<uint16_t> >(elapsed->second));
+    sol->toText();
+    EXPECT_TRUE(boost::dynamic_pointer_cast<OptionInt<uint16_t> >
+                (sol->options_.find(D6O_ELAPSED_TIME)->second));
+}
+
 TEST_F(Pkt6Test, packUnpack) {
     // Create an on-wire representation of the test packet and clone it.
     Pkt6Ptr pkt(new Pkt6(DHCPV6_SOLICIT, 0x020304));
@@ -0,0 +1,151 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/dhcp6.h>
+#include <dhcp/option.h>
+#include <dhcp/pkt4.h>
+#include <dhcp/pkt6.h>
+#include <dhcp/pkt_pool.h>
+#include <exceptions/exceptions.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Returns wire format of a DHCPv4 message.
+///
+/// @param msg_type DHCP message type.
+/// @param transid Transaction id.
+std::vector<uint8_t> createWire4(const uint8_t msg_type,
+                                 const uint32_t transid) {
+    Pkt4 pkt(msg_type, transid);
+    pkt.pack();
+    const uint8_t* cp = static_cast<const uint8_t*>(pkt.getBuffer().getData());
+    return (std::vector<uint8_t>(cp, cp + pkt.getBuffer().getLength()));
+}
+
+// This test verifies that released packets are reused.
+TEST(PktPoolTest, reuse4) {
+    PktPool<Pkt4> pool(2);
+    EXPECT_EQ(2, pool.getCapacity());
+    EXPECT_EQ(0, pool.getSize());
+
+    std::vector<uint8_t> wire = createWire4(DHCPDISCOVER, 0x1234);
+
+    Pkt4Ptr pkt = pool.create(&wire[0], wire.size());
+    ASSERT_TRUE(pkt);
+    ASSERT_NO_THROW(pkt->unpack());
+    EXPECT_EQ(DHCPDISCOVER, pkt->getType());
+    EXPECT_EQ(0, pool.getHits());
+    EXPECT_EQ(1, pool.getMisses());
+
+    // Modify the packet to make sure that its state doesn't leak to
+    // the next use.
+    pkt->addClass("foo");
+    pkt->setLocalAddr(IOAddress("192.0.2.1"));
+    pkt->setIface("eth0");
+    Pkt4* raw_pkt = pkt.get();
+
+    // Releasing the packet puts it into the pool.
+    pkt.reset();
+    EXPECT_EQ(1, pool.getSize());
+
+    wire = createWire4(DHCPREQUEST, 0x5678);
+    pkt = pool.create(&wire[0], wire.size());
+    ASSERT_TRUE(pkt);
+    EXPECT_EQ(raw_pkt, pkt.get());
+    EXPECT_EQ(0, pool.getSize());
+    EXPECT_EQ(1, pool.getHits());
+    EXPECT_EQ(1, pool.getMisses());
+
+    // The reused packet should be in the same state as a new one.
+    EXPECT_TRUE(pkt->getClasses().empty());
+    EXPECT_TRUE(pkt->options_.empty());
+    EXPECT_EQ("0.0.0.0", pkt->getLocalAddr().toText());
+    EXPECT_TRUE(pkt->getIface().empty());
+    EXPECT_FALSE(pkt->indexSet());
+
+    ASSERT_NO_THROW(pkt->unpack());
+    EXPECT_EQ(DHCPREQUEST, pkt->getType());
+    EXPECT_EQ(0x5678, pkt->getTransid());
+}
+
+// This test verifies that the packets are destroyed when the pool is
+// full and that the packets may outlive the pool.
+TEST(PktPoolTest, capacity) {
+    std::vector<uint8_t> wire = createWire4(DHCPDISCOVER, 0x1234);
+
+    Pkt4Ptr outliving;
+    {
+        PktPool<Pkt4> pool(1);
+        Pkt4Ptr pkt1 = pool.create(&wire[0], wire.size());
+        Pkt4Ptr pkt2 = pool.create(&wire[0], wire.size());
+        outliving = pool.create(&wire[0], wire.size());
+        EXPECT_EQ(3, pool.getMisses());
+
+        pkt1.reset();
+        pkt2.reset();
+        EXPECT_EQ(1, pool.getSize());
+    }
+
+    // Releasing the packet after the pool has been destroyed must be safe.
+    EXPECT_NO_THROW(outliving.reset());
+}
+
+// This test verifies that invalid data doesn't consume pooled packets.
+TEST(PktPoolTest, invalidData) {
+    PktPool<Pkt4> pool;
+    std::vector<uint8_t> wire = createWire4(DHCPDISCOVER, 0x1234);
+
+    pool.create(&wire[0], wire.size());
+    EXPECT_EQ(1, pool.getSize());
+
+    // The DHCPv4 packet is too short.
+    EXPECT_THROW(pool.create(&wire[0], 10), OutOfRange);
+    EXPECT_EQ(1, pool.getSize());
+}
+
+// This test verifies that released DHCPv6 packets are reused.
+TEST(PktPoolTest, reuse6) {
+    PktPool<Pkt6> pool;
+
+    Pkt6 solicit(DHCPV6_SOLICIT, 0x1234);
+    solicit.addOption(OptionPtr(new Option(Option::V6, D6O_CLIENTID,
+                                           OptionBuffer(8, 1))));
+    solicit.pack();
+    const uint8_t* cp = static_cast<const uint8_t*>(solicit.getBuffer().getData());
+    std::vector<uint8_t> wire(cp, cp + solicit.getBuffer().getLength());
+
+    Pkt6Ptr pkt = pool.create(&wire[0], wire.size());
+    ASSERT_NO_THROW(pkt->unpack());
+    EXPECT_TRUE(pkt->getOption(D6O_CLIENTID));
+    pkt.reset();
+
+    Pkt6 request(DHCPV6_REQUEST, 0x5678);
+    request.pack();
+    cp = static_cast<const uint8_t*>(request.getBuffer().getData());
+    wire.assign(cp, cp + request.getBuffer().getLength());
+
+    pkt = pool.create(&wire[0], wire.size());
+    EXPECT_EQ(1, pool.getHits());
+    EXPECT_TRUE(pkt->options_.empty());
+    ASSERT_NO_THROW(pkt->unpack());
+    EXPECT_EQ(DHCPV6_REQUEST, pkt->getType());
+    EXPECT_EQ(0x5678, pkt->getTransid());
+    EXPECT_FALSE(pkt->getOption(D6O_CLIENTID));
+}
+
+}
@@ -79,6 +79,10 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// Minimal interval between the log messages summarizing the allocations
+/// which failed because the pools were exhausted (in seconds).
+const time_t ALLOC_FAIL_SUMMARY_INTERVAL = 60;
+
 }; // anonymous namespace
 
 namespace isc {
@@ -183,7 +187,9 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
     PoolCollection::const_iterator first = pools.end();
     PoolPtr first_pool;
     for (it = pools.begin(); it != pools.end(); ++it) {
-        if (!(*it)->clientSupported(client_classes)) {
+        // Skip the pools not allowed for the client and the pools in
+        // which the allocation engine didn't find a free lease.
+        if ((*it)->isExhausted() || !(*it)->clientSupported(client_classes)) {
             continue;
         }
         if (first == pools.end()) {
@@ -212,7 +218,8 @@ AllocEngine::IterativeAllocator::pickAddress(const SubnetPtr& subnet,
         // Trying next pool
         if (retrying) {
             for (; it != pools.end(); ++it) {
-                if ((*it)->clientSupported(client_classes)) {
+                if (!(*it)->isExhausted() &&
+                    (*it)->clientSupported(client_classes)) {
                     break;
                 }
             }
@@ -316,7 +323,8 @@ AllocEngine::RandomAllocator::pickAddress(const SubnetPtr&,
 AllocEngine::AllocEngine(AllocType engine_type, uint64_t attempts,
                          bool ipv6)
     : attempts_(attempts), incomplete_v4_reclamations_(0),
-      incomplete_v6_reclamations_(0) {
+      incomplete_v6_reclamations_(0), exhausted_v4_failures_(0),
+      exhausted_v4_log_time_(0) {
 
     // Choose the basic (normal address) lease type
     Lease::Type basic_type = ipv6 ? Lease::TYPE_NA : Lease::TYPE_V4;
@@ -2366,6 +2374,13 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
         }
     }
 
+    // The reclaimed address can be allocated again.
+    Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getSubnet(lease->subnet_id_);
+    if (subnet) {
+        subnet->resetPoolExhausted(Lease::TYPE_V4, lease->addr_);
+    }
+
     // Update statistics.
 
     // Decrease number of assigned addresses.
@@ -3267,6 +3282,13 @@ AllocEngine::requestLease4(AllocEngine::ClientContext4& ctx) {
 
         lease_mgr.deleteLease(client_lease->addr_);
 
+        // The previous address of the client can be allocated again.
+        Subnet4Ptr old_subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets4()->getSubnet(client_lease->subnet_id_);
+        if (old_subnet) {
+            old_subnet->resetPoolExhausted(Lease::TYPE_V4, client_lease->addr_);
+        }
+
         // Need to decrease statistic for assigned addresses.
         StatsMgr::instance().addValue(
             StatsMgr::generateName("subnet", client_lease->subnet_id_, "assigned-addresses"),
@@ -3635,7 +3657,16 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
 
     Subnet4Ptr original_subnet = subnet;
 
+    // The pools in which no free address was found are marked exhausted
+    // and skipped until one of their leases is released, reclaimed or
+    // deleted. A pool marked exhausted may still get free addresses in
+    // other ways: its leases expire and can be reused even if they are
+    // not reclaimed, and another server sharing the lease database may
+    // delete them. So the pool is tried again after Pool::EXHAUSTED_TIMEOUT
+    // in any case. This replaces the shared network wide tracking of the
+    // free capacity: the pools account for the pool level client classes.
     uint64_t total_attempts = 0;
+    bool pools_exhausted = false;
     while (subnet) {
 
         ClientIdPtr client_id;
@@ -3643,9 +3674,16 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
             client_id = ctx.clientid_;
         }
 
+        // The subnets and pools known to be exhausted are skipped without
+        // probing any of their addresses.
         uint64_t possible_attempts =
-            subnet->getPoolCapacity(Lease::TYPE_V4,
-                                    ctx.query_->getClasses());
+            subnet->getFreePoolCapacity(Lease::TYPE_V4,
+                                        ctx.query_->getClasses());
+        if ((possible_attempts == 0) &&
+            (subnet->getPoolCapacity(Lease::TYPE_V4,
+                                     ctx.query_->getClasses()) > 0)) {
+            pools_exhausted = true;
+        }
         uint64_t max_attempts = (attempts_ > 0 ? attempts_ : possible_attempts);
         // Skip trying if there is no chance to get something
         if (possible_attempts == 0) {
@@ -3681,6 +3719,18 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
 
         // This pointer may be set to NULL if hooks set SKIP status.
         if (subnet) {
+            // All addresses of the pools allowed for the client have been
+            // tried, so there is no point in trying them for other clients.
+            if ((possible_attempts > 0) &&
+                (max_attempts >= possible_attempts)) {
+                subnet->setPoolsExhausted(Lease::TYPE_V4,
+                                          ctx.query_->getClasses());
+                LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                          ALLOC_ENGINE_V4_POOLS_EXHAUSTED)
+                    .arg(ctx.query_->getLabel())
+                    .arg(subnet->toText());
+            }
+
             subnet = subnet->getNextSubnet(original_subnet, ctx.query_->getClasses());
 
             if (subnet) {
@@ -3690,13 +3740,44 @@ AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
     }
 
     // Unable to allocate an address, return an empty lease.
-    LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V4_ALLOC_FAIL)
-        .arg(ctx.query_->getLabel())
-        .arg(total_attempts);
+    StatsMgr::instance().addValue("v4-allocation-fail", int64_t(1));
+    StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
+                                                         original_subnet->getID(),
+                                                         "v4-allocation-fail"),
+                                  int64_t(1));
+
+    if ((total_attempts > 0) || !pools_exhausted) {
+        LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V4_ALLOC_FAIL)
+            .arg(ctx.query_->getLabel())
+            .arg(total_attempts);
+        return (new_lease);
+    }
+
+    // All pools allowed for the client were already known to be exhausted.
+    // Such failures repeat for each retransmission of each client, so they
+    // are summarized rather than logged one by one.
+    StatsMgr::instance().addValue("v4-allocation-fail-exhausted", int64_t(1));
+    ++exhausted_v4_failures_;
+    logExhaustedFailures4();
 
     return (new_lease);
 }
 
+void
+AllocEngine::logExhaustedFailures4() {
+    if (exhausted_v4_failures_ == 0) {
+        return;
+    }
+    const time_t now = time(NULL);
+    if ((now < exhausted_v4_log_time_) ||
+        (now - exhausted_v4_log_time_ >= ALLOC_FAIL_SUMMARY_INTERVAL)) {
+        LOG_WARN(alloc_engine_logger, ALLOC_ENGINE_V4_ALLOC_FAIL_EXHAUSTED)
+            .arg(exhausted_v4_failures_);
+        exhausted_v4_failures_ = 0;
+        exhausted_v4_log_time_ = now;
+    }
+}
+
 void
 AllocEngine::updateLease4Information(const Lease4Ptr& lease,
                                      AllocEngine::ClientContext4& ctx) const {
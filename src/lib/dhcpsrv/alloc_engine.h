@@ -738,6 +738,15 @@ public:
     /// deleted.
     void deleteExpiredReclaimedLeases4(const uint32_t secs);
 
+    /// @brief Logs the summary of the DHCPv4 allocations which failed
+    /// because the pools were exhausted.
+    ///
+    /// The summary is logged at most once a minute and only if there were
+    /// such failures since the previous summary. It is called after each
+    /// such failure and periodically by the server, so the last failures
+    /// are reported even when no further allocation fails.
+    void logExhaustedFailures4();
+
 
     /// @anchor findReservationDecl
     /// @brief Attempts to find appropriate host reservation.
@@ -1480,7 +1489,12 @@ private:
     /// fails. This is the case when the pool is exhausted.
     ///
     /// The time required to find a suitable lease depends on the current
-    /// pool utilization.
+    /// pool utilization. The pools in which no free address was found are
+    /// marked exhausted and skipped by the subsequent allocations for at
+    /// most @c Pool::EXHAUSTED_TIMEOUT seconds, so the
+    /// allocation fails without probing any address when all pools allowed
+    /// for the client are exhausted. These failures are counted and logged
+    /// in a summary message at most once a minute.
     ///
     /// @param ctx Client context holding the data extracted from the
     /// client's message.
@@ -1542,6 +1556,15 @@ private:
     /// @brief Number of consecutive DHCPv6 leases' reclamations after
     /// which there are still expired leases in the database.
     uint16_t incomplete_v6_reclamations_;
+
+    /// @brief Number of DHCPv4 allocations which failed because all pools
+    /// allowed for the client were exhausted, since the last summary
+    /// log message.
+    uint64_t exhausted_v4_failures_;
+
+    /// @brief Time of the last summary log message about the exhausted
+    /// pools.
+    time_t exhausted_v4_log_time_;
 };
 
 /// @brief A pointer to the @c AllocEngine object.
@@ -7,9 +7,11 @@
 #include <config.h>
 #include <dhcpsrv/cfg_db_access.h>
 #include <dhcpsrv/db_type.h>
+#include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/memfile_lease_mgr.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/foreach.hpp>
 #include <boost/lexical_cast.hpp>
@@ -23,7 +25,7 @@ namespace dhcp {
 
 CfgDbAccess::CfgDbAccess()
     : appended_parameters_(), lease_db_access_("type=memfile"),
-      host_db_access_() {
+      host_db_access_(), lease_mgr_reused_(false) {
 }
 
 std::string
@@ -54,6 +56,8 @@ CfgDbAccess::getHostDbAccessStringList() const {
 
 void
 CfgDbAccess::createManagers() const {
+    lease_mgr_reused_ = false;
+
     // Recreate lease manager.
     LeaseMgrFactory::destroy();
     LeaseMgrFactory::create(getLeaseDbAccessString());
@@ -69,6 +73,48 @@ CfgDbAccess::createManagers() const {
     HostMgr::checkCacheBackend(true);
 }
 
+void
+CfgDbAccess::updateManagers(const CfgDbAccess& current,
+                            const bool reuse_hosts) const {
+    const std::string lease_db_access = getLeaseDbAccessString();
+    lease_mgr_reused_ = LeaseMgrFactory::haveInstance() &&
+        (lease_db_access == current.getLeaseDbAccessString());
+
+    if (lease_mgr_reused_) {
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_CFGMGR_LEASE_DB_REUSED)
+            .arg(LeaseMgrFactory::instance().getType());
+
+        // The server unregisters all timers when it is reconfigured,
+        // including the timer of the Lease File Cleanup.
+        Memfile_LeaseMgr* memfile =
+            dynamic_cast<Memfile_LeaseMgr*>(&LeaseMgrFactory::instance());
+        if (memfile) {
+            memfile->restoreLFCTimer();
+        }
+
+    } else {
+        LeaseMgrFactory::destroy();
+        LeaseMgrFactory::create(lease_db_access);
+    }
+
+    // Recreate host data sources unless they can be reused.
+    const std::list<std::string> host_db_access_list = getHostDbAccessStringList();
+    if (reuse_hosts &&
+        (host_db_access_list == current.getHostDbAccessStringList())) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_CFGMGR_HOST_DB_REUSED);
+        return;
+    }
+
+    HostMgr::create();
+    for (const std::string& hds : host_db_access_list) {
+        HostMgr::addBackend(hds);
+    }
+
+    // Check for a host cache.
+    HostMgr::checkCacheBackend(true);
+}
+
 std::string 
 CfgDbAccess::getAccessString(const std::string& access_string) const {
     std::ostringstream s;
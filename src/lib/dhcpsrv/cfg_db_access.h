@@ -78,6 +78,31 @@ public:
     /// according to the configuration specified.
     void createManagers() const;
 
+    /// @brief Creates instance of lease manager and host data sources
+    /// unless the existing ones have been created with the same parameters.
+    ///
+    /// Recreating the lease manager reloads the lease files or reconnects
+    /// to the database, which takes a long time for large deployments.
+    /// This method is used on server reconfiguration to reuse the existing
+    /// backends when their access parameters haven't changed.
+    ///
+    /// @param current Database access configuration according to which
+    /// the existing lease manager and host data sources have been created.
+    /// @param reuse_hosts Boolean flag indicating if the host data sources
+    /// may be reused. It should be false when the hooks libraries have been
+    /// reloaded, because they may provide the host data sources.
+    void updateManagers(const CfgDbAccess& current,
+                        const bool reuse_hosts = true) const;
+
+    /// @brief Checks if the lease manager has been reused by the
+    /// @ref CfgDbAccess::updateManagers.
+    ///
+    /// If the lease manager has been reused the lease statistics it
+    /// maintains remain valid.
+    bool isLeaseMgrReused() const {
+        return (lease_mgr_reused_);
+    }
+
     /// @brief Unparse an access string
     ///
     /// @param dbaccess the database access string
@@ -102,6 +127,8 @@ protected:
     /// @brief Holds host database access strings.
     std::list<std::string> host_db_access_;
 
+    /// @brief Indicates if the lease manager has been reused.
+    mutable bool lease_mgr_reused_;
 };
 
 /// @brief A pointer to the @c CfgDbAccess.
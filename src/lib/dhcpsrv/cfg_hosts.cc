@@ -13,6 +13,7 @@
 #include <dhcpsrv/cfgmgr.h>
 #include <exceptions/exceptions.h>
 #include <util/encode/hex.h>
+#include <iterator>
 #include <ostream>
 #include <string>
 #include <vector>
@@ -64,6 +65,28 @@ CfgHosts::getAll4(const IOAddress& address) {
     return (collection);
 }
 
+HostCollection
+CfgHosts::getAll4(const SubnetID& subnet_id) {
+    HostCollection collection;
+    for (auto host = hosts_.begin(); host != hosts_.end(); ++host) {
+        if ((*host)->getIPv4SubnetID() == subnet_id) {
+            collection.push_back(*host);
+        }
+    }
+    return (collection);
+}
+
+HostCollection
+CfgHosts::getAll6(const SubnetID& subnet_id) {
+    HostCollection collection;
+    for (auto host = hosts_.begin(); host != hosts_.end(); ++host) {
+        if ((*host)->getIPv6SubnetID() == subnet_id) {
+            collection.push_back(*host);
+        }
+    }
+    return (collection);
+}
+
 ConstHostCollection
 CfgHosts::getAll6(const IOAddress& address) const {
     // Do not issue logging message here because it will be logged by
@@ -202,17 +225,19 @@ CfgHosts::get4(const SubnetID& subnet_id, const IOAddress& address) const {
     LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4)
         .arg(subnet_id).arg(address.toText());
 
-    ConstHostCollection hosts = getAll4(address);
-    for (ConstHostCollection::const_iterator host = hosts.begin();
-         host != hosts.end(); ++host) {
-        if ((*host)->getIPv4SubnetID() == subnet_id) {
-            LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
-                      HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4_HOST)
-                .arg(subnet_id)
-                .arg(address.toText())
-                .arg((*host)->toText());
-            return (*host);
-        }
+    // The same address may be reserved in many subnets, so the lookup
+    // uses the (subnet id, address) index rather than all hosts having
+    // reservations for this address.
+    const HostContainerIndex4& idx = hosts_.get<4>();
+    HostContainerIndex4::const_iterator host =
+        idx.find(boost::make_tuple(subnet_id, address));
+    if (host != idx.end()) {
+        LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
+                  HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4_HOST)
+            .arg(subnet_id)
+            .arg(address.toText())
+            .arg((*host)->toText());
+        return (*host);
     }
 
     LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS, HOSTS_CFG_GET_ONE_SUBNET_ID_ADDRESS4_NULL)
@@ -377,45 +402,50 @@ CfgHosts::getHostInternal(const SubnetID& subnet_id, const bool subnet6,
         .arg(subnet_id)
         .arg(Host::getIdentifierAsText(identifier_type, identifier, identifier_len));
 
-    // Get all hosts for a specified identifier. This may return multiple hosts
-    // for different subnets, but the number of hosts returned should be low
-    // because one host presumably doesn't show up in many subnets.
-    HostCollection hosts;
-    getAllInternal<HostCollection>(identifier_type, identifier, identifier_len,
-                                   hosts);
-
+    // Search for the hosts using the (identifier, identifier type,
+    // subnet id) index of the appropriate subnet family, so the lookup
+    // doesn't depend on the number of subnets in which the host has
+    // reservations.
+    const std::vector<uint8_t> identifier_vec(identifier,
+                                              identifier + identifier_len);
     HostPtr host;
-    // Iterate over the returned hosts and select those for which the
-    // subnet id matches.
-    for (HostCollection::const_iterator host_it = hosts.begin();
-         host_it != hosts.end(); ++host_it) {
-        // Check if this is IPv4 subnet or IPv6 subnet.
-        SubnetID host_subnet_id = subnet6 ? (*host_it)->getIPv6SubnetID() :
-            (*host_it)->getIPv4SubnetID();
-
-        if (subnet_id == host_subnet_id) {
-            // If this is the first occurrence of the host for this subnet,
-            // remember it. But, if we find that this is second @c Host object
-            // for the same client, it is a misconfiguration. Most likely,
-            // the administrator has specified one reservation for a HW
-            // address and another one for the DUID, which gives an ambiguous
-            // result, and we don't know which reservation we should choose.
-            // Therefore, throw an exception.
-            if (!host) {
-                host = *host_it;
-
-            } else {
-                isc_throw(DuplicateHost,  "more than one reservation found"
-                          " for the host belonging to the subnet with id '"
-                          << subnet_id << "' and using the identifier '"
-                          << Host::getIdentifierAsText(identifier_type,
-                                                       identifier,
-                                                       identifier_len)
-                          << "'");
-            }
+    size_t hosts_num = 0;
+    if (subnet6) {
+        const HostContainerIndex3& idx = hosts_.get<3>();
+        HostContainerIndex3Range r =
+            idx.equal_range(boost::make_tuple(identifier_vec, identifier_type,
+                                              subnet_id));
+        if (r.first != r.second) {
+            host = *r.first;
+            hosts_num = std::distance(r.first, r.second);
+        }
+
+    } else {
+        const HostContainerIndex2& idx = hosts_.get<2>();
+        HostContainerIndex2Range r =
+            idx.equal_range(boost::make_tuple(identifier_vec, identifier_type,
+                                              subnet_id));
+        if (r.first != r.second) {
+            host = *r.first;
+            hosts_num = std::distance(r.first, r.second);
         }
     }
 
+    // If we find more than one @c Host object for the same client in this
+    // subnet, it is a misconfiguration. Most likely, the administrator has
+    // specified one reservation for a HW address and another one for the
+    // DUID, which gives an ambiguous result, and we don't know which
+    // reservation we should choose. Therefore, throw an exception.
+    if (hosts_num > 1) {
+        isc_throw(DuplicateHost,  "more than one reservation found"
+                  " for the host belonging to the subnet with id '"
+                  << subnet_id << "' and using the identifier '"
+                  << Host::getIdentifierAsText(identifier_type,
+                                               identifier,
+                                               identifier_len)
+                  << "'");
+    }
+
     if (host) {
         LOG_DEBUG(hosts_logger, HOSTS_DBG_RESULTS,
                   HOSTS_CFG_GET_ONE_SUBNET_ID_IDENTIFIER_HOST)
@@ -594,30 +624,148 @@ CfgHosts::add6(const HostPtr& host) {
 }
 
 bool
-CfgHosts::del(const SubnetID& /*subnet_id*/, const asiolink::IOAddress& /*addr*/) {
-    /// @todo: Implement host removal
-    isc_throw(NotImplemented, "sorry, not implemented");
-    return (false);
+CfgHosts::del(const SubnetID& subnet_id, const asiolink::IOAddress& addr) {
+    HostPtr host;
+    if (addr.isV4()) {
+        const HostContainerIndex4& idx = hosts_.get<4>();
+        HostContainerIndex4::iterator it =
+            idx.find(boost::make_tuple(subnet_id, addr));
+        if (it != idx.end()) {
+            host = *it;
+        }
+
+    } else {
+        const HostContainer6Index1& idx = hosts6_.get<1>();
+        HostContainer6Index1::iterator it =
+            idx.find(boost::make_tuple(subnet_id, addr));
+        if (it != idx.end()) {
+            host = it->host_;
+        }
+    }
+
+    if (!host) {
+        return (false);
+    }
+
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_DEL)
+        .arg(subnet_id).arg(addr.toText());
+    delHost(host);
+    return (true);
 }
 
 bool
-CfgHosts::del4(const SubnetID& /*subnet_id*/,
-               const Host::IdentifierType& /*identifier_type*/,
-               const uint8_t* /*identifier_begin*/,
-               const size_t /*identifier_len*/) {
-    /// @todo: Implement host removal
-    isc_throw(NotImplemented, "sorry, not implemented");
-    return (false);
+CfgHosts::del4(const SubnetID& subnet_id,
+               const Host::IdentifierType& identifier_type,
+               const uint8_t* identifier_begin,
+               const size_t identifier_len) {
+    const std::vector<uint8_t> identifier(identifier_begin,
+                                          identifier_begin + identifier_len);
+    const HostContainerIndex2& idx = hosts_.get<2>();
+    HostContainerIndex2::iterator it =
+        idx.find(boost::make_tuple(identifier, identifier_type, subnet_id));
+    if (it == idx.end()) {
+        return (false);
+    }
+
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_DEL4)
+        .arg(subnet_id)
+        .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
+                                       identifier_len));
+    delHost(*it);
+    return (true);
 }
 
 bool
-CfgHosts::del6(const SubnetID& /*subnet_id*/,
-               const Host::IdentifierType& /*identifier_type*/,
-               const uint8_t* /*identifier_begin*/,
-               const size_t /*identifier_len*/) {
-    /// @todo: Implement host removal
-    isc_throw(NotImplemented, "sorry, not implemented");
-    return (false);
+CfgHosts::del6(const SubnetID& subnet_id,
+               const Host::IdentifierType& identifier_type,
+               const uint8_t* identifier_begin,
+               const size_t identifier_len) {
+    const std::vector<uint8_t> identifier(identifier_begin,
+                                          identifier_begin + identifier_len);
+    const HostContainerIndex3& idx = hosts_.get<3>();
+    HostContainerIndex3::iterator it =
+        idx.find(boost::make_tuple(identifier, identifier_type, subnet_id));
+    if (it == idx.end()) {
+        return (false);
+    }
+
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_DEL6)
+        .arg(subnet_id)
+        .arg(Host::getIdentifierAsText(identifier_type, identifier_begin,
+                                       identifier_len));
+    delHost(*it);
+    return (true);
+}
+
+void
+CfgHosts::delHost(const HostPtr& host) {
+    // Take a copy of the pointer as the caller may pass the reference to
+    // the pointer held in the container.
+    HostPtr deleted = host;
+
+    // Delete IPv6 reservations using the (subnet-id, address) index.
+    HostContainer6Index1& idx6 = hosts6_.get<1>();
+    IPv6ResrvRange reservations = deleted->getIPv6Reservations();
+    for (IPv6ResrvIterator resrv = reservations.first;
+         resrv != reservations.second; ++resrv) {
+        HostContainer6Index1::iterator it =
+            idx6.find(boost::make_tuple(deleted->getIPv6SubnetID(),
+                                        resrv->second.getPrefix()));
+        if ((it != idx6.end()) && (it->host_ == deleted)) {
+            idx6.erase(it);
+        }
+    }
+
+    HostContainerIndex2& idx = hosts_.get<2>();
+    HostContainerIndex2Range r =
+        idx.equal_range(boost::make_tuple(deleted->getIdentifier(),
+                                          deleted->getIdentifierType(),
+                                          deleted->getIPv4SubnetID()));
+    for (HostContainerIndex2::iterator it = r.first; it != r.second; ++it) {
+        if (*it == deleted) {
+            idx.erase(it);
+            break;
+        }
+    }
+}
+
+size_t
+CfgHosts::delAll4(const SubnetID& subnet_id) {
+    size_t erased_hosts = 0;
+    for (auto host = hosts_.begin(); host != hosts_.end(); ) {
+        if ((*host)->getIPv4SubnetID() == subnet_id) {
+            host = hosts_.erase(host);
+            ++erased_hosts;
+        } else {
+            ++host;
+        }
+    }
+
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_DEL_ALL_SUBNET4)
+        .arg(erased_hosts).arg(subnet_id);
+    return (erased_hosts);
+}
+
+size_t
+CfgHosts::delAll6(const SubnetID& subnet_id) {
+    // Delete IPv6 reservations first.
+    HostContainer6Index1& idx6 = hosts6_.get<1>();
+    idx6.erase(idx6.lower_bound(boost::make_tuple(subnet_id)),
+               idx6.upper_bound(boost::make_tuple(subnet_id)));
+
+    size_t erased_hosts = 0;
+    for (auto host = hosts_.begin(); host != hosts_.end(); ) {
+        if ((*host)->getIPv6SubnetID() == subnet_id) {
+            host = hosts_.erase(host);
+            ++erased_hosts;
+        } else {
+            ++host;
+        }
+    }
+
+    LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_DEL_ALL_SUBNET6)
+        .arg(erased_hosts).arg(subnet_id);
+    return (erased_hosts);
 }
 
 ElementPtr
@@ -97,6 +97,14 @@ public:
     virtual HostCollection
     getAll4(const asiolink::IOAddress& address);
 
+    /// @brief Returns a collection of hosts belonging to the IPv4 subnet.
+    ///
+    /// @param subnet_id IPv4 subnet identifier.
+    ///
+    /// @return Collection of @c Host objects.
+    HostCollection
+    getAll4(const SubnetID& subnet_id);
+
     /// @brief Returns a collection of hosts using the specified IPv6 address.
     ///
     /// This method may return multiple @c Host objects if they are connected
@@ -119,6 +127,14 @@ public:
     virtual HostCollection
     getAll6(const asiolink::IOAddress& address);
 
+    /// @brief Returns a collection of hosts belonging to the IPv6 subnet.
+    ///
+    /// @param subnet_id IPv6 subnet identifier.
+    ///
+    /// @return Collection of @c Host objects.
+    HostCollection
+    getAll6(const SubnetID& subnet_id);
+
     /// @brief Returns a host connected to the IPv4 subnet.
     ///
     /// @param subnet_id Subnet identifier.
@@ -234,17 +250,17 @@ public:
 
     /// @brief Attempts to delete a host by address.
     ///
-    /// This method supports both v4 and v6.
-    /// @todo: Not implemented.
+    /// This method supports both v4 and v6. It deletes the host holding
+    /// the reservation for the address in the specified subnet.
     ///
     /// @param subnet_id subnet identifier.
     /// @param addr specified address.
+    /// @return true if deletion was successful, false otherwise.
     virtual bool del(const SubnetID& subnet_id, const asiolink::IOAddress& addr);
 
     /// @brief Attempts to delete a host by (subnet4-id, identifier, identifier-type)
     ///
     /// This method supports v4 only.
-    /// @todo: Not implemented.
     ///
     /// @param subnet_id IPv4 Subnet identifier.
     /// @param identifier_type Identifier type.
@@ -258,8 +274,8 @@ public:
 
     /// @brief Attempts to delete a host by (subnet6-id, identifier, identifier-type)
     ///
-    /// This method supports v6 only.
-    /// @todo: Not implemented.
+    /// This method supports v6 only. The host is deleted along with
+    /// its IPv6 reservations.
     ///
     /// @param subnet_id IPv6 Subnet identifier.
     /// @param identifier_type Identifier type.
@@ -271,6 +287,25 @@ public:
                       const Host::IdentifierType& identifier_type,
                       const uint8_t* identifier_begin, const size_t identifier_len);
 
+    /// @brief Deletes all hosts belonging to the IPv4 subnet.
+    ///
+    /// This method is used when the IPv4 subnet is removed or replaced
+    /// in the configuration.
+    ///
+    /// @param subnet_id IPv4 subnet identifier.
+    /// @return Number of deleted hosts.
+    size_t delAll4(const SubnetID& subnet_id);
+
+    /// @brief Deletes all hosts belonging to the IPv6 subnet.
+    ///
+    /// This method is used when the IPv6 subnet is removed or replaced
+    /// in the configuration. It removes the hosts along with their IPv6
+    /// reservations.
+    ///
+    /// @param subnet_id IPv6 subnet identifier.
+    /// @return Number of deleted hosts.
+    size_t delAll6(const SubnetID& subnet_id);
+
     /// @brief Return backend type
     ///
     /// Returns the type of the backend (e.g. "mysql", "memfile" etc.)
@@ -300,6 +335,11 @@ public:
 
 private:
 
+    /// @brief Deletes the host and its IPv6 reservations.
+    ///
+    /// @param host Pointer to the host to be deleted.
+    void delHost(const HostPtr& host);
+
     /// @brief Returns @c Host objects for the specific identifier and type.
     ///
     /// This private method is called by the @c CfgHosts::getAllInternal
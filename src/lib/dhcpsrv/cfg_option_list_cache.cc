@@ -0,0 +1,91 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cfg_option_list_cache.h>
+
+namespace isc {
+namespace dhcp {
+
+ResolvedOptions::ResolvedOptions(const std::string& option_space,
+                                 const CfgOptionList& co_list)
+    : options_(), persistent_codes_() {
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        const OptionContainerPtr& opts = (*copts)->getAll(option_space);
+        if (!opts || opts->empty()) {
+            continue;
+        }
+
+        // The option configured for a given code is the one found by
+        // the type index, which is what the CfgOption::get returns.
+        // Codes already resolved from the configurations of higher
+        // precedence are skipped.
+        const OptionContainerTypeIndex& idx = opts->get<1>();
+        for (OptionContainerTypeIndex::const_iterator desc = idx.begin();
+             desc != idx.end(); ++desc) {
+            if (!desc->option_) {
+                continue;
+            }
+            const uint16_t code = desc->option_->getType();
+            if (options_.count(code) > 0) {
+                continue;
+            }
+            OptionContainerTypeIndex::const_iterator found = idx.find(code);
+            if (found->option_) {
+                options_[code] = found->option_;
+            }
+        }
+
+        const OptionContainerPersistIndex& persist_idx = opts->get<2>();
+        const OptionContainerPersistRange& range = persist_idx.equal_range(true);
+        for (OptionContainerPersistIndex::const_iterator desc = range.first;
+             desc != range.second; ++desc) {
+            if (desc->option_) {
+                persistent_codes_.push_back(desc->option_->getType());
+            }
+        }
+    }
+}
+
+OptionPtr
+ResolvedOptions::get(const uint16_t code) const {
+    std::map<uint16_t, OptionPtr>::const_iterator option = options_.find(code);
+    return (option != options_.end() ? option->second : OptionPtr());
+}
+
+CfgOptionListCache::CfgOptionListCache(const size_t max_size)
+    : max_size_(max_size), cache_() {
+}
+
+ConstResolvedOptionsPtr
+CfgOptionListCache::get(const std::string& option_space,
+                        const CfgOptionList& co_list) {
+    const Key key(option_space, std::vector<ConstCfgOptionPtr>(co_list.begin(),
+                                                              co_list.end()));
+
+    std::map<Key, ConstResolvedOptionsPtr>::const_iterator entry = cache_.find(key);
+    if (entry != cache_.end()) {
+        return (entry->second);
+    }
+
+    if (cache_.size() >= max_size_) {
+        cache_.clear();
+    }
+
+    ConstResolvedOptionsPtr resolved(new ResolvedOptions(option_space, co_list));
+    cache_.insert(std::make_pair(key, resolved));
+    return (resolved);
+}
+
+void
+CfgOptionListCache::clear() {
+    cache_.clear();
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
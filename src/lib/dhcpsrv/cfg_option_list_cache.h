@@ -0,0 +1,145 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CFG_OPTION_LIST_CACHE_H
+#define CFG_OPTION_LIST_CACHE_H
+
+#include <dhcp/option.h>
+#include <dhcpsrv/cfg_option.h>
+#include <boost/shared_ptr.hpp>
+#include <map>
+#include <stdint.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Options resolved from a list of option configurations.
+///
+/// The server gathers the option configurations applicable to the
+/// client (host, pool, subnet, shared network, classes and global)
+/// into a @c CfgOptionList ordered by precedence. When the response
+/// is built, each requested option is looked up in the configurations
+/// in this order. This class holds the outcome of this lookup for
+/// all option codes of a given option space, so it can be done once
+/// and reused for the clients using the same list of configurations.
+class ResolvedOptions {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Resolves the options from the list of option configurations.
+    /// For each option code the option is taken from the first
+    /// configuration in the list which holds a non-null option
+    /// instance for this code, i.e. the same way as the
+    /// @c CfgOption::get is used by the server.
+    ///
+    /// @param option_space Name of the option space.
+    /// @param co_list List of option configurations ordered by precedence.
+    ResolvedOptions(const std::string& option_space,
+                    const CfgOptionList& co_list);
+
+    /// @brief Returns the option for a given option code.
+    ///
+    /// @param code Option code.
+    ///
+    /// @return Pointer to the option or NULL if the option hasn't been
+    /// configured.
+    OptionPtr get(const uint16_t code) const;
+
+    /// @brief Returns codes of the options which are always sent.
+    ///
+    /// @return Codes of the options configured with the
+    /// "always-send" flag in the order of the configurations' precedence.
+    const std::vector<uint16_t>& getPersistentCodes() const {
+        return (persistent_codes_);
+    }
+
+private:
+
+    /// @brief Options indexed by codes.
+    std::map<uint16_t, OptionPtr> options_;
+
+    /// @brief Codes of the persistent options.
+    std::vector<uint16_t> persistent_codes_;
+};
+
+/// @brief Pointer to the @c ResolvedOptions object.
+typedef boost::shared_ptr<const ResolvedOptions> ConstResolvedOptionsPtr;
+
+/// @brief Cache of options resolved from lists of option configurations.
+///
+/// Most clients of a given subnet, pool and set of classes use the same
+/// list of option configurations. This cache holds the resolved options
+/// for such lists, so the server can look up the options for the response
+/// directly.
+///
+/// The cache is keyed by the pointers to the option configurations in
+/// the list. It is held by the server configuration and the options
+/// found in it are not meant to be modified after the configuration is
+/// committed. The cache must be cleared when the configuration is
+/// modified in place. Lists including host specific options should not
+/// be cached, because the hosts fetched from the databases are new
+/// objects for each query.
+class CfgOptionListCache {
+public:
+
+    /// @brief Default maximum number of cached entries.
+    static const size_t DEFAULT_MAX_SIZE = 65536;
+
+    /// @brief Constructor.
+    ///
+    /// @param max_size Maximum number of cached entries. The cache is
+    /// cleared when this number is exceeded.
+    explicit CfgOptionListCache(const size_t max_size = DEFAULT_MAX_SIZE);
+
+    /// @brief Returns resolved options for the list of option configurations.
+    ///
+    /// The options are resolved and cached when this list is seen for the
+    /// first time.
+    ///
+    /// @param option_space Name of the option space.
+    /// @param co_list List of option configurations ordered by precedence.
+    ///
+    /// @return Pointer to the resolved options.
+    ConstResolvedOptionsPtr get(const std::string& option_space,
+                                const CfgOptionList& co_list);
+
+    /// @brief Removes all cached entries.
+    void clear();
+
+    /// @brief Returns the number of cached entries.
+    size_t size() const {
+        return (cache_.size());
+    }
+
+private:
+
+    /// @brief Key identifying the option space and list of configurations.
+    typedef std::pair<std::string, std::vector<ConstCfgOptionPtr> > Key;
+
+    /// @brief Maximum number of cached entries.
+    size_t max_size_;
+
+    /// @brief Cached entries.
+    std::map<Key, ConstResolvedOptionsPtr> cache_;
+};
+
+/// @name Pointers to the @c CfgOptionListCache objects.
+//@{
+/// @brief Pointer to the Non-const object.
+typedef boost::shared_ptr<CfgOptionListCache> CfgOptionListCachePtr;
+
+/// @brief Pointer to the const object.
+typedef boost::shared_ptr<const CfgOptionListCache> ConstCfgOptionListCachePtr;
+//@}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // CFG_OPTION_LIST_CACHE_H
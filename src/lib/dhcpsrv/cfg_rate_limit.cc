@@ -0,0 +1,101 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cfg_rate_limit.h>
+#include <exceptions/exceptions.h>
+#include <limits>
+
+using namespace isc::data;
+
+namespace isc {
+namespace dhcp {
+
+const uint32_t CfgRateLimit::DEFAULT_MAX_CLIENTS = 65536;
+
+CfgRateLimit::CfgRateLimit()
+    : client_rate_(0), client_burst_(0), relay_rate_(0), relay_burst_(0),
+      max_clients_(DEFAULT_MAX_CLIENTS), drop_duplicates_(false) {
+}
+
+void
+CfgRateLimit::setClientRate(const int64_t client_rate) {
+    rangeCheck(client_rate, "client-rate");
+    client_rate_ = client_rate;
+}
+
+void
+CfgRateLimit::setClientBurst(const int64_t client_burst) {
+    rangeCheck(client_burst, "client-burst");
+    client_burst_ = client_burst;
+}
+
+void
+CfgRateLimit::setRelayRate(const int64_t relay_rate) {
+    rangeCheck(relay_rate, "relay-rate");
+    relay_rate_ = relay_rate;
+}
+
+void
+CfgRateLimit::setRelayBurst(const int64_t relay_burst) {
+    rangeCheck(relay_burst, "relay-burst");
+    relay_burst_ = relay_burst;
+}
+
+void
+CfgRateLimit::setMaxClients(const int64_t max_clients) {
+    rangeCheck(max_clients, "max-clients");
+    if (max_clients == 0) {
+        isc_throw(OutOfRange, "value for configuration parameter"
+                  " 'max-clients' must be greater than 0");
+    }
+    max_clients_ = max_clients;
+}
+
+bool
+CfgRateLimit::equals(const CfgRateLimit& other) const {
+    return (client_rate_ == other.client_rate_ &&
+            client_burst_ == other.client_burst_ &&
+            relay_rate_ == other.relay_rate_ &&
+            relay_burst_ == other.relay_burst_ &&
+            max_clients_ == other.max_clients_ &&
+            drop_duplicates_ == other.drop_duplicates_);
+}
+
+void
+CfgRateLimit::rangeCheck(const int64_t value,
+                         const std::string& config_parameter_name) const {
+    if (value < 0) {
+        isc_throw(OutOfRange, "value for configuration parameter '"
+                  << config_parameter_name << "' must not be negative");
+
+    } else if (value > std::numeric_limits<uint32_t>::max()) {
+        isc_throw(OutOfRange, "out range value '" << value << "' for configuration"
+                  " parameter '" << config_parameter_name << "', expected maximum"
+                  " value of '" << std::numeric_limits<uint32_t>::max() << "'");
+    }
+}
+
+ElementPtr
+CfgRateLimit::toElement() const {
+    ElementPtr result = Element::createMap();
+    result->set("client-rate",
+                Element::create(static_cast<long long>(client_rate_)));
+    result->set("client-burst",
+                Element::create(static_cast<long long>(client_burst_)));
+    result->set("relay-rate",
+                Element::create(static_cast<long long>(relay_rate_)));
+    result->set("relay-burst",
+                Element::create(static_cast<long long>(relay_burst_)));
+    result->set("max-clients",
+                Element::create(static_cast<long long>(max_clients_)));
+    result->set("drop-duplicates", Element::create(drop_duplicates_));
+    return (result);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,200 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CFG_RATE_LIMIT_H
+#define CFG_RATE_LIMIT_H
+
+#include <cc/cfg_to_element.h>
+#include <boost/shared_ptr.hpp>
+#include <stdint.h>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Holds configuration parameters of the early drop of the
+/// received packets.
+///
+/// This class holds the values of the following configuration parameters
+/// of the "client-rate-limit" map:
+///
+/// - client-rate - is the maximum number of packets per second accepted
+///   from a single client, identified by its client identifier or, in its
+///   absence, by its hardware address. If this value is 0, the packets are
+///   not limited per client.
+///
+/// - client-burst - is the number of packets a client can send at once
+///   before it is limited to the client-rate. If this value is 0, the
+///   burst is equal to the client-rate.
+///
+/// - relay-rate - is the maximum number of packets per second accepted
+///   through a single relay agent, identified by the giaddr. If this value
+///   is 0, the packets are not limited per relay.
+///
+/// - relay-burst - is the number of packets which can be received through
+///   a relay at once before it is limited to the relay-rate. If this value
+///   is 0, the burst is equal to the relay-rate.
+///
+/// - max-clients - is the maximum number of clients and relays tracked at
+///   the same time. The packets of the clients which don't fit in the table
+///   are accepted.
+///
+/// - drop-duplicates - indicates if the retransmissions of a packet, i.e.
+///   the packets from the same client with the same transaction id, should
+///   be dropped while the first packet is still being processed.
+class CfgRateLimit : public isc::data::CfgToElement {
+public:
+
+    /// @brief Default value of max-clients.
+    static const uint32_t DEFAULT_MAX_CLIENTS;
+
+    /// @brief Constructor.
+    ///
+    /// Sets all parameters to their defaults, i.e. nothing is dropped.
+    CfgRateLimit();
+
+    /// @brief Checks if any packet can be dropped.
+    ///
+    /// @return true if any of the limits or the duplicates suppression
+    /// is enabled.
+    bool isEnabled() const {
+        return ((client_rate_ > 0) || (relay_rate_ > 0) || drop_duplicates_);
+    }
+
+    /// @brief Returns client-rate.
+    uint32_t getClientRate() const {
+        return (client_rate_);
+    }
+
+    /// @brief Sets client-rate.
+    ///
+    /// @param client_rate New value.
+    void setClientRate(const int64_t client_rate);
+
+    /// @brief Returns client-burst.
+    uint32_t getClientBurst() const {
+        return (client_burst_);
+    }
+
+    /// @brief Sets client-burst.
+    ///
+    /// @param client_burst New value.
+    void setClientBurst(const int64_t client_burst);
+
+    /// @brief Returns relay-rate.
+    uint32_t getRelayRate() const {
+        return (relay_rate_);
+    }
+
+    /// @brief Sets relay-rate.
+    ///
+    /// @param relay_rate New value.
+    void setRelayRate(const int64_t relay_rate);
+
+    /// @brief Returns relay-burst.
+    uint32_t getRelayBurst() const {
+        return (relay_burst_);
+    }
+
+    /// @brief Sets relay-burst.
+    ///
+    /// @param relay_burst New value.
+    void setRelayBurst(const int64_t relay_burst);
+
+    /// @brief Returns max-clients.
+    uint32_t getMaxClients() const {
+        return (max_clients_);
+    }
+
+    /// @brief Sets max-clients.
+    ///
+    /// @param max_clients New value.
+    void setMaxClients(const int64_t max_clients);
+
+    /// @brief Returns drop-duplicates.
+    bool getDropDuplicates() const {
+        return (drop_duplicates_);
+    }
+
+    /// @brief Sets drop-duplicates.
+    ///
+    /// @param drop_duplicates New value.
+    void setDropDuplicates(const bool drop_duplicates) {
+        drop_duplicates_ = drop_duplicates;
+    }
+
+    /// @brief Compares two @c CfgRateLimit objects for equality.
+    ///
+    /// @param other An object to be compared with this object.
+    ///
+    /// @return true if objects are equal, false otherwise.
+    bool equals(const CfgRateLimit& other) const;
+
+    /// @brief Equality operator.
+    ///
+    /// @param other Object to be compared with this object.
+    ///
+    /// @return true if objects are equal, false otherwise.
+    bool operator==(const CfgRateLimit& other) const {
+        return (equals(other));
+    }
+
+    /// @brief Inequality operator.
+    ///
+    /// @param other Object to be compared with this object.
+    ///
+    /// @return true if objects are not equal, false otherwise.
+    bool operator!=(const CfgRateLimit& other) const {
+        return (!equals(other));
+    }
+
+    /// @brief Unparse a configuration object
+    ///
+    /// @return a pointer to unparsed configuration
+    virtual isc::data::ElementPtr toElement() const;
+
+private:
+
+    /// @brief Checks if the value is a valid rate, burst or table size.
+    ///
+    /// @param value Value to be checked.
+    /// @param config_parameter_name A name of the configuration parameter
+    /// (used for logging purposes if value is out of range).
+    ///
+    /// @throw isc::OutOfRange if the value is negative or greater than
+    /// the maximum value of uint32_t.
+    void rangeCheck(const int64_t value,
+                    const std::string& config_parameter_name) const;
+
+    /// @brief client-rate
+    uint32_t client_rate_;
+
+    /// @brief client-burst
+    uint32_t client_burst_;
+
+    /// @brief relay-rate
+    uint32_t relay_rate_;
+
+    /// @brief relay-burst
+    uint32_t relay_burst_;
+
+    /// @brief max-clients
+    uint32_t max_clients_;
+
+    /// @brief drop-duplicates
+    bool drop_duplicates_;
+};
+
+/// @brief Pointer to the Non-const object.
+typedef boost::shared_ptr<CfgRateLimit> CfgRateLimitPtr;
+
+/// @brief Pointer to the const object.
+typedef boost::shared_ptr<const CfgRateLimit> ConstCfgRateLimitPtr;
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // CFG_RATE_LIMIT_H
@@ -55,6 +55,32 @@ CfgSubnets4::del(const ConstSubnet4Ptr& subnet) {
         .arg(subnet->toText());
 }
 
+Subnet4Ptr
+CfgSubnets4::replace(const Subnet4Ptr& subnet) {
+    auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto subnet_it = index.find(subnet->getID());
+    if (subnet_it == index.end()) {
+        isc_throw(BadValue, "no subnet with ID of '" << subnet->getID()
+                  << "' found");
+    }
+
+    ConstSubnet4Ptr other = getByPrefix(subnet->toText());
+    if (other && (other->getID() != subnet->getID())) {
+        isc_throw(isc::dhcp::DuplicateSubnetID, "subnet with the prefix of '"
+                  << subnet->toText() << "' already exists");
+    }
+
+    Subnet4Ptr old_subnet = *subnet_it;
+    if (!index.replace(subnet_it, subnet)) {
+        isc_throw(Unexpected, "failed to replace the subnet with ID of '"
+                  << subnet->getID() << "'");
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_REPLACE_SUBNET4)
+        .arg(subnet->toText());
+    return (old_subnet);
+}
+
 ConstSubnet4Ptr
 CfgSubnets4::getBySubnetId(const SubnetID& subnet_id) const {
     const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
@@ -309,15 +335,19 @@ CfgSubnets4::selectSubnet(const std::string& iface,
 
 Subnet4Ptr
 CfgSubnets4::getSubnet(const SubnetID id) const {
+    const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto subnet_it = index.find(id);
+    return ((subnet_it != index.cend()) ? (*subnet_it) : Subnet4Ptr());
+}
 
-    /// @todo: Once this code is migrated to multi-index container, use
-    /// an index rather than full scan.
-    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
-        if ((*subnet)->getID() == id) {
-            return (*subnet);
+void
+CfgSubnets4::resetPoolExhausted(const IOAddress& address) const {
+    for (Subnet4Collection::const_iterator subnet = subnets_.begin();
+         subnet != subnets_.end(); ++subnet) {
+        if ((*subnet)->inRange(address)) {
+            (*subnet)->resetPoolExhausted(Lease::TYPE_V4, address);
         }
     }
-    return (Subnet4Ptr());
 }
 
 Subnet4Ptr
@@ -349,24 +379,60 @@ CfgSubnets4::removeStatistics() {
     using namespace isc::stats;
 
     // For each v4 subnet currently configured, remove the statistic.
-    StatsMgr& stats_mgr = StatsMgr::instance();
     for (Subnet4Collection::const_iterator subnet4 = subnets_.begin();
          subnet4 != subnets_.end(); ++subnet4) {
-        SubnetID subnet_id = (*subnet4)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "total-addresses"));
+        removeStatistics((*subnet4)->getID());
+    }
+}
+
+void
+CfgSubnets4::removeStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // The declined leases of the subnet are no longer counted in the
+    // global statistic.
+    ObservationPtr declined =
+        stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                        "declined-addresses"));
+    if (declined) {
+        stats_mgr.addValue("declined-addresses",
+                           -declined->getInteger().first);
+    }
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "total-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "v4-allocation-fail"));
+}
+
+void
+CfgSubnets4::updateStatistics(const ConstSubnet4Ptr& subnet,
+                              const bool recount) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    StatsMgr::instance().setValue(StatsMgr::generateName("subnet",
+                                                         subnet->getID(),
+                                                         "total-addresses"),
+                                  static_cast<int64_t>
+                                  (subnet->getPoolCapacity(Lease::TYPE_V4)));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+    if (recount && LeaseMgrFactory::haveInstance()) {
+        LeaseMgrFactory::instance().recountLeaseStats4(subnet->getID());
     }
 }
 
@@ -392,6 +458,26 @@ CfgSubnets4::updateStatistics() {
     }
 }
 
+void
+CfgSubnets4::updateStatistics(const CfgSubnets4& previous) {
+    // The lease statistics depend only on the subnet identifiers, so the
+    // leases are only counted for the subnets which are new.
+    const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto subnet = previous.subnets_.begin();
+         subnet != previous.subnets_.end(); ++subnet) {
+        if (index.find((*subnet)->getID()) == index.end()) {
+            removeStatistics((*subnet)->getID());
+        }
+    }
+
+    const auto& previous_index = previous.subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
+        const bool recount =
+            (previous_index.find((*subnet)->getID()) == previous_index.end());
+        updateStatistics(*subnet, recount);
+    }
+}
+
 ElementPtr
 CfgSubnets4::toElement() const {
     ElementPtr result = Element::createList();
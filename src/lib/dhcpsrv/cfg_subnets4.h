@@ -47,6 +47,21 @@ public:
     /// @throw isc::BadValue if such subnet doesn't exist.
     void del(const ConstSubnet4Ptr& subnet);
 
+    /// @brief Replaces subnet in the configuration.
+    ///
+    /// The subnet having the same identifier as the specified subnet is
+    /// replaced in place, i.e. the new subnet takes the position of the
+    /// replaced subnet in the configuration.
+    ///
+    /// @param subnet Pointer to the new subnet.
+    /// @return Pointer to the replaced subnet.
+    ///
+    /// @throw isc::BadValue if the subnet having the identifier of the new
+    /// subnet doesn't exist.
+    /// @throw isc::DuplicateSubnetID if other subnet has the same prefix
+    /// as the new subnet.
+    Subnet4Ptr replace(const Subnet4Ptr& subnet);
+
     /// @brief Returns pointer to the collection of all IPv4 subnets.
     ///
     /// This is used in a hook (subnet4_select), where the hook is able
@@ -159,12 +174,17 @@ public:
 
     /// @brief Returns subnet with specified subnet-id value
     ///
-    /// Warning: this method uses full scan. Its use is not recommended for
-    /// packet processing.
-    ///
     /// @return Subnet (or NULL)
     Subnet4Ptr getSubnet(const SubnetID id) const;
 
+    /// @brief Clears the exhausted flag of the pool an address belongs to.
+    ///
+    /// This is called when a lease is deleted from the lease database
+    /// and its subnet is not known.
+    ///
+    /// @param address Address of the deleted lease.
+    void resetPoolExhausted(const asiolink::IOAddress& address) const;
+
     /// @brief Returns a pointer to a subnet if provided address is in its range.
     ///
     /// This method returns a pointer to the subnet if the address passed in
@@ -244,6 +264,19 @@ public:
     /// not expected to change until the next reconfiguration event.
     void updateStatistics();
 
+    /// @brief Updates statistics after the previous configuration.
+    ///
+    /// This method is used instead of @c removeStatistics and
+    /// @c updateStatistics when the new configuration uses the same lease
+    /// database as the previous one. The statistics of the subnets which
+    /// are no longer configured are removed and the leases are only
+    /// recounted for the subnets which weren't configured before. The
+    /// remaining subnets keep their lease statistics because these depend
+    /// only on the subnet identifiers.
+    ///
+    /// @param previous Subnets of the previous configuration.
+    void updateStatistics(const CfgSubnets4& previous);
+
     /// @brief Removes statistics.
     ///
     /// During commitment of a new configuration, we need to get rid of the old
@@ -252,6 +285,29 @@ public:
     /// configuration and also subnet-ids may change.
     void removeStatistics();
 
+    /// @brief Updates statistics of a single subnet.
+    ///
+    /// This method is used when the subnet is added to or replaced in the
+    /// current configuration without committing a new configuration. It
+    /// sets the statistics dependent on the subnet configuration and
+    /// optionally recounts the leases belonging to the subnet.
+    ///
+    /// @param subnet Pointer to the subnet.
+    /// @param recount Boolean flag indicating if the leases belonging to
+    /// the subnet should be recounted.
+    static void updateStatistics(const ConstSubnet4Ptr& subnet,
+                                 const bool recount);
+
+    /// @brief Removes statistics of a single subnet.
+    ///
+    /// This method is used when the subnet is removed from the current
+    /// configuration without committing a new configuration. The declined
+    /// leases of the subnet are subtracted from the global
+    /// declined-addresses statistic.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    static void removeStatistics(const SubnetID& subnet_id);
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -55,6 +55,32 @@ CfgSubnets6::del(const ConstSubnet6Ptr& subnet) {
         .arg(subnet->toText());
 }
 
+Subnet6Ptr
+CfgSubnets6::replace(const Subnet6Ptr& subnet) {
+    auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto subnet_it = index.find(subnet->getID());
+    if (subnet_it == index.end()) {
+        isc_throw(BadValue, "no subnet with ID of '" << subnet->getID()
+                  << "' found");
+    }
+
+    ConstSubnet6Ptr other = getByPrefix(subnet->toText());
+    if (other && (other->getID() != subnet->getID())) {
+        isc_throw(isc::dhcp::DuplicateSubnetID, "subnet with the prefix of '"
+                  << subnet->toText() << "' already exists");
+    }
+
+    Subnet6Ptr old_subnet = *subnet_it;
+    if (!index.replace(subnet_it, subnet)) {
+        isc_throw(Unexpected, "failed to replace the subnet with ID of '"
+                  << subnet->getID() << "'");
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_REPLACE_SUBNET6)
+        .arg(subnet->toText());
+    return (old_subnet);
+}
+
 ConstSubnet6Ptr
 CfgSubnets6::getBySubnetId(const SubnetID& subnet_id) const {
     const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
@@ -231,44 +257,76 @@ CfgSubnets6::selectSubnet(const OptionPtr& interface_id,
 
 Subnet6Ptr
 CfgSubnets6::getSubnet(const SubnetID id) const {
-
-    /// @todo: Once this code is migrated to multi-index container, use
-    /// an index rather than full scan.
-    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
-        if ((*subnet)->getID() == id) {
-            return (*subnet);
-        }
-    }
-    return (Subnet6Ptr());
+    const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    auto subnet_it = index.find(id);
+    return ((subnet_it != index.cend()) ? (*subnet_it) : Subnet6Ptr());
 }
 
 void
 CfgSubnets6::removeStatistics() {
     using namespace isc::stats;
 
-    StatsMgr& stats_mgr = StatsMgr::instance();
     // For each v6 subnet currently configured, remove the statistics.
     for (Subnet6Collection::const_iterator subnet6 = subnets_.begin();
          subnet6 != subnets_.end(); ++subnet6) {
-        SubnetID subnet_id = (*subnet6)->getID();
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
+        removeStatistics((*subnet6)->getID());
+    }
+}
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-nas"));
+void
+CfgSubnets6::removeStatistics(const SubnetID& subnet_id) {
+    using namespace isc::stats;
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // The declined leases of the subnet are no longer counted in the
+    // global statistic.
+    ObservationPtr declined =
+        stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                        "declined-addresses"));
+    if (declined) {
+        stats_mgr.addValue("declined-addresses",
+                           -declined->getInteger().first);
+    }
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "assigned-pds"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-nas"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "declined-reclaimed-addresses"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id, "total-pds"));
 
-        stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
-                                             "reclaimed-leases"));
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "assigned-pds"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "declined-reclaimed-addresses"));
+
+    stats_mgr.del(StatsMgr::generateName("subnet", subnet_id,
+                                         "reclaimed-leases"));
+}
+
+void
+CfgSubnets6::updateStatistics(const ConstSubnet6Ptr& subnet,
+                              const bool recount) {
+    using namespace isc::stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet->getID(),
+                                              "total-nas"),
+                       static_cast<int64_t>
+                       (subnet->getPoolCapacity(Lease::TYPE_NA)));
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet->getID(),
+                                              "total-pds"),
+                       static_cast<int64_t>
+                       (subnet->getPoolCapacity(Lease::TYPE_PD)));
+
+    if (recount && LeaseMgrFactory::haveInstance()) {
+        LeaseMgrFactory::instance().recountLeaseStats6(subnet->getID());
     }
 }
 
@@ -299,6 +357,26 @@ CfgSubnets6::updateStatistics() {
     }
 }
 
+void
+CfgSubnets6::updateStatistics(const CfgSubnets6& previous) {
+    // The lease statistics depend only on the subnet identifiers, so the
+    // leases are only counted for the subnets which are new.
+    const auto& index = subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto subnet = previous.subnets_.begin();
+         subnet != previous.subnets_.end(); ++subnet) {
+        if (index.find((*subnet)->getID()) == index.end()) {
+            removeStatistics((*subnet)->getID());
+        }
+    }
+
+    const auto& previous_index = previous.subnets_.get<SubnetSubnetIdIndexTag>();
+    for (auto subnet = subnets_.begin(); subnet != subnets_.end(); ++subnet) {
+        const bool recount =
+            (previous_index.find((*subnet)->getID()) == previous_index.end());
+        updateStatistics(*subnet, recount);
+    }
+}
+
 ElementPtr
 CfgSubnets6::toElement() const {
     ElementPtr result = Element::createList();
@@ -89,10 +89,20 @@ CfgMgr::commit() {
 
     ensureCurrentAllocated();
 
+    // Recounting the leases is expensive for large lease databases. If the
+    // lease manager has been reused by the new configuration, the lease
+    // statistics of the subnets present in both configurations remain
+    // valid, so only the removed and added subnets are accounted for.
+    const SrvConfigPtr previous = configuration_;
+    const bool incremental = !configs_.back()->sequenceEquals(*configuration_) &&
+        configs_.back()->getCfgDbAccess()->isLeaseMgrReused();
+
     // First we need to remove statistics. The new configuration can have fewer
     // subnets. Also, it may change subnet-ids. So we need to remove them all
     // and add it back.
-    configuration_->removeStatistics();
+    if (!incremental) {
+        configuration_->removeStatistics();
+    }
 
     if (!configs_.back()->sequenceEquals(*configuration_)) {
         configuration_ = configs_.back();
@@ -106,7 +116,13 @@ CfgMgr::commit() {
     }
 
     // Now we need to set the statistics back.
-    configuration_->updateStatistics();
+    if (incremental) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE,
+                  DHCPSRV_CFGMGR_STATS_UPDATED);
+        configuration_->updateStatistics(*previous);
+    } else {
+        configuration_->updateStatistics();
+    }
 }
 
 void
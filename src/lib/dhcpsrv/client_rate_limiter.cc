@@ -0,0 +1,243 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcp/dhcp4.h>
+#include <dhcpsrv/client_rate_limiter.h>
+#include <algorithm>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+ClientRateLimiter::ClientRateLimiter()
+    : cfg_(), client_burst_(0), relay_burst_(0), clients_(), relays_(),
+      last_purge_() {
+}
+
+void
+ClientRateLimiter::configure(const ConstCfgRateLimitPtr& cfg) {
+    // The server passes the configuration on each reconfiguration, so
+    // the tracked clients are kept unless the limits have changed.
+    const bool unchanged = (cfg && cfg_ ? (*cfg == *cfg_) : (cfg == cfg_));
+    cfg_ = cfg;
+    if (unchanged) {
+        return;
+    }
+    clients_.clear();
+    relays_.clear();
+    if (cfg_) {
+        client_burst_ = (cfg_->getClientBurst() > 0 ?
+                         cfg_->getClientBurst() : cfg_->getClientRate());
+        relay_burst_ = (cfg_->getRelayBurst() > 0 ?
+                        cfg_->getRelayBurst() : cfg_->getRelayRate());
+    }
+}
+
+ClientRateLimiter::Result
+ClientRateLimiter::accept(const Pkt4Ptr& query, const Time& now) {
+    if (!cfg_ || !cfg_->isEnabled()) {
+        return (ACCEPT);
+    }
+
+    const std::vector<uint8_t> key = getClientKey(query);
+    Client* client = 0;
+    if (!key.empty()) {
+        ClientMap::iterator it = clients_.find(key);
+        if (it != clients_.end()) {
+            client = &it->second;
+        }
+    }
+
+    // Drop the retransmissions of a parked packet. These don't take
+    // tokens, so the client can send a new request as soon as the parked
+    // packet has been processed.
+    if (client && client->parked_) {
+        if (now >= client->parked_until_) {
+            client->parked_ = false;
+
+        } else if (cfg_->getDropDuplicates() &&
+                   (client->xid_ == query->getTransid())) {
+            return (DROP_DUPLICATE);
+        }
+    }
+
+    // Check the client first, so a client exceeding its own rate doesn't
+    // consume the rate of the relay.
+    if ((cfg_->getClientRate() > 0) && !key.empty()) {
+        if (!client) {
+            client = getClient(key, now);
+        }
+        if (client && !take(client->bucket_, cfg_->getClientRate(),
+                            client_burst_, now)) {
+            return (DROP_CLIENT_RATE);
+        }
+    }
+
+    const IOAddress& giaddr = query->getGiaddr();
+    if ((cfg_->getRelayRate() > 0) && !giaddr.isV4Zero()) {
+        const uint32_t relay_key = giaddr.toUint32();
+        RelayMap::iterator it = relays_.find(relay_key);
+        if ((it == relays_.end()) && makeRoom(now)) {
+            it = relays_.insert(std::make_pair(relay_key,
+                                               createBucket(relay_burst_,
+                                                            now))).first;
+        }
+        if ((it != relays_.end()) &&
+            !take(it->second, cfg_->getRelayRate(), relay_burst_, now)) {
+            return (DROP_RELAY_RATE);
+        }
+    }
+
+    return (ACCEPT);
+}
+
+void
+ClientRateLimiter::park(const Pkt4Ptr& query,
+                        const std::chrono::milliseconds& timeout,
+                        const Time& now) {
+    if (!cfg_ || !cfg_->getDropDuplicates()) {
+        return;
+    }
+    const std::vector<uint8_t> key = getClientKey(query);
+    if (key.empty()) {
+        return;
+    }
+    Client* client = getClient(key, now);
+    if (client) {
+        client->parked_ = true;
+        client->xid_ = query->getTransid();
+        if (timeout.count() > 0) {
+            client->parked_until_ = now + timeout;
+        } else {
+            client->parked_until_ = Time::max();
+        }
+    }
+}
+
+void
+ClientRateLimiter::unpark(const Pkt4Ptr& query) {
+    if (!cfg_ || clients_.empty()) {
+        return;
+    }
+    ClientMap::iterator it = clients_.find(getClientKey(query));
+    if ((it != clients_.end()) && (it->second.xid_ == query->getTransid())) {
+        it->second.parked_ = false;
+    }
+}
+
+std::vector<uint8_t>
+ClientRateLimiter::getClientKey(const Pkt4Ptr& query) {
+    std::vector<uint8_t> key;
+    OptionPtr client_id = query->getOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    if (client_id && !client_id->getData().empty()) {
+        const OptionBuffer& data = client_id->getData();
+        key.reserve(data.size() + 1);
+        key.push_back(0);
+        key.insert(key.end(), data.begin(), data.end());
+        return (key);
+    }
+
+    HWAddrPtr hwaddr = query->getHWAddr();
+    if (hwaddr && !hwaddr->hwaddr_.empty()) {
+        key.reserve(hwaddr->hwaddr_.size() + 2);
+        key.push_back(1);
+        key.push_back(static_cast<uint8_t>(hwaddr->htype_));
+        key.insert(key.end(), hwaddr->hwaddr_.begin(), hwaddr->hwaddr_.end());
+    }
+    return (key);
+}
+
+ClientRateLimiter::Bucket
+ClientRateLimiter::createBucket(const uint32_t burst, const Time& now) {
+    Bucket bucket;
+    bucket.tokens_ = burst;
+    bucket.last_ = now;
+    return (bucket);
+}
+
+void
+ClientRateLimiter::refill(Bucket& bucket, const uint32_t rate,
+                          const uint32_t burst, const Time& now) {
+    if (now > bucket.last_) {
+        const double elapsed =
+            std::chrono::duration<double>(now - bucket.last_).count();
+        bucket.tokens_ = std::min(static_cast<double>(burst),
+                                  bucket.tokens_ + elapsed * rate);
+        bucket.last_ = now;
+    }
+}
+
+bool
+ClientRateLimiter::take(Bucket& bucket, const uint32_t rate,
+                        const uint32_t burst, const Time& now) {
+    refill(bucket, rate, burst, now);
+    if (bucket.tokens_ < 1) {
+        return (false);
+    }
+    bucket.tokens_ -= 1;
+    return (true);
+}
+
+bool
+ClientRateLimiter::makeRoom(const Time& now) {
+    const size_t max_clients = cfg_->getMaxClients();
+    if (clients_.size() + relays_.size() < max_clients) {
+        return (true);
+    }
+
+    // Purging is linear in the size of the tables, so it is not repeated
+    // for every packet when the tables are full of active clients.
+    if (now - last_purge_ < std::chrono::seconds(1)) {
+        return (false);
+    }
+    last_purge_ = now;
+
+    for (ClientMap::iterator it = clients_.begin(); it != clients_.end(); ) {
+        Client& client = it->second;
+        refill(client.bucket_, cfg_->getClientRate(), client_burst_, now);
+        if (client.parked_ && (now < client.parked_until_)) {
+            ++it;
+        } else if (client.bucket_.tokens_ < client_burst_) {
+            ++it;
+        } else {
+            it = clients_.erase(it);
+        }
+    }
+    for (RelayMap::iterator it = relays_.begin(); it != relays_.end(); ) {
+        refill(it->second, cfg_->getRelayRate(), relay_burst_, now);
+        if (it->second.tokens_ < relay_burst_) {
+            ++it;
+        } else {
+            it = relays_.erase(it);
+        }
+    }
+
+    return (clients_.size() + relays_.size() < max_clients);
+}
+
+ClientRateLimiter::Client*
+ClientRateLimiter::getClient(const std::vector<uint8_t>& key,
+                             const Time& now) {
+    ClientMap::iterator it = clients_.find(key);
+    if (it != clients_.end()) {
+        return (&it->second);
+    }
+    if (!makeRoom(now)) {
+        return (0);
+    }
+    Client client;
+    client.bucket_ = createBucket(client_burst_, now);
+    client.parked_ = false;
+    client.xid_ = 0;
+    client.parked_until_ = now;
+    return (&clients_.insert(std::make_pair(key, client)).first->second);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,213 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CLIENT_RATE_LIMITER_H
+#define CLIENT_RATE_LIMITER_H
+
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/cfg_rate_limit.h>
+#include <boost/functional/hash.hpp>
+#include <boost/noncopyable.hpp>
+#include <chrono>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Early drop of the packets received from misbehaving clients.
+///
+/// The server checks each received packet with @c accept before it is
+/// classified and processed. The packet is dropped when:
+/// - another packet from the same client with the same transaction id
+///   is parked, i.e. its processing is waiting for a hooks library,
+/// - the client has exceeded its rate,
+/// - the relay agent forwarding the packet has exceeded its rate.
+///
+/// The rates are enforced with token buckets: each client and each relay
+/// has a bucket holding up to the burst number of tokens, refilled at the
+/// configured rate. An accepted packet takes a token from the buckets.
+///
+/// The clients are identified by the client identifier or, in its
+/// absence, by the hardware address and the relays by the giaddr. The
+/// number of tracked clients and relays is bounded by max-clients. When
+/// the tables are full, the entries which would not limit the next
+/// packet, i.e. with full buckets and no parked packet, are removed. The
+/// packets from the clients which still don't fit are accepted.
+///
+/// @note This class is not thread safe.
+class ClientRateLimiter : public boost::noncopyable {
+public:
+
+    /// @brief Type of the time points.
+    typedef std::chrono::steady_clock::time_point Time;
+
+    /// @brief Result of the check of a received packet.
+    enum Result {
+        ACCEPT,           ///< The packet should be processed.
+        DROP_DUPLICATE,   ///< The packet is a retransmission of a parked one.
+        DROP_CLIENT_RATE, ///< The client has exceeded its rate.
+        DROP_RELAY_RATE   ///< The relay has exceeded its rate.
+    };
+
+    /// @brief Constructor.
+    ///
+    /// Nothing is dropped until the limiter is configured.
+    ClientRateLimiter();
+
+    /// @brief Sets the configuration.
+    ///
+    /// When the limits are changed, all tracked clients and relays are
+    /// forgotten. A configuration holding the same values as the current
+    /// one retains them.
+    ///
+    /// @param cfg Pointer to the configuration.
+    void configure(const ConstCfgRateLimitPtr& cfg);
+
+    /// @brief Checks if a received packet should be processed.
+    ///
+    /// @param query Received and parsed packet.
+    /// @param now Current time.
+    ///
+    /// @return @c ACCEPT if the packet should be processed, the reason of
+    /// the drop otherwise.
+    Result accept(const Pkt4Ptr& query, const Time& now = Time::clock::now());
+
+    /// @brief Records that the processing of a packet has been parked.
+    ///
+    /// The retransmissions of the packet will be dropped until it is
+    /// unparked, or at most for the given time. The caller passes the
+    /// timeout of the parking lot holding the packet, so the packets
+    /// dropped by the parking lot stop suppressing their retransmissions
+    /// at the same time.
+    ///
+    /// @param query Parked packet.
+    /// @param timeout Maximum time the packet remains parked. A value of
+    /// 0 means that the packet remains parked until it is unparked.
+    /// @param now Current time.
+    void park(const Pkt4Ptr& query, const std::chrono::milliseconds& timeout,
+              const Time& now = Time::clock::now());
+
+    /// @brief Records that the processing of a packet has resumed.
+    ///
+    /// @param query Unparked packet.
+    void unpark(const Pkt4Ptr& query);
+
+    /// @brief Returns the number of tracked clients.
+    size_t getClientCount() const {
+        return (clients_.size());
+    }
+
+    /// @brief Returns the number of tracked relays.
+    size_t getRelayCount() const {
+        return (relays_.size());
+    }
+
+private:
+
+    /// @brief Token bucket.
+    struct Bucket {
+        /// @brief Number of available tokens.
+        double tokens_;
+
+        /// @brief Time when the bucket was last refilled.
+        Time last_;
+    };
+
+    /// @brief State of a client.
+    struct Client {
+        /// @brief Rate limit of the client.
+        Bucket bucket_;
+
+        /// @brief Indicates if a packet of the client is parked.
+        bool parked_;
+
+        /// @brief Transaction id of the parked packet.
+        uint32_t xid_;
+
+        /// @brief Time when the parked packet stops suppressing its
+        /// retransmissions.
+        Time parked_until_;
+    };
+
+    /// @brief Type of the table of clients.
+    typedef std::unordered_map<std::vector<uint8_t>, Client,
+                               boost::hash<std::vector<uint8_t> > > ClientMap;
+
+    /// @brief Type of the table of relays indexed by giaddr.
+    typedef std::unordered_map<uint32_t, Bucket> RelayMap;
+
+    /// @brief Returns the key identifying the client which sent a packet.
+    ///
+    /// @param query Received packet.
+    /// @return The client identifier or the hardware address, prefixed
+    /// with the identifier type, or an empty key if the packet has none.
+    static std::vector<uint8_t> getClientKey(const Pkt4Ptr& query);
+
+    /// @brief Creates a full bucket.
+    ///
+    /// @param burst Burst of the bucket.
+    /// @param now Current time.
+    static Bucket createBucket(const uint32_t burst, const Time& now);
+
+    /// @brief Refills a bucket.
+    ///
+    /// @param bucket The bucket.
+    /// @param rate Rate of the bucket.
+    /// @param burst Burst of the bucket.
+    /// @param now Current time.
+    static void refill(Bucket& bucket, const uint32_t rate,
+                       const uint32_t burst, const Time& now);
+
+    /// @brief Takes a token from a bucket.
+    ///
+    /// @param bucket The bucket.
+    /// @param rate Rate of the bucket.
+    /// @param burst Burst of the bucket.
+    /// @param now Current time.
+    /// @return true if a token was available, false otherwise.
+    static bool take(Bucket& bucket, const uint32_t rate,
+                     const uint32_t burst, const Time& now);
+
+    /// @brief Makes room in the tables if they are full.
+    ///
+    /// The tables are purged at most once a second.
+    ///
+    /// @param now Current time.
+    /// @return true if there is room for a new client or relay.
+    bool makeRoom(const Time& now);
+
+    /// @brief Returns the client entry, creating it if possible.
+    ///
+    /// @param key Key of the client.
+    /// @param now Current time.
+    /// @return Pointer to the entry or null if the tables are full.
+    Client* getClient(const std::vector<uint8_t>& key, const Time& now);
+
+    /// @brief Configuration.
+    ConstCfgRateLimitPtr cfg_;
+
+    /// @brief Burst of the clients.
+    uint32_t client_burst_;
+
+    /// @brief Burst of the relays.
+    uint32_t relay_burst_;
+
+    /// @brief Tracked clients.
+    ClientMap clients_;
+
+    /// @brief Tracked relays.
+    RelayMap relays_;
+
+    /// @brief Time of the last purge of the tables.
+    Time last_purge_;
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // CLIENT_RATE_LIMITER_H
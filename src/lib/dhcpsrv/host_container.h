@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -26,8 +26,10 @@ namespace dhcp {
 /// all @c Host objects which are identified by a specified identifier, i.e.
 /// HW address or DUID.
 ///
-/// @todo This container will be extended to search for @c Host objects
-/// associated with a specific IPv4 address or IPv6 prefix/length.
+/// The ordered indexes are used to return all hosts for the identifier
+/// or the IPv4 address in the stable order. The hashed indexes are used
+/// for the lookups within the subnet, which are made for each packet and
+/// for each reservation added to the configuration.
 ///
 /// @see http://www.boost.org/doc/libs/1_56_0/libs/multi_index/doc/index.html
 typedef boost::multi_index_container<
@@ -67,6 +69,66 @@ typedef boost::multi_index_container<
             // Index using values returned by the @c Host::getIPv4Reservation.
             boost::multi_index::const_mem_fun<Host, const asiolink::IOAddress&,
                                                &Host::getIPv4Reservation>
+        >,
+
+        // Third index is used to search for the host using one of the
+        // identifiers within the IPv4 subnet. The lookup doesn't depend
+        // on the number of subnets the host has reservations in, so it
+        // is used for the per packet lookups and the duplicate checks.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const std::vector<uint8_t>&,
+                    &Host::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, Host::IdentifierType,
+                    &Host::getIdentifierType
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv4SubnetID
+                >
+            >
+        >,
+
+        // Fourth index is the counterpart of the third index for the
+        // IPv6 subnets.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, const std::vector<uint8_t>&,
+                    &Host::getIdentifier
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, Host::IdentifierType,
+                    &Host::getIdentifierType
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv6SubnetID
+                >
+            >
+        >,
+
+        // Fifth index is used to search for the host using the reserved
+        // IPv4 address within the IPv4 subnet. The same address may be
+        // reserved in many subnets, so the second index is not suitable
+        // for this lookup.
+        boost::multi_index::hashed_non_unique<
+            boost::multi_index::composite_key<
+                Host,
+                boost::multi_index::const_mem_fun<
+                    Host, SubnetID,
+                    &Host::getIPv4SubnetID
+                >,
+                boost::multi_index::const_mem_fun<
+                    Host, const asiolink::IOAddress&,
+                    &Host::getIPv4Reservation
+                >
+            >
         >
     >
 > HostContainer;
@@ -91,6 +153,36 @@ typedef HostContainer::nth_index<1>::type HostContainerIndex1;
 typedef std::pair<HostContainerIndex1::iterator,
                   HostContainerIndex1::iterator> HostContainerIndex1Range;
 
+/// @brief Third index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// identifier + identifier type + IPv4 subnet id tuple.
+typedef HostContainer::nth_index<2>::type HostContainerIndex2;
+
+/// @brief Results range returned using the @c HostContainerIndex2.
+typedef std::pair<HostContainerIndex2::iterator,
+                  HostContainerIndex2::iterator> HostContainerIndex2Range;
+
+/// @brief Fourth index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// identifier + identifier type + IPv6 subnet id tuple.
+typedef HostContainer::nth_index<3>::type HostContainerIndex3;
+
+/// @brief Results range returned using the @c HostContainerIndex3.
+typedef std::pair<HostContainerIndex3::iterator,
+                  HostContainerIndex3::iterator> HostContainerIndex3Range;
+
+/// @brief Fifth index type in the @c HostContainer.
+///
+/// This index allows for searching for @c Host objects using an
+/// IPv4 subnet id + reserved IPv4 address tuple.
+typedef HostContainer::nth_index<4>::type HostContainerIndex4;
+
+/// @brief Results range returned using the @c HostContainerIndex4.
+typedef std::pair<HostContainerIndex4::iterator,
+                  HostContainerIndex4::iterator> HostContainerIndex4Range;
+
 /// @brief Defines one entry for the Host Container for v6 hosts
 ///
 /// It's essentially a pair of (IPv6 reservation, Host pointer).
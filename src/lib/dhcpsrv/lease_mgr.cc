@@ -85,28 +85,70 @@ LeaseMgr::recountLeaseStats4() {
 
     for (Subnet4Collection::const_iterator subnet = subnets->begin();
          subnet != subnets->end(); ++subnet) {
-        SubnetID subnet_id = (*subnet)->getID();
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "assigned-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "declined-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "reclaimed-declined-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "reclaimed-leases"),
-                           zero);
+        clearSubnetLeaseStats4((*subnet)->getID());
     }
 
-    // Get counts per state per subnet. Iterate over the result set
-    // updating the subnet and global values.
+    // Get counts per state per subnet.
+    setLeaseStats4(*query);
+}
+
+void
+LeaseMgr::recountLeaseStats4(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery4(subnet_id);
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    // The subnet may have been counted before, so its declined leases
+    // must be removed from the global value before they are counted again.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    ObservationPtr declined =
+        stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                        "declined-addresses"));
+    if (declined) {
+        stats_mgr.addValue("declined-addresses",
+                           -declined->getInteger().first);
+    }
+
+    clearSubnetLeaseStats4(subnet_id);
+    setLeaseStats4(*query);
+}
+
+void
+LeaseMgr::clearSubnetLeaseStats4(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-leases"),
+                       zero);
+}
+
+void
+LeaseMgr::setLeaseStats4(LeaseStatsQuery& query) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // Iterate over the result set updating the subnet and global values.
     LeaseStatsRow row;
-    while (query->getNextRow(row)) {
+    while (query.getNextRow(row)) {
         if (row.lease_state_ == Lease::STATE_DEFAULT) {
             // Set subnet level value.
             stats_mgr.setValue(StatsMgr::generateName("subnet", row.subnet_id_,
@@ -205,33 +247,74 @@ LeaseMgr::recountLeaseStats6() {
 
     for (Subnet6Collection::const_iterator subnet = subnets->begin();
          subnet != subnets->end(); ++subnet) {
-        SubnetID subnet_id = (*subnet)->getID();
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "assigned-nas"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "declined-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::
-                           generateName("subnet", subnet_id,
-                                        "reclaimed-declined-addresses"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "assigned-pds"),
-                           zero);
-
-        stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
-                                                  "reclaimed-leases"),
-                           zero);
+        clearSubnetLeaseStats6((*subnet)->getID());
     }
 
-    // Get counts per state per subnet. Iterate over the result set
-    // updating the subnet and global values.
+    // Get counts per state per subnet.
+    setLeaseStats6(*query);
+}
+
+void
+LeaseMgr::recountLeaseStats6(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    LeaseStatsQueryPtr query = startSubnetLeaseStatsQuery6(subnet_id);
+    if (!query) {
+        /// NULL means not backend does not support recounting.
+        return;
+    }
+
+    // The subnet may have been counted before, so its declined leases
+    // must be removed from the global value before they are counted again.
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    ObservationPtr declined =
+        stats_mgr.getObservation(StatsMgr::generateName("subnet", subnet_id,
+                                                        "declined-addresses"));
+    if (declined) {
+        stats_mgr.addValue("declined-addresses",
+                           -declined->getInteger().first);
+    }
+
+    clearSubnetLeaseStats6(subnet_id);
+    setLeaseStats6(*query);
+}
+
+void
+LeaseMgr::clearSubnetLeaseStats6(const SubnetID& subnet_id) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    int64_t zero = 0;
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-nas"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-declined-addresses"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "assigned-pds"),
+                       zero);
+
+    stats_mgr.setValue(StatsMgr::generateName("subnet", subnet_id,
+                                              "reclaimed-leases"),
+                       zero);
+}
+
+void
+LeaseMgr::setLeaseStats6(LeaseStatsQuery& query) {
+    using namespace stats;
+
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    // Iterate over the result set updating the subnet and global values.
     LeaseStatsRow row;
-    while (query->getNextRow(row)) {
+    while (query.getNextRow(row)) {
         switch(row.lease_type_) {
             case Lease::TYPE_NA:
                 if (row.lease_state_ == Lease::STATE_DEFAULT) {
@@ -240,7 +323,7 @@ LeaseMgr::recountLeaseStats6() {
                                        generateName("subnet", row.subnet_id_,
                                                     "assigned-nas"),
                                        row.state_count_);
-                } if (row.lease_state_ == Lease::STATE_DECLINED) {
+                } else if (row.lease_state_ == Lease::STATE_DECLINED) {
                     // Set subnet level value.
                     stats_mgr.setValue(StatsMgr::
                                        generateName("subnet", row.subnet_id_,
@@ -580,6 +580,18 @@ public:
     /// adding to the appropriate global statistic.
     void recountLeaseStats4();
 
+    /// @brief Recalculates per-subnet lease statistics for an IPv4 subnet
+    ///
+    /// This method is the single subnet variant of @ref recountLeaseStats4()
+    /// used when the subnet is added to the configuration without
+    /// committing a new configuration, or replaced with a new subnet
+    /// having the same identifier. The statistics of other subnets are
+    /// not modified. The global declined-addresses statistic is updated
+    /// with the new number of declined leases in the subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void recountLeaseStats4(const SubnetID& subnet_id);
+
     /// @brief Creates and runs the IPv4 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -637,6 +649,18 @@ public:
     /// per subnet and adding to the appropriate global statistic.
     void recountLeaseStats6();
 
+    /// @brief Recalculates per-subnet lease statistics for an IPv6 subnet
+    ///
+    /// This method is the single subnet variant of @ref recountLeaseStats6()
+    /// used when the subnet is added to the configuration without
+    /// committing a new configuration, or replaced with a new subnet
+    /// having the same identifier. The statistics of other subnets are
+    /// not modified. The global declined-addresses statistic is updated
+    /// with the new number of declined leases in the subnet.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    void recountLeaseStats6(const SubnetID& subnet_id);
+
     /// @brief Creates and runs the IPv6 lease stats query for all subnets
     ///
     /// LeaseMgr derivations implement this method such that it creates and
@@ -741,6 +765,33 @@ public:
     /// support transactions, this is a no-op.
     virtual void rollback() = 0;
 
+private:
+
+    /// @brief Sets the per-subnet IPv4 lease statistics to zero.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    static void clearSubnetLeaseStats4(const SubnetID& subnet_id);
+
+    /// @brief Sets the IPv4 lease statistics from the lease stats query.
+    ///
+    /// The per-subnet statistics are set to the values found in the result
+    /// set and the declined leases are added to the global statistic.
+    ///
+    /// @param query Lease stats query whose result set is to be used.
+    static void setLeaseStats4(LeaseStatsQuery& query);
+
+    /// @brief Sets the per-subnet IPv6 lease statistics to zero.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    static void clearSubnetLeaseStats6(const SubnetID& subnet_id);
+
+    /// @brief Sets the IPv6 lease statistics from the lease stats query.
+    ///
+    /// The per-subnet statistics are set to the values found in the result
+    /// set and the declined leases are added to the global statistic.
+    ///
+    /// @param query Lease stats query whose result set is to be used.
+    static void setLeaseStats6(LeaseStatsQuery& query);
 };
 
 }  // namespace dhcp
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -13,6 +13,7 @@
 #include <log/logger_support.h>
 #include <log/logger_manager.h>
 #include <log/logger_name.h>
+#include <limits>
 
 using namespace isc::data;
 using namespace isc::log;
@@ -150,6 +151,37 @@ void LogConfigParser::parseOutputOptions(std::vector<LoggingDestination>& destin
             dest.flush_ = flush_ptr->boolValue();
         }
 
+        isc::data::ConstElementPtr async_ptr = output_option->get("async");
+        if (async_ptr) {
+            dest.async_ = async_ptr->boolValue();
+        }
+
+        isc::data::ConstElementPtr queue_size_ptr =
+            output_option->get("queue-size");
+        if (queue_size_ptr) {
+            int64_t queue_size = queue_size_ptr->intValue();
+            if ((queue_size <= 0) ||
+                (queue_size > std::numeric_limits<uint32_t>::max())) {
+                isc_throw(BadValue, "Unsupported queue-size value "
+                          << queue_size << ", expected a positive 32-bit"
+                          " integer (" << queue_size_ptr->getPosition()
+                          << ")");
+            }
+            dest.queue_size_ = static_cast<uint32_t>(queue_size);
+        }
+
+        isc::data::ConstElementPtr overflow_ptr =
+            output_option->get("overflow-policy");
+        if (overflow_ptr) {
+            std::string overflow = overflow_ptr->stringValue();
+            if ((overflow != "drop") && (overflow != "block")) {
+                isc_throw(BadValue, "Unsupported overflow-policy value '"
+                          << overflow << "', expected 'drop' or 'block' ("
+                          << overflow_ptr->getPosition() << ")");
+            }
+            dest.overflow_policy_ = overflow;
+        }
+
         destination.push_back(dest);
     }
 }
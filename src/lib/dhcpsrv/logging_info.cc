@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2015,2017-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -20,7 +20,10 @@ LoggingDestination::equals(const LoggingDestination& other) const {
     return (output_ == other.output_ &&
             maxver_ == other.maxver_ &&
             maxsize_ == other.maxsize_ &&
-            flush_ == other.flush_);
+            flush_ == other.flush_ &&
+            async_ == other.async_ &&
+            queue_size_ == other.queue_size_ &&
+            overflow_policy_ == other.overflow_policy_);
 }
 
 ElementPtr
@@ -35,6 +38,13 @@ LoggingDestination::toElement() const {
     result->set("maxsize", Element::create(static_cast<long long>(maxsize_)));
     // Set flush
     result->set("flush", Element::create(flush_));
+    // Set asynchronous output parameters only when enabled
+    if (async_) {
+        result->set("async", Element::create(async_));
+        result->set("queue-size",
+                    Element::create(static_cast<long long>(queue_size_)));
+        result->set("overflow-policy", Element::create(overflow_policy_));
+    }
 
     return(result);
 }
@@ -149,6 +159,11 @@ LoggingInfo::toSpec() const {
         // Copy the immediate flush flag
         option.flush = dest->flush_;
 
+        // Copy the asynchronous output parameters
+        option.async = dest->async_;
+        option.queue_size = dest->queue_size_;
+        option.overflow = isc::log::getOverflow(dest->overflow_policy_);
+
         // ... and set the destination
         spec.addOutputOption(option);
     }
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2015,2017-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -38,6 +38,17 @@ public:
     /// @brief Immediate flush
     bool flush_;
 
+    /// @brief Write the messages in a separate thread
+    bool async_;
+
+    /// @brief Maximum number of messages waiting to be written
+    /// (used when async_ is true)
+    uint32_t queue_size_;
+
+    /// @brief Action taken when the queue is full: "drop" or "block"
+    /// (used when async_ is true)
+    std::string overflow_policy_;
+
     /// @brief Compares two objects for equality.
     ///
     /// @param other Object to be compared with this object.
@@ -47,7 +58,8 @@ public:
 
     /// @brief Default constructor.
     LoggingDestination()
-        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true) {
+        : output_("stdout"), maxver_(1), maxsize_(10240000), flush_(true),
+          async_(false), queue_size_(4096), overflow_policy_("drop") {
     }
 
     /// @brief Unparse a configuration object
@@ -67,7 +79,10 @@ public:
 ///                    "output": "/path/to/the/logfile.log",
 ///                    "maxver": 8,
 ///                    "maxsize": 204800,
-///                    "flush": true
+///                    "flush": true,
+///                    "async": true,
+///                    "queue-size": 4096,
+///                    "overflow-policy": "drop"
 ///                }
 ///            ],
 ///            "severity": "WARN",
@@ -1505,6 +1505,13 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
     }
 }
 
+void
+Memfile_LeaseMgr::restoreLFCTimer() {
+    if (persistLeases(V4) || persistLeases(V6)) {
+        lfcSetup();
+    }
+}
+
 template<typename LeaseFileType>
 void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file) {
     bool do_lfc = true;
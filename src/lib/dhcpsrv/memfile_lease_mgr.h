@@ -700,6 +700,13 @@ public:
     int getLFCExitStatus() const;
     //@}
 
+    /// @brief Schedules the periodic %Lease File Cleanup again.
+    ///
+    /// The server unregisters all timers when it is being reconfigured.
+    /// This method is called when the lease manager instance is reused
+    /// by the new configuration to register the LFC timer again.
+    void restoreLFCTimer();
+
     /// @brief Creates and runs the IPv4 lease stats query
     ///
     /// It creates an instance of a MemfileLeaseStatsQuery4 for an all subnets
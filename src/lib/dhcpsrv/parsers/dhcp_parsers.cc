@@ -11,6 +11,7 @@
 #include <dhcpsrv/parsers/host_reservation_parser.h>
 #include <dhcpsrv/parsers/host_reservations_list_parser.h>
 #include <dhcpsrv/parsers/option_data_parser.h>
+#include <dhcpsrv/shared_network.h>
 #include <dhcpsrv/cfg_mac_source.h>
 #include <util/encode/hex.h>
 #include <util/strutil.h>
@@ -857,15 +858,105 @@ Subnet4ConfigParser::initSubnet(data::ConstElementPtr params,
     options_->copyTo(*subnet4->getCfgOption());
 }
 
+namespace {
+
+/// @brief Returns the subnets of the parsed configuration by identifier.
+///
+/// Only the subnets having explicitly specified identifiers are returned
+/// because the generated identifiers depend on the order of the subnets.
+///
+/// @param current Current configuration.
+/// @param name Name of the subnets list, i.e. subnet4 or subnet6.
+/// @return Map of the subnets configurations by subnet identifiers.
+std::map<SubnetID, ConstElementPtr>
+getParsedSubnets(const SrvConfigPtr& current, const std::string& name) {
+    std::map<SubnetID, ConstElementPtr> subnets;
+    if (!current || !current->getParsedConfig()) {
+        return (subnets);
+    }
+    ConstElementPtr subnets_list = current->getParsedConfig()->get(name);
+    if (!subnets_list || (subnets_list->getType() != Element::list)) {
+        return (subnets);
+    }
+    BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
+        ConstElementPtr id = subnet_json->get("id");
+        if (id && (id->getType() == Element::integer) && (id->intValue() > 0)) {
+            subnets[static_cast<SubnetID>(id->intValue())] = subnet_json;
+        }
+    }
+    return (subnets);
+}
+
+/// @brief Returns the current subnet if its configuration hasn't changed.
+///
+/// The subnets belonging to shared networks and the subnets bound to the
+/// interfaces which are no longer present are not returned.
+///
+/// @tparam SubnetPtrType Type of the pointer to the subnet.
+/// @tparam SharedNetworkPtrType Type of the pointer to the shared network.
+/// @param parsed Parsed subnets of the current configuration.
+/// @param subnet_json New configuration of the subnet.
+/// @param get_subnet Function returning the current subnet by identifier.
+/// @return Pointer to the current subnet or null if it must be parsed.
+template<typename SubnetPtrType, typename SharedNetworkPtrType,
+         typename GetSubnet>
+SubnetPtrType
+getUnchangedSubnet(const std::map<SubnetID, ConstElementPtr>& parsed,
+                   const ConstElementPtr& subnet_json,
+                   const GetSubnet& get_subnet) {
+    ConstElementPtr id = subnet_json->get("id");
+    if (!id || (id->getType() != Element::integer) || (id->intValue() <= 0)) {
+        return (SubnetPtrType());
+    }
+    const SubnetID subnet_id = static_cast<SubnetID>(id->intValue());
+    auto parsed_subnet = parsed.find(subnet_id);
+    if ((parsed_subnet == parsed.end()) ||
+        !parsed_subnet->second->equals(*subnet_json)) {
+        return (SubnetPtrType());
+    }
+    SubnetPtrType subnet = get_subnet(subnet_id);
+    if (!subnet) {
+        return (SubnetPtrType());
+    }
+    SharedNetworkPtrType network;
+    subnet->getSharedNetwork(network);
+    if (network || (!subnet->getIface().empty() &&
+                    !IfaceMgr::instance().getIface(subnet->getIface()))) {
+        return (SubnetPtrType());
+    }
+    return (subnet);
+}
+
+}
+
 //**************************** Subnets4ListConfigParser **********************
 
 size_t
-Subnets4ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
+Subnets4ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list,
+                                const SrvConfigPtr& current) {
+    std::map<SubnetID, ConstElementPtr> parsed =
+        getParsedSubnets(current, "subnet4");
     size_t cnt = 0;
     BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-        Subnet4ConfigParser parser;
-        Subnet4Ptr subnet = parser.parse(subnet_json);
+        // The subnet which is configured exactly as in the current
+        // configuration is reused along with its host reservations.
+        Subnet4Ptr subnet;
+        if (!parsed.empty()) {
+            subnet = getUnchangedSubnet<Subnet4Ptr, SharedNetwork4Ptr>
+                (parsed, subnet_json, [&current](const SubnetID& id) {
+                    return (current->getCfgSubnets4()->getSubnet(id));
+                });
+        }
+        if (subnet) {
+            HostCollection hosts = current->getCfgHosts()->getAll4(subnet->getID());
+            for (auto h = hosts.begin(); h != hosts.end(); ++h) {
+                cfg->getCfgHosts()->add(*h);
+            }
+        } else {
+            Subnet4ConfigParser parser;
+            subnet = parser.parse(subnet_json);
+        }
         if (subnet) {
 
             // Adding a subnet to the Configuration Manager may fail if the
@@ -1214,12 +1305,31 @@ Subnet6ConfigParser::initSubnet(data::ConstElementPtr params,
 //**************************** Subnet6ListConfigParser ********************
 
 size_t
-Subnets6ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
+Subnets6ListConfigParser::parse(SrvConfigPtr cfg, ConstElementPtr subnets_list,
+                                const SrvConfigPtr& current) {
+    std::map<SubnetID, ConstElementPtr> parsed =
+        getParsedSubnets(current, "subnet6");
     size_t cnt = 0;
     BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-        Subnet6ConfigParser parser;
-        Subnet6Ptr subnet = parser.parse(subnet_json);
+        // The subnet which is configured exactly as in the current
+        // configuration is reused along with its host reservations.
+        Subnet6Ptr subnet;
+        if (!parsed.empty()) {
+            subnet = getUnchangedSubnet<Subnet6Ptr, SharedNetwork6Ptr>
+                (parsed, subnet_json, [&current](const SubnetID& id) {
+                    return (current->getCfgSubnets6()->getSubnet(id));
+                });
+        }
+        if (subnet) {
+            HostCollection hosts = current->getCfgHosts()->getAll6(subnet->getID());
+            for (auto h = hosts.begin(); h != hosts.end(); ++h) {
+                cfg->getCfgHosts()->add(*h);
+            }
+        } else {
+            Subnet6ConfigParser parser;
+            subnet = parser.parse(subnet_json);
+        }
 
         // Adding a subnet to the Configuration Manager may fail if the
         // subnet id is invalid (duplicate). Thus, we catch exceptions
@@ -567,10 +567,20 @@ public:
     /// (by instantiating Subnet6ConfigParser) and adds to specified
     /// configuration.
     ///
+    /// The subnets having explicitly specified identifiers which are
+    /// configured exactly as in the current configuration are not parsed.
+    /// The current subnets and their host reservations are added to the
+    /// configuration instead. The caller must make sure that the current
+    /// subnets don't depend on the changed parts of the configuration,
+    /// e.g. the option definitions.
+    ///
     /// @param cfg Pointer to server configuration.
     /// @param subnets_list pointer to a list of IPv4 subnets
+    /// @param current Pointer to the current server configuration which
+    /// subnets can be reused or null.
     /// @return number of subnets created
-    size_t parse(SrvConfigPtr cfg, data::ConstElementPtr subnets_list);
+    size_t parse(SrvConfigPtr cfg, data::ConstElementPtr subnets_list,
+                 const SrvConfigPtr& current = SrvConfigPtr());
 
     /// @brief Parses contents of the subnet4 list.
     ///
@@ -760,10 +770,20 @@ public:
     /// (by instantiating Subnet6ConfigParser) and adds to specified
     /// configuration.
     ///
+    /// The subnets having explicitly specified identifiers which are
+    /// configured exactly as in the current configuration are not parsed.
+    /// The current subnets and their host reservations are added to the
+    /// configuration instead. The caller must make sure that the current
+    /// subnets don't depend on the changed parts of the configuration,
+    /// e.g. the option definitions.
+    ///
     /// @param cfg configuration (parsed subnets will be stored here)
     /// @param subnets_list pointer to a list of IPv6 subnets
+    /// @param current Pointer to the current server configuration which
+    /// subnets can be reused or null.
     /// @throw DhcpConfigError if CfgMgr rejects the subnet (e.g. subnet-id is a duplicate)
-    size_t parse(SrvConfigPtr cfg, data::ConstElementPtr subnets_list);
+    size_t parse(SrvConfigPtr cfg, data::ConstElementPtr subnets_list,
+                 const SrvConfigPtr& current = SrvConfigPtr());
 
     /// @brief Parses contents of the subnet6 list.
     ///
@@ -0,0 +1,64 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/parsers/rate_limit_parser.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+
+using namespace isc::data;
+
+namespace isc {
+namespace dhcp {
+
+void
+RateLimitParser::parse(const CfgRateLimitPtr& cfg,
+                       const ConstElementPtr& rate_limit) {
+    if (rate_limit->getType() != Element::map) {
+        isc_throw(DhcpConfigError, "client-rate-limit is supposed to be a map ("
+                  << rate_limit->getPosition() << ")");
+    }
+
+    std::string param;
+
+    try {
+        for (auto const& entry : rate_limit->mapValue()) {
+            param = entry.first;
+            if (param == "client-rate") {
+                cfg->setClientRate(getInteger(rate_limit, param));
+
+            } else if (param == "client-burst") {
+                cfg->setClientBurst(getInteger(rate_limit, param));
+
+            } else if (param == "relay-rate") {
+                cfg->setRelayRate(getInteger(rate_limit, param));
+
+            } else if (param == "relay-burst") {
+                cfg->setRelayBurst(getInteger(rate_limit, param));
+
+            } else if (param == "max-clients") {
+                cfg->setMaxClients(getInteger(rate_limit, param));
+
+            } else if (param == "drop-duplicates") {
+                cfg->setDropDuplicates(getBoolean(rate_limit, param));
+
+            } else {
+                isc_throw(DhcpConfigError, "unsupported parameter '" << param
+                          << "' in client-rate-limit ("
+                          << getPosition(param, rate_limit) << ")");
+            }
+        }
+    } catch (const DhcpConfigError&) {
+        throw;
+    } catch (const std::exception& ex) {
+        // Append position of the configuration parameter to the error message.
+        isc_throw(DhcpConfigError, ex.what() << " ("
+                  << getPosition(param, rate_limit) << ")");
+    }
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
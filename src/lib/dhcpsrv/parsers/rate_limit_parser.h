@@ -0,0 +1,47 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef RATE_LIMIT_PARSER_H
+#define RATE_LIMIT_PARSER_H
+
+#include <cc/data.h>
+#include <cc/simple_parser.h>
+#include <dhcpsrv/cfg_rate_limit.h>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Parser for the client-rate-limit structure.
+///
+/// Currently supported parameters are:
+/// - client-rate,
+/// - client-burst,
+/// - relay-rate,
+/// - relay-burst,
+/// - max-clients,
+/// - drop-duplicates.
+///
+/// These parameters are optional and the default values are used for
+/// those that aren't specified. The ranges are checked by the
+/// @c CfgRateLimit class.
+class RateLimitParser : public isc::data::SimpleParser {
+public:
+
+    /// @brief Parses the client-rate-limit map.
+    ///
+    /// @param cfg parsed values will be stored here
+    /// @param rate_limit a JSON map holding the parameters
+    ///
+    /// @throw DhcpConfigError if unknown parameter specified or the
+    /// parameter contains invalid value.
+    void parse(const CfgRateLimitPtr& cfg,
+               const isc::data::ConstElementPtr& rate_limit);
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // RATE_LIMIT_PARSER_H
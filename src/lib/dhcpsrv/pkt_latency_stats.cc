@@ -0,0 +1,203 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/pkt_latency_stats.h>
+#include <stats/stats_mgr.h>
+#include <boost/algorithm/string/predicate.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+#include <cctype>
+
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Converts duration to microseconds.
+///
+/// @param duration Duration measured by the monotonic clock.
+template<typename Duration>
+uint64_t toMicroseconds(const Duration& duration) {
+    return (std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+/// @brief Converts message type name to the form used in statistic names.
+///
+/// The "DHCP" prefix is removed, letters are converted to lower case and
+/// underscores to dashes, e.g. "DHCPDISCOVER" becomes "discover".
+///
+/// @param name Message type name.
+std::string typeNameToText(const char* name) {
+    std::string text(name ? name : "unknown");
+    if (boost::starts_with(text, "DHCP") && (text.size() > 4)) {
+        text = text.substr(4);
+    }
+    for (std::string::iterator c = text.begin(); c != text.end(); ++c) {
+        *c = (*c == '_' ? '-' : std::tolower(*c));
+    }
+    return (text);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+PktLatencyStats::PktLatencyStats(const std::string& prefix,
+                                 const long publish_interval)
+    : prefix_(prefix),
+      publish_interval_(std::chrono::milliseconds(publish_interval)),
+      last_publish_(Clock::now()), started_(false), start_(), last_(),
+      current_(0), types_() {
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        durations_[i] = Clock::duration::zero();
+        touched_[i] = false;
+    }
+}
+
+void
+PktLatencyStats::start(const Pkt& pkt) {
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        durations_[i] = Clock::duration::zero();
+        touched_[i] = false;
+    }
+    current_ = 0;
+    started_ = true;
+    start_ = Clock::now();
+    last_ = start_;
+
+    // The packet timestamp is set by the packet filter when the packet
+    // is read from the socket.
+    if (!pkt.getTimestamp().is_not_a_date_time()) {
+        const boost::posix_time::time_duration wait =
+            boost::posix_time::microsec_clock::universal_time() - pkt.getTimestamp();
+        if (!wait.is_negative()) {
+            durations_[RECEIVE] = std::chrono::microseconds(wait.total_microseconds());
+            touched_[RECEIVE] = true;
+        }
+    }
+}
+
+void
+PktLatencyStats::setMessageType(const uint8_t type, const char* name) {
+    if (!started_) {
+        return;
+    }
+
+    std::map<uint8_t, TypeStatsPtr>::const_iterator stats = types_.find(type);
+    if (stats != types_.end()) {
+        current_ = stats->second.get();
+        return;
+    }
+
+    TypeStatsPtr type_stats(new TypeStats());
+    const std::string type_text = typeNameToText(name);
+    for (int i = 0; i < PHASE_COUNT; ++i) {
+        type_stats->names_[i] = prefix_ + "-" + type_text + "-" +
+            phaseToText(static_cast<Phase>(i)) + "-latency";
+    }
+    types_.insert(std::make_pair(type, type_stats));
+    current_ = type_stats.get();
+}
+
+void
+PktLatencyStats::finish() {
+    if (!started_) {
+        return;
+    }
+    started_ = false;
+
+    if (!current_) {
+        return;
+    }
+
+    const Clock::time_point now = Clock::now();
+    for (int i = 0; i < TOTAL; ++i) {
+        if (touched_[i]) {
+            current_->histograms_[i].record(toMicroseconds(durations_[i]));
+        }
+    }
+    current_->histograms_[TOTAL].record(toMicroseconds(now - start_ +
+                                                       durations_[RECEIVE]));
+    current_ = 0;
+
+    if (now - last_publish_ >= publish_interval_) {
+        publish();
+        last_publish_ = now;
+    }
+}
+
+void
+PktLatencyStats::publish() const {
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    for (std::map<uint8_t, TypeStatsPtr>::const_iterator type = types_.begin();
+         type != types_.end(); ++type) {
+        for (int i = 0; i < PHASE_COUNT; ++i) {
+            const LatencyHistogram& histogram = type->second->histograms_[i];
+            if (histogram.getCount() == 0) {
+                continue;
+            }
+            const std::string& name = type->second->names_[i];
+            stats_mgr.setValue(name + "-p50",
+                               static_cast<int64_t>(histogram.getPercentile(50)));
+            stats_mgr.setValue(name + "-p90",
+                               static_cast<int64_t>(histogram.getPercentile(90)));
+            stats_mgr.setValue(name + "-p99",
+                               static_cast<int64_t>(histogram.getPercentile(99)));
+            stats_mgr.setValue(name + "-max",
+                               static_cast<int64_t>(histogram.getMax()));
+        }
+    }
+}
+
+const LatencyHistogram*
+PktLatencyStats::getHistogram(const uint8_t type, const Phase phase) const {
+    std::map<uint8_t, TypeStatsPtr>::const_iterator stats = types_.find(type);
+    if ((stats == types_.end()) || (phase >= PHASE_COUNT)) {
+        return (0);
+    }
+    return (&stats->second->histograms_[phase]);
+}
+
+const char*
+PktLatencyStats::phaseToText(const Phase phase) {
+    switch (phase) {
+    case RECEIVE:
+        return ("receive");
+    case BUFFER_RECEIVE:
+        return ("buffer-receive");
+    case UNPACK:
+        return ("unpack");
+    case CLASSIFY:
+        return ("classify");
+    case PKT_RECEIVE:
+        return ("pkt-receive");
+    case SUBNET_SELECT:
+        return ("subnet-select");
+    case HOST_LOOKUP:
+        return ("host-lookup");
+    case DDNS:
+        return ("ddns");
+    case LEASE_ALLOC:
+        return ("lease-alloc");
+    case BUILD_RESPONSE:
+        return ("build-response");
+    case LEASES_COMMITTED:
+        return ("leases-committed");
+    case PKT_SEND:
+        return ("pkt-send");
+    case BUFFER_SEND:
+        return ("buffer-send");
+    case TOTAL:
+        return ("total");
+    default:
+        ;
+    }
+    return ("unknown");
+}
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
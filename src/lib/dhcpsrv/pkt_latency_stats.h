@@ -0,0 +1,179 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef PKT_LATENCY_STATS_H
+#define PKT_LATENCY_STATS_H
+
+#include <dhcp/pkt.h>
+#include <stats/latency_histogram.h>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <chrono>
+#include <map>
+#include <stdint.h>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Latency statistics of the packet processing phases.
+///
+/// The server marks the end of each processing phase of the packet
+/// being processed. The time elapsed since the previous mark, measured
+/// with a monotonic clock, is attributed to the phase. When the
+/// processing is finished, the phase durations are recorded in the
+/// latency histograms maintained per message type and phase.
+///
+/// The histograms are periodically published to the @c StatsMgr as
+/// integer statistics holding the median, 90th and 99th percentile and
+/// the maximum of the duration in microseconds, e.g.
+/// "pkt4-discover-lease-alloc-latency-p99". The "total" phase covers the
+/// whole processing from the reception of the packet.
+///
+/// Only the packets of which the message type has been set with
+/// @c setMessageType, i.e. the packets which have been accepted for
+/// processing, are recorded.
+///
+/// @note This class is not thread safe.
+class PktLatencyStats : public boost::noncopyable {
+public:
+
+    /// @brief Packet processing phases.
+    enum Phase {
+        RECEIVE,          ///< Waiting between reception and processing.
+        BUFFER_RECEIVE,   ///< bufferN_receive callouts.
+        UNPACK,           ///< Parsing the packet.
+        CLASSIFY,         ///< Classification and sanity checks.
+        PKT_RECEIVE,      ///< pktN_receive callouts.
+        SUBNET_SELECT,    ///< Subnet selection including the callouts.
+        HOST_LOOKUP,      ///< Host reservations lookup.
+        DDNS,             ///< Client FQDN and hostname processing.
+        LEASE_ALLOC,      ///< Lease allocation, renewal or release.
+        BUILD_RESPONSE,   ///< Appending options and adjusting the response.
+        LEASES_COMMITTED, ///< leasesN_committed callouts.
+        PKT_SEND,         ///< pktN_send callouts and packing the response.
+        BUFFER_SEND,      ///< bufferN_send callouts and sending the response.
+        TOTAL,            ///< Whole processing.
+        PHASE_COUNT       ///< Number of phases.
+    };
+
+    /// @brief Default interval between publishing the statistics.
+    static const long DEFAULT_PUBLISH_INTERVAL = 1000;
+
+    /// @brief Constructor.
+    ///
+    /// @param prefix Prefix of the statistic names, e.g. "pkt4".
+    /// @param publish_interval Interval between publishing the statistics
+    /// in milliseconds.
+    explicit PktLatencyStats(const std::string& prefix,
+                             const long publish_interval = DEFAULT_PUBLISH_INTERVAL);
+
+    /// @brief Starts timing of a received packet.
+    ///
+    /// The time elapsed since the packet timestamp is attributed to the
+    /// @c RECEIVE phase.
+    ///
+    /// @param pkt Received packet.
+    void start(const Pkt& pkt);
+
+    /// @brief Marks the end of the processing phase.
+    ///
+    /// The time elapsed since the previous mark is added to the phase.
+    /// It does nothing if the timing hasn't been started.
+    ///
+    /// @param phase Processing phase which has ended.
+    void mark(const Phase phase) {
+        if (started_) {
+            const Clock::time_point now = Clock::now();
+            durations_[phase] += now - last_;
+            touched_[phase] = true;
+            last_ = now;
+        }
+    }
+
+    /// @brief Sets the message type of the packet being timed.
+    ///
+    /// @param type Message type.
+    /// @param name Message type name, e.g. "DHCPDISCOVER".
+    void setMessageType(const uint8_t type, const char* name);
+
+    /// @brief Finishes timing of the packet.
+    ///
+    /// Records the phase durations in the histograms if the message type
+    /// has been set and publishes the statistics if the publishing
+    /// interval has elapsed.
+    void finish();
+
+    /// @brief Publishes the statistics to the @c StatsMgr.
+    void publish() const;
+
+    /// @brief Returns the histogram for the message type and phase.
+    ///
+    /// @param type Message type.
+    /// @param phase Processing phase.
+    ///
+    /// @return Pointer to the histogram or NULL if no packet of this type
+    /// has been recorded.
+    const stats::LatencyHistogram* getHistogram(const uint8_t type,
+                                                const Phase phase) const;
+
+    /// @brief Returns the name of the phase used in the statistic names.
+    ///
+    /// @param phase Processing phase.
+    static const char* phaseToText(const Phase phase);
+
+private:
+
+    /// @brief Monotonic clock used for timing.
+    typedef std::chrono::steady_clock Clock;
+
+    /// @brief Histograms of a message type.
+    struct TypeStats {
+        /// @brief Names of the statistics, without the percentile suffix.
+        std::string names_[PHASE_COUNT];
+
+        /// @brief Histograms of the phases.
+        stats::LatencyHistogram histograms_[PHASE_COUNT];
+    };
+
+    /// @brief Pointer to the histograms of a message type.
+    typedef boost::shared_ptr<TypeStats> TypeStatsPtr;
+
+    /// @brief Prefix of the statistic names.
+    std::string prefix_;
+
+    /// @brief Interval between publishing the statistics.
+    Clock::duration publish_interval_;
+
+    /// @brief Time of the last publishing.
+    Clock::time_point last_publish_;
+
+    /// @brief Flag indicating if a packet is being timed.
+    bool started_;
+
+    /// @brief Time of the start of the timing.
+    Clock::time_point start_;
+
+    /// @brief Time of the last mark.
+    Clock::time_point last_;
+
+    /// @brief Time spent in the phases.
+    Clock::duration durations_[PHASE_COUNT];
+
+    /// @brief Flags indicating which phases have been marked.
+    bool touched_[PHASE_COUNT];
+
+    /// @brief Histograms of the message type being timed or NULL.
+    TypeStats* current_;
+
+    /// @brief Histograms by message types.
+    std::map<uint8_t, TypeStatsPtr> types_;
+};
+
+} // end of namespace isc::dhcp
+} // end of namespace isc
+
+#endif // PKT_LATENCY_STATS_H
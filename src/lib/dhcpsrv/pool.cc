@@ -17,11 +17,14 @@ using namespace isc::data;
 namespace isc {
 namespace dhcp {
 
+const unsigned Pool::EXHAUSTED_TIMEOUT;
+
 Pool::Pool(Lease::Type type, const isc::asiolink::IOAddress& first,
            const isc::asiolink::IOAddress& last)
     :id_(getNextID()), first_(first), last_(last), type_(type),
      capacity_(0), cfg_option_(new CfgOption()), client_class_(""),
-     last_allocated_(first), last_allocated_valid_(false) {
+     last_allocated_(first), last_allocated_valid_(false),
+     exhausted_(false), exhausted_time_() {
 }
 
 bool Pool::inRange(const isc::asiolink::IOAddress& addr) const {
@@ -17,6 +17,7 @@
 #include <dhcpsrv/lease.h>
 #include <boost/shared_ptr.hpp>
 
+#include <chrono>
 #include <vector>
 
 namespace isc {
@@ -161,6 +162,38 @@ public:
         last_allocated_valid_ = false;
     }
 
+    /// @brief Time after which a pool marked exhausted is tried again
+    /// (in seconds).
+    static const unsigned EXHAUSTED_TIMEOUT = 60;
+
+    /// @brief Checks if the pool is known to have no free leases.
+    ///
+    /// The allocation engine marks the pool exhausted when it has walked
+    /// over all addresses in the pool without finding a free one. The
+    /// pool is then skipped by the allocator until a lease belonging to
+    /// it is released, reclaimed or deleted by this server. The leases
+    /// may also expire or be deleted by another server sharing the lease
+    /// database, so the pool is tried again after @c EXHAUSTED_TIMEOUT
+    /// anyway.
+    ///
+    /// @return true if the pool is exhausted, false otherwise.
+    bool isExhausted() const {
+        return (exhausted_ && (std::chrono::steady_clock::now() <
+                               exhausted_time_ +
+                               std::chrono::seconds(EXHAUSTED_TIMEOUT)));
+    }
+
+    /// @brief Marks the pool exhausted or not exhausted.
+    ///
+    /// @param exhausted true if the pool has no free leases, false if
+    /// the pool may have free leases.
+    void setExhausted(const bool exhausted) {
+        exhausted_ = exhausted;
+        if (exhausted) {
+            exhausted_time_ = std::chrono::steady_clock::now();
+        }
+    }
+
     /// @brief Unparse a pool object.
     ///
     /// @return A pointer to unparsed pool configuration.
@@ -234,6 +267,12 @@ protected:
 
     /// @brief Status of last allocated address
     bool last_allocated_valid_;
+
+    /// @brief Indicates if the pool is known to have no free leases.
+    bool exhausted_;
+
+    /// @brief Time when the pool was marked exhausted.
+    std::chrono::steady_clock::time_point exhausted_time_;
 };
 
 /// @brief Pool information for IPv4 addresses
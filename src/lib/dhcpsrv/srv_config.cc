@@ -28,6 +28,7 @@ SrvConfig::SrvConfig()
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
       cfg_hosts_(new CfgHosts()), cfg_rsoo_(new CfgRSOO()),
+      cfg_option_list_cache_(new CfgOptionListCache()),
       cfg_expiration_(new CfgExpiration()), cfg_duid_(new CfgDUID()),
       cfg_db_access_(new CfgDbAccess()),
       cfg_host_operations4_(CfgHostOperations::createConfig4()),
@@ -36,7 +37,8 @@ SrvConfig::SrvConfig()
       decline_timer_(0), echo_v4_client_id_(true), dhcp4o6_port_(0),
       d2_client_config_(new D2ClientConfig()),
       configured_globals_(Element::createMap()),
-      cfg_consist_(new CfgConsistency()) {
+      cfg_consist_(new CfgConsistency()),
+      cfg_rate_limit_(new CfgRateLimit()) {
 }
 
 SrvConfig::SrvConfig(const uint32_t sequence)
@@ -46,6 +48,7 @@ SrvConfig::SrvConfig(const uint32_t sequence)
       cfg_shared_networks4_(new CfgSharedNetworks4()),
       cfg_shared_networks6_(new CfgSharedNetworks6()),
       cfg_hosts_(new CfgHosts()), cfg_rsoo_(new CfgRSOO()),
+      cfg_option_list_cache_(new CfgOptionListCache()),
       cfg_expiration_(new CfgExpiration()), cfg_duid_(new CfgDUID()),
       cfg_db_access_(new CfgDbAccess()),
       cfg_host_operations4_(CfgHostOperations::createConfig4()),
@@ -54,7 +57,8 @@ SrvConfig::SrvConfig(const uint32_t sequence)
       decline_timer_(0), echo_v4_client_id_(true), dhcp4o6_port_(0),
       d2_client_config_(new D2ClientConfig()),
       configured_globals_(Element::createMap()),
-      cfg_consist_(new CfgConsistency()) {
+      cfg_consist_(new CfgConsistency()),
+      cfg_rate_limit_(new CfgRateLimit()) {
 }
 
 std::string
@@ -210,6 +214,29 @@ SrvConfig::updateStatistics() {
     }
 }
 
+void
+SrvConfig::updateStatistics(const SrvConfig& previous) {
+    if (LeaseMgrFactory::haveInstance()) {
+        getCfgSubnets4()->updateStatistics(*previous.getCfgSubnets4());
+
+        getCfgSubnets6()->updateStatistics(*previous.getCfgSubnets6());
+    }
+}
+
+bool
+SrvConfig::isParsedParameterUnchanged(const ConstElementPtr& config,
+                                      const std::string& name) const {
+    if (!parsed_config_) {
+        return (false);
+    }
+    ConstElementPtr value = config->get(name);
+    ConstElementPtr parsed_value = parsed_config_->get(name);
+    if (!value || !parsed_value) {
+        return (!value && !parsed_value);
+    }
+    return (value->equals(*parsed_value));
+}
+
 void 
 SrvConfig::extractConfiguredGlobals(isc::data::ConstElementPtr config) {
     if (config->getType() != Element::map) {
@@ -428,6 +455,11 @@ SrvConfig::toElement() const {
     ConstElementPtr cfg_consist = cfg_consist_->toElement();
     dhcp->set("sanity-checks", cfg_consist);
 
+    // Set client-rate-limit only when enabled (DHCPv4 only)
+    if ((family == AF_INET) && cfg_rate_limit_->isEnabled()) {
+        dhcp->set("client-rate-limit", cfg_rate_limit_->toElement());
+    }
+
     return (result);
 }
 
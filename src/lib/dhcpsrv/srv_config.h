@@ -16,12 +16,14 @@
 #include <dhcpsrv/cfg_iface.h>
 #include <dhcpsrv/cfg_option.h>
 #include <dhcpsrv/cfg_option_def.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
 #include <dhcpsrv/cfg_rsoo.h>
 #include <dhcpsrv/cfg_shared_networks.h>
 #include <dhcpsrv/cfg_subnets4.h>
 #include <dhcpsrv/cfg_subnets6.h>
 #include <dhcpsrv/cfg_mac_source.h>
 #include <dhcpsrv/cfg_consistency.h>
+#include <dhcpsrv/cfg_rate_limit.h>
 #include <dhcpsrv/client_class_def.h>
 #include <dhcpsrv/d2_client_cfg.h>
 #include <dhcpsrv/logging_info.h>
@@ -282,6 +284,18 @@ public:
         return (cfg_rsoo_);
     }
 
+    /// @brief Returns pointer to the cache of options resolved from the
+    /// lists of option configurations.
+    ///
+    /// The cache is not a part of the configuration. It is used by the
+    /// server to avoid looking up the options in each of the applicable
+    /// option configurations for every response.
+    ///
+    /// @return Pointer to the cache.
+    CfgOptionListCachePtr getCfgOptionListCache() const {
+        return (cfg_option_list_cache_);
+    }
+
     /// @brief Returns pointer to the object holding configuration pertaining
     /// to processing expired leases.
     CfgExpirationPtr getCfgExpiration() {
@@ -347,6 +361,18 @@ public:
         return (cfg_consist_);
     }
 
+    /// @brief Returns pointer to the object holding configuration of the
+    /// early drop of the received packets.
+    CfgRateLimitPtr getCfgRateLimit() {
+        return (cfg_rate_limit_);
+    }
+
+    /// @brief Returns pointer to the const object holding configuration
+    /// of the early drop of the received packets.
+    ConstCfgRateLimitPtr getCfgRateLimit() const {
+        return (cfg_rate_limit_);
+    }
+
     //@}
 
     /// @brief Returns non-const reference to an array that stores
@@ -496,6 +522,16 @@ public:
     /// @ref CfgSubnets6::removeStatistics for details.
     void removeStatistics();
 
+    /// @brief Updates statistics after the previous configuration.
+    ///
+    /// This method is used when the new configuration uses the same
+    /// lease database as the previous one. See
+    /// @ref CfgSubnets4::updateStatistics(const CfgSubnets4&) and
+    /// @ref CfgSubnets6::updateStatistics(const CfgSubnets6&) for details.
+    ///
+    /// @param previous Previous configuration.
+    void updateStatistics(const SrvConfig& previous);
+
     /// @brief Sets decline probation-period
     ///
     /// Probation-period is the timer, expressed, in seconds, that specifies how
@@ -579,6 +615,41 @@ public:
         configured_globals_->set(name, value);
     }
 
+    /// @brief Returns the configuration this configuration has been parsed
+    /// from.
+    ///
+    /// @return Pointer to the parsed configuration or null if it hasn't been
+    /// set or the configuration has been modified since it was parsed.
+    isc::data::ConstElementPtr getParsedConfig() const {
+        return (parsed_config_);
+    }
+
+    /// @brief Sets the configuration this configuration has been parsed from.
+    ///
+    /// The server sets it to the configuration including the default and
+    /// derived parameters, so the subnets, client classes and host
+    /// reservations which haven't changed can be reused by the next
+    /// configuration rather than being parsed again. It must be reset
+    /// when the configuration is modified by other means, e.g. by the
+    /// commands modifying the subnets.
+    ///
+    /// @param config Pointer to the parsed configuration, which must not be
+    /// modified afterwards, or null.
+    void setParsedConfig(const isc::data::ConstElementPtr& config) {
+        parsed_config_ = config;
+    }
+
+    /// @brief Checks if a global parameter of the parsed configuration is
+    /// the same as in the specified configuration.
+    ///
+    /// @param config New configuration.
+    /// @param name Name of the global parameter.
+    /// @return true if this configuration has been parsed from the
+    /// configuration having the same value of the parameter (or neither
+    /// has the parameter), false otherwise.
+    bool isParsedParameterUnchanged(const isc::data::ConstElementPtr& config,
+                                    const std::string& name) const;
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -637,6 +708,9 @@ private:
     /// RFC 6422 for the definition of the RSOO-enabled option.
     CfgRSOOPtr cfg_rsoo_;
 
+    /// @brief Pointer to the cache of resolved options.
+    CfgOptionListCachePtr cfg_option_list_cache_;
+
     /// @brief Pointer to the configuration pertaining to processing of
     /// expired leases.
     CfgExpirationPtr cfg_expiration_;
@@ -686,8 +760,15 @@ private:
     /// @brief Stores the global parameters specified via configuration
     isc::data::ElementPtr configured_globals_;
 
+    /// @brief Configuration this configuration has been parsed from.
+    isc::data::ConstElementPtr parsed_config_;
+
     /// @brief Pointer to the configuration consistency settings
     CfgConsistencyPtr cfg_consist_;
+
+    /// @brief Pointer to the configuration of the early drop of the
+    /// received packets.
+    CfgRateLimitPtr cfg_rate_limit_;
 };
 
 /// @name Pointers to the @c SrvConfig object.
@@ -214,6 +214,56 @@ Subnet::sumPoolCapacity(const PoolCollection& pools,
     return (sum);
 }
 
+uint64_t
+Subnet::getFreePoolCapacity(Lease::Type type,
+                            const ClientClasses& client_classes) const {
+    const PoolCollection& pools = getPools(type);
+    uint64_t sum = 0;
+    for (PoolCollection::const_iterator p = pools.begin(); p != pools.end(); ++p) {
+        if ((*p)->isExhausted() || !(*p)->clientSupported(client_classes)) {
+            continue;
+        }
+        uint64_t x = (*p)->getCapacity();
+
+        // Check if we can add it. If sum + x > uint64::max, then we would have
+        // overflown if we tried to add it.
+        if (x > std::numeric_limits<uint64_t>::max() - sum) {
+            return (std::numeric_limits<uint64_t>::max());
+        }
+
+        sum += x;
+    }
+
+    return (sum);
+}
+
+void
+Subnet::setPoolsExhausted(Lease::Type type,
+                          const ClientClasses& client_classes) {
+    const PoolCollection& pools = getPools(type);
+    for (PoolCollection::const_iterator p = pools.begin(); p != pools.end(); ++p) {
+        if ((*p)->clientSupported(client_classes)) {
+            (*p)->setExhausted(true);
+        }
+    }
+}
+
+void
+Subnet::resetPoolExhausted(Lease::Type type, const IOAddress& addr) {
+    PoolPtr pool = getPool(type, addr, false);
+    if (pool) {
+        pool->setExhausted(false);
+    }
+}
+
+void
+Subnet::resetPoolsExhausted(Lease::Type type) {
+    const PoolCollection& pools = getPools(type);
+    for (PoolCollection::const_iterator p = pools.begin(); p != pools.end(); ++p) {
+        (*p)->setExhausted(false);
+    }
+}
+
 void Subnet4::checkType(Lease::Type type) const {
     if (type != Lease::TYPE_V4) {
         isc_throw(BadValue, "Only TYPE_V4 is allowed for Subnet4");
@@ -215,6 +215,43 @@ public:
     uint64_t getPoolCapacity(Lease::Type type,
                              const ClientClasses& client_classes) const;
 
+    /// @brief Returns the number of possible leases for specified lease type
+    /// allowed for a client which belongs to classes, excluding the pools
+    /// known to be exhausted.
+    ///
+    /// @param type type of the lease
+    /// @param client_classes List of classes the client belongs to.
+    uint64_t getFreePoolCapacity(Lease::Type type,
+                                 const ClientClasses& client_classes) const;
+
+    /// @brief Marks the pools allowed for a client exhausted.
+    ///
+    /// This is called by the allocation engine when it has walked over all
+    /// addresses of these pools without finding a free one. The exhausted
+    /// pools are skipped by the allocator and the subnets without free
+    /// pools are skipped when selecting a subnet within a shared network.
+    ///
+    /// @param type type of the lease
+    /// @param client_classes List of classes the client belongs to.
+    void setPoolsExhausted(Lease::Type type,
+                           const ClientClasses& client_classes);
+
+    /// @brief Clears the exhausted flag of the pool an address belongs to.
+    ///
+    /// This is called when a lease is released, reclaimed or deleted.
+    ///
+    /// @param type type of the lease
+    /// @param addr released, reclaimed or deleted address or prefix
+    void resetPoolExhausted(Lease::Type type,
+                            const isc::asiolink::IOAddress& addr);
+
+    /// @brief Clears the exhausted flags of all pools.
+    ///
+    /// This is called when all leases of the subnet are deleted.
+    ///
+    /// @param type type of the lease
+    void resetPoolsExhausted(Lease::Type type);
+
     /// @brief Returns textual representation of the subnet (e.g.
     /// "2001:db8::/64")
     ///
@@ -873,6 +873,94 @@ TEST_F(SharedNetworkAlloc4Test, runningOut) {
     EXPECT_FALSE(lease);
 }
 
+// This test verifies that the pools in which no free address was found
+// are marked exhausted and skipped until they are reset.
+TEST_F(SharedNetworkAlloc4Test, exhaustedPools) {
+    // Allocate everything in subnet1.
+    Lease4Ptr lease = insertLease("192.0.2.17", subnet1_->getID());
+
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress::IPV4_ZERO_ADDRESS(),
+            false, false, "host.example.com.", true);
+    ctx.query_.reset(new Pkt4(DHCPDISCOVER, 1234));
+
+    // The engine should have walked over the pool1 and marked it exhausted.
+    Lease4Ptr lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_TRUE(subnet2_->inPool(Lease::TYPE_V4, lease2->addr_));
+    EXPECT_TRUE(pool1_->isExhausted());
+    EXPECT_FALSE(pool2_->isExhausted());
+    EXPECT_EQ(0, subnet1_->getFreePoolCapacity(Lease::TYPE_V4,
+                                               ctx.query_->getClasses()));
+
+    // Remove the lease behind the engine's back. The subnet1 should not
+    // be probed because its pool is still marked exhausted.
+    ASSERT_TRUE(LeaseMgrFactory::instance().deleteLease(lease->addr_));
+    ctx.subnet_ = subnet1_;
+    lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_TRUE(subnet2_->inPool(Lease::TYPE_V4, lease2->addr_));
+
+    // This is what happens when the lease is released or reclaimed. The
+    // address should be offered again. The pool2 is marked exhausted to
+    // make sure that the engine doesn't stick to the recently used subnet2.
+    subnet1_->resetPoolExhausted(Lease::TYPE_V4, lease->addr_);
+    EXPECT_FALSE(pool1_->isExhausted());
+    subnet2_->setPoolsExhausted(Lease::TYPE_V4, ctx.query_->getClasses());
+    ctx.subnet_ = subnet1_;
+    lease2 = engine_.allocateLease4(ctx);
+    ASSERT_TRUE(lease2);
+    EXPECT_EQ("192.0.2.17", lease2->addr_.toText());
+}
+
+// This test verifies that the allocation failures are counted and that
+// no address is probed when all pools are known to be exhausted.
+TEST_F(SharedNetworkAlloc4Test, exhaustedPoolsFailure) {
+    // Returns the current value of a statistic or 0 if it doesn't exist.
+    auto getStat = [](const std::string& name) -> int64_t {
+        ObservationPtr stat = StatsMgr::instance().getObservation(name);
+        return (stat ? stat->getInteger().first : 0);
+    };
+    const std::string subnet_name =
+        StatsMgr::generateName("subnet", subnet1_->getID(),
+                               "v4-allocation-fail");
+    const int64_t fail = getStat("v4-allocation-fail");
+    const int64_t fail_exhausted = getStat("v4-allocation-fail-exhausted");
+    const int64_t fail_subnet = getStat(subnet_name);
+
+    // Allocate everything in both subnets.
+    insertLease("192.0.2.17", subnet1_->getID());
+    for (int i = 5; i <= 100; i++) {
+        stringstream tmp;
+        tmp << "10.1.2." << i;
+        insertLease(tmp.str(), subnet2_->getID());
+    }
+
+    AllocEngine::ClientContext4
+        ctx(subnet1_, ClientIdPtr(), hwaddr_, IOAddress::IPV4_ZERO_ADDRESS(),
+            false, false, "host.example.com.", true);
+    ctx.query_.reset(new Pkt4(DHCPDISCOVER, 1234));
+
+    // The first allocation walks over all pools and marks them exhausted.
+    EXPECT_FALSE(engine_.allocateLease4(ctx));
+    EXPECT_TRUE(pool1_->isExhausted());
+    EXPECT_TRUE(pool2_->isExhausted());
+    EXPECT_EQ(fail + 1, getStat("v4-allocation-fail"));
+    EXPECT_EQ(fail_exhausted, getStat("v4-allocation-fail-exhausted"));
+    EXPECT_EQ(fail_subnet + 1, getStat(subnet_name));
+
+    // The next allocations fail without probing any address. Free one
+    // address behind the engine's back to make sure it is not probed.
+    ASSERT_TRUE(LeaseMgrFactory::instance().deleteLease(IOAddress("10.1.2.50")));
+    for (int i = 0; i < 3; ++i) {
+        ctx.subnet_ = subnet1_;
+        EXPECT_FALSE(engine_.allocateLease4(ctx));
+    }
+    EXPECT_EQ(fail + 4, getStat("v4-allocation-fail"));
+    EXPECT_EQ(fail_exhausted + 3, getStat("v4-allocation-fail-exhausted"));
+    EXPECT_EQ(fail_subnet + 4, getStat(subnet_name));
+}
+
 // This test verifies that the server can offer an address from a
 // subnet and the introduction of shared network doesn't break anything here.
 TEST_F(SharedNetworkAlloc4Test, requestSharedNetworkSimple) {
@@ -136,6 +136,44 @@ TEST(CfgDbAccessTest, createLeaseMgr) {
     });
 }
 
+// Tests that the lease manager is reused when the lease database access
+// string hasn't changed and recreated otherwise.
+TEST(CfgDbAccessTest, updateLeaseMgr) {
+    CfgDbAccess current;
+    ASSERT_NO_THROW(current.setLeaseDbAccessString("type=memfile persist=false universe=4"));
+    ASSERT_NO_THROW(current.createManagers());
+    EXPECT_FALSE(current.isLeaseMgrReused());
+
+    // Add a lease which is only held in memory.
+    Lease4Ptr lease(new Lease4(asiolink::IOAddress("192.0.2.10"),
+                               HWAddrPtr(new HWAddr(HWAddr::fromText("01:02:03:04:05:06"))),
+                               ClientIdPtr(), 3600, 1000, 2000, time(0), 1));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(lease));
+
+    // The same parameters, so the lease manager should be reused along with
+    // the lease it holds.
+    CfgDbAccess same;
+    ASSERT_NO_THROW(same.setLeaseDbAccessString("type=memfile persist=false universe=4"));
+    ASSERT_NO_THROW(same.updateManagers(current));
+    EXPECT_TRUE(same.isLeaseMgrReused());
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(lease->addr_));
+
+    // Different parameters, so the lease manager should be recreated.
+    CfgDbAccess other;
+    ASSERT_NO_THROW(other.setLeaseDbAccessString("type=memfile persist=false universe=4 lfc-interval=0"));
+    ASSERT_NO_THROW(other.updateManagers(same));
+    EXPECT_FALSE(other.isLeaseMgrReused());
+    EXPECT_FALSE(LeaseMgrFactory::instance().getLease4(lease->addr_));
+
+    // The lease manager can't be reused if it doesn't exist.
+    LeaseMgrFactory::destroy();
+    ASSERT_NO_THROW(same.updateManagers(current));
+    EXPECT_FALSE(same.isLeaseMgrReused());
+    EXPECT_TRUE(LeaseMgrFactory::haveInstance());
+
+    LeaseMgrFactory::destroy();
+}
+
 // The following tests require MySQL enabled.
 #if defined HAVE_MYSQL
 
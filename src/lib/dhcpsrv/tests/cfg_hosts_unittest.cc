@@ -274,6 +274,64 @@ TEST_F(CfgHostsTest, get4) {
     }
 }
 
+// This test checks that the reservations can be retrieved for the host
+// which has reservations for the same address in many subnets.
+TEST_F(CfgHostsTest, get4ManySubnets) {
+    CfgHosts cfg;
+    // Add hosts using the same HW address and the same IPv4 address in
+    // all subnets.
+    for (unsigned i = 0; i < 25; ++i) {
+        cfg.add(HostPtr(new Host(hwaddrs_[0]->toText(false), "hw-address",
+                                 SubnetID(1 + i), SubnetID(100 + i),
+                                 IOAddress("192.0.2.5"))));
+    }
+
+    for (unsigned i = 0; i < 25; ++i) {
+        // Retrieve host by HW address within the IPv4 subnet.
+        ConstHostPtr host = cfg.get4(SubnetID(1 + i), Host::IDENT_HWADDR,
+                                     &hwaddrs_[0]->hwaddr_[0],
+                                     hwaddrs_[0]->hwaddr_.size());
+        ASSERT_TRUE(host);
+        EXPECT_EQ(1 + i, host->getIPv4SubnetID());
+
+        // Retrieve host by HW address within the IPv6 subnet.
+        host = cfg.get6(SubnetID(100 + i), Host::IDENT_HWADDR,
+                        &hwaddrs_[0]->hwaddr_[0], hwaddrs_[0]->hwaddr_.size());
+        ASSERT_TRUE(host);
+        EXPECT_EQ(1 + i, host->getIPv4SubnetID());
+
+        // Retrieve host by reserved address.
+        host = cfg.get4(SubnetID(1 + i), IOAddress("192.0.2.5"));
+        ASSERT_TRUE(host);
+        EXPECT_EQ(1 + i, host->getIPv4SubnetID());
+    }
+
+    // There are no reservations in other subnets.
+    EXPECT_FALSE(cfg.get4(SubnetID(26), Host::IDENT_HWADDR,
+                          &hwaddrs_[0]->hwaddr_[0],
+                          hwaddrs_[0]->hwaddr_.size()));
+    EXPECT_FALSE(cfg.get4(SubnetID(26), IOAddress("192.0.2.5")));
+    EXPECT_FALSE(cfg.get4(SubnetID(1), IOAddress("192.0.2.6")));
+
+    // The duplicates are detected in any of the subnets.
+    EXPECT_THROW(cfg.add(HostPtr(new Host(hwaddrs_[0]->toText(false),
+                                          "hw-address", SubnetID(13),
+                                          SUBNET_ID_UNUSED,
+                                          IOAddress("192.0.2.6")))),
+                 DuplicateHost);
+    EXPECT_THROW(cfg.add(HostPtr(new Host(hwaddrs_[1]->toText(false),
+                                          "hw-address", SubnetID(13),
+                                          SUBNET_ID_UNUSED,
+                                          IOAddress("192.0.2.5")))),
+                 ReservedAddress);
+
+    // Deleting the host in one subnet leaves the hosts in other subnets.
+    EXPECT_TRUE(cfg.del(SubnetID(13), IOAddress("192.0.2.5")));
+    EXPECT_FALSE(cfg.get4(SubnetID(13), IOAddress("192.0.2.5")));
+    EXPECT_TRUE(cfg.get4(SubnetID(14), IOAddress("192.0.2.5")));
+    EXPECT_EQ(24, cfg.getAll4(IOAddress("192.0.2.5")).size());
+}
+
 // This test checks that the DHCPv4 reservations can be unparsed
 TEST_F(CfgHostsTest, unparsed4) {
     CfgMgr::instance().setFamily(AF_INET);
@@ -594,6 +652,90 @@ TEST_F(CfgHostsTest, get6MultipleAddrs) {
     }
 }
 
+// This test checks that the IPv4 hosts can be deleted by identifier and
+// by reserved address.
+TEST_F(CfgHostsTest, del4) {
+    CfgHosts cfg;
+    for (unsigned i = 0; i < 10; ++i) {
+        cfg.add(HostPtr(new Host(hwaddrs_[i]->toText(false), "hw-address",
+                                 SubnetID(1 + i % 2), SUBNET_ID_UNUSED,
+                                 increase(IOAddress("192.0.2.5"), i))));
+    }
+
+    // The host doesn't belong to subnet 2.
+    EXPECT_FALSE(cfg.del4(SubnetID(2), Host::IDENT_HWADDR,
+                          &hwaddrs_[0]->hwaddr_[0], hwaddrs_[0]->hwaddr_.size()));
+    EXPECT_TRUE(cfg.del4(SubnetID(1), Host::IDENT_HWADDR,
+                         &hwaddrs_[0]->hwaddr_[0], hwaddrs_[0]->hwaddr_.size()));
+    EXPECT_FALSE(cfg.get4(SubnetID(1), Host::IDENT_HWADDR,
+                          &hwaddrs_[0]->hwaddr_[0], hwaddrs_[0]->hwaddr_.size()));
+    EXPECT_FALSE(cfg.get4(SubnetID(1), IOAddress("192.0.2.5")));
+
+    // Delete the host by address.
+    EXPECT_FALSE(cfg.del(SubnetID(1), IOAddress("192.0.2.6")));
+    EXPECT_TRUE(cfg.del(SubnetID(2), IOAddress("192.0.2.6")));
+    EXPECT_FALSE(cfg.get4(SubnetID(2), Host::IDENT_HWADDR,
+                          &hwaddrs_[1]->hwaddr_[0], hwaddrs_[1]->hwaddr_.size()));
+
+    // Other hosts are still there.
+    for (unsigned i = 2; i < 10; ++i) {
+        EXPECT_TRUE(cfg.get4(SubnetID(1 + i % 2), Host::IDENT_HWADDR,
+                             &hwaddrs_[i]->hwaddr_[0],
+                             hwaddrs_[i]->hwaddr_.size()));
+    }
+
+    // Delete all hosts from subnet 1.
+    EXPECT_EQ(4, cfg.delAll4(SubnetID(1)));
+    EXPECT_EQ(0, cfg.delAll4(SubnetID(1)));
+    EXPECT_EQ(4, cfg.delAll4(SubnetID(2)));
+}
+
+// This test checks that the IPv6 hosts are deleted along with their
+// IPv6 reservations.
+TEST_F(CfgHostsTest, del6) {
+    CfgHosts cfg;
+    for (unsigned i = 0; i < 10; ++i) {
+        HostPtr host = HostPtr(new Host(duids_[i]->toText(), "duid",
+                                        SUBNET_ID_UNUSED, SubnetID(1 + i % 2),
+                                        IOAddress("0.0.0.0")));
+        host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                       increase(IOAddress("2001:db8:1::1"), i)));
+        host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_PD,
+                                       increase(IOAddress("3000::"), i), 64));
+        cfg.add(host);
+    }
+
+    EXPECT_FALSE(cfg.del6(SubnetID(2), Host::IDENT_DUID,
+                          &duids_[0]->getDuid()[0], duids_[0]->getDuid().size()));
+    EXPECT_TRUE(cfg.del6(SubnetID(1), Host::IDENT_DUID,
+                         &duids_[0]->getDuid()[0], duids_[0]->getDuid().size()));
+    EXPECT_FALSE(cfg.get6(SubnetID(1), IOAddress("2001:db8:1::1")));
+    EXPECT_FALSE(cfg.get6(SubnetID(1), IOAddress("3000::")));
+
+    // Delete the host by delegated prefix.
+    EXPECT_TRUE(cfg.del(SubnetID(2), increase(IOAddress("3000::"), 1)));
+    EXPECT_FALSE(cfg.get6(SubnetID(2), Host::IDENT_DUID,
+                          &duids_[1]->getDuid()[0], duids_[1]->getDuid().size()));
+    EXPECT_FALSE(cfg.get6(SubnetID(2), increase(IOAddress("2001:db8:1::1"), 1)));
+
+    // The reservations of the deleted host can be reused.
+    HostPtr host = HostPtr(new Host(duids_[20]->toText(), "duid",
+                                    SUBNET_ID_UNUSED, SubnetID(1),
+                                    IOAddress("0.0.0.0")));
+    host->addReservation(IPv6Resrv(IPv6Resrv::TYPE_NA,
+                                   IOAddress("2001:db8:1::1")));
+    EXPECT_NO_THROW(cfg.add(host));
+
+    // Delete all hosts from subnet 2.
+    EXPECT_EQ(4, cfg.delAll6(SubnetID(2)));
+    for (unsigned i = 2; i < 10; ++i) {
+        EXPECT_EQ(i % 2 == 0,
+                  static_cast<bool>(cfg.get6(SubnetID(1 + i % 2),
+                                             increase(IOAddress("2001:db8:1::1"),
+                                                      i))));
+    }
+}
+
 
 // Checks that it's not possible for a second host to reserve an address
 // which is already reserved.
@@ -0,0 +1,119 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <dhcp/option_space.h>
+#include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/cfg_option_list_cache.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Creates a DHCPv4 option with a single byte of data.
+///
+/// @param code Option code.
+/// @param value Option data.
+OptionPtr createOption(const uint16_t code, const uint8_t value) {
+    return (OptionPtr(new Option(Option::V4, code, OptionBuffer(1, value))));
+}
+
+// This test verifies that the options are resolved according to the
+// precedence of the option configurations.
+TEST(ResolvedOptionsTest, precedence) {
+    CfgOptionPtr subnet_cfg(new CfgOption());
+    CfgOptionPtr global_cfg(new CfgOption());
+
+    OptionPtr subnet_routers = createOption(DHO_ROUTERS, 1);
+    OptionPtr global_routers = createOption(DHO_ROUTERS, 2);
+    OptionPtr global_domain = createOption(DHO_DOMAIN_NAME, 3);
+    OptionPtr global_ntp = createOption(DHO_NTP_SERVERS, 4);
+
+    ASSERT_NO_THROW(subnet_cfg->add(subnet_routers, false, DHCP4_OPTION_SPACE));
+    ASSERT_NO_THROW(global_cfg->add(global_routers, false, DHCP4_OPTION_SPACE));
+    ASSERT_NO_THROW(global_cfg->add(global_domain, true, DHCP4_OPTION_SPACE));
+    ASSERT_NO_THROW(global_cfg->add(global_ntp, false, DHCP4_OPTION_SPACE));
+
+    CfgOptionList co_list;
+    co_list.push_back(subnet_cfg);
+    co_list.push_back(global_cfg);
+
+    ResolvedOptions resolved(DHCP4_OPTION_SPACE, co_list);
+
+    // The subnet level option takes precedence.
+    EXPECT_TRUE(subnet_routers == resolved.get(DHO_ROUTERS));
+    EXPECT_TRUE(global_domain == resolved.get(DHO_DOMAIN_NAME));
+    EXPECT_TRUE(global_ntp == resolved.get(DHO_NTP_SERVERS));
+    EXPECT_FALSE(resolved.get(DHO_TIME_SERVERS));
+
+    // Only the domain name is always sent.
+    ASSERT_EQ(1, resolved.getPersistentCodes().size());
+    EXPECT_EQ(DHO_DOMAIN_NAME, resolved.getPersistentCodes()[0]);
+
+    // Options from other option spaces are not resolved.
+    ResolvedOptions other("foo", co_list);
+    EXPECT_FALSE(other.get(DHO_ROUTERS));
+}
+
+// This test verifies that the resolved options are cached per list
+// of option configurations.
+TEST(CfgOptionListCacheTest, get) {
+    CfgOptionPtr subnet_cfg(new CfgOption());
+    CfgOptionPtr class_cfg(new CfgOption());
+    CfgOptionPtr global_cfg(new CfgOption());
+
+    ASSERT_NO_THROW(subnet_cfg->add(createOption(DHO_ROUTERS, 1), false,
+                                    DHCP4_OPTION_SPACE));
+    ASSERT_NO_THROW(class_cfg->add(createOption(DHO_ROUTERS, 2), false,
+                                   DHCP4_OPTION_SPACE));
+
+    CfgOptionList subnet_list;
+    subnet_list.push_back(subnet_cfg);
+    subnet_list.push_back(global_cfg);
+
+    CfgOptionList class_list;
+    class_list.push_back(class_cfg);
+    class_list.push_back(subnet_cfg);
+    class_list.push_back(global_cfg);
+
+    CfgOptionListCache cache;
+    ConstResolvedOptionsPtr resolved = cache.get(DHCP4_OPTION_SPACE, subnet_list);
+    ASSERT_TRUE(resolved);
+    EXPECT_EQ(1, cache.size());
+    EXPECT_EQ(1, resolved->get(DHO_ROUTERS)->getUint8());
+
+    // The same list returns the cached entry.
+    EXPECT_TRUE(resolved == cache.get(DHCP4_OPTION_SPACE, subnet_list));
+    EXPECT_EQ(1, cache.size());
+
+    // Different list creates a new entry.
+    ConstResolvedOptionsPtr class_resolved = cache.get(DHCP4_OPTION_SPACE,
+                                                       class_list);
+    ASSERT_TRUE(class_resolved);
+    EXPECT_EQ(2, cache.size());
+    EXPECT_EQ(2, class_resolved->get(DHO_ROUTERS)->getUint8());
+
+    cache.clear();
+    EXPECT_EQ(0, cache.size());
+}
+
+// This test verifies that the cache is cleared when it reaches the
+// maximum size.
+TEST(CfgOptionListCacheTest, maxSize) {
+    CfgOptionListCache cache(2);
+    CfgOptionList co_list;
+    for (unsigned i = 0; i < 3; ++i) {
+        co_list.push_back(CfgOptionPtr(new CfgOption()));
+        ASSERT_TRUE(cache.get(DHCP4_OPTION_SPACE, co_list));
+    }
+    EXPECT_EQ(1, cache.size());
+}
+
+} // end of anonymous namespace
@@ -107,6 +107,71 @@ TEST(CfgSubnets4Test, deleteSubnet) {
     EXPECT_FALSE(cfg.getByPrefix("192.0.3.0/26"));
 }
 
+// This test verifies that the subnet can be replaced in place.
+TEST(CfgSubnets4Test, replaceSubnet) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"),
+                                   26, 1, 2, 3, SubnetID(5)));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.3.0"),
+                                   26, 1, 2, 3, SubnetID(8)));
+    ASSERT_NO_THROW(cfg.add(subnet1));
+    ASSERT_NO_THROW(cfg.add(subnet2));
+
+    // Replace the subnet #5 with the subnet having different prefix.
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.0.4.0"),
+                                   26, 1, 2, 3, SubnetID(5)));
+    Subnet4Ptr replaced;
+    ASSERT_NO_THROW(replaced = cfg.replace(subnet3));
+    EXPECT_EQ(subnet1, replaced);
+    ASSERT_EQ(2, cfg.getAll()->size());
+    EXPECT_EQ(subnet3, cfg.getAll()->front());
+    EXPECT_EQ(subnet3, cfg.getSubnet(SubnetID(5)));
+    EXPECT_EQ(subnet3, cfg.getByPrefix("192.0.4.0/26"));
+    EXPECT_FALSE(cfg.getByPrefix("192.0.2.0/26"));
+
+    // The subnet having the identifier of the new subnet must exist.
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.0.5.0"),
+                                   26, 1, 2, 3, SubnetID(10)));
+    EXPECT_THROW(cfg.replace(subnet4), BadValue);
+
+    // The prefix must not be used by other subnet.
+    Subnet4Ptr subnet5(new Subnet4(IOAddress("192.0.3.0"),
+                                   26, 1, 2, 3, SubnetID(5)));
+    EXPECT_THROW(cfg.replace(subnet5), DuplicateSubnetID);
+    EXPECT_EQ(subnet3, cfg.getSubnet(SubnetID(5)));
+}
+
+// This test verifies that the exhausted flag of the pool holding an
+// address of a deleted lease is cleared.
+TEST(CfgSubnets4Test, resetPoolExhausted) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"),
+                                   26, 1, 2, 3, SubnetID(5)));
+    Pool4Ptr pool1(new Pool4(IOAddress("192.0.2.10"), IOAddress("192.0.2.20")));
+    subnet1->addPool(pool1);
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.3.0"),
+                                   26, 1, 2, 3, SubnetID(8)));
+    Pool4Ptr pool2(new Pool4(IOAddress("192.0.3.10"), IOAddress("192.0.3.20")));
+    subnet2->addPool(pool2);
+    ASSERT_NO_THROW(cfg.add(subnet1));
+    ASSERT_NO_THROW(cfg.add(subnet2));
+
+    pool1->setExhausted(true);
+    pool2->setExhausted(true);
+
+    // Addresses outside of the pools don't change anything.
+    cfg.resetPoolExhausted(IOAddress("192.0.2.30"));
+    cfg.resetPoolExhausted(IOAddress("10.0.0.1"));
+    EXPECT_TRUE(pool1->isExhausted());
+    EXPECT_TRUE(pool2->isExhausted());
+
+    cfg.resetPoolExhausted(IOAddress("192.0.3.15"));
+    EXPECT_TRUE(pool1->isExhausted());
+    EXPECT_FALSE(pool2->isExhausted());
+}
+
 // This test verifies that it is possible to retrieve a subnet using an
 // IP address.
 TEST(CfgSubnets4Test, selectSubnetByCiaddr) {
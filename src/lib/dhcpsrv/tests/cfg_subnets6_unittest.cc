@@ -108,6 +108,41 @@ TEST(CfgSubnets6Test, deleteSubnet) {
     EXPECT_FALSE(cfg.getByPrefix("2001:db8:2::/48"));
 }
 
+// This test verifies that the subnet can be replaced in place.
+TEST(CfgSubnets6Test, replaceSubnet) {
+    CfgSubnets6 cfg;
+
+    Subnet6Ptr subnet1(new Subnet6(IOAddress("2001:db8:1::"), 48, 1, 2, 3, 4,
+                                   SubnetID(5)));
+    Subnet6Ptr subnet2(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4,
+                                   SubnetID(8)));
+    ASSERT_NO_THROW(cfg.add(subnet1));
+    ASSERT_NO_THROW(cfg.add(subnet2));
+
+    // Replace the subnet #5 with the subnet having different prefix.
+    Subnet6Ptr subnet3(new Subnet6(IOAddress("2001:db8:3::"), 48, 1, 2, 3, 4,
+                                   SubnetID(5)));
+    Subnet6Ptr replaced;
+    ASSERT_NO_THROW(replaced = cfg.replace(subnet3));
+    EXPECT_EQ(subnet1, replaced);
+    ASSERT_EQ(2, cfg.getAll()->size());
+    EXPECT_EQ(subnet3, cfg.getAll()->front());
+    EXPECT_EQ(subnet3, cfg.getSubnet(SubnetID(5)));
+    EXPECT_EQ(subnet3, cfg.getByPrefix("2001:db8:3::/48"));
+    EXPECT_FALSE(cfg.getByPrefix("2001:db8:1::/48"));
+
+    // The subnet having the identifier of the new subnet must exist.
+    Subnet6Ptr subnet4(new Subnet6(IOAddress("2001:db8:4::"), 48, 1, 2, 3, 4,
+                                   SubnetID(10)));
+    EXPECT_THROW(cfg.replace(subnet4), BadValue);
+
+    // The prefix must not be used by other subnet.
+    Subnet6Ptr subnet5(new Subnet6(IOAddress("2001:db8:2::"), 48, 1, 2, 3, 4,
+                                   SubnetID(5)));
+    EXPECT_THROW(cfg.replace(subnet5), DuplicateSubnetID);
+    EXPECT_EQ(subnet3, cfg.getSubnet(SubnetID(5)));
+}
+
 // This test checks that the subnet can be selected using a relay agent's
 // link address.
 TEST(CfgSubnets6Test, selectSubnetByRelayAddress) {
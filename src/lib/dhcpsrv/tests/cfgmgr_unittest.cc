@@ -558,6 +558,64 @@ TEST_F(CfgMgrTest, commitStats4) {
     EXPECT_EQ(128, total_addrs->getInteger().first);
 }
 
+// This test verifies that the leases are only recounted for the added
+// subnets when the lease manager has been reused.
+TEST_F(CfgMgrTest, commitStatsIncremental4) {
+    CfgMgr& cfg_mgr = CfgMgr::instance();
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    const std::string access = "type=memfile persist=false universe=4";
+
+    // Let's prepare the "old" configuration: two subnets with a pool each
+    // and pretend there were addresses assigned, so statistics are non-zero.
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3, 123));
+    subnet1->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 25)));
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet1);
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.1.3.0"), 24, 1, 2, 3, 124));
+    subnet2->addPool(PoolPtr(new Pool4(IOAddress("192.1.3.0"), 25)));
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet2);
+    CfgDbAccessPtr cfg_db = cfg_mgr.getStagingCfg()->getCfgDbAccess();
+    cfg_db->setLeaseDbAccessString(access);
+    ASSERT_NO_THROW(cfg_db->createManagers());
+    cfg_mgr.commit();
+    stats_mgr.setValue("subnet[123].assigned-addresses", static_cast<int64_t>(100));
+    stats_mgr.setValue("subnet[124].assigned-addresses", static_cast<int64_t>(50));
+
+    // The new configuration changes the pool of the first subnet, removes
+    // the second one and adds a new subnet. The lease manager is reused.
+    Subnet4Ptr subnet3(new Subnet4(IOAddress("192.1.2.0"), 24, 4, 5, 6, 123));
+    subnet3->addPool(PoolPtr(new Pool4(IOAddress("192.1.2.0"), 26)));
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet3);
+    Subnet4Ptr subnet4(new Subnet4(IOAddress("192.1.4.0"), 24, 4, 5, 6, 125));
+    subnet4->addPool(PoolPtr(new Pool4(IOAddress("192.1.4.0"), 25)));
+    cfg_mgr.getStagingCfg()->getCfgSubnets4()->add(subnet4);
+    cfg_db = cfg_mgr.getStagingCfg()->getCfgDbAccess();
+    cfg_db->setLeaseDbAccessString(access);
+    ASSERT_NO_THROW(cfg_db->updateManagers(*cfg_mgr.getCurrentCfg()->getCfgDbAccess()));
+    ASSERT_TRUE(cfg_db->isLeaseMgrReused());
+    cfg_mgr.commit();
+
+    // The leases of the kept subnet are not recounted but its total
+    // is updated.
+    ObservationPtr assigned = stats_mgr.getObservation("subnet[123].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(100, assigned->getInteger().first);
+    ObservationPtr total = stats_mgr.getObservation("subnet[123].total-addresses");
+    ASSERT_TRUE(total);
+    EXPECT_EQ(64, total->getInteger().first);
+
+    // The statistics of the removed subnet are gone.
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[124].assigned-addresses"));
+    EXPECT_FALSE(stats_mgr.getObservation("subnet[124].total-addresses"));
+
+    // The leases of the new subnet have been counted.
+    assigned = stats_mgr.getObservation("subnet[125].assigned-addresses");
+    ASSERT_TRUE(assigned);
+    EXPECT_EQ(0, assigned->getInteger().first);
+    total = stats_mgr.getObservation("subnet[125].total-addresses");
+    ASSERT_TRUE(total);
+    EXPECT_EQ(128, total->getInteger().first);
+}
+
 // This test verifies that once the configuration is cleared, the statistics
 // are removed.
 TEST_F(CfgMgrTest, clearStats4) {
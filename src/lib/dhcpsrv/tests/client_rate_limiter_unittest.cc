@@ -0,0 +1,247 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/option.h>
+#include <dhcpsrv/client_rate_limiter.h>
+#include <gtest/gtest.h>
+#include <chrono>
+#include <stdint.h>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Test fixture class for @c ClientRateLimiter.
+class ClientRateLimiterTest : public ::testing::Test {
+protected:
+
+    /// @brief Constructor.
+    ClientRateLimiterTest()
+        : cfg_(new CfgRateLimit()), now_(ClientRateLimiter::Time::clock::now()) {
+    }
+
+    /// @brief Creates a DHCPDISCOVER from a client.
+    ///
+    /// @param client Last byte of the hardware address of the client.
+    /// @param xid Transaction id.
+    /// @param giaddr Relay agent address.
+    Pkt4Ptr createQuery(const uint8_t client, const uint32_t xid = 1234,
+                        const std::string& giaddr = "0.0.0.0") const {
+        Pkt4Ptr query(new Pkt4(DHCPDISCOVER, xid));
+        std::vector<uint8_t> mac(6, 0);
+        mac[5] = client;
+        query->setHWAddr(HTYPE_ETHER, mac.size(), mac);
+        query->setGiaddr(IOAddress(giaddr));
+        return (query);
+    }
+
+    /// @brief Returns the time after the given number of milliseconds.
+    ClientRateLimiter::Time after(const int ms) const {
+        return (now_ + std::chrono::milliseconds(ms));
+    }
+
+    /// @brief Configuration used by the tests.
+    CfgRateLimitPtr cfg_;
+
+    /// @brief Reference time.
+    ClientRateLimiter::Time now_;
+
+    /// @brief Limiter under test.
+    ClientRateLimiter limiter_;
+};
+
+// This test verifies that nothing is dropped by default.
+TEST_F(ClientRateLimiterTest, disabled) {
+    Pkt4Ptr query = createQuery(1);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, now_));
+    }
+
+    limiter_.configure(cfg_);
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, now_));
+    }
+    EXPECT_EQ(0, limiter_.getClientCount());
+}
+
+// This test verifies that a client is limited to its burst and then to
+// its rate, and that the other clients are not affected.
+TEST_F(ClientRateLimiterTest, clientRate) {
+    cfg_->setClientRate(2);
+    cfg_->setClientBurst(3);
+    limiter_.configure(cfg_);
+
+    Pkt4Ptr query = createQuery(1);
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, now_));
+    }
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE, limiter_.accept(query, now_));
+
+    // Another client has its own bucket.
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(2), now_));
+
+    // A token is added every 500ms.
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(query, after(400)));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, after(500)));
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(query, after(500)));
+
+    // The bucket doesn't hold more than the burst.
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(ClientRateLimiter::ACCEPT,
+                  limiter_.accept(query, after(10000)));
+    }
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(query, after(10000)));
+    EXPECT_EQ(2, limiter_.getClientCount());
+}
+
+// This test verifies that the client identifier takes precedence over
+// the hardware address to identify the clients.
+TEST_F(ClientRateLimiterTest, clientId) {
+    cfg_->setClientRate(1);
+    limiter_.configure(cfg_);
+
+    std::vector<uint8_t> id(4, 7);
+    OptionPtr client_id(new Option(Option::V4, DHO_DHCP_CLIENT_IDENTIFIER,
+                                   id));
+    Pkt4Ptr query1 = createQuery(1);
+    query1->addOption(client_id);
+    Pkt4Ptr query2 = createQuery(2);
+    query2->addOption(client_id);
+
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query1, now_));
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(query2, now_));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(2), now_));
+}
+
+// This test verifies that the packets forwarded by a relay are limited.
+TEST_F(ClientRateLimiterTest, relayRate) {
+    cfg_->setRelayRate(2);
+    limiter_.configure(cfg_);
+
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(1, 1, "10.0.0.1"), now_));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(2, 1, "10.0.0.1"), now_));
+    EXPECT_EQ(ClientRateLimiter::DROP_RELAY_RATE,
+              limiter_.accept(createQuery(3, 1, "10.0.0.1"), now_));
+
+    // Other relays and the directly connected clients are not affected.
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(3, 1, "10.0.0.2"), now_));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(3), now_));
+
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(3, 1, "10.0.0.1"), after(500)));
+    EXPECT_EQ(2, limiter_.getRelayCount());
+}
+
+// This test verifies that the retransmissions of a parked packet are
+// dropped until it is unparked or for at most the parking timeout.
+TEST_F(ClientRateLimiterTest, dropDuplicates) {
+    cfg_->setDropDuplicates(true);
+    limiter_.configure(cfg_);
+
+    Pkt4Ptr query = createQuery(1, 1234);
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, now_));
+    limiter_.park(query, std::chrono::milliseconds(4000), now_);
+
+    // The retransmission is dropped, a new transaction is not.
+    EXPECT_EQ(ClientRateLimiter::DROP_DUPLICATE,
+              limiter_.accept(createQuery(1, 1234), after(1000)));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(1, 4321), after(1000)));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(2, 1234), after(1000)));
+
+    limiter_.unpark(query);
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(1, 1234), after(1000)));
+
+    // A packet which is never unparked stops suppressing the
+    // retransmissions after the parking timeout.
+    limiter_.park(query, std::chrono::milliseconds(4000), now_);
+    EXPECT_EQ(ClientRateLimiter::DROP_DUPLICATE,
+              limiter_.accept(query, after(3999)));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, after(4000)));
+
+    // Without a parking timeout the retransmissions are dropped until
+    // the packet is unparked.
+    limiter_.park(query, std::chrono::milliseconds(0), now_);
+    EXPECT_EQ(ClientRateLimiter::DROP_DUPLICATE,
+              limiter_.accept(query, after(3600000)));
+    limiter_.unpark(query);
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, after(3600000)));
+}
+
+// This test verifies that the number of tracked clients is bounded and
+// that the idle clients are purged to make room for the new ones.
+TEST_F(ClientRateLimiterTest, maxClients) {
+    cfg_->setClientRate(1);
+    cfg_->setMaxClients(2);
+    limiter_.configure(cfg_);
+
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(1), now_));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(2), now_));
+
+    // The table is full, the new client is accepted but not tracked.
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(3), now_));
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(createQuery(3), now_));
+    EXPECT_EQ(2, limiter_.getClientCount());
+
+    // The tracked clients are still limited.
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(createQuery(1), now_));
+
+    // Once the buckets of the tracked clients are full, they are purged.
+    EXPECT_EQ(ClientRateLimiter::ACCEPT,
+              limiter_.accept(createQuery(3), after(2000)));
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(createQuery(3), after(2000)));
+    EXPECT_EQ(1, limiter_.getClientCount());
+}
+
+// This test verifies that the tracked clients are forgotten when the
+// configuration changes.
+TEST_F(ClientRateLimiterTest, reconfigure) {
+    cfg_->setClientRate(1);
+    limiter_.configure(cfg_);
+
+    Pkt4Ptr query = createQuery(1);
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, now_));
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(query, now_));
+
+    // Configuring the same object retains the state.
+    limiter_.configure(cfg_);
+    EXPECT_EQ(1, limiter_.getClientCount());
+
+    // Configuring a copy holding the same values retains the state too.
+    CfgRateLimitPtr cfg(new CfgRateLimit(*cfg_));
+    limiter_.configure(cfg);
+    EXPECT_EQ(1, limiter_.getClientCount());
+    EXPECT_EQ(ClientRateLimiter::DROP_CLIENT_RATE,
+              limiter_.accept(query, now_));
+
+    // Changing the limits resets the state.
+    cfg.reset(new CfgRateLimit(*cfg_));
+    cfg->setClientBurst(2);
+    limiter_.configure(cfg);
+    EXPECT_EQ(0, limiter_.getClientCount());
+    EXPECT_EQ(ClientRateLimiter::ACCEPT, limiter_.accept(query, now_));
+}
+
+}
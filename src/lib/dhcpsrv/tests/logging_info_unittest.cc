@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2015,2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2015,2017-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -188,4 +188,42 @@ TEST_F(LoggingInfoTest, equalityOperators) {
 
 }
 
+// Checks that the asynchronous output parameters are compared, unparsed
+// and passed to the logging library.
+TEST_F(LoggingInfoTest, asyncDestination) {
+    LoggingDestination dest1;
+    LoggingDestination dest2;
+    EXPECT_FALSE(dest1.async_);
+    EXPECT_EQ(4096, dest1.queue_size_);
+    EXPECT_EQ("drop", dest1.overflow_policy_);
+
+    dest1.async_ = true;
+    EXPECT_FALSE(dest1.equals(dest2));
+    dest2.async_ = true;
+    EXPECT_TRUE(dest1.equals(dest2));
+    dest1.queue_size_ = 100;
+    EXPECT_FALSE(dest1.equals(dest2));
+    dest2.queue_size_ = 100;
+    dest1.overflow_policy_ = "block";
+    EXPECT_FALSE(dest1.equals(dest2));
+    dest2.overflow_policy_ = "block";
+    EXPECT_TRUE(dest1.equals(dest2));
+
+    std::string expected =
+        "{ \"output\": \"stdout\", \"maxsize\": 10240000,\n"
+        " \"maxver\": 1, \"flush\": true, \"async\": true,\n"
+        " \"queue-size\": 100, \"overflow-policy\": \"block\" }";
+    runToElementTest<LoggingDestination>(expected, dest1);
+
+    LoggingInfo info;
+    info.clearDestinations();
+    info.destinations_.push_back(dest1);
+    isc::log::LoggerSpecification spec = info.toSpec();
+    ASSERT_EQ(1, spec.optionCount());
+    EXPECT_TRUE(spec.begin()->async);
+    EXPECT_EQ(100, spec.begin()->queue_size);
+    EXPECT_EQ(isc::log::OutputOption::OVERFLOW_BLOCK,
+              spec.begin()->overflow);
+}
+
 } // end of anonymous namespace
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -338,6 +338,84 @@ TEST_F(LoggingTest, logRotate) {
     wipeFiles();
 }
 
+// Checks that the asynchronous output parameters are parsed.
+TEST_F(LoggingTest, parsingAsyncOutput) {
+
+    const char* config_txt =
+    "{ \"loggers\": ["
+    "    {"
+    "        \"name\": \"kea\","
+    "        \"output_options\": ["
+    "            {"
+    "                \"output\": \"logfile.txt\","
+    "                \"async\": true,"
+    "                \"queue-size\": 1000,"
+    "                \"overflow-policy\": \"block\""
+    "            },"
+    "            {"
+    "                \"output\": \"stdout\""
+    "            }"
+    "        ],"
+    "        \"severity\": \"INFO\""
+    "    }"
+    "]}";
+
+    SrvConfigPtr storage(new SrvConfig());
+
+    LogConfigParser parser(storage);
+
+    ConstElementPtr config = Element::fromJSON(config_txt);
+    config = config->get("loggers");
+
+    EXPECT_NO_THROW(parser.parseConfiguration(config));
+
+    ASSERT_EQ(1, storage->getLoggingInfo().size());
+    ASSERT_EQ(2, storage->getLoggingInfo()[0].destinations_.size());
+
+    const LoggingDestination& async_dest =
+        storage->getLoggingInfo()[0].destinations_[0];
+    EXPECT_TRUE(async_dest.async_);
+    EXPECT_EQ(1000, async_dest.queue_size_);
+    EXPECT_EQ("block", async_dest.overflow_policy_);
+
+    // Output is synchronous by default
+    const LoggingDestination& sync_dest =
+        storage->getLoggingInfo()[0].destinations_[1];
+    EXPECT_FALSE(sync_dest.async_);
+    EXPECT_EQ(4096, sync_dest.queue_size_);
+    EXPECT_EQ("drop", sync_dest.overflow_policy_);
+}
+
+// Checks that invalid asynchronous output parameters are rejected.
+TEST_F(LoggingTest, parsingAsyncOutputInvalid) {
+    const char* bad_options[] = {
+        "\"queue-size\": 0",
+        "\"queue-size\": -1",
+        "\"queue-size\": 5000000000",
+        "\"overflow-policy\": \"wait\""
+    };
+
+    for (size_t i = 0; i < sizeof(bad_options) / sizeof(bad_options[0]); ++i) {
+        std::string config_txt =
+            "{ \"loggers\": [ {"
+            "    \"name\": \"kea\","
+            "    \"output_options\": [ {"
+            "        \"output\": \"stdout\","
+            "        \"async\": true, " + std::string(bad_options[i]) +
+            "    } ],"
+            "    \"severity\": \"INFO\""
+            "} ] }";
+
+        SrvConfigPtr storage(new SrvConfig());
+        LogConfigParser parser(storage);
+        ConstElementPtr config = Element::fromJSON(config_txt);
+        config = config->get("loggers");
+
+        EXPECT_THROW(parser.parseConfiguration(config), BadValue)
+            << "option: " << bad_options[i];
+    }
+}
+
 /// @todo Add tests for malformed logging configuration
 
 /// @todo There is no easy way to test applyConfiguration() and defaultLogging().
@@ -0,0 +1,101 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcp/dhcp4.h>
+#include <dhcp/pkt4.h>
+#include <dhcpsrv/pkt_latency_stats.h>
+#include <stats/stats_mgr.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Test fixture class for @c PktLatencyStats.
+class PktLatencyStatsTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    PktLatencyStatsTest()
+        : query_(new Pkt4(DHCPDISCOVER, 1234)) {
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Destructor.
+    virtual ~PktLatencyStatsTest() {
+        StatsMgr::instance().removeAll();
+    }
+
+    /// @brief Query used in the tests.
+    Pkt4Ptr query_;
+};
+
+// This test verifies that the phases of the accepted packets are recorded
+// and published.
+TEST_F(PktLatencyStatsTest, record) {
+    PktLatencyStats latency("pkt4", 0);
+
+    latency.start(*query_);
+    latency.mark(PktLatencyStats::UNPACK);
+    latency.setMessageType(DHCPDISCOVER, query_->getName());
+    latency.mark(PktLatencyStats::LEASE_ALLOC);
+    latency.mark(PktLatencyStats::LEASE_ALLOC);
+    latency.finish();
+
+    const stats::LatencyHistogram* histogram =
+        latency.getHistogram(DHCPDISCOVER, PktLatencyStats::LEASE_ALLOC);
+    ASSERT_TRUE(histogram);
+    EXPECT_EQ(1, histogram->getCount());
+
+    histogram = latency.getHistogram(DHCPDISCOVER, PktLatencyStats::TOTAL);
+    ASSERT_TRUE(histogram);
+    EXPECT_EQ(1, histogram->getCount());
+
+    // Phases which haven't been marked are not recorded.
+    histogram = latency.getHistogram(DHCPDISCOVER, PktLatencyStats::DDNS);
+    ASSERT_TRUE(histogram);
+    EXPECT_EQ(0, histogram->getCount());
+
+    EXPECT_FALSE(latency.getHistogram(DHCPREQUEST, PktLatencyStats::TOTAL));
+
+    // The statistics have been published.
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-discover-lease-alloc-latency-p50"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-discover-total-latency-p99"));
+    EXPECT_TRUE(StatsMgr::instance().getObservation("pkt4-discover-unpack-latency-max"));
+    EXPECT_FALSE(StatsMgr::instance().getObservation("pkt4-discover-ddns-latency-p50"));
+}
+
+// This test verifies that the packets without message type and the marks
+// made outside of the timing are not recorded.
+TEST_F(PktLatencyStatsTest, notRecorded) {
+    PktLatencyStats latency("pkt4", 0);
+
+    // Marking without starting has no effect.
+    latency.mark(PktLatencyStats::UNPACK);
+    latency.setMessageType(DHCPDISCOVER, query_->getName());
+    latency.finish();
+    EXPECT_FALSE(latency.getHistogram(DHCPDISCOVER, PktLatencyStats::TOTAL));
+
+    // Packets dropped before the message type is known are not recorded.
+    latency.start(*query_);
+    latency.mark(PktLatencyStats::UNPACK);
+    latency.finish();
+    EXPECT_FALSE(latency.getHistogram(DHCPDISCOVER, PktLatencyStats::TOTAL));
+    EXPECT_EQ(0, StatsMgr::instance().count());
+}
+
+// This test verifies the names of the phases.
+TEST(PktLatencyStatsPhaseTest, phaseToText) {
+    EXPECT_EQ("receive", std::string(PktLatencyStats::phaseToText(PktLatencyStats::RECEIVE)));
+    EXPECT_EQ("lease-alloc",
+              std::string(PktLatencyStats::phaseToText(PktLatencyStats::LEASE_ALLOC)));
+    EXPECT_EQ("total", std::string(PktLatencyStats::phaseToText(PktLatencyStats::TOTAL)));
+}
+
+} // end of anonymous namespace
@@ -27,6 +27,17 @@ using namespace isc::asiolink;
 
 namespace {
 
+/// @brief Pool4 exposing the time when it was marked exhausted.
+class NakedPool4 : public Pool4 {
+public:
+    /// @brief Constructor.
+    NakedPool4(const IOAddress& first, const IOAddress& last)
+        : Pool4(first, last) {
+    }
+
+    using Pool4::exhausted_time_;
+};
+
 TEST(Pool4Test, constructor_first_last) {
 
     // let's construct 192.0.2.1-192.0.2.255 pool
@@ -281,6 +292,24 @@ TEST(Pool4Test, lastAllocated) {
     EXPECT_FALSE(pool->isLastAllocatedValid());
 }
 
+// This test checks that the pool is considered exhausted for a limited time.
+TEST(Pool4Test, exhausted) {
+    NakedPool4 pool(IOAddress("192.0.2.0"), IOAddress("192.0.2.255"));
+    EXPECT_FALSE(pool.isExhausted());
+
+    pool.setExhausted(true);
+    EXPECT_TRUE(pool.isExhausted());
+    pool.setExhausted(false);
+    EXPECT_FALSE(pool.isExhausted());
+
+    // The pool is no longer exhausted after the timeout.
+    pool.setExhausted(true);
+    pool.exhausted_time_ -= std::chrono::seconds(Pool::EXHAUSTED_TIMEOUT - 1);
+    EXPECT_TRUE(pool.isExhausted());
+    pool.exhausted_time_ -= std::chrono::seconds(1);
+    EXPECT_FALSE(pool.isExhausted());
+}
+
 TEST(Pool6Test, constructor_first_last) {
 
     // let's construct 2001:db8:1:: - 2001:db8:1::ffff:ffff:ffff:ffff pool
@@ -0,0 +1,98 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/data.h>
+#include <dhcpsrv/cfg_rate_limit.h>
+#include <dhcpsrv/parsers/dhcp_parsers.h>
+#include <dhcpsrv/parsers/rate_limit_parser.h>
+#include <testutils/test_to_element.h>
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::test;
+
+namespace {
+
+/// @brief Parses the configuration with @c RateLimitParser.
+///
+/// @param config JSON text of the client-rate-limit map.
+/// @return Pointer to the parsed configuration.
+CfgRateLimitPtr
+parse(const std::string& config) {
+    CfgRateLimitPtr cfg(new CfgRateLimit());
+    RateLimitParser parser;
+    parser.parse(cfg, Element::fromJSON(config));
+    return (cfg);
+}
+
+// This test verifies the default values.
+TEST(RateLimitParserTest, defaults) {
+    CfgRateLimitPtr cfg;
+    ASSERT_NO_THROW(cfg = parse("{ }"));
+    EXPECT_EQ(0, cfg->getClientRate());
+    EXPECT_EQ(0, cfg->getClientBurst());
+    EXPECT_EQ(0, cfg->getRelayRate());
+    EXPECT_EQ(0, cfg->getRelayBurst());
+    EXPECT_EQ(CfgRateLimit::DEFAULT_MAX_CLIENTS, cfg->getMaxClients());
+    EXPECT_FALSE(cfg->getDropDuplicates());
+    EXPECT_FALSE(cfg->isEnabled());
+}
+
+// This test verifies that all parameters are parsed and unparsed.
+TEST(RateLimitParserTest, all) {
+    std::string config = "{ \"client-rate\": 5, \"client-burst\": 10,"
+        " \"relay-rate\": 1000, \"relay-burst\": 2000,"
+        " \"max-clients\": 100, \"drop-duplicates\": true }";
+    CfgRateLimitPtr cfg;
+    ASSERT_NO_THROW(cfg = parse(config));
+    EXPECT_EQ(5, cfg->getClientRate());
+    EXPECT_EQ(10, cfg->getClientBurst());
+    EXPECT_EQ(1000, cfg->getRelayRate());
+    EXPECT_EQ(2000, cfg->getRelayBurst());
+    EXPECT_EQ(100, cfg->getMaxClients());
+    EXPECT_TRUE(cfg->getDropDuplicates());
+    EXPECT_TRUE(cfg->isEnabled());
+    runToElementTest<CfgRateLimit>(config, *cfg);
+}
+
+// This test verifies that any of the limits enables the filter.
+TEST(RateLimitParserTest, enabled) {
+    EXPECT_TRUE(parse("{ \"client-rate\": 1 }")->isEnabled());
+    EXPECT_TRUE(parse("{ \"relay-rate\": 1 }")->isEnabled());
+    EXPECT_TRUE(parse("{ \"drop-duplicates\": true }")->isEnabled());
+    EXPECT_FALSE(parse("{ \"client-burst\": 1 }")->isEnabled());
+}
+
+// This test verifies that the invalid configurations are rejected.
+TEST(RateLimitParserTest, invalid) {
+    EXPECT_THROW(parse("[ ]"), DhcpConfigError);
+    EXPECT_THROW(parse("{ \"foo\": 1 }"), DhcpConfigError);
+    EXPECT_THROW(parse("{ \"client-rate\": -1 }"), DhcpConfigError);
+    EXPECT_THROW(parse("{ \"relay-burst\": 4294967296 }"), DhcpConfigError);
+    EXPECT_THROW(parse("{ \"max-clients\": 0 }"), DhcpConfigError);
+    EXPECT_THROW(parse("{ \"client-rate\": \"5\" }"), DhcpConfigError);
+    EXPECT_THROW(parse("{ \"drop-duplicates\": 1 }"), DhcpConfigError);
+}
+
+// This test verifies that the configurations are compared by value.
+TEST(RateLimitParserTest, equals) {
+    std::string config = "{ \"client-rate\": 5, \"client-burst\": 10,"
+        " \"relay-rate\": 1000, \"drop-duplicates\": true }";
+    CfgRateLimitPtr cfg = parse(config);
+    EXPECT_TRUE(*cfg == *parse(config));
+    EXPECT_FALSE(*cfg != *parse(config));
+    EXPECT_TRUE(*cfg != *parse("{ \"client-rate\": 5, \"client-burst\": 10,"
+                               " \"relay-rate\": 1000 }"));
+    EXPECT_TRUE(*cfg != *parse("{ \"client-rate\": 5, \"client-burst\": 10,"
+                               " \"relay-rate\": 1000, \"max-clients\": 1,"
+                               " \"drop-duplicates\": true }"));
+}
+
+}
@@ -486,6 +486,28 @@ TEST_F(SrvConfigTest, configuredGlobals) {
     }
 }
 
+// Verifies that the parameters of the parsed configuration are compared.
+TEST_F(SrvConfigTest, parsedConfig) {
+    SrvConfig conf(32);
+    ConstElementPtr config = Element::fromJSON("{ \"foo\": [ 1, 2 ] }");
+
+    // Nothing is unchanged before the configuration is set.
+    EXPECT_FALSE(conf.getParsedConfig());
+    EXPECT_FALSE(conf.isParsedParameterUnchanged(config, "foo"));
+    EXPECT_FALSE(conf.isParsedParameterUnchanged(config, "bar"));
+
+    conf.setParsedConfig(Element::fromJSON("{ \"foo\": [ 1, 2 ],"
+                                           "  \"bar\": 1 }"));
+    EXPECT_TRUE(conf.isParsedParameterUnchanged(config, "foo"));
+    EXPECT_TRUE(conf.isParsedParameterUnchanged(config, "baz"));
+    EXPECT_FALSE(conf.isParsedParameterUnchanged(config, "bar"));
+    EXPECT_FALSE(conf.isParsedParameterUnchanged(
+                     Element::fromJSON("{ \"foo\": [ 2, 1 ] }"), "foo"));
+
+    conf.setParsedConfig(ConstElementPtr());
+    EXPECT_FALSE(conf.isParsedParameterUnchanged(config, "foo"));
+}
+
 // Verifies that the toElement method works well (tests limited to
 // direct parameters)
 TEST_F(SrvConfigTest, unparse) {
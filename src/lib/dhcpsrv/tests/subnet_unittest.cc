@@ -344,6 +344,55 @@ TEST(Subnet4Test, getCapacity) {
     EXPECT_EQ(200, subnet->getPoolCapacity(Lease::TYPE_V4, three_classes));
 }
 
+// Checks that the exhausted pools are excluded from the free capacity.
+TEST(Subnet4Test, exhaustedPools) {
+    Subnet4Ptr subnet(new Subnet4(IOAddress("192.1.2.0"), 24, 1, 2, 3));
+
+    // Let's add a /25 pool and a /26 pool for the bar class only.
+    PoolPtr pool1(new Pool4(IOAddress("192.1.2.0"), 25));
+    subnet->addPool(pool1);
+    PoolPtr pool2(new Pool4(IOAddress("192.1.2.128"), 26));
+    pool2->allowClientClass("bar");
+    subnet->addPool(pool2);
+
+    isc::dhcp::ClientClasses no_class;
+    isc::dhcp::ClientClasses bar_class;
+    bar_class.insert("bar");
+
+    // No pool is exhausted initially.
+    EXPECT_FALSE(pool1->isExhausted());
+    EXPECT_FALSE(pool2->isExhausted());
+    EXPECT_EQ(128, subnet->getFreePoolCapacity(Lease::TYPE_V4, no_class));
+    EXPECT_EQ(192, subnet->getFreePoolCapacity(Lease::TYPE_V4, bar_class));
+
+    // Only the pool allowed for the client is marked exhausted.
+    subnet->setPoolsExhausted(Lease::TYPE_V4, no_class);
+    EXPECT_TRUE(pool1->isExhausted());
+    EXPECT_FALSE(pool2->isExhausted());
+    EXPECT_EQ(0, subnet->getFreePoolCapacity(Lease::TYPE_V4, no_class));
+    EXPECT_EQ(64, subnet->getFreePoolCapacity(Lease::TYPE_V4, bar_class));
+
+    // The total capacity is unchanged.
+    EXPECT_EQ(192, subnet->getPoolCapacity(Lease::TYPE_V4, bar_class));
+
+    // Resetting the pool for an address outside of the pools is a no-op.
+    subnet->resetPoolExhausted(Lease::TYPE_V4, IOAddress("192.1.2.250"));
+    EXPECT_TRUE(pool1->isExhausted());
+
+    // Reset the pool the address belongs to.
+    subnet->resetPoolExhausted(Lease::TYPE_V4, IOAddress("192.1.2.10"));
+    EXPECT_FALSE(pool1->isExhausted());
+    EXPECT_EQ(128, subnet->getFreePoolCapacity(Lease::TYPE_V4, no_class));
+
+    // Reset all pools.
+    subnet->setPoolsExhausted(Lease::TYPE_V4, bar_class);
+    EXPECT_TRUE(pool1->isExhausted());
+    EXPECT_TRUE(pool2->isExhausted());
+    subnet->resetPoolsExhausted(Lease::TYPE_V4);
+    EXPECT_FALSE(pool1->isExhausted());
+    EXPECT_FALSE(pool2->isExhausted());
+}
+
 // Checks that it is not allowed to add invalid pools.
 TEST(Subnet4Test, pool4Checks) {
 
@@ -30,7 +30,8 @@ CalloutManager::CalloutManager(int num_libraries)
       current_hook_(-1), current_library_(-1),
       hook_vector_(ServerHooks::getServerHooks().getCount()),
       library_handle_(this), pre_library_handle_(this, 0),
-      post_library_handle_(this, INT_MAX), num_libraries_(num_libraries)
+      post_library_handle_(this, INT_MAX), num_libraries_(num_libraries),
+      timing_enabled_(false), timings_()
 {
     if (num_libraries < 0) {
         isc_throw(isc::BadValue, "number of libraries passed to the "
@@ -55,6 +56,23 @@ CalloutManager::checkLibraryIndex(int library_index) const {
               num_libraries_ << ")");
 }
 
+// Record the execution of a callout.
+
+void
+CalloutManager::recordTiming(int hook_index, int library_index, long duration,
+                             bool error) {
+    CalloutTiming& timing = timings_[std::make_pair(hook_index, library_index)];
+    const uint64_t usec = (duration > 0 ? static_cast<uint64_t>(duration) : 0);
+    ++timing.calls_;
+    if (error) {
+        ++timing.errors_;
+    }
+    timing.total_usec_ += usec;
+    if (usec > timing.max_usec_) {
+        timing.max_usec_ = usec;
+    }
+}
+
 // Register a callout for the current library.
 
 void
@@ -174,6 +192,10 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 stopwatch.start();
                 int status = (*i->second)(callout_handle);
                 stopwatch.stop();
+                if (timing_enabled_) {
+                    recordTiming(hook_index, current_library_,
+                                 stopwatch.getLastMicroseconds(), status != 0);
+                }
                 if (status == 0) {
                     LOG_DEBUG(callouts_logger, HOOKS_DBG_EXTENDED_CALLS,
                               HOOKS_CALLOUT_CALLED).arg(current_library_)
@@ -191,6 +213,10 @@ CalloutManager::callCallouts(int hook_index, CalloutHandle& callout_handle) {
                 // If an exception occurred, the stopwatch.stop() hasn't been
                 // called, so we have to call it here.
                 stopwatch.stop();
+                if (timing_enabled_) {
+                    recordTiming(hook_index, current_library_,
+                                 stopwatch.getLastMicroseconds(), true);
+                }
                 // Any exception, not just ones based on isc::Exception
                 LOG_ERROR(callouts_logger, HOOKS_CALLOUT_EXCEPTION)
                     .arg(current_library_)
@@ -15,7 +15,9 @@
 
 #include <climits>
 #include <map>
+#include <stdint.h>
 #include <string>
+#include <utility>
 
 namespace isc {
 namespace hooks {
@@ -30,6 +32,31 @@ public:
         isc::Exception(file, line, what) {}
 };
 
+/// @brief Execution statistics of the callouts registered by a library
+/// on a hook point.
+struct CalloutTiming {
+    /// @brief Constructor.
+    CalloutTiming()
+        : calls_(0), errors_(0), total_usec_(0), max_usec_(0) {
+    }
+
+    /// @brief Number of callout invocations.
+    uint64_t calls_;
+
+    /// @brief Number of invocations which returned an error or threw.
+    uint64_t errors_;
+
+    /// @brief Total execution time in microseconds.
+    uint64_t total_usec_;
+
+    /// @brief Longest execution time in microseconds.
+    uint64_t max_usec_;
+};
+
+/// @brief Callout execution statistics indexed by the hook index and
+/// the library index.
+typedef std::map<std::pair<int, int>, CalloutTiming> CalloutTimings;
+
 /// @brief Callout Manager
 ///
 /// This class manages the registration, deregistration and execution of the
@@ -274,6 +301,32 @@ public:
         return (current_hook_);
     }
 
+    /// @brief Enables or disables callout execution timing.
+    ///
+    /// When enabled, @c callCallouts records the number of invocations
+    /// and the execution time of the callouts for each hook point and
+    /// library. It is disabled by default.
+    ///
+    /// @param enabled true to enable timing, false to disable it.
+    void setTimingEnabled(bool enabled) {
+        timing_enabled_ = enabled;
+    }
+
+    /// @brief Checks if callout execution timing is enabled.
+    bool isTimingEnabled() const {
+        return (timing_enabled_);
+    }
+
+    /// @brief Returns the recorded callout execution statistics.
+    const CalloutTimings& getTimings() const {
+        return (timings_);
+    }
+
+    /// @brief Removes the recorded callout execution statistics.
+    void clearTimings() {
+        timings_.clear();
+    }
+
     /// @brief Get number of libraries
     ///
     /// Returns the number of libraries that this CalloutManager is expected
@@ -407,6 +460,15 @@ private:
     /// @throw NoSuchLibrary Library index is not valid.
     void checkLibraryIndex(int library_index) const;
 
+    /// @brief Records the execution of a callout.
+    ///
+    /// @param hook_index Index of the hook point.
+    /// @param library_index Index of the library which registered the callout.
+    /// @param duration Execution time in microseconds.
+    /// @param error true if the callout returned an error or threw.
+    void recordTiming(int hook_index, int library_index, long duration,
+                      bool error);
+
     /// @brief Compare two callout entries for library equality
     ///
     /// This is used in callout removal code when all callouts on a hook for a
@@ -464,6 +526,12 @@ private:
 
     /// Number of libraries.
     int num_libraries_;
+
+    /// Indicates if the callout execution timing is enabled.
+    bool timing_enabled_;
+
+    /// Recorded callout execution statistics.
+    CalloutTimings timings_;
 };
 
 } // namespace util
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <cc/command_interpreter.h>
 #include <hooks/callout_handle.h>
 #include <hooks/callout_manager.h>
 #include <hooks/callout_manager.h>
@@ -19,6 +20,8 @@
 #include <string>
 #include <vector>
 
+using namespace isc::config;
+using namespace isc::data;
 using namespace std;
 
 namespace isc {
@@ -26,7 +29,7 @@ namespace hooks {
 
 // Constructor
 
-HooksManager::HooksManager() {
+HooksManager::HooksManager() : callout_timing_enabled_(false) {
 }
 
 // Return reference to singleton hooks manager.
@@ -103,6 +106,7 @@ HooksManager::loadLibrariesInternal(const HookLibsCollection& libraries) {
     if (status) {
         // ... and obtain the callout manager for them if successful.
         callout_manager_ = lm_collection_->getCalloutManager();
+        callout_manager_->setTimingEnabled(callout_timing_enabled_);
     } else {
         // Unable to load libraries, reset to state before this function was
         // called.
@@ -187,6 +191,7 @@ HooksManager::performConditionalInitialization() {
     lm_collection_->loadLibraries();
 
     callout_manager_ = lm_collection_->getCalloutManager();
+    callout_manager_->setTimingEnabled(callout_timing_enabled_);
 }
 
 // Shell around ServerHooks::registerHook()
@@ -227,6 +232,123 @@ HooksManager::validateLibraries(const std::vector<std::string>& libraries) {
     return (LibraryManagerCollection::validateLibraries(libraries));
 }
 
+// Callout execution timing
+
+void
+HooksManager::setCalloutTimingEnabledInternal(bool enabled) {
+    conditionallyInitialize();
+    callout_timing_enabled_ = enabled;
+    callout_manager_->setTimingEnabled(enabled);
+}
+
+void
+HooksManager::setCalloutTimingEnabled(bool enabled) {
+    getHooksManager().setCalloutTimingEnabledInternal(enabled);
+}
+
+bool
+HooksManager::isCalloutTimingEnabled() {
+    return (getHooksManager().callout_timing_enabled_);
+}
+
+void
+HooksManager::clearCalloutTimingsInternal() {
+    if (callout_manager_) {
+        callout_manager_->clearTimings();
+    }
+}
+
+void
+HooksManager::clearCalloutTimings() {
+    getHooksManager().clearCalloutTimingsInternal();
+}
+
+ElementPtr
+HooksManager::getCalloutTimingsInternal() {
+    ElementPtr result = Element::createList();
+    if (!callout_manager_) {
+        return (result);
+    }
+
+    const std::vector<std::string> names = getLibraryNamesInternal();
+    const ServerHooks& server_hooks = ServerHooks::getServerHooks();
+    const CalloutTimings& timings = callout_manager_->getTimings();
+    for (CalloutTimings::const_iterator timing = timings.begin();
+         timing != timings.end(); ++timing) {
+        const int library_index = timing->first.second;
+        std::string library;
+        if (library_index == 0) {
+            library = "pre-library";
+        } else if ((library_index > 0) &&
+                   (library_index <= static_cast<int>(names.size()))) {
+            library = names[library_index - 1];
+        } else {
+            library = "post-library";
+        }
+
+        ElementPtr entry = Element::createMap();
+        entry->set("hook", Element::create(server_hooks.getName(timing->first.first)));
+        entry->set("library", Element::create(library));
+        entry->set("calls",
+                   Element::create(static_cast<int64_t>(timing->second.calls_)));
+        entry->set("errors",
+                   Element::create(static_cast<int64_t>(timing->second.errors_)));
+        entry->set("total-time-usec",
+                   Element::create(static_cast<int64_t>(timing->second.total_usec_)));
+        entry->set("max-time-usec",
+                   Element::create(static_cast<int64_t>(timing->second.max_usec_)));
+        result->add(entry);
+    }
+    return (result);
+}
+
+ElementPtr
+HooksManager::getCalloutTimings() {
+    return (getHooksManager().getCalloutTimingsInternal());
+}
+
+ConstElementPtr
+HooksManager::listCalloutTimingsHandler(const std::string& /*name*/,
+                                        const ConstElementPtr& params) {
+    bool reset = false;
+    if (params) {
+        if (params->getType() != Element::map) {
+            return (createAnswer(CONTROL_RESULT_ERROR,
+                                 "arguments must be a map"));
+        }
+        ConstElementPtr reset_param = params->get("reset");
+        if (reset_param) {
+            if (reset_param->getType() != Element::boolean) {
+                return (createAnswer(CONTROL_RESULT_ERROR,
+                                     "'reset' parameter must be a boolean"));
+            }
+            reset = reset_param->boolValue();
+        }
+    }
+
+    ElementPtr arguments = Element::createMap();
+    arguments->set("enabled", Element::create(isCalloutTimingEnabled()));
+    arguments->set("timings", getCalloutTimings());
+    if (reset) {
+        clearCalloutTimings();
+    }
+    return (createAnswer(CONTROL_RESULT_SUCCESS, arguments));
+}
+
+ConstElementPtr
+HooksManager::calloutTimingEnableHandler(const std::string& /*name*/,
+                                         const ConstElementPtr& /*params*/) {
+    setCalloutTimingEnabled(true);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, "Callout timing enabled."));
+}
+
+ConstElementPtr
+HooksManager::calloutTimingDisableHandler(const std::string& /*name*/,
+                                          const ConstElementPtr& /*params*/) {
+    setCalloutTimingEnabled(false);
+    return (createAnswer(CONTROL_RESULT_SUCCESS, "Callout timing disabled."));
+}
+
 // Shared callout manager
 boost::shared_ptr<CalloutManager>&
 HooksManager::getSharedCalloutManager() {
@@ -7,6 +7,7 @@
 #ifndef HOOKS_MANAGER_H
 #define HOOKS_MANAGER_H
 
+#include <cc/data.h>
 #include <hooks/server_hooks.h>
 #include <hooks/libinfo.h>
 
@@ -222,6 +223,64 @@ public:
     static std::vector<std::string> validateLibraries(
                        const std::vector<std::string>& libraries);
 
+    /// @brief Enables or disables callout execution timing.
+    ///
+    /// When enabled, the number of invocations and the execution time
+    /// of the callouts are recorded for each hook point and library. The
+    /// setting is retained when the libraries are reloaded, but the
+    /// recorded statistics are not.
+    ///
+    /// @param enabled true to enable timing, false to disable it.
+    static void setCalloutTimingEnabled(bool enabled);
+
+    /// @brief Checks if callout execution timing is enabled.
+    static bool isCalloutTimingEnabled();
+
+    /// @brief Removes the recorded callout execution statistics.
+    static void clearCalloutTimings();
+
+    /// @brief Returns the recorded callout execution statistics.
+    ///
+    /// @return List of maps, each holding the hook point name, the library
+    /// name, the number of calls and errors, and the total and maximum
+    /// execution time in microseconds. The callouts registered by the
+    /// server before and after the libraries' callouts are reported for
+    /// the "pre-library" and "post-library" libraries respectively.
+    static data::ElementPtr getCalloutTimings();
+
+    /// @brief Handles list-callout-timings command.
+    ///
+    /// Returns the recorded callout execution statistics. If the
+    /// "reset" argument is true, the statistics are removed afterwards.
+    ///
+    /// @param name Name of the command (ignored).
+    /// @param params Optional map with the "reset" boolean.
+    ///
+    /// @return Answer holding the timing state and the statistics.
+    static data::ConstElementPtr
+    listCalloutTimingsHandler(const std::string& name,
+                              const data::ConstElementPtr& params);
+
+    /// @brief Handles callout-timing-enable command.
+    ///
+    /// @param name Name of the command (ignored).
+    /// @param params Command arguments (ignored).
+    ///
+    /// @return Answer confirming that the timing has been enabled.
+    static data::ConstElementPtr
+    calloutTimingEnableHandler(const std::string& name,
+                               const data::ConstElementPtr& params);
+
+    /// @brief Handles callout-timing-disable command.
+    ///
+    /// @param name Name of the command (ignored).
+    /// @param params Command arguments (ignored).
+    ///
+    /// @return Answer confirming that the timing has been disabled.
+    static data::ConstElementPtr
+    calloutTimingDisableHandler(const std::string& name,
+                                const data::ConstElementPtr& params);
+
     /// Index numbers for pre-defined hooks.
     static const int CONTEXT_CREATE = ServerHooks::CONTEXT_CREATE;
     static const int CONTEXT_DESTROY = ServerHooks::CONTEXT_DESTROY;
@@ -475,6 +534,17 @@ private:
     /// @brief Return a collection of library names with parameters.
     HookLibsCollection getLibraryInfoInternal() const;
 
+    /// @brief Enables or disables callout execution timing.
+    ///
+    /// @param enabled true to enable timing, false to disable it.
+    void setCalloutTimingEnabledInternal(bool enabled);
+
+    /// @brief Removes the recorded callout execution statistics.
+    void clearCalloutTimingsInternal();
+
+    /// @brief Returns the recorded callout execution statistics.
+    data::ElementPtr getCalloutTimingsInternal();
+
     //@}
 
     /// @brief Initialization to No Libraries
@@ -514,6 +584,9 @@ private:
     /// Shared callout manager to survive library reloads.
     boost::shared_ptr<CalloutManager> shared_callout_manager_;
 
+    /// Indicates if the callout execution timing is enabled.
+    bool callout_timing_enabled_;
+
 };
 
 } // namespace util
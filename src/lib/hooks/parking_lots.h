@@ -9,11 +9,15 @@
 
 #include <exceptions/exceptions.h>
 #include <boost/any.hpp>
+#include <boost/functional/hash.hpp>
 #include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
+#include <chrono>
 #include <functional>
-#include <list>
 #include <map>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
 
 #include <iostream>
 
@@ -57,9 +61,71 @@ namespace hooks {
 /// functions are most often shared pointers. One should not use references
 /// to parked objects nor references to shared pointers to avoid premature
 /// destruction of the parked objects.
+///
+/// The parked objects are indexed by their hash (computed with
+/// @c boost::hash, i.e. the pointer value for the shared pointers), so
+/// finding an object doesn't depend on the number of parked objects.
+///
+/// A timeout can be set for the parking lot to protect against callouts
+/// which never unpark the objects. The @c expire() method, called
+/// periodically by the server, removes the objects parked for longer than
+/// the timeout and, depending on the configured action, invokes their
+/// unpark callbacks. The server sets a default timeout for all parking
+/// lots, which is used unless the hooks library sets its own.
 class ParkingLot {
 public:
 
+    /// @brief Action taken on the objects parked for longer than the timeout.
+    enum TimeoutAction {
+        TIMEOUT_DROP,   ///< remove the object without calling the callback
+        TIMEOUT_UNPARK  ///< remove the object and call the callback
+    };
+
+    /// @brief Constructor.
+    ///
+    /// The parked objects never time out by default.
+    ParkingLot()
+        : parking_(), timeout_(0), timeout_action_(TIMEOUT_DROP),
+          timeout_set_(false), max_size_(0), timed_out_(0) {
+    }
+
+    /// @brief Sets the timeout for the objects parked in this parking lot.
+    ///
+    /// @param timeout timeout in milliseconds, counted from the time the
+    /// object was parked. The value of 0 disables the timeout.
+    /// @param action action taken on the objects which timed out.
+    void setTimeout(const long timeout, const TimeoutAction action) {
+        timeout_ = std::chrono::milliseconds(timeout);
+        timeout_action_ = action;
+        timeout_set_ = true;
+    }
+
+    /// @brief Sets the default timeout for the objects parked in this
+    /// parking lot.
+    ///
+    /// The default timeout is ignored once the timeout was set with
+    /// @c setTimeout().
+    ///
+    /// @param timeout timeout in milliseconds. The value of 0 disables
+    /// the timeout.
+    /// @param action action taken on the objects which timed out.
+    void setDefaultTimeout(const long timeout, const TimeoutAction action) {
+        if (!timeout_set_) {
+            timeout_ = std::chrono::milliseconds(timeout);
+            timeout_action_ = action;
+        }
+    }
+
+    /// @brief Returns the timeout in milliseconds (0 if disabled).
+    long getTimeout() const {
+        return (static_cast<long>(timeout_.count()));
+    }
+
+    /// @brief Returns the action taken on the objects which timed out.
+    TimeoutAction getTimeoutAction() const {
+        return (timeout_action_);
+    }
+
     /// @brief Parks an object.
     ///
     /// @tparam Type of the parked object.
@@ -71,12 +137,12 @@ public:
     template<typename T>
     void park(T parked_object, std::function<void()> unpark_callback) {
         auto it = find(parked_object);
-        if (it == parking_.end() || it->refcount_ <= 0) {
+        if (it == parking_.end() || it->second.refcount_ <= 0) {
             isc_throw(InvalidOperation, "unable to park an object because"
                       " reference count for this object hasn't been increased."
                       " Call ParkingLot::reference() first");
         } else {
-            it->update(parked_object, unpark_callback);
+            it->second.update(parked_object, unpark_callback);
         }
     }
 
@@ -93,10 +159,13 @@ public:
         auto it = find(parked_object);
         if (it == parking_.end()) {
             ParkingInfo parking_info(parked_object);
-            parking_.push_back(parking_info);
+            parking_.insert(std::make_pair(hash(parked_object), parking_info));
+            if (parking_.size() > max_size_) {
+                max_size_ = parking_.size();
+            }
 
         } else {
-            ++it->refcount_;
+            ++it->second.refcount_;
         }
     }
 
@@ -118,15 +187,15 @@ public:
         auto it = find(parked_object);
         if (it != parking_.end()) {
             if (force) {
-                it->refcount_ = 0;
+                it->second.refcount_ = 0;
 
             } else {
-                --it->refcount_;
+                --it->second.refcount_;
             }
 
-            if (it->refcount_ <= 0) {
+            if (it->second.refcount_ <= 0) {
                 // Unpark the packet and invoke the callback.
-                std::function<void()> cb = it->unpark_callback_;
+                std::function<void()> cb = it->second.unpark_callback_;
                 parking_.erase(it);
                 cb();
             }
@@ -161,6 +230,59 @@ public:
         return (false);
     }
 
+    /// @brief Removes the objects parked for longer than the timeout.
+    ///
+    /// Depending on the timeout action, the unpark callbacks of the removed
+    /// objects are invoked or not. The callbacks are invoked after all timed
+    /// out objects have been removed, so they may use this parking lot.
+    ///
+    /// @return Number of the removed objects.
+    size_t expire() {
+        if (timeout_.count() <= 0) {
+            return (0);
+        }
+
+        const std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::now() - timeout_;
+        std::vector<std::function<void()> > callbacks;
+        size_t expired = 0;
+        for (auto it = parking_.begin(); it != parking_.end(); ) {
+            if (it->second.parked_at_ <= deadline) {
+                if ((timeout_action_ == TIMEOUT_UNPARK) &&
+                    it->second.unpark_callback_) {
+                    callbacks.push_back(it->second.unpark_callback_);
+                }
+                it = parking_.erase(it);
+                ++expired;
+
+            } else {
+                ++it;
+            }
+        }
+        timed_out_ += expired;
+
+        for (auto cb = callbacks.begin(); cb != callbacks.end(); ++cb) {
+            (*cb)();
+        }
+
+        return (expired);
+    }
+
+    /// @brief Returns the number of parked (or referenced) objects.
+    size_t size() const {
+        return (parking_.size());
+    }
+
+    /// @brief Returns the maximum number of objects parked at the same time.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+    /// @brief Returns the number of objects removed because of the timeout.
+    uint64_t getTimedOut() const {
+        return (timed_out_);
+    }
+
 private:
 
     /// @brief Holds information about parked object.
@@ -168,6 +290,8 @@ private:
         boost::any parked_object_;               ///< parked object
         std::function<void()> unpark_callback_;  ///< pointer to the callback
         int refcount_;                           ///< current reference count
+        /// time of parking (or referencing if not parked yet)
+        std::chrono::steady_clock::time_point parked_at_;
 
         /// @brief Constructor.
         ///
@@ -176,7 +300,7 @@ private:
         ParkingInfo(const boost::any& parked_object,
                     std::function<void()> callback = 0)
             : parked_object_(parked_object), unpark_callback_(callback),
-              refcount_(1) {
+              refcount_(1), parked_at_(std::chrono::steady_clock::now()) {
         }
 
         /// @brief Update parking information.
@@ -187,27 +311,57 @@ private:
                     std::function<void()> callback) {
             parked_object_ = parked_object;
             unpark_callback_ = callback;
+            parked_at_ = std::chrono::steady_clock::now();
         }
     };
 
-    /// @brief Type of list of parked objects.
-    typedef std::list<ParkingInfo> ParkingInfoList;
-    /// @brief Type of the iterator in the list of parked objects.
-    typedef ParkingInfoList::iterator ParkingInfoListIterator;
+    /// @brief Type of the container of parked objects indexed by their hash.
+    typedef std::unordered_multimap<std::size_t, ParkingInfo> ParkingInfoMap;
+    /// @brief Type of the iterator in the container of parked objects.
+    typedef ParkingInfoMap::iterator ParkingInfoMapIterator;
 
     /// @brief Container holding parked objects for this parking lot.
-    ParkingInfoList parking_;
+    ParkingInfoMap parking_;
+
+    /// @brief Timeout of the parked objects (0 if disabled).
+    std::chrono::milliseconds timeout_;
+
+    /// @brief Action taken on the objects which timed out.
+    TimeoutAction timeout_action_;
+
+    /// @brief Indicates if the timeout was set by @c setTimeout().
+    bool timeout_set_;
+
+    /// @brief Maximum number of objects parked at the same time.
+    size_t max_size_;
+
+    /// @brief Number of objects removed because of the timeout.
+    uint64_t timed_out_;
+
+    /// @brief Computes the hash of the parked object.
+    ///
+    /// @tparam T parked object type.
+    /// @param parked_object object for which the hash should be computed.
+    /// @return Hash of the object.
+    template<typename T>
+    static std::size_t hash(const T& parked_object) {
+        return (boost::hash<T>()(parked_object));
+    }
 
     /// @brief Search for the information about the parked object.
     ///
+    /// Only the objects with the same hash are compared.
+    ///
     /// @tparam T parked object type.
     /// @param parked_object object for which the information should be found.
     /// @return Iterator pointing to the parked object, or @c parking_.end() if
     /// no such object found.
     template<typename T>
-    ParkingInfoListIterator find(T parked_object) {
-        for (auto it = parking_.begin(); it != parking_.end(); ++it) {
-            if (boost::any_cast<T>(it->parked_object_) == parked_object) {
+    ParkingInfoMapIterator find(T parked_object) {
+        auto range = parking_.equal_range(hash(parked_object));
+        for (auto it = range.first; it != range.second; ++it) {
+            const T* object = boost::any_cast<T>(&it->second.parked_object_);
+            if (object && (*object == parked_object)) {
                 return (it);
             }
         }
@@ -281,6 +435,19 @@ public:
         return (parking_lot_->drop(parked_object));
     }
 
+    /// @brief Sets the timeout for the objects parked in this parking lot.
+    ///
+    /// This allows callouts to bound the time a packet remains parked
+    /// in case the asynchronous operation they wait for never completes.
+    ///
+    /// @param timeout timeout in milliseconds, counted from the time the
+    /// object was parked. The value of 0 disables the timeout.
+    /// @param action action taken on the objects which timed out.
+    void setTimeout(const long timeout,
+                    const ParkingLot::TimeoutAction action) {
+        parking_lot_->setTimeout(timeout, action);
+    }
+
 private:
 
     /// @brief Parking lot to which this handle points.
@@ -295,13 +462,40 @@ typedef boost::shared_ptr<ParkingLotHandle> ParkingLotHandlePtr;
 class ParkingLots {
 public:
 
+    /// @brief Constructor.
+    ///
+    /// The parked objects never time out by default.
+    ParkingLots()
+        : parking_lots_(), default_timeout_(0),
+          default_timeout_action_(ParkingLot::TIMEOUT_DROP) {
+    }
+
     /// @brief Removes all parked objects.
     ///
     /// It doesn't invoke callbacks associated with the removed objects.
+    /// The default timeout is retained.
     void clear() {
         parking_lots_.clear();
     }
 
+    /// @brief Sets the default timeout for all parking lots.
+    ///
+    /// The timeout applies to the existing parking lots and to the ones
+    /// created later, unless the hooks library sets the timeout of the
+    /// parking lot.
+    ///
+    /// @param timeout timeout in milliseconds. The value of 0 disables
+    /// the timeout.
+    /// @param action action taken on the objects which timed out.
+    void setDefaultTimeout(const long timeout,
+                           const ParkingLot::TimeoutAction action) {
+        default_timeout_ = timeout;
+        default_timeout_action_ = action;
+        for (auto it = parking_lots_.begin(); it != parking_lots_.end(); ++it) {
+            it->second->setDefaultTimeout(timeout, action);
+        }
+    }
+
     /// @brief Returns pointer to the parking lot for a hook points.
     ///
     /// If the parking lot for the specified hook point doesn't exist, it is
@@ -312,7 +506,10 @@ public:
     /// @return Pointer to the parking lot.
     ParkingLotPtr getParkingLotPtr(const int hook_index) {
         if (parking_lots_.count(hook_index) == 0) {
-            parking_lots_[hook_index] = boost::make_shared<ParkingLot>();
+            ParkingLotPtr parking_lot = boost::make_shared<ParkingLot>();
+            parking_lot->setDefaultTimeout(default_timeout_,
+                                           default_timeout_action_);
+            parking_lots_[hook_index] = parking_lot;
         }
         return (parking_lots_[hook_index]);
     }
@@ -322,6 +519,12 @@ private:
     /// @brief Container holding parking lots for various hook points.
     std::map<int, ParkingLotPtr> parking_lots_;
 
+    /// @brief Default timeout of the parking lots in milliseconds.
+    long default_timeout_;
+
+    /// @brief Default action taken on the objects which timed out.
+    ParkingLot::TimeoutAction default_timeout_action_;
+
 };
 
 /// @brief Type of the pointer to the parking lots.
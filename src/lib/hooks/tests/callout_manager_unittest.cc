@@ -463,6 +463,50 @@ TEST_F(CalloutManagerTest, CallCalloutsError) {
     EXPECT_EQ(11223344, callout_value_);
 }
 
+// Check that the callout execution is timed per hook and library when
+// the timing is enabled.
+
+TEST_F(CalloutManagerTest, CallCalloutsTiming) {
+    getCalloutManager()->setLibraryIndex(1);
+    getCalloutManager()->registerCallout("alpha", callout_one);
+    getCalloutManager()->registerCallout("alpha", callout_one_error);
+    getCalloutManager()->setLibraryIndex(2);
+    getCalloutManager()->registerCallout("alpha", callout_two);
+    getCalloutManager()->registerCallout("beta", callout_two);
+
+    // The timing is disabled by default.
+    EXPECT_FALSE(getCalloutManager()->isTimingEnabled());
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    EXPECT_TRUE(getCalloutManager()->getTimings().empty());
+
+    getCalloutManager()->setTimingEnabled(true);
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    getCalloutManager()->callCallouts(alpha_index_, getCalloutHandle());
+    getCalloutManager()->callCallouts(beta_index_, getCalloutHandle());
+
+    const CalloutTimings& timings = getCalloutManager()->getTimings();
+    ASSERT_EQ(3, timings.size());
+
+    CalloutTimings::const_iterator timing =
+        timings.find(std::make_pair(alpha_index_, 1));
+    ASSERT_TRUE(timing != timings.end());
+    EXPECT_EQ(4, timing->second.calls_);
+    EXPECT_EQ(2, timing->second.errors_);
+    EXPECT_GE(timing->second.total_usec_, timing->second.max_usec_);
+
+    timing = timings.find(std::make_pair(alpha_index_, 2));
+    ASSERT_TRUE(timing != timings.end());
+    EXPECT_EQ(2, timing->second.calls_);
+    EXPECT_EQ(0, timing->second.errors_);
+
+    timing = timings.find(std::make_pair(beta_index_, 2));
+    ASSERT_TRUE(timing != timings.end());
+    EXPECT_EQ(1, timing->second.calls_);
+
+    getCalloutManager()->clearTimings();
+    EXPECT_TRUE(getCalloutManager()->getTimings().empty());
+}
+
 // Now test that we can deregister a single callout on a hook.
 
 TEST_F(CalloutManagerTest, DeregisterSingleCallout) {
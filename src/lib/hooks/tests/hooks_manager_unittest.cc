@@ -657,6 +657,69 @@ TEST_F(HooksManagerTest, LibraryNames) {
     EXPECT_TRUE(loaded_names.empty());
 }
 
+// Check that the callout execution timing can be enabled with a command
+// and the recorded statistics listed and reset.
+
+TEST_F(HooksManagerTest, CalloutTiming) {
+
+    HookLibsCollection library_names;
+    library_names.push_back(make_pair(std::string(FULL_CALLOUT_LIBRARY),
+                                      data::ConstElementPtr()));
+    EXPECT_TRUE(HooksManager::loadLibraries(library_names));
+
+    // The timing is disabled by default.
+    EXPECT_FALSE(HooksManager::isCalloutTimingEnabled());
+    CalloutHandlePtr handle = HooksManager::createCalloutHandle();
+    handle->setArgument("result", static_cast<int>(0));
+    handle->setArgument("data_2", static_cast<int>(15));
+    HooksManager::callCallouts(hookpt_two_index_, *handle);
+    EXPECT_EQ(0, HooksManager::getCalloutTimings()->size());
+
+    // Enable it and call the callouts twice.
+    ConstElementPtr answer =
+        HooksManager::calloutTimingEnableHandler("callout-timing-enable",
+                                                 ConstElementPtr());
+    ASSERT_TRUE(answer);
+    EXPECT_EQ(0, answer->get("result")->intValue());
+    EXPECT_TRUE(HooksManager::isCalloutTimingEnabled());
+    HooksManager::callCallouts(hookpt_two_index_, *handle);
+    HooksManager::callCallouts(hookpt_two_index_, *handle);
+
+    // List and reset the statistics.
+    answer = HooksManager::listCalloutTimingsHandler("list-callout-timings",
+                                                     Element::fromJSON("{ \"reset\": true }"));
+    ASSERT_TRUE(answer);
+    EXPECT_EQ(0, answer->get("result")->intValue());
+    ConstElementPtr args = answer->get("arguments");
+    ASSERT_TRUE(args);
+    EXPECT_TRUE(args->get("enabled")->boolValue());
+    ConstElementPtr timings = args->get("timings");
+    ASSERT_TRUE(timings);
+    ASSERT_EQ(1, timings->size());
+    EXPECT_EQ("hookpt_two", timings->get(0)->get("hook")->stringValue());
+    EXPECT_EQ(FULL_CALLOUT_LIBRARY,
+              timings->get(0)->get("library")->stringValue());
+    EXPECT_EQ(2, timings->get(0)->get("calls")->intValue());
+    EXPECT_EQ(0, timings->get(0)->get("errors")->intValue());
+    EXPECT_EQ(0, HooksManager::getCalloutTimings()->size());
+
+    // Invalid arguments are rejected.
+    answer = HooksManager::listCalloutTimingsHandler("list-callout-timings",
+                                                     Element::fromJSON("{ \"reset\": 1 }"));
+    ASSERT_TRUE(answer);
+    EXPECT_EQ(1, answer->get("result")->intValue());
+
+    // The setting survives the reload of the libraries.
+    EXPECT_TRUE(HooksManager::loadLibraries(library_names));
+    EXPECT_TRUE(HooksManager::isCalloutTimingEnabled());
+
+    answer = HooksManager::calloutTimingDisableHandler("callout-timing-disable",
+                                                       ConstElementPtr());
+    ASSERT_TRUE(answer);
+    EXPECT_EQ(0, answer->get("result")->intValue());
+    EXPECT_FALSE(HooksManager::isCalloutTimingEnabled());
+}
+
 // Test the library validation function.
 
 TEST_F(HooksManagerTest, validateLibraries) {
@@ -9,7 +9,10 @@
 #include <exceptions/exceptions.h>
 #include <hooks/parking_lots.h>
 #include <gtest/gtest.h>
+#include <boost/shared_ptr.hpp>
 #include <string>
+#include <vector>
+#include <unistd.h>
 
 using namespace isc;
 using namespace isc::hooks;
@@ -40,6 +43,33 @@ TEST(ParkingLotsTest, createGetParkingLot) {
     EXPECT_FALSE(parking_lot3 == parking_lot0);
 }
 
+// Test that the default timeout applies to all parking lots unless the
+// timeout is set for the parking lot.
+TEST(ParkingLotsTest, defaultTimeout) {
+    ParkingLots parking_lots;
+    ParkingLotPtr parking_lot0 = parking_lots.getParkingLotPtr(1);
+    ParkingLotPtr parking_lot1 = parking_lots.getParkingLotPtr(2);
+    parking_lot1->setTimeout(500, ParkingLot::TIMEOUT_UNPARK);
+
+    parking_lots.setDefaultTimeout(2000, ParkingLot::TIMEOUT_DROP);
+    EXPECT_EQ(2000, parking_lot0->getTimeout());
+    EXPECT_EQ(ParkingLot::TIMEOUT_DROP, parking_lot0->getTimeoutAction());
+    EXPECT_EQ(500, parking_lot1->getTimeout());
+    EXPECT_EQ(ParkingLot::TIMEOUT_UNPARK, parking_lot1->getTimeoutAction());
+
+    // The parking lots created later and after clearing use the default.
+    EXPECT_EQ(2000, parking_lots.getParkingLotPtr(3)->getTimeout());
+    ASSERT_NO_THROW(parking_lots.clear());
+    EXPECT_EQ(2000, parking_lots.getParkingLotPtr(2)->getTimeout());
+
+    // The timeout set for the parking lot takes precedence.
+    ParkingLotPtr parking_lot2 = parking_lots.getParkingLotPtr(2);
+    parking_lot2->setTimeout(0, ParkingLot::TIMEOUT_DROP);
+    parking_lots.setDefaultTimeout(3000, ParkingLot::TIMEOUT_DROP);
+    EXPECT_EQ(0, parking_lot2->getTimeout());
+    EXPECT_EQ(3000, parking_lots.getParkingLotPtr(1)->getTimeout());
+}
+
 // Test that object can't be parked if it hasn't been referenced on the
 // parking lot.
 TEST(ParkingLotTest, parkWithoutReferencing) {
@@ -111,4 +141,106 @@ TEST(ParkingLotTest, drop) {
     EXPECT_FALSE(parking_lot_handle->unpark(parked_object));
 }
 
+// Test that many objects can be parked and unparked in any order and
+// that the parking statistics are maintained.
+TEST(ParkingLotTest, manyObjects) {
+    ParkingLot parking_lot;
+
+    std::vector<boost::shared_ptr<int> > objects;
+    for (int i = 0; i < 1000; ++i) {
+        objects.push_back(boost::shared_ptr<int>(new int(i)));
+    }
+
+    int unparked = 0;
+    for (auto object = objects.begin(); object != objects.end(); ++object) {
+        ASSERT_NO_THROW(parking_lot.reference(*object));
+        ASSERT_NO_THROW(parking_lot.park(*object, [&unparked] {
+            ++unparked;
+        }));
+    }
+    EXPECT_EQ(1000, parking_lot.size());
+    EXPECT_EQ(1000, parking_lot.getMaxSize());
+
+    // An object which hasn't been parked can't be unparked.
+    EXPECT_FALSE(parking_lot.unpark(boost::shared_ptr<int>(new int(0))));
+
+    for (auto object = objects.rbegin(); object != objects.rend(); ++object) {
+        EXPECT_TRUE(parking_lot.unpark(*object));
+    }
+    EXPECT_EQ(1000, unparked);
+    EXPECT_EQ(0, parking_lot.size());
+    EXPECT_EQ(1000, parking_lot.getMaxSize());
+    EXPECT_EQ(0, parking_lot.getTimedOut());
+}
+
+// Test that parked objects don't time out by default.
+TEST(ParkingLotTest, noTimeout) {
+    ParkingLot parking_lot;
+    EXPECT_EQ(0, parking_lot.getTimeout());
+
+    std::string parked_object = "foo";
+    ASSERT_NO_THROW(parking_lot.reference(parked_object));
+    ASSERT_NO_THROW(parking_lot.park(parked_object, [] { }));
+
+    EXPECT_EQ(0, parking_lot.expire());
+    EXPECT_EQ(1, parking_lot.size());
+}
+
+// Test that the objects parked for longer than the timeout are dropped
+// without invoking the callback.
+TEST(ParkingLotTest, timeoutDrop) {
+    ParkingLot parking_lot;
+    parking_lot.setTimeout(1, ParkingLot::TIMEOUT_DROP);
+    EXPECT_EQ(1, parking_lot.getTimeout());
+    EXPECT_EQ(ParkingLot::TIMEOUT_DROP, parking_lot.getTimeoutAction());
+
+    std::string parked_object = "foo";
+    ASSERT_NO_THROW(parking_lot.reference(parked_object));
+    bool unparked = false;
+    ASSERT_NO_THROW(parking_lot.park(parked_object, [&unparked] {
+        unparked = true;
+    }));
+
+    usleep(10000);
+    EXPECT_EQ(1, parking_lot.expire());
+    EXPECT_FALSE(unparked);
+    EXPECT_EQ(0, parking_lot.size());
+    EXPECT_EQ(1, parking_lot.getTimedOut());
+
+    // The object is gone.
+    EXPECT_FALSE(parking_lot.unpark(parked_object));
+}
+
+// Test that the objects parked for longer than the timeout are unparked
+// and that the objects parked for a shorter time are kept.
+TEST(ParkingLotTest, timeoutUnpark) {
+    ParkingLotPtr parking_lot = boost::make_shared<ParkingLot>();
+    ParkingLotHandlePtr parking_lot_handle =
+        boost::make_shared<ParkingLotHandle>(parking_lot);
+    parking_lot_handle->setTimeout(1, ParkingLot::TIMEOUT_UNPARK);
+
+    std::string parked_object = "foo";
+    ASSERT_NO_THROW(parking_lot_handle->reference(parked_object));
+    bool unparked = false;
+    ASSERT_NO_THROW(parking_lot->park(parked_object, [&unparked] {
+        unparked = true;
+    }));
+
+    usleep(10000);
+
+    // Park another object just before the expiration: it must be kept.
+    parking_lot_handle->setTimeout(1000, ParkingLot::TIMEOUT_UNPARK);
+    std::string other_object = "bar";
+    ASSERT_NO_THROW(parking_lot_handle->reference(other_object));
+    ASSERT_NO_THROW(parking_lot->park(other_object, [] { }));
+    EXPECT_EQ(0, parking_lot->expire());
+
+    parking_lot_handle->setTimeout(1, ParkingLot::TIMEOUT_UNPARK);
+    usleep(10000);
+    EXPECT_EQ(2, parking_lot->expire());
+    EXPECT_TRUE(unparked);
+    EXPECT_EQ(0, parking_lot->size());
+    EXPECT_EQ(2, parking_lot->getTimedOut());
+}
+
 }
@@ -18,8 +18,10 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/weak_ptr.hpp>
 #include <array>
+#include <chrono>
 #include <map>
 #include <queue>
+#include <vector>
 
 #include <iostream>
 
@@ -80,6 +82,9 @@ class ConnectionPool;
 /// @brief Shared pointer to a connection pool.
 typedef boost::shared_ptr<ConnectionPool> ConnectionPoolPtr;
 
+/// @brief Shared pointer to the statistics of a destination.
+typedef boost::shared_ptr<HttpClient::Statistics> StatisticsPtr;
+
 /// @brief Client side HTTP connection to the server.
 ///
 /// Each connection is established with a unique destination identified by the
@@ -92,6 +97,10 @@ typedef boost::shared_ptr<ConnectionPool> ConnectionPoolPtr;
 /// the new request is stored in the FIFO queue. The queued requests to the
 /// particular URL are sent to the server when the current transaction ends.
 ///
+/// If the connection is persistent and no request is queued when the
+/// transaction ends, the idle timer is started. If no transaction is started
+/// before the idle timer expires, the socket is closed.
+///
 /// The communication over the TCP socket is asynchronous. The caller is notified
 /// about the completion of the transaction via a callback that the caller supplies
 /// when initiating the transaction.
@@ -104,8 +113,12 @@ public:
     /// @param conn_pool Back pointer to the connection pool to which this connection
     /// belongs.
     /// @param url URL associated with this connection.
+    /// @param stats Pointer to the statistics of the destination.
+    /// @param idle_timeout Idle timeout in milliseconds. The value of 0
+    /// disables closing the idle connection.
     explicit Connection(IOService& io_service, const ConnectionPoolPtr& conn_pool,
-                        const Url& url);
+                        const Url& url, const StatisticsPtr& stats,
+                        const long idle_timeout);
 
     /// @brief Destructor.
     ~Connection();
@@ -199,6 +212,11 @@ private:
     /// @brief Local callback invoked when request timeout occurs.
     void timerCallback();
 
+    /// @brief Local callback invoked when idle timeout occurs.
+    ///
+    /// It closes the socket.
+    void idleTimerCallback();
+
     /// @brief Pointer to the connection pool owning this connection.
     ///
     /// This is a weak pointer to avoid circular dependency between the
@@ -214,6 +232,18 @@ private:
     /// @brief Interval timer used for detecting request timeouts.
     IntervalTimer timer_;
 
+    /// @brief Interval timer used for closing idle connection.
+    IntervalTimer idle_timer_;
+
+    /// @brief Idle timeout in milliseconds.
+    long idle_timeout_;
+
+    /// @brief Statistics of the destination.
+    StatisticsPtr stats_;
+
+    /// @brief Time when the current transaction has started.
+    std::chrono::steady_clock::time_point start_time_;
+
     /// @brief Holds currently sent request.
     HttpRequestPtr current_request_;
 
@@ -250,8 +280,13 @@ public:
     ///
     /// @param io_service Reference to the IO service to be used by the
     /// connections.
-    explicit ConnectionPool(IOService& io_service)
-        : io_service_(io_service), conns_(), queue_() {
+    /// @param max_url_connections Maximum number of connections to the
+    /// same URL.
+    /// @param idle_timeout Idle timeout of the connections in milliseconds.
+    ConnectionPool(IOService& io_service, const size_t max_url_connections,
+                   const long idle_timeout)
+        : io_service_(io_service), max_url_connections_(max_url_connections),
+          idle_timeout_(idle_timeout), conns_(), queue_(), stats_() {
     }
 
     /// @brief Destructor.
@@ -298,8 +333,10 @@ public:
 
     /// @brief Queue next request for sending to the server.
     ///
-    /// A new transaction is started immediatelly, if there is no other request
-    /// in progress for the given URL. Otherwise, the request is queued.
+    /// A new transaction is started immediatelly over an idle connection to
+    /// the given URL. If there is no idle connection, a new connection is
+    /// created unless the maximum number of connections to the URL has been
+    /// reached. Otherwise, the request is queued.
     ///
     /// @param url Destination where the request should be sent.
     /// @param request Pointer to the request to be sent to the server.
@@ -314,29 +351,32 @@ public:
                       const HttpResponsePtr& response,
                       const long request_timeout,
                       const HttpClient::RequestHandler& callback) {
-        auto it = conns_.find(url);
-        if (it != conns_.end()) {
-            ConnectionPtr conn = it->second;
-            // There is a connection for this URL already. Check if it is idle.
-            if (conn->isTransactionOngoing()) {
-                // Connection is busy, so let's queue the request.
-                queue_[url].push(RequestDescriptor(request, response,
-                                                   request_timeout,
-                                                   callback));
-
-            } else {
-                // Connection is idle, so we can start the transaction.
-                conn->doTransaction(request, response, request_timeout,
-                                    callback);
+        std::vector<ConnectionPtr>& conns = conns_[url];
+
+        // Use any idle connection with this destination.
+        for (auto conn = conns.begin(); conn != conns.end(); ++conn) {
+            if (!(*conn)->isTransactionOngoing()) {
+                (*conn)->doTransaction(request, response, request_timeout,
+                                       callback);
+                return;
             }
+        }
 
-        } else {
-            // There is no connection with this destination yet. Let's create
-            // it and start the transaction.
+        if (conns.size() < max_url_connections_) {
+            // All connections with this destination are busy but we can
+            // create another one and start the transaction.
             ConnectionPtr conn(new Connection(io_service_, shared_from_this(),
-                                              url));
+                                              url, getStatistics(url),
+                                              idle_timeout_));
             conn->doTransaction(request, response, request_timeout, callback);
-            conns_[url] = conn;
+            conns.push_back(conn);
+
+        } else {
+            // All connections are busy, so let's queue the request.
+            ++getStatistics(url)->requests_queued_;
+            queue_[url].push(RequestDescriptor(request, response,
+                                               request_timeout,
+                                               callback));
         }
     }
 
@@ -345,10 +385,13 @@ public:
     ///
     /// @param url URL for which connection shuld be closed.
     void closeConnection(const Url& url) {
-        // Close connection for the specified URL.
+        // Close connections for the specified URL.
         auto conns_it = conns_.find(url);
         if (conns_it != conns_.end()) {
-            conns_it->second->close();
+            for (auto conn = conns_it->second.begin();
+                 conn != conns_it->second.end(); ++conn) {
+                (*conn)->close();
+            }
             conns_.erase(conns_it);
         }
 
@@ -364,20 +407,56 @@ public:
     void closeAll() {
         for (auto conns_it = conns_.begin(); conns_it != conns_.end();
              ++conns_it) {
-            conns_it->second->close();
+            for (auto conn = conns_it->second.begin();
+                 conn != conns_it->second.end(); ++conn) {
+                (*conn)->close();
+            }
         }
 
         conns_.clear();
         queue_.clear();
     }
 
+    /// @brief Returns statistics of the given URL.
+    ///
+    /// @param url URL for which statistics should be returned.
+    ///
+    /// @return Pointer to the statistics. The statistics are created if
+    /// they don't exist for the URL.
+    StatisticsPtr getStatistics(const Url& url) {
+        StatisticsPtr& stats = stats_[url];
+        if (!stats) {
+            stats.reset(new HttpClient::Statistics());
+        }
+        return (stats);
+    }
+
+    /// @brief Returns copy of the statistics of the given URL.
+    ///
+    /// @param url URL for which statistics should be returned.
+    ///
+    /// @return Statistics of the URL or zero statistics if there are none.
+    HttpClient::Statistics getStatistics(const Url& url) const {
+        auto stats_it = stats_.find(url);
+        if (stats_it != stats_.end()) {
+            return (*stats_it->second);
+        }
+        return (HttpClient::Statistics());
+    }
+
 private:
 
     /// @brief Holds reference to the IO service.
     IOService& io_service_;
 
+    /// @brief Maximum number of connections to the same URL.
+    size_t max_url_connections_;
+
+    /// @brief Idle timeout of the connections in milliseconds.
+    long idle_timeout_;
+
     /// @brief Holds mapping of URLs to connections.
-    std::map<Url, ConnectionPtr> conns_;
+    std::map<Url, std::vector<ConnectionPtr> > conns_;
 
     /// @brief Request descriptor holds parameters associated with the
     /// particular request.
@@ -410,14 +489,19 @@ private:
 
     /// @brief Holds the queue of requests for different URLs.
     std::map<Url, std::queue<RequestDescriptor> > queue_;
+
+    /// @brief Holds statistics of the different URLs.
+    std::map<Url, StatisticsPtr> stats_;
 };
 
 Connection::Connection(IOService& io_service,
                        const ConnectionPoolPtr& conn_pool,
-                       const Url& url)
+                       const Url& url, const StatisticsPtr& stats,
+                       const long idle_timeout)
     : conn_pool_(conn_pool), url_(url), socket_(io_service), timer_(io_service),
-      current_request_(), current_response_(), parser_(), current_callback_(),
-      buf_(), input_buf_() {
+      idle_timer_(io_service), idle_timeout_(idle_timeout), stats_(stats),
+      start_time_(), current_request_(), current_response_(), parser_(),
+      current_callback_(), buf_(), input_buf_() {
 }
 
 Connection::~Connection() {
@@ -446,6 +530,10 @@ Connection::doTransaction(const HttpRequestPtr& request,
 
         buf_ = request->toString();
 
+        // The connection is no longer idle.
+        idle_timer_.cancel();
+        start_time_ = std::chrono::steady_clock::now();
+
         // If the socket is open we check if it is possible to transmit the data
         // over this socket by reading from it with message peeking. If the socket
         // is not usable, we close it and then re-open it. There is a narrow window of
@@ -456,6 +544,13 @@ Connection::doTransaction(const HttpRequestPtr& request,
             socket_.close();
         }
 
+        if (socket_.getASIOSocket().is_open()) {
+            ++stats_->connections_reused_;
+
+        } else {
+            ++stats_->connections_opened_;
+        }
+
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
                   HTTP_CLIENT_REQUEST_SEND)
             .arg(request->toBriefString())
@@ -487,6 +582,7 @@ Connection::doTransaction(const HttpRequestPtr& request,
 void
 Connection::close() {
     timer_.cancel();
+    idle_timer_.cancel();
     socket_.close();
     resetState();
 }
@@ -505,8 +601,18 @@ Connection::terminate(const boost::system::error_code& ec,
 
     HttpResponsePtr response;
 
+    // Update the statistics of the destination.
+    const uint64_t latency = static_cast<uint64_t>
+        (std::chrono::duration_cast<std::chrono::microseconds>
+         (std::chrono::steady_clock::now() - start_time_).count());
+    stats_->total_latency_ += latency;
+    if (latency > stats_->max_latency_) {
+        stats_->max_latency_ = latency;
+    }
+
     if (!ec && current_response_->isFinalized()) {
         response = current_response_;
+        ++stats_->requests_completed_;
 
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC,
                   HTTP_SERVER_RESPONSE_RECEIVED)
@@ -518,6 +624,8 @@ Connection::terminate(const boost::system::error_code& ec,
             .arg(parser_->getBufferAsString(MAX_LOGGED_MESSAGE_SIZE));
 
     } else {
+        ++stats_->requests_failed_;
+
         std::string err = parsing_error.empty() ? ec.message() : parsing_error;
 
         LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_BASIC,
@@ -561,6 +669,11 @@ Connection::terminate(const boost::system::error_code& ec,
     if (conn_pool && conn_pool->getNextRequest(url_, request, response, request_timeout,
                                                callback)) {
         doTransaction(request, response, request_timeout, callback);
+
+    } else if ((idle_timeout_ > 0) && socket_.getASIOSocket().is_open()) {
+        // Close the persistent connection if it is not used for a while.
+        idle_timer_.setup(boost::bind(&Connection::idleTimerCallback, this),
+                          idle_timeout_, IntervalTimer::ONE_SHOT);
     }
 }
 
@@ -708,6 +821,18 @@ Connection::timerCallback() {
     terminate(boost::asio::error::timed_out);
 }
 
+void
+Connection::idleTimerCallback() {
+    if (!isTransactionOngoing()) {
+        LOG_DEBUG(http_logger, isc::log::DBGLVL_TRACE_DETAIL,
+                  HTTP_CLIENT_IDLE_CONNECTION_CLOSED)
+            .arg(url_.toText());
+
+        ++stats_->connections_idle_closed_;
+        socket_.close();
+    }
+}
+
 }
 
 namespace isc {
@@ -720,8 +845,15 @@ public:
     /// @brief Constructor.
     ///
     /// Creates new connection pool.
-    HttpClientImpl(IOService& io_service)
-        : conn_pool_(new ConnectionPool(io_service)) {
+    ///
+    /// @param io_service IO service to be used by the connections.
+    /// @param max_url_connections Maximum number of connections to the
+    /// same URL.
+    /// @param idle_timeout Idle timeout of the connections in milliseconds.
+    HttpClientImpl(IOService& io_service, const size_t max_url_connections,
+                   const long idle_timeout)
+        : conn_pool_(new ConnectionPool(io_service, max_url_connections,
+                                        idle_timeout)) {
     }
 
     /// @brief Holds a pointer to the connection pool.
@@ -729,8 +861,28 @@ public:
 
 };
 
-HttpClient::HttpClient(IOService& io_service)
-    : impl_(new HttpClientImpl(io_service)) {
+HttpClient::Statistics::Statistics()
+    : connections_opened_(0), connections_reused_(0),
+      connections_idle_closed_(0), requests_completed_(0),
+      requests_failed_(0), requests_queued_(0), total_latency_(0),
+      max_latency_(0) {
+}
+
+uint64_t
+HttpClient::Statistics::getMeanLatency() const {
+    const uint64_t count = requests_completed_ + requests_failed_;
+    return (count > 0 ? total_latency_ / count : 0);
+}
+
+HttpClient::HttpClient(IOService& io_service, const size_t max_url_connections,
+                       const long idle_timeout)
+    : impl_() {
+    if (max_url_connections == 0) {
+        isc_throw(HttpClientError, "maximum number of connections to the"
+                  " same URL must be greater than 0");
+    }
+    impl_.reset(new HttpClientImpl(io_service, max_url_connections,
+                                   idle_timeout));
 }
 
 void
@@ -763,5 +915,11 @@ HttpClient::stop() {
     impl_->conn_pool_->closeAll();
 }
 
+HttpClient::Statistics
+HttpClient::getStatistics(const Url& url) const {
+    const ConnectionPool& conn_pool = *impl_->conn_pool_;
+    return (conn_pool.getStatistics(url));
+}
+
 } // end of namespace isc::http
 } // end of namespace isc
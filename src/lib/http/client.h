@@ -14,6 +14,7 @@
 #include <http/response.h>
 #include <boost/shared_ptr.hpp>
 #include <functional>
+#include <stdint.h>
 #include <string>
 
 namespace isc {
@@ -59,6 +60,20 @@ class HttpClientImpl;
 /// a request by trying to read from the socket (with message peeking). If
 /// the socket is usable the client uses it to transmit the request.
 ///
+/// The client may open more than one connection to the same destination,
+/// up to the number specified in the constructor. In this case, the new
+/// request is sent over any idle connection to the destination. If all
+/// connections are busy and the limit of connections has not been reached,
+/// a new connection is opened. Otherwise, the request is queued. Note that
+/// the responses to the requests sent over different connections may be
+/// received in a different order than the requests were sent. The persistent
+/// connection which hasn't been used for the specified idle timeout is
+/// closed by the client, to avoid sending requests over the connections
+/// being closed by the server.
+///
+/// The client gathers the statistics of the communication with each
+/// destination, which can be retrieved with @ref HttpClient::getStatistics.
+///
 /// All errors are reported to the caller via the callback function supplied
 /// to the @ref HttpClient::asyncSendRequest. The IO errors are communicated
 /// via the @c boost::system::error code value. The response parsing errors
@@ -82,20 +97,55 @@ public:
                                const HttpResponsePtr&,
                                const std::string&)> RequestHandler;
 
+    /// @brief Statistics of the communication with a destination.
+    ///
+    /// The latencies are expressed in microseconds and measured from
+    /// starting the transaction over a connection until the response is
+    /// received or an error occurs.
+    struct Statistics {
+        /// @brief Constructor.
+        Statistics();
+
+        /// @brief Returns mean latency of the transactions.
+        ///
+        /// @return Mean latency in microseconds or 0 if no transactions
+        /// have completed.
+        uint64_t getMeanLatency() const;
+
+        uint64_t connections_opened_;      ///< Connections (re)opened.
+        uint64_t connections_reused_;      ///< Transactions over an open connection.
+        uint64_t connections_idle_closed_; ///< Connections closed when idle.
+        uint64_t requests_completed_;      ///< Transactions with a response.
+        uint64_t requests_failed_;         ///< Transactions ended with an error.
+        uint64_t requests_queued_;         ///< Requests queued as connections were busy.
+        uint64_t total_latency_;           ///< Sum of the latencies.
+        uint64_t max_latency_;             ///< Highest latency.
+    };
+
     /// @brief Constructor.
     ///
     /// @param io_service IO service to be used by the HTTP client.
-    explicit HttpClient(asiolink::IOService& io_service);
+    /// @param max_url_connections Maximum number of simultaneous connections
+    /// to the same destination. It must be greater than 0.
+    /// @param idle_timeout Timeout in milliseconds after which an idle
+    /// persistent connection is closed. The value of 0 disables closing
+    /// the idle connections by the client.
+    ///
+    /// @throw HttpClientError if the maximum number of connections is 0.
+    explicit HttpClient(asiolink::IOService& io_service,
+                        const size_t max_url_connections = 1,
+                        const long idle_timeout = 0);
 
     /// @brief Queues new asynchronous HTTP request.
     ///
-    /// The client creates one connection for the specified URL. If the
+    /// The client creates connections for the specified URL, up to the
+    /// maximum number of connections specified in the constructor. If an idle
     /// connection with the particular destination already exists, it will be
-    /// re-used for the new transaction scheduled with this call. If another
-    /// transaction is still in progress, the new transaction is queued. The
-    /// queued transactions are started in the FIFO order one after another. If
-    /// the connection is idle or the connection doesn't exist, the new
-    /// transaction is started immediatelly.
+    /// re-used for the new transaction scheduled with this call. If all
+    /// connections are busy and no new connection can be created, the new
+    /// transaction is queued. The queued transactions are started in the FIFO
+    /// order as the connections become idle. Otherwise, the new transaction
+    /// is started immediatelly.
     ///
     /// The existing connection is tested before it is used for the new
     /// transaction by attempting to read (with message peeking) from the open
@@ -155,6 +205,16 @@ public:
     /// @brief Closes all connections.
     void stop();
 
+    /// @brief Returns statistics of the communication with a destination.
+    ///
+    /// The statistics are retained when the connections are closed.
+    ///
+    /// @param url URL of the destination.
+    ///
+    /// @return Statistics of the destination. All values are 0 if no
+    /// request has been sent to this destination.
+    Statistics getStatistics(const Url& url) const;
+
 private:
 
     /// @brief Pointer to the HTTP client implementation.
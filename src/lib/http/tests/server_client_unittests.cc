@@ -26,6 +26,7 @@
 #include <list>
 #include <sstream>
 #include <string>
+#include <vector>
 
 using namespace boost::asio::ip;
 using namespace isc::asiolink;
@@ -1250,4 +1251,103 @@ TEST_F(HttpClientTest, clientRequestTimeout) {
 }
 
 
+// Test that the client opens multiple connections to the same destination
+// and queues the requests when all connections are busy.
+TEST_F(HttpClientTest, parallelConnections) {
+    // Start the server.
+    ASSERT_NO_THROW(listener_.start());
+
+    // Create the client allowing two connections to the same destination.
+    HttpClient client(io_service_, 2);
+
+    // Specify the URL of the server.
+    Url url("http://127.0.0.1:18123");
+
+    // Send three requests. Two of them should be sent over the separate
+    // connections and the third one should be queued.
+    std::vector<HttpResponseJsonPtr> responses;
+    unsigned resp_num = 0;
+    for (int i = 0; i < 3; ++i) {
+        PostHttpRequestJsonPtr request = createRequest("sequence", i);
+        HttpResponseJsonPtr response(new HttpResponseJson());
+        responses.push_back(response);
+        ASSERT_NO_THROW(client.asyncSendRequest(url, request, response,
+            [this, &resp_num](const boost::system::error_code& ec,
+                              const HttpResponsePtr&,
+                              const std::string&) {
+            if (++resp_num > 2) {
+                io_service_.stop();
+            }
+            EXPECT_FALSE(ec);
+        }));
+    }
+
+    ASSERT_NO_THROW(runIOService());
+
+    // Each request should have received its own response.
+    for (int i = 0; i < 3; ++i) {
+        ConstElementPtr sequence = responses[i]->getJsonElement("sequence");
+        ASSERT_TRUE(sequence);
+        EXPECT_EQ(i, sequence->intValue());
+    }
+
+    HttpClient::Statistics stats = client.getStatistics(url);
+    EXPECT_EQ(2, stats.connections_opened_);
+    EXPECT_EQ(1, stats.connections_reused_);
+    EXPECT_EQ(1, stats.requests_queued_);
+    EXPECT_EQ(3, stats.requests_completed_);
+    EXPECT_EQ(0, stats.requests_failed_);
+    EXPECT_GT(stats.max_latency_, 0);
+    EXPECT_LE(stats.getMeanLatency(), stats.max_latency_);
+
+    // There are no statistics for other destinations.
+    stats = client.getStatistics(Url("http://[::1]:18124"));
+    EXPECT_EQ(0, stats.connections_opened_);
+    EXPECT_EQ(0, stats.requests_completed_);
+    EXPECT_EQ(0, stats.getMeanLatency());
+}
+
+// Test that the client closes the persistent connection which is idle
+// for longer than the idle timeout.
+TEST_F(HttpClientTest, clientIdleTimeout) {
+    // Start the server.
+    ASSERT_NO_THROW(listener_.start());
+
+    // Create the client with the idle timeout of 100 ms.
+    HttpClient client(io_service_, 1, 100);
+
+    // Specify the URL of the server.
+    Url url("http://127.0.0.1:18123");
+
+    for (int i = 0; i < 2; ++i) {
+        PostHttpRequestJsonPtr request = createRequest("sequence", i);
+        HttpResponseJsonPtr response(new HttpResponseJson());
+        ASSERT_NO_THROW(client.asyncSendRequest(url, request, response,
+            [this](const boost::system::error_code& ec,
+                   const HttpResponsePtr&,
+                   const std::string&) {
+            io_service_.stop();
+            EXPECT_FALSE(ec);
+        }));
+        ASSERT_NO_THROW(runIOService());
+
+        // Let the connection be idle for longer than the idle timeout.
+        ASSERT_NO_THROW(runIOService(300));
+    }
+
+    // The connection should have been closed by the client after each
+    // request and reopened for the second request.
+    HttpClient::Statistics stats = client.getStatistics(url);
+    EXPECT_EQ(2, stats.connections_opened_);
+    EXPECT_EQ(0, stats.connections_reused_);
+    EXPECT_EQ(2, stats.connections_idle_closed_);
+    EXPECT_EQ(2, stats.requests_completed_);
+}
+
+// Test that the maximum number of connections to the same destination
+// must be greater than 0.
+TEST_F(HttpClientTest, zeroMaxConnections) {
+    EXPECT_THROW(HttpClient(io_service_, 0), HttpClientError);
+}
+
 }
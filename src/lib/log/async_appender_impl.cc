@@ -0,0 +1,145 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <log/async_appender_impl.h>
+
+#include <boost/bind.hpp>
+
+#include <algorithm>
+
+using namespace isc::util::thread;
+
+namespace {
+
+/// Number of the events dropped by all asynchronous appenders.
+std::atomic<uint64_t> dropped_total(0);
+
+}
+
+namespace isc {
+namespace log {
+namespace internal {
+
+AsyncAppender::AsyncAppender(const log4cplus::SharedAppenderPtr& target,
+                             const size_t queue_size,
+                             const OutputOption::Overflow overflow)
+    : target_(target), ring_(std::max(queue_size, static_cast<size_t>(1))),
+      head_(0), tail_(0), overflow_(overflow), dropped_(0),
+      writer_waiting_(false), producer_waiting_(false), stopping_(false),
+      mutex_(), event_cond_(), space_cond_(), writer_() {
+    writer_.reset(new Thread(boost::bind(&AsyncAppender::run, this)));
+}
+
+AsyncAppender::~AsyncAppender() {
+    try {
+        destructorImpl();
+    } catch (...) {
+        // The destructor must not throw.
+    }
+}
+
+void
+AsyncAppender::close() {
+    if (closed) {
+        return;
+    }
+    {
+        Mutex::Locker lock(mutex_);
+        stopping_ = true;
+        event_cond_.signal();
+        space_cond_.signal();
+    }
+    // The writer thread writes the remaining events before it terminates.
+    writer_->wait();
+    target_->close();
+    closed = true;
+}
+
+uint64_t
+AsyncAppender::getDroppedTotal() {
+    return (dropped_total.load());
+}
+
+void
+AsyncAppender::append(const log4cplus::spi::InternalLoggingEvent& event) {
+    const uint64_t tail = tail_.load();
+    if (tail - head_.load() >= ring_.size()) {
+        if (overflow_ == OutputOption::OVERFLOW_DROP) {
+            ++dropped_;
+            ++dropped_total;
+            return;
+        }
+
+        // Wait for the writer thread to take an event from the buffer.
+        // The flag is set before checking the buffer again, so the writer
+        // thread either sees the flag or this thread sees the free space.
+        Mutex::Locker lock(mutex_);
+        producer_waiting_.store(true);
+        while ((tail - head_.load() >= ring_.size()) && !stopping_) {
+            space_cond_.wait(mutex_);
+        }
+        producer_waiting_.store(false);
+        if (stopping_) {
+            ++dropped_;
+            ++dropped_total;
+            return;
+        }
+    }
+
+    // The slot has been emptied by the writer thread.
+    ring_[tail % ring_.size()].reset(event.clone().release());
+    tail_.store(tail + 1);
+
+    if (writer_waiting_.load()) {
+        Mutex::Locker lock(mutex_);
+        event_cond_.signal();
+    }
+}
+
+void
+AsyncAppender::run() {
+    while (waitForEvent()) {
+        const uint64_t head = head_.load();
+        LogEventPtr event;
+        event.swap(ring_[head % ring_.size()]);
+        head_.store(head + 1);
+
+        if (producer_waiting_.load()) {
+            Mutex::Locker lock(mutex_);
+            space_cond_.signal();
+        }
+
+        try {
+            target_->doAppend(*event);
+        } catch (...) {
+            // There is nowhere to report the failure to write a log
+            // message, so the event is lost as if it was dropped.
+        }
+    }
+}
+
+bool
+AsyncAppender::waitForEvent() {
+    if (tail_.load() != head_.load()) {
+        return (true);
+    }
+
+    // The flag is set before checking the buffer again, so the logging
+    // thread either sees the flag or this thread sees the new event.
+    Mutex::Locker lock(mutex_);
+    writer_waiting_.store(true);
+    while ((tail_.load() == head_.load()) && !stopping_) {
+        event_cond_.wait(mutex_);
+    }
+    writer_waiting_.store(false);
+    return (tail_.load() != head_.load());
+}
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
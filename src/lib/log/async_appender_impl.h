@@ -0,0 +1,138 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LOG_ASYNC_APPENDER_H
+#define LOG_ASYNC_APPENDER_H
+
+#include <log/buffer_appender_impl.h>
+#include <log/output_option.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <log4cplus/appender.h>
+#include <log4cplus/spi/loggingevent.h>
+#include <boost/scoped_ptr.hpp>
+
+#include <atomic>
+#include <vector>
+
+namespace isc {
+namespace log {
+namespace internal {
+
+/// \brief Asynchronous Logger Appender
+///
+/// This appender passes the logging events to another appender (console,
+/// file or syslog) in a background thread, so the thread logging a message
+/// doesn't wait for the message to be formatted by the layout and written.
+///
+/// The events are copied into a bounded ring buffer. The logging calls are
+/// serialized by the \c LoggerManager mutex, so the ring buffer has a single
+/// producer and a single consumer (the writer thread) and it is accessed
+/// without locks. The mutex of this class is only used to put the writer
+/// thread to sleep when the buffer is empty and the logging thread when
+/// the buffer is full and the overflow policy is to block.
+///
+/// With the drop policy, the events which don't fit in the buffer are
+/// discarded and counted. The counter of all asynchronous appenders in
+/// the process is returned by \c getDroppedTotal.
+///
+/// The events remaining in the buffer are written when the appender is
+/// closed, i.e. when the logging is reconfigured or the appender is
+/// destroyed.
+class AsyncAppender : public log4cplus::Appender {
+public:
+    /// \brief Constructor
+    ///
+    /// Starts the writer thread.
+    ///
+    /// \param target Appender writing the events.
+    /// \param queue_size Maximum number of events waiting to be written.
+    /// \param overflow Action taken when the buffer is full.
+    AsyncAppender(const log4cplus::SharedAppenderPtr& target,
+                  const size_t queue_size,
+                  const OutputOption::Overflow overflow);
+
+    /// \brief Destructor
+    ///
+    /// Closes the appender if it hasn't been closed.
+    virtual ~AsyncAppender();
+
+    /// \brief Close the appender
+    ///
+    /// Waits for the writer thread to write the remaining events, stops it
+    /// and closes the target appender.
+    virtual void close();
+
+    /// \brief Returns the number of events dropped by this appender.
+    uint64_t getDropped() const {
+        return (dropped_.load());
+    }
+
+    /// \brief Returns the number of events dropped by all asynchronous
+    /// appenders since the process start.
+    static uint64_t getDroppedTotal();
+
+protected:
+    /// \brief Queue the event to be written by the writer thread.
+    virtual void append(const log4cplus::spi::InternalLoggingEvent& event);
+
+private:
+    /// \brief Body of the writer thread.
+    void run();
+
+    /// \brief Wait until there is an event in the buffer.
+    ///
+    /// \return false if the appender is closed and all events have been
+    /// written, true otherwise.
+    bool waitForEvent();
+
+    /// \brief Target appender.
+    log4cplus::SharedAppenderPtr target_;
+
+    /// \brief Ring buffer of the events.
+    std::vector<LogEventPtr> ring_;
+
+    /// \brief Number of the events taken from the buffer.
+    std::atomic<uint64_t> head_;
+
+    /// \brief Number of the events put into the buffer.
+    std::atomic<uint64_t> tail_;
+
+    /// \brief Action taken when the buffer is full.
+    const OutputOption::Overflow overflow_;
+
+    /// \brief Number of the dropped events.
+    std::atomic<uint64_t> dropped_;
+
+    /// \brief Indicates if the writer thread waits for events.
+    std::atomic<bool> writer_waiting_;
+
+    /// \brief Indicates if the logging thread waits for space in the buffer.
+    std::atomic<bool> producer_waiting_;
+
+    /// \brief Indicates if the writer thread should terminate.
+    bool stopping_;
+
+    /// \brief Mutex protecting the condition variables.
+    isc::util::thread::Mutex mutex_;
+
+    /// \brief Signalled when an event is put into the empty buffer or the
+    /// appender is closed.
+    isc::util::thread::CondVar event_cond_;
+
+    /// \brief Signalled when an event is taken from the full buffer.
+    isc::util::thread::CondVar space_cond_;
+
+    /// \brief Writer thread.
+    boost::scoped_ptr<isc::util::thread::Thread> writer_;
+};
+
+} // end namespace internal
+} // end namespace log
+} // end namespace isc
+
+#endif // LOG_ASYNC_APPENDER_H
@@ -557,13 +557,10 @@ main(int argc, char* argv[]) {
         text += ", ";
         text += global->getText(e.id());
         // Format with arguments
-        vector<string> args(e.arguments());
-        for (size_t i(0); i < args.size(); ++ i) {
-            try {
-                replacePlaceholder(&text, args[i], i + 1);
-            } catch (...) {
-                // Error in error handling: nothing right to do...
-            }
+        try {
+            replacePlaceholders(&text, e.arguments());
+        } catch (...) {
+            // Error in error handling: nothing right to do...
         }
 
         cerr << text << "\n";
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #include <log/log_formatter.h>
 
 #include <cassert>
+#include <cctype>
 
 #ifdef ENABLE_LOGGER_CHECKS
 #include <iostream>
@@ -16,52 +17,159 @@
 using namespace std;
 using namespace boost;
 
+namespace {
+
+/// \brief Parses the number of the placeholder starting at the given position
+///
+/// \param message The message.
+/// \param mark Position of a '%' character in the message.
+/// \param placeholder Set to the number following the '%' character, or to
+///        0 if it isn't followed by a digit.
+/// \return The position following the placeholder.
+size_t
+parsePlaceholder(const string& message, const size_t mark,
+                 unsigned& placeholder) {
+    placeholder = 0;
+    size_t end = mark + 1;
+    while ((end < message.size()) && isdigit(static_cast<unsigned char>(message[end]))) {
+        // Cap the value rather than overflow on a silly long number.
+        if (placeholder < 1000000) {
+            placeholder = placeholder * 10 + (message[end] - '0');
+        }
+        ++end;
+    }
+    return (end);
+}
+
+/// \brief Replaces the placeholders by the arguments in one pass
+///
+/// The placeholders %first, %first+1... are replaced by the arguments. The
+/// other placeholders are left unchanged. If the placeholder of an argument
+/// is not found, a complaint is added at the end.
+///
+/// \param message The message with placeholders, replaced by the
+///        formatted message.
+/// \param args The arguments, the first replaces %first and so on.
+/// \param first The number of the placeholder of the first argument.
+/// \return true if placeholders following the last argument were found.
+bool
+substitutePlaceholders(string* message, const vector<string>& args,
+                       const unsigned first) {
+    size_t length = message->size();
+    for (vector<string>::const_iterator arg = args.begin();
+         arg != args.end(); ++arg) {
+        length += arg->size();
+    }
+    string result;
+    result.reserve(length);
+
+    vector<bool> used(args.size(), false);
+    bool excess = false;
+    size_t pos = 0;
+    while (pos < message->size()) {
+        const size_t mark = message->find('%', pos);
+        if (mark == string::npos) {
+            result.append(*message, pos, string::npos);
+            break;
+        }
+        result.append(*message, pos, mark - pos);
+
+        unsigned placeholder;
+        const size_t end = parsePlaceholder(*message, mark, placeholder);
+        if ((placeholder >= first) && (placeholder - first < args.size())) {
+            result.append(args[placeholder - first]);
+            used[placeholder - first] = true;
+        } else {
+            // Not a placeholder or a placeholder without argument: copy it.
+            excess = excess || (placeholder >= first + args.size());
+            result.append(*message, mark, end - mark);
+        }
+        pos = end;
+    }
+
+    // Complain about the arguments without placeholder.
+    for (size_t i = 0; i < args.size(); ++i) {
+        if (!used[i]) {
+            result.append(" @@Missing placeholder %" +
+                          lexical_cast<string>(first + i) + " for '" +
+                          args[i] + "'@@");
+        }
+    }
+
+    message->swap(result);
+    return (excess);
+}
+
+/// \brief Reports the placeholders without argument
+///
+/// \param message The formatted message, a complaint is added at its end.
+void
+reportExcessPlaceholders(string* message) {
+#ifdef ENABLE_LOGGER_CHECKS
+    // Make sure we print the message so we can identify which
+    // identifier has the problem.
+    cerr << "Message " << *message << endl;
+    assert("Excess logger placeholders still exist in message" == NULL);
+#else
+    message->append(" @@Excess logger placeholders still exist@@");
+#endif /* ENABLE_LOGGER_CHECKS */
+}
+
+}
+
 namespace isc {
 namespace log {
 
+#ifdef ENABLE_LOGGER_CHECKS
+void
+checkPlaceholder(const string& message, const unsigned placeholder) {
+    for (size_t mark = message.find('%'); mark != string::npos;
+         mark = message.find('%', mark + 1)) {
+        unsigned found;
+        parsePlaceholder(message, mark, found);
+        if (found == placeholder) {
+            return;
+        }
+    }
+    // We're missing the placeholder, so throw an exception
+    isc_throw(MismatchedPlaceholders,
+              "Missing logger placeholder in message: " << message);
+}
+#else
+void
+checkPlaceholder(const string&, const unsigned) {
+    // The missing placeholders are reported by replacePlaceholders.
+}
+#endif /* ENABLE_LOGGER_CHECKS */
+
 void
 replacePlaceholder(string* message, const string& arg,
                    const unsigned placeholder)
 {
-    const string mark("%" + lexical_cast<string>(placeholder));
-    size_t pos(message->find(mark));
-    if (pos != string::npos) {
-        do {
-            message->replace(pos, mark.size(), arg);
-            pos = message->find(mark, pos + arg.size());
-        } while (pos != string::npos);
-    }
-#ifdef ENABLE_LOGGER_CHECKS
-    else {
-        // We're missing the placeholder, so throw an exception
-        isc_throw(MismatchedPlaceholders,
-                  "Missing logger placeholder in message: " << *message);
+    // Throws if the logger checks are enabled and the placeholder is missing.
+    checkPlaceholder(*message, placeholder);
+    substitutePlaceholders(message, vector<string>(1, arg), placeholder);
+}
+
+void
+replacePlaceholders(string* message, const vector<string>& args) {
+    // Nothing to replace (the common case of a message without arguments)
+    // unless there are excess placeholders.
+    if (args.empty() && (message->find('%') == string::npos)) {
+        return;
     }
-#else
-    else {
-        // We're missing the placeholder, so add some complain
-        message->append(" @@Missing placeholder " + mark + " for '" + arg + "'@@");
+
+    if (substitutePlaceholders(message, args, 1)) {
+        reportExcessPlaceholders(message);
     }
-#endif /* ENABLE_LOGGER_CHECKS */
 }
 
 void
 checkExcessPlaceholders(string* message, unsigned int placeholder) {
-    const string mark("%" + lexical_cast<string>(placeholder));
-    const size_t pos(message->find(mark));
-    if (pos != string::npos) {
-        // Excess placeholders were found.  If we enable the harsh check,
-        // abort it.  Note: ideally we'd like to throw MismatchedPlaceholders,
-        // but we can't at least for now because this function is called from
-        // the Formatter's destructor.
-#ifdef ENABLE_LOGGER_CHECKS
-        // Also, make sure we print the message so we can identify which
-        // identifier has the problem.
-        cerr << "Message " << *message << endl;
-        assert("Excess logger placeholders still exist in message" == NULL);
-#else
-        message->append(" @@Excess logger placeholders still exist@@");
-#endif /* ENABLE_LOGGER_CHECKS */
+    // Without arguments the message is left unchanged, the placeholders
+    // from the given one are only looked for.
+    if (substitutePlaceholders(message, vector<string>(), placeholder)) {
+        reportExcessPlaceholders(message);
     }
 }
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <string>
 #include <iostream>
+#include <vector>
 
 #include <exceptions/exceptions.h>
 #include <boost/lexical_cast.hpp>
@@ -47,21 +48,53 @@ public:
 ///
 /// \brief Internal excess placeholder checker
 ///
-/// This is used internally by the Formatter to check for excess
-/// placeholders (and fewer arguments).
+/// Checks for excess placeholders (and fewer arguments), i.e. the given
+/// placeholder or the following ones. It is not used by the Formatter
+/// anymore, which reports them in \c replacePlaceholders.
 void
 checkExcessPlaceholders(std::string* message, unsigned int placeholder);
 
 ///
 /// \brief The internal replacement routine
 ///
-/// This is used internally by the Formatter. Replaces a placeholder
-/// in the message by replacement. If the placeholder is not found,
-/// it adds a complain at the end.
+/// Replaces a placeholder in the message by replacement. If the placeholder
+/// is not found, it adds a complaint at the end (or throws
+/// \c MismatchedPlaceholders if the logger checks are enabled). It is not
+/// used by the Formatter anymore, which replaces all placeholders at once
+/// with \c replacePlaceholders.
 void
 replacePlaceholder(std::string* message, const std::string& replacement,
                    const unsigned placeholder);
 
+///
+/// \brief Internal placeholder checker
+///
+/// This is used internally by the Formatter when an argument is added.
+/// If the logger checks are enabled, it throws \c MismatchedPlaceholders
+/// when the message doesn't contain the placeholder for the argument.
+/// Otherwise it does nothing and the missing placeholder is reported
+/// by \c replacePlaceholders.
+void
+checkPlaceholder(const std::string& message, const unsigned placeholder);
+
+///
+/// \brief The internal single pass replacement routine
+///
+/// This is used internally by the Formatter and by the message compiler
+/// to report errors. Replaces all placeholders
+/// %1, %2... in the message by the corresponding arguments in one pass
+/// over the message, so a placeholder appearing in an argument is never
+/// replaced. If the placeholder of an argument is not found, it adds a
+/// complaint at the end. If there are more placeholders than arguments,
+/// it adds a complaint at the end too (or aborts if the logger checks are
+/// enabled).
+///
+/// \param message The message with placeholders, replaced by the
+///        formatted message.
+/// \param args The arguments, the first replaces %1 and so on.
+void
+replacePlaceholders(std::string* message, const std::vector<std::string>& args);
+
 ///
 /// \brief The log message formatter
 ///
@@ -84,6 +117,12 @@ replacePlaceholder(std::string* message, const std::string& replacement,
 /// Of course, if the logging is turned off, we don't bother with any replacing
 /// and just return.
 ///
+/// The .arg calls convert the arguments to strings right away, because they
+/// may refer to temporary objects which don't outlive the call, and store
+/// them. The placeholders are replaced in a single pass over the message
+/// when the formatter is destroyed, just before the output, instead of
+/// searching the message for every argument.
+///
 /// User of logging code should not really care much about this class, only
 /// call the .arg method to generate the correct output.
 ///
@@ -112,8 +151,10 @@ private:
     /// \brief The messages with %1, %2... placeholders
     std::string* message_;
 
-    /// \brief Which will be the next placeholder to replace
-    unsigned nextPlaceholder_;
+    /// \brief The arguments replacing the placeholders, in order
+    ///
+    /// Mutable as the copy constructor moves them to the new object.
+    mutable std::vector<std::string> args_;
 
 
 public:
@@ -133,8 +174,7 @@ public:
     ///     if no output is wanted.
     Formatter(const Severity& severity = NONE, std::string* message = NULL,
               Logger* logger = NULL) :
-        logger_(logger), severity_(severity), message_(message),
-        nextPlaceholder_(0)
+        logger_(logger), severity_(severity), message_(message), args_()
     {
     }
 
@@ -145,8 +185,9 @@ public:
     /// object being copied relinquishes that responsibility.
     Formatter(const Formatter& other) :
         logger_(other.logger_), severity_(other.severity_),
-        message_(other.message_), nextPlaceholder_(other.nextPlaceholder_)
+        message_(other.message_), args_()
     {
+        args_.swap(other.args_);
         other.logger_ = NULL;
     }
 
@@ -156,7 +197,7 @@ public:
     ~ Formatter() {
         if (logger_) {
             try {
-                checkExcessPlaceholders(message_, ++nextPlaceholder_);
+                replacePlaceholders(message_, args_);
                 logger_->output(severity_, *message_);
             } catch (...) {
                 // Catch and ignore all exceptions here.
@@ -174,18 +215,18 @@ public:
             logger_ = other.logger_;
             severity_ = other.severity_;
             message_ = other.message_;
-            nextPlaceholder_ = other.nextPlaceholder_;
+            args_.swap(other.args_);
+            other.args_.clear();
             other.logger_ = NULL;
         }
 
         return *this;
     }
 
-    /// \brief Replaces another placeholder
+    /// \brief Adds the argument for another placeholder
     ///
-    /// Replaces another placeholder and returns a new formatter with it.
-    /// Deactivates the current formatter. In case the formatter is not active,
-    /// only produces another inactive formatter.
+    /// Converts the value to a string and stores it for the next placeholder.
+    /// In case the formatter is not active, does nothing.
     ///
     /// \param value The argument to place into the placeholder.
     template<class Arg> Formatter& arg(const Arg& value) {
@@ -217,18 +258,14 @@ public:
     /// \param arg The text to place into the placeholder.
     Formatter& arg(const std::string& arg) {
         if (logger_) {
-            // Note that this method does a replacement and returns the
-            // modified string. If there are multiple invocations of arg() (e.g.
-            // logger.info(msgid).arg(xxx).arg(yyy)...), each invocation
-            // operates on the string returned by the previous one. This
-            // sequential operation means that if we had a message like "%1 %2",
-            // and called .arg("%2").arg(42), we would get "42 42"; the first
-            // call replaces the %1" with "%2" and the second replaces all
-            // occurrences of "%2" with 42. (Conversely, the sequence
-            // .arg(42).arg("%1") would return "42 %1" - there are no recursive
-            // replacements).
+            // The argument is only stored here: all placeholders are replaced
+            // when the message is output. As the replacement is done in a
+            // single pass over the original message, an argument containing
+            // a placeholder is copied verbatim, e.g. the message "%1 %2" with
+            // .arg("%2").arg(42) gives "%2 42".
             try {
-                replacePlaceholder(message_, arg, ++nextPlaceholder_ );
+                checkPlaceholder(*message_, args_.size() + 1);
+                args_.push_back(arg);
             }
             catch (...) {
                 // Something went wrong here, the log message is broken, so
@@ -253,6 +290,7 @@ public:
         if (logger_) {
             delete message_;
             message_ = NULL;
+            args_.clear();
             logger_ = NULL;
         }
     }
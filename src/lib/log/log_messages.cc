@@ -10,6 +10,7 @@ namespace isc {
 namespace log {
 
 extern const isc::log::MessageID LOG_BAD_DESTINATION = "LOG_BAD_DESTINATION";
+extern const isc::log::MessageID LOG_BAD_OVERFLOW = "LOG_BAD_OVERFLOW";
 extern const isc::log::MessageID LOG_BAD_SEVERITY = "LOG_BAD_SEVERITY";
 extern const isc::log::MessageID LOG_BAD_STREAM = "LOG_BAD_STREAM";
 extern const isc::log::MessageID LOG_DUPLICATE_MESSAGE_ID = "LOG_DUPLICATE_MESSAGE_ID";
@@ -37,6 +38,7 @@ namespace {
 
 const char* values[] = {
     "LOG_BAD_DESTINATION", "unrecognized log destination: %1",
+    "LOG_BAD_OVERFLOW", "unrecognized log overflow policy: %1",
     "LOG_BAD_SEVERITY", "unrecognized log severity: %1",
     "LOG_BAD_STREAM", "bad log console output stream: %1",
     "LOG_DUPLICATE_MESSAGE_ID", "duplicate message ID (%1) in compiled code",
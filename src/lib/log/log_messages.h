@@ -9,6 +9,7 @@ namespace isc {
 namespace log {
 
 extern const isc::log::MessageID LOG_BAD_DESTINATION;
+extern const isc::log::MessageID LOG_BAD_OVERFLOW;
 extern const isc::log::MessageID LOG_BAD_SEVERITY;
 extern const isc::log::MessageID LOG_BAD_STREAM;
 extern const isc::log::MessageID LOG_DUPLICATE_MESSAGE_ID;
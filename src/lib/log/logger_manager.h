@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -140,6 +140,13 @@ public:
     /// calls.
     static isc::util::thread::Mutex& getMutex();
 
+    /// \brief Return the number of log messages dropped by the outputs
+    /// configured for asynchronous writing because their queue was full.
+    ///
+    /// The count covers all such outputs since the process start, i.e. it
+    /// isn't reset by a reconfiguration.
+    static uint64_t getDroppedMessages();
+
 private:
     /// \brief Initialize Processing
     ///
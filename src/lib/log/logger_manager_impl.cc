@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2017 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -27,6 +27,7 @@
 #include <log/logger_name.h>
 #include <log/logger_specification.h>
 #include <log/buffer_appender_impl.h>
+#include <log/async_appender_impl.h>
 
 #include <boost/lexical_cast.hpp>
 
@@ -112,7 +113,7 @@ LoggerManagerImpl::createConsoleAppender(log4cplus::Logger& logger,
         new log4cplus::ConsoleAppender(
             (opt.stream == OutputOption::STR_STDERR), opt.flush));
     setConsoleAppenderLayout(console);
-    logger.addAppender(console);
+    addAppender(logger, console, opt);
 }
 
 // File appender.  Depending on whether a maximum size is given, either
@@ -148,7 +149,7 @@ LoggerManagerImpl::createFileAppender(log4cplus::Logger& logger,
 
     // use the same console layout for the files.
     setConsoleAppenderLayout(fileapp);
-    logger.addAppender(fileapp);
+    addAppender(logger, fileapp, opt);
 }
 
 void
@@ -172,7 +173,24 @@ LoggerManagerImpl::createSyslogAppender(log4cplus::Logger& logger,
     log4cplus::SharedAppenderPtr syslogapp(
         new log4cplus::SysLogAppender(properties));
     setSyslogAppenderLayout(syslogapp);
-    logger.addAppender(syslogapp);
+    addAppender(logger, syslogapp, opt);
+}
+
+// Attach the appender, through an asynchronous appender if requested.
+// The layout stays with the destination appender so the messages are
+// formatted by the writer thread.
+void
+LoggerManagerImpl::addAppender(log4cplus::Logger& logger,
+                               log4cplus::SharedAppenderPtr& appender,
+                               const OutputOption& opt)
+{
+    if (!opt.async) {
+        logger.addAppender(appender);
+        return;
+    }
+    log4cplus::SharedAppenderPtr asyncapp(
+        new internal::AsyncAppender(appender, opt.queue_size, opt.overflow));
+    logger.addAppender(asyncapp);
 }
 
 
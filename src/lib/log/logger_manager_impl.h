@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -125,6 +125,18 @@ private:
     static void createSyslogAppender(log4cplus::Logger& logger,
                                      const OutputOption& opt);
 
+    /// \brief Attach an appender to a logger
+    ///
+    /// If the output option requests asynchronous output, the appender is
+    /// wrapped in an appender writing the messages in a separate thread.
+    ///
+    /// \param logger Log4cplus logger to which the appender must be attached.
+    /// \param appender Appender writing to the destination.
+    /// \param opt Output options for this appender.
+    static void addAppender(log4cplus::Logger& logger,
+                            log4cplus::SharedAppenderPtr& appender,
+                            const OutputOption& opt);
+
     /// \brief Create buffered appender
     ///
     /// Appends an object to the logger that will store the log events sent
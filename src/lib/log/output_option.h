@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -50,10 +50,17 @@ struct OutputOption {
         STR_STDERR = 2
     } Stream;
 
+    /// If asynchronous, action taken when the queue of messages is full
+    typedef enum {
+        OVERFLOW_DROP = 0,
+        OVERFLOW_BLOCK = 1
+    } Overflow;
+
     /// \brief Constructor
     OutputOption() : destination(DEST_CONSOLE), stream(STR_STDERR),
                      flush(true), facility("LOCAL0"), filename(""),
-                     maxsize(0), maxver(0)
+                     maxsize(0), maxver(0), async(false),
+                     queue_size(4096), overflow(OVERFLOW_DROP)
     {}
 
     /// Members. 
@@ -65,10 +72,14 @@ struct OutputOption {
     std::string     filename;           ///< Filename if file output
     size_t          maxsize;            ///< 0 if no maximum size
     unsigned int    maxver;             ///< Maximum versions (none if <= 0)
+    bool            async;              ///< true to write in a separate thread
+    size_t          queue_size;         ///< Messages queued if asynchronous
+    Overflow        overflow;           ///< Action if the queue is full
 };
 
 OutputOption::Destination getDestination(const std::string& dest_str);
 OutputOption::Stream getStream(const std::string& stream_str);
+OutputOption::Overflow getOverflow(const std::string& overflow_str);
 
 
 } // namespace log
@@ -0,0 +1,172 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <gtest/gtest.h>
+
+#include <log/async_appender_impl.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+
+#include <log4cplus/appender.h>
+#include <log4cplus/spi/loggingevent.h>
+#include <boost/bind.hpp>
+
+using namespace isc::log;
+using namespace isc::log::internal;
+using namespace isc::util::thread;
+
+namespace {
+
+/// \brief Log the event the given number of times.
+void
+logEvents(log4cplus::Appender* appender,
+          const log4cplus::spi::InternalLoggingEvent& event,
+          const size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        appender->doAppend(event);
+    }
+}
+
+/// \brief Appender counting the written events
+///
+/// The appender can be locked, in which case the writer thread stays in
+/// append() until the appender is unlocked.
+class TestTargetAppender : public log4cplus::Appender {
+public:
+    TestTargetAppender() : count_(0), entered_(false), open_(true) {
+    }
+
+    virtual ~TestTargetAppender() {
+        destructorImpl();
+    }
+
+    virtual void close() {
+        closed = true;
+    }
+
+    /// \brief Make the next append() call wait.
+    void lock() {
+        Mutex::Locker lock(mutex_);
+        open_ = false;
+    }
+
+    /// \brief Release the waiting append() call.
+    void unlock() {
+        Mutex::Locker lock(mutex_);
+        open_ = true;
+        open_cond_.signal();
+    }
+
+    /// \brief Wait until append() has been called.
+    void waitEntered() {
+        Mutex::Locker lock(mutex_);
+        while (!entered_) {
+            entered_cond_.wait(mutex_);
+        }
+    }
+
+    /// \brief Returns the number of written events.
+    size_t getCount() {
+        Mutex::Locker lock(mutex_);
+        return (count_);
+    }
+
+protected:
+    virtual void append(const log4cplus::spi::InternalLoggingEvent&) {
+        Mutex::Locker lock(mutex_);
+        entered_ = true;
+        entered_cond_.signal();
+        while (!open_) {
+            open_cond_.wait(mutex_);
+        }
+        ++count_;
+    }
+
+private:
+    size_t count_;
+    bool entered_;
+    bool open_;
+    Mutex mutex_;
+    CondVar entered_cond_;
+    CondVar open_cond_;
+};
+
+class AsyncAppenderTest : public ::testing::Test {
+protected:
+    AsyncAppenderTest() : target_(new TestTargetAppender()),
+                          target_ptr_(target_),
+                          event_("async", log4cplus::INFO_LOG_LEVEL,
+                                 "Bar", "file", 123) {
+    }
+
+    TestTargetAppender* target_;
+    log4cplus::SharedAppenderPtr target_ptr_;
+    log4cplus::spi::InternalLoggingEvent event_;
+};
+
+// Test that all events are written by the writer thread and that the
+// events remaining in the buffer are written when the appender is closed.
+TEST_F(AsyncAppenderTest, writeAll) {
+    AsyncAppender appender(target_ptr_, 16, OutputOption::OVERFLOW_BLOCK);
+    logEvents(&appender, event_, 1000);
+    appender.close();
+    EXPECT_EQ(1000, target_->getCount());
+    EXPECT_EQ(0, appender.getDropped());
+}
+
+// Test that the events not fitting in the buffer are dropped and counted
+// with the drop policy.
+TEST_F(AsyncAppenderTest, dropWhenFull) {
+    const uint64_t dropped_total = AsyncAppender::getDroppedTotal();
+
+    AsyncAppender appender(target_ptr_, 4, OutputOption::OVERFLOW_DROP);
+    target_->lock();
+
+    // The writer thread takes the first event and waits in the target.
+    logEvents(&appender, event_, 1);
+    target_->waitEntered();
+
+    // Four events fit in the buffer, the others are dropped.
+    logEvents(&appender, event_, 10);
+    EXPECT_EQ(6, appender.getDropped());
+    EXPECT_EQ(dropped_total + 6, AsyncAppender::getDroppedTotal());
+
+    target_->unlock();
+    appender.close();
+    EXPECT_EQ(5, target_->getCount());
+}
+
+// Test that the logging thread waits for space in the buffer with the
+// block policy.
+TEST_F(AsyncAppenderTest, blockWhenFull) {
+    AsyncAppender appender(target_ptr_, 1, OutputOption::OVERFLOW_BLOCK);
+    target_->lock();
+
+    // The logging thread fills the buffer and waits while the target
+    // is locked.
+    Thread producer(boost::bind(&logEvents, &appender, boost::cref(event_),
+                                10));
+    target_->waitEntered();
+    EXPECT_GT(10, target_->getCount());
+
+    target_->unlock();
+    producer.wait();
+    appender.close();
+    EXPECT_EQ(10, target_->getCount());
+    EXPECT_EQ(0, appender.getDropped());
+}
+
+// Test that the appender can be destroyed without being closed.
+TEST_F(AsyncAppenderTest, destroy) {
+    {
+        AsyncAppender appender(target_ptr_, 8, OutputOption::OVERFLOW_DROP);
+        logEvents(&appender, event_, 5);
+    }
+    EXPECT_EQ(5, target_->getCount());
+}
+
+}
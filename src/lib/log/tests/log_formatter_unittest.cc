@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -176,4 +176,64 @@ TEST_F(FormatterTest, noRecurse) {
     EXPECT_EQ("%1 %1", outputs[0].second);
 }
 
+// Test the placeholders are replaced in a single pass over the original
+// message, so an argument containing a later placeholder is kept verbatim
+TEST_F(FormatterTest, singlePass) {
+    Formatter(isc::log::INFO, s("%1 %2"), this).arg("%2").arg(42);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("%2 42", outputs[0].second);
+}
+
+// Test percent characters not followed by a placeholder number are kept
+TEST_F(FormatterTest, percent) {
+    Formatter(isc::log::INFO, s("%1% of 100%, %0 and %"), this).arg(50);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("50% of 100%, %0 and %", outputs[0].second);
+}
+
+// Test placeholders with more than one digit
+TEST_F(FormatterTest, manyArgs) {
+    Formatter(isc::log::INFO, s("%10 %1 %11 %2%3%4%5%6%7%8%9"), this).
+        arg(1).arg(2).arg(3).arg(4).arg(5).arg(6).arg(7).arg(8).arg(9).
+        arg(10).arg(11);
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("10 1 11 23456789", outputs[0].second);
+}
+
+// Test the arguments follow the formatter when it is copied
+TEST_F(FormatterTest, copy) {
+    {
+        Formatter original(isc::log::INFO, s("%1 and %2"), this);
+        original.arg("first");
+        Formatter copy(original);
+        copy.arg("second");
+    }
+    ASSERT_EQ(1, outputs.size());
+    EXPECT_EQ("first and second", outputs[0].second);
+}
+
+
+// Test the single placeholder replacement helper
+TEST_F(FormatterTest, replacePlaceholder) {
+    std::string message("%1 %2 %2");
+    isc::log::replacePlaceholder(&message, "second", 2);
+    EXPECT_EQ("%1 second second", message);
+    isc::log::replacePlaceholder(&message, "%2", 1);
+    EXPECT_EQ("%2 second second", message);
+}
+
+#ifndef ENABLE_LOGGER_CHECKS
+
+// Test the check of the placeholders left after the replacement
+TEST_F(FormatterTest, checkExcessPlaceholders) {
+    std::string message("no placeholder %1");
+    isc::log::checkExcessPlaceholders(&message, 2);
+    EXPECT_EQ("no placeholder %1", message);
+    isc::log::checkExcessPlaceholders(&message, 1);
+    EXPECT_EQ("no placeholder %1 @@Excess logger placeholders still exist@@",
+              message);
+}
+
+#endif /* ENABLE_LOGGER_CHECKS */
+
 }
@@ -1,4 +1,4 @@
-// Copyright (C) 2011-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2011-2018 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -28,6 +28,9 @@ TEST(OutputOptionTest, Initialization) {
     EXPECT_EQ(string(""), option.filename);
     EXPECT_EQ(0, option.maxsize);
     EXPECT_EQ(0, option.maxver);
+    EXPECT_FALSE(option.async);
+    EXPECT_EQ(4096, option.queue_size);
+    EXPECT_EQ(OutputOption::OVERFLOW_DROP, option.overflow);
 }
 
 TEST(OutputOption, getDestination) {
@@ -58,3 +61,13 @@ TEST(OutputOption, getStream) {
     EXPECT_EQ(OutputOption::STR_STDOUT, getStream(""));
 }
 
+TEST(OutputOption, getOverflow) {
+    EXPECT_EQ(OutputOption::OVERFLOW_DROP, getOverflow("drop"));
+    EXPECT_EQ(OutputOption::OVERFLOW_DROP, getOverflow("DROP"));
+    EXPECT_EQ(OutputOption::OVERFLOW_BLOCK, getOverflow("block"));
+    EXPECT_EQ(OutputOption::OVERFLOW_BLOCK, getOverflow("BlocK"));
+
+    // bad values should default to drop
+    EXPECT_EQ(OutputOption::OVERFLOW_DROP, getOverflow("some bad value"));
+    EXPECT_EQ(OutputOption::OVERFLOW_DROP, getOverflow(""));
+}
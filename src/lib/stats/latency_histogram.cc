@@ -0,0 +1,176 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <stats/latency_histogram.h>
+#include <algorithm>
+#include <cmath>
+
+namespace isc {
+namespace stats {
+
+LatencyHistogram::LatencyHistogram(unsigned sub_bucket_bits)
+    : sub_bucket_bits_(sub_bucket_bits),
+      sub_bucket_count_(1ULL << sub_bucket_bits),
+      half_sub_bucket_count_(sub_bucket_count_ / 2),
+      buckets_(), count_(0), total_(0), min_(0), max_(0) {
+    if ((sub_bucket_bits < 2) || (sub_bucket_bits > 16)) {
+        isc_throw(BadValue, "the number of sub-bucket bits of the latency"
+                  " histogram " << sub_bucket_bits << " is out of range"
+                  " of 2 to 16");
+    }
+    buckets_.resize(sub_bucket_count_ + (MAX_VALUE_BITS - sub_bucket_bits) *
+                    half_sub_bucket_count_, 0);
+}
+
+void
+LatencyHistogram::record(uint64_t value) {
+    value = std::min(value, getHighestTrackableValue());
+    ++buckets_[getBucketIndex(value)];
+    if ((count_ == 0) || (value < min_)) {
+        min_ = value;
+    }
+    if (value > max_) {
+        max_ = value;
+    }
+    ++count_;
+    total_ += value;
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram& other) {
+    if (other.sub_bucket_bits_ != sub_bucket_bits_) {
+        isc_throw(BadValue, "unable to merge the histograms with different"
+                  " precisions");
+    }
+    if (other.count_ == 0) {
+        return;
+    }
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        buckets_[i] += other.buckets_[i];
+    }
+    if ((count_ == 0) || (other.min_ < min_)) {
+        min_ = other.min_;
+    }
+    max_ = std::max(max_, other.max_);
+    count_ += other.count_;
+    total_ += other.total_;
+}
+
+void
+LatencyHistogram::subtract(const LatencyHistogram& earlier) {
+    if (earlier.sub_bucket_bits_ != sub_bucket_bits_) {
+        isc_throw(BadValue, "unable to subtract the histogram with a"
+                  " different precision");
+    }
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        if (earlier.buckets_[i] > buckets_[i]) {
+            isc_throw(BadValue, "unable to subtract the histogram which"
+                      " is not an earlier copy of this histogram");
+        }
+    }
+
+    // The remaining values lie between the lowest and the highest
+    // non-empty buckets.
+    size_t lowest = buckets_.size();
+    size_t highest = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        buckets_[i] -= earlier.buckets_[i];
+        if (buckets_[i] > 0) {
+            lowest = std::min(lowest, i);
+            highest = i;
+        }
+    }
+    count_ -= earlier.count_;
+    total_ -= earlier.total_;
+    if (count_ > 0) {
+        min_ = std::max(min_, getBucketLowestValue(lowest));
+        max_ = std::min(max_, getBucketHighestValue(highest));
+    } else {
+        min_ = 0;
+        max_ = 0;
+    }
+}
+
+void
+LatencyHistogram::reset() {
+    std::fill(buckets_.begin(), buckets_.end(), 0);
+    count_ = 0;
+    total_ = 0;
+    min_ = 0;
+    max_ = 0;
+}
+
+double
+LatencyHistogram::getMean() const {
+    return (count_ > 0 ? static_cast<double>(total_) / count_ : 0.0);
+}
+
+uint64_t
+LatencyHistogram::getPercentile(double percentile) const {
+    if (count_ == 0) {
+        return (0);
+    }
+
+    percentile = std::max(0.0, std::min(percentile, 100.0));
+    uint64_t target = static_cast<uint64_t>(std::ceil(percentile * count_ / 100.0));
+    if (target == 0) {
+        target = 1;
+    }
+
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < buckets_.size(); ++i) {
+        cumulative += buckets_[i];
+        if (cumulative >= target) {
+            return (std::min(getBucketHighestValue(i), max_));
+        }
+    }
+    return (max_);
+}
+
+uint64_t
+LatencyHistogram::getHighestTrackableValue() {
+    return ((1ULL << MAX_VALUE_BITS) - 1);
+}
+
+size_t
+LatencyHistogram::getBucketIndex(uint64_t value) const {
+    if (value < sub_bucket_count_) {
+        return (static_cast<size_t>(value));
+    }
+
+    // Find the power of two the value belongs to, retaining the
+    // sub_bucket_bits_ most significant bits of the value.
+    unsigned shift = 0;
+    while (value >= sub_bucket_count_) {
+        value >>= 1;
+        ++shift;
+    }
+    return (static_cast<size_t>(sub_bucket_count_ +
+                                (shift - 1) * half_sub_bucket_count_ +
+                                (value - half_sub_bucket_count_)));
+}
+
+uint64_t
+LatencyHistogram::getBucketHighestValue(size_t index) const {
+    if (index < sub_bucket_count_) {
+        return (index);
+    }
+    const uint64_t offset = index - sub_bucket_count_;
+    const unsigned shift = static_cast<unsigned>(offset / half_sub_bucket_count_) + 1;
+    const uint64_t top = half_sub_bucket_count_ + offset % half_sub_bucket_count_;
+    return (((top + 1) << shift) - 1);
+}
+
+uint64_t
+LatencyHistogram::getBucketLowestValue(size_t index) const {
+    return (index > 0 ? getBucketHighestValue(index - 1) + 1 : 0);
+}
+
+} // end of namespace isc::stats
+} // end of namespace isc
@@ -0,0 +1,166 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LATENCY_HISTOGRAM_H
+#define LATENCY_HISTOGRAM_H
+
+#include <cstddef>
+#include <stdint.h>
+#include <vector>
+
+namespace isc {
+namespace stats {
+
+/// @brief Histogram of latencies with bounded relative error.
+///
+/// The histogram records values (typically durations expressed in
+/// microseconds) in log-linear buckets, similar to the HDR histograms.
+/// With N sub-bucket bits, values lower than 2^N are recorded exactly.
+/// Higher values are recorded in buckets which width doubles with every
+/// power of two, each power of two being split into 2^(N - 1) buckets.
+/// This keeps the relative error of the reported percentiles below
+/// 1/2^(N - 1) regardless of the value, while the histogram has a fixed
+/// size and recording a value takes constant time. Each additional bit
+/// halves the error and doubles the size of the histogram.
+///
+/// Values higher than @c getHighestTrackableValue are recorded as this
+/// value.
+class LatencyHistogram {
+public:
+
+    /// @brief Default number of bits determining the precision of the
+    /// histogram, i.e. a relative error below 1/16.
+    static const unsigned DEFAULT_SUB_BUCKET_BITS = 5;
+
+    /// @brief Number of bits of the highest trackable value.
+    ///
+    /// For microseconds this is about 19 hours.
+    static const unsigned MAX_VALUE_BITS = 36;
+
+    /// @brief Constructor.
+    ///
+    /// @param sub_bucket_bits Number of bits determining the precision
+    /// of the histogram.
+    ///
+    /// @throw isc::BadValue if the number of bits is lower than 2 or
+    /// greater than 16.
+    explicit LatencyHistogram(unsigned sub_bucket_bits =
+                              DEFAULT_SUB_BUCKET_BITS);
+
+    /// @brief Records a value.
+    ///
+    /// @param value Recorded value.
+    void record(uint64_t value);
+
+    /// @brief Adds the values recorded by another histogram.
+    ///
+    /// @param other Histogram which values are added to this one.
+    ///
+    /// @throw isc::BadValue if the histograms have different precisions.
+    void merge(const LatencyHistogram& other);
+
+    /// @brief Removes the values recorded by an earlier copy of this
+    /// histogram.
+    ///
+    /// This is used to get the values recorded between two points in
+    /// time. The lowest and the highest values recorded in this period
+    /// are not known, so they are estimated with the precision of the
+    /// histogram.
+    ///
+    /// @param earlier Histogram holding a subset of the values recorded
+    /// by this histogram.
+    ///
+    /// @throw isc::BadValue if the earlier histogram holds values which
+    /// are not recorded by this histogram or has a different precision.
+    void subtract(const LatencyHistogram& earlier);
+
+    /// @brief Removes all recorded values.
+    void reset();
+
+    /// @brief Returns the number of recorded values.
+    uint64_t getCount() const {
+        return (count_);
+    }
+
+    /// @brief Returns the lowest recorded value or 0 if none.
+    uint64_t getMin() const {
+        return (count_ > 0 ? min_ : 0);
+    }
+
+    /// @brief Returns the highest recorded value or 0 if none.
+    uint64_t getMax() const {
+        return (max_);
+    }
+
+    /// @brief Returns the mean of the recorded values or 0 if none.
+    double getMean() const;
+
+    /// @brief Returns the value at the given percentile.
+    ///
+    /// The returned value is the highest value equivalent to the values
+    /// in the bucket holding the percentile, capped by the highest
+    /// recorded value.
+    ///
+    /// @param percentile Percentile between 0 and 100.
+    ///
+    /// @return Value at the percentile or 0 if no values were recorded.
+    uint64_t getPercentile(double percentile) const;
+
+    /// @brief Returns the number of bits determining the precision.
+    unsigned getSubBucketBits() const {
+        return (sub_bucket_bits_);
+    }
+
+    /// @brief Returns the highest value tracked by the histogram.
+    static uint64_t getHighestTrackableValue();
+
+private:
+
+    /// @brief Returns the index of the bucket for the value.
+    ///
+    /// @param value Value not greater than the highest trackable value.
+    size_t getBucketIndex(uint64_t value) const;
+
+    /// @brief Returns the highest value recorded in the bucket.
+    ///
+    /// @param index Bucket index.
+    uint64_t getBucketHighestValue(size_t index) const;
+
+    /// @brief Returns the lowest value recorded in the bucket.
+    ///
+    /// @param index Bucket index.
+    uint64_t getBucketLowestValue(size_t index) const;
+
+    /// @brief Number of bits determining the precision.
+    unsigned sub_bucket_bits_;
+
+    /// @brief Number of values recorded exactly.
+    uint64_t sub_bucket_count_;
+
+    /// @brief Number of buckets for each power of two above
+    /// @c sub_bucket_count_.
+    uint64_t half_sub_bucket_count_;
+
+    /// @brief Counts of the values recorded in the buckets.
+    std::vector<uint64_t> buckets_;
+
+    /// @brief Number of recorded values.
+    uint64_t count_;
+
+    /// @brief Sum of the recorded values.
+    uint64_t total_;
+
+    /// @brief Lowest recorded value.
+    uint64_t min_;
+
+    /// @brief Highest recorded value.
+    uint64_t max_;
+};
+
+} // end of namespace isc::stats
+} // end of namespace isc
+
+#endif // LATENCY_HISTOGRAM_H
@@ -10,6 +10,10 @@
 #include <stats/stats_mgr.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <cc/json_stream.h>
+#include <boost/shared_ptr.hpp>
+#include <string>
+#include <vector>
 
 using namespace std;
 using namespace isc::data;
@@ -114,16 +118,24 @@ isc::data::ConstElementPtr StatsMgr::get(const std::string& name) const {
 }
 
 isc::data::ConstElementPtr StatsMgr::getAll() const {
-    isc::data::ElementPtr map = isc::data::Element::createMap(); // a map
-
-    // Let's iterate over all stored statistics...
+    // Take a snapshot of the statistics. Their values are converted to
+    // JSON only when the map is written out, so the response to
+    // statistic-get-all doesn't hold the values of all of them at once.
+    std::vector<std::string> names;
+    boost::shared_ptr<std::vector<ObservationPtr> >
+        observations(new std::vector<ObservationPtr>());
+    names.reserve(global_->stats_.size());
+    observations->reserve(global_->stats_.size());
     for (std::map<std::string, ObservationPtr>::iterator s = global_->stats_.begin();
          s != global_->stats_.end(); ++s) {
-
-        // ... and add each of them to the map.
-        map->set(s->first, s->second->getJSON());
+        names.push_back(s->first);
+        observations->push_back(s->second);
     }
-    return (map);
+
+    return (ConstElementPtr(new StreamedMapElement(names,
+        [observations](const size_t i) {
+            return ((*observations)[i]->getJSON());
+        })));
 }
 
 void StatsMgr::resetAll() {
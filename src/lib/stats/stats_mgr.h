@@ -195,6 +195,10 @@ class StatsMgr : public boost::noncopyable {
 
     /// @brief Returns all statistics as a JSON structure.
     ///
+    /// The returned map is a @c isc::data::StreamedMapElement holding
+    /// the statistics present at the time of the call. The value of a
+    /// statistic is converted to JSON when it is accessed or written out.
+    ///
     /// @return JSON structures representing all statistics
     isc::data::ConstElementPtr getAll() const;
 
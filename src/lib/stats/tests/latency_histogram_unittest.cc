@@ -0,0 +1,155 @@
+// Copyright (C) 2018 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <exceptions/exceptions.h>
+#include <stats/latency_histogram.h>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::stats;
+
+namespace {
+
+// This test verifies that an empty histogram reports zeros.
+TEST(LatencyHistogramTest, empty) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0.0, histogram.getMean());
+    EXPECT_EQ(0, histogram.getPercentile(50));
+}
+
+// This test verifies that low values are recorded exactly.
+TEST(LatencyHistogramTest, lowValues) {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 20; ++i) {
+        histogram.record(i);
+    }
+    EXPECT_EQ(20, histogram.getCount());
+    EXPECT_EQ(1, histogram.getMin());
+    EXPECT_EQ(20, histogram.getMax());
+    EXPECT_DOUBLE_EQ(10.5, histogram.getMean());
+    EXPECT_EQ(10, histogram.getPercentile(50));
+    EXPECT_EQ(19, histogram.getPercentile(95));
+    EXPECT_EQ(20, histogram.getPercentile(100));
+    EXPECT_EQ(1, histogram.getPercentile(0));
+}
+
+// This test verifies that the relative error of the percentiles for
+// high values is bounded.
+TEST(LatencyHistogramTest, highValues) {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 100000; ++i) {
+        histogram.record(i);
+    }
+    EXPECT_EQ(100000, histogram.getCount());
+    EXPECT_EQ(100000, histogram.getMax());
+
+    const double percentiles[] = { 10, 50, 90, 99, 99.9 };
+    for (size_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); ++i) {
+        const double expected = percentiles[i] * 1000;
+        const uint64_t reported = histogram.getPercentile(percentiles[i]);
+        EXPECT_GE(reported, expected);
+        EXPECT_LE(reported, expected * (1 + 1.0 / 16))
+            << "percentile " << percentiles[i];
+    }
+}
+
+// This test verifies that the precision of the histogram can be increased.
+TEST(LatencyHistogramTest, precision) {
+    LatencyHistogram histogram(7);
+    EXPECT_EQ(7, histogram.getSubBucketBits());
+    for (uint64_t i = 1; i <= 100000; ++i) {
+        histogram.record(i);
+    }
+
+    const double percentiles[] = { 10, 50, 90, 99, 99.9 };
+    for (size_t i = 0; i < sizeof(percentiles) / sizeof(percentiles[0]); ++i) {
+        const double expected = percentiles[i] * 1000;
+        const uint64_t reported = histogram.getPercentile(percentiles[i]);
+        EXPECT_GE(reported, expected);
+        EXPECT_LE(reported, expected * (1 + 1.0 / 64))
+            << "percentile " << percentiles[i];
+    }
+
+    // The histograms with different precisions can't be combined.
+    LatencyHistogram other;
+    EXPECT_THROW(histogram.merge(other), isc::BadValue);
+    EXPECT_THROW(histogram.subtract(other), isc::BadValue);
+
+    // The number of bits must be in range.
+    EXPECT_THROW(LatencyHistogram(1), isc::BadValue);
+    EXPECT_THROW(LatencyHistogram(17), isc::BadValue);
+}
+
+// This test verifies that the values above the highest trackable value
+// are capped and that the histogram can be reset.
+TEST(LatencyHistogramTest, capAndReset) {
+    LatencyHistogram histogram;
+    histogram.record(LatencyHistogram::getHighestTrackableValue() + 100);
+    EXPECT_EQ(LatencyHistogram::getHighestTrackableValue(), histogram.getMax());
+    EXPECT_EQ(LatencyHistogram::getHighestTrackableValue(),
+              histogram.getPercentile(50));
+
+    histogram.reset();
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMax());
+    EXPECT_EQ(0, histogram.getPercentile(99));
+}
+
+// This test verifies that the histograms can be merged.
+TEST(LatencyHistogramTest, merge) {
+    LatencyHistogram histogram1;
+    LatencyHistogram histogram2;
+    for (uint64_t i = 1; i <= 10; ++i) {
+        histogram1.record(i + 10);
+        histogram2.record(i);
+    }
+    histogram1.merge(histogram2);
+    EXPECT_EQ(20, histogram1.getCount());
+    EXPECT_EQ(1, histogram1.getMin());
+    EXPECT_EQ(20, histogram1.getMax());
+    EXPECT_DOUBLE_EQ(10.5, histogram1.getMean());
+    EXPECT_EQ(10, histogram1.getPercentile(50));
+
+    // Merging an empty histogram doesn't change anything.
+    histogram1.merge(LatencyHistogram());
+    EXPECT_EQ(20, histogram1.getCount());
+    EXPECT_EQ(1, histogram1.getMin());
+}
+
+// This test verifies that the values recorded by an earlier copy can
+// be removed.
+TEST(LatencyHistogramTest, subtract) {
+    LatencyHistogram histogram;
+    for (uint64_t i = 1; i <= 10; ++i) {
+        histogram.record(i * 1000);
+    }
+    LatencyHistogram earlier(histogram);
+    for (uint64_t i = 1; i <= 10; ++i) {
+        histogram.record(i + 10);
+    }
+    histogram.subtract(earlier);
+    EXPECT_EQ(10, histogram.getCount());
+    EXPECT_EQ(11, histogram.getMin());
+    EXPECT_EQ(20, histogram.getMax());
+    EXPECT_DOUBLE_EQ(15.5, histogram.getMean());
+    EXPECT_EQ(15, histogram.getPercentile(50));
+
+    // The histogram holding values not recorded by this histogram
+    // can't be subtracted.
+    EXPECT_THROW(histogram.subtract(earlier), isc::BadValue);
+
+    histogram.subtract(histogram);
+    EXPECT_EQ(0, histogram.getCount());
+    EXPECT_EQ(0, histogram.getMin());
+    EXPECT_EQ(0, histogram.getMax());
+}
+
+} // end of anonymous namespace
@@ -10,6 +10,7 @@
 #include <exceptions/exceptions.h>
 #include <cc/data.h>
 #include <cc/command_interpreter.h>
+#include <cc/json_stream.h>
 #include <util/boost_time_utils.h>
 #include <boost/date_time/posix_time/posix_time_types.hpp>
 #include <boost/shared_ptr.hpp>
@@ -199,6 +200,22 @@ TEST_F(StatsMgrTest, getGetAll) {
     EXPECT_EQ(exp_str_beta, rep_all->get("beta")->str());
     EXPECT_EQ(exp_str_gamma, rep_all->get("gamma")->str());
     EXPECT_EQ(exp_str_delta, rep_all->get("delta")->str());
+
+    // The statistics are converted to JSON when they are written out, so
+    // the removed statistics are still reported and the values are the
+    // current ones.
+    const StreamedMapElement* streamed =
+        dynamic_cast<const StreamedMapElement*>(rep_all.get());
+    ASSERT_TRUE(streamed);
+    EXPECT_FALSE(streamed->isMaterialized());
+    StatsMgr::instance().setValue("beta", 1.5);
+    exp_str_beta = "[ [ 1.5, \""
+        + isc::util::ptimeToText(StatsMgr::instance().getObservation("beta")
+                                   ->getFloat().second) + "\" ] ]";
+    EXPECT_TRUE(StatsMgr::instance().del("alpha"));
+    EXPECT_EQ("{ \"alpha\": " + exp_str_alpha + ", \"beta\": " + exp_str_beta +
+              ", \"delta\": " + exp_str_delta + ", \"gamma\": " +
+              exp_str_gamma + " }", rep_all->str());
 }
 
 // This test checks whether existing statistics can be reset.